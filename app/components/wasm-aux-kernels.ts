@@ -0,0 +1,166 @@
+/**
+ * 보조 WASM 커널 지연 로더 (이미지 / 행렬 / FFT / 해시 / 물리 / ONNX 그래프 실행기)
+ * - 인식 코어(sign_wasm)와 분리된 모듈이라 첫 인식까지의 다운로드/인스턴스화에 포함되지 않음
+ * - 계열별로 처음 요청될 때 한 번만 스크립트를 넣고 인스턴스를 만든 뒤 Promise를 캐시
+ * - 빌드: cd cpp && make aux → build/aux/sign_<계열>.{js,wasm}를 public/wasm/에 복사
+ */
+
+const basePath = process.env.NEXT_PUBLIC_BASE_PATH || "";
+
+export type AuxKernelFamily = "image" | "matrix" | "fft" | "hash" | "physics" | "onnx";
+
+export interface AuxKernelModule {
+  _malloc: (size: number) => number;
+  _free: (ptr: number) => void;
+  HEAPU8: Uint8Array;
+  HEAP32: Int32Array;
+  HEAPU32: Uint32Array;
+  HEAPF32: Float32Array;
+
+  // 해당 계열 모듈에만 존재 (cpp/src/aux_kernels.h, Makefile AUX_EXPORT_<계열>)
+  _processImageData?: (imagePtr: number, width: number, height: number, filterType: number) => void;
+  _buildIntegralImage?: (imagePtr: number, width: number, height: number, tablePtr: number) => void;
+  _boxFilter?: (imagePtr: number, width: number, height: number, radius: number) => void;
+  _estimateHandRoi?: (imagePtr: number, previousPtr: number, width: number, height: number, step: number, boxPtr: number) => number;
+  _cropRegion?: (imagePtr: number, width: number, height: number, boxPtr: number, outPtr: number) => number;
+  _matrixMultiplyLarge?: (aPtr: number, bPtr: number, resultPtr: number, size: number) => void;
+  _computeFFT?: (realPtr: number, imagPtr: number, size: number) => void;
+  _sha256Hash?: (inputPtr: number, length: number, outputPtr: number) => void;
+  _simulateParticles?: (positionsPtr: number, velocitiesPtr: number, count: number, deltaTime: number) => void;
+
+  // ONNX 그래프 실행기 (onnx 모듈, session은 _onnxCreate가 돌려준 포인터, 문자열은 NUL 종료 힙 주소)
+  _onnxCreate?: () => number;
+  _onnxDestroy?: (session: number) => void;
+  _onnxLoad?: (session: number, modelPtr: number, modelSize: number, dataPtr: number, dataSize: number, maxBatch: number) => number;
+  _onnxError?: (session: number) => number;
+  _onnxInputBuffer?: (session: number) => number;
+  _onnxRun?: (session: number, batch: number) => number;
+  _onnxInputSize?: (session: number) => number;
+  _onnxInputStride?: (session: number) => number;
+  _onnxOutputSize?: (session: number) => number;
+  _onnxOutputStride?: (session: number) => number;
+  _onnxMaxBatch?: (session: number) => number;
+  _onnxDescribe?: (session: number) => number;
+
+  // 커널 튜닝 (image/matrix 모듈, param은 kernel_tuning::Param 번호)
+  _setKernelParameter?: (param: number, value: number) => number;
+  _getKernelParameter?: (param: number) => number;
+  _autotuneImageKernels?: (repeats: number, sweepPtr: number) => number;
+  _autotuneMatrixKernels?: (repeats: number, sweepPtr: number) => number;
+
+  // 메모리 계정 (모든 모듈, cpp/src/memory_accounting.h, tag는 memory_accounting::Tag 번호)
+  _allocateTagged?: (tag: number, bytes: number) => number;
+  _freeTagged?: (ptr: number) => void;
+  _getMemoryStat?: (tag: number, field: number) => number;
+  _setMemoryBudget?: (tag: number, bytes: number) => number;
+}
+
+// memory_accounting::Tag 순서 (마지막 "total"은 TAG_COUNT = 전체 합)
+export const MEMORY_TAGS = ["recognizer", "model", "temporal", "knn", "fft", "image", "matrix", "other", "total"] as const;
+const MEMORY_FIELDS = ["live", "peak", "allocations", "frees", "failures", "budget"] as const;
+
+/**
+ * 보조 모듈 힙의 태그별 사용량 (모듈마다 힙이 따로이므로 계정도 모듈별)
+ * - 큰 입출력 버퍼를 _allocateTagged(MEMORY_TAGS.indexOf("matrix"), bytes)로 잡으면 해당 태그에 집계
+ */
+export function readAuxMemory(module: AuxKernelModule): Record<string, Record<string, number>> | null {
+  if (!module._getMemoryStat) return null;
+  const report: Record<string, Record<string, number>> = {};
+  MEMORY_TAGS.forEach((tag, t) => {
+    report[tag] = {};
+    MEMORY_FIELDS.forEach((field, f) => (report[tag][field] = module._getMemoryStat!(t, f)));
+  });
+  return report;
+}
+
+/**
+ * onnx 모듈 힙의 NUL 종료 문자열 (_onnxError / _onnxDescribe 반환값)
+ */
+export function readAuxString(module: AuxKernelModule, ptr: number): string {
+  if (!ptr) return "";
+  let end = ptr;
+  while (module.HEAPU8[end] !== 0) end++;
+  return new TextDecoder().decode(module.HEAPU8.subarray(ptr, end));
+}
+
+// kernel_tuning::Param 순서와 같은 프로필 키
+const KERNEL_PARAM_KEYS = ["matvec.block", "gemm.block", "blur.tile", "mlp.batch"];
+
+/**
+ * 코어 모듈이 보관한 커널 튜닝 프로필(getKernelProfile / localStorage)을 보조 모듈에 적용
+ * - 첫 줄(형식/빌드 대상)은 코어 쪽 applyKernelProfile이 확인하므로 여기서는 "키 값" 줄만 읽음
+ */
+export function applyKernelProfileToAux(module: AuxKernelModule, profile: string): void {
+  if (!module._setKernelParameter) return;
+  for (const line of profile.split("\n").slice(1)) {
+    const [key, value] = line.trim().split(/\s+/);
+    const param = KERNEL_PARAM_KEYS.indexOf(key);
+    if (param >= 0 && value !== undefined) module._setKernelParameter(param, Number(value));
+  }
+}
+
+type AuxModuleFactory = (options?: { locateFile?: (path: string) => string }) => Promise<AuxKernelModule>;
+
+// Makefile의 AUX_NAME_<계열>과 같은 전역 팩토리 이름
+const FACTORY_NAMES: Record<AuxKernelFamily, string> = {
+  image: "CreateSignImageModule",
+  matrix: "CreateSignMatrixModule",
+  fft: "CreateSignFftModule",
+  hash: "CreateSignHashModule",
+  physics: "CreateSignPhysicsModule",
+  onnx: "CreateSignOnnxModule",
+};
+
+const loading = new Map<AuxKernelFamily, Promise<AuxKernelModule>>();
+
+function getFactory(family: AuxKernelFamily): AuxModuleFactory | undefined {
+  return (window as unknown as Record<string, AuxModuleFactory | undefined>)[FACTORY_NAMES[family]];
+}
+
+async function loadScript(src: string): Promise<void> {
+  const script = document.createElement("script");
+  script.src = src;
+  script.async = true;
+  await new Promise<void>((resolve, reject) => {
+    script.onload = () => resolve();
+    script.onerror = () => reject(new Error(`WASM script load failed: ${src}`));
+    document.head.appendChild(script);
+  });
+}
+
+async function instantiate(family: AuxKernelFamily): Promise<AuxKernelModule> {
+  if (typeof window === "undefined") throw new Error("aux kernels require a browser");
+  if (!getFactory(family)) await loadScript(`${basePath}/wasm/sign_${family}.js`);
+
+  const factory = getFactory(family);
+  if (!factory) throw new Error(`${FACTORY_NAMES[family]} is not defined`);
+  return factory({
+    locateFile: (path) => (path.endsWith(".wasm") ? `${basePath}/wasm/${path}` : path),
+  });
+}
+
+/**
+ * 보조 커널 모듈을 필요할 때 로드 (같은 계열은 한 번만 로드, 실패하면 다음 호출에서 다시 시도)
+ */
+export function loadAuxKernels(family: AuxKernelFamily): Promise<AuxKernelModule> {
+  let pending = loading.get(family);
+  if (!pending) {
+    pending = instantiate(family).catch((error) => {
+      loading.delete(family);
+      throw error;
+    });
+    loading.set(family, pending);
+  }
+  return pending;
+}
+
+/**
+ * 유휴 시간에 미리 로드 (다음 화면에서 쓸 계열을 알고 있을 때, 첫 인식과 경쟁하지 않도록)
+ */
+export function prefetchAuxKernels(families: AuxKernelFamily[]): void {
+  if (typeof window === "undefined") return;
+  const start = () => families.forEach((family) => void loadAuxKernels(family).catch(() => undefined));
+  const idle = (window as unknown as { requestIdleCallback?: (cb: () => void) => number }).requestIdleCallback;
+  if (idle) idle(start);
+  else setTimeout(start, 0);
+}
@@ -8,6 +8,9 @@ import { HandLandmark } from "./mediapipe-hand-detector";
 
 const basePath = process.env.NEXT_PUBLIC_BASE_PATH || "";
 
+// 시작 시 미리 확보할 힙 크기 (INITIAL_MEMORY 32MB 안에서 스테이징/인식 작업 공간 확보)
+const HEAP_RESERVE_BYTES = 16 * 1024 * 1024;
+
 const getWasmPath = (path: string) => {
   return `${basePath}${path}`;
 };
@@ -18,6 +21,15 @@ export interface RecognitionResult {
   id: number;
 }
 
+// 두 손 인식 결과 (손이 없으면 id 0, 신뢰도 0)
+export interface TwoHandRecognitionResult {
+  left: RecognitionResult;
+  right: RecognitionResult;
+  combined: RecognitionResult; // 같은 제스처면 신뢰도 상승, 다르면 신뢰도가 높은 손
+}
+
+type LandmarkPoints = { x: number; y: number; z: number }[];
+
 interface WasmModule {
   // C++ 클래스 생성자들
   SignRecognizer: new () => SignRecognizerInstance;
@@ -27,6 +39,9 @@ interface WasmModule {
   // Emscripten 필수 함수/속성
   _malloc: (size: number) => number;
   _free: (ptr: number) => void;
+  reserveHeap?: (bytes: number) => boolean;
+  getMemoryReport?: () => string;
+  setMemoryBudget?: (tag: string, bytes: number) => boolean;
 
   // 메모리 버퍼 접근용
   HEAPU8: Uint8Array;
@@ -48,6 +63,70 @@ interface SignRecognizerInstance {
   setDetectionThreshold: (threshold: number) => void;
   setRecognitionThreshold: (threshold: number) => void;
   getVersion: () => string;
+  getInputBuffer?: () => number;
+  getOutputBuffer?: () => number;
+  getMaxBatchFrames?: () => number;
+  recognizeStaged?: (frameCount: number) => number;
+  recognizeStagedTwoHands?: (frameCount: number) => number;
+  getGestureName?: (id: number) => string;
+  getStats?: () => Float64Array;
+  resetStats?: () => void;
+  setLandmarkFilter?: (mode: number) => void;
+  setFilterFrameRate?: (fps: number) => void;
+  resetLandmarkFilter?: () => void;
+  autotuneKernels?: (repeats: number) => string;
+  autotuneKernelStep?: (step: number, repeats: number) => number;
+  applyKernelProfile?: (profile: string) => boolean;
+  getKernelProfile?: () => string;
+}
+
+// 커널 튜닝 프로필 보관 키 (cpp/src/kernel_tuning.h, 기기마다 첫 실행에 한 번 측정)
+export const KERNEL_PROFILE_STORAGE_KEY = "sign-kernel-profile";
+const KERNEL_AUTOTUNE_REPEATS = 5;
+// 튜닝 한 단계(파라미터 하나)를 시작할 유휴 시간: 최소값과 직전 단계 소요 시간 중 큰 값
+// (브라우저 유휴 조각은 최대 50ms라 그 이상은 요구하지 않음)
+const KERNEL_AUTOTUNE_MIN_SLICE_MS = 10;
+const KERNEL_AUTOTUNE_MAX_SLICE_MS = 50;
+
+type IdleSlice = { timeRemaining: () => number; didTimeout: boolean };
+type IdleScheduler = (cb: (deadline: IdleSlice) => void, options?: { timeout: number }) => number;
+
+// 인식 앞단 랜드마크 지터 필터 (C++ LandmarkFilter::Mode와 같은 값)
+export enum LandmarkFilterMode {
+  Off = 0,
+  OneEuro = 1,
+  Kalman = 2,
+}
+
+// 단계별 계측 통계 (C++ PerfStats 스냅샷 레이아웃과 동일한 순서)
+const STATS_STAGE_NAMES = [
+  "recognize",
+  "featureExtraction",
+  "inference",
+  "ruleFallback",
+  "serialization",
+] as const;
+const STATS_HEADER_SIZE = 3;
+
+export interface StageStats {
+  calls: number;
+  totalUs: number;
+  meanUs: number;
+  minUs: number;
+  maxUs: number;
+  p50Us: number;
+  p99Us: number;
+  allocations: number;
+}
+
+// 서브시스템(태그)별 메모리 계정 (cpp/src/memory_accounting.h, 바이트/횟수)
+export interface MemoryTagStats {
+  live: number;
+  peak: number;
+  allocations: number;
+  frees: number;
+  failures: number;
+  budget: number; // 0: 무제한
 }
 
 // 딥러닝 인식기 (MLP)
@@ -70,6 +149,16 @@ declare global {
   }): Promise<WasmModule>;
 }
 
+// 두 손 조합 라벨 (C++ SignRecognizer::combineHands와 같은 규칙, 이전 빌드 폴백용)
+function combineHands(left: RecognitionResult, right: RecognitionResult): RecognitionResult {
+  if (left.id === 0) return right;
+  if (right.id === 0) return left;
+  if (left.id === right.id) {
+    return { ...right, confidence: 1 - (1 - left.confidence) * (1 - right.confidence) };
+  }
+  return left.confidence > right.confidence ? left : right;
+}
+
 export class WASMSignRecognizer {
   private wasmModule: WasmModule | null = null;
   private recognizer: SignRecognizerInstance | null = null; // Rule-based
@@ -80,6 +169,11 @@ export class WASMSignRecognizer {
   private memoryPool: number[] = [];
   private landmarkDataCache = new Float32Array(42); // 한 손(21개 * 2좌표) 캐시
 
+  // C++ 인스턴스가 소유한 고정 스테이징 버퍼 뷰 (초기화 시 한 번 생성)
+  private stagingInput: Float32Array | null = null;
+  private stagingOutput: Float32Array | null = null;
+  private gestureNames = new Map<number, string>();
+
   async initialize(): Promise<boolean> {
     try {
       if (typeof window === "undefined") return false;
@@ -115,13 +209,18 @@ export class WASMSignRecognizer {
 
       if (!this.wasmModule) throw new Error("Module is null");
 
+      // 힙을 미리 확보하여 핫패스에서 메모리 확장(뷰 분리)이 일어나지 않게 함
+      this.wasmModule.reserveHeap?.(HEAP_RESERVE_BYTES);
+
       // 3. 인스턴스 생성
       // (A) 규칙 기반
       if (this.wasmModule.SignRecognizer) {
         this.recognizer = new this.wasmModule.SignRecognizer();
+        this.applyKernelProfile();
         this.recognizer.initialize();
         this.recognizer.setDetectionThreshold(0.5);
         this.recognizer.setRecognitionThreshold(0.7);
+        this.bindStagingBuffers();
         console.log("✅ Rule-based Recognizer initialized");
       } else {
         console.error("❌ SignRecognizer class not found");
@@ -188,6 +287,11 @@ export class WASMSignRecognizer {
       return { gesture: "초기화 안됨", confidence: 0, id: 0 };
     }
 
+    // 고정 스테이징 버퍼가 있으면 할당/JSON 없는 경로 사용
+    if (this.stagingInput && this.stagingOutput) {
+      return this.recognizeStaged(landmarks);
+    }
+
     let ptr = 0;
 
     try {
@@ -255,6 +359,152 @@ export class WASMSignRecognizer {
     }
   }
 
+  // 보관한 커널 튜닝 프로필 적용, 없거나 다른 빌드의 프로필이면 유휴 시간에 다시 측정해 보관
+  private applyKernelProfile(): void {
+    const recognizer = this.recognizer;
+    if (!recognizer?.applyKernelProfile || !recognizer.autotuneKernels || !recognizer.getKernelProfile) return;
+    let stored: string | null = null;
+    try {
+      stored = window.localStorage.getItem(KERNEL_PROFILE_STORAGE_KEY);
+    } catch {
+      return; // 저장소를 쓸 수 없으면 기본값 유지
+    }
+    if (stored && recognizer.applyKernelProfile(stored)) return;
+
+    // 파라미터 하나씩 유휴 조각마다 측정 (한 번에 다 재면 메인 스레드를 수백 ms 막음)
+    const idle = (window as unknown as { requestIdleCallback?: IdleScheduler }).requestIdleCallback;
+    const schedule = (cb: (deadline: IdleSlice) => void) => {
+      if (idle) idle(cb);
+      else setTimeout(() => cb({ timeRemaining: () => KERNEL_AUTOTUNE_MAX_SLICE_MS, didTimeout: false }), 0);
+    };
+    let step = 0;
+    let needed = KERNEL_AUTOTUNE_MIN_SLICE_MS;
+    const tune = (deadline: IdleSlice) => {
+      if (this.recognizer !== recognizer) return; // 튜닝 도중 dispose됨
+      if (deadline.timeRemaining() < needed) {
+        schedule(tune); // 이번 조각은 짧음 → 다음 유휴 시간에
+        return;
+      }
+      try {
+        if (!recognizer.autotuneKernelStep) {
+          // 이전 빌드의 WASM 모듈: 단계 API가 없어 한 번에 측정
+          window.localStorage.setItem(KERNEL_PROFILE_STORAGE_KEY, recognizer.autotuneKernels!(KERNEL_AUTOTUNE_REPEATS));
+          return;
+        }
+        const started = performance.now();
+        if (recognizer.autotuneKernelStep(step, KERNEL_AUTOTUNE_REPEATS) >= 0) {
+          const elapsed = performance.now() - started;
+          needed = Math.min(KERNEL_AUTOTUNE_MAX_SLICE_MS, Math.max(KERNEL_AUTOTUNE_MIN_SLICE_MS, elapsed));
+          step++;
+          schedule(tune);
+          return;
+        }
+        // 모든 단계 완료 → 적용된 값을 프로필로 보관
+        window.localStorage.setItem(KERNEL_PROFILE_STORAGE_KEY, recognizer.getKernelProfile!());
+      } catch (e) {
+        console.warn("Kernel autotune failed:", e);
+      }
+    };
+    schedule(tune);
+  }
+
+  // 고정 스테이징 버퍼 뷰 생성 (reserveHeap 이후 한 번만)
+  private bindStagingBuffers(): void {
+    const recognizer = this.recognizer;
+    const module = this.wasmModule;
+    if (!recognizer?.getInputBuffer || !recognizer.getOutputBuffer || !module?.HEAPU8) {
+      return; // 이전 빌드의 WASM 모듈: 기존 _malloc 경로 사용
+    }
+    const maxFrames = recognizer.getMaxBatchFrames?.() ?? 1;
+    const buffer = module.HEAPU8.buffer as ArrayBuffer;
+    this.stagingInput = new Float32Array(
+      buffer,
+      recognizer.getInputBuffer(),
+      maxFrames * 42
+    );
+    this.stagingOutput = new Float32Array(
+      buffer,
+      recognizer.getOutputBuffer(),
+      maxFrames * 2
+    );
+  }
+
+  /**
+   * 두 손 동시 인식: 두 번의 recognizeFast 대신 C++에서 두 손을 한 패스로 처리
+   * - 손이 없으면 null/빈 배열 (스테이징 버퍼에는 좌표 0으로 기록 → 손 없음)
+   * - 이전 빌드의 WASM 모듈이면 손마다 recognizeFast로 처리하고 조합만 여기서 계산
+   */
+  async recognizeTwoHands(
+    left: LandmarkPoints | null,
+    right: LandmarkPoints | null
+  ): Promise<TwoHandRecognitionResult> {
+    const none: RecognitionResult = { gesture: "감지되지 않음", confidence: 0, id: 0 };
+    const recognizer = this.recognizer;
+    if (!this.isInitialized || !recognizer) {
+      return { left: none, right: none, combined: none };
+    }
+
+    if (!recognizer.recognizeStagedTwoHands || !this.stagingInput || !this.stagingOutput) {
+      const leftResult = left?.length ? await this.recognizeFast(left) : none;
+      const rightResult = right?.length ? await this.recognizeFast(right) : none;
+      return { left: leftResult, right: rightResult, combined: combineHands(leftResult, rightResult) };
+    }
+
+    if (this.stagingInput.byteLength === 0) this.bindStagingBuffers();
+    const input = this.stagingInput!;
+    const output = this.stagingOutput!;
+    const hands = [left, right];
+    for (let h = 0; h < 2; h++) {
+      const hand = hands[h];
+      const base = h * 42;
+      for (let i = 0; i < 21; i++) {
+        const lm = hand?.[i];
+        input[base + i * 2] = lm ? lm.x : 0;
+        input[base + i * 2 + 1] = lm ? lm.y : 0;
+      }
+    }
+
+    recognizer.recognizeStagedTwoHands(1);
+
+    return {
+      left: this.readStagedResult(output, 0),
+      right: this.readStagedResult(output, 2),
+      combined: this.readStagedResult(output, 4),
+    };
+  }
+
+  // 출력 스테이징 버퍼의 [id, confidence] 쌍 → 결과 (제스처 이름은 캐시)
+  private readStagedResult(output: Float32Array, offset: number): RecognitionResult {
+    const id = output[offset];
+    let gesture = this.gestureNames.get(id);
+    if (gesture === undefined) {
+      gesture = this.recognizer?.getGestureName?.(id) ?? String(id);
+      this.gestureNames.set(id, gesture);
+    }
+    return { gesture, confidence: output[offset + 1], id };
+  }
+
+  private recognizeStaged(
+    landmarks: { x: number; y: number; z: number }[]
+  ): RecognitionResult {
+    const recognizer = this.recognizer!;
+
+    // 예외적으로 메모리가 확장되어 뷰가 분리되었으면 다시 생성
+    if (this.stagingInput!.byteLength === 0) this.bindStagingBuffers();
+    const input = this.stagingInput!;
+    const output = this.stagingOutput!;
+
+    for (let i = 0; i < 21; i++) {
+      const lm = landmarks[i];
+      input[i * 2] = lm ? lm.x : 0;
+      input[i * 2 + 1] = lm ? lm.y : 0;
+    }
+
+    recognizer.recognizeStaged!(1);
+
+    return this.readStagedResult(output, 0);
+  }
+
   // ============================================================
   // 2. 딥러닝 인식 (MLP) - [기존 로직 100% 이식]
   // ============================================================
@@ -376,6 +626,65 @@ export class WASMSignRecognizer {
     }));
   }
 
+  // ============================================================
+  // 3. 핫패스 계측 통계 (STATS=1 빌드에서만 값이 쌓임)
+  // ============================================================
+  public getStats(): Record<string, StageStats> | null {
+    if (!this.recognizer?.getStats) return null;
+
+    // WASM 힙을 가리키는 뷰이므로 즉시 복사
+    const flat = this.recognizer.getStats().slice();
+    if (flat[0] !== 1) return null; // 계측이 빌드에 포함되지 않음
+
+    const fieldsPerStage = flat[2];
+    const stats: Record<string, StageStats> = {};
+    STATS_STAGE_NAMES.forEach((name, i) => {
+      const o = STATS_HEADER_SIZE + i * fieldsPerStage;
+      stats[name] = {
+        calls: flat[o],
+        totalUs: flat[o + 1],
+        meanUs: flat[o + 2],
+        minUs: flat[o + 3],
+        maxUs: flat[o + 4],
+        p50Us: flat[o + 5],
+        p99Us: flat[o + 6],
+        allocations: flat[o + 7],
+      };
+    });
+    return stats;
+  }
+
+  public resetStats(): void {
+    this.recognizer?.resetStats?.();
+  }
+
+  /**
+   * 서브시스템별 힙 사용량 (recognizer, model, temporal, knn, fft, image, matrix, other, total)
+   * - peak으로 INITIAL_MEMORY를 산정, 세션 종료 후 live가 남으면 누수
+   */
+  public getMemoryReport(): Record<string, MemoryTagStats> | null {
+    const report = this.wasmModule?.getMemoryReport?.();
+    return report ? (JSON.parse(report) as Record<string, MemoryTagStats>) : null;
+  }
+
+  // 태그별 하드 예산 (넘는 할당은 실패, 0이면 무제한)
+  public setMemoryBudget(tag: string, bytes: number): boolean {
+    return this.wasmModule?.setMemoryBudget?.(tag, bytes) ?? false;
+  }
+
+  /**
+   * 인식 앞단 지터 필터 설정 (연속 프레임을 같은 손으로 간주해 평활화)
+   * - 손을 놓쳤다가 다시 잡으면 resetLandmarkFilter()로 상태를 비워야 함
+   */
+  public setLandmarkFilter(mode: LandmarkFilterMode, fps: number = 30): void {
+    this.recognizer?.setFilterFrameRate?.(fps);
+    this.recognizer?.setLandmarkFilter?.(mode);
+  }
+
+  public resetLandmarkFilter(): void {
+    this.recognizer?.resetLandmarkFilter?.();
+  }
+
   dispose() {
     if (this.wasmModule) {
       this.memoryPool.forEach((ptr) => {
@@ -385,6 +694,8 @@ export class WASMSignRecognizer {
       });
     }
     this.memoryPool = [];
+    this.stagingInput = null;
+    this.stagingOutput = null;
     this.recognizer = null;
     this.mlpRecognizer = null;
     this.wasmModule = null;
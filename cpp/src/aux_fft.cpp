@@ -0,0 +1,58 @@
+#include "aux_kernels.h"
+#include <cmath>  // cos, sin
+#include <utility>  // std::swap
+
+#ifndef M_PI  // M_PI가 정의되지 않았으면
+#define M_PI 3.14159265358979323846  // 원주율 상수 정의
+#endif
+
+// 3. 단순 FFT 구현 (재귀적)
+void computeFFT(float* realPart, float* imagPart, int size) {
+    if (size <= 1) return;
+    
+    // 비트 역순 정렬
+    for (int i = 1, j = 0; i < size; i++) {
+        int bit = size >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        
+        if (i < j) {
+            std::swap(realPart[i], realPart[j]);
+            std::swap(imagPart[i], imagPart[j]);
+        }
+    }
+    
+    // FFT 계산
+    for (int len = 2; len <= size; len <<= 1) {
+        double ang = -2 * M_PI / len;
+        double wlen_r = cos(ang);
+        double wlen_i = sin(ang);
+        
+        for (int i = 0; i < size; i += len) {
+            double w_r = 1;
+            double w_i = 0;
+            
+            for (int j = 0; j < len / 2; j++) {
+                int u = i + j;
+                int v = i + j + len / 2;
+                
+                double u_r = realPart[u];
+                double u_i = imagPart[u];
+                double v_r = realPart[v] * w_r - imagPart[v] * w_i;
+                double v_i = realPart[v] * w_i + imagPart[v] * w_r;
+                
+                realPart[u] = u_r + v_r;
+                imagPart[u] = u_i + v_i;
+                realPart[v] = u_r - v_r;
+                imagPart[v] = u_i - v_i;
+                
+                double next_w_r = w_r * wlen_r - w_i * wlen_i;
+                double next_w_i = w_r * wlen_i + w_i * wlen_r;
+                w_r = next_w_r;
+                w_i = next_w_i;
+            }
+        }
+    }
+}
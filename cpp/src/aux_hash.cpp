@@ -0,0 +1,33 @@
+#include "aux_kernels.h"
+
+// 4. SHA-256 해시 (간단 버전)
+void sha256Hash(uint8_t* input, int length, uint8_t* output) {
+    // SHA-256 상수들
+    const uint32_t K[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+        0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        // ... (전체 64개 상수는 생략)
+    };
+    
+    // 초기 해시값
+    uint32_t H[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+    
+    // 간단한 해시 시뮬레이션 (실제 SHA-256은 더 복잡)
+    for (int i = 0; i < length; i++) {
+        uint32_t data = input[i];
+        for (int j = 0; j < 8; j++) {
+            H[j] = (H[j] + data * K[i % 64]) ^ (H[j] << 7) ^ (H[j] >> 11);
+        }
+    }
+    
+    // 결과를 바이트 배열로 변환
+    for (int i = 0; i < 8; i++) {
+        output[i * 4] = (H[i] >> 24) & 0xFF;
+        output[i * 4 + 1] = (H[i] >> 16) & 0xFF;
+        output[i * 4 + 2] = (H[i] >> 8) & 0xFF;
+        output[i * 4 + 3] = H[i] & 0xFF;
+    }
+}
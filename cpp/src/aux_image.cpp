@@ -0,0 +1,322 @@
+#include "aux_kernels.h"
+#include "memory_accounting.h"  // 임시 버퍼/적분 영상은 IMAGE 태그 (예산 초과 시 필터를 건너뜀)
+#include <immintrin.h>  // SSE4.1/AVX2 (적분 영상 누적합, 피부색 마스크)
+#include <algorithm>  // std::min, std::max
+#include <cstdlib>  // std::abs
+#include <cstring>  // std::memcpy, std::memset
+#include <memory_resource>
+#include <vector>
+
+namespace {
+// 피부색 범위 (BT.601 YCbCr, 정수 근사)
+constexpr int SKIN_CB_MIN = 77, SKIN_CB_MAX = 127;
+constexpr int SKIN_CR_MIN = 133, SKIN_CR_MAX = 173;
+constexpr int MOTION_THRESHOLD = 20;  // 이전 프레임과의 밝기 차 (0~255)
+constexpr int ROI_TRIM_PERCENT = 2;   // 마스크 질량 양끝 2%는 잡음으로 보고 제외
+constexpr int ROI_MARGIN_PERCENT = 15;  // 상자 크기 대비 여유
+
+// 적분 영상 버퍼 (boxFilter 호출마다 재할당하지 않도록 재사용)
+// 영상이 1/4 미만으로 작아지면 줄여 다시 할당하고, RETAIN_BYTES를 넘는 버퍼는 호출이 끝나면 바로 해제해
+// 스레드 수명 동안 가장 큰 영상 크기를 붙잡고 있지 않는다 (보유량은 IMAGE 예산에 계상)
+struct IntegralScratch {
+    static constexpr size_t RETAIN_BYTES = size_t(16) << 20;  // 720p 적분 영상(~14.8MB)까지 보유
+    uint32_t* data = nullptr;
+    size_t bytes = 0;
+    ~IntegralScratch() { release(); }
+    // count개 이상 확보 (실패하면 nullptr, 기존 버퍼는 해제)
+    uint32_t* reserve(size_t count) {
+        const size_t needed = count * sizeof(uint32_t);
+        if (needed <= bytes && needed >= bytes / 4) return data;
+        release();
+        data = static_cast<uint32_t*>(memory_accounting::allocate(memory_accounting::IMAGE, needed));
+        bytes = data ? needed : 0;
+        return data;
+    }
+    void release() {
+        memory_accounting::deallocate(memory_accounting::IMAGE, data, bytes);
+        data = nullptr;
+        bytes = 0;
+    }
+    // 호출 끝: 보유 한도를 넘는 버퍼는 돌려준다
+    void trim() {
+        if (bytes > RETAIN_BYTES) release();
+    }
+};
+thread_local IntegralScratch integralScratch;
+
+std::pmr::memory_resource* imageMemory() {
+    return memory_accounting::resource(memory_accounting::IMAGE);
+}
+
+// RGBA 8픽셀 → R, G, B epi32
+inline void splitRgb(const uint8_t* p, __m256i& r, __m256i& g, __m256i& b) {
+    const __m256i px = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    const __m256i lo = _mm256_set1_epi32(0xFF);
+    r = _mm256_and_si256(px, lo);
+    g = _mm256_and_si256(_mm256_srli_epi32(px, 8), lo);
+    b = _mm256_and_si256(_mm256_srli_epi32(px, 16), lo);
+}
+
+inline __m256i luma(__m256i r, __m256i g, __m256i b) {
+    __m256i y = _mm256_add_epi32(_mm256_mullo_epi32(r, _mm256_set1_epi32(77)), _mm256_mullo_epi32(g, _mm256_set1_epi32(150)));
+    return _mm256_srai_epi32(_mm256_add_epi32(y, _mm256_mullo_epi32(b, _mm256_set1_epi32(29))), 8);
+}
+
+inline __m256i inRange(__m256i v, int lo, int hi) {
+    return _mm256_andnot_si256(_mm256_or_si256(_mm256_cmpgt_epi32(_mm256_set1_epi32(lo), v), _mm256_cmpgt_epi32(v, _mm256_set1_epi32(hi))),
+                               _mm256_set1_epi32(-1));
+}
+
+inline bool isSkin(int r, int g, int b) {
+    int cb = 128 + ((-43 * r - 85 * g + 128 * b) >> 8);
+    int cr = 128 + ((128 * r - 107 * g - 21 * b) >> 8);
+    return cb >= SKIN_CB_MIN && cb <= SKIN_CB_MAX && cr >= SKIN_CR_MIN && cr <= SKIN_CR_MAX;
+}
+
+inline int lumaScalar(const uint8_t* p) {
+    return (77 * p[0] + 150 * p[1] + 29 * p[2]) >> 8;
+}
+
+// 히스토그램 질량의 trim% ~ (100 - trim)% 구간 [lo, hi)
+void massBounds(const std::pmr::vector<int>& hist, int total, int& lo, int& hi) {
+    const long long cut = static_cast<long long>(total) * ROI_TRIM_PERCENT / 100;
+    long long acc = 0;
+    lo = 0;
+    while (lo < static_cast<int>(hist.size()) - 1 && (acc += hist[lo]) <= cut) lo++;
+    acc = 0;
+    hi = static_cast<int>(hist.size());
+    while (hi > lo + 1 && (acc += hist[hi - 1]) <= cut) hi--;
+}
+}  // namespace
+
+// 1. 이미지 가우시안 블러 (CPU 집약적)
+void processImageData(uint8_t* imageData, int width, int height, int filterType) {
+    if (filterType == 1) {  // 5x5 박스 블러 (적분 영상)
+        boxFilter(imageData, width, height, 2);
+        return;
+    }
+    if (filterType == 0) { // Gaussian Blur
+        const int kernelSize = 5;
+        const float kernel[25] = {
+            1, 4, 6, 4, 1,
+            4, 16, 24, 16, 4,
+            6, 24, 36, 24, 6,
+            4, 16, 24, 16, 4,
+            1, 4, 6, 4, 1
+        };
+        const float kernelSum = 256.0f;
+        
+        const size_t bytes = static_cast<size_t>(width) * height * 4;
+        uint8_t* temp = static_cast<uint8_t*>(memory_accounting::allocate(memory_accounting::IMAGE, bytes));
+        if (!temp) return;  // 메모리 부족 또는 IMAGE 예산 초과: 원본 유지
+        std::memset(temp, 0, bytes);  // 가장자리 2픽셀은 0 (기존 동작)
+        
+        // 열 타일 폭 (blur.tile, 0은 행 전체): 타일 안에서 위아래로 내려가며 5행 창을 캐시에 유지
+        const int tile = kernel_tuning::get(kernel_tuning::BLUR_TILE);
+        const int tileWidth = tile > 0 ? tile : width;
+        
+        // 가우시안 블러 적용 (RGBA 채널별로)
+        for (int x0 = 2; x0 < width - 2; x0 += tileWidth) {
+            const int x1 = std::min(x0 + tileWidth, width - 2);
+            for (int y = 2; y < height - 2; y++) {
+                for (int x = x0; x < x1; x++) {
+                    for (int channel = 0; channel < 4; channel++) {
+                        float sum = 0;
+                        
+                        for (int ky = 0; ky < kernelSize; ky++) {
+                            for (int kx = 0; kx < kernelSize; kx++) {
+                                int pixelY = y + ky - 2;
+                                int pixelX = x + kx - 2;
+                                int pixelIndex = (pixelY * width + pixelX) * 4 + channel;
+                                sum += imageData[pixelIndex] * kernel[ky * kernelSize + kx];
+                            }
+                        }
+                        
+                        temp[(y * width + x) * 4 + channel] = (uint8_t)(sum / kernelSum);
+                    }
+                }
+            }
+        }
+        
+        // 결과 복사
+        std::memcpy(imageData, temp, bytes);
+        memory_accounting::deallocate(memory_accounting::IMAGE, temp, bytes);
+    }
+}
+
+// 적분 영상: 행마다 누적합 레지스터(픽셀 2개 x RGBA)를 들고 윗행 값을 더함
+void buildIntegralImage(const uint8_t* imageData, int width, int height, uint32_t* table) {
+    const size_t stride = (static_cast<size_t>(width) + 1) * 4;
+    std::memset(table, 0, stride * sizeof(uint32_t));  // 0행
+    for (int y = 0; y < height; y++) {
+        const uint8_t* src = imageData + static_cast<size_t>(y) * width * 4;
+        const uint32_t* up = table + static_cast<size_t>(y) * stride + 4;
+        uint32_t* row = table + static_cast<size_t>(y + 1) * stride;
+        std::memset(row, 0, 4 * sizeof(uint32_t));  // 0열
+        row += 4;
+        __m256i run = _mm256_setzero_si256();  // 양쪽 128비트 모두 직전 픽셀까지의 행 누적합
+        int x = 0;
+        for (; x + 2 <= width; x += 2) {
+            __m128i two;
+            std::memcpy(&two, src + x * 4, 8);  // 8바이트만 읽음 (행 끝을 넘지 않음)
+            __m256i px = _mm256_cvtepu8_epi32(two);
+            // [p0, p1] → [p0, p0 + p1]: 아래 128비트를 위로 올려 더함
+            px = _mm256_add_epi32(px, _mm256_permute2x128_si256(px, px, 0x08));
+            __m256i sum = _mm256_add_epi32(run, px);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + x * 4),
+                                _mm256_add_epi32(sum, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(up + x * 4))));
+            run = _mm256_permute2x128_si256(sum, sum, 0x11);  // 위 128비트(p1까지 합)를 양쪽에
+        }
+        if (x < width) {
+            int32_t packed;
+            std::memcpy(&packed, src + x * 4, 4);
+            __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(run), _mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(row + x * 4),
+                             _mm_add_epi32(sum, _mm_loadu_si128(reinterpret_cast<const __m128i*>(up + x * 4))));
+        }
+    }
+}
+
+// 픽셀마다 적분 영상 4점 조회로 (2r+1)^2 창 평균 (경계는 영상 안쪽만 평균)
+void boxFilter(uint8_t* imageData, int width, int height, int radius) {
+    if (radius <= 0 || width <= 0 || height <= 0) return;
+    const size_t stride = (static_cast<size_t>(width) + 1) * 4;
+    uint32_t* table = integralScratch.reserve(stride * (height + 1));
+    if (!table) return;  // 메모리 부족 또는 IMAGE 예산 초과: 원본 유지
+    buildIntegralImage(imageData, width, height, table);
+
+    for (int y = 0; y < height; y++) {
+        const int y0 = std::max(0, y - radius), y1 = std::min(height, y + radius + 1);
+        const uint32_t* top = table + static_cast<size_t>(y0) * stride;
+        const uint32_t* bottom = table + static_cast<size_t>(y1) * stride;
+        uint8_t* dst = imageData + static_cast<size_t>(y) * width * 4;
+        for (int x = 0; x < width; x++) {
+            const int x0 = std::max(0, x - radius), x1 = std::min(width, x + radius + 1);
+            auto at = [](const uint32_t* row, int col) {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + col * 4));
+            };
+            // 부호 없는 32비트 순환 덧셈이라 누적합이 넘쳐도 창 합은 정확 (창 합 < 2^31)
+            __m128i sum = _mm_sub_epi32(_mm_add_epi32(at(bottom, x1), at(top, x0)), _mm_add_epi32(at(bottom, x0), at(top, x1)));
+            const __m128 inv = _mm_set1_ps(1.0f / ((x1 - x0) * (y1 - y0)));
+            __m128i avg = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(sum), inv));
+            avg = _mm_packus_epi16(_mm_packus_epi32(avg, avg), avg);
+            int32_t packed = _mm_cvtsi128_si32(avg);
+            std::memcpy(dst + x * 4, &packed, 4);
+        }
+    }
+    integralScratch.trim();
+}
+
+// 피부색(+움직임) 마스크의 행/열 히스토그램에서 양끝을 잘라낸 경계 상자
+int estimateHandRoi(const uint8_t* imageData, const uint8_t* previous, int width, int height, int step, int* box) {
+    if (!imageData || !box || width <= 0 || height <= 0) return 0;
+    step = std::max(1, step);
+    // 히스토그램 (피부색 열/행 + 움직임 열/행)이 IMAGE 예산을 넘으면 손 없음으로 처리
+    const size_t histogramBytes = static_cast<size_t>(width + height) * sizeof(int) * (previous ? 2 : 1);
+    if (!memory_accounting::fitsBudget(memory_accounting::IMAGE, histogramBytes)) return 0;
+    std::pmr::vector<int> skinCols(width, 0, imageMemory()), skinRows(height, 0, imageMemory());
+    std::pmr::vector<int> motionCols(imageMemory()), motionRows(imageMemory());
+    if (previous) {
+        motionCols.assign(width, 0);
+        motionRows.assign(height, 0);
+    }
+    int skinTotal = 0, motionTotal = 0, sampled = 0;
+
+    for (int y = 0; y < height; y += step) {
+        const uint8_t* row = imageData + static_cast<size_t>(y) * width * 4;
+        const uint8_t* prev = previous ? previous + static_cast<size_t>(y) * width * 4 : nullptr;
+        int x = 0;
+        for (; x + 8 <= width; x += 8) {
+            __m256i r, g, b;
+            splitRgb(row + x * 4, r, g, b);
+            __m256i cb = _mm256_add_epi32(_mm256_set1_epi32(128), _mm256_srai_epi32(
+                _mm256_add_epi32(_mm256_sub_epi32(_mm256_mullo_epi32(b, _mm256_set1_epi32(128)), _mm256_mullo_epi32(r, _mm256_set1_epi32(43))),
+                                 _mm256_mullo_epi32(g, _mm256_set1_epi32(-85))), 8));
+            __m256i cr = _mm256_add_epi32(_mm256_set1_epi32(128), _mm256_srai_epi32(
+                _mm256_sub_epi32(_mm256_sub_epi32(_mm256_mullo_epi32(r, _mm256_set1_epi32(128)), _mm256_mullo_epi32(g, _mm256_set1_epi32(107))),
+                                 _mm256_mullo_epi32(b, _mm256_set1_epi32(21))), 8));
+            __m256i skin = _mm256_and_si256(inRange(cb, SKIN_CB_MIN, SKIN_CB_MAX), inRange(cr, SKIN_CR_MIN, SKIN_CR_MAX));
+            int skinBits = _mm256_movemask_ps(_mm256_castsi256_ps(skin));
+            int motionBits = 0;
+            if (prev && skinBits) {
+                __m256i pr, pg, pb;
+                splitRgb(prev + x * 4, pr, pg, pb);
+                __m256i diff = _mm256_abs_epi32(_mm256_sub_epi32(luma(r, g, b), luma(pr, pg, pb)));
+                motionBits = skinBits & _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(diff, _mm256_set1_epi32(MOTION_THRESHOLD))));
+            }
+            for (int bits = skinBits; bits; bits &= bits - 1) skinCols[x + __builtin_ctz(bits)]++;
+            for (int bits = motionBits; bits; bits &= bits - 1) motionCols[x + __builtin_ctz(bits)]++;
+            skinRows[y] += __builtin_popcount(skinBits);
+            if (prev) motionRows[y] += __builtin_popcount(motionBits);
+        }
+        for (; x < width; x++) {
+            const uint8_t* p = row + x * 4;
+            if (!isSkin(p[0], p[1], p[2])) continue;
+            skinCols[x]++;
+            skinRows[y]++;
+            if (prev && std::abs(lumaScalar(p) - lumaScalar(prev + x * 4)) > MOTION_THRESHOLD) {
+                motionCols[x]++;
+                motionRows[y]++;
+            }
+        }
+        sampled += width;
+    }
+    for (int y = 0; y < height; y++) {
+        skinTotal += skinRows[y];
+        if (previous) motionTotal += motionRows[y];
+    }
+
+    // 움직이는 피부 픽셀이 충분하면 그것만 사용 (얼굴처럼 정지한 피부색 영역 제외), 아니면 피부색만
+    const int minPixels = std::max(16, sampled / 500);
+    const bool useMotion = previous && motionTotal >= minPixels;
+    const std::pmr::vector<int>& cols = useMotion ? motionCols : skinCols;
+    const std::pmr::vector<int>& rows = useMotion ? motionRows : skinRows;
+    const int total = useMotion ? motionTotal : skinTotal;
+    if (total < minPixels) return 0;
+
+    int x0, x1, y0, y1;
+    massBounds(cols, total, x0, x1);
+    massBounds(rows, total, y0, y1);
+    const int mx = (x1 - x0) * ROI_MARGIN_PERCENT / 100 + step, my = (y1 - y0) * ROI_MARGIN_PERCENT / 100 + step;
+    x0 = std::max(0, x0 - mx);
+    y0 = std::max(0, y0 - my);
+    x1 = std::min(width, x1 + mx);
+    y1 = std::min(height, y1 + my);
+    box[0] = x0;
+    box[1] = y0;
+    box[2] = x1 - x0;
+    box[3] = y1 - y0;
+    return total;
+}
+
+int cropRegion(const uint8_t* imageData, int width, int height, const int* box, uint8_t* out) {
+    if (!imageData || !box || !out) return 0;
+    const int x = box[0], y = box[1], w = box[2], h = box[3];
+    if (x < 0 || y < 0 || w <= 0 || h <= 0 || x + w > width || y + h > height) return 0;
+    for (int row = 0; row < h; row++) {
+        std::memcpy(out + static_cast<size_t>(row) * w * 4, imageData + (static_cast<size_t>(y + row) * width + x) * 4,
+                    static_cast<size_t>(w) * 4);
+    }
+    return w * h;
+}
+
+// blur.tile 자동 튜닝 (640 x 480 RGBA 가우시안, 열 타일 폭별 시간)
+int autotuneImageKernels(int repeats, kernel_tuning::Sweep* sweep) {
+    struct Workload {
+        std::vector<uint8_t> source, image;
+        int width, height;
+    } work;
+    work.width = 640;
+    work.height = 480;
+    work.source.resize(static_cast<size_t>(work.width) * work.height * 4);
+    uint32_t seed = 7;
+    for (uint8_t& v : work.source) {
+        seed = seed * 1664525u + 1013904223u;
+        v = static_cast<uint8_t>(seed >> 24);
+    }
+    return kernel_tuning::autotune(kernel_tuning::BLUR_TILE, [](void* context) {
+        Workload* w = static_cast<Workload*>(context);
+        w->image = w->source;  // 제자리 필터이므로 매번 같은 입력에서 시작
+        processImageData(w->image.data(), w->width, w->height, 0);
+    }, &work, repeats, sweep);
+}
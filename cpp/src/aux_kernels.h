@@ -0,0 +1,81 @@
+#ifndef AUX_KERNELS_H
+#define AUX_KERNELS_H
+
+#include <cstdint>
+#include "kernel_tuning.h"
+#include "memory_accounting.h"  // allocateTagged / freeTagged / getMemoryStat / setMemoryBudget (모든 모듈)
+
+/**
+ * 보조 커널 (인식과 무관한 이미지/행렬/FFT/해시/물리 연산, ONNX 그래프 실행기)
+ *
+ * - 인식 코어(sign_wasm)에서 분리되어 계열마다 별도 WASM 모듈로 빌드됨 (make aux)
+ *   aux_image.cpp → build/aux/sign_image.{js,wasm} (CreateSignImageModule) 등
+ * - 페이지가 해당 기능을 쓸 때만 wasm-aux-kernels.ts의 loadAuxKernels()로 로드
+ * - C 링키지: 각 모듈이 _processImageData처럼 그대로 내보내고, 네이티브 도구는 직접 링크 가능
+ * - 포인터 인자는 해당 모듈 인스턴스의 힙(_malloc) 주소
+ *   큰 입출력 버퍼는 _allocateTagged(태그, 바이트)로 잡으면 모듈의 태그별 사용량/예산에 포함됨
+ *   (예: 행렬은 MATRIX, 이미지는 IMAGE, 해제는 _freeTagged)
+ */
+extern "C" {
+
+// 1. 이미지 필터링 (filterType 0: 5x5 가우시안 블러(열 타일 폭 kernel_tuning blur.tile), 1: 5x5 박스 블러(적분 영상), RGBA)
+void processImageData(uint8_t* imageData, int width, int height, int filterType);
+
+// 적분 영상(합 영역 테이블): table은 (width + 1) x (height + 1) x 4 (RGBA 채널 교차, 0행/0열은 0)
+// - 값은 부호 없는 32비트 순환 누적이라 넘쳐도 창 합(4점 차)은 창 합 < 2^32이면 정확
+void buildIntegralImage(const uint8_t* imageData, int width, int height, uint32_t* table);
+
+// 반지름 radius 박스 블러 (픽셀당 O(1), 경계는 영상 안쪽 픽셀만 평균, 제자리)
+void boxFilter(uint8_t* imageData, int width, int height, int radius);
+
+// 손 ROI 추정: 피부색(YCbCr) 마스크, previous(이전 프레임, 없으면 nullptr)가 있으면 움직임 마스크와 결합
+// - step 행마다 표본 추출, box[4] = {x, y, w, h}에 여유를 둔 경계 상자 기록
+// - 반환: 상자 계산에 쓴 마스크 픽셀 수 (0이면 손 없음 또는 히스토그램이 IMAGE 예산 초과, box는 그대로)
+int estimateHandRoi(const uint8_t* imageData, const uint8_t* previous, int width, int height, int step, int* box);
+
+// box 영역을 out(w x h x 4)으로 복사, 반환: 픽셀 수 (상자가 영상 밖이면 0)
+int cropRegion(const uint8_t* imageData, int width, int height, const int* box, uint8_t* out);
+
+// 2. 대용량 행렬 곱셈 (size x size, 캐시 블록 분할, 블록 크기는 kernel_tuning gemm.block)
+void matrixMultiplyLarge(float* matA, float* matB, float* result, int size);
+
+// 3. 제자리 복소 FFT (size는 2의 거듭제곱)
+void computeFFT(float* realPart, float* imagPart, int size);
+
+// 4. 해시 (32바이트 출력)
+void sha256Hash(uint8_t* input, int length, uint8_t* output);
+
+// 5. 파티클 물리 시뮬레이션 (positions/velocities: particleCount x 3)
+void simulateParticles(float* positions, float* velocities, int particleCount, float deltaTime);
+
+// 6. 커널 튜닝 (kernel_tuning.h, image/matrix 모듈에 포함)
+// - autotune*: 후보 블록/타일 크기를 재서 가장 빠른 값을 적용하고 반환 (sweep은 네이티브 보고용, JavaScript는 0)
+//   작업 버퍼가 태그 예산(MATRIX/IMAGE)을 넘으면 튜닝하지 않고 0
+// - set/getKernelParameter: 브라우저가 보관한 튜닝 값을 모듈 로드 직후 적용 (param은 kernel_tuning::Param 번호)
+int autotuneMatrixKernels(int repeats, kernel_tuning::Sweep* sweep);
+int autotuneImageKernels(int repeats, kernel_tuning::Sweep* sweep);
+int setKernelParameter(int param, int value);  // 1: 적용, 0: 알 수 없는 파라미터/범위 밖
+int getKernelParameter(int param);  // 알 수 없는 파라미터는 -1
+
+// 7. ONNX 그래프 실행기 (onnx 모듈, onnx_executor.h의 OnnxModel을 C 링키지로 감쌈)
+// - 사용: onnxCreate → fetch한 모델(+외부 데이터) 바이트를 _malloc 버퍼에 복사해 onnxLoad
+//   → onnxInputBuffer에 batch행 기록 → onnxRun(batch)의 출력 [batch][onnxOutputStride] 읽기 → onnxDestroy
+// - 로드 시 융합/정적 메모리 계획을 마치므로 onnxRun은 힙 할당 없음
+// - 문자열(onnxError, onnxDescribe)은 세션이 소유한 NUL 종료 문자열 (다음 onnxLoad/onnxDescribe 전까지 유효)
+struct OnnxSession;
+OnnxSession* onnxCreate();
+void onnxDestroy(OnnxSession* session);
+int onnxLoad(OnnxSession* session, const uint8_t* model, int modelSize, const uint8_t* data, int dataSize, int maxBatch);  // 1: 성공
+const char* onnxError(OnnxSession* session);  // 마지막 onnxLoad 실패 사유
+float* onnxInputBuffer(OnnxSession* session);  // 입력 [maxBatch][inputStride] (로드 후 불변, 미로드면 0)
+const float* onnxRun(OnnxSession* session, int batch);  // 범위 밖이거나 미로드면 0
+int onnxInputSize(OnnxSession* session);
+int onnxInputStride(OnnxSession* session);
+int onnxOutputSize(OnnxSession* session);
+int onnxOutputStride(OnnxSession* session);
+int onnxMaxBatch(OnnxSession* session);
+const char* onnxDescribe(OnnxSession* session);  // 융합 후 실행 계획 (미로드면 빈 문자열)
+
+}
+
+#endif // AUX_KERNELS_H
@@ -0,0 +1,69 @@
+#include "aux_kernels.h"
+#include "onnx_executor.h"
+#include <algorithm>  // std::max
+#include <string>
+
+// ============================================================
+// 7. ONNX 그래프 실행기 (학습 팀이 내보낸 .onnx 파일을 재빌드 없이 실행)
+// ============================================================
+// 인식 코어에는 넣지 않고 이 모듈에서만 링크 (ONNX 모델을 쓰는 페이지만 내려받음)
+struct OnnxSession {
+    OnnxModel model;
+    std::string error;
+    std::string plan;  // onnxDescribe 결과 보관
+};
+
+OnnxSession* onnxCreate() {
+    return new OnnxSession();
+}
+
+void onnxDestroy(OnnxSession* session) {
+    delete session;
+}
+
+int onnxLoad(OnnxSession* session, const uint8_t* model, int modelSize, const uint8_t* data, int dataSize, int maxBatch) {
+    if (!session) return 0;
+    session->error.clear();
+    return session->model.loadFromMemory(model, static_cast<size_t>(std::max(0, modelSize)), data,
+                                         static_cast<size_t>(std::max(0, dataSize)), maxBatch, &session->error)
+               ? 1
+               : 0;
+}
+
+const char* onnxError(OnnxSession* session) {
+    return session ? session->error.c_str() : "";
+}
+
+float* onnxInputBuffer(OnnxSession* session) {
+    return session ? session->model.input() : nullptr;
+}
+
+const float* onnxRun(OnnxSession* session, int batch) {
+    return session ? session->model.run(batch) : nullptr;
+}
+
+int onnxInputSize(OnnxSession* session) {
+    return session ? session->model.inputSize() : 0;
+}
+
+int onnxInputStride(OnnxSession* session) {
+    return session ? session->model.inputStride() : 0;
+}
+
+int onnxOutputSize(OnnxSession* session) {
+    return session ? session->model.outputSize() : 0;
+}
+
+int onnxOutputStride(OnnxSession* session) {
+    return session ? session->model.outputStride() : 0;
+}
+
+int onnxMaxBatch(OnnxSession* session) {
+    return session ? session->model.maxBatch() : 0;
+}
+
+const char* onnxDescribe(OnnxSession* session) {
+    if (!session) return "";
+    session->plan = session->model.loaded() ? session->model.describe() : std::string();
+    return session->plan.c_str();
+}
@@ -0,0 +1,50 @@
+#include "aux_kernels.h"
+#include <cmath>  // std::sqrt
+
+// 5. 파티클 물리 시뮬레이션
+void simulateParticles(float* positions, float* velocities, int particleCount, float deltaTime) {
+    const float gravity = -9.8f;
+    const float damping = 0.99f;
+    
+    // 각 파티클 업데이트
+    for (int i = 0; i < particleCount; i++) {
+        int idx = i * 3; // x, y, z
+        
+        // 중력 적용
+        velocities[idx + 1] += gravity * deltaTime;
+        
+        // 위치 업데이트
+        positions[idx] += velocities[idx] * deltaTime;
+        positions[idx + 1] += velocities[idx + 1] * deltaTime;
+        positions[idx + 2] += velocities[idx + 2] * deltaTime;
+        
+        // 바닥 충돌 검사
+        if (positions[idx + 1] < 0) {
+            positions[idx + 1] = 0;
+            velocities[idx + 1] = -velocities[idx + 1] * damping;
+        }
+        
+        // 간단한 파티클 간 상호작용
+        for (int j = i + 1; j < particleCount; j++) {
+            int jdx = j * 3;
+            
+            float dx = positions[idx] - positions[jdx];
+            float dy = positions[idx + 1] - positions[jdx + 1];
+            float dz = positions[idx + 2] - positions[jdx + 2];
+            
+            float distance = std::sqrt(dx*dx + dy*dy + dz*dz);
+            
+            if (distance < 1.0f && distance > 0.001f) {
+                float force = 0.1f / distance;
+                
+                velocities[idx] += dx * force * deltaTime;
+                velocities[idx + 1] += dy * force * deltaTime;
+                velocities[idx + 2] += dz * force * deltaTime;
+                
+                velocities[jdx] -= dx * force * deltaTime;
+                velocities[jdx + 1] -= dy * force * deltaTime;
+                velocities[jdx + 2] -= dz * force * deltaTime;
+            }
+        }
+    }
+}
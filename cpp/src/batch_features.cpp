@@ -0,0 +1,146 @@
+#include "batch_features.h"
+#include "fast_math.h"  // acosDegrees, cosineBetween (한 손 경로와 같은 커널)
+
+#include <algorithm>    // std::min
+#include <immintrin.h>  // SIMD 인트린식 (__m256, _mm256_*)
+
+namespace batch_features {
+
+namespace {
+
+// 손 LANES개의 레인 우선 좌표 (x[i][lane] = 손 lane의 랜드마크 i)
+struct HandBlock {
+    alignas(32) float x[21][LANES];
+    alignas(32) float y[21][LANES];
+    alignas(32) float z[21][LANES];
+};
+
+// 손 count개를 블록에 전치 (남는 레인은 0 → 거리/각도 0, 표준편차 0이라 그대로)
+void loadBlock(const float* landmarks, int count, int stride, HandBlock& block) {
+    for (int lane = 0; lane < LANES; lane++) {
+        const float* hand = lane < count ? landmarks + static_cast<size_t>(lane) * stride : nullptr;
+        for (int i = 0; i < 21; i++) {
+            block.x[i][lane] = hand ? hand[i * 3] : 0.0f;
+            block.y[i][lane] = hand ? hand[i * 3 + 1] : 0.0f;
+            block.z[i][lane] = hand ? hand[i * 3 + 2] : 0.0f;
+        }
+    }
+}
+
+// 8x8 전치: r[k]의 레인 l → r[l]의 레인 k (특징 8개 x 손 8개 → 손 8개 x 특징 8개)
+inline void transpose8(__m256 r[8]) {
+    const __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]);
+    const __m256 t1 = _mm256_unpackhi_ps(r[0], r[1]);
+    const __m256 t2 = _mm256_unpacklo_ps(r[2], r[3]);
+    const __m256 t3 = _mm256_unpackhi_ps(r[2], r[3]);
+    const __m256 t4 = _mm256_unpacklo_ps(r[4], r[5]);
+    const __m256 t5 = _mm256_unpackhi_ps(r[4], r[5]);
+    const __m256 t6 = _mm256_unpacklo_ps(r[6], r[7]);
+    const __m256 t7 = _mm256_unpackhi_ps(r[6], r[7]);
+    const __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+    r[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+    r[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+    r[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+    r[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+    r[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+    r[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+    r[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+    r[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+}
+
+// 블록의 원시 특징 (표준화 전): f[k]의 레인 = 손
+void computeBlock(const HandBlock& block, __m256* f) {
+    // 1. 모든 쌍의 거리 (i < j 순서, 210개)
+    int k = 0;
+    for (int i = 0; i < 20; i++) {
+        const __m256 xi = _mm256_load_ps(block.x[i]);
+        const __m256 yi = _mm256_load_ps(block.y[i]);
+        const __m256 zi = _mm256_load_ps(block.z[i]);
+        for (int j = i + 1; j < 21; j++) {
+            const __m256 dx = _mm256_sub_ps(_mm256_load_ps(block.x[j]), xi);
+            const __m256 dy = _mm256_sub_ps(_mm256_load_ps(block.y[j]), yi);
+            const __m256 dz = _mm256_sub_ps(_mm256_load_ps(block.z[j]), zi);
+            f[k++] = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz)));
+        }
+    }
+
+    // 2. 손목 거리 (쌍 거리 0번 행)
+    for (int j = 0; j < 20; j++) f[210 + j] = f[j];
+
+    // 3. 손가락 각도, 5. 곡률: 각 a-b-c (b 기준 두 변, x, y만)
+    auto angle = [&block](int a, int b, int c) {
+        const __m256 bx = _mm256_load_ps(block.x[b]);
+        const __m256 by = _mm256_load_ps(block.y[b]);
+        return fast_math::acosDegrees(fast_math::cosineBetween(
+            _mm256_sub_ps(_mm256_load_ps(block.x[a]), bx), _mm256_sub_ps(_mm256_load_ps(block.y[a]), by),
+            _mm256_sub_ps(_mm256_load_ps(block.x[c]), bx), _mm256_sub_ps(_mm256_load_ps(block.y[c]), by)));
+    };
+    static const int fingerTips[5] = {4, 8, 12, 16, 20};
+    static const int fingerPips[5] = {3, 6, 10, 14, 18};
+    static const int fingerMcps[5] = {2, 5, 9, 13, 17};
+    for (int n = 0; n < 5; n++) f[230 + n] = angle(fingerTips[n], fingerPips[n], fingerMcps[n]);
+    for (int i = 1; i < 20; i++) f[236 + i] = angle(i - 1, i, i + 1);
+
+    // 4. 손바닥 중심 (랜드마크 0..4 평균)
+    __m256 palmX = _mm256_load_ps(block.x[0]);
+    __m256 palmY = _mm256_load_ps(block.y[0]);
+    for (int i = 1; i < 5; i++) {
+        palmX = _mm256_add_ps(palmX, _mm256_load_ps(block.x[i]));
+        palmY = _mm256_add_ps(palmY, _mm256_load_ps(block.y[i]));
+    }
+    f[235] = _mm256_div_ps(palmX, _mm256_set1_ps(5.0f));
+    f[236] = _mm256_div_ps(palmY, _mm256_set1_ps(5.0f));
+}
+
+// 손마다 z-점수 표준화 (표준편차 <= 1e-6이면 원래 값) 후 8개 특징씩 전치해 행 우선으로 기록
+// 합과 분산은 누산기 4개로 나눠 덧셈 지연 사슬을 끊음 (한 손 경로도 -ffast-math로 묶어 더하므로 끝 비트만 다름)
+void storeBlock(const __m256* f, int count, float* out, int outStride) {
+    __m256 sum[4] = {_mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps()};
+    for (int k = 0; k < FEATURES; k += 4) {
+        for (int a = 0; a < 4; a++) sum[a] = _mm256_add_ps(sum[a], f[k + a]);
+    }
+    const __m256 inverseSize = _mm256_set1_ps(1.0f / FEATURES);
+    const __m256 mean = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(sum[0], sum[1]), _mm256_add_ps(sum[2], sum[3])), inverseSize);
+    __m256 variance[4] = {_mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps()};
+    for (int k = 0; k < FEATURES; k += 4) {
+        for (int a = 0; a < 4; a++) {
+            const __m256 d = _mm256_sub_ps(f[k + a], mean);
+            variance[a] = _mm256_add_ps(variance[a], _mm256_mul_ps(d, d));
+        }
+    }
+    const __m256 stddev = _mm256_sqrt_ps(_mm256_mul_ps(
+        _mm256_add_ps(_mm256_add_ps(variance[0], variance[1]), _mm256_add_ps(variance[2], variance[3])), inverseSize));
+    const __m256 scaled = _mm256_cmp_ps(stddev, _mm256_set1_ps(1e-6f), _CMP_GT_OQ);
+    // 표준화하지 않는 레인은 (f - 0) * 1
+    const __m256 shift = _mm256_and_ps(scaled, mean);
+    const __m256 scale = _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_div_ps(_mm256_set1_ps(1.0f), stddev), scaled);
+
+    for (int k = 0; k < FEATURES; k += 8) {
+        __m256 r[8];
+        for (int t = 0; t < 8; t++) r[t] = _mm256_mul_ps(_mm256_sub_ps(f[k + t], shift), scale);
+        transpose8(r);
+        for (int lane = 0; lane < count; lane++) _mm256_storeu_ps(out + static_cast<size_t>(lane) * outStride + k, r[lane]);
+    }
+}
+
+}  // namespace
+
+void extractComplexFeatures(const float* landmarks, int hands, int landmarkStride, float* out, int outStride) {
+    HandBlock block;
+    __m256 features[FEATURES];
+    for (int first = 0; first < hands; first += LANES) {
+        const int count = std::min(LANES, hands - first);
+        loadBlock(landmarks + static_cast<size_t>(first) * landmarkStride, count, landmarkStride, block);
+        computeBlock(block, features);
+        storeBlock(features, count, out + static_cast<size_t>(first) * outStride, outStride);
+    }
+}
+
+}  // namespace batch_features
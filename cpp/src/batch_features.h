@@ -0,0 +1,32 @@
+#ifndef BATCH_FEATURES_H
+#define BATCH_FEATURES_H
+
+/**
+ * 여러 손의 특징 일괄 추출 (오프라인 작업용, 손 하나 = SIMD 레인 하나)
+ *
+ * - SignRecognizer 내부 특징 추출(비공개, recognize 경로)과 같은 256개 특징
+ *   인식기 밖에서 특징 행렬이 필요하면 한 손 추출을 여는 대신 이 함수(또는 FeatureArena)를 사용
+ *   ([0, 210) 쌍 거리, [210, 230) 손목 거리, [230, 235) 손가락 각도, [235, 237) 손바닥 중심, [237, 256) 곡률 → 표준화)
+ * - 손 LANES개를 레인 우선 SoA(x[21][LANES] ...)로 전치한 뒤 거리/각도/정규화의 각 단계를
+ *   모든 손에 대해 한 번에 계산 (손 하나 안의 짧은 반복 대신 레인마다 다른 손)
+ * - 결과는 8x8 전치로 행 우선 특징 행렬 [hands][outStride]에 바로 기록 → 배치 추론 입력으로 그대로 사용
+ *   (OnnxModel::input()/inputStride() 등)
+ * - 각도는 fast_math 같은 커널이라 한 손 경로와 비트 단위로 같고, 거리 합/분산의 합산 순서만 달라
+ *   표준화된 값은 마지막 몇 비트까지 같음 (make batchfeat로 확인)
+ * - 지터 필터는 적용하지 않음, 힙 할당 없음 (블록 버퍼는 스택)
+ */
+namespace batch_features {
+
+static constexpr int LANES = 8;            // __m256 레인 = 한 번에 처리하는 손 수
+static constexpr int FEATURES = 256;       // FeatureArena::COMPLEX_SIZE, SignRecognizer 내부 특징 수와 같음
+static constexpr int HAND_FLOATS = 63;     // 손마다 21 x (x, y, z)
+
+// hands개 손의 특징을 out [hands][outStride] (outStride >= FEATURES)에 기록
+// - landmarks: 손 h의 좌표가 landmarks + h * landmarkStride에서 시작 (x, y, z 21쌍)
+//   (데이터셋 행에서 바로 읽으려면 landmarkStride = 126, 오른손은 landmarks + 63)
+// - 마지막 묶음이 LANES개보다 적으면 빈 레인은 0으로 채워 계산하고 기록하지 않음
+void extractComplexFeatures(const float* landmarks, int hands, int landmarkStride, float* out, int outStride);
+
+}  // namespace batch_features
+
+#endif // BATCH_FEATURES_H
@@ -0,0 +1,361 @@
+#include "convolution.h"
+#include <immintrin.h>  // AVX SIMD
+#include <algorithm>  // std::min, std::max, std::fill, std::swap
+#include <cmath>  // std::cos, std::sin
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+// 연산량 모델 계수 (단일 채널 DIRECT의 출력 하나 x 탭 하나 = 1, tools/convolution_bench로 측정해 맞춤)
+constexpr double DIRECT_COST = 1.0;          // 단일 채널 탭당 곱셈-누산 (출력 8개 x 4 레지스터)
+constexpr double CHANNEL_DIRECT_COST = 1.5;  // 다채널 탭당 (프레임 간격 적재, 마스크 조각 포함)
+constexpr double BUTTERFLY_COST = 19.0;      // 블록 쌍의 N log2 N 항당 (FFT 두 번: 정방향 + 역방향)
+constexpr double SPECTRUM_COST = 14.0;       // 블록 쌍의 N당 (0 채움, 스펙트럼 곱셈, overlap-add)
+constexpr double PAIR_COST = 1800.0;         // 블록 쌍 하나의 고정 비용 (호출, 분기, 짧은 루프 꼬리)
+
+inline int log2Int(int n) {
+    int bits = 0;
+    while ((1 << bits) < n) bits++;
+    return bits;
+}
+
+// 블록 쌍 하나(복소 FFT 1회로 실수 블록 2개)의 비용
+inline double fftPairCost(int n) {
+    return BUTTERFLY_COST * n * log2Int(n) + SPECTRUM_COST * n + PAIR_COST;
+}
+
+// 채널 수 tail(1~7)개 레인만 켜진 마스크
+inline __m256i tailMask(int tail) {
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32(tail), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+}
+}  // namespace
+
+bool ConvolutionEngine::setKernel(const float* kernel, int kernelSize) {
+    if (!kernel || kernelSize <= 0) return false;
+    if (!memory_accounting::fitsBudget(memory_accounting::FFT, memory_accounting::growthBytes(taps, kernelSize))) return false;
+    taps.assign(kernel, kernel + kernelSize);
+    fftN = 0;  // 커널 스펙트럼은 다음 FFT 호출에서 다시 계산
+    return true;
+}
+
+int ConvolutionEngine::fftSizeFor(int inputSize, int kernelSize) {
+    // 블록 길이 L = N - k + 1 → 블록 쌍 수 ceil(n / L / 2), 후보 중 총비용 최소인 N
+    int best = 0;
+    double bestCost = 0.0;
+    int upper = std::min(MAX_FFT_SIZE, 1 << log2Int(inputSize + kernelSize - 1));
+    for (int n = std::max(16, 1 << log2Int(2 * kernelSize)); n <= upper; n <<= 1) {
+        int block = n - kernelSize + 1;
+        int pairs = ((inputSize + block - 1) / block + 1) / 2;
+        double cost = pairs * fftPairCost(n);
+        if (!best || cost < bestCost) {
+            best = n;
+            bestCost = cost;
+        }
+    }
+    return best;
+}
+
+ConvolutionEngine::Method ConvolutionEngine::choose(int inputSize, int kernelSize, int channels) {
+    int outSize = outputLength(inputSize, kernelSize);
+    int n = outSize > 0 ? fftSizeFor(inputSize, kernelSize) : 0;
+    if (!n) return DIRECT;
+    int block = n - kernelSize + 1;
+    int blocks = (inputSize + block - 1) / block;
+    // 단일 채널은 같은 채널의 블록 두 개, 다채널은 채널 두 개를 묶으므로 묶음 수 계산이 다름
+    double fft = channels > 1 ? double((channels + 1) / 2) * blocks * fftPairCost(n)
+                              : double((blocks + 1) / 2) * fftPairCost(n);
+    double direct = (channels > 1 ? CHANNEL_DIRECT_COST : DIRECT_COST) * double(outSize) * kernelSize * channels;
+    return fft < direct ? FFT : DIRECT;
+}
+
+// ===================== DIRECT =====================
+
+// 출력 8개씩 한 레지스터, 커널 탭마다 브로드캐스트 곱셈 (레지스터 4개로 의존 사슬 분리)
+void ConvolutionEngine::directSingle(const float* input, int outSize, float* output) const {
+    const int k = static_cast<int>(taps.size());
+    const float* w = taps.data();
+    int i = 0;
+    for (; i + 32 <= outSize; i += 32) {
+        __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+        __m256 acc2 = _mm256_setzero_ps(), acc3 = _mm256_setzero_ps();
+        for (int t = 0; t < k; t++) {
+            const __m256 tap = _mm256_set1_ps(w[t]);
+            const float* x = input + i + t;
+            acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(tap, _mm256_loadu_ps(x)));
+            acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(tap, _mm256_loadu_ps(x + 8)));
+            acc2 = _mm256_add_ps(acc2, _mm256_mul_ps(tap, _mm256_loadu_ps(x + 16)));
+            acc3 = _mm256_add_ps(acc3, _mm256_mul_ps(tap, _mm256_loadu_ps(x + 24)));
+        }
+        _mm256_storeu_ps(output + i, acc0);
+        _mm256_storeu_ps(output + i + 8, acc1);
+        _mm256_storeu_ps(output + i + 16, acc2);
+        _mm256_storeu_ps(output + i + 24, acc3);
+    }
+    for (; i + 8 <= outSize; i += 8) {
+        __m256 acc = _mm256_setzero_ps();
+        for (int t = 0; t < k; t++) acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_set1_ps(w[t]), _mm256_loadu_ps(input + i + t)));
+        _mm256_storeu_ps(output + i, acc);
+    }
+    for (; i < outSize; i++) {
+        float sum = 0.0f;
+        for (int t = 0; t < k; t++) sum += input[i + t] * w[t];
+        output[i] = sum;
+    }
+}
+
+// 채널 방향 벡터화: 채널 8개 x 출력 프레임 4개를 레지스터 4개에 두고 탭마다 브로드캐스트 한 번,
+// 마지막 채널 조각은 마스크 적재/저장
+void ConvolutionEngine::directChannels(const float* input, int outFrames, int channels, float* output) const {
+    const int k = static_cast<int>(taps.size());
+    const float* w = taps.data();
+    const size_t stride = static_cast<size_t>(channels);
+    const int full = channels & ~7;
+    const int tail = channels - full;
+    const __m256i mask = tailMask(tail);
+    auto load = [&](const float* p, int c) { return c < full ? _mm256_loadu_ps(p) : _mm256_maskload_ps(p, mask); };
+    auto store = [&](float* p, int c, __m256 v) {
+        if (c < full) _mm256_storeu_ps(p, v);
+        else _mm256_maskstore_ps(p, mask, v);
+    };
+    int i = 0;
+    for (; i + 4 <= outFrames; i += 4) {
+        const float* frame = input + i * stride;
+        float* out = output + i * stride;
+        for (int c = 0; c < channels; c += 8) {
+            __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+            __m256 acc2 = _mm256_setzero_ps(), acc3 = _mm256_setzero_ps();
+            for (int t = 0; t < k; t++) {
+                const __m256 tap = _mm256_set1_ps(w[t]);
+                const float* x = frame + t * stride + c;
+                acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(tap, load(x, c)));
+                acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(tap, load(x + stride, c)));
+                acc2 = _mm256_add_ps(acc2, _mm256_mul_ps(tap, load(x + 2 * stride, c)));
+                acc3 = _mm256_add_ps(acc3, _mm256_mul_ps(tap, load(x + 3 * stride, c)));
+            }
+            store(out + c, c, acc0);
+            store(out + stride + c, c, acc1);
+            store(out + 2 * stride + c, c, acc2);
+            store(out + 3 * stride + c, c, acc3);
+        }
+    }
+    for (; i < outFrames; i++) {
+        const float* frame = input + i * stride;
+        for (int c = 0; c < channels; c += 8) {
+            __m256 acc = _mm256_setzero_ps();
+            for (int t = 0; t < k; t++) acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_set1_ps(w[t]), load(frame + t * stride + c, c)));
+            store(output + i * stride + c, c, acc);
+        }
+    }
+}
+
+// ===================== FFT =====================
+
+bool ConvolutionEngine::prepareFft(int n) {
+    if (n == fftN) return true;
+    // 교환 쌍은 n개 미만, 나머지 버퍼는 n개씩
+    size_t growth = memory_accounting::growthBytes(bitReverseSwaps, n);
+    for (const std::pmr::vector<float>* v : {&twiddleRe, &twiddleIm, &workRe, &workIm, &kernelRe, &kernelIm}) {
+        growth += memory_accounting::growthBytes(*v, n);
+    }
+    if (!memory_accounting::fitsBudget(memory_accounting::FFT, growth)) return false;
+    fftN = n;
+    const int bits = log2Int(n);
+    bitReverseSwaps.clear();
+    bitReverseSwaps.reserve(n);
+    for (int i = 0; i < n; i++) {
+        int r = 0;
+        for (int b = 0; b < bits; b++) r |= ((i >> b) & 1) << (bits - 1 - b);
+        if (i < r) {
+            bitReverseSwaps.push_back(i);
+            bitReverseSwaps.push_back(r);
+        }
+    }
+    // 길이 len 단계의 트위들 exp(-2πij/len)는 오프셋 len/2 - 1부터 len/2개
+    twiddleRe.resize(n);
+    twiddleIm.resize(n);
+    for (int half = 1; half < n; half <<= 1) {
+        for (int j = 0; j < half; j++) {
+            double angle = -M_PI * j / half;
+            twiddleRe[half - 1 + j] = static_cast<float>(std::cos(angle));
+            twiddleIm[half - 1 + j] = static_cast<float>(std::sin(angle));
+        }
+    }
+    workRe.resize(n);
+    workIm.resize(n);
+
+    // 뒤집은 커널(상관 → 컨볼루션)의 스펙트럼
+    const int k = static_cast<int>(taps.size());
+    kernelRe.assign(n, 0.0f);
+    kernelIm.assign(n, 0.0f);
+    for (int j = 0; j < k; j++) kernelRe[j] = taps[k - 1 - j];
+    fftForward(kernelRe.data(), kernelIm.data());
+    return true;
+}
+
+void ConvolutionEngine::fftForward(float* re, float* im) const {
+    const int n = fftN;
+    for (size_t p = 0; p < bitReverseSwaps.size(); p += 2) {
+        int i = bitReverseSwaps[p], j = bitReverseSwaps[p + 1];
+        std::swap(re[i], re[j]);
+        std::swap(im[i], im[j]);
+    }
+    // 첫 두 단계(길이 2, 4)는 트위들이 1, -i뿐이라 곱셈 없는 기수 4 나비 하나로 처리
+    for (int base = 0; base < n; base += 4) {
+        float* r = re + base;
+        float* m = im + base;
+        float ar = r[0] + r[1], ai = m[0] + m[1], br = r[0] - r[1], bi = m[0] - m[1];
+        float cr = r[2] + r[3], ci = m[2] + m[3], dr = r[2] - r[3], di = m[2] - m[3];
+        r[0] = ar + cr; m[0] = ai + ci;
+        r[2] = ar - cr; m[2] = ai - ci;
+        r[1] = br + di; m[1] = bi - dr;  // b + (-i)d
+        r[3] = br - di; m[3] = bi + dr;
+    }
+    // 길이 8 단계: 128비트 나비 4개
+    if (n >= 8) {
+        const __m128 w4r = _mm_loadu_ps(twiddleRe.data() + 3), w4i = _mm_loadu_ps(twiddleIm.data() + 3);
+        for (int base = 0; base < n; base += 8) {
+            __m128 xr = _mm_loadu_ps(re + base + 4), xi = _mm_loadu_ps(im + base + 4);
+            __m128 tr = _mm_sub_ps(_mm_mul_ps(xr, w4r), _mm_mul_ps(xi, w4i));
+            __m128 ti = _mm_add_ps(_mm_mul_ps(xr, w4i), _mm_mul_ps(xi, w4r));
+            __m128 ar = _mm_loadu_ps(re + base), ai = _mm_loadu_ps(im + base);
+            _mm_storeu_ps(re + base, _mm_add_ps(ar, tr));
+            _mm_storeu_ps(im + base, _mm_add_ps(ai, ti));
+            _mm_storeu_ps(re + base + 4, _mm_sub_ps(ar, tr));
+            _mm_storeu_ps(im + base + 4, _mm_sub_ps(ai, ti));
+        }
+    }
+    for (int half = 8; half < n; half <<= 1) {
+        const float* wr = twiddleRe.data() + half - 1;
+        const float* wi = twiddleIm.data() + half - 1;
+        for (int base = 0; base < n; base += 2 * half) {
+            float* ur = re + base;
+            float* ui = im + base;
+            float* vr = ur + half;
+            float* vi = ui + half;
+            // 나비 연산 8개씩 (half는 8의 배수)
+            for (int j = 0; j < half; j += 8) {
+                __m256 twr = _mm256_loadu_ps(wr + j), twi = _mm256_loadu_ps(wi + j);
+                __m256 xr = _mm256_loadu_ps(vr + j), xi = _mm256_loadu_ps(vi + j);
+                __m256 tr = _mm256_sub_ps(_mm256_mul_ps(xr, twr), _mm256_mul_ps(xi, twi));
+                __m256 ti = _mm256_add_ps(_mm256_mul_ps(xr, twi), _mm256_mul_ps(xi, twr));
+                __m256 ar = _mm256_loadu_ps(ur + j), ai = _mm256_loadu_ps(ui + j);
+                _mm256_storeu_ps(ur + j, _mm256_add_ps(ar, tr));
+                _mm256_storeu_ps(ui + j, _mm256_add_ps(ai, ti));
+                _mm256_storeu_ps(vr + j, _mm256_sub_ps(ar, tr));
+                _mm256_storeu_ps(vi + j, _mm256_sub_ps(ai, ti));
+            }
+        }
+    }
+}
+
+void ConvolutionEngine::convolveBlockPair(const float* a, int aLen, int aStride, const float* b, int bLen, int bStride,
+                                          float* outA, float* outB) {
+    const int n = fftN;
+    const int k = static_cast<int>(taps.size());
+    float* re = workRe.data();
+    float* im = workIm.data();
+    for (int j = 0; j < aLen; j++) re[j] = a[static_cast<size_t>(j) * aStride];
+    std::fill(re + aLen, re + n, 0.0f);
+    for (int j = 0; j < bLen; j++) im[j] = b[static_cast<size_t>(j) * bStride];
+    std::fill(im + bLen, im + n, 0.0f);
+
+    fftForward(re, im);
+
+    // Y = X · H, 역변환은 conj(FFT(conj(Y))) / n 이므로 곱하면서 켤레를 취함
+    const float* hr = kernelRe.data();
+    const float* hi = kernelIm.data();
+    int j = 0;
+    for (; j + 8 <= n; j += 8) {
+        __m256 xr = _mm256_loadu_ps(re + j), xi = _mm256_loadu_ps(im + j);
+        __m256 kr = _mm256_loadu_ps(hr + j), ki = _mm256_loadu_ps(hi + j);
+        _mm256_storeu_ps(re + j, _mm256_sub_ps(_mm256_mul_ps(xr, kr), _mm256_mul_ps(xi, ki)));
+        _mm256_storeu_ps(im + j, _mm256_sub_ps(_mm256_setzero_ps(), _mm256_add_ps(_mm256_mul_ps(xr, ki), _mm256_mul_ps(xi, kr))));
+    }
+    for (; j < n; j++) {
+        float yr = re[j] * hr[j] - im[j] * hi[j];
+        float yi = re[j] * hi[j] + im[j] * hr[j];
+        re[j] = yr;
+        im[j] = -yi;
+    }
+
+    fftForward(re, im);
+
+    // 커널이 실수라 실부 = a * h, 허부 = b * h (켤레 복원은 허부 부호 반전)
+    const float scale = 1.0f / n;
+    for (int m = 0; m < aLen + k - 1; m++) outA[m] += re[m] * scale;
+    for (int m = 0; m < (bLen ? bLen + k - 1 : 0); m++) outB[m] -= im[m] * scale;
+}
+
+// ===================== 공개 API =====================
+
+int ConvolutionEngine::convolve(const float* input, int inputSize, float* output, Method method) {
+    const int k = static_cast<int>(taps.size());
+    const int outSize = outputLength(inputSize, k);
+    if (!input || !output || outSize <= 0) return -1;
+    if (method == AUTO) method = choose(inputSize, k, 1);
+    int n = method == FFT ? fftSizeFor(inputSize, k) : 0;
+    if (!n) method = DIRECT;  // 커널이 MAX_FFT_SIZE에 비해 너무 긴 경우
+    last = method;
+    if (method == DIRECT) {
+        directSingle(input, outSize, output);
+        return outSize;
+    }
+
+    const int block = n - k + 1;
+    const size_t accSize = static_cast<size_t>(inputSize) + k - 1 + block;
+    if (!prepareFft(n) || !memory_accounting::fitsBudget(memory_accounting::FFT, memory_accounting::growthBytes(accA, accSize))) {
+        return -1;
+    }
+    accA.assign(accSize, 0.0f);
+    float* acc = accA.data();
+    // 같은 채널의 연속 블록 두 개를 실부/허부로 묶음
+    for (int start = 0; start < inputSize; start += 2 * block) {
+        int aLen = std::min(block, inputSize - start);
+        int bStart = start + block;
+        int bLen = bStart < inputSize ? std::min(block, inputSize - bStart) : 0;
+        convolveBlockPair(input + start, aLen, 1, input + std::min(bStart, inputSize - 1), bLen, 1, acc + start,
+                          acc + bStart);
+    }
+    for (int i = 0; i < outSize; i++) output[i] = acc[i + k - 1];
+    return outSize;
+}
+
+int ConvolutionEngine::convolveChannels(const float* input, int frames, int channels, float* output, Method method) {
+    const int k = static_cast<int>(taps.size());
+    const int outFrames = outputLength(frames, k);
+    if (!input || !output || channels <= 0 || outFrames <= 0) return -1;
+    if (method == AUTO) method = choose(frames, k, channels);
+    int n = method == FFT ? fftSizeFor(frames, k) : 0;
+    if (!n) method = DIRECT;
+    last = method;
+    if (method == DIRECT) {
+        directChannels(input, outFrames, channels, output);
+        return outFrames;
+    }
+
+    const int block = n - k + 1;
+    const size_t accSize = static_cast<size_t>(frames) + k - 1;
+    if (!prepareFft(n) || !memory_accounting::fitsBudget(memory_accounting::FFT, memory_accounting::growthBytes(accA, accSize) +
+                                                                                     memory_accounting::growthBytes(accB, accSize))) {
+        return -1;
+    }
+    // 채널 두 개를 실부/허부로 묶어 블록마다 FFT 한 번
+    for (int c = 0; c < channels; c += 2) {
+        const bool pair = c + 1 < channels;
+        accA.assign(accSize, 0.0f);
+        accB.assign(accSize, 0.0f);
+        for (int start = 0; start < frames; start += block) {
+            int len = std::min(block, frames - start);
+            const float* a = input + static_cast<size_t>(start) * channels + c;
+            convolveBlockPair(a, len, channels, pair ? a + 1 : a, pair ? len : 0, channels, accA.data() + start,
+                              accB.data() + start);
+        }
+        for (int i = 0; i < outFrames; i++) {
+            output[static_cast<size_t>(i) * channels + c] = accA[i + k - 1];
+            if (pair) output[static_cast<size_t>(i) * channels + c + 1] = accB[i + k - 1];
+        }
+    }
+    return outFrames;
+}
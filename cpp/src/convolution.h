@@ -0,0 +1,86 @@
+#ifndef CONVOLUTION_H
+#define CONVOLUTION_H
+
+#include "memory_accounting.h"
+
+#include <memory_resource>
+#include <vector>
+
+/**
+ * 1차원 컨볼루션 엔진 (랜드마크 시계열 평활화/대역 통과용)
+ *
+ * 연산은 기존 fastConvolution과 같은 valid 상관: out[i] = Σ input[i + k] * kernel[k]
+ * (출력 길이 n - k + 1, 커널을 뒤집어 넣으면 수학적 컨볼루션)
+ *
+ * - DIRECT: 출력 8개를 AVX 레지스터 하나에 두고 커널 탭마다 브로드캐스트 곱셈 누산 (짧은 커널)
+ * - FFT: 중첩 가산(overlap-add). 커널 스펙트럼은 FFT 크기별로 한 번만 계산해 재사용하고,
+ *   커널이 실수이므로 실수 블록 두 개를 복소수 하나(실부/허부)로 묶어 FFT 한 번으로 처리
+ * - AUTO: 신호/커널 길이로 두 방식의 연산량을 추정해 싼 쪽 선택 (choose)
+ * - 다채널: 프레임 우선 [frame][channel] 배열(예: 21 x 3 = 63 좌표)의 모든 채널에 같은 커널을 한 번에 적용
+ *   DIRECT는 채널 방향으로 벡터화, FFT는 채널 두 개씩 묶음
+ *
+ * 인스턴스는 커널 스펙트럼과 작업 버퍼를 소유하므로 스레드마다 하나씩 사용
+ * 버퍼는 memory_accounting FFT 태그 자원에서 할당 (FFT 크기가 커질 때의 힙 사용량 추적)
+ * 버퍼를 키우기 전에 FFT 예산을 확인해 넘으면 setKernel은 false, convolve/convolveChannels는 -1 (중단 없음)
+ */
+class ConvolutionEngine {
+public:
+    enum Method { AUTO = 0, DIRECT = 1, FFT = 2 };
+
+    static constexpr int MAX_FFT_SIZE = 1 << 16;
+
+    ConvolutionEngine() {}
+
+    // 커널 설정 (길이 1 이상), 이전 커널 스펙트럼은 무효화
+    bool setKernel(const float* kernel, int kernelSize);
+    int kernelSize() const { return static_cast<int>(taps.size()); }
+
+    static int outputLength(int inputSize, int kernelSize) {
+        return inputSize >= kernelSize && kernelSize > 0 ? inputSize - kernelSize + 1 : 0;
+    }
+
+    // 연산량 추정으로 방식 선택 (channels: 같은 커널을 적용할 채널 수)
+    static Method choose(int inputSize, int kernelSize, int channels = 1);
+
+    // 단일 채널: output[outputLength()] 기록, 출력 개수 반환 (-1: 커널 없음/입력이 커널보다 짧음/FFT 예산 초과)
+    int convolve(const float* input, int inputSize, float* output, Method method = AUTO);
+
+    // 다채널: input[frames][channels] → output[outputLength(frames)][channels]
+    int convolveChannels(const float* input, int frames, int channels, float* output, Method method = AUTO);
+
+    // 마지막 호출에서 실제로 쓰인 방식 (AUTO가 고른 결과 확인용)
+    Method lastMethod() const { return last; }
+
+private:
+    static int fftSizeFor(int inputSize, int kernelSize);  // 비용 최소 FFT 크기 (2의 거듭제곱)
+
+    void directSingle(const float* input, int outSize, float* output) const;
+    void directChannels(const float* input, int outFrames, int channels, float* output) const;
+
+    bool prepareFft(int n);  // 크기 n의 트위들/비트 역순/커널 스펙트럼 준비 (같은 n이면 재사용, 예산 초과면 false)
+    void fftForward(float* re, float* im) const;  // 제자리 복소 FFT (크기 fftN)
+
+    // 실수 블록 a, b(각 stride 간격, 길이 aLen/bLen ≤ 블록 길이)를 묶어 커널과 선형 컨볼루션,
+    // 결과를 accA/accB에 더함 (각 len + k - 1개, bLen == 0이면 b 생략)
+    void convolveBlockPair(const float* a, int aLen, int aStride, const float* b, int bLen, int bStride,
+                           float* accA, float* accB);
+
+    static std::pmr::memory_resource* memory() { return memory_accounting::resource(memory_accounting::FFT); }
+
+    std::pmr::vector<float> taps{memory()};         // 커널 (상관 순서)
+
+    int fftN = 0;
+    std::pmr::vector<int> bitReverseSwaps{memory()};  // 비트 역순 교환 쌍 (i < rev(i)인 것만, i/rev(i) 번갈아)
+    std::pmr::vector<float> twiddleRe{memory()};    // 단계별로 이어 붙인 트위들 (길이 len 단계: len/2개)
+    std::pmr::vector<float> twiddleIm{memory()};
+    std::pmr::vector<float> kernelRe{memory()};     // 뒤집은 커널의 스펙트럼 (fftN개)
+    std::pmr::vector<float> kernelIm{memory()};
+    std::pmr::vector<float> workRe{memory()};       // 작업 버퍼 (fftN개)
+    std::pmr::vector<float> workIm{memory()};
+    std::pmr::vector<float> accA{memory()};         // 채널별 overlap-add 누적 (입력 길이 + k - 1)
+    std::pmr::vector<float> accB{memory()};
+
+    Method last = DIRECT;
+};
+
+#endif // CONVOLUTION_H
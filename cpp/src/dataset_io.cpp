@@ -0,0 +1,197 @@
+#include "dataset_io.h"
+#include <algorithm>  // std::sort, std::unique
+#include <charconv>  // std::from_chars
+#include <cstdlib>  // std::strtof
+#include <cstring>  // std::memchr
+#include <fstream>  // 파일 읽기
+
+namespace {
+
+void setError(std::string* error, const std::string& message) {
+    if (error) *error = message;
+}
+
+// 파일 전체를 문자열로 읽기
+bool readFile(const std::string& path, std::string& out, std::string* error) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        setError(error, "cannot open " + path);
+        return false;
+    }
+    // 크기를 먼저 구해 한 번에 읽기 (스트림 버퍼 복사 없음)
+    in.seekg(0, std::ios::end);
+    out.resize(static_cast<size_t>(in.tellg()));
+    in.seekg(0, std::ios::beg);
+    in.read(&out[0], static_cast<std::streamsize>(out.size()));
+    if (!in) {
+        setError(error, "cannot read " + path);
+        return false;
+    }
+    return true;
+}
+
+// [p, end)의 float 하나 파싱 → 다음 위치 (실패 시 p)
+// from_chars는 로캘을 보지 않고 strtof와 같이 올바르게 반올림하므로 값은 비트 단위로 같음 ('+' 등은 strtof로)
+const char* parseFloat(const char* p, const char* end, float& value) {
+    while (p < end && *p == ' ') p++;
+    const std::from_chars_result result = std::from_chars(p, end, value);
+    if (result.ec == std::errc()) return result.ptr;
+    char* next = nullptr;
+    value = std::strtof(p, &next);
+    return next;
+}
+
+// "key": [ ... ] 형태의 숫자 배열 파싱 (중첩 없는 단순 JSON 전용)
+bool parseNumberArray(const std::string& text, const char* key, std::vector<float>& out) {
+    std::string quoted = std::string("\"") + key + "\"";
+    size_t pos = text.find(quoted);
+    if (pos == std::string::npos) return false;
+    pos = text.find('[', pos + quoted.size());
+    if (pos == std::string::npos) return false;
+
+    out.clear();
+    const char* p = text.c_str() + pos + 1;
+    while (*p) {
+        while (*p == ' ' || *p == ',' || *p == '\n' || *p == '\r' || *p == '\t') p++;
+        if (*p == ']') return true;
+        char* end = nullptr;
+        float value = std::strtof(p, &end);
+        if (end == p) return false;  // 숫자가 아닌 토큰
+        out.push_back(value);
+        p = end;
+    }
+    return false;  // 닫는 괄호 없음
+}
+
+// "key": ["a", "b"] 형태의 문자열 배열 파싱 (이스케이프 없는 라벨 전용)
+bool parseStringArray(const std::string& text, const char* key, std::vector<std::string>& out) {
+    std::string quoted = std::string("\"") + key + "\"";
+    size_t pos = text.find(quoted);
+    if (pos == std::string::npos) return false;
+    pos = text.find('[', pos + quoted.size());
+    size_t close = text.find(']', pos);
+    if (pos == std::string::npos || close == std::string::npos) return false;
+
+    out.clear();
+    size_t cur = pos + 1;
+    while (true) {
+        size_t open = text.find('"', cur);
+        if (open == std::string::npos || open > close) return true;
+        size_t end = text.find('"', open + 1);
+        if (end == std::string::npos || end > close) return false;
+        out.push_back(text.substr(open + 1, end - open - 1));
+        cur = end + 1;
+    }
+}
+
+}  // namespace
+
+bool loadLabelsJson(const std::string& path, std::vector<std::string>& labels, std::string* error) {
+    std::string text;
+    if (!readFile(path, text, error)) return false;
+    if (!parseStringArray(text, "labels", labels) || labels.empty()) {
+        setError(error, "no \"labels\" array in " + path);
+        return false;
+    }
+    return true;
+}
+
+bool loadScalerJson(const std::string& path, std::vector<float>& mean, std::vector<float>& scale,
+                    std::string* error) {
+    std::string text;
+    if (!readFile(path, text, error)) return false;
+    if (!parseNumberArray(text, "mean", mean) || !parseNumberArray(text, "scale", scale)) {
+        setError(error, "missing \"mean\"/\"scale\" arrays in " + path);
+        return false;
+    }
+    if (mean.size() != scale.size()) {
+        setError(error, "mean/scale size mismatch in " + path);
+        return false;
+    }
+    return true;
+}
+
+bool loadDatasetCsv(const std::string& path, const std::vector<std::string>& labelNames,
+                    LabeledDataset& dataset, std::string* error) {
+    std::string text;
+    if (!readFile(path, text, error)) return false;
+
+    dataset = LabeledDataset();
+    const char* p = text.c_str();
+    const char* end = p + text.size();
+    int lineNo = 0;
+
+    while (p < end) {
+        const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        if (!lineEnd) lineEnd = end;
+        lineNo++;
+        const char* contentEnd = lineEnd;
+        if (contentEnd > p && contentEnd[-1] == '\r') contentEnd--;  // CRLF 처리
+
+        const char* comma = static_cast<const char*>(std::memchr(p, ',', contentEnd - p));
+        if (comma) {
+            std::string label(p, comma);
+            if (label != "label") {  // 헤더 행 건너뛰기
+                int labelIdx = -1;
+                for (size_t i = 0; i < labelNames.size(); i++) {
+                    if (labelNames[i] == label) labelIdx = static_cast<int>(i);
+                }
+
+                // 숫자 열 파싱 (from_chars로 직접 스캔, 임시 문자열 없음)
+                size_t before = dataset.features.size();
+                const char* q = comma + 1;
+                while (q < contentEnd) {
+                    float value = 0.0f;
+                    const char* next = parseFloat(q, contentEnd, value);
+                    if (next == q) break;
+                    dataset.features.push_back(value);
+                    q = next;
+                    if (q < contentEnd && *q == ',') q++;
+                }
+
+                int columns = static_cast<int>(dataset.features.size() - before);
+                if (dataset.dim == 0) dataset.dim = columns;
+                if (columns != dataset.dim) {
+                    setError(error, path + ":" + std::to_string(lineNo) + ": expected " +
+                                        std::to_string(dataset.dim) + " features, got " + std::to_string(columns));
+                    return false;
+                }
+                dataset.labels.push_back(labelIdx);
+            }
+        }
+        p = lineEnd + 1;
+    }
+
+    if (dataset.labels.empty()) {
+        setError(error, "no rows in " + path);
+        return false;
+    }
+    return true;
+}
+
+bool loadDatasetLabels(const std::string& path, std::vector<std::string>& labels, std::string* error) {
+    std::string text;
+    if (!readFile(path, text, error)) return false;
+
+    labels.clear();
+    const char* p = text.c_str();
+    const char* end = p + text.size();
+    while (p < end) {
+        const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        if (!lineEnd) lineEnd = end;
+        const char* comma = static_cast<const char*>(std::memchr(p, ',', lineEnd - p));
+        if (comma) {
+            std::string label(p, comma);
+            if (label != "label" && (labels.empty() || labels.back() != label)) labels.push_back(label);  // 연속 중복은 바로 제외
+        }
+        p = lineEnd + 1;
+    }
+    std::sort(labels.begin(), labels.end());
+    labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
+
+    if (labels.empty()) {
+        setError(error, "no labeled rows in " + path);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,42 @@
+#ifndef DATASET_IO_H
+#define DATASET_IO_H
+
+#include <string>
+#include <vector>
+
+/**
+ * 네이티브 도구용 데이터셋/모델 메타데이터 로더
+ *
+ * - notebooks/sign_dataset.csv: "label,f0..f125" 형식 (왼손 63 + 오른손 63 정규화 좌표)
+ * - public/models/scaler.json: {"mean": [...], "scale": [...]} (StandardScaler)
+ * - public/models/labels.json: {"labels": [...]} (클래스 인덱스 순서)
+ *
+ * WASM 빌드에는 포함되지 않으며 리플레이 하니스 등 네이티브 도구에서만 사용
+ * 실패 시 false를 반환하고 error에 사유를 기록 (예외 미사용)
+ */
+
+// 라벨이 붙은 특징 행렬 (행 우선, rows x dim)
+struct LabeledDataset {
+    int dim = 0;                      // 행당 특징 개수 (보통 126)
+    std::vector<float> features;      // rows * dim 개 float
+    std::vector<int> labels;          // 행별 클래스 인덱스 (labels.json 순서, 모르는 라벨은 -1)
+
+    size_t size() const { return labels.size(); }
+    const float* row(size_t i) const { return features.data() + i * dim; }
+};
+
+// labels.json 로드 ({"labels": ["hello", ...]})
+bool loadLabelsJson(const std::string& path, std::vector<std::string>& labels, std::string* error = nullptr);
+
+// scaler.json 로드 ({"mean": [...], "scale": [...]})
+bool loadScalerJson(const std::string& path, std::vector<float>& mean, std::vector<float>& scale,
+                    std::string* error = nullptr);
+
+// CSV 데이터셋 로드 (첫 열 라벨 이름 → labelNames 인덱스로 변환)
+bool loadDatasetCsv(const std::string& path, const std::vector<std::string>& labelNames,
+                    LabeledDataset& dataset, std::string* error = nullptr);
+
+// CSV 첫 열의 고유 라벨을 사전순으로 수집 (sklearn LabelEncoder와 같은 클래스 순서, 헤더 행 제외)
+bool loadDatasetLabels(const std::string& path, std::vector<std::string>& labels, std::string* error = nullptr);
+
+#endif // DATASET_IO_H
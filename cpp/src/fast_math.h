@@ -0,0 +1,206 @@
+#ifndef FAST_MATH_H
+#define FAST_MATH_H
+
+#include <immintrin.h>  // SIMD 인트린식 (__m256, _mm256_*)
+
+/**
+ * SIMD 초월 함수 근사 (특징 추출의 각도·회전, 소프트맥스)
+ *
+ * - 8 lanes(__m256) 다항식 근사 (Cephes 단정밀도 계수). 배열 함수는 레지스터 두 벌(16개)씩 처리해
+ *   다항식 지연 시간을 겹치고, 꼬리는 0으로 채운 레지스터 하나로 같은 식을 계산
+ * - 스칼라 함수도 같은 8-lane 커널의 0번 레인을 돌려주므로 벡터/스칼라 결과가 비트 단위로 같음
+ *   (한 경로는 배열로, 다른 경로는 하나씩 계산해도 특징이 일치)
+ * - sqrt는 하드웨어 명령(_mm256_sqrt_ps, 정확 반올림)이 이미 한 명령이라 근사하지 않고 sqrt()로 감싸기만 함
+ *
+ * 최대 오차 (make fastmath로 측정, double 기준, 도구의 한계는 4e-7):
+ *   acos   [-1, 1]          절대 3.0e-7 rad (π 근처 float 1ulp 정도), acos(1) = 0, acos(-1) = π
+ *   atan2  전 사분면         절대 2.8e-7 rad, (±0, x<0) → ±π, (0, 0) → 0
+ *   exp    [-87, 88]        상대 3.0e-7 (범위 밖 입력은 경계로 고정), exp(0) = 1 정확
+ * 커널은 noinline 한 벌이라 -ffast-math(네이티브)에서도 호출 위치와 상관없이 같은 비트를 냄
+ */
+// 커널 본문을 한 벌만 두어 인라인 위치(상수 전파, FMA 축약)에 따라 결과 비트가 달라지지 않게 함
+#if defined(__GNUC__)
+#define FAST_MATH_KERNEL __attribute__((noinline)) inline
+#else
+#define FAST_MATH_KERNEL inline
+#endif
+
+namespace fast_math {
+
+// ---------------------------------------------------------------------------
+// 8-lane 커널
+// ---------------------------------------------------------------------------
+inline __m256 sqrt(__m256 x) {
+    return _mm256_sqrt_ps(x);
+}
+
+// acos: |x| <= 0.5는 asin 다항식, 그 밖은 acos(a) = 2·asin(√((1-a)/2))로 접어 같은 다항식 사용
+FAST_MATH_KERNEL __m256 acos(__m256 x) {
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 pi = _mm256_set1_ps(3.14159265358979f);
+    const __m256 halfPi = _mm256_set1_ps(1.57079632679490f);
+
+    const __m256 a = _mm256_min_ps(_mm256_andnot_ps(signMask, x), one);  // |x|, 범위 밖 입력은 1로
+    const __m256 big = _mm256_cmp_ps(a, half, _CMP_GT_OQ);
+    const __m256 z = _mm256_blendv_ps(_mm256_mul_ps(a, a), _mm256_mul_ps(_mm256_sub_ps(one, a), half), big);
+    const __m256 s = _mm256_blendv_ps(a, _mm256_sqrt_ps(z), big);
+
+    __m256 p = _mm256_set1_ps(4.2163199048e-2f);
+    p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(2.4181311049e-2f));
+    p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(4.5470025998e-2f));
+    p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(7.4953002686e-2f));
+    p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(1.6666752422e-1f));
+    const __m256 r = _mm256_add_ps(s, _mm256_mul_ps(_mm256_mul_ps(s, z), p));  // asin(s)
+
+    const __m256 negative = _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ);
+    const __m256 twoR = _mm256_add_ps(r, r);
+    const __m256 bigResult = _mm256_blendv_ps(twoR, _mm256_sub_ps(pi, twoR), negative);  // x < 0: π - acos(|x|)
+    const __m256 smallResult = _mm256_sub_ps(halfPi, _mm256_xor_ps(r, _mm256_and_ps(x, signMask)));  // π/2 - asin(x)
+    return _mm256_blendv_ps(smallResult, bigResult, big);
+}
+
+// atan2: t = min(|y|,|x|) / max(|y|,|x|) ∈ [0, 1], t > tan(π/8)이면 π/4 + atan((t-1)/(t+1))로 접은 뒤 사분면 복원
+FAST_MATH_KERNEL __m256 atan2(__m256 y, __m256 x) {
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+
+    const __m256 ay = _mm256_andnot_ps(signMask, y);
+    const __m256 ax = _mm256_andnot_ps(signMask, x);
+    const __m256 steep = _mm256_cmp_ps(ay, ax, _CMP_GT_OQ);
+    const __m256 num = _mm256_min_ps(ay, ax);
+    const __m256 den = _mm256_max_ps(ay, ax);
+    const __m256 t = _mm256_blendv_ps(zero, _mm256_div_ps(num, den), _mm256_cmp_ps(den, zero, _CMP_GT_OQ));  // (0, 0) → 0
+
+    const __m256 reduce = _mm256_cmp_ps(t, _mm256_set1_ps(0.414213562373095f), _CMP_GT_OQ);
+    const __m256 u = _mm256_blendv_ps(t, _mm256_div_ps(_mm256_sub_ps(t, one), _mm256_add_ps(t, one)), reduce);
+    const __m256 base = _mm256_and_ps(reduce, _mm256_set1_ps(0.785398163397448f));
+    const __m256 z = _mm256_mul_ps(u, u);
+
+    __m256 q = _mm256_set1_ps(8.05374449538e-2f);
+    q = _mm256_add_ps(_mm256_mul_ps(q, z), _mm256_set1_ps(-1.38776856032e-1f));
+    q = _mm256_add_ps(_mm256_mul_ps(q, z), _mm256_set1_ps(1.99777106478e-1f));
+    q = _mm256_add_ps(_mm256_mul_ps(q, z), _mm256_set1_ps(-3.33329491539e-1f));
+    __m256 a = _mm256_add_ps(base, _mm256_add_ps(u, _mm256_mul_ps(_mm256_mul_ps(u, z), q)));  // atan(t)
+
+    a = _mm256_blendv_ps(a, _mm256_sub_ps(_mm256_set1_ps(1.57079632679490f), a), steep);          // |y| > |x|
+    a = _mm256_blendv_ps(a, _mm256_sub_ps(_mm256_set1_ps(3.14159265358979f), a), _mm256_cmp_ps(x, zero, _CMP_LT_OQ));
+    return _mm256_or_ps(a, _mm256_and_ps(y, signMask));  // y의 부호 (a >= 0)
+}
+
+// exp: x = n·ln2 + r (|r| <= ln2/2, ln2를 두 조각으로 빼서 오차 축소), e^r 다항식 × 2^n (지수 비트 직접 구성)
+FAST_MATH_KERNEL __m256 exp(__m256 x) {
+    x = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(-87.0f)), _mm256_set1_ps(88.0f));  // 2^n이 정규 수 범위
+    const __m256 n = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(1.44269504088896f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256 r = _mm256_sub_ps(x, _mm256_mul_ps(n, _mm256_set1_ps(0.693359375f)));
+    r = _mm256_sub_ps(r, _mm256_mul_ps(n, _mm256_set1_ps(-2.12194440e-4f)));
+
+    __m256 p = _mm256_set1_ps(1.9875691500e-4f);
+    p = _mm256_add_ps(_mm256_mul_ps(p, r), _mm256_set1_ps(1.3981999507e-3f));
+    p = _mm256_add_ps(_mm256_mul_ps(p, r), _mm256_set1_ps(8.3334519073e-3f));
+    p = _mm256_add_ps(_mm256_mul_ps(p, r), _mm256_set1_ps(4.1665795894e-2f));
+    p = _mm256_add_ps(_mm256_mul_ps(p, r), _mm256_set1_ps(1.6666665459e-1f));
+    p = _mm256_add_ps(_mm256_mul_ps(p, r), _mm256_set1_ps(5.0000001201e-1f));
+    const __m256 er = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(p, r), r), r), _mm256_set1_ps(1.0f));
+
+    const __m256i bits = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)), 23);
+    return _mm256_mul_ps(er, _mm256_castsi256_ps(bits));
+}
+
+// 코사인 → 도 (배열/스칼라 acosDegrees와 같은 식)
+inline __m256 acosDegrees(__m256 cosine) {
+    return _mm256_mul_ps(acos(cosine), _mm256_set1_ps(57.2957795130823f));
+}
+
+// 레인마다 두 2-D 벡터 사이 각의 코사인 (길이 0 → 1, [-1, 1]로 고정)
+// 코사인이 ±1 근처면 acos 기울기가 커서 마지막 비트 차이도 각도에서 보이므로 스칼라도 이 커널 한 벌을 씀
+FAST_MATH_KERNEL __m256 cosineBetween(__m256 ax, __m256 ay, __m256 bx, __m256 by) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 magA = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(ax, ax), _mm256_mul_ps(ay, ay)));
+    const __m256 magB = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(bx, bx), _mm256_mul_ps(by, by)));
+    const __m256 degenerate = _mm256_or_ps(_mm256_cmp_ps(magA, zero, _CMP_EQ_OQ), _mm256_cmp_ps(magB, zero, _CMP_EQ_OQ));
+    __m256 c = _mm256_div_ps(_mm256_add_ps(_mm256_mul_ps(ax, bx), _mm256_mul_ps(ay, by)), _mm256_mul_ps(magA, magB));
+    c = _mm256_min_ps(_mm256_max_ps(c, _mm256_set1_ps(-1.0f)), _mm256_set1_ps(1.0f));
+    return _mm256_blendv_ps(c, _mm256_set1_ps(1.0f), degenerate);
+}
+
+// ---------------------------------------------------------------------------
+// 배열 함수 (16개씩 + 8개 + 0으로 채운 꼬리, in과 out은 같아도 됨)
+// ---------------------------------------------------------------------------
+template <typename Kernel>
+inline void applyLanes(const float* in, float* out, int n, Kernel kernel) {
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m256 a = kernel(_mm256_loadu_ps(in + i));
+        const __m256 b = kernel(_mm256_loadu_ps(in + i + 8));
+        _mm256_storeu_ps(out + i, a);
+        _mm256_storeu_ps(out + i + 8, b);
+    }
+    for (; i + 8 <= n; i += 8) _mm256_storeu_ps(out + i, kernel(_mm256_loadu_ps(in + i)));
+    if (i < n) {
+        alignas(32) float tail[8] = {};
+        for (int k = i; k < n; k++) tail[k - i] = in[k];
+        _mm256_store_ps(tail, kernel(_mm256_load_ps(tail)));
+        for (int k = i; k < n; k++) out[k] = tail[k - i];
+    }
+}
+
+template <typename Kernel>
+inline void applyLanes(const float* in0, const float* in1, float* out, int n, Kernel kernel) {
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m256 a = kernel(_mm256_loadu_ps(in0 + i), _mm256_loadu_ps(in1 + i));
+        const __m256 b = kernel(_mm256_loadu_ps(in0 + i + 8), _mm256_loadu_ps(in1 + i + 8));
+        _mm256_storeu_ps(out + i, a);
+        _mm256_storeu_ps(out + i + 8, b);
+    }
+    for (; i + 8 <= n; i += 8) _mm256_storeu_ps(out + i, kernel(_mm256_loadu_ps(in0 + i), _mm256_loadu_ps(in1 + i)));
+    if (i < n) {
+        alignas(32) float tail0[8] = {}, tail1[8] = {};
+        for (int k = i; k < n; k++) {
+            tail0[k - i] = in0[k];
+            tail1[k - i] = in1[k];
+        }
+        _mm256_store_ps(tail0, kernel(_mm256_load_ps(tail0), _mm256_load_ps(tail1)));
+        for (int k = i; k < n; k++) out[k] = tail0[k - i];
+    }
+}
+
+// 코사인 배열 → 각도(도) 배열
+inline void acosDegrees(const float* cosines, float* degrees, int n) {
+    applyLanes(cosines, degrees, n, [](__m256 c) { return acosDegrees(c); });
+}
+
+inline void atan2(const float* y, const float* x, float* out, int n) {
+    applyLanes(y, x, out, n, [](__m256 a, __m256 b) { return atan2(a, b); });
+}
+
+inline void exp(const float* in, float* out, int n) {
+    applyLanes(in, out, n, [](__m256 v) { return exp(v); });
+}
+
+// ---------------------------------------------------------------------------
+// 스칼라 (8-lane 커널의 0번 레인)
+// ---------------------------------------------------------------------------
+inline float acosDegrees(float cosine) {
+    return _mm256_cvtss_f32(acosDegrees(_mm256_set1_ps(cosine)));
+}
+
+inline float atan2(float y, float x) {
+    return _mm256_cvtss_f32(atan2(_mm256_set1_ps(y), _mm256_set1_ps(x)));
+}
+
+inline float exp(float x) {
+    return _mm256_cvtss_f32(exp(_mm256_set1_ps(x)));
+}
+
+// 두 2-D 벡터 사이 각의 코사인 ([-1, 1]로 고정, 길이 0인 벡터가 있으면 1 → 0도)
+inline float cosineBetween(float ax, float ay, float bx, float by) {
+    return _mm256_cvtss_f32(cosineBetween(_mm256_set1_ps(ax), _mm256_set1_ps(ay), _mm256_set1_ps(bx), _mm256_set1_ps(by)));
+}
+
+}  // namespace fast_math
+
+#endif // FAST_MATH_H
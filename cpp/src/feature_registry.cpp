@@ -0,0 +1,218 @@
+#include "feature_registry.h"
+#include "fast_math.h"  // acosDegrees, cosineBetween (인식기와 같은 근사)
+
+#include <algorithm>  // std::copy, std::max, std::min
+#include <chrono>
+#include <numeric>    // std::accumulate
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int BLOCK_SIZES[FeatureArena::BLOCK_COUNT] = {210, 20, 5, 2, 19, FeatureArena::COMPLEX_SIZE, 5, 63, 126};
+const char* const BLOCK_NAMES[FeatureArena::BLOCK_COUNT] = {
+    "pairwise-distances", "wrist-distances", "finger-angles", "palm-center", "curvature",
+    "complex-features", "finger-extension", "wrist-relative-xyz", "hand-xyz"};
+
+struct OffsetTable {
+    int offsets[FeatureArena::BLOCK_COUNT];
+    int total;
+};
+
+constexpr OffsetTable makeOffsets() {
+    OffsetTable table{};
+    for (int b = 0; b < FeatureArena::BLOCK_COUNT; b++) {
+        table.offsets[b] = table.total;
+        table.total += (BLOCK_SIZES[b] + 15) / 16 * 16;  // 블록마다 64바이트 경계에서 시작
+    }
+    return table;
+}
+
+constexpr OffsetTable OFFSETS = makeOffsets();
+static_assert(OFFSETS.total <= FeatureArena::CAPACITY, "FeatureArena::CAPACITY too small");
+
+// SignRecognizer::calculateDistance / calculateAngle과 같은 식
+inline float distance(const HandLandmark& a, const HandLandmark& b) {
+    float dx = a.x - b.x;
+    float dy = a.y - b.y;
+    float dz = a.z - b.z;
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+// 각 BA-BC의 코사인 (acos는 블록 단위로 fast_math::acosDegrees 한 번)
+inline float angleCosine(const HandLandmark& a, const HandLandmark& b, const HandLandmark& c) {
+    return fast_math::cosineBetween(a.x - b.x, a.y - b.y, c.x - b.x, c.y - b.y);
+}
+
+const int FINGER_TIPS[5] = {4, 8, 12, 16, 20};
+const int FINGER_PIPS[5] = {3, 6, 10, 14, 18};
+const int FINGER_MCPS[5] = {2, 5, 9, 13, 17};
+
+}  // namespace
+
+// ============================================================
+// FeatureArena
+// ============================================================
+int FeatureArena::blockSize(Block block) {
+    return block >= 0 && block < BLOCK_COUNT ? BLOCK_SIZES[block] : 0;
+}
+
+const char* FeatureArena::blockName(Block block) {
+    return block >= 0 && block < BLOCK_COUNT ? BLOCK_NAMES[block] : "unknown";
+}
+
+const int* FeatureArena::offsets() {
+    return OFFSETS.offsets;
+}
+
+uint32_t FeatureArena::closure(uint32_t mask) {
+    if (mask & bit(COMPLEX_FEATURES)) {
+        mask |= bit(PAIRWISE_DISTANCES) | bit(WRIST_DISTANCES) | bit(FINGER_ANGLES) | bit(PALM_CENTER) | bit(CURVATURE);
+    }
+    if (mask & bit(WRIST_DISTANCES)) mask |= bit(PAIRWISE_DISTANCES);
+    return mask & ((1u << BLOCK_COUNT) - 1);
+}
+
+void FeatureArena::compute(const float* handsXyz, uint32_t mask) {
+    mask = closure(mask);
+    computed = mask;
+    if (!mask) return;
+
+    // 한 손 선택 (오른손 우선) 후 HandLandmark 배열로 복사
+    const float* right = handsXyz + HAND_FLOATS;
+    bool hasRight = std::any_of(right, right + HAND_FLOATS, [](float v) { return v != 0.0f; });
+    const float* selected = hasRight ? right : handsXyz;
+    std::copy(selected, selected + HAND_FLOATS, &landmarks[0].x);
+    const std::vector<HandLandmark>& lm = landmarks;
+    const HandLandmark& wrist = lm[0];
+
+    if (mask & bit(PAIRWISE_DISTANCES)) {
+        float* out = block(PAIRWISE_DISTANCES);
+        for (int i = 0; i < 21; i++) {
+            for (int j = i + 1; j < 21; j++) *out++ = distance(lm[i], lm[j]);
+        }
+    }
+    if (mask & bit(WRIST_DISTANCES)) {
+        // PAIRWISE 0행 (0, j) = 손목과 j의 거리 (차의 부호만 다르고 제곱이므로 같은 값)
+        const float* pairwise = block(PAIRWISE_DISTANCES);
+        std::copy(pairwise, pairwise + 20, block(WRIST_DISTANCES));
+    }
+    if (mask & bit(FINGER_ANGLES)) {
+        float* out = block(FINGER_ANGLES);
+        for (int f = 0; f < 5; f++) out[f] = angleCosine(lm[FINGER_TIPS[f]], lm[FINGER_PIPS[f]], lm[FINGER_MCPS[f]]);
+        fast_math::acosDegrees(out, out, 5);
+    }
+    if (mask & bit(PALM_CENTER)) {
+        float palmX = 0, palmY = 0;
+        for (int i = 0; i < 5; i++) {
+            palmX += lm[i].x;
+            palmY += lm[i].y;
+        }
+        float* out = block(PALM_CENTER);
+        out[0] = palmX / 5;
+        out[1] = palmY / 5;
+    }
+    if (mask & bit(CURVATURE)) {
+        float* out = block(CURVATURE);
+        for (int i = 1; i < 20; i++) out[i - 1] = angleCosine(lm[i - 1], lm[i], lm[i + 1]);
+        fast_math::acosDegrees(out, out, 19);
+    }
+    if (mask & bit(COMPLEX_FEATURES)) {
+        // extractComplexFeatures 순서로 이어 붙인 뒤 같은 z-점수 정규화
+        float* out = block(COMPLEX_FEATURES);
+        float* p = out;
+        for (Block b : {PAIRWISE_DISTANCES, WRIST_DISTANCES, FINGER_ANGLES, PALM_CENTER, CURVATURE}) {
+            p = std::copy(block(b), block(b) + BLOCK_SIZES[b], p);
+        }
+        float mean = std::accumulate(out, out + COMPLEX_SIZE, 0.0f) / COMPLEX_SIZE;
+        float variance = 0.0f;
+        for (int i = 0; i < COMPLEX_SIZE; i++) variance += (out[i] - mean) * (out[i] - mean);
+        variance /= COMPLEX_SIZE;
+        float stddev = std::sqrt(variance);
+        if (stddev > 1e-6f) {
+            for (int i = 0; i < COMPLEX_SIZE; i++) out[i] = (out[i] - mean) / stddev;
+        }
+    }
+    if (mask & bit(FINGER_EXTENSION)) {
+        // recognizeByRules: 엄지는 손목과의 X 거리, 나머지는 tip.y < pip.y < mcp.y
+        float* out = block(FINGER_EXTENSION);
+        out[0] = std::abs(lm[4].x - wrist.x) > std::abs(lm[3].x - wrist.x) ? 1.0f : 0.0f;
+        for (int f = 1; f < 5; f++) {
+            const HandLandmark& tip = lm[FINGER_TIPS[f]];
+            const HandLandmark& pip = lm[FINGER_TIPS[f] - 2];
+            const HandLandmark& mcp = lm[FINGER_TIPS[f] - 3];
+            out[f] = tip.y < pip.y && pip.y < mcp.y ? 1.0f : 0.0f;
+        }
+    }
+    if (mask & bit(WRIST_RELATIVE_XYZ)) {
+        float* out = block(WRIST_RELATIVE_XYZ);
+        for (int i = 0; i < 21; i++) {
+            out[i * 3 + 0] = lm[i].x - wrist.x;
+            out[i * 3 + 1] = lm[i].y - wrist.y;
+            out[i * 3 + 2] = lm[i].z - wrist.z;
+        }
+    }
+    if (mask & bit(HAND_XYZ)) {
+        std::copy(handsXyz, handsXyz + 2 * HAND_FLOATS, block(HAND_XYZ));
+    }
+}
+
+// ============================================================
+// FeatureRegistry
+// ============================================================
+int FeatureRegistry::registerModel(const std::string& name, uint32_t blocks, ModelFn fn, void* context) {
+    if (!fn || modelCount() >= MAX_MODELS || (blocks >> FeatureArena::BLOCK_COUNT) != 0) return -1;
+    models.push_back(Model{name, blocks, fn, context, ModelStats()});
+    mask = FeatureArena::closure(mask | blocks);
+    return modelCount() - 1;
+}
+
+void FeatureRegistry::evaluate(const float* handsXyz, Output* out) {
+    if (!timing) {
+        features.compute(handsXyz, mask);
+        for (int m = 0; m < modelCount(); m++) out[m] = models[m].fn(features, models[m].context);
+        return;
+    }
+
+    auto start = Clock::now();
+    features.compute(handsXyz, mask);
+    auto previous = Clock::now();
+    featurization.runs++;
+    featurization.totalUs += std::chrono::duration<double, std::micro>(previous - start).count();
+    for (int m = 0; m < modelCount(); m++) {
+        out[m] = models[m].fn(features, models[m].context);
+        auto now = Clock::now();
+        models[m].stats.runs++;
+        models[m].stats.totalUs += std::chrono::duration<double, std::micro>(now - previous).count();
+        previous = now;
+    }
+}
+
+void FeatureRegistry::resetStats() {
+    featurization = ModelStats();
+    for (Model& model : models) model.stats = ModelStats();
+}
+
+// ============================================================
+// 기본 모델 어댑터
+// ============================================================
+namespace registry_models {
+
+FeatureRegistry::Output rules(const FeatureArena& arena, void* recognizer) {
+    (void)recognizer;  // 규칙 판정은 인스턴스 상태를 쓰지 않음
+    RecognitionResult r = SignRecognizer::classifyFingerPattern(arena.block(FeatureArena::FINGER_EXTENSION));
+    return {r.id, r.confidence};
+}
+
+FeatureRegistry::Output network(const FeatureArena& arena, void* recognizer) {
+    RecognitionResult r = static_cast<SignRecognizer*>(recognizer)->recognizeFromFeatures(
+        arena.block(FeatureArena::COMPLEX_FEATURES), FeatureArena::COMPLEX_SIZE,
+        arena.block(FeatureArena::FINGER_EXTENSION));
+    return {r.id, r.confidence};
+}
+
+FeatureRegistry::Output mlp(const FeatureArena& arena, void* recognition) {
+    return {static_cast<SignRecognition*>(recognition)->predictMLPFromPointer(arena.block(FeatureArena::HAND_XYZ)), -1.0f};
+}
+
+}  // namespace registry_models
@@ -0,0 +1,139 @@
+#ifndef FEATURE_REGISTRY_H
+#define FEATURE_REGISTRY_H
+
+#include "sign_recognition.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * 특징 블록 영역 (프레임 하나의 공유 특징)
+ *
+ * - 입력은 데이터셋 행과 같은 두 손 좌표 126개 (왼손 63 + 오른손 63, 손마다 21 x (x, y, z))
+ * - 한 손 특징은 오른손 값이 하나라도 0이 아니면 오른손, 아니면 왼손에서 계산
+ * - 블록마다 고정 오프셋(64바이트 정렬)을 갖고, compute()는 요청된 블록과 그 의존 블록만 채움
+ *   (요청되지 않은 블록의 값은 이전 프레임 그대로이므로 읽지 않음)
+ * - 지터 필터는 적용하지 않음 (필요하면 입력 전에 적용)
+ */
+class FeatureArena {
+public:
+    enum Block {
+        PAIRWISE_DISTANCES = 0,  // 210: 모든 랜드마크 쌍 거리 (i < j, extractComplexFeatures 순서)
+        WRIST_DISTANCES,         // 20: 랜드마크 1..20과 손목 거리 (PAIRWISE 0행 재사용)
+        FINGER_ANGLES,           // 5: 손가락별 tip-pip-mcp 각도 (도)
+        PALM_CENTER,             // 2: 랜드마크 0..4 평균 (x, y)
+        CURVATURE,               // 19: 연속 세 랜드마크 각도 (도)
+        COMPLEX_FEATURES,        // 256: 위 다섯 블록을 이어 붙여 z-점수 정규화 (extractComplexFeatures와 같은 값)
+        FINGER_EXTENSION,        // 5: 엄지/검지/중지/약지/소지 펴짐 (1/0, recognizeByRules와 같은 판정)
+        WRIST_RELATIVE_XYZ,      // 63: 손목 기준 상대 좌표
+        HAND_XYZ,                // 126: 두 손 원본 좌표 (SignRecognition 입력)
+        BLOCK_COUNT
+    };
+
+    static constexpr uint32_t bit(Block block) { return 1u << block; }
+
+    static constexpr int COMPLEX_SIZE = 256;
+    static constexpr int HAND_FLOATS = 63;
+    static constexpr int CAPACITY = 784;  // 블록 크기를 16 float 단위로 올려 합한 값
+
+    static int blockSize(Block block);
+    static const char* blockName(Block block);
+
+    // 의존 블록까지 포함한 마스크 (COMPLEX_FEATURES → 거리/각도/손바닥/곡률, WRIST_DISTANCES → PAIRWISE)
+    static uint32_t closure(uint32_t mask);
+
+    // handsXyz[126]에서 mask(closure 적용 후)의 블록만 계산
+    void compute(const float* handsXyz, uint32_t mask);
+
+    const float* block(Block b) const { return data + offsets()[b]; }
+    const std::vector<HandLandmark>& hand() const { return landmarks; }  // 선택된 한 손 21개
+    uint32_t computedMask() const { return computed; }
+
+private:
+    static const int* offsets();  // 블록별 시작 위치 (float 단위, 16 배수)
+
+    float* block(Block b) { return data + offsets()[b]; }
+
+    alignas(64) float data[CAPACITY];
+    std::vector<HandLandmark> landmarks = std::vector<HandLandmark>(21);
+    uint32_t computed = 0;
+};
+
+/**
+ * 다중 모델 등록부 (그림자 모델 A/B 비교용)
+ *
+ * - 모델은 등록할 때 소비하는 특징 블록 마스크를 선언
+ * - evaluate()는 등록된 모든 모델 마스크의 합집합만 FeatureArena에 한 번 계산하고 모든 모델에 전달
+ *   → 모델을 하나 더 붙이는 비용은 그 모델의 추론뿐 (특징 추출 중복 없음)
+ * - 모델 함수는 함수 포인터 + context (할당/가상 호출 없음), 등록 순서대로 호출
+ * - 인스턴스는 영역과 통계를 소유하므로 스레드마다 하나씩 사용
+ */
+class FeatureRegistry {
+public:
+    struct Output {
+        int id;
+        float confidence;  // -1: 신뢰도를 내지 않는 모델 (예: SignRecognition MLP)
+    };
+
+    typedef Output (*ModelFn)(const FeatureArena& arena, void* context);
+
+    struct ModelStats {
+        uint64_t runs = 0;
+        double totalUs = 0.0;  // 추론 시간 합 (특징 추출 제외)
+    };
+
+    static constexpr int MAX_MODELS = 16;
+
+    // 모델 등록, 인덱스 반환 (-1: 최대 개수 초과 / fn 없음 / 알 수 없는 블록)
+    int registerModel(const std::string& name, uint32_t blocks, ModelFn fn, void* context);
+
+    int modelCount() const { return static_cast<int>(models.size()); }
+    const std::string& modelName(int index) const { return models[index].name; }
+    uint32_t modelBlocks(int index) const { return models[index].blocks; }
+    uint32_t featureMask() const { return mask; }  // 등록된 모델 블록의 합집합 (의존 포함)
+
+    // 프레임 하나 평가: out[modelCount()]에 등록 순서대로 결과 기록
+    void evaluate(const float* handsXyz, Output* out);
+
+    const FeatureArena& arena() const { return features; }
+
+    // 계측 (evaluate마다 steady_clock, timing을 끄면 측정 생략)
+    void setTiming(bool enabled) { timing = enabled; }
+    const ModelStats& modelStats(int index) const { return models[index].stats; }
+    const ModelStats& featureStats() const { return featurization; }
+    void resetStats();
+
+private:
+    struct Model {
+        std::string name;
+        uint32_t blocks;
+        ModelFn fn;
+        void* context;
+        ModelStats stats;
+    };
+
+    std::vector<Model> models;
+    uint32_t mask = 0;
+    FeatureArena features;
+    ModelStats featurization;
+    bool timing = false;
+};
+
+/**
+ * 기본 모델 어댑터 (context는 각각 SignRecognizer* / SignRecognition*)
+ * - 규칙: FINGER_EXTENSION
+ * - 210 특징 신경망 + 규칙 폴백 (recognize와 같은 결과): COMPLEX_FEATURES | FINGER_EXTENSION
+ * - SignRecognition MLP: HAND_XYZ (스케일러는 호출자가 미리 설정)
+ */
+namespace registry_models {
+constexpr uint32_t RULES_BLOCKS = FeatureArena::bit(FeatureArena::FINGER_EXTENSION);
+constexpr uint32_t NETWORK_BLOCKS = FeatureArena::bit(FeatureArena::COMPLEX_FEATURES) | RULES_BLOCKS;
+constexpr uint32_t MLP_BLOCKS = FeatureArena::bit(FeatureArena::HAND_XYZ);
+
+FeatureRegistry::Output rules(const FeatureArena& arena, void* recognizer);
+FeatureRegistry::Output network(const FeatureArena& arena, void* recognizer);
+FeatureRegistry::Output mlp(const FeatureArena& arena, void* recognition);
+}  // namespace registry_models
+
+#endif // FEATURE_REGISTRY_H
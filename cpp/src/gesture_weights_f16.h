@@ -0,0 +1,9 @@
+// 자동 생성: tools/weights_f16.cpp (make weights-f16), 직접 수정하지 말 것
+// W1/W2/W3: IEEE half (uint16_t), B1/B2/B3: fp32
+#include <cstdint>
+static const uint16_t W1[] = {0x2c53, 0xa9e6, 0x2ce8, 0xaeed, 0xa51a, 0xa147, 0x25fc, 0xaafd, 0x2ea3, 0xa9a1, 0x22b1, 0x2ef1, 0x2afd, 0xa648, 0x270f, 0x2927, 0xaace, 0xaadd, 0x2f79, 0xad4c, 0xac47, 0x296d, 0xa861, 0x295d, 0x2ba5, 0x25f1, 0xa460, 0x2f10, 0xab89, 0xa955, 0xaaba, 0x29b3, 0xa232, 0x2d3e, 0x2a0b, 0x1de2, 0x2c67, 0x25bc, 0xab49, 0xa48d, 0x9d77, 0xadd2, 0x83ab, 0xa0a8, 0xa761, 0xa990, 0x2a89, 0xae15, 0xa045, 0x2e8b, 0x9059, 0x2f70, 0xaacd, 0x240d, 0x2ce2, 0x2e9f, 0xac8c, 0x2dca, 0x2c9e, 0xa816, 0x2eda, 0xaace, 0xaa44, 0x2945, 0x9b0d, 0xac02, 0x2e7d, 0xad93, 0x2d92, 0x2cb2, 0x285f, 0xa38c, 0xa87c, 0xa847, 0x1fcc, 0xb010, 0xac72, 0x2f28, 0x288e, 0xac3d, 0xaccf, 0xad69, 0xa83f, 0xa594, 0x26cc, 0xaaf7, 0x2ce4, 0x2808, 0xaab9, 0x2e85, 0xa8e1, 0x192c, 0xae53, 0xacac, 0x2a55, 0xa7d1, 0xa9c2, 0x280d, 0xa3ad, 0x2431, 0x99be, 0x26dd, 0x1660, 0x2df8, 0xaa39, 0x2848, 0x2e0d, 0x2a5e, 0x2416, 0x24af, 0x2d15, 0xac7d, 0x2cb5, 0x2c45, 0xa993, 0xa6ff, 0xad35, 0xa5f5, 0x2a14, 0x2c89, 0x233f, 0x2f9a, 0x187a, 0xaeff, 0xa839, 0x2af4, 0x9f7f, 0xa8f9, 0xac50, 0x20be, 0x2d9f, 0x9a71, 0xa413, 0xa83f, 0x2834, 0x2905, 0xab16, 0xafe6, 0xa7d3, 0x15ba, 0xa00c, 0x2ddb, 0x21e6, 0xaa67, 0xabdf, 0x28e8, 0xa6a4, 0x2aa8, 0xa8e4, 0xaf86, 0x2109, 0x304e, 0xaf41, 0x2515, 0xacb2, 0x29be, 0xadf4, 0xabd1, 0x2c28, 0x2c20, 0xac8a, 0x2cf2, 0xaa45, 0xacd4, 0x2530, 0x9e86, 0x2270, 0xa7ff, 0x248a, 0xa449, 0x2e69, 0xadfb, 0xa30c, 0x2f83, 0xacc5, 0xaaa6, 0x3060, 0xa970, 0xa917, 0x2c11, 0x947e, 0x2c77, 0xac26, 0xa6ce, 0x2333, 0x2371, 0xa362, 0xa7a1, 0x2933, 0xac97, 0x2c75, 0x2aa6, 0xa423, 0xa2e1, 0xaff4, 0xb028, 0x2500, 0xaf7a, 0xae8d, 0x2d98, 0x2639, 0x2ec6, 0xad20, 0xae92, 0x20a1, 0xa9bf, 0xa90d, 0xab36, 0x2446, 0x2bac, 0x2c83, 0x988a, 0xac13, 0x23b8, 0x2f47, 0xa212, 0xaa69, 0x27e8, 0x2d3a, 0xabe1, 0xac71, 0x29d8, 0xac3d, 0x2d7c, 0x2de7, 0x2dbb, 0xaf11, 0x276c, 0x96d1, 0xab3d, 0xa938, 0x183b, 0xa53b, 0xaa0d, 0x2bdd, 0x292e, 0xa905, 0x2e13, 0xaa18, 0x270b, 0xa8a9, 0xae62, 0x2618, 0x2ce9, 0x1bc0, 0x1fd1, 0x2c9a, 0x2e2b, 0xa3e0, 0x2639, 0x2d34, 0x28fa, 0x2d44, 0xaaf2, 0x9c40, 0x2c77, 0xaa81, 0xa48c, 0x2908, 0xa95d, 0x2749, 0x28e0, 0x24d9, 0x2347, 0x1ebe, 0x2e52, 0xa5d6, 0x9d27, 0x2b97, 0x2ab1, 0x28d8, 0xa093, 0x2e70, 0x2c4e, 0x94dc, 0x20ca, 0xa4e4, 0xaa49, 0x3033, 0x2b91, 0x2b8c, 0x2a3d, 0x25d6, 0xad3f, 0xadb8, 0xa28e, 0xac3b, 0xa347, 0x9277, 0x2b69, 0xa84b, 0x256c, 0xa99f, 0xa8ef, 0xa76d, 0xad65, 0x9dfc, 0xaceb, 0xaa4e, 0xad30, 0x2abf, 0xa562, 0x25be, 0x2c34, 0x2978, 0x2c32, 0xa550, 0x2392, 0x2d61, 0x9d1c, 0xa300, 0xa530, 0x2bb6, 0xae30, 0xaa0d, 0xa583, 0x21f8, 0x28cd, 0x2fd9, 0x2966, 0x26a7, 0xa5b4, 0xa83b, 0xa8e8, 0x2f2d, 0x2ee8, 0x2f6f, 0xa1d8, 0x2e54, 0x2697, 0x2ddf, 0x2d82, 0x2ca3, 0x2a13, 0x2cd4, 0x296b, 0x2e03, 0x2a90, 0x93ff, 0x142f, 0x2994, 0x1e9d, 0x2b2c, 0xa456, 0xab0e, 0x2358, 0xa409, 0xa2ba, 0x2ae5, 0x9b83, 0x296e, 0xac82, 0xa1fa, 0xac21, 0x2bd0, 0x2955, 0xa9d9, 0x9d6f, 0x2e9b, 0x2d58, 0x2de5, 0x2b25, 0x264d, 0x2c2c, 0x28c1, 0xabd2, 0x9646, 0x2dec, 0xa5ed, 0x2210, 0x1bd3, 0x9e03, 0xae62, 0xa515, 0x2d67, 0xab54, 0x2ce7, 0xac8f, 0x22fb, 0xa5a4, 0xa9de, 0x2ea0, 0x2751, 0x2184, 0x2fd1, 0xa407, 0xb08f, 0x2851, 0x2c8d, 0xad3b, 0xabca, 0xac59, 0xad48, 0x29be, 0x24e6, 0x2d15, 0xa874, 0xac94, 0xaf94, 0x28c0, 0x2c06, 0x211b, 0x2604, 0x2d23, 0xaa99, 0xacbd, 0xaf0d, 0x9ac3, 0xacf9, 0x2ab6, 0x25d4, 0xa9ea, 0xa8b9, 0x2b3b, 0xae31, 0xad93, 0x2e9a, 0xac7f, 0x2435, 0xab30, 0x27e1, 0x2a61, 0x2cae, 0x24a6, 0xaef1, 0x2803, 0x24fe, 0xa5e6, 0x3039, 0xae0a, 0x2ad6, 0x2d5b, 0x2afb, 0x22e6, 0xab15, 0x221c, 0x2c0e, 0xab14, 0xaa97, 0xa1c6, 0x9ff8, 0x225b, 0xa98f, 0xaacd, 0x29fb, 0x2c59, 0xa9a7, 0x24f8, 0xa667, 0xa308, 0xaaa2, 0xad63, 0xad35, 0x2fbf, 0x258f, 0xb00e, 0x1e41, 0xac6b, 0x26d2, 0xa34b, 0xa8e3, 0xaba8, 0x2b21, 0x261b, 0xb02d, 0xa904, 0x2c84, 0xa78b, 0x2dc4, 0x2609, 0x2b24, 0x251b, 0xaa87, 0x1d44, 0xacec, 0xa8d8, 0xab23, 0x28c7, 0xa496, 0x2c00, 0x29f1, 0xacd3, 0x29a4, 0x24c4, 0x21b9, 0xa536, 0xa5d4, 0xaee4, 0x2fd1, 0x1ec8, 0x1a92, 0xa10d, 0x2df5, 0xab57, 0x2888, 0x2cc9, 0x2303, 0xaf43, 0xa648, 0x2e5f, 0xa69d, 0xa229, 0xa6a9, 0x2c84, 0xa971, 0xad00, 0xab56, 0x2ecd, 0x2c40, 0xa90f, 0x2e74, 0x2ff1, 0xac66, 0xa5e5, 0xab6d, 0xacf3, 0x26f8, 0xa896, 0x2702, 0x292e, 0xaec6, 0x9cfa, 0xa805, 0x9dc4, 0xabbd, 0xaf9c, 0x2a60, 0x230d, 0xad09, 0x25d4, 0x2615, 0x2afc, 0xaefb, 0x2d14, 0xa039, 0x251a, 0x2a3d, 0xa4b0, 0xa728, 0x2ca9, 0x272b, 0xac57, 0x2f2c, 0xaed5, 0xa98e, 0x2f7c, 0xa9e0, 0x29f3, 0x2986, 0x29fe, 0x2951, 0x2e5b, 0xaad8, 0xa8ec, 0x2e5f, 0x244b, 0xa4e2, 0x0f92, 0xa85d, 0xad23, 0xa230, 0x24b8, 0x9e77, 0x279b, 0xac0c, 0x1ba6, 0xa884, 0xabcb, 0xac40, 0x29ca, 0x9d7a, 0x2e3c, 0xafcd, 0xaf16, 0x2cc1, 0x1dec, 0x20a5, 0x22ed, 0xaee4, 0xa8a8, 0xabc7, 0xacf2, 0xa393, 0xabe0, 0x2c82, 0x2d82, 0xacfe, 0xaa66, 0x2d8f, 0x2eb1, 0xa97b, 0x2ee1, 0x2f1d, 0xab6a, 0x2ef9, 0x24e5, 0x2c4a, 0xaa4b, 0xaafb, 0x2d0a, 0x25ce, 0xa2fc, 0x0486, 0x2aa4, 0xa054, 0xa1ce, 0x2791, 0x806f, 0x2c55, 0x2a6b, 0xa8e5, 0xac45, 0x2a30, 0x27e0, 0xa9ac, 0x28b8, 0xa42a, 0x2c64, 0x9d8d, 0xaec1, 0x2da1, 0x2aca, 0xa89d, 0xa62f, 0xa9d3, 0xa8fb, 0x24b2, 0xa99d, 0x2795, 0x2db2, 0xac50, 0xa170, 0x272d, 0x2f29, 0xafc4, 0x1d51, 0x9f1c, 0xa67d, 0x2f73, 0xa843, 0xadc2, 0x2d94, 0x2d10, 0x2817, 0x2d5b, 0xac60, 0xaca2, 0x2b3a, 0x1faa, 0x295a, 0xa403, 0x2bd0, 0x2955, 0x9b76, 0xa4e4, 0x2542, 0xa1cf, 0x2daf, 0xa76b, 0x2d94, 0xaab3, 0xae3f, 0x266d, 0x2d2e, 0xa502, 0xa51c, 0xa7eb, 0xaa3c, 0x2efd, 0x1ecd, 0x28dd, 0x2b0e, 0xa86a, 0xa501, 0xa13c, 0x2c3d, 0xac56, 0x993e, 0xa419, 0x2025, 0xa8e4, 0xa403, 0xaa8a, 0x2970, 0xa257, 0xacd5, 0xa938, 0xac22, 0x2cb6, 0xa8d6, 0x251a, 0xa717, 0x9ca4, 0xac6e, 0xac01, 0xad25, 0x9ea5, 0xb029, 0xa97b, 0xad7d, 0x9774, 0x3003, 0x247e, 0xaab9, 0x2f94, 0x253b, 0xaeaf, 0x2d13, 0x1949, 0xad84, 0x2996, 0xae7e, 0xad34, 0x2f2d, 0xaede, 0xa1e5, 0x20d0, 0x2892, 0xa7bb, 0x2b60, 0xadc8, 0xa876, 0x254b, 0xaea4, 0x294d, 0xa41f, 0xad5d, 0xaa7d, 0xa841, 0xa9b0, 0xad3c, 0x9473, 0xae33, 0x284c, 0x283f, 0xaf75, 0x2321, 0x2caf, 0x29a8, 0xa15d, 0xa449, 0x28d5, 0x28c7, 0x2e88, 0xa236, 0x2c4b, 0xadbd, 0xac99, 0xa8fd, 0x284e, 0x2afd, 0x8d83, 0x230b, 0xaa9f, 0x2b15, 0xa3aa, 0xa92f, 0xa772, 0xa186, 0xaa20, 0x2b5d, 0x272d, 0xa93d, 0xa8e1, 0x2cfe, 0x2c82, 0x2cb4, 0x2dfd, 0x21dc, 0x2cb3, 0x2c54, 0x2ee9, 0x2980, 0x93b8, 0xa785, 0xad94, 0x2e34, 0x2cc9, 0xb0c4, 0x9b11, 0x2dcf, 0xa9de, 0x307a, 0x2e9e, 0xadf3, 0xaae6, 0x2db2, 0x9e6e, 0xaec5, 0x20f1, 0x24ac, 0xad52, 0xadbb, 0x2f00, 0xacbc, 0xac60, 0xa321, 0x2eb9, 0xaa20, 0xadc1, 0xa861, 0x28b7, 0xad37, 0xab16, 0x25e2, 0xaa22, 0xafb7, 0x23ea, 0xaef0, 0x159a, 0xaaf2, 0xa6b1, 0x2cdd, 0xa782, 0xaffa, 0xae3e, 0x2dfd, 0xb100, 0xac46, 0xa87a, 0x25dc, 0xa8fa, 0x2d54, 0x8dbf, 0x2848, 0x2de2, 0x1dfb, 0x99ed, 0x2a90, 0xa87f, 0x2fcd, 0xa964, 0x2e7d, 0x26e1, 0x2eba, 0x2a32, 0xac5c, 0x2ed3, 0x2c0a, 0x2efc, 0xaccd, 0xa0d2, 0x2a60, 0xadb3, 0x2621, 0x3020, 0xac43, 0xa5fe, 0x298d, 0x2da3, 0x24e2, 0xa7d9, 0x19ba, 0xa598, 0xab11, 0x2e3e, 0xa95d, 0xad01, 0x2afd, 0xa8bc, 0x29ee, 0x229c, 0x2d05, 0x2632, 0xaaf2, 0x2dcf, 0xab15, 0x2281, 0x2d4e, 0xadb2, 0xab94, 0x2d49, 0x2e5f, 0xa93b, 0xa6d0, 0x9242, 0x25fe, 0xabc7, 0x2c20, 0x2138, 0xaadc, 0x9e3c, 0xace3, 0x2306, 0xa49e, 0x2bac, 0x2bef, 0x2538, 0xa8a8, 0x2c49, 0x2d6b, 0xa816, 0x2b05, 0xab52, 0x1893, 0xa5ac, 0x2c09, 0x2e9a, 0x16d5, 0xa896, 0x2eb4, 0x2be3, 0xa41e, 0xac3a, 0x2c3a, 0xa25c, 0x2b17, 0x2c02, 0x2412, 0x2edb, 0xaefe, 0x2b0e, 0x2424, 0x23fe, 0xa4c6, 0x2da3, 0xaf0a, 0xaa42, 0xad97, 0x24cf, 0xaa66, 0xa6e0, 0x23c0, 0xa8ac, 0x2f04, 0x1fd1, 0xa99e, 0xad1f, 0xaf69, 0xa8dc, 0x189c, 0xabcb, 0x2560, 0x2841, 0xae37, 0xaf75, 0x2722, 0xa713, 0x2534, 0x2bc2, 0x2e72, 0xa80a, 0x2526, 0x2fa3, 0x2435, 0xa75f, 0x2d6f, 0xa81a, 0xad25, 0x2aa4, 0x20c4, 0xacfb, 0xa407, 0xa464, 0x954a, 0x18db, 0x2cc0, 0xac08, 0xac27, 0x2f18, 0x21dd, 0x2774, 0xaaad, 0xaf56, 0xa95d, 0xa535, 0x29dd, 0xad7c, 0xac6e, 0xadf5, 0x2b0f, 0xabb9, 0x2a14, 0xae75, 0x2472, 0x2b0d, 0xaefa, 0x2af3, 0xad4b, 0xad9f, 0x2f32, 0xaf65, 0xacdb, 0x27fb, 0x2ac7, 0xae12, 0x29a4, 0xa91d, 0xa88a, 0x27a6, 0xaf26, 0xa9bc, 0x2cb9, 0x2b43, 0xac68, 0x2c98, 0xadd8, 0xa5fd, 0xade1, 0xa435, 0xa4f5, 0xa829, 0xac2c, 0x11ee, 0x2c56, 0x2aff, 0x9980, 0xaae6, 0x96b3, 0xa756, 0x2c9b, 0xabe7, 0xa9ce, 0xae94, 0xab85, 0xaabb, 0xab90, 0x29df, 0x2bc7, 0xa58b, 0xa5a9, 0x2248, 0x93e7, 0x1e05, 0x2d4c, 0x1dbd, 0x2832, 0x2ea1, 0x2a24, 0x25ae, 0x2ce2, 0xadc7, 0x2a43, 0x2db1, 0x2942, 0x2d85, 0x2cc5, 0xa80f, 0x1b39, 0x2e84, 0xaf01, 0xa661, 0xabcc, 0x9902, 0x2c2e, 0x258c, 0xad59, 0xab37, 0x2d2d, 0xaaa2, 0xa7f3, 0x284d, 0xa65e, 0xa8e2, 0x2e6c, 0xa5ca, 0x254f, 0x272e, 0xae44, 0xa43b, 0x2cb0, 0x297a, 0x2b22, 0x29a7, 0xaa0c, 0x2b5d, 0x2ee3, 0xad96, 0x9cfb, 0x2c10, 0xa350, 0xa827, 0xa124, 0xa2ea, 0x9d05, 0xa715, 0xa818, 0xaafa, 0xab40, 0xac81, 0x2f3d, 0xa975, 0xaf40, 0x2e8e, 0xaefb, 0x26fa, 0xa87a, 0xa496, 0x1e1b, 0x19b5, 0xa86f, 0xa687, 0x2c8f, 0x2495, 0x2399, 0xa76f, 0xad1c, 0xaa57, 0x2b5a, 0x2deb, 0xad8b, 0x1c80, 0x2c4d, 0x24c1, 0xa98e, 0xaaa0, 0xacb3, 0x2a6e, 0x262d, 0xaf60, 0xad29, 0xa82f, 0x1c25, 0xa954, 0x2f15, 0x20c1, 0xabb2, 0x2f1b, 0x2a8f, 0xaa99, 0x2667, 0xaf0b, 0x2680, 0xa89b, 0x2290, 0x2c70, 0x2790, 0xaeb7, 0xac3c, 0xabb3, 0x85b1, 0x2c55, 0xa4f2, 0x2aa5, 0xaaaa, 0x2bd9, 0x26a0, 0xa9cd, 0xa35b, 0x25e8, 0x2dbf, 0x9b16, 0xa8ac, 0x2bc6, 0xac63, 0x2892, 0x2eed, 0x2c6f, 0x2641, 0x2b24, 0xa714, 0x2a17, 0xa9ab, 0x9e95, 0x2b49, 0x2b45, 0xaf27, 0xab64, 0xa48a, 0xa40a, 0x2bb2, 0xac30, 0x2792, 0x22f8, 0x2b6a, 0x29f3, 0x2c26, 0x2c1f, 0x9fbc, 0xac56, 0xa383, 0xa5b7, 0xa1f4, 0x2d4a, 0x2b6d, 0xacce, 0xa65a, 0x2135, 0x2b70, 0xa486, 0x093d, 0x280c, 0xab1f, 0xa5c4, 0xae4c, 0x214d, 0x2bc2, 0x29f9, 0xad90, 0xa4a6, 0xab5b, 0xacaa, 0xa983, 0xa719, 0xa846, 0xaf95, 0x2c5c, 0xa264, 0xaa6e, 0x2500, 0x2e67, 0x1f98, 0x29f3, 0x24ef, 0x2dfb, 0x2b9a, 0x3004, 0x28de, 0x2f17, 0x2dd3, 0x283d, 0x2e59, 0x267d, 0x2a28, 0xa052, 0x1c89, 0x1e49, 0xacaf, 0x2aa7, 0x2a37, 0x20a9, 0xacff, 0xa1c1, 0xa9d2, 0x2a65, 0xa7a9, 0x2c32, 0xaa75, 0x2d71, 0xaa3e, 0x2c21, 0x2f83, 0xab46, 0x25c3, 0x9e69, 0xa4d2, 0xabdb, 0x9a1a, 0xa9af, 0xa9a3, 0x2f9a, 0x2eab, 0x2d77, 0x2dd8, 0x2da2, 0xadab, 0x2ae8, 0x286b, 0x2c23, 0x1ec7, 0x2a27, 0xa7c3, 0xa8a7, 0x9abb, 0xa58d, 0xa27c, 0x2c2b, 0xabe8, 0x24b0, 0x2c0a, 0xa1ca, 0xad2f, 0xac97, 0xab83, 0x2a12, 0x2bbe, 0x2e97, 0xab87, 0x29ab, 0x2d5c, 0x278f, 0x299e, 0x2ed2, 0x1fc1, 0x2202, 0xa8e4, 0xac49, 0x2d63, 0x279f, 0xa363, 0xa6fb, 0x27cb, 0x2bc2, 0x9ec6, 0xa986, 0xa6db, 0x2deb, 0x2e1f, 0x9d68, 0xac2a, 0x2c23, 0xab75, 0x2a4e, 0x2a9b, 0xac2b, 0x2114, 0x2e62, 0x259e, 0xaab4, 0x2ced, 0xae3e, 0xa81e, 0x2a7a, 0xa036, 0xa669, 0x9d8c, 0x28c5, 0x2ea7, 0xaa44, 0x2617, 0x2c78, 0x2dfc, 0xac80, 0x22a2, 0x2d8e, 0xac3a, 0xab1a, 0x27b2, 0xa9aa, 0xa8f8, 0x2aa9, 0x2815, 0xaac8, 0xa8c4, 0x2bed, 0x28cf, 0xa936, 0xaffc, 0x2e7e, 0xa335, 0xa759, 0x2bc7, 0x9aa3, 0xa93f, 0x24ca, 0xaea3, 0xa51d, 0xa6ee, 0x285d, 0xa7c3, 0x2f54, 0xaa2f, 0xad9c, 0xa81a, 0xadfd, 0xaca5, 0x2b63, 0xa818, 0xace4, 0x2942, 0xaa85, 0xab18, 0x2bf7, 0xabdd, 0xa271, 0x2b8a, 0x9e8e, 0x9e4e, 0x2d6e, 0x271d, 0xae06, 0x2d13, 0xa121, 0x1b4d, 0xa185, 0x2758, 0x9965, 0xa0dd, 0x2067, 0xaf27, 0x113e, 0xad5e, 0xae17, 0xa58f, 0xa3f5, 0xa3fa, 0xaf4c, 0x1e56, 0xad44, 0x2a24, 0xa8c7, 0xa86f, 0x23f7, 0xae46, 0x2624, 0x2fb8, 0x9d73, 0xaa63, 0x2c8d, 0x2b2a, 0x2fd7, 0x21b4, 0x2fa5, 0x2b9c, 0xa86e, 0xa5cd, 0xa8e3, 0x2c10, 0xa0c4, 0x2c05, 0xaab8, 0xa00e, 0x2ee7, 0x2a8b, 0x9e0c, 0x2894, 0xaa44, 0xadbb, 0x20b8, 0x2946, 0x297c, 0x282d, 0x2466, 0xae39, 0xa4c9, 0x2c08, 0x2610, 0xae20, 0x2bf6, 0xae14, 0x24e3, 0xa978, 0xa46c, 0x26c4, 0x27c3, 0xad4b, 0x2846, 0x2e81, 0xaee9, 0x2130, 0x16cd, 0xabaf, 0xaf87, 0x2b55, 0xae7e, 0xac15, 0x286e, 0xace8, 0xa890, 0x2b8c, 0xab0b, 0xaf2c, 0x2a0d, 0xad03, 0xada4, 0x2de2, 0x2a45, 0x24f5, 0x9655, 0xa844, 0x21e4, 0x2209, 0xac5c, 0x2e74, 0x1b57, 0xaf35, 0xa2bb, 0x2e79, 0xae36, 0x2dbf, 0x2d89, 0x2af6, 0xa868, 0x2844, 0x2cf0, 0xa36d, 0x2c79, 0x297b, 0xa598, 0x2e1a, 0x2ea4, 0x1ebe, 0x2ca5, 0xaba0, 0x2589, 0xa9ca, 0xaab3, 0xae45, 0x2506, 0x2cfd, 0x2b5c, 0x2773, 0x202a, 0xaa5a, 0x2aa6, 0x2847, 0x25fe, 0x24bc, 0x2f9c, 0x230a, 0x993e, 0x2e9f, 0xadf1, 0x20e4, 0x2e17, 0x2535, 0xab71, 0xa91f, 0xacb4, 0xaa73, 0x2e8c, 0xad75, 0x2152, 0x2a44, 0xa6b9, 0x261b, 0xa60a, 0x2a3b, 0x2cab, 0x2a40, 0xaa11, 0xa991, 0x9083, 0xa6af, 0xaafd, 0xac0b, 0xa1ad, 0x2e22, 0x94ea, 0x2cf9, 0x2dc7, 0x18e9, 0x2bb2, 0x3079, 0x2f81, 0xa869, 0xa7db, 0x21e1, 0x2102, 0x2ac3, 0xad46, 0x9e82, 0x2f78, 0x2d10, 0xab92, 0x2db1, 0x2c2f, 0xb00b, 0x2ad5, 0x266c, 0x2e99, 0xa94b, 0xa7db, 0x2d77, 0xae5d, 0xadc3, 0x2984, 0xa762, 0xac51, 0x2f0b, 0x27bc, 0xab60, 0x2e08, 0xaa71, 0xa782, 0x276e, 0xa5d9, 0x2c20, 0x2bd5, 0xaf49, 0xabcc, 0xa0b2, 0x2233, 0x2cf2, 0x250b, 0x2e23, 0xa9f6, 0xa69a, 0x2757, 0xa5d2, 0xaf38, 0xa11c, 0x2072, 0xaca1, 0x2445, 0xa5d3, 0x28cc, 0xab1e, 0xa859, 0x2d36, 0x2f77, 0x2e6a, 0x2d85, 0x2c8c, 0xa36d, 0x2cec, 0x2d33, 0x263b, 0x2c74, 0x2f23, 0x291b, 0xa4db, 0xa8ac, 0xa900, 0x2af7, 0x2c1a, 0xab03, 0xafaf, 0x25ef, 0x2ad0, 0xb010, 0x2fef, 0x2d87, 0x261b, 0x2b48, 0xa585, 0x2991, 0xa7d7, 0x2a6b, 0x25b8, 0xa5f1, 0x2a20, 0x2976, 0xac20, 0x2945, 0x2c59, 0x2c9f, 0x2e0b, 0x245d, 0xac69, 0x2866, 0xa4cd, 0x266b, 0x173c, 0xa7a5, 0xa7b7, 0x2d41, 0x2c9b, 0xa904, 0xab79, 0xa7ff, 0x2c9a, 0x8193, 0xaf30, 0xa2c9, 0x2c9d, 0xad0a, 0xaa3f, 0xa4d2, 0x2caf, 0xaa31, 0xa08e, 0x2c01, 0xa8b9, 0x257e, 0xa5ac, 0x2969, 0xada5, 0x102e, 0x2ea4, 0x2e6e, 0x2d5b, 0x2ec1, 0xa431, 0x24ca, 0x2c49, 0x25e9, 0xacc1, 0xa899, 0xa4c2, 0xb08a, 0x2947, 0x2cb5, 0xac23, 0x2f9f, 0xa5eb, 0x2c87, 0x2d81, 0x2543, 0x2b76, 0x267c, 0xaecd, 0x2d46, 0x2b49, 0xacbe, 0x2b60, 0x2b11, 0x2855, 0x2b71, 0xac98, 0x97d1, 0xa571, 0xac84, 0x18f8, 0xa6e8, 0xadd2, 0xaccd, 0x2950, 0xacd0, 0xaaa9, 0x29ff, 0x2abc, 0xa640, 0x2aad, 0xabd9, 0xa310, 0xad88, 0xa3ba, 0xa8a8, 0xaf94, 0xaea9, 0x2446, 0x9843, 0x20a5, 0xacea, 0x2d54, 0x2e81, 0x254d, 0x1d6e, 0x27d8, 0x2c57, 0x2c98, 0x2047, 0xb02d, 0x1feb, 0x2d4b, 0xa330, 0x2f7e, 0xa71b, 0x2943, 0x2c59, 0x8ff2, 0xa606, 0xa104, 0x2ed9, 0x1d73, 0xac1f, 0x26a9, 0x25c1, 0x2f4f, 0xaa82, 0x2d6f, 0x21cd, 0x2da6, 0xa516, 0xad4b, 0xab82, 0x2b94, 0x250b, 0x2ce5, 0x2d01, 0x2dc4, 0x9f16, 0x282d, 0xa6c7, 0xa181, 0x2d38, 0x286c, 0x2a80, 0xabde, 0x2bc4, 0x9b54, 0x2c44, 0x2d4f, 0x2e5d, 0xacb1, 0x9ea2, 0x2da9, 0x2d57, 0xa47e, 0xa728, 0x2056, 0xac0f, 0x2799, 0x2d56, 0xa73b, 0x2947, 0x9da6, 0xa941, 0xa3f3, 0xa825, 0x2c9b, 0xa595, 0x2724, 0xa468, 0xabfb, 0xaa6a, 0xab64, 0x2847, 0xa163, 0x2aae, 0xaa86, 0xab13, 0x29fc, 0x2b6e, 0xa926, 0x2b89, 0x2aaf, 0xacd7, 0xa908, 0x2d3d, 0xae30, 0xac0f, 0x2b98, 0x2168, 0x2512, 0x2a1d, 0x28e6, 0x2653, 0x2918, 0xad6b, 0x2a0b, 0xa976, 0xae0f, 0x2c7c, 0x9cce, 0x2b2d, 0x2aa0, 0xa546, 0xa86f, 0x2ccc, 0x2ed9, 0x2a7d, 0x2f5a, 0x2d99, 0x2b7e, 0x2c09, 0x9ca8, 0x25c2, 0xa957, 0x2879, 0x2695, 0xac44, 0x99b4, 0x9a56, 0x2c22, 0xa56b, 0x236f, 0xab6b, 0x1a0a, 0x2c5b, 0xa025, 0x2a3b, 0x2b27, 0xa444, 0xac96, 0x1c39, 0x2da4, 0xaa94, 0xa9e9, 0x1a4d, 0xa7d2, 0x2856, 0x2903, 0x2aab, 0xacf2, 0x2c38, 0xa5b2, 0x1bbd, 0x9c85, 0x23ef, 0xad6d, 0x285a, 0xacda, 0xac5c, 0x157d, 0xa8e9, 0xa87e, 0x2f62, 0xacb4, 0xaaee, 0x2c38, 0xa63f, 0x283b, 0x2827, 0xae5b, 0xacd9, 0x2c52, 0xadb7, 0xabc7, 0xa84f, 0xabeb, 0xa26a, 0xa8be, 0xaa19, 0xae2b, 0xab50, 0xa969, 0xa8cc, 0xacdb, 0x24b0, 0x29e7, 0xaa91, 0x2a5d, 0x2c67, 0xad1e, 0xac39, 0xa99c, 0x28c0, 0xafa0, 0xad81, 0x1c6f, 0x2d66, 0xaba3, 0xa70e, 0x2f6e, 0x1abc, 0xa865, 0x2efb, 0xac40, 0x2f83, 0xa14f, 0xab4c, 0x3005, 0x2901, 0xaaaa, 0x214c, 0x24fe, 0x2713, 0x2f0a, 0x2a15, 0x9926, 0x2949, 0x946d, 0xaac1, 0x2b5d, 0x2fb5, 0xaca2, 0x2fc3, 0xa7a1, 0xabdb, 0x2972, 0x245b, 0xaa87, 0x14dd, 0x2f8e, 0xa409, 0x2fd7, 0x2d6c, 0x0ed1, 0xa0c1, 0xa59f, 0x2b6d, 0x2bb9, 0xa822, 0xae1f, 0x2ab3, 0xaaca, 0xacaf, 0x9ee8, 0x2e0d, 0xae18, 0x2c17, 0xa8a9, 0xa6a0, 0x2cb1, 0xa287, 0x2c31, 0x2dd8, 0x2d81, 0xac01, 0x2a7c, 0xab46, 0x2c8f, 0x2c2e, 0x2036, 0x1c56, 0x9fb2, 0x9fc9, 0x2a96, 0xa9b1, 0x2bd9, 0xab8b, 0xa93e, 0x2bdd, 0x2682, 0xa8fc, 0x2fbc, 0x2c60, 0xae37, 0x2285, 0xad38, 0x2add, 0x28fd, 0x2841, 0xaebd, 0x2df1, 0x26e4, 0xaaec, 0x2b8d, 0x2730, 0x1b4a, 0x2c31, 0x270c, 0xab2f, 0x2add, 0x2d8e, 0x9da9, 0x2ebf, 0xa935, 0x24ae, 0x2bdb, 0x2c3b, 0x99ca, 0xa01c, 0x2737, 0xac69, 0x2cb9, 0x298f, 0x25ce, 0x2854, 0xac17, 0xadaf, 0xa87d, 0x2af9, 0xaedf, 0xa9d5, 0xaca6, 0xa64e, 0x2ce0, 0x9a37, 0xaf08, 0xa863, 0xa39d, 0xafae, 0xacde, 0xac0a, 0xa699, 0xac79, 0xab41, 0xac63, 0x24a8, 0x2d91, 0xa987, 0x1714, 0xa98e, 0x2ab5, 0x1ea2, 0x28b0, 0xa711, 0xa11d, 0x2ea9, 0xae12, 0x2d39, 0x283d, 0xa4f9, 0x15f1, 0x1f5f, 0x2941, 0xa921, 0x2e1f, 0x2514, 0x2905, 0xab07, 0xa97c, 0x2323, 0xa74f, 0x96ca, 0x1ef7, 0x2912, 0xad6c, 0x233b, 0x2e94, 0x2c05, 0xaa46, 0x2974, 0x2762, 0xae86, 0x984c, 0x24a2, 0x2634, 0x2e1b, 0xab06, 0x2abc, 0x2e3a, 0x1fe4, 0x2422, 0xa90d, 0x2aaf, 0xacb4, 0x2dd5, 0x2483, 0xa034, 0x2efd, 0x3004, 0x2c19, 0xa833, 0x2b75, 0x2e6e, 0x216d, 0xab34, 0xa16f, 0x26e0, 0xaf66, 0x2244, 0x2cc1, 0xaa6c, 0xa872, 0x2457, 0x2914, 0xa980, 0xae9b, 0x286d, 0x2668, 0x2ac7, 0xaee6, 0x2980, 0xab0f, 0xa388, 0x2e99, 0xade8, 0xaee9, 0x2e40, 0xaaba, 0xadf0, 0x2ef6, 0xae92, 0xaae4, 0xa2af, 0xb013, 0xad86, 0x2bf7, 0xa5cc, 0xaf86, 0x21f3, 0xadb2, 0xad1c, 0x2b4e, 0xaf8e, 0xae33, 0xa94a, 0xacb6, 0xa9d9, 0x2f2b, 0xafb4, 0xad12, 0x2fab, 0xad4c, 0x1d85, 0x244f, 0xa06a, 0xa8b9, 0x2a09, 0xafc3, 0x214e, 0x29ca, 0x29cb, 0x2c87, 0x28e2, 0x2718, 0x2ce2, 0x2979, 0xa7df, 0x29d3, 0x174b, 0x2c91, 0x2f97, 0xafc5, 0x3013, 0x2cb1, 0xaec0, 0x2c31, 0x2b69, 0x9cc0, 0x2e62, 0x2538, 0xac6b, 0xa94c, 0xa841, 0x2df1, 0x1b34, 0xa9ec, 0xad21, 0xadc0, 0x2628, 0xaa21, 0x9623, 0x2863, 0xaa6e, 0x27be, 0xaf04, 0x2dd5, 0x270b, 0x2b02, 0x2da3, 0x2549, 0x2b98, 0xad21, 0x2997, 0x2a8f, 0xad5f, 0xa27e, 0x1e08, 0x2b63, 0x1f6c, 0xa97e, 0x2b03, 0x2538, 0xad3a, 0xa2ba, 0x297c, 0xada9, 0x2b27, 0x2957, 0xace8, 0x2ce6, 0xaf95, 0xabda, 0x2afb, 0xadba, 0x20cf, 0xabdd, 0xa59c, 0xac6c, 0xab41, 0x2be6, 0x2d8d, 0x9f63, 0xaefe, 0x2e52, 0x2801, 0xac6c, 0x2cb8, 0xa997, 0x286b, 0xa88b, 0xaa25, 0xa751, 0x2c31, 0x29f8, 0x2b93, 0xac28, 0x2ef0, 0x2d54, 0x2ca6, 0x2413, 0x2ca5, 0xa0f1, 0xa954, 0x2e95, 0x2cf8, 0x2df5, 0x2c3c, 0x265c, 0x2e56, 0xaac8, 0xad9c, 0x2bf8, 0x267c, 0xaa7d, 0xa8a2, 0xa913, 0xa44c, 0x2e5c, 0x2e68, 0x2866, 0x2af8, 0x9d87, 0xaa34, 0x2809, 0x294e, 0xaabd, 0xa748, 0x22d4, 0xadfe, 0xa343, 0x2774, 0xa406, 0x2eac, 0xa6fc, 0xab47, 0x29ec, 0x2b83, 0xaef0, 0xac00, 0x2f35, 0xa411, 0x2d85, 0x27fd, 0xa4df, 0x9ea4, 0x228b, 0x2bf9, 0x2e57, 0xa991, 0x2825, 0x2d25, 0xac8f, 0x2910, 0x2b35, 0xa5aa, 0x2916, 0x2858, 0xa953, 0xa2b0, 0x2a31, 0x2a71, 0x2c0b, 0x2d21, 0xac7a, 0x1fbd, 0x2ef6, 0xae71, 0x2985, 0x2d51, 0x2a4f, 0x2c7f, 0x29fa, 0xa6e8, 0x2fd2, 0x20b3, 0x29d4, 0xa7f8, 0x2c7a, 0xa994, 0x296f, 0xa916, 0xacb7, 0xa469, 0x2f0c, 0xae01, 0xa992, 0x2ae0, 0xacba, 0xa33b, 0xa7c8, 0x2767, 0x2fb8, 0x2d57, 0xaa1b, 0x2ba2, 0x284c, 0xac1d, 0xa915, 0x2c89, 0x2c2d, 0xaa37, 0x2cd6, 0xad57, 0x295d, 0x2c8a, 0xa85e, 0xa136, 0x9c53, 0x2233, 0x22b4, 0x2997, 0x234d, 0xab4c, 0xad75, 0x2eea, 0x2efb, 0x19b0, 0xa3e6, 0x2d35, 0x9e2f, 0x2e0f, 0x2c08, 0xaa10, 0x2a83, 0x9aba, 0xaf88, 0x2c54, 0x2eaf, 0xabd8, 0xaec4, 0x8bb7, 0xade7, 0xa805, 0x3026, 0x20db, 0xaa3f, 0x9fe5, 0xab86, 0xa379, 0x2a8d, 0xaca9, 0xa881, 0x285e, 0xb00d, 0x2d55, 0x2ebd, 0x2a02, 0x1824, 0x25ff, 0xa583, 0xac4e, 0x9511, 0xaebb, 0x2c05, 0x2f72, 0xab55, 0xac36, 0x2cf4, 0x2a5a, 0x2bac, 0x2620, 0x29ac, 0x2b24, 0x2ca4, 0xaea7, 0xae78, 0xa03a, 0xad05, 0x26cd, 0xa9df, 0xaae6, 0xaf10, 0xae70, 0x2857, 0x1ea2, 0xae9e, 0xa868, 0x2deb, 0xa471, 0xa4c5, 0xa9dd, 0xa91a, 0x19c6, 0x2c4b, 0x28da, 0x2be6, 0x9bd0, 0x2733, 0x9ea5, 0x2ac4, 0x2c37, 0xa81d, 0xa522, 0x2510, 0xab9d, 0x2638, 0x26e1, 0xa9d3, 0xaaf9, 0x23e0, 0xa97f, 0x2c6b, 0xac7e, 0xa7cf, 0x2acc, 0xaece, 0xad90, 0x2f13, 0x2b2b, 0x2610, 0x2f4b, 0x18ef, 0xa0c4, 0x287b, 0x277a, 0x1f32, 0xaac5, 0x2c28, 0x27e7, 0x2fb5, 0x2b8c, 0x28ba, 0x2d5b, 0xab83, 0x2481, 0x2e2a, 0x9ae6, 0xa88c, 0xaa4e, 0x2e21, 0xaca9, 0xaca4, 0x20d1, 0x2d51, 0x1d65, 0xa895, 0x1c63, 0xa32e, 0xaea1, 0xad1f, 0x28e5, 0xac05, 0x28cb, 0x2cba, 0xaf07, 0xa8c3, 0xa55e, 0x2978, 0x2654, 0xacb0, 0x1c4d, 0x25d3, 0xa61d, 0x2c01, 0xaf85, 0x24ec, 0x2cb0, 0x2717, 0xa570, 0x2e14, 0xab77, 0xaa31, 0x9f8a, 0x1d75, 0xafb6, 0x2c3b, 0xa6da, 0xa46a, 0x2d38, 0xacea, 0xab39, 0x2fff, 0xa7c9, 0xaf9f, 0x2db1, 0x1bab, 0xa61e, 0xa87c, 0xa6f0, 0xa5dc, 0x2548, 0x9e3a, 0x214b, 0xa87f, 0xab50, 0x27f4, 0x2b98, 0x2993, 0x27db, 0x2d72, 0xa684, 0xab78, 0xa4e7, 0xa50a, 0x2c32, 0xa898, 0xacf2, 0x2ded, 0x2c24, 0xa9cb, 0x2766, 0x2b64, 0x251a, 0x2842, 0x24fb, 0xabfb, 0x26ea, 0xa20e, 0x2472, 0xabc8, 0x2844, 0xa989, 0xae11, 0xa9eb, 0x2884, 0x282f, 0x2fab, 0xa529, 0x9d6d, 0x2d20, 0xab07, 0x2a95, 0xa8c8, 0x2c41, 0x22fd, 0x29a7, 0x2e75, 0xab8f, 0x2cab, 0x9f2f, 0xabb8, 0x29f4, 0x2d14, 0xaca7, 0xabe3, 0x249f, 0x2a8c, 0xb022, 0x285d, 0xa99b, 0xa817, 0x22c2, 0xa95e, 0xade5, 0x9486, 0xa417, 0xa90e, 0x2071, 0xa8e4, 0xafc4, 0x28b2, 0xaf25, 0xa6b5, 0x2a16, 0xb028, 0xa8f5, 0x2e3b, 0xa32f, 0x220b, 0x2c19, 0xa490, 0x2140, 0xab17, 0x9d4e, 0x2d61, 0xa986, 0xab2c, 0x2cef, 0xa665, 0x2b11, 0x2d9a, 0x25d2, 0xa953, 0x290b, 0xa985, 0x23fd, 0xa8bb, 0xa958, 0x2d65, 0x2822, 0xa870, 0x226f, 0x29e8, 0x21d6, 0x2e40, 0xa97e, 0xa9d4, 0xa911, 0x29e8, 0x2d39, 0x2e63, 0x2abc, 0x2c2c, 0x2c62, 0x2dbb, 0xaa32, 0xaa16, 0xb064, 0x29b7, 0x2ffc, 0xae71, 0xa862, 0x26a2, 0x151b, 0xaae3, 0x9ecd, 0x28c9, 0x2aec, 0x1ea0, 0xad8e, 0x290d, 0x2003, 0xae87, 0xaa55, 0x27b0, 0x2415, 0x289e, 0x2593, 0xae37, 0xac16, 0xa7d5, 0x2944, 0xaa9e, 0x2dcd, 0xae61, 0x2e60, 0x2591, 0x9d64, 0x2c8e, 0xa2bc, 0xac6d, 0xaa7b, 0x13d6, 0xae27, 0x3006, 0x2e97, 0x291a, 0x2d43, 0xa5ae, 0xacb7, 0x2ddb, 0xa760, 0xaa6f, 0x2c9c, 0x2e7e, 0xa725, 0x2c83, 0x251f, 0xae6e, 0x266c, 0x2bb3, 0xac23, 0x1f5d, 0x2fca, 0xa561, 0x9883, 0x215e, 0xad3a, 0x2efc, 0x2e0f, 0xabe0, 0x2cec, 0x25e8, 0xa7b0, 0x2064, 0x9c06, 0x288a, 0x21c6, 0xaac4, 0xada4, 0x2d8d, 0x2c25, 0xadcc, 0xacba, 0x2a28, 0x28da, 0x2809, 0x2d2b, 0xa86e, 0x2efc, 0x2e73, 0x2ca3, 0x2c01, 0xa81e, 0x2c60, 0xa563, 0x19c7, 0x2477, 0x27da, 0xab7f, 0xac8e, 0x285b, 0x29a3, 0xaa76, 0xa9ce, 0x2c79, 0xa42b, 0x2df4, 0xab70, 0xa740, 0x29a6, 0x9764, 0xaf33, 0x29d3, 0xa765, 0x2743, 0x2c87, 0xac3e, 0x2979, 0x2f2e, 0x21f8, 0xa2b4, 0xa60c, 0xa698, 0xad0f, 0x296a, 0x24d6, 0xad19, 0x2e45, 0x2d1e, 0xaf1e, 0x2091, 0x2847, 0x2c9b, 0x2d8b, 0xa98d, 0xa723, 0xa3cc, 0x2a18, 0x1c67, 0x2d2f, 0x25b4, 0xa49c, 0x2ec6, 0x2c16, 0x2cd1, 0xad18, 0x283f, 0xa7e9, 0x2c0a, 0x28f0, 0x2e5a, 0x223c, 0xaba1, 0x2e06, 0x2659, 0x2cb7, 0x1ab9, 0xa7ee, 0x9b2f, 0x247e, 0x231a, 0xa8c6, 0xac69, 0x2de9, 0x2c39, 0xae08, 0x2061, 0x2977, 0x2d79, 0xa1e2, 0x2d44, 0xab7b, 0x2843, 0x2837, 0xaef9, 0x2b01, 0x2c90, 0xae3b, 0x24f3, 0xa491, 0x263b, 0x2339, 0xa96a, 0x29a7, 0x2136, 0x248b, 0xadf2, 0x2dcb, 0x27b6, 0x25cf, 0x2f15, 0x2a0d, 0xabe7, 0x2dd9, 0x2f36, 0x2c66, 0xa70a, 0x9004, 0x2a21, 0xa0f7, 0x2540, 0x262d, 0x2563, 0x2a8d, 0xa809, 0xaa1f, 0x2c1b, 0x2852, 0xa835, 0x2a41, 0xaab4, 0xadaa, 0x2682, 0x1827, 0xa5ef, 0xa703, 0x9d53, 0x2718, 0x2d4b, 0x9e88, 0xa9a1, 0xa4cd, 0xaec7, 0x2cbe, 0x2b07, 0xaef3, 0xa84d, 0xaf93, 0xadf8, 0x2c58, 0x25cd, 0x2a73, 0x2ea6, 0x2546, 0xa35e, 0x2c77, 0x27dd, 0xaf21, 0x2a15, 0xafcd, 0xadb4, 0xa9e2, 0xafd4, 0xaca1, 0xa9c1, 0xaefe, 0x1c82, 0x24aa, 0xaf6a, 0x28ef, 0xaa91, 0xadad, 0xa81a, 0x9c2c, 0xada5, 0xaddb, 0x2e0a, 0xacb8, 0x2796, 0xae80, 0xaba5, 0xae69, 0x2ed9, 0xa20f, 0xa859, 0x2d34, 0x22db, 0xaf2c, 0x2969, 0xab0e, 0x2d7f, 0xace7, 0xad09, 0x2ed0, 0x29e7, 0x2525, 0xa834, 0x2d65, 0x2a32, 0x29ab, 0x29cd, 0x22e4, 0x2c4f, 0x250b, 0xa03b, 0xacea, 0xad4f, 0x174f, 0xab33, 0xb004, 0xaa91, 0xaa1d, 0xaee6, 0xaac9, 0xadf7, 0xabaf, 0x2a50, 0xae4e, 0xae54, 0xad0b, 0x2e72, 0xb034, 0x2d01, 0x297d, 0xb021, 0x2ada, 0x2d88, 0x288e, 0xaa7d, 0xaaaf, 0xac4b, 0xa7a1, 0xae20, 0xad1a, 0x2651, 0x1c92, 0xa7c3, 0xab2c, 0xb077, 0x26a2, 0x9c08, 0x25f8, 0x2b3c, 0xaede, 0xaf31, 0xa83d, 0xaac2, 0xae05, 0xaa1d, 0xa000, 0xa4d9, 0xa9c2, 0x9636, 0xae62, 0xaac8, 0xaeb2, 0xac3a, 0x2c03, 0xab54, 0x2f07, 0x25b7, 0x2bfb, 0x2f12, 0x2c30, 0xad7b, 0x2892, 0x24e0, 0xac8e, 0x2cd8, 0x1f4a, 0xaef9, 0xa3aa, 0xab82, 0xac55, 0xa96d, 0xabd7, 0x2ca8, 0xade0, 0xa87c, 0x21a6, 0xaf7c, 0xa8d4, 0x2759, 0xacb0, 0x1f56, 0x2ebe, 0x2f45, 0xac22, 0x2cdc, 0x28d0, 0x289c, 0xa844, 0xae7d, 0x2da6, 0x2ef4, 0x2730, 0x2d0f, 0x2c13, 0x2788, 0xa3e6, 0x039c, 0x9f28, 0x28da, 0xa9e7, 0xacdb, 0xa0e1, 0x2946, 0x1f40, 0x2c39, 0x9e34, 0x99f5, 0xa69b, 0x2d99, 0xa35f, 0x1d94, 0xa85c, 0xad5d, 0x25c3, 0x2a66, 0x298e, 0x2804, 0xa62e, 0x2be5, 0x2d9e, 0x2ad4, 0x2e00, 0x2efc, 0x27eb, 0xa8d0, 0x2a65, 0x27d6, 0x13ad, 0xac72, 0xab69, 0xa166, 0x2e85, 0x2508, 0x2594, 0x2ce4, 0x3000, 0x29a6, 0xa5bc, 0xa521, 0x25c6, 0x298b, 0x1da5, 0x1ebe, 0x2e7b, 0x2e0e, 0xabd6, 0xa0d0, 0x2c9f, 0xb09c, 0x979e, 0xa74e, 0xa82c, 0x24c7, 0xa61a, 0xa82a, 0xae41, 0xadc6, 0xa699, 0xae90, 0x2866, 0xa876, 0xad3e, 0x2524, 0xa9c5, 0x2c02, 0x243f, 0xacd5, 0xadea, 0x25a8, 0x2c60, 0xa9fc, 0x2513, 0x2aaa, 0xa231, 0x2af2, 0x26af, 0xa1ae, 0xac1a, 0xac6b, 0x253a, 0x2d3f, 0xae75, 0x1da5, 0xaa8f, 0xaf10, 0xa084, 0x24f6, 0xac2c, 0x22aa, 0xa62b, 0x2dd9, 0x247a, 0x2f4e, 0x1e65, 0x2d22, 0xa7dd, 0x2cb8, 0x17d1, 0x2a9d, 0x2cfd, 0xa89c, 0x28a8, 0xa8ba, 0xada0, 0xa8f9, 0xa86d, 0x2c34, 0xa9b5, 0x298c, 0x29ff, 0x2c4a, 0xa897, 0x3053, 0xa64b, 0x2a05, 0x29b6, 0x2a07, 0x2e8b, 0x2cbf, 0x2f33, 0xa7d2, 0xa815, 0x213b, 0x26b4, 0xac1a, 0x18e1, 0x2fdd, 0x2e2d, 0x2c52, 0x2c0e, 0x2cd8, 0xa4e0, 0x1fa9, 0xa96f, 0x2c1a, 0xa89a, 0xab99, 0xac61, 0x2d7d, 0xa48c, 0x25f1, 0x9ceb, 0xa5c7, 0x13a7, 0xae29, 0xa41c, 0xaca3, 0xa2bc, 0xaf9c, 0xab9c, 0x2da4, 0xa3d7, 0xad9d, 0xa697, 0xa265, 0x2a37, 0x9b9a, 0x2c9e, 0x2b2e, 0xa46f, 0x262c, 0x2e1d, 0x2c23, 0x2fac, 0x2ad4, 0xaf1e, 0x262a, 0xa304, 0xafb3, 0x2d82, 0x2768, 0x2117, 0x2ae1, 0x2986, 0x28c5, 0x2845, 0xa44c, 0xac63, 0x2810, 0x2b7c, 0xaadf, 0x9d80, 0x29c4, 0xa54c, 0xa539, 0x2e01, 0xa54e, 0xa8c6, 0x2c1d, 0x29bf, 0xadde, 0x2f2c, 0xa8e0, 0x27cd, 0x2738, 0x2b23, 0xa67e, 0x2c54, 0xa823, 0x2f3e, 0xab1c, 0x2e80, 0x2614, 0x2ece, 0xaae8, 0x9503, 0x2e90, 0x2f60, 0x2934, 0xa9d6, 0x2ab3, 0xa436, 0x96ee, 0xa51e, 0xa5e2, 0x2afb, 0xae63, 0x2810, 0xab09, 0xa36c, 0x218b, 0xa675, 0xa9d3, 0x2ba8, 0xad4d, 0x11ba, 0x1ce5, 0xa47c, 0xae2a, 0xa7ec, 0xad12, 0xaff7, 0x2706, 0xa6ad, 0xac89, 0x3009, 0xaa62, 0xac96, 0xa879, 0xad0f, 0xaec8, 0xa914, 0xa7c5, 0x1b44, 0xa821, 0x21f4, 0x2a36, 0xa5be, 0xaaf7, 0xadd5, 0x26f2, 0xa7be, 0x1e74, 0x2535, 0x23a0, 0x29a9, 0xa31c, 0xa6e0, 0xad46, 0x2f1f, 0xaab9, 0xaf32, 0x2ec5, 0xa776, 0x2a3c, 0x21d0, 0x1f87, 0x28bf, 0xaccc, 0xa8b2, 0xa469, 0xab33, 0xa26e, 0xa8ba, 0x2ee6, 0x29d6, 0xa417, 0x2c3f, 0xacd8, 0xaa97, 0xa719, 0xae7f, 0xaa84, 0xadc2, 0xa903, 0xa492, 0x2705, 0xa3d2, 0x251f, 0xace2, 0x99c2, 0xac5f, 0xaa2f, 0xa692, 0x2937, 0x27f6, 0x2ce4, 0x2729, 0xad34, 0x2c9a, 0x2c4f, 0x9f92, 0x2ead, 0x2e39, 0xacf8, 0x2cbf, 0x2e0f, 0xaf4e, 0x2e31, 0xa666, 0xa4ac, 0xa93a, 0xa7a4, 0xab91, 0x2bb4, 0x982c, 0x18c9, 0xab4f, 0xa3d4, 0x9ef6, 0xa1b1, 0x2ec4, 0xa88a, 0x2414, 0x2abf, 0xa64d, 0x2e3d, 0x2c78, 0xaa44, 0xa23d, 0xa6b6, 0x23d2, 0xa66b, 0xa490, 0xa5ed, 0x254b, 0xa9d7, 0xa1d1, 0x2c1f, 0xac7d, 0x2a65, 0x252f, 0xaae8, 0xa6cd, 0xa4f2, 0xa027, 0xa98c, 0xa938, 0xa6b7, 0x2613, 0x2d6e, 0xa9c5, 0xa9d9, 0xad4a, 0xa756, 0xae10, 0x2b1a, 0x2c4c, 0x1bb7, 0x28c7, 0x242d, 0xae01, 0x2c72, 0x2a46, 0xaf11, 0xa8b2, 0x2521, 0xaebc, 0xa4e7, 0xa2b4, 0xad85, 0x2b75, 0x2eef, 0xac83, 0x9dce, 0x2c8c, 0xafa1, 0xaa2c, 0x231c, 0x9a91, 0x29a7, 0x285e, 0xae30, 0x26d5, 0x2c7b, 0x2560, 0x2a93, 0x2f40, 0xa8dc, 0xad91, 0x2b42, 0xad9f, 0xae3d, 0x2c86, 0xa7fb, 0x2ac8, 0x2f10, 0xab22, 0xacae, 0x224c, 0xaed2, 0xa477, 0xa722, 0x2c9e, 0x296e, 0xa480, 0x2f2d, 0x25f0, 0xaff7, 0x2e77, 0x2d3c, 0xaa90, 0x2dff, 0x2914, 0xac81, 0xa9ee, 0x2c66, 0xaafc, 0x2b91, 0x2592, 0xadba, 0x2d93, 0x2731, 0xa934, 0xa596, 0xaa8b, 0xa364, 0xa894, 0x9ba6, 0x2a3d, 0xa9c4, 0x2ffa, 0xad5f, 0x2a08, 0x2945, 0xa1de, 0xa9bb, 0x296f, 0x2add, 0x267f, 0x2c5b, 0xa646, 0xa76e, 0xa715, 0x2d4d, 0xad46, 0x2242, 0x240c, 0xa89b, 0x153f, 0x2e21, 0x2b6c, 0x2ec5, 0xa55c, 0x98e2, 0xa335, 0x2bf1, 0xa997, 0x2d3e, 0x2a81, 0xa823, 0x012d, 0x2dbc, 0x283b, 0x2cfe, 0xa969, 0xac21, 0xa831, 0xa451, 0xa6fe, 0xaa47, 0x28c9, 0x2a45, 0xa803, 0xa939, 0x283c, 0xae30, 0x28e7, 0x1fc2, 0x27d3, 0xac50, 0x2e73, 0xaa2f, 0xaeb0, 0x2e72, 0xa0c2, 0x29b8, 0x2604, 0x9346, 0x9c59, 0x29cd, 0x25ae, 0xae4f, 0xa908, 0xae7c, 0xaf2b, 0x2cf0, 0x28f0, 0xaa45, 0x2d70, 0xac85, 0xa944, 0x2b0a, 0xabb9, 0x2a71, 0xaed3, 0xacd4, 0x2799, 0xa069, 0x1c93, 0xa7c9, 0x20ea, 0x295c, 0x24e2, 0xa300, 0xae7e, 0x2e02, 0x2487, 0xb008, 0xa91c, 0xade6, 0xa280, 0xa7c3, 0xa923, 0x2904, 0x29fd, 0x2a9c, 0xa34e, 0x2630, 0xa9ef, 0x1f2b, 0xad98, 0x244a, 0x2546, 0x1f04, 0xaf9a, 0xa6bc, 0x9873, 0x2881, 0xaf25, 0x28b0, 0x22b6, 0x1528, 0x2e64, 0xa5c0, 0xaa11, 0x2cd1, 0xa708, 0x9786, 0x2e48, 0xad31, 0xa9f8, 0x2c06, 0xaa10, 0x2d36, 0x2b82, 0xab39, 0x2d05, 0xa893, 0x9449, 0x26ff, 0xabc9, 0x1ed1, 0x2fc0, 0xa961, 0x1c28, 0xa218, 0x2ece, 0xae9b, 0xab69, 0xa22c, 0xac82, 0x2752, 0xa16a, 0x29c9, 0xa193, 0x2625, 0x251a, 0x2d9b, 0xa832, 0xa97f, 0x2c08, 0x99c8, 0xa709, 0xa495, 0x28a8, 0x2536, 0x24d3, 0x2a9c, 0xae4d, 0xa56f, 0x2d15, 0x1144, 0x2fdd, 0xa8ef, 0xad26, 0xa144, 0x9585, 0xad61, 0x2cf6, 0xaa53, 0xa1dd, 0xa5f6, 0x29b0, 0x1ef9, 0x1dd5, 0x2f8b, 0xaad6, 0x2e62, 0x2f68, 0xacac, 0x9c25, 0x24ea, 0x26ed, 0x98be, 0x267f, 0xabdf, 0xa584, 0x2fca, 0xafa3, 0x2c0f, 0x2fdd, 0xad54, 0xa867, 0xa636, 0xa857, 0x2502, 0x292e, 0xaa24, 0x1a74, 0x2da0, 0xaf59, 0x2ab6, 0x2e19, 0xad77, 0x279d, 0x2cc5, 0x29d5, 0x266f, 0xa38f, 0x9dcf, 0xad69, 0x2d92, 0xab81, 0xa8aa, 0x2ece, 0x2838, 0xa4c8, 0x2999, 0xaabc, 0x28f8, 0xa5bc, 0xa9fc, 0xa8c2, 0x2ce8, 0xad47, 0xae5f, 0xa131, 0x2c2b, 0x2997, 0xa591, 0x2761, 0x29e0, 0xaa37, 0x2b80, 0x2d94, 0xa0a2, 0x2a86, 0xaae2, 0x2f23, 0xac23, 0x26b4, 0x2580, 0xa857, 0xaead, 0xa877, 0x2eca, 0x2778, 0x2079, 0x3058, 0xac82, 0x2bce, 0x285e, 0xad50, 0x2f75, 0x2b2f, 0x2882, 0x2d91, 0x2c7c, 0xa395, 0x2da2, 0x293b, 0xa8ea, 0x2d68, 0x90d3, 0xac5d, 0xacbb, 0x27db, 0xac2e, 0xabec, 0xae08, 0x285a, 0x2018, 0xa8ce, 0xaf1e, 0x2bb2, 0x2d72, 0xa868, 0x1cd5, 0x2e54, 0xa389, 0x24ea, 0x1b04, 0xac92, 0xb0dc, 0x0013, 0xad48, 0x2b02, 0x9eae, 0x2b44, 0xa9a7, 0x2e63, 0x9ffd, 0x2e85, 0x2ac6, 0x1e2c, 0x2e46, 0x2e06, 0xa5c5, 0x2e08, 0x2e47, 0xa86b, 0x2c60, 0xa60a, 0xaaa5, 0x2cb3, 0x2dea, 0x2bd3, 0xae7a, 0x2b0e, 0xa97a, 0xaa14, 0x1c5f, 0x272d, 0x2528, 0x26bf, 0x2ce4, 0xab50, 0xa205, 0xa6ee, 0xab29, 0x2352, 0x2d90, 0x2cd6, 0x2881, 0xab62, 0x2812, 0x2937, 0x2c19, 0xac4e, 0xac43, 0x210e, 0xaf45, 0x28d7, 0x24e6, 0x2074, 0x2d26, 0x2b1f, 0x14ef, 0xa658, 0x2d88, 0xaec4, 0xa70c, 0x2dfc, 0xa9b1, 0xa898, 0x2357, 0xaf7e, 0xac74, 0xacf8, 0x2a18, 0x2886, 0xabcd, 0x2d87, 0x2ac3, 0x2a4a, 0x203c, 0x8e0c, 0xa0dd, 0x2dfc, 0x1cc7, 0xabed, 0x2f4d, 0x2af8, 0xab39, 0x3022, 0x29e8, 0xa1ec, 0x299a, 0x2ccd, 0xaeb1, 0x16ca, 0xab5b, 0xadd9, 0x2706, 0x2e0f, 0xaf24, 0x2e2f, 0x25e3, 0xa8a2, 0xa9ff, 0x18ab, 0x28fd, 0x2482, 0x2dfc, 0xaf0b, 0x29f4, 0xa8f0, 0xa5d3, 0xa528, 0x22e9, 0x2513, 0x2cf6, 0xa854, 0xae37, 0x28d9, 0xa921, 0x2c19, 0xa3c2, 0x2ac5, 0x2bcc, 0x2aae, 0xab22, 0xa851, 0x2dde, 0xa9ed, 0x29be, 0x2940, 0x2f29, 0xa8e8, 0x2c40, 0xa855, 0xa371, 0xa24f, 0x2d20, 0x2b5a, 0x23d3, 0x9f46, 0x2a96, 0x29bd, 0x2f7e, 0x28bb, 0xa9cd, 0x2cab, 0x285d, 0x9fc8, 0x24ec, 0x273d, 0xa68a, 0x238a, 0xa94d, 0x2928, 0x2d13, 0x2e96, 0xa0ed, 0xa83b, 0x285b, 0xaa52, 0x2756, 0xa118, 0x181e, 0xaae4, 0xab4c, 0x2d0a, 0x1ef2, 0x8b13, 0xa635, 0x2ac8, 0xa4c5, 0x2813, 0xa40b, 0xab9e, 0x2bfa, 0x2cdc, 0xaab5, 0x2c24, 0x2c88, 0x2061, 0xa324, 0x1f38, 0xa835, 0x2bd0, 0xa893, 0x2a1f, 0xa8d8, 0x2d6b, 0xa80c, 0x2885, 0xa805, 0x2c94, 0x2779, 0xaa18, 0x2d48, 0x2a9d, 0xa8f2, 0x270a, 0xac35, 0x2551, 0x2e44, 0xa961, 0x2c8f, 0x2d30, 0x2300, 0x23ba, 0xa812, 0xae15, 0x21c1, 0x0e6d, 0x2dbd, 0x2ce6, 0xa38b, 0xae46, 0x2e35, 0x287c, 0x25be, 0x9c9d, 0x2406, 0xaf79, 0x9e34, 0xa9d6, 0x2190, 0xa866, 0x2c41, 0x23d7, 0x2981, 0xa033, 0x2994, 0xa0e3, 0x2c54, 0xa8e6, 0xa5f4, 0x2af1, 0xa9ec, 0xa416, 0x24b1, 0x2c4a, 0x2c98, 0x2f8b, 0x290f, 0xa689, 0x2abd, 0x08b0, 0x2e53, 0x26e1, 0x2ab0, 0xa45d, 0xab6d, 0x2e7d, 0xac96, 0x2f00, 0xa929, 0xaa3b, 0x9f1f, 0xaa5f, 0x2642, 0xab36, 0x1f89, 0xa5ba, 0xacc5, 0xacd5, 0x1bdd, 0x2c57, 0xaee2, 0x2741, 0xa2c4, 0x2266, 0x28bb, 0x9a72, 0xa8a5, 0x26d7, 0x2878, 0xaa6d, 0x2ce4, 0xaa0a, 0xaa85, 0xa633, 0x9ce7, 0xaeb1, 0x29d7, 0xae47, 0xa872, 0x265b, 0xad5e, 0x29bf, 0x2ba4, 0xacab, 0x2748, 0x2e63, 0xabff, 0xab46, 0x2ca2, 0x23c0, 0xa329, 0x2b31, 0xad53, 0xaf43, 0xa9e6, 0xac8f, 0xad57, 0xa4d9, 0xac87, 0x2ac6, 0x2926, 0x2ab2, 0x8f3c, 0xa1ff, 0xaaeb, 0xadda, 0xa3d5, 0x0f9a, 0xa9e5, 0x2537, 0xac7e, 0xa1a2, 0xa5e1, 0xac61, 0x28dd, 0xa8c3, 0x2759, 0x2ce9, 0x2a5f, 0x289d, 0xad75, 0xaa70, 0xad10, 0x2242, 0x2807, 0xab79, 0x2d5b, 0x2f16, 0xac06, 0xa82e, 0x2f8b, 0x2744, 0x2aac, 0xa85f, 0xa779, 0x2f23, 0xa545, 0xa7c2, 0xa7d5, 0x231f, 0xab3d, 0xa822, 0x300d, 0x1d13, 0xb031, 0x2dc4, 0xaea7, 0x2438, 0x2726, 0xa952, 0x2811, 0xa983, 0xad2a, 0x2f98, 0xa7d2, 0x28cc, 0x20e9, 0xaa20, 0xa4ee, 0x2af1, 0xaac2, 0x2545, 0x25e1, 0x2c7f, 0xae9d, 0x29b0, 0x2a50, 0x2913, 0x3021, 0xaca0, 0xad5f, 0xa49a, 0x2abe, 0x27ba, 0x2d00, 0xaa04, 0x23ab, 0xa645, 0xab96, 0xa4fc, 0xaed2, 0xac95, 0xad41, 0x2b1a, 0xa4bc, 0xad98, 0x2aaf, 0x2e13, 0xad59, 0xa6da, 0xa745, 0x2803, 0x23d2, 0x2eb6, 0xa6c1, 0xaa23, 0x2f2a, 0x2647, 0x28da, 0x2f08, 0xacbc, 0xa4f1, 0x2a69, 0xa885, 0xa7b1, 0x9df5, 0x2ce9, 0x26d2, 0x2c18, 0x2778, 0xa2a8, 0x8f97, 0xac31, 0xa963, 0x98b8, 0x2683, 0xa92b, 0x1a1e, 0xaa75, 0xa5e4, 0xaef2, 0xa873, 0x2b8d, 0x230c, 0x2d5d, 0xaf11, 0xad2b, 0x2e55, 0xae2d, 0xaf42, 0x231e, 0x2a80, 0xb04c, 0xa0ce, 0xad23, 0x28be, 0xa3dc, 0x203a, 0x2c87, 0x2c20, 0xacba, 0xaf64, 0x283d, 0xb0bf, 0xa79c, 0x2bec, 0x29ad, 0x2c55, 0x2f36, 0x2eec, 0xac2c, 0x2f49, 0x2937, 0x20f3, 0x2434, 0x2a4c, 0xafc0, 0xac63, 0xaa35, 0x2685, 0x3063, 0xa607, 0x29cd, 0x2e53, 0x2992, 0x1769, 0xab8f, 0xa41f, 0xaf67, 0xaf29, 0x2f92, 0xaf7a, 0xad33, 0xad63, 0xa4cc, 0xab96, 0xa25b, 0x2600, 0x2788, 0xa71e, 0x20ce, 0x2865, 0xaca1, 0x2b58, 0xa960, 0xa48b, 0x2e84, 0x27ac, 0x2905, 0xa9d6, 0xaa80, 0xac1d, 0x2b4f, 0x2676, 0xa3c4, 0x2c09, 0x25e0, 0xb013, 0x2e8c, 0x2ab6, 0xa8b9, 0x2947, 0xaf1f, 0xabd5, 0x2edf, 0x1973, 0x2e56, 0x283a, 0x2587, 0x2a65, 0x9d03, 0x9f40, 0x2bc9, 0xaaf1, 0xa841, 0xa7fd, 0xac25, 0xa82e, 0x2d85, 0xaab8, 0x9278, 0x2a80, 0x9c3d, 0x21c2, 0xae49, 0x9cb1, 0x2d05, 0xaa36, 0x2991, 0xa20e, 0x2983, 0x9fad, 0x2ee3, 0x2b81, 0xaf1f, 0x18fd, 0x922c, 0xa639, 0xa0a9, 0xa5c3, 0x1a7e, 0x2ef8, 0x2959, 0x2908, 0x2c2e, 0x2b2d, 0x2c64, 0x94ce, 0xaed8, 0xab78, 0x27e3, 0xa88c, 0x2a3b, 0xa9d2, 0x2baf, 0x221d, 0x2d47, 0xaea0, 0x2c2f, 0x2e07, 0x1c30, 0x2866, 0x96c8, 0xae5e, 0x2db2, 0x2ec7, 0x2842, 0x2a8f, 0x2b2f, 0x2fc3, 0x2d0e, 0x2bfd, 0xac79, 0xabe1, 0x22d9, 0x2d94, 0xadef, 0xacfe, 0x2cc7, 0xad19, 0x2640, 0x2f12, 0xa966, 0x99f4, 0xa76a, 0x288d, 0x292b, 0x9bd7, 0x280a, 0x1cf0, 0x1d57, 0x2ceb, 0xace0, 0xa103, 0x9298, 0xad79, 0x106a, 0x2e70, 0xa72a, 0xabc6, 0xa65b, 0xadbf, 0x2ca1, 0xa44e, 0xa6a0, 0x2cbe, 0x2bf2, 0xacc0, 0x288e, 0x2cfd, 0x2763, 0x280d, 0x9ef2, 0x2ac4, 0xa1ed, 0x2967, 0xab59, 0x2628, 0xa631, 0xaebc, 0xab78, 0xac58, 0x251a, 0xa204, 0x203b, 0xadad, 0xad2c, 0x2d1c, 0xabfc, 0xa7e6, 0x2cb4, 0x2c2e, 0xa681, 0x24a1, 0xaa08, 0xa69a, 0xa75d, 0x2c34, 0x28df, 0x2e1d, 0xa5f9, 0xa7ce, 0x2b27, 0x2a91, 0x2f75, 0xac46, 0xacd1, 0x2281, 0x2ce0, 0x2d29, 0x1b6b, 0xa8c4, 0x2d11, 0xac02, 0x2b39, 0xa786, 0xaa22, 0xa83a, 0xabaa, 0xad91, 0xa85d, 0x2cf1, 0x237c, 0x2a62, 0x2248, 0xa82a, 0x28e9, 0xa915, 0x9a3c, 0xa8ee, 0x2ea8, 0x96c1, 0x2c7f, 0xa599, 0xa8b0, 0xaca9, 0xabfb, 0xad66, 0xaa24, 0x2d88, 0xad88, 0xa598, 0xa809, 0xacbe, 0x2cee, 0x2ca4, 0x2a0b, 0x2d12, 0x2cfc, 0x27a6, 0x2af0, 0x2efb, 0xa9a7, 0x2cd5, 0x2c29, 0xab34, 0x2792, 0x1dd7, 0x27e4, 0x2757, 0xad3a, 0x2c84, 0x25e1, 0xa977, 0x2e37, 0x2cab, 0x25cd, 0x2ee5, 0x22af, 0xa562, 0x282c, 0x2d2c, 0x28bd, 0xac24, 0x29a7, 0xa73c, 0x2ccc, 0x2d4e, 0x298a, 0xad27, 0x23fe, 0xab5e, 0xac30, 0x269f, 0xa5ce, 0x2d83, 0xaa26, 0xabbf, 0xa93e, 0xaca8, 0xad4c, 0x2ddd, 0xad09, 0xa8d6, 0x2ee8, 0xa16c, 0xaeeb, 0x2906, 0x2e43, 0xae3e, 0xa812, 0xacbd, 0x2255, 0xab62, 0xa2de, 0x9786, 0xa9df, 0x994b, 0x9ff1, 0x2add, 0x29a3, 0x1987, 0xae2c, 0xaa6b, 0x9a48, 0x9d42, 0x2c6e, 0x1a0e, 0xa530, 0x2717, 0x24bc, 0x2a1f, 0x285f, 0x2352, 0x999c, 0xa6c5, 0x284c, 0x2a72, 0xa61c, 0xa831, 0x233a, 0x2892, 0x26c4, 0x2e02, 0x2f52, 0x2d61, 0xa338, 0xabda, 0x2542, 0x2a3d, 0x2cab, 0xaca9, 0xa86d, 0x3045, 0x2d03, 0xac32, 0x1c91, 0xac58, 0x274a, 0x2ba1, 0xa6e1, 0x2bb6, 0x2e46, 0x2d55, 0xae1c, 0xa620, 0x2c0d, 0x95ec, 0x2a17, 0x2d9d, 0x2cc0, 0x2a52, 0xa9b9, 0x2b4d, 0x289f, 0x2c05, 0xad9b, 0xaaae, 0x2d28, 0xa9bc, 0xacbb, 0xacfa, 0xac9a, 0x2d3a, 0xac6c, 0x26c5, 0xa4ce, 0xa8e7, 0xa94f, 0xaa8a, 0xa653, 0x1ef1, 0xad54, 0x29ef, 0xa679, 0x2d81, 0xab40, 0x2954, 0x2f9d, 0x2c71, 0xabb6, 0x2f4b, 0x2ddd, 0x2cb5, 0x2c8d, 0x260d, 0x21c1, 0x2f7a, 0x2c54, 0x1585, 0x2b3a, 0x2f5d, 0x2754, 0x2d8a, 0x25ae, 0xae85, 0x2cba, 0x2a07, 0xaec2, 0x96ef, 0xa349, 0xb06b, 0x2233, 0x3007, 0xaf10, 0x2d70, 0x2a9b, 0x22f6, 0x2947, 0x2ae7, 0x2d7b, 0x271f, 0xa22f, 0xadf1, 0x2676, 0xab3e, 0x206e, 0xac0b, 0xa093, 0xa158, 0xa4d2, 0x2db6, 0x25f4, 0xa51e, 0x2856, 0x242a, 0xaec5, 0x262f, 0xaca9, 0xaae3, 0x2807, 0xac12, 0xadca, 0x2e13, 0xb028, 0xaa46, 0xa7c1, 0xa2c9, 0xaa75, 0x293f, 0x2b13, 0x2efe, 0xadc9, 0xa85e, 0x3053, 0xaa5e, 0x2d0b, 0xa68e, 0x1c4f, 0xa61d, 0x2cd4, 0x28b0, 0xab82, 0x2cb1, 0x20b3, 0xadfc, 0x2f9d, 0xa72a, 0xb06f, 0x2ed9, 0xae6f, 0x24b8, 0x2f8f, 0x2b14, 0x2032, 0x2d7e, 0xaf8e, 0x1e0d, 0x23f9, 0xa93b, 0xaeb6, 0x2dca, 0xa562, 0xad37, 0x2dd1, 0x9e75, 0xa960, 0xa3a7, 0x1892, 0xaa06, 0xac2b, 0x1fea, 0xad9f, 0x2adb, 0x2ac2, 0x2697, 0xaa7d, 0xae64, 0x2dc0, 0xabb0, 0xab1f, 0x2df4, 0xa9f5, 0xafb5, 0xac90, 0x2a63, 0xac29, 0x2a35, 0xa84c, 0xacfe, 0xa178, 0xace6, 0x1e37, 0xaa1b, 0x2a8c, 0x2c97, 0x26fb, 0x2fb6, 0x2429, 0x2be8, 0xa7ae, 0x2c72, 0x25e2, 0xaa56, 0xa81d, 0xad96, 0x274b, 0x204c, 0xad87, 0xaa9b, 0xa9b5, 0xac97, 0x0881, 0xa995, 0xac1c, 0x1c01, 0xac80, 0x25f1, 0x29ee, 0x252e, 0x2cc1, 0x24d6, 0x2de3, 0x274d, 0xac00, 0xabc2, 0x2c8c, 0x27e9, 0x18ee, 0x2d08, 0xaa09, 0xa8e1, 0xa1af, 0xaa16, 0x2651, 0xa6c9, 0x285d, 0xad14, 0x2eaa, 0xab5b, 0x2886, 0x2df7, 0xaaf3, 0xaa63, 0xa86b, 0x9c0a, 0x2411, 0x2863, 0x2917, 0x9b55, 0x285e, 0xae27, 0x2c3b, 0xad18, 0xac98, 0x9eb8, 0xa9e6, 0x9d1a, 0xae4e, 0xa0ce, 0x2e27, 0xafca, 0xaa2e, 0x3065, 0xb0fe, 0xa913, 0x292b, 0xacf2, 0xa8e1, 0xa6e6, 0xaa8d, 0xac26, 0x2eeb, 0xa550, 0x25fd, 0x2703, 0xb00b, 0xb0e8, 0xa4cf, 0x2274, 0x299a, 0xa7a8, 0x2a19, 0xa88b, 0x276b, 0x2874, 0xad52, 0x26ec, 0xac9d, 0xaae3, 0x262c, 0x9d18, 0xa1b6, 0x9a71, 0x1b7d, 0xac0c, 0x1fe5, 0x2a37, 0x968c, 0xa801, 0x2aa8, 0xaad0, 0x254a, 0xa7df, 0xaadb, 0xad77, 0x2bb8, 0xaebf, 0x2a5d, 0xaefc, 0xaff7, 0x20eb, 0xadca, 0xa7b8, 0x2735, 0xa640, 0x2bda, 0x2cf0, 0xa881, 0x2c55, 0xada3, 0x19a0, 0x2bd5, 0xab54, 0x2c10, 0x2983, 0x24d7, 0x201a, 0x2c9f, 0xa665, 0x2c7c, 0x2d0d, 0x2f18, 0xabca, 0x2cf0, 0x2542, 0xa8b4, 0x2c6a, 0xaba6, 0xae55, 0x2ffa, 0xa735, 0xae80, 0x248e, 0x2db4, 0xacc2, 0xacc6, 0xa92a, 0xae63, 0x9ef9, 0x2bbe, 0xa8e0, 0x2803, 0x2de1, 0x9a4e, 0xacd6, 0x2ec2, 0xa6e0, 0x1a20, 0x15c5, 0xa29e, 0xa8fe, 0x3061, 0xabf0, 0x257b, 0x2d16, 0xadf6, 0x9652, 0x2f66, 0xafc8, 0x29e4, 0x2b68, 0xaba8, 0x2bfd, 0x2558, 0xae4a, 0x304d, 0x2738, 0xab6b, 0x2c73, 0x2a60, 0x25b6, 0xa30d, 0xaf9c, 0xae19, 0xa9a2, 0xad45, 0x275d, 0x2f7f, 0xaf9a, 0xa63c, 0x2409, 0xa946, 0xa5c8, 0xab32, 0x24d7, 0xa9fa, 0x2d16, 0x9d46, 0x2c3f, 0x2f1c, 0x9d39, 0x259d, 0x2a9b, 0xac14, 0xa954, 0xae9f, 0x2c0b, 0xa4dd, 0xae74, 0x0ccc, 0x2d1e, 0xacff, 0x2c41, 0x2f7e, 0x27d1, 0x2b78, 0x9c15, 0xad18, 0x2b00, 0x2bce, 0x28c6, 0xa929, 0x2e25, 0xad4d, 0xab5c, 0x2c30, 0xaeb9, 0x2832, 0x2987, 0xa8cb, 0x29e4, 0x1e35, 0xadfd, 0x28db, 0xa8bd, 0x9d88, 0x2b2a, 0x9036, 0x2dda, 0x2f1c, 0xaa12, 0xa952, 0x2cf6, 0xac8c, 0x2d32, 0x2e35, 0x2292, 0x1abc, 0x2ffd, 0xa97c, 0x2972, 0x3033, 0xad7b, 0xa631, 0x2c18, 0x2818, 0x2cab, 0x2949, 0x2961, 0x2fc6, 0xa73e, 0xab25, 0x2c2f, 0x301b, 0x8cef, 0x2756, 0x2ea4, 0xada6, 0x9bc8, 0x2d53, 0xa545, 0x2ec9, 0x2f59, 0xae37, 0xa93b, 0xa841, 0x9eda, 0x1251, 0x2efc, 0xa8e5, 0x3006, 0x2cfb, 0x2b58, 0x2b6c, 0x2e4e, 0x245f, 0x22a2, 0x9d69, 0xac27, 0xa085, 0x2ce5, 0x2b2a, 0x1dea, 0xa532, 0x2911, 0x2eb8, 0x2c29, 0x2be1, 0x2c50, 0x1afb, 0x20b4, 0x9702, 0x2c7b, 0xa175, 0x24c3, 0xaa57, 0x2e70, 0x2cd2, 0xa64a, 0x25f1, 0x2549, 0x2a10, 0x25f7, 0x2bc7, 0x2ae5, 0x9c56, 0x2672, 0xae69, 0x27ba, 0x2e4f, 0x2853, 0xa317, 0x2a8c, 0xaa40, 0xae5a, 0x1b69, 0x2b25, 0x295d, 0xae48, 0xab0f, 0xad05, 0xa6ed, 0xae21, 0xabe3, 0x23a1, 0xad97, 0xa06a, 0x15f1, 0xaa65, 0x2b47, 0xa88f, 0xade8, 0x2905, 0x2182, 0xa6d9, 0xae61, 0xaaee, 0x1d68, 0x2c2d, 0xa4b0, 0x293f, 0x2220, 0xa9b3, 0xaecb, 0x28ad, 0xaa1e, 0xaf64, 0xaaa2, 0xa4bc, 0xaf9b, 0xad60, 0x1807, 0xaffa, 0x27e5, 0x2946, 0xaf46, 0x24d2, 0xad31, 0x2560, 0x2607, 0x300d, 0xadc4, 0x2eab, 0x2d14, 0xaca1, 0x2e55, 0x214d, 0x29ea, 0x2d57, 0xa65d, 0x25fc, 0xaa1a, 0xa1cf, 0x9a8e, 0xa68b, 0xa328, 0xa993, 0x23b3, 0x27e5, 0x269a, 0x285b, 0x21d8, 0x2a9f, 0x2a10, 0xacdb, 0x2fae, 0x29ab, 0xae80, 0xa0f5, 0xa8e9, 0xa8b3, 0xa513, 0x96e2, 0xb002, 0xa5d0, 0xaf33, 0xa7b4, 0x2869, 0x23f4, 0xa97a, 0x1890, 0xae99, 0x281d, 0x2fbb, 0x2834, 0xaff4, 0x2dc8, 0x2826, 0x26cf, 0x2dda, 0xadb8, 0xa5e6, 0x2a39, 0x2092, 0xad72, 0x2c74, 0xac04, 0xaca0, 0x2d16, 0x25e9, 0x2449, 0x2852, 0xacdc, 0xa30a, 0xa33f, 0xa3bf, 0x2f6c, 0xa9af, 0xa9bc, 0x2ec1, 0x9afa, 0x9a0d, 0xa8e8, 0xaeea, 0x2cfe, 0x29bc, 0x2efe, 0x2d8d, 0x2b3b, 0xa8d7, 0xab54, 0xaada, 0x2cbd, 0x2b20, 0x2dd1, 0x1c0f, 0x2ced, 0x2465, 0x2e67, 0x2c07, 0xaa32, 0x9ad8, 0x280f, 0xacf3, 0x2d02, 0x2d40, 0xa11f, 0x2c5d, 0x2231, 0xa7d4, 0x21a2, 0xaa37, 0x2492, 0xa9c3, 0x22aa, 0xabae, 0x2c08, 0x2887, 0xa3e7, 0x2b3b, 0x2e16, 0x1acf, 0x2c36, 0xa8b6, 0xa42d, 0x2d6a, 0x2d17, 0x1d73, 0x27c9, 0x2b6c, 0xa9ae, 0x225d, 0xa709, 0xa8af, 0xa6e3, 0xa39e, 0x2a98, 0xadaf, 0x2c55, 0x2ee4, 0x9fec, 0xa98f, 0x2922, 0xac6a, 0x2c45, 0x1bb9, 0x2905, 0xad42, 0xac53, 0xa38a, 0xae9a, 0xa7e4, 0xa0f9, 0xa818, 0xa8d6, 0x2d48, 0xae30, 0x2cc7, 0xa509, 0xa4df, 0xaff5, 0x2da2, 0xab05, 0xacd9, 0x1421, 0x2a9e, 0x1ee0, 0x9802, 0xab10, 0xac49, 0x1fb9, 0x1c7b, 0x25fe, 0xa795, 0xaeea, 0xa7ac, 0x26c4, 0xa5e2, 0xaf1a, 0x9a1d, 0xaa5e, 0xa267, 0x2d39, 0x2657, 0xad70, 0x2811, 0xaec9, 0xac29, 0x2ce3, 0xa872, 0x29b9, 0x274c, 0x288d, 0xa145, 0xa771, 0xab3e, 0xa8de, 0xa592, 0x2600, 0xa42a, 0xaccd, 0xabe8, 0x302e, 0xa9d9, 0x1d8a, 0x2e42, 0xabc4, 0x28ea, 0x28c4, 0xac63, 0x23f6, 0xa8a7, 0x2c9d, 0x29b3, 0x2a97, 0x2c82, 0x271e, 0xa07e, 0xa4d6, 0xa829, 0xa8d8, 0x2e79, 0x961f, 0xaed2, 0x2486, 0x2f7e, 0x2136, 0x2f82, 0x218a, 0x270a, 0x2bc3, 0x2eb6, 0x2172, 0x2341, 0x2a13, 0xab01, 0x2a23, 0x2d3d, 0xac84, 0x2429, 0x2a8b, 0xaf6b, 0x2df0, 0x2e3f, 0xae06, 0x2e41, 0x2e7b, 0xaecb, 0xaad8, 0x19e8, 0xacb3, 0xacbc, 0x2965, 0xae0a, 0x2b2e, 0x2397, 0x2918, 0x2b6e, 0x2988, 0xa964, 0x2b1d, 0x2daa, 0xa8de, 0x2ef7, 0x2d5c, 0x2900, 0x2d2a, 0xa8ac, 0xa9a3, 0x2de7, 0x2fee, 0xa886, 0x2cb1, 0xa79c, 0x21b4, 0x2a51, 0x2e5e, 0xaf73, 0x28a0, 0x2f8f, 0x2abe, 0x2c8b, 0x2c49, 0xa9d9, 0x2d71, 0x1a45, 0xaca8, 0x2e31, 0x2fab, 0xa08d, 0x2d95, 0x282b, 0xaf2e, 0xa389, 0xac0b, 0x2766, 0x2997, 0x94d0, 0x2c4b, 0xa003, 0x2fe0, 0xae93, 0x2dd4, 0xa79e, 0xacbb, 0xa9a7, 0x2dce, 0x2c7a, 0x2aa7, 0x2cd3, 0x2851, 0xaa99, 0x2795, 0xa455, 0x277b, 0x2e81, 0xa068, 0x2551, 0x3001, 0xa9e1, 0x2def, 0xaa80, 0x22c7, 0x2701, 0x2f05, 0xaa7e, 0x300b, 0x28a2, 0xaff8, 0x2c03, 0x20e1, 0xa307, 0x2cb8, 0x9420, 0xa99e, 0x2dad, 0xab0b, 0xadc5, 0x250a, 0xa8fb, 0xa3b4, 0x2c89, 0xaf1b, 0x1ffb, 0x2a0e, 0x99b7, 0x99a5, 0x302b, 0x2842, 0x2790, 0xa95f, 0xaf82, 0xac33, 0x2e2c, 0x2a37, 0xa05f, 0x2d91, 0xa2b0, 0xafbc, 0x2bce, 0x2ba1, 0x2f16, 0x2c1d, 0xa506, 0x2ce2, 0x28d8, 0xa865, 0x1d4c, 0x2e81, 0xaa8e, 0x2c1b, 0x9f59, 0x0d3d, 0x2f44, 0xac3c, 0x2a14, 0xa9b2, 0x2d57, 0xa12c, 0x27a5, 0x292a, 0x252f, 0x1f0b, 0x2e23, 0xaa46, 0x2c40, 0x23cb, 0xab9d, 0xad4f, 0xae6b, 0xac4c, 0x2a74, 0x1a55, 0xae3a, 0xa84a, 0xaf13, 0xa87e, 0xaca3, 0xa9d6, 0x2f1d, 0x2b35, 0xb010, 0xa694, 0xa121, 0x1c7d, 0xa0ea, 0xaa67, 0xa168, 0xabfc, 0x28be, 0x0896, 0xa787, 0xa741, 0xaf55, 0x2bed, 0xaade, 0x1841, 0xa0ef, 0x2a6e, 0x291c, 0xaaa5, 0x1a93, 0xa15f, 0x2d83, 0x2c6c, 0x29f3, 0xa82c, 0x9eff, 0x2523, 0x2c2c, 0x2b51, 0xaebe, 0xa849, 0x29d8, 0xad4b, 0x22e4, 0x2501, 0xab77, 0x28b7, 0xab8c, 0x1c68, 0xab69, 0xa8b5, 0xa646, 0x2cc4, 0xa9a0, 0xa9e4, 0xaad3, 0x1ace, 0x2b73, 0xac05, 0x25db, 0xaaf9, 0xa03d, 0xa589, 0x29c8, 0x2c79, 0x280b, 0xadd2, 0x2941, 0xac2d, 0xa3ab, 0xa73d, 0x2a62, 0xaa32, 0x20fa, 0x2c93, 0xa960, 0x2e98, 0xa8cb, 0x2982, 0x2b06, 0x2734, 0xad21, 0xac4d, 0x2eea, 0xaedb, 0xac31, 0x2a46, 0xad25, 0xa5a1, 0x3006, 0x25e1, 0xaba8, 0xa692, 0xaa4e, 0x2d6b, 0x2a83, 0x0aed, 0xa801, 0x2e26, 0xae58, 0x2dce, 0xa701, 0x2975, 0x2c16, 0xa931, 0x2885, 0xa9c5, 0x2883, 0xab65, 0x9c61, 0xa9ce, 0x29b5, 0xa6f1, 0x2a23, 0xaf14, 0xa62f, 0x2922, 0x2860, 0xa02e, 0xa6a0, 0x2c3c, 0x2a70, 0xaea3, 0x2839, 0x2059, 0xaca9, 0xa834, 0x29b5, 0xad94, 0x2b6d, 0x261d, 0x2a23, 0x28b7, 0xa5b8, 0xa994, 0x2c1a, 0xa4f8, 0xaee2, 0xad33, 0xaa04, 0xaa77, 0x2817, 0x2fd7, 0xaab3, 0x2c18, 0x2d96, 0xab0a, 0x259c, 0x2d7e, 0x22c9, 0xad8e, 0x2a86, 0xad06, 0xa735, 0x294a, 0xa159, 0x2d02, 0x2b1b, 0xa115, 0x1ee8, 0xa03e, 0x2d68, 0xa9e8, 0x2ca3, 0x2a6b, 0xabe7, 0x2b0d, 0xa9a3, 0x28b4, 0x2ed5, 0x29bd, 0x2a4e, 0x2efe, 0x2669, 0x2455, 0xa2ad, 0xa41d, 0xabbd, 0x29ac, 0x20e4, 0xac6c, 0x2c97, 0x2985, 0x295d, 0x1f1c, 0xa3af, 0x2942, 0x2ef2, 0xa866, 0x21e1, 0xa8e2, 0x28bd, 0x24a3, 0xaaba, 0x287d, 0xa71f, 0xa90e, 0xad70, 0xa82e, 0xacff, 0x8489, 0xa729, 0xac7d, 0xaa25, 0x9d31, 0xae05, 0xa92e, 0xac49, 0xacd0, 0x2e54, 0x27cd, 0xaec5, 0x0d65, 0x2347, 0x26a7, 0xad5c, 0xad62, 0xa15d, 0x9ddb, 0xa9cd, 0xaf81, 0x2f3b, 0x29b5, 0x9d5c, 0x2ce7, 0xae12, 0x24b8, 0x2e25, 0xae3e, 0x0e20, 0x2dd0, 0xaac4, 0x2845, 0x24ce, 0xaa6a, 0x9720, 0x2a8e, 0x2089, 0x296c, 0x2f85, 0x98ad, 0xadf1, 0x2f25, 0x2c38, 0x2c98, 0x2cd0, 0xad17, 0x2a52, 0xae66, 0x26bf, 0xa0fd, 0x8a02, 0x3010, 0x169d, 0xae5c, 0xa4bd, 0x2d0c, 0x2b3d, 0x2c62, 0xa318, 0x0612, 0xa890, 0xa55e, 0xaf48, 0x2ca4, 0xa975, 0xa835, 0x2a1c, 0x2ea2, 0x2150, 0x2daa, 0x1f1d, 0xa5c9, 0xacdb, 0x2b9b, 0xa305, 0x19bf, 0x297f, 0xaafe, 0x94e6, 0x2ca2, 0x2867, 0x2cf8, 0x2e9a, 0x2933, 0x9eb7, 0x2dd2, 0xacf6, 0x2b7e, 0x2ea3, 0xa2d6, 0x2cbd, 0xa92d, 0xa6cc, 0xa9e4, 0x9dc8, 0x2e43, 0x2313, 0xa46b, 0x2f99, 0x2486, 0xa911, 0xa465, 0xae4e, 0xaa0d, 0xa2c9, 0xa9b9, 0xa5f9, 0x9f1c, 0xab3c, 0xa126, 0xa867, 0x25a8, 0xa6ad, 0xa640, 0x2ee7, 0xaa90, 0xa1d3, 0x183b, 0xae78, 0xa866, 0x2be0, 0xacd8, 0xae13, 0x1b9d, 0x28ab, 0x057f, 0x22ae, 0x254a, 0xaa49, 0xac1d, 0xa868, 0xad42, 0x2521, 0xae9c, 0xa520, 0xacc9, 0xaf94, 0xad75, 0xa7b9, 0xa86b, 0x2543, 0x2558, 0xa743, 0xa2c5, 0xa9fa, 0xab7c, 0x2a80, 0xa978, 0xaed8, 0x2cef, 0xa064, 0xa4d2, 0xa822, 0x277a, 0xad04, 0x2044, 0xa41a, 0x2afd, 0xa224, 0x282c, 0xad46, 0xa70d, 0x2545, 0xa40e, 0x2774, 0xaad0, 0xa91e, 0x2150, 0xaa01, 0xa789, 0xa966, 0xa46c, 0x2c94, 0xaf0c, 0x302c, 0x255e, 0xaa78, 0x2db8, 0x2ea9, 0x2bf3, 0xa8ee, 0xa4dc, 0x2237, 0x98ae, 0x2c37, 0x1e1f, 0x2134, 0x2a53, 0xadab, 0x2299, 0xa35d, 0x2155, 0x243f, 0x2e5e, 0xa9bb, 0x28a6, 0x2d0d, 0xa66a, 0x28a1, 0x2eca, 0xae74, 0x2133, 0x9c9e, 0xaedd, 0xa281, 0xa900, 0xaafe, 0xa7de, 0xaa4d, 0xab28, 0xaa5f, 0x2c8c, 0x29a4, 0x2743, 0xa726, 0xa09e, 0x2fde, 0x2da8, 0x2bff, 0x23a5, 0x294d, 0xaa86, 0xa93c, 0x2e0d, 0x200f, 0xada3, 0x2711, 0x2ce7, 0x9c67, 0x2e6e, 0x2d10, 0x2eba, 0x1f62, 0x924f, 0xaceb, 0x109d, 0x2754, 0x2b09, 0xa99c, 0xac24, 0x2ce4, 0xafbb, 0x265e, 0x2b9a, 0xa80b, 0xa48f, 0x2cc0, 0xa131, 0xa70e, 0xa5eb, 0x191b, 0xac56, 0x2cf5, 0xad7e, 0xa85d, 0x2fc1, 0xa044, 0xaade, 0x2003, 0xa75d, 0x28a4, 0xaaa2, 0xaec2, 0xab9a, 0xa96f, 0xac43, 0xadab, 0x2fd5, 0x28bc, 0xaee5, 0x2ec5, 0xad73, 0xac0d, 0xa6ce, 0xa63f, 0xa911, 0x9db2, 0xaac6, 0xabf8, 0x2ce9, 0xb00f, 0xaa74, 0x1654, 0x21dd, 0xa627, 0x2b76, 0xa89e, 0x29db, 0xabf5, 0xae44, 0x2836, 0x2a3b, 0x2889, 0x2472, 0x2c63, 0x2a45, 0x29ab, 0x2ca8, 0xae3a, 0xa9a7, 0xad3a, 0x2993, 0x2278, 0x2356, 0xacc2, 0xac06, 0x2a05, 0x0c56, 0x2d14, 0x21fc, 0xa164, 0x2d0b, 0xac24, 0x2b81, 0x2d0c, 0xa5c5, 0xacfc, 0xac02, 0x2e6f, 0x2d44, 0xabef, 0xaba9, 0x28c8, 0x2f56, 0x2957, 0xa367, 0x2df2, 0xac94, 0x29e8, 0x286e, 0xa24c, 0x2d78, 0x272d, 0xad6e, 0xac35, 0x138a, 0x24e5, 0xaa91, 0x25c0, 0x2a4f, 0xa7fd, 0x2e33, 0xad50, 0xad1c, 0x2a41, 0xb023, 0xa653, 0xabe7, 0x2e1f, 0xace4, 0x2c44, 0xa3ed, 0xacf2, 0xae46, 0x26a3, 0x2c29, 0xb005, 0x27ea, 0xabc9, 0xa987, 0xa6fb, 0x2727, 0x99fa, 0x193d, 0xadb0, 0x240b, 0x2ada, 0xaff8, 0xa863, 0x2ca0, 0x25f9, 0xad44, 0xa175, 0x9c6b, 0xaa8f, 0x2782, 0x9a09, 0xa77b, 0xaa60, 0xaced, 0xac91, 0xa84a, 0xa919, 0x2337, 0x2d2c, 0xa221, 0xaddc, 0x206f, 0x2d79, 0x21a5, 0x2bf6, 0x9d89, 0x9d3a, 0xab03, 0xa9ac, 0x290d, 0xa21e, 0x2af2, 0xacc3, 0xa860, 0x2961, 0xa804, 0xa46d, 0xac4d, 0xa9af, 0xa8ac, 0x2c15, 0x245d, 0xa9fb, 0xabac, 0xae42, 0x27bf, 0xa8fb, 0xabf9, 0x1917, 0xa490, 0x1dab, 0xa750, 0xa8e5, 0xac68, 0x2a3a, 0x2a30, 0xa295, 0x24ff, 0x2dbe, 0xad29, 0x2cd0, 0x2372, 0xaab1, 0x1597, 0x2a94, 0xa927, 0x2fd3, 0x3060, 0x2cdc, 0x2d0b, 0xab60, 0xa827, 0xa871, 0x2dc3, 0xaa31, 0xa775, 0x2568, 0xb0a3, 0x2a8f, 0x9717, 0xb05c, 0xa95f, 0x2e6f, 0x272b, 0xac05, 0x2c22, 0x96b1, 0xa5c1, 0x2ca8, 0x1b3e, 0xa58e, 0xa173, 0x2e39, 0x2d8d, 0xaba4, 0x17a5, 0xa95d, 0x2a91, 0x2998, 0x26f6, 0xac5b, 0x2c4c, 0xa8dd, 0x2479, 0x244e, 0xac79, 0xa731, 0x8353, 0x2c8d, 0x2c48, 0xac76, 0xa0c1, 0xa56d, 0xaccb, 0x2a94, 0x2d74, 0xae85, 0xa68a, 0xa987, 0xad9d, 0x2d24, 0xa611, 0x2ae6, 0x231b, 0xad26, 0xacea, 0x28b0, 0xa469, 0xaa83, 0x274b, 0xb065, 0x2859, 0x2cee, 0x2d1a, 0xa5c2, 0x2988, 0xaeec, 0xa9f3, 0x2db2, 0x83bd, 0x261a, 0x2d1e, 0xa840, 0xa813, 0x2f1d, 0xac44, 0x276a, 0xaf12, 0x2a4f, 0xafaf, 0x29d6, 0x2be6, 0x28fa, 0x25f9, 0xa9d6, 0xaf3e, 0xa795, 0x22b7, 0x25d3, 0x2960, 0xaa80, 0x1d70, 0x9eb3, 0x20a5, 0x2630, 0x24f8, 0x2c8c, 0xaef7, 0xad35, 0xadc4, 0xa98c, 0x93b0, 0x26b4, 0xa946, 0x28ac, 0xa859, 0x994f, 0xa836, 0xaf61, 0xad91, 0xb058, 0x2b20, 0x2d96, 0x2cf8, 0x27e8, 0xabfc, 0x24f0, 0x2b8e, 0x9b7e, 0x2e33, 0xa7b6, 0x19ba, 0xa77d, 0xa409, 0x9f32, 0x1dda, 0x271d, 0x2cff, 0x2cbb, 0x28a8, 0xad64, 0xa977, 0x2234, 0xae62, 0x9ae5, 0x2cc2, 0x28ed, 0x2d06, 0xaaf6, 0x2b8a, 0xabef, 0xa8d3, 0x2c6e, 0x24bd, 0xa92d, 0x2016, 0xa919, 0x2851, 0x2811, 0x2b9d, 0xa517, 0xa3cb, 0xa81d, 0x2a9b, 0xabc9, 0x2b1c, 0x2ccb, 0xad16, 0xa943, 0xa902, 0x2a86, 0xae72, 0xa53f, 0xa8ba, 0xa159, 0x2ce9, 0x9aaf, 0xa2bc, 0x294e, 0xaf03, 0x238b, 0xa8ca, 0xa6f5, 0x2af8, 0x2d26, 0x2c94, 0x2482, 0x2ee5, 0x2e8a, 0xa6a2, 0x3052, 0x28dc, 0x2f4a, 0x2b50, 0x2b7d, 0x2bc5, 0x2eae, 0x2ccc, 0x2b63, 0x2d67, 0xa47d, 0x2bc9, 0xa32d, 0x2e86, 0xaa1a, 0xac1f, 0x2e08, 0x2aa4, 0x9886, 0x2ff8, 0x9ec6, 0xaa91, 0xa47a, 0xa4ab, 0x2cf8, 0x271d, 0x2e60, 0x2b12, 0x2ca7, 0x1561, 0x2d3f, 0x294d, 0xa28d, 0xa3b1, 0x2fa6, 0x2a1c, 0x287d, 0x9deb, 0x2d5a, 0xa47f, 0x3033, 0x2c58, 0xa9bb, 0x2f08, 0x2c28, 0x216b, 0x2ea3, 0xa80e, 0xa11d, 0xa5ee, 0xab0d, 0x9e31, 0x2eb2, 0x2a79, 0x28d7, 0x2dd8, 0xa00f, 0x2876, 0x267f, 0xa4f4, 0x2d1d, 0xa98f, 0x2dc5, 0x2a1c, 0xaf33, 0x2e2b, 0x9f3b, 0x1ff1, 0x29d8, 0x2cad, 0xac84, 0xa9cd, 0xad4e, 0xaf13, 0xa93d, 0x2e12, 0xaed3, 0x2d1c, 0x2949, 0x2df2, 0x2f34, 0x20e7, 0x9d13, 0x2d2e, 0x2ce2, 0xafb4, 0x2f29, 0x2e24, 0xa9b6, 0x2cec, 0xa955, 0x26f5, 0x253f, 0x20b9, 0xa74d, 0xa8be, 0x2b24, 0x2737, 0x9f6d, 0xa721, 0xa9af, 0xaa2b, 0x2aca, 0xacc2, 0x2d20, 0x240b, 0x2654, 0x2d2d, 0x2daf, 0x28fb, 0xabbb, 0xa97f, 0x2de6, 0xa52d, 0x2b10, 0x22cf, 0xa96a, 0x2e0b, 0x986d, 0xa5d9, 0x2d47, 0x2d27, 0xa2f7, 0xaa52, 0xad27, 0xa03b, 0x2c2d, 0xafa9, 0x2c04, 0x921d, 0xad56, 0xaa14, 0x2177, 0xacab, 0x2ab6, 0x2cb2, 0xab5c, 0xa91f, 0x29b2, 0xa8bd, 0xa644, 0xaa05, 0xac84, 0xa0b1, 0xad00, 0x2cfa, 0x2d70, 0xa2e0, 0xa816, 0x2e1a, 0xa284, 0xa8d2, 0x286d, 0xa4ac, 0xae51, 0x2753, 0x18ef, 0xaa84, 0xaba9, 0xa20e, 0xada5, 0x26ec, 0x18fd, 0xae15, 0x2d4b, 0xac73, 0xa99b, 0x2712, 0x2802, 0xaee1, 0x2dd6, 0xab72, 0x2cee, 0xa994, 0x254d, 0xa9cc, 0xa4f1, 0xae8c, 0x2ef8, 0x2cd1, 0xaae4, 0xa28b, 0x2e7b, 0xac6b, 0xa1e5, 0x2cba, 0xab69, 0x2462, 0x949f, 0xad6e, 0x2ba5, 0x283c, 0xa8e9, 0xac93, 0x2a1d, 0xa428, 0xa62f, 0x186e, 0x2973, 0x2b3f, 0xa1e1, 0x2bd8, 0x2443, 0x287b, 0x2321, 0xa158, 0x244a, 0x1426, 0x287f, 0x2c1c, 0xa43e, 0x2839, 0x2aa5, 0x25f7, 0x2e68, 0x1d15, 0xa496, 0x2f4c, 0xad9d, 0xae55, 0x2815, 0x2ba4, 0x9e8f, 0x0f76, 0xae59, 0x25a7, 0x2df6, 0x2896, 0x22b1, 0x2f88, 0xacf2, 0xac43, 0xa938, 0x2c05, 0x198c, 0x2335, 0x2807, 0x9c9d, 0xac36, 0x2754, 0xac1b, 0xa22b, 0x29d6, 0x2abb, 0x25af, 0x9404, 0x21f2, 0x249d, 0x2846, 0x2979, 0xa138, 0x28fa, 0xae09, 0xaa27, 0x302f, 0xae26, 0xac4f, 0x2ad0, 0xad35, 0x2eed, 0x2416, 0xa9cc, 0x28e4, 0xac8f, 0x2cc0, 0xab72, 0x2815, 0x285a, 0xb09d, 0xa2b6, 0x2b5d, 0xacdc, 0x2839, 0xa5ea, 0xae08, 0xa689, 0x2c11, 0xa87c, 0xa1d1, 0x2c02, 0x277f, 0xabb4, 0x2f47, 0xa857, 0xac1c, 0x2656, 0x2971, 0xa267, 0xa4e4, 0xac91, 0x28e1, 0x2d4e, 0x2595, 0xac30, 0xa77c, 0xaeed, 0xa74c, 0x1904, 0xab47, 0x2c06, 0xac6a, 0xa26f, 0xaaa7, 0x2a07, 0xa964, 0x195a, 0xa7fb, 0xb01f, 0xad41, 0x2d1b, 0x2d57, 0xa89f, 0x26af, 0xa242, 0xaf00, 0x2b4b, 0x2fb9, 0xa83c, 0x2cb4, 0x2bbc, 0x2cc4, 0x2cf4, 0x2f3f, 0xa623, 0xabea, 0xa91e, 0x2c18, 0xab61, 0xa574, 0xa513, 0xa1bf, 0x2fd3, 0xa5ce, 0x1d95, 0x2edd, 0xa651, 0xac35, 0xac67, 0x2bdb, 0xad97, 0xadab, 0x2775, 0xab12, 0x2aff, 0x2c86, 0x24e2, 0x2c0a, 0x2cb2, 0x29cd, 0xa8fc, 0xa817, 0x1e63, 0xa92f, 0x2b47, 0xaa21, 0xac30, 0x2e4a, 0x24b3, 0xa042, 0x294e, 0xae74, 0xac15, 0x2dea, 0xab7d, 0xa8b3, 0x2729, 0x9d91, 0x2854, 0x9329, 0x99be, 0x1f71, 0xa7f4, 0x2a71, 0x2ba8, 0x2a5c, 0xa9a5, 0xa76b, 0xaac7, 0xad98, 0xa90e, 0x2d94, 0xb003, 0x1b44, 0x2d3b, 0xad89, 0x302d, 0x2ad6, 0x2661, 0x2b97, 0xa85e, 0x2c82, 0xa59a, 0x2d2e, 0x2d6a, 0xa297, 0xa85d, 0x2052, 0x2886, 0x2859, 0x2d0f, 0x2982, 0x2e68, 0x2d46, 0xae1e, 0xa815, 0x2792, 0x9715, 0xac07, 0x29e5, 0x2bae, 0xa5a2, 0x22d5, 0x2699, 0xaab9, 0x2b3d, 0xa963, 0x2ddc, 0x2447, 0xaed1, 0x24e4, 0x2b80, 0xadac, 0x271c, 0x2f83, 0xa428, 0x2dbd, 0xa537, 0x26e3, 0x2e8d, 0x2489, 0x285b, 0x2f41, 0x2b94, 0xaec0, 0x232c, 0x2a43, 0x2b33, 0xac4e, 0x1ff7, 0x2c07, 0x9e07, 0x9f86, 0xac52, 0x24ae, 0x2d54, 0xaa10, 0x2710, 0xa784, 0xa573, 0xad77, 0x23ed, 0xa8fa, 0xad96, 0xadaa, 0xa616, 0xad7e, 0x2d17, 0xad5e, 0x225e, 0x1c8d, 0xad93, 0x2bcb, 0x25dd, 0xacce, 0x9c93, 0x2865, 0xae8b, 0x15be, 0xad06, 0xaf6f, 0xa848, 0x9cff, 0xa808, 0xaf23, 0xad94, 0xa71e, 0x2444, 0x29b2, 0x29e5, 0xa3a9, 0x2a77, 0xaec7, 0xaf5b, 0xa7e6, 0xac3f, 0xacc0, 0xa370, 0x2419, 0x2c2b, 0xaed5, 0x9263, 0xaa0d, 0x2c58, 0xa8ae, 0xad56, 0xab26, 0xaf5d, 0x2ac5, 0x2d57, 0x2206, 0x2d81, 0x274e, 0xa7c1, 0x24d0, 0xa64b, 0xa884, 0x29f9, 0x269a, 0x2c9a, 0xa967, 0xa2ad, 0x1912, 0x2efe, 0x274f, 0x2c9b, 0x9f2c, 0x2d37, 0xaa1a, 0x2989, 0xa60f, 0x16a3, 0x27d3, 0x2759, 0xac72, 0x2e67, 0xaacc, 0xac1e, 0x2b14, 0x2f0c, 0xaac0, 0xa1a7, 0x2d36, 0x2c73, 0x2eeb, 0x2648, 0x2eb1, 0xa8a6, 0xab9b, 0x9b01, 0x2e83, 0x24c7, 0x2522, 0x2df2, 0x181b, 0xa6d7, 0xa6a6, 0x2e61, 0xa621, 0xa9cb, 0x2da7, 0x2cec, 0x2f55, 0x2eae, 0x2863, 0xa956, 0x2470, 0xaceb, 0x2aab, 0x2d6a, 0xadc4, 0xa231, 0x28c2, 0xa34c, 0xaa98, 0xa504, 0xaa90, 0x2894, 0xae97, 0xa84b, 0x2983, 0x2930, 0x2e7a, 0xa72b, 0xacbe, 0x2570, 0x2e1e, 0xa999, 0x1293, 0x286f, 0xa4fe, 0x2cde, 0x2d63, 0x2621, 0xa8df, 0x2e92, 0xa351, 0x28b8, 0x2d3b, 0x2b10, 0x2e2a, 0xa2cb, 0x2727, 0xa655, 0x251f, 0xace5, 0x1953, 0xabdc, 0x213e, 0x268f, 0x2c1a, 0x2c07, 0xa565, 0xab52, 0x9b4f, 0x2824, 0x2dcd, 0x2bad, 0x2ad5, 0x2aae, 0xad11, 0x2c03, 0xa7c6, 0x297c, 0x2df1, 0x213f, 0xa9c1, 0x21d1, 0xa808, 0xa95a, 0xa9ad, 0xa894, 0xa9c5, 0xab64, 0xabc8, 0x2ac4, 0x2d12, 0x9bf4, 0xac87, 0x9cc8, 0xad18, 0xafed, 0x2c18, 0xac3b, 0xb014, 0x2c0a, 0x2895, 0xaf4c, 0x197b, 0xa4f5, 0xae42, 0xa4b1, 0x2c8d, 0x2c85, 0xa936, 0xabf0, 0x238e, 0xa8f3, 0x2b81, 0x2741, 0xaedb, 0xac27, 0xa192, 0xab4f, 0x2c68, 0x2a8d, 0xa85a, 0xabdd, 0x2007, 0xac52, 0xaf4f, 0x2a31, 0xa82b, 0x2a04, 0xa89a, 0xaa2a, 0xa21c, 0xaab3, 0xa90e, 0xae57, 0x292f, 0xab28, 0x289f, 0x2a14, 0x2864, 0x2499, 0x24c9, 0xac0b, 0x1efa, 0x2d9d, 0xa93a, 0x2b39, 0xad14, 0x289c, 0x2563, 0xaa91, 0xaa04, 0xaaa4, 0xacd2, 0x26cf, 0x2236, 0x281e, 0x2aa1, 0xa816, 0xacd7, 0xadf4, 0xa8e3, 0xabdd, 0xacd3, 0xadec, 0xa4e8, 0xacc3, 0xa664, 0xa27b, 0x2633, 0xaf60, 0x254c, 0x2e2d, 0xab13, 0x2bbb, 0xa903, 0xaa51, 0x2e1d, 0x2c5b, 0x29d8, 0xa8da, 0xa6aa, 0xa82b, 0x2b58, 0x2c1e, 0xa877, 0x2cec, 0xa684, 0xae1c, 0xa675, 0xadd4, 0xab47, 0x2545, 0x1e41, 0xadb2, 0x2d47, 0x29d5, 0x9c5b, 0x1eee, 0xac1f, 0xabdd, 0x27ec, 0x20c2, 0xa514, 0x9caf, 0x2f6c, 0xad05, 0x2c5e, 0xa8fd, 0xa4aa, 0x2c73, 0x2e99, 0x26e1, 0x1904, 0xa843, 0x2562, 0xa9b5, 0xa600, 0xa6aa, 0x2e96, 0xa8f1, 0xaa7a, 0x2991, 0x29ea, 0xaf00, 0x2eca, 0x2a58, 0xafa0, 0x2a80, 0xa411, 0x290d, 0xab6f, 0x2cc6, 0xac70, 0xa6c8, 0x2ec9, 0x90e7, 0x2555, 0x2cdc, 0xab18, 0xaa6a, 0x2eb2, 0xaf4e, 0xa449, 0xa0a4, 0x2675, 0xad88, 0xa1ce, 0xa79e, 0xad75, 0x2878, 0xa8c5, 0xa455, 0x2a21, 0xa510, 0xa8c0, 0xa61b, 0x2a0e, 0x27be, 0x9981, 0x29a8, 0xa712, 0x2fcc, 0xaa16, 0x292e, 0x2e69, 0x28ef, 0xa2b2, 0xa25d, 0xa0dc, 0x971e, 0xa972, 0xaefc, 0xadfe, 0xa89c, 0xa4cb, 0xae16, 0x2f66, 0xad7e, 0x96c9, 0x2857, 0x2c5a, 0xac20, 0x2c0f, 0xaf5b, 0x2f26, 0x2a31, 0x23fd, 0x2db3, 0x9ccf, 0xb01f, 0x251b, 0xa704, 0xae50, 0x2277, 0x2b36, 0x290b, 0x2db2, 0x28f7, 0xa87e, 0x297c, 0x2c36, 0xa58d, 0x29be, 0x2cf0, 0xaf54, 0x2f00, 0xa85c, 0xaa0d, 0x9c89, 0x2b20, 0xaca7, 0xa4dd, 0xa8e0, 0x1202, 0x1c6c, 0x2bdd, 0xaa5a, 0x2f83, 0xa92f, 0xa840, 0xa833, 0x2db1, 0xad55, 0x2b26, 0xaa7d, 0x175e, 0x2528, 0x292e, 0xac8b, 0x2f2b, 0x2d4f, 0xad1c, 0x2426, 0x2bec, 0x2a8b, 0x2c6b, 0xa76f, 0xabaa, 0xa981, 0x24d5, 0x2640, 0xa5e8, 0x26ca, 0x2535, 0xac05, 0xab99, 0xaa3b, 0x2c5f, 0x2d38, 0xaf28, 0xa63e, 0x224f, 0x2370, 0xabad, 0xa2e8, 0xac1e, 0xadcd, 0xa2b0, 0xaac6, 0xaedc, 0x2939, 0x1c74, 0xac75, 0x2f74, 0xabc0, 0x22d0, 0x23ec, 0x22ef, 0x252e, 0xaa2d, 0xae97, 0xae15, 0x9614, 0x286d, 0xacdc, 0x2981, 0x2608, 0xa6bf, 0x299e, 0xae1f, 0x2578, 0xaaed, 0xa246, 0xa431, 0x27cf, 0xaea6, 0xae2b, 0x1d31, 0xa156, 0x2996, 0x2f45, 0xa6cd, 0x1c89, 0x29ed, 0xa662, 0x1e9d, 0x1ced, 0xac7e, 0x2a9e, 0x208c, 0xa532, 0x28fe, 0x271c, 0xabe3, 0xa46c, 0xadb2, 0xa85c, 0x2692, 0x9984, 0x2ef6, 0xa92d, 0x2de8, 0x2f59, 0x27fe, 0x2ad2, 0x301e, 0xac0a, 0x2e0d, 0x2e3a, 0x2b32, 0x2e9e, 0x2a4b, 0xaf4e, 0x2afa, 0xa484, 0xa4ca, 0x2bc9, 0xa41a, 0xaebe, 0x2c08, 0x2c4d, 0x298c, 0x16d4, 0x2e3c, 0x2839, 0x9d22, 0xa937, 0xaec1, 0x2e22, 0x1dca, 0x1fcd, 0x1a67, 0x2c39, 0x21ee, 0x2ad5, 0xab48, 0xad59, 0x29e8, 0x9c6d, 0x2924, 0x2866, 0xa67e, 0xaaab, 0x2f83, 0x23f8, 0xaaf5, 0x2a35, 0x2c6b, 0x2c71, 0x2824, 0x2fb1, 0xad23, 0xa78d, 0x2588, 0xad25, 0x8537, 0x2253, 0xa522, 0xa004, 0x21f4, 0xac9b, 0x2a4f, 0xa73d, 0xa4f1, 0x269f, 0x207f, 0xa7c2, 0x2c4b, 0xae2e, 0xa729, 0xa321, 0xacc9, 0xacc0, 0x28b9, 0xad4b, 0xac0c, 0x9559, 0x2a52, 0xa720, 0xaf04, 0xacfa, 0xaeb7, 0xa769, 0xad9a, 0xaa60, 0x9487, 0xa620, 0x266d, 0xa6ac, 0xab45, 0x9ee2, 0x2d29, 0x255c, 0xab43, 0x2ac6, 0xaa2d, 0xae15, 0x2930, 0xaee5, 0x2d59, 0xaaca, 0xa9e2, 0x29d2, 0xad90, 0xac9b, 0x2a46, 0x265c, 0xaf7b, 0x20f7, 0x2b29, 0xacc1, 0xacaf, 0xabf5, 0xaa4b, 0xa860, 0x9fde, 0xafc0, 0xab14, 0x9c01, 0x20b4, 0x2a67, 0x28ad, 0xaa33, 0x2241, 0x27ce, 0xa63a, 0xa5d6, 0x2afa, 0x2987, 0xa665, 0xaf40, 0x2029, 0xac4d, 0xaf84, 0xaf13, 0x2c73, 0xac45, 0x27b0, 0x27e3, 0x28e3, 0xa985, 0x258e, 0xae17, 0x28c4, 0x1bd1, 0xa752, 0x21e1, 0xac03, 0xa47d, 0xafd4, 0x1e96, 0x2919, 0x2bb1, 0x2d3d, 0x2d4d, 0xaa9c, 0x9ecd, 0x2a51, 0xac9f, 0xa836, 0xa8d9, 0xac90, 0xaa91, 0xa0b2, 0xa6a2, 0xa11a, 0x2c13, 0xae59, 0x2b49, 0x2852, 0xafed, 0x1777, 0xaac6, 0x2a06, 0x20c5, 0x2c43, 0x1b35, 0xa0c8, 0x9e94, 0xac0b, 0xa44b, 0x1d79, 0x13bc, 0xab44, 0xac45, 0x08b8, 0x2135, 0x20a9, 0xad68, 0x1795, 0xa8ad, 0xa8ce, 0x2e75, 0xa255, 0x27a5, 0x2d40, 0xa436, 0x1351, 0x2d6f, 0x2ec4, 0xac78, 0x239f, 0x2d88, 0xa880, 0xabbf, 0x2e37, 0xab4e, 0xa16b, 0x26ed, 0x2890, 0x2a64, 0x2cda, 0xac32, 0xa31f, 0xa49d, 0xad0b, 0xabf6, 0x260a, 0xa847, 0xaafc, 0x2d21, 0xa96c, 0xad21, 0x2f81, 0x2609, 0x2c81, 0xa060, 0xad40, 0xacd4, 0x26d6, 0x1f32, 0xa979, 0x2012, 0xad49, 0xa73c, 0xa06f, 0x2a8e, 0xa752, 0x2f07, 0x29bf, 0x262e, 0x252d, 0xa62c, 0x254d, 0xa3b2, 0xacc9, 0x9c65, 0xa97f, 0xa6c1, 0xa66d, 0xad02, 0x2bf6, 0xad38, 0x9b3d, 0x2c98, 0xa0b2, 0xa935, 0x2cf0, 0xa20e, 0xad9c, 0x29b6, 0xa8e1, 0xa76c, 0x2d62, 0xad50, 0x2ca9, 0xa5f7, 0xad38, 0x2e83, 0x9da1, 0xaa78, 0xa46e, 0xa5e6, 0x2d7b, 0x2bb6, 0x2c0e, 0xa82c, 0x2dd4, 0xa5b1, 0xa648, 0x1e9d, 0x2b9c, 0x286f, 0xa81a, 0x2d0b, 0xa732, 0x2a13, 0x235d, 0xad9f, 0x2e11, 0x28fe, 0xa91d, 0x2823, 0x2f5c, 0x2529, 0xa02a, 0xab15, 0xac2b, 0xa141, 0x29ce, 0xacde, 0x26d5, 0xa298, 0xadc2, 0x0f05, 0x2ac8, 0xac4d, 0x2eac, 0xa429, 0xabe7, 0x9451, 0x27e4, 0x2e47, 0x187b, 0xa5d7, 0xa17b, 0x9e5e, 0xaeab, 0x9d42, 0x2953, 0xad72, 0xa496, 0xabd6, 0xa82a, 0xa8e1, 0x2d06, 0xa505, 0x2b3b, 0xac69, 0x26fe, 0xa5f5, 0x2ba1, 0xaf69, 0xac0f, 0x2ca2, 0xaa26, 0x2a34, 0x2928, 0xa9a2, 0x2c5f, 0xa03f, 0xab25, 0xa914, 0xa8e2, 0xaf41, 0xae1c, 0x2450, 0xae9b, 0xa82f, 0xa484, 0xac4a, 0x2bdd, 0x9754, 0xaa86, 0xac83, 0x1f68, 0xa85e, 0xad2e, 0xac8c, 0x269a, 0xaa99, 0x183b, 0x2ade, 0xa60c, 0x2893, 0xaec3, 0x2c66, 0x24ce, 0xa7ff, 0xa88e, 0xa779, 0x24ea, 0xa667, 0x1d1f, 0x2d17, 0x291a, 0xa729, 0x26e7, 0x301b, 0x2d2d, 0x1f81, 0x2d5d, 0x2d41, 0xa615, 0x11b5, 0x2e84, 0xa810, 0xa726, 0xa772, 0x2103, 0xae3a, 0x2c32, 0xaa67, 0xa7e2, 0x2ec7, 0xaa1f, 0xad26, 0x29d8, 0x25aa, 0xacc5, 0xabaf, 0x2f3f, 0xa83b, 0x2c22, 0x2544, 0x282d, 0xa5d8, 0x2afc, 0xa8e2, 0x2b78, 0xa61b, 0x25ad, 0x9dd0, 0x93d0, 0x2bb9, 0x9a02, 0x29bb, 0xaebc, 0xa0c5, 0xa4b7, 0xa313, 0xaf73, 0xa4e6, 0x2a75, 0xaf7c, 0xaac5, 0x28b2, 0xadf0, 0xa84b, 0x2823, 0xaa38, 0x2dad, 0xa97b, 0x2519, 0x285e, 0xa00e, 0x2aa1, 0x2837, 0x2486, 0xa466, 0xac53, 0xae8d, 0x2ef5, 0xa608, 0xac62, 0x2d09, 0xaf59, 0x2e82, 0x22e7, 0xa1a5, 0xa65f, 0x23dc, 0x2f80, 0x2a59, 0xae4f, 0x2e0c, 0xa66a, 0x26a4, 0x2b15, 0x9bf4, 0x1433, 0xabf4, 0x2bb6, 0xab0e, 0x9e55, 0x1fbd, 0xad28, 0x2f5f, 0xa7d9, 0xaa42, 0x2b9c, 0x28b7, 0xa43d, 0x2e06, 0x2d89, 0xaf34, 0x2a3b, 0x26c2, 0xaba3, 0x2da0, 0x2e98, 0xa9da, 0x21c1, 0x2e4b, 0xaad1, 0x26b5, 0x2743, 0xa96b, 0xa741, 0x223f, 0xaf34, 0x2d67, 0x2968, 0xacbe, 0x2747, 0xa957, 0x2d04, 0x9a9f, 0x19d5, 0xa926, 0xac70, 0xa843, 0x2702, 0x2c6f, 0xae03, 0x200b, 0x2459, 0xaa00, 0xa58f, 0xa99a, 0x2f30, 0x2fe0, 0xaa8a, 0x256e, 0x2c51, 0x2d27, 0xac71, 0x2a81, 0x2924, 0xa8b1, 0xb02d, 0x2ce6, 0x2c2a, 0xaa54, 0x2db4, 0xab72, 0xab01, 0x29e2, 0x268b, 0x2b98, 0xac70, 0xae5d, 0x2dab, 0x2672, 0xabf2, 0x2347, 0xa186, 0x2908, 0x23e0, 0x24c9, 0xa83e, 0x22cb, 0xa8b6, 0x27df, 0xa176, 0xa3b4, 0xa7b4, 0x2ec8, 0xac27, 0x2428, 0x2cb6, 0x9fa3, 0x9fe9, 0x2957, 0x2877, 0x2c19, 0x27d8, 0xad3f, 0xa595, 0xad9c, 0x9a3d, 0x18c1, 0x2cd1, 0x2962, 0x2bc8, 0x2c94, 0x234a, 0x2318, 0x2503, 0x26bc, 0x9dce, 0xa8ff, 0x2ef3, 0xa89a, 0x2a69, 0x30ac, 0x99b4, 0x2c71, 0x2b84, 0x197e, 0xa9b1, 0xa8f2, 0x2a00, 0xad6f, 0x2b47, 0x2a1d, 0x1fa5, 0x2e45, 0x2b41, 0x2910, 0xa027, 0xad11, 0xa949, 0x2cd1, 0x2dbd, 0xac7f, 0xa851, 0xa1ee, 0xa895, 0xacb4, 0x2b3c, 0x9d19, 0x2512, 0x2867, 0xa42e, 0x10dc, 0xa870, 0xa1bd, 0x2bb9, 0x2002, 0xac05, 0xac29, 0xa10e, 0x10bc, 0x2bc6, 0x2acc, 0xacaf, 0x2d75, 0x2c87, 0xaf7c, 0x1d48, 0xaded, 0xa1cc, 0x82f9, 0xac41, 0xabe0, 0x2640, 0x1d61, 0xa4d7, 0x28ce, 0xa72e, 0xaccf, 0x296d, 0xa6d8, 0xad0f, 0xad8a, 0xaaf7, 0xad39, 0x27d8, 0xaa1a, 0xa4b9, 0xacd8, 0xa5e4, 0xa806, 0xaccb, 0x239a, 0xa909, 0x2487, 0x2caf, 0x271e, 0xae3f, 0x26a6, 0x2ae4, 0xaf61, 0x2c29, 0xa6a7, 0x25ca, 0xab93, 0x28cb, 0xaf41, 0xa8ef, 0x0d4c, 0xac81, 0x244b, 0x28f1, 0x2a60, 0xa411, 0x2e55, 0xa795, 0x2e19, 0x2e20, 0xa538, 0x2df6, 0x2b79, 0x254d, 0xa440, 0xa446, 0x2495, 0xaa3c, 0x2657, 0xac7e, 0xa312, 0x2d29, 0xa7d5, 0xa34c, 0x9dc0, 0xa837, 0xada2, 0x24b2, 0xa8de, 0x0114, 0xad81, 0x28da, 0xa2c7, 0xa88c, 0xac02, 0x2269, 0x1a14, 0xa286, 0x267c, 0x29b4, 0x245d, 0xac4a, 0x99fb, 0x2378, 0x23e0, 0x2ddd, 0xaf73, 0x29d6, 0x2d8e, 0xadff, 0xadf4, 0xa381, 0xab9b, 0xa91f, 0x2dd7, 0xab56, 0xab8b, 0x2f37, 0x2ae1, 0xa0a6, 0x2450, 0xaf36, 0xa857, 0x2e4c, 0x2015, 0xaef6, 0x2e14, 0xa9dc, 0xa1e0, 0x21ed, 0xa5a3, 0x21b0, 0xa05c, 0xaac7, 0xac7b, 0x2929, 0xa442, 0x29e0, 0x257f, 0x9f8c, 0xa8cc, 0x2c3e, 0x266d, 0x2c70, 0xa176, 0xaadd, 0x1a9f, 0x2ca8, 0xad8e, 0x24ab, 0xa9b1, 0xaa5d, 0xa6f0, 0xadb6, 0x2eff, 0xa955, 0xaf13, 0x294e, 0x24fa, 0xad38, 0x2e15, 0x2875, 0xae1a, 0x2a03, 0x2e4e, 0x258c, 0xac89, 0xa663, 0xac44, 0x2111, 0xa8ba, 0x25c9, 0xa389, 0xa4e8, 0x2401, 0xaba9, 0xa8a1, 0xa6a8, 0x2717, 0x25fe, 0xacb3, 0xaecc, 0x2945, 0x2bc8, 0xa3e9, 0x2db8, 0x263c, 0x1c5a, 0x294a, 0xa9e0, 0x1df8, 0x2b6f, 0xac26, 0xab45, 0x2e50, 0xa59d, 0x2447, 0x243f, 0xad8c, 0x26dc, 0x28ed, 0x2e31, 0xadc5, 0x2996, 0x2dba, 0x2596, 0x2edd, 0x28c5, 0xa5cd, 0xa2a3, 0xa486, 0xaa9b, 0x21fa, 0x28ba, 0x2cff, 0x26e1, 0xad0c, 0x203d, 0xa9f0, 0xa93b, 0xab74, 0x1d65, 0xae57, 0x2493, 0x206f, 0xaaee, 0xa914, 0xa3d7, 0x2b9f, 0x29c8, 0xaea0, 0xa411, 0x204f, 0xaf64, 0xa4ad, 0x2d39, 0xac21, 0x152c, 0x279f, 0xa91c, 0xa96f, 0xac0c, 0xaf87, 0x24eb, 0x2bda, 0x2b0d, 0x28a2, 0x2d02, 0x29ea, 0x2c21, 0xa64b, 0xad96, 0x2135, 0xab68, 0xa70e, 0x2bb4, 0xad28, 0x2aee, 0xacd0, 0xa815, 0x26ce, 0x2434, 0x2d3d, 0x267d, 0xa460, 0xad5d, 0x2ae6, 0x2e5c, 0x2b13, 0xaaf9, 0x27a3, 0x219a, 0xaf42, 0x1899, 0xaaed, 0xac11, 0xa88a, 0x2d1b, 0xad4b, 0x2baf, 0x2d93, 0xa3c8, 0x28c6, 0x259c, 0xa582, 0x2ff7, 0xa80a, 0x2c3b, 0x2b00, 0x8c21, 0xae14, 0xa933, 0x2a2b, 0xaa79, 0x2f0f, 0x2a64, 0x2401, 0xaebf, 0x2ee1, 0xa208, 0xa934, 0x2f1a, 0x28bb, 0xa660, 0xa933, 0xab19, 0x2a92, 0x2a77, 0x2543, 0x2665, 0xa2ab, 0xacaa, 0xa808, 0xa5a0, 0xac63, 0xaa0f, 0xa95d, 0xa9d8, 0x2d38, 0xac32, 0x2841, 0x1f1f, 0xa6a8, 0x1c0b, 0x285f, 0xa525, 0xa876, 0x209e, 0x2f24, 0x2503, 0x2b98, 0xa531, 0x1712, 0xae4b, 0x2e6f, 0xac0a, 0xb062, 0xa90d, 0x2c27, 0xa5e5, 0xa3fd, 0x2b05, 0x288d, 0x2c05, 0xa866, 0x2e76, 0x1fcc, 0xae4b, 0xa237, 0x2cac, 0xa8a3, 0x2691, 0x2fcc, 0x2329, 0x2c1d, 0xa83e, 0x23b6, 0x28b7, 0xa7f6, 0x2e01, 0xadd2, 0x2ad9, 0x21d0, 0xac31, 0xa96b, 0x27bf, 0x2b8a, 0xa4a5, 0x2cfb, 0xa8a6, 0x28c3, 0x2f4a, 0xadd7, 0xac22, 0x2f4d, 0x2c2a, 0x2d71, 0x2bb3, 0xadce, 0xab23, 0x2c00, 0x20f2, 0x2cbc, 0x2b24, 0xaf14, 0xab6e, 0x2fbf, 0x1f90, 0x9ae7, 0x288c, 0x244f, 0x2da1, 0xa654, 0xa598, 0x2e7e, 0x2d9c, 0xaa7f, 0x2a7b, 0x2e29, 0xa846, 0x2a7f, 0x2a6a, 0x1657, 0x27f9, 0x2cc3, 0x2e93, 0xa4ef, 0x18ea, 0x2740, 0x2859, 0x2df9, 0x2e3f, 0x9914, 0xaa64, 0x2c75, 0xac35, 0xa871, 0x2a14, 0x2829, 0xa959, 0xa1ea, 0x2677, 0x2818, 0x2843, 0x2ac6, 0xa2c4, 0x2b01, 0x202d, 0xaa7f, 0xa837, 0x29c7, 0x9c2d, 0xad47, 0xa6a7, 0x9e39, 0xacba, 0xa671, 0x2872, 0xa032, 0x2c2a, 0xa45a, 0x2820, 0x29a9, 0xa9a5, 0x29e4, 0x2e7e, 0xae6f, 0xa550, 0xa93a, 0xa83c, 0xa6f0, 0xaad8, 0xae9d, 0x1cca, 0x2acb, 0xa9fd, 0xaed0, 0x263a, 0xaf72, 0xaaa6, 0x2d3a, 0x2537, 0xaab9, 0x2cf0, 0x26f4, 0x1fb8, 0xa87a, 0xa541, 0x2df0, 0xa71a, 0xaf26, 0xa959, 0xa94e, 0x2921, 0x2c5c, 0xa128, 0xab5c, 0x28e4, 0xac67, 0xac44, 0xaa1a, 0x28ab, 0x2b2a, 0x2a14, 0xa58c, 0x297a, 0xaa76, 0x94a2, 0xa4c7, 0x2b48, 0xab4d, 0xaa71, 0xa424, 0x2b8f, 0xa714, 0x2724, 0xa96f, 0xa96d, 0x2bd0, 0x2b69, 0x2f1f, 0xa689, 0x263d, 0x2b4d, 0xa090, 0x2432, 0x2d30, 0xaf3b, 0x2a84, 0x2db8, 0xae7c, 0x2c2d, 0xa87f, 0xae82, 0x29ea, 0x2e34, 0x1a7c, 0x2e73, 0xa7d6, 0xac20, 0xaa28, 0x2af6, 0xa7df, 0x1ea2, 0xa142, 0xac92, 0x2968, 0xa15f, 0x2b90, 0x986c, 0x22f1, 0x2de2, 0x20ae, 0xa8d4, 0xa911, 0x2b6c, 0x2574, 0x2c32, 0x2def, 0xac74, 0x2e48, 0x260a, 0x2118, 0x2f52, 0xa7e7, 0x25ae, 0x2fda, 0x2d01, 0xa8b5, 0x2a0c, 0xa9a5, 0x2cd3, 0xab45, 0x2e5d, 0x2c41, 0x9b23, 0xa896, 0x295a, 0x2828, 0x1d4c, 0xadb8, 0x2cfa, 0xa435, 0xad3e, 0x1b93, 0x2c2c, 0xa011, 0x2d2a, 0x2e1b, 0xaa06, 0xa0b6, 0x9fcc, 0x24b9, 0x26b0, 0x2eaf, 0xae6e, 0xa915, 0x2989, 0xab40, 0xa129, 0x2f5b, 0x2cc4, 0x2da1, 0xa59c, 0xaa75, 0xaba9, 0x2d4b, 0xa2d9, 0x2b53, 0x1d78, 0x2dac, 0x227f, 0x29ef, 0x24bb, 0x9399, 0x2bf4, 0xad7b, 0x2eb0, 0xae20, 0xa8a1, 0xa454, 0xad68, 0xaec8, 0xaa22, 0x8dbb, 0xac39, 0x2b0f, 0xa3f9, 0xad6f, 0xabc9, 0xa778, 0xade2, 0xa8c7, 0xade7, 0xb010, 0x2666, 0x2cdc, 0xa851, 0x2dab, 0x1ff4, 0x1b80, 0xaabd, 0xaa20, 0x2066, 0x29d6, 0xacb9, 0xaa9c, 0x2cd8, 0xaf22, 0x27a7, 0x2d30, 0x2c32, 0x2944, 0x2070, 0x2855, 0x2e39, 0xa850, 0xa6b9, 0x2df8, 0x1cef, 0xa8b4, 0x281a, 0x98da, 0x9e16, 0xa41c, 0xa1a0, 0xabf4, 0xa219, 0x9b38, 0xac37, 0xa36c, 0xa664, 0x9a8b, 0xaa5c, 0xa872, 0xa373, 0x25b7, 0x28c5, 0xa86a, 0x27d9, 0xa979, 0xae73, 0xa8ee, 0x2cab, 0x2104, 0xac5d, 0x2972, 0xa3c3, 0xac55, 0xa713, 0x2b1f, 0xadea, 0x2e0d, 0x2d87, 0xad07, 0xa929, 0xa57f, 0x12af, 0x2d11, 0x2d0e, 0xa488, 0x2bf2, 0x2e84, 0xadeb, 0x2d13, 0x2c33, 0x292d, 0x290e, 0x279d, 0xa126, 0xa6e8, 0x24ce, 0xa19c, 0xae11, 0x2b70, 0xae06, 0xa916, 0x298f, 0xacc2, 0x2a81, 0x9566, 0xa97a, 0xa8ed, 0xa4dd, 0x2a5f, 0xaac5, 0x2d24, 0xa566, 0xac56, 0x2c07, 0xab3f, 0x2af4, 0x2e44, 0xad5a, 0xad02, 0x1cba, 0x259a, 0x9da9, 0x28cd, 0x2b0b, 0x200b, 0x9cc7, 0x2794, 0x2d91, 0x2a20, 0xae50, 0xa50b, 0xa554, 0xabfe, 0xa036, 0xa370, 0x239c, 0xa3b4, 0x2c3a, 0xa519, 0x2796, 0xab1e, 0x2e81, 0xa970, 0xa195, 0x2dfd, 0x2482, 0xaaf3, 0x2e9b, 0xa824, 0x2869, 0x25b3, 0x2249, 0xa7b9, 0x2458, 0xacb7, 0xa54d, 0x2500, 0xa719, 0xa896, 0x2907, 0xaf1a, 0x2e98, 0x2a5c, 0xadd3, 0xabe9, 0xa9e7, 0xac45, 0x2c4d, 0x2cba, 0xaddf, 0x90d0, 0x2f70, 0x2ad4, 0xa4b7, 0x2ad5, 0xa809, 0x2960, 0x9c5b, 0x281a, 0x267f, 0x27c8, 0xaf46, 0xaca2, 0x2c76, 0x9084, 0xa441, 0x2f0b, 0xa4e3, 0xa175, 0x2d4b, 0x2b78, 0xa57f, 0xa870, 0x9ee7, 0xaeb0, 0x26b6, 0xaaba, 0xad20, 0x29aa, 0xa779, 0x2566, 0x2b59, 0xac95, 0x278c, 0xa75c, 0x2de9, 0x2c98, 0xae1b, 0x1f86, 0x2b46, 0x22d1, 0xace7, 0xa9ec, 0xa36c, 0xab7b, 0x2516, 0xa67e, 0x2b8e, 0xa8e9, 0xadee, 0xa98f, 0x2f33, 0xa807, 0xa143, 0x288e, 0xaf91, 0xae65, 0xa27c, 0xa6d2, 0xa1e1, 0x2cdf, 0xac29, 0xad99, 0xa22a, 0xae47, 0x99d4, 0x2e2e, 0xaec6, 0xadeb, 0x2af4, 0xae17, 0x1e74, 0x1ca4, 0x22dd, 0xa593, 0xa9c2, 0xab45, 0xac7c, 0x9c4b, 0xad6a, 0x9630, 0xada9, 0xaec1, 0x2871, 0x2510, 0x2bfa, 0xad64, 0xab1d, 0x2eb4, 0x9aed, 0xaa76, 0xaa3a, 0xac1b, 0xa639, 0xaa82, 0xaa43, 0xa7a9, 0x2d9c, 0x12bf, 0xad2e, 0x2d11, 0xa7b7, 0x2981, 0x2a34, 0x2100, 0xa06e, 0x26b1, 0xa535, 0xaa31, 0x291b, 0xac97, 0x1981, 0x2a8a, 0x278d, 0xa5b4, 0xa5dc, 0x2a7d, 0xa563, 0x2c97, 0xa6a1, 0xaaac, 0x05b3, 0xae4e, 0xa843, 0xa559, 0x2781, 0xa8c2, 0x298f, 0xaf9a, 0xa537, 0xa8f7, 0x2a17, 0x2e2e, 0x277b, 0x144d, 0x2ef8, 0x2e99, 0x2cb4, 0xa77d, 0x2ced, 0xa598, 0x0a88, 0x26ab, 0x23d3, 0xab99, 0x24b5, 0x2a0a, 0xac86, 0xa186, 0x26e3, 0xa972, 0xa8d3, 0xad31, 0xa164, 0x215b, 0x2bf6, 0xa5a2, 0x2cf9, 0x2240, 0xad56, 0xaf04, 0x3033, 0xb000, 0x9a61, 0x2cf5, 0xa738, 0x2c2c, 0x1b79, 0x2b76, 0x296a, 0xaf48, 0x2cab, 0x2130, 0xabe4, 0x2992, 0xad60, 0xad36, 0x2808, 0x1d3a, 0xafe1, 0x2954, 0x26fb, 0xa1ed, 0x2ccc, 0xa351, 0xaa0f, 0x2db5, 0x248c, 0xaff6, 0x3040, 0xab87, 0xa415, 0x9527, 0xa69f, 0xadce, 0x2d6a, 0xaff5, 0x2392, 0x2f3f, 0xac7d, 0x2522, 0xa324, 0x2c25, 0x27fb, 0x11a1, 0x293d, 0xa852, 0xadac, 0xad4e, 0x2e53, 0x9e23, 0xac27, 0xac8b, 0xad54, 0x2d4a, 0xaba6, 0xafad, 0xacb6, 0x25f8, 0xaaa0, 0x2c6d, 0x2c45, 0xa40f, 0x2d54, 0x939d, 0xac81, 0x253e, 0x9d40, 0xaf24, 0xaae0, 0xac85, 0xac8f, 0x227e, 0x9ec0, 0x21b3, 0x2ba0, 0xac71, 0xab25, 0xab92, 0x2c43, 0x1983, 0x2ed8, 0xa415, 0xa9d2, 0xa97d, 0xad92, 0x25af, 0x29cf, 0xa1bb, 0xaa5c, 0xa21f, 0xad21, 0xa604, 0x2440, 0xac7a, 0x288d, 0x2ed7, 0x2940, 0xaa24, 0xaa6f, 0x2e14, 0x2c6c, 0x2e06, 0x2ad2, 0xa928, 0xa9b2, 0xa575, 0x29aa, 0x2b10, 0x28d2, 0x26a8, 0x2e42, 0x248d, 0x2341, 0xa82e, 0x278f, 0xa912, 0x2811, 0xa6ec, 0x2b27, 0x2d68, 0xa598, 0xa462, 0x294c, 0xad6d, 0xa763, 0xacc9, 0x2c6e, 0x168f, 0xa925, 0x24db, 0xaaa6, 0xad03, 0xa43a, 0x2d2d, 0x1b70, 0xa888, 0x1dbd, 0xaf08, 0xaea5, 0x2957, 0xa117, 0xb001, 0xa0ce, 0xaa46, 0x295c, 0xa93f, 0x257d, 0xad1f, 0x2cdd, 0x28a9, 0xa244, 0x2d41, 0xafc1, 0xae90, 0x2baf, 0x9e25, 0xad4e, 0xaac1, 0x2278, 0x1fa1, 0x2c75, 0xa811, 0xa7b3, 0x9d40, 0xadbb, 0x2b4e, 0x2fda, 0xad11, 0xac64, 0xadaf, 0xaeb3, 0xabc6, 0x29a8, 0xac87, 0xa502, 0x2b88, 0xa59d, 0xa765, 0x2811, 0x2b31, 0xaf30, 0x2702, 0xac3f, 0xa181, 0x2c45, 0x23bd, 0xae35, 0x2216, 0x2899, 0x9c2f, 0x29a3, 0x2cfb, 0x1561, 0xae4d, 0x2d77, 0x1dcd, 0x2f32, 0x27ab, 0x21bd, 0x2d7d, 0x2351, 0xaecf, 0xa901, 0x2ccc, 0x2a22, 0x291d, 0x29fc, 0xa0de, 0x1fd7, 0x2650, 0xac29, 0x2e8a, 0xab6c, 0x26c2, 0xa983, 0xa42f, 0xa0ca, 0x25ab, 0xa0af, 0xae43, 0x2856, 0x2ed6, 0x2a19, 0xaba4, 0x247a, 0x2c82, 0x2cf2, 0x2f2d, 0xa6d6, 0x29df, 0x280f, 0x2814, 0xada2, 0x9dd7, 0x1854, 0xabd9, 0xa04e, 0x2c0a, 0x24b9, 0xaf4c, 0x29b5, 0xae17, 0xae52, 0xaf48, 0xa68e, 0xa6e4, 0x2cd3, 0xabcf, 0x2e3c, 0x1326, 0x29a4, 0x2edb, 0x2e2c, 0xaef5, 0x2e1c, 0x1c08, 0x2333, 0x2d31, 0xa406, 0x286b, 0x2d67, 0x2850, 0xa6c8, 0x2980, 0x2e47, 0xadf2, 0x265a, 0xa1b8, 0xae97, 0x2ada, 0xa90c, 0xace9, 0xa550, 0x2c03, 0xac5d, 0x2d50, 0xab5f, 0xabd6, 0x2c6e, 0x977d, 0xaf01, 0x29bc, 0x2d00, 0xab60, 0x2a12, 0xab82, 0x2b4b, 0x2957, 0x2db9, 0xae23, 0xa860, 0xac41, 0x9b89, 0x2a26, 0x2d17, 0x231f, 0xa88d, 0xab84, 0xabb7, 0x2924, 0x29fb, 0xa2fb, 0x2615, 0x24d2, 0xa7f3, 0x2949, 0xadf4, 0x1a7c, 0xaa9a, 0x2af0, 0xad9e, 0x2d80, 0xa2f1, 0x24d8, 0x9d15, 0x2df7, 0xac07, 0xa9ce, 0x2f79, 0x252c, 0xa669, 0x2feb, 0x246f, 0xa32f, 0x255d, 0x25bb, 0xad7a, 0x2ca9, 0xa711, 0x1565, 0x18ce, 0xa0e0, 0x28de, 0x25d2, 0xae5c, 0xad72, 0x28c2, 0x28fd, 0x2b7d, 0x2c2c, 0x2782, 0xa9ec, 0x2a6d, 0x2876, 0xab1e, 0x2858, 0x2305, 0xacf3, 0x28c4, 0x292b, 0xae5f, 0x2ff7, 0x2184, 0x2a23, 0x1e63, 0x24da, 0xa689, 0x2d23, 0xa89e, 0xa822, 0x29bd, 0xa9f8, 0xa9e4, 0x200b, 0x2161, 0x1556, 0xa6f9, 0x2926, 0xad37, 0x2e52, 0x24f8, 0xaa02, 0x24a0, 0x23e1, 0x2c1d, 0x2cd6, 0xa579, 0xa5e1, 0x251f, 0x2df1, 0xa289, 0xa4c9, 0x2c50, 0x24bd, 0xa9b2, 0x2947, 0x1e74, 0x2f77, 0x2c15, 0xaec7, 0x2e33, 0xa2a7, 0xa9a3, 0x2f36, 0x2755, 0x2968, 0xa0b8, 0xaab3, 0xa834, 0x2a35, 0x262d, 0x1f9c, 0xaaa4, 0xad6a, 0xad80, 0xa874, 0xacd1, 0x2175, 0x2221, 0xa9d2, 0xac1c, 0x2b16, 0x28ec, 0xaddf, 0x27ec, 0x2869, 0x2d31, 0xacf7, 0x2a2e, 0x2d0c, 0x2401, 0x1ed4, 0x2690, 0x2c93, 0x1edf, 0xa8da, 0x2603, 0x29e7, 0xa618, 0x2b25, 0xa5ae, 0xaf31, 0x2b0e, 0x2751, 0xad77, 0xa5d8, 0x2d38, 0x9c0f, 0xa844, 0x2de6, 0x1d49, 0xaff1, 0x2de2, 0xadcb, 0xaf78, 0xa237, 0xa7d0, 0x9a4b, 0x2bf9, 0x9ca7, 0xae5c, 0xad2e, 0x2159, 0xac7d, 0x28d0, 0x282a, 0xa5e6, 0xa5da, 0xa601, 0x1c4a, 0xa3ea, 0x2c40, 0x2176, 0x2391, 0x21b2, 0xae2c, 0xab9e, 0xa6c7, 0x9449, 0xae82, 0x21e3, 0xab15, 0x20e6, 0xa639, 0xaabd, 0x2b42, 0x2de5, 0xad40, 0xacbe, 0x2ca6, 0xaf20, 0xace2, 0x2d12, 0x9c44, 0x25cd, 0x2e57, 0x2a0e, 0xaa63, 0x2f55, 0x300d, 0x1c31, 0x2ff3, 0x2c82, 0x288b, 0x2cda, 0x2c1d, 0x2990, 0x2e3b, 0x2d57, 0xa3e2, 0xabfc, 0xa5d2, 0xa828, 0xa2f2, 0x2a11, 0x2448, 0xa6c7, 0x2b73, 0xaf85, 0x2b4f, 0x26c9, 0x2efa, 0xac26, 0xad49, 0x2d5e, 0x295a, 0xa27c, 0x2bb3, 0xa856, 0xace3, 0x2a5e, 0xaa7d, 0x2593, 0xa9f4, 0xa164, 0xacc3, 0x2e0b, 0xac02, 0xad85, 0xa96b, 0xad11, 0xa485, 0x2d06, 0xa4e2, 0xad8f, 0xa48f, 0xae57, 0x2b1c, 0x2a60, 0x258c, 0xa6fd, 0x25ec, 0xafc6, 0xad89, 0x246e, 0xad3b, 0xa8bf, 0x2874, 0x2107, 0x2cba, 0xaf9e, 0x2910, 0x8640, 0xaab0, 0x2874, 0x2c61, 0xaf93, 0xa903, 0x296f, 0x2936, 0x2273, 0xaac3, 0xa6b7, 0x2e0e, 0xa904, 0x2a07, 0x24f6, 0xa8ac, 0x27f8, 0xa66f, 0x30a3, 0x26f0, 0x240b, 0x256c, 0x23e7, 0xa914, 0x227e, 0x224b, 0x2f00, 0xa02a, 0xa590, 0x1dbb, 0xabf5, 0x2bf0, 0x293b, 0x2594, 0x2ca5, 0xa895, 0xaac6, 0x2d42, 0x2b91, 0x2a7a, 0x2c3a, 0x2f8c, 0x2614, 0x2d2b, 0x2e60, 0xaccd, 0xab54, 0x2a69, 0x15e6, 0x2955, 0x28a4, 0xa3d1, 0x226e, 0x2248, 0x222d, 0x2f14, 0x29ab, 0x9e57, 0x9e75, 0x2a71, 0x2a40, 0xadd8, 0xadb9, 0xaf2f, 0x25b9, 0xacde, 0x2ada, 0x2737, 0x14e2, 0xac5b, 0x2965, 0xaa62, 0xaa27, 0x26f7, 0xa7be, 0x20a5, 0xac2b, 0x2c22, 0xaaea, 0x29c7, 0xa6ef, 0xa9e2, 0xa968, 0x2bcc, 0xac6d, 0xadac, 0x2d62, 0x2c1b, 0xa800, 0x9b35, 0x2bd2, 0xaddd, 0xa660, 0x22de, 0xae69, 0x2b05, 0x2c2f, 0xa2b7, 0x9f7b, 0x2c04, 0x288b, 0x2e92, 0x2ba5, 0xa5d4, 0x2f3a, 0xaaa5, 0xa813, 0xa80e, 0xa8cb, 0xa280, 0x9a19, 0x1cd6, 0xa978, 0xa8a5, 0x1a5e, 0x2986, 0x24fb, 0x2d2d, 0x1d13, 0xab41, 0x240a, 0x1e5e, 0x2398, 0xa837, 0xaa32, 0x2df3, 0xa8f3, 0xa4f0, 0xa05e, 0x22b1, 0x2926, 0x29f2, 0xa6a9, 0xad0b, 0xac81, 0x2d1d, 0x238c, 0xaa05, 0x2308, 0xa26d, 0xa829, 0x2db8, 0xa512, 0x0dcd, 0xa893, 0xace3, 0xae24, 0x1e83, 0xafb3, 0x2cda, 0x2d49, 0xaece, 0xae13, 0x2c47, 0xac22, 0xa69d, 0x2e4d, 0xa950, 0xa86c, 0x2b59, 0xae0e, 0xaa00, 0x2c63, 0xada4, 0x2a94, 0x2f79, 0xae42, 0xab0e, 0x2182, 0xac25, 0xa57c, 0x2bd5, 0x2db2, 0x2aff, 0x236e, 0x9053, 0x2c90, 0x27f0, 0xa824, 0xa18a, 0x29ef, 0xaca3, 0xac90, 0x2c53, 0x28b9, 0x296e, 0xa99e, 0x2eef, 0x2e42, 0xab24, 0x12a8, 0xaa57, 0x1e58, 0x16f8, 0x2d61, 0x26ba, 0x255d, 0xac52, 0x266a, 0x2c6b, 0x9db7, 0xac62, 0x23a2, 0xa825, 0x1edd, 0x28c5, 0x2550, 0x2ee4, 0x01cb, 0x9e18, 0x2170, 0xa976, 0x2d0c, 0xaabf, 0x2db3, 0xac3a, 0xae36, 0x2e19, 0xa13c, 0xaeec, 0x3023, 0xaaf6, 0xad53, 0xa188, 0xa484, 0xae9c, 0xa84c, 0x2e36, 0x2741, 0xa952, 0xa7e9, 0xaa94, 0x2f1b, 0xa980, 0x25c5, 0xa0b2, 0x2cd0, 0xa2ff, 0xa8f7, 0x2e51, 0xa9b0, 0x2eae, 0x2d0c, 0x1cae, 0x2e14, 0x2bb9, 0x2cf9, 0x2905, 0x25c2, 0xae2b, 0x2a96, 0xa6da, 0xafc4, 0x2d91, 0xa8bc, 0xaafb, 0x2c7b, 0x2cad, 0x2764, 0xa9e0, 0x9dca, 0xafdf, 0x2f7a, 0xa93d, 0xabc6, 0x2935, 0xaa41, 0x2d0f, 0x2bb1, 0xa8f0, 0x297a, 0x22bb, 0x284d, 0xae95, 0xa41b, 0x2a94, 0xac10, 0x2cfc, 0x277d, 0xa9b7, 0x9ea1, 0x29df, 0xae6e, 0x299e, 0xad30, 0xaf1b, 0xa9f9, 0xac85, 0xad1d, 0x15d3, 0x1a2a, 0x2121, 0xa20d, 0xac14, 0x24b7, 0x2bb4, 0x2b74, 0x2495, 0x2813, 0xaeb5, 0x2a01, 0x2bd8, 0xa869, 0x2c8a, 0x290e, 0x2c7b, 0xa193, 0xa6d8, 0x223c, 0xabfe, 0xab2d, 0xa58f, 0xab3d, 0x1889, 0x2ec1, 0x192e, 0xafa6, 0xa24c, 0xac10, 0x29d9, 0x2763, 0xa8e3, 0x2514, 0x302a, 0xab09, 0xa805, 0x9d94, 0x2b36, 0x22d9, 0xaa61, 0xa42f, 0x2765, 0xab5f, 0x2c37, 0xad30, 0xa8c5, 0xaa13, 0x2d8b, 0xaa54, 0xaa22, 0x2c99, 0xa078, 0xac9f, 0x1c98, 0x25f3, 0xab24, 0x2e45, 0x09d4, 0x249b, 0x2dcc, 0x2aac, 0x22ec, 0x2d4c, 0x27d6, 0xa82e, 0x276a, 0xada8, 0xa1fe, 0x2c54, 0xa42f, 0xaa96, 0x2da1, 0xa9e3, 0xacde, 0x2b4a, 0x299b, 0x2012, 0xa8bf, 0xad1c, 0x27a6, 0x2ffb, 0xac96, 0x2b39, 0xaaff, 0x28cb, 0xa5d3, 0xadb7, 0x25e9, 0x2656, 0xafea, 0x2d4a, 0x2b0f, 0x25f3, 0xa66a, 0xa8c6, 0xb009, 0xaca9, 0x2e2c, 0xae6d, 0xa76d, 0xa99b, 0xad9b, 0x1fa5, 0x238d, 0xa5c6, 0x286d, 0xa86d, 0xa709, 0xa998, 0x2c80, 0xac95, 0x250a, 0x21ef, 0xa2a0, 0xa6c1, 0x17bb, 0xa989, 0xade2, 0xa6bb, 0x199e, 0x263f, 0x2c6c, 0xaaee, 0x2c0d, 0xad51, 0xa8bc, 0xae25, 0xa247, 0xaf32, 0xae42, 0x9c94, 0x2abe, 0x2c07, 0xaced, 0x1c9d, 0x2abc, 0xa8d4, 0xa9ab, 0x2c74, 0x1eb1, 0xac39, 0xa041, 0xa7cd, 0x2c19, 0xac99, 0x25c6, 0xa060, 0xa8eb, 0x28b7, 0xad1a, 0xaa9d, 0xaf39, 0x9608, 0xacc8, 0x229e, 0xadee, 0x977b, 0xadb6, 0x28dd, 0x2373, 0xa607, 0x2592, 0x29c6, 0xa9a3, 0xac2d, 0x1073, 0x9ddd, 0x9982, 0x9a30, 0xa940, 0xaca8, 0x251f, 0x20f2, 0xaec8, 0xa8b5, 0x2ebc, 0xaf2b, 0x2d3e, 0x27b8, 0x2ab6, 0x2eeb, 0xa0a0, 0xafd2, 0xa705, 0x2c7a, 0xa96e, 0x2ec3, 0x2d68, 0x2342, 0xaa9c, 0x2da3, 0xab29, 0x9d9f, 0xa9f1, 0xa68b, 0xa45e, 0x2c45, 0x2183, 0x2d31, 0xa43c, 0xae1b, 0x2573, 0x2a5d, 0x2529, 0x2bd1, 0xa4d0, 0x2b17, 0x20dd, 0x9b27, 0x2b5d, 0x3006, 0xab38, 0x9e0e, 0x2a41, 0xaa86, 0x27f1, 0x2da1, 0x167d, 0xa46b, 0x2e18, 0xac78, 0x154a, 0xacf9, 0xaac9, 0xae23, 0x9a17, 0xa42b, 0xad35, 0x225c, 0x2eb6, 0xae8a, 0x2ab8, 0xa39f, 0xa148, 0x2856, 0xa016, 0xa4e5, 0xa57c, 0x2506, 0xa693, 0x20c0, 0x2f4f, 0xacee, 0xacd2, 0x2793, 0x28b6, 0xab15, 0x2e54, 0xae13, 0x2adf, 0x2ed5, 0xadb9, 0xae75, 0x1b2e, 0xad3c, 0xade9, 0xa806, 0xae77, 0xadfe, 0xa022, 0x280d, 0xa4db, 0x23b3, 0x27a1, 0xa987, 0x2fa2, 0xadcd, 0xa08f, 0x2b29, 0xaddd, 0xa5f0, 0x2cc3, 0x29f6, 0x2670, 0x1de5, 0x29cd, 0x9f53, 0x2a40, 0x2e1f, 0x2b84, 0xaf0b, 0xa39d, 0x22d5, 0xac59, 0x2e84, 0x2e6d, 0xa1b4, 0x25ea, 0x2212, 0x2ab4, 0xaa01, 0x2e20, 0xae37, 0x22b8, 0x2e99, 0x2324, 0xa81a, 0x29a4, 0xaae3, 0x1db5, 0x2f65, 0xac55, 0x264e, 0x25f5, 0x21c4, 0x2c1e, 0xa34e, 0x28bf, 0xa8cd, 0x27ac, 0x2eb7, 0x26e5, 0x2c0f, 0xa897, 0x2c14, 0x2366, 0x2949, 0x2c59, 0x1e65, 0x1f99, 0xa8d6, 0x2e0a, 0x2ac1, 0x21b8, 0x2605, 0x274d, 0x1fd5, 0x2cf1, 0x2e7d, 0xad4d, 0x2ccf, 0x2ad5, 0x226c, 0x27fe, 0xa0a5, 0xad66, 0x234f, 0xab84, 0x2ba5, 0xa848, 0xafa7, 0x2f5d, 0x1d71, 0xaea0, 0x2ae6, 0xa58d, 0x24ee, 0x2012, 0xaca0, 0xa5b9, 0xa8f0, 0xa554, 0xaacc, 0xa7e8, 0xa27b, 0xac6f, 0xae5a, 0xad1d, 0x1483, 0xacf3, 0x245b, 0xac16, 0x271c, 0xaa8d, 0x2948, 0xaca4, 0xae12, 0x2828, 0x2ab4, 0x2889, 0x27c5, 0x2b6a, 0xadfe, 0x2ed1, 0xac8d, 0x2795, 0x2ca0, 0xacc6, 0xac7f, 0x2c71, 0xaa4f, 0x26da, 0xa9b7, 0x9b96, 0x2011, 0x2d60, 0xaf72, 0x2b24, 0x2c28, 0x27a9, 0xa8ed, 0xa67c, 0xac97, 0xa199, 0x2ad3, 0xaeed, 0x2d6a, 0x29f9, 0x1cf8, 0x2b25, 0xa9dc, 0xa8cc, 0xa9c5, 0x299b, 0xac0b, 0xaf86, 0x2a40, 0x2030, 0xadab, 0xae9d, 0x262c, 0xa910, 0x2bfe, 0xa6ff, 0x2bbd, 0x2cd1, 0xa5e3, 0xab52, 0xa8d3, 0xad8f, 0xa7c4, 0xaa41, 0xaec7, 0x2a1a, 0x2e49, 0xa777, 0x17d7, 0x2841, 0xa46a, 0x2f26, 0x25ad, 0xae70, 0x2ef0, 0xa82b, 0xa6ae, 0x2cfd, 0x2cf8, 0x99e6, 0x1749, 0x1e83, 0xaa07, 0x2e66, 0x2d21, 0xac5e, 0xa7c1, 0xacc6, 0xaebd, 0x2ea8, 0x978c, 0xa043, 0xa3ad, 0xa909, 0xaebf, 0x2abc, 0xa7b8, 0xad1b, 0xac5e, 0x2c1e, 0xac31, 0x2b62, 0x200b, 0x2940, 0x0188, 0x28cb, 0xa91d, 0x2d25, 0x29d3, 0xaa61, 0x28ba, 0xaae4, 0xa467, 0x8ea0, 0xa7e1, 0xad2d, 0xa8c0, 0x2e82, 0x25f4, 0x2c5d, 0x2f54, 0xa911, 0xaaed, 0xa1af, 0xac8c, 0x26b1, 0x290c, 0xa86b, 0xa9e1, 0x2aa4, 0x9ee6, 0x2563, 0x2cff, 0xad6f, 0x2311, 0xa263, 0x1852, 0x28c3, 0xa7e9, 0xa7d9, 0xa737, 0x2550, 0xaa0f, 0xa801, 0x2e45, 0xaba8, 0x1a2e, 0xa635, 0xab16, 0xad73, 0xa98e, 0xa6c6, 0x9f27, 0xa452, 0x27cd, 0x28dc, 0x22a4, 0xa222, 0x22a1, 0x2850, 0xaa9e, 0xae6e, 0x2b8f, 0x2b81, 0x2bb6, 0xaa2f, 0x2584, 0xac45, 0xa5dd, 0xa86e, 0xadf0, 0xa941, 0x9d63, 0xa41f, 0x2f93, 0x2a9c, 0xa144, 0x29d7, 0xa494, 0xaccd, 0xaa7f, 0x1e6d, 0xabf8, 0x2eb1, 0x2afd, 0xaa79, 0x2675, 0x2eac, 0x2998, 0x2510, 0x1f24, 0x2909, 0x2ecd, 0xaa78, 0xa44c, 0x2de7, 0x2ead, 0x2aeb, 0x28c5, 0xa64c, 0x248f, 0x2c2d, 0xa09c, 0xa7a8, 0x2ade, 0x27d2, 0xac96, 0x2d9f, 0x2de9, 0x2043, 0xa66f, 0xaca2, 0xaa53, 0x2ff6, 0x29e0, 0xa985, 0xa546, 0xab19, 0xad65, 0x2db0, 0x2e04, 0xa9ec, 0xab07, 0xa60b, 0x2b66, 0x2be8, 0x258e, 0x2bd9, 0x2221, 0x2909, 0x9c29, 0xa1ee, 0x2600, 0x2568, 0x2d86, 0x2b90, 0xaf3c, 0xa87a, 0x2d3f, 0xab83, 0x2f25, 0x25e4, 0x292e, 0x941a, 0x282f, 0x2c64, 0xae77, 0x2811, 0x2ac1, 0xac3d, 0x304f, 0xa9bb, 0xace9, 0x1a68, 0x2ceb, 0xa9e8, 0x2d3b, 0x2dc3, 0xaa2e, 0xa8ec, 0x2b28, 0xaccc, 0xa7c1, 0x282e, 0x9cf6, 0xad1f, 0xa711, 0xa930, 0x1dbf, 0xac82, 0xa919, 0x26a2, 0xacda, 0xa1cd, 0xad78, 0x2d72, 0xa8cb, 0x9c28, 0x1780, 0x2575, 0x22fd, 0xa778, 0xa8c7, 0x2aa3, 0x191e, 0xac82, 0xaf58, 0xa055, 0xafae, 0x264e, 0x2c7f, 0x2c30, 0x1e21, 0xa3f6, 0x24ca, 0x2e74, 0x2115, 0x2c25, 0x25e6, 0xa726, 0x2cc8, 0xa7d5, 0x2a90, 0x2e46, 0x2d1b, 0xae1f, 0xa982, 0x2dbc, 0x2878, 0x194d, 0x2f02, 0xa93e, 0x2412, 0x2122, 0x2b63, 0xaf2f, 0xa4f3, 0xacc6, 0x2a98, 0x2ba5, 0xadae, 0xac1a, 0xa969, 0x2933, 0x1d8c, 0x0fd5, 0x96ca, 0x2939, 0xa592, 0x282c, 0xa53c, 0x29c5, 0x2a11, 0xa0f0, 0x28db, 0xa164, 0xa884, 0xa356, 0x22f6, 0x2ebc, 0xabf1, 0xaaaf, 0x293d, 0xab3f, 0x2873, 0xacbe, 0x2526, 0xa7cd, 0x1738, 0xad0c, 0x28ff, 0xad87, 0xaf09, 0xab11, 0xa907, 0x2557, 0x273d, 0x2d34, 0x2fcf, 0x12e2, 0xa156, 0x2b14, 0x238e, 0x2916, 0x3055, 0xab41, 0xa031, 0x2f1e, 0xa323, 0x2fdf, 0xa96f, 0x2d26, 0xa78e, 0x2c35, 0x2a20, 0x9f94, 0x1832, 0xacfe, 0xb059, 0x0542, 0x2b70, 0xa4d0, 0xabf3, 0x2bab, 0x2be5, 0x2814, 0x2e18, 0xac84, 0xa814, 0xa92b, 0x2e6f, 0xa864, 0xa7e5, 0x2a4c, 0x2c26, 0x1cdc, 0xa8f4, 0x2cbd, 0xacbe, 0x2d40, 0x2a33, 0x2d7b, 0xaafb, 0xad56, 0xa926, 0xa78d, 0x2e13, 0x2712, 0xa956, 0xa9a2, 0xa7df, 0xa229, 0x9dc3, 0xab4e, 0xb019, 0xa54c, 0x8279, 0xacb7, 0x2d4b, 0x2995, 0xa94b, 0xb03d, 0xa5cd, 0x2de7, 0xadfd, 0x2ead, 0x2906, 0xaa14, 0xac63, 0xaabb, 0x9eb3, 0x294d, 0xac8c, 0x2c06, 0x1f68, 0x2310, 0x9080, 0xaab8, 0x2f3d, 0xace0, 0xad48, 0x3026, 0xa502, 0xa8c6, 0xa210, 0xa5d3, 0x2b6d, 0xad0a, 0x2f34, 0xaa01, 0x2bde, 0x9cdc, 0x2913, 0xaf6b, 0xa961, 0x252d, 0xaf3a, 0x280d, 0xad95, 0x2a1d, 0xa426, 0xaa49, 0xaed6, 0xa841, 0xad40, 0xaa62, 0x2a86, 0x2a25, 0xa61c, 0x2a33, 0x1ebe, 0xab8b, 0x287d, 0xa9e4, 0x2183, 0x265b, 0x292f, 0x28cc, 0x3045, 0x2d4b, 0x24ad, 0xac89, 0xac02, 0x2d5f, 0xaf2e, 0xae95, 0x209f, 0xa67b, 0xab80, 0xacca, 0xaf4c, 0x28bd, 0xab62, 0xa89b, 0x2d1c, 0x2471, 0xa8fd, 0xac5a, 0x28c3, 0xac1a, 0xa36e, 0x18eb, 0xaf56, 0xa6c0, 0x2a90, 0xabbc, 0xa95b, 0xa9ba, 0xaa50, 0x2ce2, 0xae1c, 0xa979, 0x2c9d, 0xa218, 0x2da4, 0xa7e1, 0xab35, 0x2c97, 0xabe0, 0xadda, 0x2719, 0x2a63, 0xa7e2, 0x260a, 0x29d2, 0x24c0, 0x2edf, 0xa932, 0x25c1, 0x2d73, 0x2c89, 0xaf67, 0x2d49, 0xaa01, 0xa72f, 0x2ba7, 0x2ed3, 0x2d6d, 0x21d3, 0x256a, 0x2fac, 0x2136, 0x2c34, 0xa74e, 0xaac5, 0xadd3, 0xaba7, 0x3000, 0xac6d, 0xae52, 0x2800, 0xa566, 0x267d, 0x2da8, 0x2eb5, 0x2a4f, 0xa8e7, 0x2a8b, 0xafbb, 0xa370, 0xa36f, 0x2a93, 0xaa61, 0x2aa0, 0xa9db, 0xaaf6, 0xaa49, 0xa9fb, 0xaaf2, 0xa880, 0x28a7, 0x2c36, 0xa804, 0xad3d, 0xab61, 0x2b31, 0xaa05, 0xa664, 0x22ee, 0xad14, 0x2bff, 0xaaef, 0x2e7d, 0x29cd, 0x9e78, 0xa45f, 0xa8ac, 0x2c6a, 0xac58, 0x2ddb, 0x2804, 0x2da7, 0xa8db, 0x2c61, 0x2cb0, 0xab3a, 0x29ba, 0xa026, 0xa958, 0x1fef, 0x28a0, 0xaca8, 0x2f84, 0xa713, 0x239f, 0xacb9, 0xa74e, 0xa45e, 0x2968, 0xa9f6, 0xa68f, 0x259f, 0xaa2e, 0x2b30, 0xa110, 0xab95, 0x2c99, 0xaed1, 0x21ea, 0x2f43, 0xa66f, 0xaa7e, 0x2d60, 0x2803, 0x9880, 0xa4d4, 0x29a7, 0xafe6, 0x2bef, 0xae81, 0xaf4b, 0x2fdd, 0x208c, 0x2862, 0x2b18, 0xa9e2, 0x2bc4, 0x27bd, 0x27f8, 0xaf56, 0x2d77, 0xacee, 0x25e8, 0xa842, 0xab93, 0xaca0, 0xacf4, 0xab4d, 0xac67, 0xa65d, 0xa699, 0xa5d2, 0x292b, 0xa7d1, 0x2195, 0x2e88, 0xaf23, 0xa60e, 0xaf62, 0xac59, 0xa1e5, 0xacde, 0xad60, 0x2f16, 0xae9c, 0xae31, 0x21f6, 0x2c7a, 0x28f8, 0x2ac9, 0x2a51, 0x2a62, 0x2bc9, 0x28ba, 0xaa47, 0xa632, 0x2cd5, 0xa832, 0xaaa9, 0x2c03, 0x2800, 0x2da6, 0x2d3f, 0xaf34, 0xa270, 0x2ee2, 0x259c, 0xab46, 0x2e1d, 0x26e8, 0x9f72, 0xab17, 0x2c4f, 0x295c, 0x2da4, 0xa36d, 0xa1b4, 0x2449, 0x2047, 0xa67f, 0xac6b, 0x2d25, 0x2284, 0x2407, 0x2add, 0x260e, 0x2ec8, 0x2d83, 0x2c1e, 0xace0, 0x2953, 0xa78c, 0xa271, 0x2d51, 0xac5a, 0xac4f, 0x281f, 0x2a35, 0xaa80, 0xa695, 0x2d55, 0xa63d, 0x2a12, 0x2af7, 0x2a18, 0xa591, 0x2dd4, 0x280d, 0x286b, 0x2d76, 0xa573, 0x195e, 0x9d43, 0x26db, 0x2459, 0xae11, 0xaaa3, 0xad42, 0xab74, 0x2dab, 0xaec0, 0x2982, 0x279f, 0xb006, 0xaa6d, 0xa75d, 0xac93, 0x2588, 0xa00d, 0xaca6, 0x26c3, 0x28a3, 0x22c1, 0xac55, 0xa071, 0x2906, 0x2055, 0x2e8e, 0xadc5, 0x2786, 0xabea, 0x254a, 0xadf5, 0x2c53, 0xa8ca, 0xa5e6, 0xa8a8, 0xa5e0, 0x2b40, 0x295c, 0xa979, 0xad58, 0x0619, 0xae2d, 0xa2d5, 0x272d, 0x2bab, 0x1feb, 0xa8e9, 0x2258, 0xaef2, 0x28b8, 0xad18, 0x21be, 0xad1e, 0xae84, 0x28cb, 0xab4e, 0x2594, 0x2642, 0x2950, 0x2c3d, 0x2a2a, 0x2dae, 0xa6a4, 0xa67a, 0xa7cc, 0x27ae, 0xa47f, 0xad16, 0xae46, 0xabcd, 0xad5c, 0xab84, 0xa851, 0xa8de, 0xaa8e, 0xab09, 0xaeb6, 0x2bc5, 0x27a0, 0xa8ff, 0x1830, 0x2516, 0xaec4, 0x2448, 0xa3cf, 0xae74, 0x9efb, 0xae19, 0x2adb, 0x26eb, 0x274e, 0xa855, 0x2e80, 0xab01, 0xac4e, 0x29e5, 0x1a44, 0xa984, 0x20ca, 0xab47, 0xab4c, 0x27b9, 0xa9e2, 0xafad, 0x2536, 0x2e4e, 0x1d42, 0x2ef0, 0x2b8f, 0xa441, 0x27b4, 0x2980, 0xad98, 0x2d7a, 0x2973, 0x8d4c, 0xa474, 0x2c53, 0xaaff, 0x2b8b, 0x2e5b, 0xa84e, 0xa9bb, 0x2d15, 0xae19, 0x2c48, 0x2cb3, 0xad13, 0xa0b1, 0x2a3c, 0xad1a, 0x227a, 0xa1c7, 0xa466, 0x28ad, 0x1916, 0x2339, 0xa84b, 0xad77, 0xacc5, 0xae91, 0x2a14, 0x1c62, 0xa0d4, 0x2c49, 0xad1b, 0xa121, 0x24ec, 0xa007, 0xad81, 0x22df, 0xa327, 0x9d44, 0xa468, 0x2107, 0xac5d, 0x254c, 0x2352, 0xa3c0, 0x2a70, 0xa6f3, 0xad5b, 0xa6af, 0xae23, 0xa8b4, 0xa587, 0xac27, 0x1701, 0xaaef, 0xa46d, 0x2998, 0xa97f, 0x2956, 0x2440, 0xa8f1, 0xa8ab, 0xa94a, 0x2dc2, 0xa878, 0xa736, 0x2c97, 0x9afc, 0xa668, 0xa85d, 0x29dd, 0xaeb5, 0x0a41, 0xaf42, 0xa63c, 0xa786, 0x2a20, 0x2a72, 0xadf1, 0x2414, 0xacac, 0xad70, 0x0b60, 0xa86c, 0x259e, 0xaf1d, 0xaf2c, 0x2799, 0x9f5f, 0x2dd2, 0xac69, 0x2a78, 0x2d8a, 0x2a2f, 0x2a65, 0xa8e5, 0x26cf, 0x285d, 0x2d7f, 0x1c1d, 0xad0e, 0x2e81, 0xad47, 0xa845, 0x2dc8, 0x2d39, 0xaeb4, 0x2f1d, 0x298a, 0x29e2, 0x2df8, 0x2c70, 0xaa80, 0x2cea, 0xaad6, 0xa74b, 0x2fd0, 0x2620, 0xaede, 0x280b, 0x1d29, 0xacf3, 0x2ebc, 0xabbc, 0xa5d1, 0xa834, 0x2cb6, 0xabb6, 0xa0fc, 0x273d, 0x27fa, 0xa92e, 0x9924, 0x293c, 0x2a5e, 0x2aec, 0xaef2, 0xad83, 0x2556, 0x9e5d, 0x25ad, 0xa8c6, 0xa4ee, 0x2c0b, 0xae33, 0x21b9, 0x296e, 0xaf09, 0x282a, 0x2d6f, 0x25d7, 0x228d, 0xa882, 0x2cca, 0xad53, 0x1b7c, 0x2746, 0xaac0, 0xacd9, 0x285b, 0x2076, 0xad50, 0x2e8c, 0xa7fb, 0xaa8d, 0x2dc8, 0x1fba, 0xad8f, 0xa804, 0xaf05, 0x2a9b, 0xa221, 0xae10, 0xaa73, 0x2ac8, 0x2b3c, 0xa3b9, 0x2b30, 0x286b, 0x29db, 0xa742, 0xad23, 0x2923, 0xa8b2, 0xaf4e, 0xae6b, 0x2f55, 0xac69, 0xaca0, 0x2bbe, 0xac6e, 0x1ecb, 0xa4bb, 0x2aea, 0xabd4, 0x2565, 0xae0b, 0xae45, 0xa882, 0xaf33, 0xabc8, 0xac1d, 0x8cb1, 0xa881, 0xa439, 0x2e36, 0xa5fd, 0x2d18, 0x29b3, 0x28df, 0x2e49, 0x260c, 0xadad, 0xa662, 0x2e81, 0xa911, 0x2dd4, 0x22e3, 0xabc4, 0x29d1, 0xa026, 0xa75e, 0x2daa, 0xa12c, 0xacc2, 0x2683, 0x2b3a, 0xa80b, 0x2b80, 0xa925, 0xac4c, 0x2f70, 0x2cbc, 0xa4ea, 0x1763, 0xa9db, 0xa3aa, 0xa575, 0x2807, 0x2875, 0x24aa, 0x2b70, 0xacdb, 0x2c96, 0x1d5f, 0x21c1, 0x2d13, 0x29a9, 0xaa06, 0x2c24, 0xa9a6, 0xa126, 0x2ce6, 0x2405, 0xaab0, 0x2b28, 0x2abb, 0x9a5d, 0x27c7, 0x2aeb, 0xadaa, 0x1a43, 0x2f21, 0xa76c, 0x2960, 0x268b, 0xa751, 0xa902, 0xa729, 0xacd5, 0xaab8, 0xa8ff, 0xa575, 0x2d65, 0x262e, 0x23b5, 0xa3be, 0x29de, 0x2c8a, 0x2c03, 0x2a7f, 0x2c15, 0xab91, 0xaf64, 0xaa6f, 0x21f1, 0xa90c, 0x1840, 0xa38c, 0xae6f, 0xa607, 0xa6ff, 0xab9e, 0x9f88, 0x2a6b, 0xade6, 0xaaf5, 0x2a29, 0xae00, 0xa606, 0x9e06, 0xa4c9, 0xa8ba, 0xa864, 0xaf16, 0xae50, 0xac25, 0x1dcf, 0xa669, 0xa9f5, 0xa815, 0xad6c, 0x9d60, 0xac26, 0xaa27, 0x2739, 0x29b5, 0x1a7e, 0x2118, 0x991e, 0x2856, 0xaa0e, 0xadad, 0xae78, 0xa990, 0xad64, 0xaccb, 0xa827, 0xad7c, 0xac6e, 0x9e96, 0x2f06, 0x2080, 0xaccd, 0x29de, 0xa926, 0xa92e, 0x2cea, 0x2d22, 0xac0f, 0xab76, 0x2d15, 0xac4f, 0x26bf, 0x9f3a, 0x2967, 0x2d53, 0xa905, 0x2787, 0xaa6d, 0xa756, 0x2868, 0xa7e1, 0x01a1, 0xacc6, 0x287a, 0x2f18, 0xa1b4, 0x2d43, 0x2cda, 0xa5f0, 0xa980, 0x2716, 0xa463, 0x2b11, 0x2f70, 0xa658, 0xaaaa, 0x2d2b, 0x1d2f, 0xac80, 0xaa43, 0x2b36, 0x2d72, 0x27de, 0xa9d6, 0x2bf3, 0xaae2, 0x2e34, 0xae71, 0xa309, 0xa811, 0x2abf, 0x2879, 0x2e0d, 0x224e, 0x2b76, 0x2f4b, 0x285c, 0x28fa, 0xaae1, 0x2904, 0xa9ae, 0x27d0, 0x2f48, 0x2da9, 0x2aa0, 0xaa83, 0x289c, 0x2702, 0x9457, 0xae93, 0x2ca2, 0x287b, 0xac41, 0xa948, 0xa44a, 0xa631, 0xaea8, 0xa5f6, 0xad68, 0xa832, 0x2aaf, 0x2bf0, 0x2709, 0x2869, 0xaced, 0xac74, 0x2b45, 0xa67a, 0xae6a, 0x27b4, 0x20f2, 0xaeea, 0xa9e7, 0x29d9, 0xa44e, 0x2a2c, 0x9140, 0x9e4e, 0xaa6a, 0xae90, 0xa800, 0x1d85, 0xad4c, 0x2c25, 0xa1c7, 0xa94c, 0x275e, 0xa8ab, 0xa995, 0xa762, 0xac72, 0xab24, 0x9eb2, 0xad17, 0xae7d, 0xa3fb, 0xab3a, 0xa908, 0x2cda, 0xace8, 0x2ad7, 0x2817, 0xa9d1, 0x2995, 0x2b29, 0x2c5b, 0x2d9b, 0x2963, 0xab02, 0x2992, 0xa879, 0x2e2e, 0x1ca7, 0x2487, 0xa263, 0x1df7, 0x1e22, 0xa16f, 0x2b76, 0xa5f9, 0x1803, 0x2be4, 0xadca, 0x2de4, 0x2b8e, 0xa602, 0x28a8, 0xab8d, 0x26b6, 0xaa9f, 0x9da5, 0x276d, 0xb003, 0xac1e, 0xa668, 0xae35, 0xac2f, 0xa867, 0x26aa, 0xab38, 0xac06, 0x25fc, 0xabc9, 0xa9c2, 0x9711, 0x266f, 0xacdc, 0xb017, 0x2c2b, 0xa5dc, 0xad4c, 0xaba7, 0xad36, 0x2544, 0xa97d, 0x1ee9, 0x1ad0, 0x1e2d, 0xa940, 0xac69, 0x2b05, 0x182f, 0x2247, 0xab50, 0x1d2a, 0xa54a, 0x2c6e, 0x2eb4, 0x2fcf, 0x2ab6, 0x2688, 0xa123, 0x2c37, 0x2bda, 0x3064, 0x2dda, 0x2f65, 0xa37b, 0x9caf, 0x2e75, 0x2949, 0x1317, 0x2d0a, 0x1dd1, 0x2aaa, 0xa74b, 0x2ee5, 0x2d43, 0xad31, 0x2cc0, 0x258d, 0x2eca, 0x2e4c, 0x98cb, 0x2857, 0x2d1d, 0x2bb4, 0xaac1, 0x2765, 0xa3e6, 0x9eed, 0xa855, 0xa06a, 0x2f86, 0x2c05, 0x2f58, 0xaa47, 0x2bfe, 0x28f5, 0x2b3e, 0x26d3, 0x2e40, 0xa252, 0xac23, 0x275b, 0xaa54, 0x297e, 0x2e17, 0x2341, 0x2457, 0x2e8a, 0x2b98, 0xa4bc, 0xac6d, 0xaef3, 0x2930, 0xa9fd, 0x2987, 0xac16, 0x2b28, 0x2f1e, 0xa1b0, 0xa434, 0x300b, 0xa47c, 0xa9c1, 0x28e4, 0xad3f, 0xa71d, 0xa02f, 0xa939, 0xacfd, 0xa9d5, 0xab06, 0xa9a7, 0x2a97, 0x2ccf, 0x216c, 0x9dd4, 0x2764, 0x222a, 0x2f92, 0xadee, 0x27f0, 0xacbb, 0x2f74, 0x2026, 0x2c81, 0x29a8, 0xa917, 0xab55, 0x2ec6, 0xadf8, 0xa927, 0xa7e9, 0xaa8e, 0xa895, 0x2b85, 0xac54, 0x2662, 0x9d57, 0xac88, 0x27a7, 0x2e4e, 0xa69b, 0xada9, 0x3034, 0x264c, 0xae95, 0x2e2f, 0x23e7, 0xaa17, 0x2eb7, 0x2862, 0x2a15, 0x2cfd, 0x2974, 0x2ad6, 0x28bc, 0xa987, 0xaa5a, 0xa2f3, 0xacb0, 0x2d1d, 0xae22, 0xad96, 0xaa78, 0xafdc, 0x1fb4, 0xad87, 0xaf8b, 0xa6ba, 0xa97d, 0xae11, 0x8e51, 0xa069, 0x245f, 0xa729, 0x200e, 0x912c, 0xaa0e, 0x98dc, 0xa634, 0x2c82, 0x2cd0, 0x2860, 0x2d50, 0xb02b, 0xa7db, 0x2d8f, 0x2398, 0x1e74, 0x22f3, 0xa437, 0x2ea2, 0x2fae, 0xae27, 0xa82a, 0x2b6f, 0xa939, 0x2aa1, 0x2aef, 0xa5ef, 0x2c00, 0xa162, 0x2a61, 0x2c22, 0x2fff, 0xa1c8, 0xa55d, 0x2ecb, 0xac89, 0xabc4, 0x2e7c, 0xa469, 0x2b55, 0x2007, 0x2c5f, 0x251e, 0x2e85, 0xa7fe, 0x2f06, 0x2935, 0xad9e, 0xaa2e, 0x2539, 0xabff, 0xa929, 0x2df3, 0x2914, 0x208c, 0x2209, 0x296f, 0x2ad4, 0x2cec, 0x1d03, 0x2c06, 0x2138, 0xb018, 0x2d76, 0x2e85, 0xa849, 0x2de9, 0x2b58, 0xb067, 0x2cd1, 0x9e7c, 0xb061, 0x2cf4, 0x292c, 0xad6f, 0x2b12, 0x2be9, 0xa010, 0xab38, 0x2c8f, 0xa7f4, 0xaabb, 0x2951, 0xad79, 0xad0f, 0x24ef, 0x975c, 0x2229, 0x2e9c, 0xac05, 0xaf62, 0x28e5, 0xa04d, 0xaab3, 0x2661, 0x2ab3, 0xacf5, 0x9632, 0x2bc5, 0x285e, 0x1f17, 0x23ad, 0xaca8, 0xa912, 0xa1e1, 0xa1d7, 0x99cd, 0x27ed, 0xacdf, 0xaa34, 0x29ca, 0xa9d0, 0x283d, 0xa31e, 0xa3c3, 0xafe5, 0xae01, 0x2a2a, 0xa097, 0x28ef, 0x2ec2, 0xac02, 0xa8f1, 0xa82d, 0xaa5c, 0x1a65, 0xaafc, 0xae5e, 0x27bc, 0xa885, 0xade7, 0xb07d, 0xa91a, 0xa9ed, 0xa634, 0x2b70, 0x296c, 0x2a2f, 0x2a5a, 0x2719, 0xac12, 0x1da4, 0x2b07, 0x1c94, 0xa9b3, 0x2a4a, 0xad56, 0xa9ef, 0xa856, 0x8dba, 0xac1b, 0xaa25, 0xab09, 0xa975, 0x2cdb, 0xaf6f, 0x1a9e, 0x2d45, 0xaa55, 0x2358, 0xa9be, 0xa8af, 0x275a, 0xa809, 0x9ad8, 0x2700, 0x217c, 0xa202, 0x2d09, 0xacc6, 0xad64, 0x24ce, 0x2ce2, 0x2daa, 0x2d49, 0x26a1, 0x1c23, 0x9f91, 0x28b6, 0x2d0e, 0xa80d, 0xaa01, 0x292a, 0xae47, 0xa414, 0x25ad, 0xabdd, 0x9f2e, 0xad08, 0x2f88, 0x2bb9, 0xa2d1, 0x2b6e, 0x250f, 0x2b92, 0x27a4, 0xb030, 0x2d4a, 0xaaf4, 0xa162, 0x21ee, 0xa5a2, 0xa9b5, 0xaace, 0x2cbb, 0xa663, 0x25a6, 0x2f03, 0xa547, 0x290a, 0x2724, 0xad3d, 0xaf1a, 0x2f40, 0x291c, 0xaca4, 0x29f0, 0xa0ee, 0xaf3b, 0x2d4d, 0xa8d4, 0xaf74, 0x2e0d, 0xadfd, 0xa455, 0x2834, 0x24f1, 0xac56, 0x2846, 0x2010, 0x2aeb, 0x2340, 0xb00e, 0x2ee9, 0x2744, 0x2c71, 0x2ba0, 0xa977, 0xae7c, 0x2ea7, 0xafd6, 0xaea6, 0xa1a8, 0x25ff, 0xad3b, 0x2d87, 0xae2a, 0x2116, 0xa4e3, 0xace6, 0x218b, 0x224d, 0x2ada, 0xa980, 0xacd9, 0xaa78, 0x2e9a, 0x2d91, 0x24a4, 0x2303, 0x30a4, 0xa395, 0x2cdb, 0xa7f9, 0x2aed, 0x299c, 0xa938, 0x286d, 0xa855, 0x2636, 0xa6dd, 0xa702, 0xa455, 0xa4ec, 0x2bf1, 0xa7d9, 0x98ec, 0xa4da, 0xafad, 0xa615, 0xaa57, 0xadd0, 0x2d8c, 0xa09c, 0xaec9, 0x2803, 0x2dd7, 0xad11, 0x9bb8, 0x2c0e, 0x9ded, 0x2c09, 0x2f3c, 0x9bc6, 0x2cc9, 0xa23e, 0xa954, 0x2f9a, 0xa58b, 0xa96b, 0xacd5, 0x2eab, 0x2e5c, 0x286f, 0xa340, 0xa689, 0x2938, 0x2d4d, 0x9f64, 0x273f, 0x2faa, 0x1e21, 0x2b60, 0xad26, 0x2598, 0xab89, 0xa8a8, 0xa85c, 0x2c50, 0x28f4, 0xa21f, 0x284d, 0x28c5, 0xad65, 0xaa4d, 0x287d, 0xabdd, 0x29d0, 0xaf42, 0xaae5, 0x2d93, 0xa642, 0xa90c, 0x23fc, 0x2869, 0xabbd, 0xacd5, 0xacc5, 0xad43, 0x2efe, 0xa9ba, 0xaa4d, 0xaad4, 0x9bd0, 0xaa17, 0x2ac5, 0xa6cb, 0x29c1, 0x2045, 0x98da, 0xa699, 0x9f8b, 0xa85f, 0xac73, 0x2f13, 0xad3a, 0xacff, 0x22e1, 0xa447, 0xaff2, 0xac03, 0xac59, 0x2c21, 0x2511, 0xa3d5, 0x2a8e, 0x2ce0, 0xae85, 0x2cb6, 0xa871, 0xa0cb, 0x2db0, 0xa82f, 0x28bd, 0x1c34, 0x2e96, 0x2d91, 0xa014, 0x2ecf, 0x2cb2, 0x2c5e, 0xa607, 0x1cdc, 0xacf5, 0x9c68, 0xa9af, 0xaf4a, 0x2161, 0x2766, 0x27de, 0x2a05, 0x29d3, 0xa48a, 0x2770, 0xa9f2, 0xac0a, 0x2c0a, 0x2e0b, 0x285f, 0x2586, 0xa1b9, 0x18b6, 0x2ece, 0xa832, 0xa42b, 0x2286, 0x2808, 0xaae7, 0x2d0b, 0x2abd, 0x26b0, 0xaa76, 0x2b84, 0xad7a, 0x2d71, 0x2c98, 0xada9, 0x21c4, 0x2c11, 0xa646, 0x2c73, 0xa552, 0x9d18, 0x2c40, 0xab2a, 0x9e38, 0x1b3d, 0xa92f, 0x2480, 0xa1f6, 0x2faf, 0x26ba, 0xa9f8, 0x2ff6, 0x2a07, 0xaf81, 0x1d95, 0xa66b, 0x2306, 0x272e, 0xac23, 0x2ce5, 0x25bd, 0xa7dc, 0xb00b, 0xad0d, 0x2d50, 0xaf2e, 0x270e, 0x2e83, 0xab2f, 0xacff, 0x9fd4, 0x1469, 0xa860, 0xa5ff, 0x269e, 0x26eb, 0xa6f8, 0x2904, 0xaeb3, 0xae4f, 0x2632, 0x2999, 0xad7c, 0x2f41, 0x2b90, 0xaae4, 0x282f, 0xaeae, 0x2291, 0x2f35, 0xac10, 0x9c22, 0x2beb, 0x273b, 0xacbc, 0x2873, 0x1d57, 0x28af, 0xae43, 0xaef0, 0xab51, 0x26bf, 0xa873, 0x2e41, 0x2a22, 0xaa66, 0x2506, 0xad9a, 0xaa0d, 0x2da4, 0xad88, 0xac3e, 0x273b, 0xaa8e, 0xa8a5, 0xa8b8, 0xadd6, 0x9e9f, 0xaeb4, 0xacd8, 0x9c7f, 0xad5c, 0x28e1, 0x29b1, 0x2cc9, 0xac32, 0x9fb6, 0x271a, 0x9a12, 0x941b, 0x25c6, 0xb02c, 0x2cf4, 0xb010, 0x2efc, 0x2907, 0xab97, 0x2890, 0x2b82, 0x2af7, 0x2f2e, 0x2c28, 0xa418, 0xa8a5, 0xaad2, 0x2031, 0x2547, 0x2cf1, 0xaf17, 0x2b60, 0xa06d, 0x0d76, 0x231f, 0xa082, 0x2989, 0x2e3d, 0xa2b4, 0xafba, 0x297f, 0xac21, 0xac48, 0x24fe, 0x2a7a, 0xa9cd, 0x242b, 0x2cce, 0x93f7, 0x2ecc, 0x9d81, 0xad29, 0x2cf7, 0x2adc, 0x2605, 0xac9a, 0x25d9, 0x26ac, 0xac4c, 0xae12, 0x2275, 0xad2d, 0x28d1, 0xac69, 0xac64, 0x29af, 0xa868, 0xad64, 0x2c37, 0xa5e4, 0xaea2, 0x2cbf, 0x2849, 0xa193, 0x2f9d, 0xab82, 0xaf8f, 0xa422, 0x2dff, 0xa1f3, 0x2938, 0x9320, 0x214f, 0xabdc, 0xa109, 0x2538, 0x1015, 0xa915, 0xae92, 0x2bc7, 0x1eb9, 0x997e, 0x2d1d, 0x223c, 0xa5a7, 0x2be9, 0x2602, 0xa9e4, 0x2738, 0xa9a4, 0xad3c, 0x2e62, 0x271b, 0x2be1, 0x9809, 0xad3d, 0x23a4, 0x1ea0, 0xa9ee, 0xa07f, 0x2b1a, 0xadd6, 0xa658, 0x2c3e, 0xad08, 0x26a8, 0x2ce2, 0x2d44, 0xab91, 0x29ac, 0x2cee, 0xac29, 0x9e00, 0x2b3c, 0xa5ff, 0xa09d, 0xacd6, 0x2677, 0x2aa0, 0x2db5, 0x26f9, 0x2dd4, 0x2a2f, 0xab41, 0x2428, 0x2ebb, 0x1e11, 0xaa54, 0x286e, 0xa20d, 0xadb0, 0x2576, 0xa03f, 0x2dee, 0x2d3b, 0xac8d, 0xaadf, 0x261d, 0x2816, 0x26cf, 0x2a9a, 0xafdc, 0x9f5f, 0x2ecd, 0xae46, 0xa8c1, 0x2909, 0x2b37, 0x2671, 0x2ad7, 0xa2d6, 0xa647, 0x245a, 0xaf0c, 0xac07, 0x2f19, 0x28e2, 0xa849, 0x2acd, 0x2b6d, 0x2c1c, 0x2508, 0xae77, 0xad3f, 0x2e10, 0xae7b, 0xac01, 0xacc4, 0x2c7e, 0xa83f, 0x2fb8, 0xa867, 0x2e80, 0x2a26, 0xa9c0, 0x9511, 0xa979, 0xae4c, 0x2e2e, 0x289e, 0x2c08, 0x2aee, 0x2622, 0x2c8c, 0x2607, 0x2d0e, 0xa952, 0xaf5d, 0xacaf, 0x20f2, 0xab16, 0x2c37, 0x99b7, 0x24e1, 0xab0b, 0x2fd9, 0xaec7, 0xaea9, 0xa882, 0xae08, 0xaaeb, 0x2899, 0xa9b7, 0xa26c, 0xac04, 0xa9a7, 0xae17, 0x21b1, 0xaced, 0x2926, 0x26a5, 0xaef0, 0x152e, 0x2dfc, 0xafe6, 0xa9bb, 0xa06c, 0x242a, 0xb048, 0x141f, 0xa48e, 0x2407, 0x28c8, 0xb02b, 0x25cc, 0xaac3, 0xafe5, 0x21e4, 0x2e38, 0x24fd, 0xa75b, 0xa9e6, 0x28d6, 0x3010, 0x2cf8, 0xa338, 0x1cd4, 0xa425, 0x29ca, 0x3028, 0x1a04, 0x2da4, 0xa8c4, 0x23aa, 0x2e41, 0xaa1a, 0x20ca, 0x2532, 0xa8b4, 0x2ee0, 0x1eb3, 0x25c8, 0x2778, 0xa577, 0x2de8, 0x2ebd, 0xa947, 0x2bad, 0xa530, 0x2ec0, 0x24fe, 0x2e0e, 0xa8c0, 0x1f26, 0x2e70, 0x3016, 0xa360, 0x2e4b, 0xa05c, 0x25aa, 0x2d32, 0x2b58, 0x2a88, 0x2b2e, 0x27fe, 0xab80, 0x2dbd, 0x3008, 0xabc4, 0x2b1d, 0xa943, 0xa037, 0x2cd6, 0x2e49, 0xa4b5, 0x2af6, 0x2df4, 0xa4b2, 0x2996, 0x2dfa, 0xac4b, 0xaa60, 0xa9c1, 0xa8fd, 0xab71, 0x243e, 0x29de, 0xac53, 0x2455, 0x2b19, 0xae75, 0x281b, 0x297d, 0x297a, 0x2508, 0xaa1d, 0xafb6, 0x2d5d, 0x25d3, 0xa826, 0xabd7, 0x2a0a, 0xaa65, 0x2520, 0x2e63, 0xac46, 0xada8, 0x96bf, 0xac08, 0x225e, 0x2c5e, 0xa1bf, 0xaa9b, 0xa693, 0x2c54, 0x2c43, 0x20da, 0xa8e3, 0x245a, 0x2459, 0x2beb, 0xad76, 0x1e28, 0x2a30, 0x2978, 0x2c94, 0x2823, 0xabd7, 0x2c3f, 0x2897, 0x2903, 0xae26, 0x2d37, 0xa4d2, 0xaf36, 0x2d49, 0x26b9, 0x2713, 0xae44, 0xa811, 0x922e, 0x28f4, 0xada5, 0x26b0, 0x2148, 0x2885, 0x2466, 0xacd7, 0xae90, 0xa941, 0xa8f9, 0xa60e, 0x2cea, 0xa362, 0xa81a, 0xadb9, 0x26da, 0xa970, 0x2bfd, 0x205d, 0xabce, 0x279c, 0x2757, 0xae45, 0x2df9, 0x2a78, 0x2877, 0x2f2d, 0x2065, 0xa88b, 0x306b, 0xa8b0, 0x2723, 0xaddb, 0x2dc9, 0x2657, 0x2300, 0x1e6d, 0xa893, 0xac6c, 0xa2a0, 0x2981, 0x2dcb, 0x2bd6, 0xac65, 0xb019, 0x1c01, 0x2bb5, 0xa8d8, 0xa1ab, 0x2c58, 0xa283, 0x231e, 0x29e3, 0xad7b, 0x2c30, 0x2ccd, 0x2740, 0x27f6, 0x2e62, 0x25e6, 0x9d1f, 0xa932, 0xa8c0, 0x2c18, 0xa0a1, 0x2dd4, 0xa765, 0x9d14, 0xa9f9, 0x1fa7, 0xad70, 0x2bc3, 0x28a4, 0xab1b, 0x241d, 0xadea, 0xafe5, 0xa9aa, 0xac18, 0xa56a, 0xad85, 0xacd3, 0x2854, 0xa464, 0x285c, 0x2d35, 0xa71c, 0xad82, 0x2e01, 0xa46a, 0xab9f, 0x2c2e, 0xa9f3, 0xaf3a, 0x9ab7, 0xa967, 0xacbb, 0xa9fd, 0x2964, 0xae11, 0x2f2c, 0xa761, 0x250e, 0x2d25, 0x2572, 0xaa63, 0x2c04, 0xa5a1, 0xad72, 0x2b41, 0x2a9b, 0x2bc9, 0xa85a, 0x2c31, 0x2a67, 0x20a3, 0xaa47, 0xaef1, 0x25ce, 0x2e22, 0xad00, 0x8c43, 0x2972, 0xaa02, 0x288e, 0x2cf3, 0x29b7, 0x2d05, 0x2a68, 0xad62, 0xad85, 0x8acc, 0x2c8e, 0xa637, 0x2bf4, 0xa632, 0x243b, 0x24ff, 0x2744, 0x2d18, 0x9fc8, 0xafd0, 0x2932, 0xacd1, 0xab2a, 0x1672, 0xaa05, 0xa2f4, 0xade0, 0x2998, 0xae20, 0x2165, 0x20e4, 0xac91, 0xabb5, 0x2a3f, 0xaf5c, 0x28ef, 0x2f18, 0xaf22, 0xae99, 0x2b42, 0x25ca, 0xa39a, 0x2e82, 0xa1fb, 0x28e3, 0x2f32, 0x9cc9, 0xa45f, 0x2dcb, 0xacaa, 0x289e, 0x1ffd, 0xac2d, 0xaaf8, 0x258b, 0xa595, 0x2b9c, 0x292e, 0x1123, 0xad12, 0x2e36, 0xaabd, 0xa6d1, 0x2ec0, 0x2889, 0x8969, 0x9d74, 0xace6, 0x28b8, 0x2822, 0x285e, 0xa748, 0xa844, 0xa975, 0xa2b8, 0xaca4, 0xa3d7, 0x2b3f, 0x29e7, 0xa3ff, 0xaab3, 0x20f8, 0xaecc, 0xa8fb, 0xa31b, 0xb01d, 0x2b13, 0xaeea, 0xac01, 0xab0f, 0xad26, 0x93ff, 0xaf0f, 0xa0d9, 0x972e, 0x2420, 0x2ea2, 0xb042, 0xab4c, 0xaf4c, 0xa975, 0xaa42, 0xaeec, 0x9d11, 0x25af, 0xa5ed, 0xa6c5, 0x27be, 0xa89e, 0xaa6c, 0xac30, 0xac56, 0xa88f, 0xa6b4, 0xac98, 0xa467, 0xa8b0, 0xad11, 0xa167, 0xa5e7, 0xa92c, 0xa853, 0xae90, 0x2854, 0xa6f7, 0x19c3, 0xac08, 0x27de, 0x2c0f, 0x2c88, 0xa6b6, 0xae38, 0x25fc, 0xac91, 0x296a, 0xa210, 0xa964, 0xaa2f, 0x29dd, 0x1f72, 0x26d6, 0x29d7, 0xb045, 0x2742, 0x27bd, 0x9eab, 0x2c36, 0xaca5, 0xa955, 0xab31, 0xad15, 0xa9f7, 0x1d83, 0xad14, 0x29d8, 0x2bc1, 0x2eb3, 0x2b04, 0x27cf, 0x2f03, 0x27d2, 0x2452, 0xaf10, 0xab62, 0x2e93, 0xadbd, 0xa7e0, 0x2e9c, 0xaaf6, 0xaa91, 0x2d34, 0x2859, 0x2d4d, 0x25a4, 0x2aa4, 0xac9d, 0x2f4f, 0x2271, 0x2a16, 0x24e7, 0xa738, 0x2da7, 0x2d2e, 0x2b99, 0x29ff, 0x2812, 0x25ed, 0xa5e4, 0x2df8, 0xadf7, 0xa82f, 0x2e97, 0x2cb7, 0xa693, 0xa9d7, 0x2671, 0x283b, 0xa927, 0x2d9b, 0xad8b, 0x22ae, 0xa974, 0xaa0c, 0xa23d, 0x2b2c, 0xaab0, 0xa2c1, 0xa7eb, 0x208f, 0x28bb, 0x259e, 0xaf3f, 0x2c96, 0x2522, 0x24f3, 0x24d3, 0x2ab7, 0xaab2, 0xac08, 0xaa09, 0xa2c7, 0x2a71, 0x2e47, 0x27e2, 0x2e06, 0x2e42, 0x2284, 0x2be7, 0x2f5a, 0x28c5, 0x2c8d, 0x2f1b, 0xa9d4, 0x2870, 0x2e86, 0xad24, 0xaa81, 0x2f11, 0x18c7, 0x29a3, 0xa8a6, 0x23ff, 0xaa81, 0xa4d3, 0xa8d1, 0x2d1a, 0x266e, 0x2821, 0x2e30, 0x2ce9, 0x2bdf, 0xac38, 0x2e8e, 0x2ceb, 0xaa92, 0xa419, 0x21bb, 0xa7aa, 0x2754, 0xae57, 0x2b52, 0x1fcc, 0x9e4c, 0xaa4d, 0x2f65, 0xa9a9, 0x25c8, 0x9583, 0x1d70, 0xa97d, 0xa1b8, 0xa78d, 0x2ad4, 0xa869, 0x29e1, 0x283b, 0x2979, 0xafe6, 0xa910, 0xaaa4, 0xacc1, 0xadc8, 0x2c43, 0x2622, 0xaacb, 0x28ae, 0xa855, 0xa838, 0x2f27, 0xb01c, 0xa716, 0x2f09, 0xaa99, 0x24d2, 0xa1b2, 0xa811, 0x2785, 0x22d1, 0xade0, 0xa06e, 0x2f21, 0x29e7, 0xabed, 0x2925, 0xae95, 0xaaac, 0x28d0, 0x266b, 0xacbf, 0x2f7a, 0x2394, 0xa9b4, 0xa4d1, 0xac4d, 0x2a01, 0x2ac5, 0x2a36, 0x278f, 0x2bdf, 0xa894, 0xac10, 0x2fc1, 0xac88, 0x2d6a, 0x231a, 0x234d, 0x1b43, 0x2643, 0xa1b4, 0xa426, 0x2828, 0x2322, 0x250e, 0x2de2, 0xa9ff, 0xad9b, 0x2490, 0xa91a, 0x15d4, 0x2dab, 0xadd5, 0xab80, 0x28e8, 0x2af8, 0x2b0e, 0x2e53, 0xa1c2, 0x22e9, 0x2eb5, 0xab66, 0x9c1a, 0x2b3b, 0x9f0a, 0xae21, 0x9d51, 0x2bf1, 0xae94, 0xa6ca, 0x29cc, 0x278b, 0x2ada, 0x2cf0, 0xa811, 0xa176, 0x2954, 0xaa4d, 0x2c55, 0xa79c, 0x2c1b, 0x2a00, 0x2921, 0x9c75, 0xaa09, 0xa4be, 0x2d53, 0x2e94, 0x2d8a, 0x2804, 0x20da, 0x2a02, 0x9b95, 0x1f81, 0xab85, 0x2736, 0x2cae, 0x23d1, 0xad99, 0x29bb, 0x0ea6, 0xa7db, 0x2cc7, 0xae4b, 0xad9d, 0x2f18, 0x2844, 0xa6bc, 0x2d16, 0xa0ca, 0xacaa, 0x2ed2, 0x24d8, 0xad71, 0x27bf, 0x24f4, 0xa6d0, 0xab04, 0xaa0a, 0xa909, 0xa4d8, 0x2cbe, 0xafdc, 0x1a91, 0x2b15, 0xac21, 0xa4a1, 0xaa45, 0xab0d, 0x2a66, 0x1e05, 0x2ba4, 0x2c7b, 0x98a5, 0xa9e5, 0x2c86, 0xadfb, 0x2484, 0xa90f, 0x2755, 0xad10, 0xad54, 0x2588, 0x9c5d, 0x2122, 0x8c92, 0x29eb, 0x2750, 0xa481, 0xaa54, 0x2ad5, 0x2c22, 0x2c50, 0xab23, 0x23fc, 0xaa77, 0x2859, 0xa412, 0xaabb, 0xad52, 0x9909, 0x2c54, 0x9e89, 0xaa27, 0x2ab9, 0xaed0, 0x29b5, 0x205d, 0x2899, 0x2b08, 0x26bc, 0x2b8c, 0x2d91, 0x2a82, 0xabdb, 0x1fc7, 0x2e8b, 0xaadf, 0x2e3f, 0x2af2, 0xad82, 0xa786, 0x2d70, 0x136a, 0x2e6a, 0xaa32, 0xadba, 0x27ea, 0x2e44, 0xa86d, 0xaa5d, 0xa312, 0xa4a0, 0x2285, 0x2c5e, 0xadc4, 0x26ff, 0x969a, 0x2047, 0x2b40, 0x2dfa, 0x2890, 0x8d78, 0x2efb, 0x2ec0, 0xa611, 0x9f62, 0x282d, 0x2d31, 0x2e48, 0xa49f, 0x2ec6, 0x2eeb, 0x2e94, 0xa737, 0xa65e, 0x9cd6, 0x2aec, 0x2f08, 0x2c3e, 0xad3b, 0x2e44, 0xa1fb, 0x2bb2, 0xa508, 0xad46, 0x2a12, 0x9ab0, 0xafa8, 0x2195, 0x294b, 0xacbe, 0x2364, 0xafda, 0x2ab2, 0x2bec, 0xad5a, 0xa8f6, 0x2563, 0x2c1c, 0xac81, 0xa4ef, 0xae6d, 0xad13, 0x147e, 0xabc3, 0xabb9, 0x2679, 0xa417, 0xa44d, 0xa7e2, 0xab1d, 0xada5, 0x1f3e, 0xac52, 0xaa9b, 0x2d3c, 0xaf60, 0xaec1, 0x2f9b, 0x9d5d, 0x25c2, 0x2f0a, 0x1c4e, 0xac7e, 0xaafa, 0xaf39, 0xa74b, 0x2c48, 0xae55, 0x21f5, 0x2d0d, 0xaed8, 0x23a9, 0x2ff9, 0xacc6, 0x2a17, 0xa300, 0xaa70, 0x269b, 0x28cf, 0x2ad4, 0x2e52, 0x1f6d, 0xa2bd, 0xa4ea, 0x28ee, 0xaa9b, 0x24aa, 0xa843, 0x2aaa, 0xa5a4, 0xaa34, 0xa861, 0x2c96, 0x2045, 0xa600, 0x2ad1, 0x2d0c, 0x2d5d, 0x2d61, 0x2f14, 0xaf78, 0xa3bc, 0x2cad, 0x262a, 0x2602, 0x2d6e, 0x2583, 0xad48, 0x9992, 0xaaa5, 0xa887, 0xa530, 0xae9b, 0x9466, 0x2e63, 0xaa05, 0xa2d5, 0xa557, 0x1e28, 0x2dd4, 0x2992, 0xaed6, 0x99df, 0xacf7, 0x97ee, 0x28d8, 0x2290, 0xaa5e, 0x2caa, 0x2dcc, 0xa84a, 0x2e07, 0xa702, 0xab0a, 0x8969, 0x2446, 0x292f, 0xa812, 0x28d8, 0xad0f, 0x1eb2, 0x2bdf, 0x2a79, 0xaf21, 0xab04, 0xa5a2, 0xadab, 0xad16, 0xac47, 0x2b81, 0xad1a, 0xab28, 0x2da1, 0x2d16, 0xa925, 0xa632, 0x2f8f, 0xacf0, 0xa404, 0x2b46, 0x13c6, 0xa50b, 0x2c18, 0x2d8f, 0x24b2, 0x2ca9, 0xaa09, 0xa119, 0x3014, 0xa868, 0x28e7, 0xa716, 0x2a34, 0xae75, 0x2b15, 0xa6e3, 0x3027, 0x2cd5, 0x2d2c, 0x2e58, 0xa45b, 0x3008, 0xa803, 0x260e, 0x2b97, 0x2422, 0xaaa2, 0x2e36, 0xaa79, 0x2c85, 0x2e47, 0xa440, 0x2d8d, 0x2faf, 0xa71e, 0xaa49, 0x2a49, 0x2dab, 0x2da6, 0x2803, 0x2921, 0x2e88, 0x9980, 0xa6ec, 0x2503, 0x9930, 0xa9d1, 0xa638, 0x2ca9, 0xa9e7, 0x2980, 0xa2de, 0xa94f, 0x2d4b, 0x2a15, 0xa4cd, 0xa934, 0xa59d, 0x25af, 0x22c8, 0x25ad, 0x2b23, 0x28fd, 0x2fc1, 0x29a9, 0x1ca0, 0xa68c, 0x2807, 0x29e1, 0x291a, 0x2040, 0xa835, 0x28da, 0xa462, 0x9a12, 0x9ed6, 0xacce, 0xa424, 0xa85b, 0xaea8, 0x2c56, 0x2d77, 0x286d, 0xace3, 0xacb6, 0xaf56, 0xac67, 0x9ca7, 0xa65f, 0x2d08, 0x9888, 0x2c29, 0xa9f6, 0x1d29, 0x298c, 0x1c5e, 0xadb5, 0xaf63, 0xa84d, 0xaa2d, 0x2c3e, 0x226a, 0x2819, 0x2c55, 0x22e0, 0xab97, 0xa930, 0xa9f0, 0xac37, 0x22ca, 0x2c9f, 0xad01, 0xaf34, 0x1f29, 0xadb3, 0xad71, 0x2ceb, 0x2b3d, 0xab41, 0x99a4, 0x2db2, 0xa8d8, 0x2ccb, 0xa1d9, 0x2b17, 0x2f51, 0xa03e, 0x992e, 0xa55d, 0x2aec, 0x2fdc, 0xad51, 0x2171, 0x2a1b, 0xa82c, 0xabc3, 0x21b9, 0x9dda, 0x235a, 0x290a, 0x2c9a, 0x9e36, 0xa435, 0x2ca4, 0xac2b, 0x284d, 0x2843, 0x2825, 0x296e, 0x21d3, 0x2d90, 0x2d7c, 0x2b6b, 0x2999, 0x2213, 0x18fc, 0xac95, 0x2f72, 0x2f4f, 0x294a, 0x2da2, 0x2f6e, 0xac2f, 0x3017, 0x2bbb, 0x9fa8, 0x2f5b, 0xa1d0, 0xad05, 0x2d39, 0x2620, 0x9950, 0x2d7e, 0x2bee, 0xabcd, 0x2f92, 0x9ada, 0xac9c, 0xa920, 0xa106, 0xa316, 0x2af3, 0x2da5, 0x28ec, 0xade0, 0x3003, 0x2b70, 0xac36, 0x301d, 0xa222, 0x1d1f, 0xa7bd, 0x2af4, 0xaa0d, 0x2958, 0xa94b, 0xaca3, 0xa7fa, 0x2ee8, 0xae34, 0xabb9, 0x2e51, 0x073a, 0x29d8, 0x2e86, 0x9b90, 0xa4be, 0xa883, 0x2b35, 0xad9f, 0xa8dd, 0x26d7, 0x22aa, 0x2ede, 0xaa27, 0x2f18, 0x2ca0, 0xa312, 0x9cc6, 0xa9ac, 0x2b81, 0x2b70, 0x2180, 0x2a53, 0x19f7, 0x1ef1, 0xa9ac, 0xa4c5, 0x248f, 0x282a, 0xa68c, 0xaae4, 0xa73d, 0xa695, 0x2ae6, 0x2cf2, 0xab50, 0xa8a2, 0x2072, 0x2c55, 0x29f4, 0x17a8, 0x2c80, 0xa95e, 0xaf32, 0x2fe2, 0xac29, 0x2497, 0xa629, 0xa784, 0xaf12, 0x2a81, 0xaa6d, 0xad67, 0x245e, 0x1a45, 0xaa61, 0x2be4, 0xaf03, 0xafd1, 0x2f6b, 0xaeba, 0xacb5, 0x2f5a, 0xae40, 0x9bf5, 0x2ab9, 0x2810, 0x2c66, 0xa7c4, 0x2a5e, 0x24b7, 0x2c42, 0x2508, 0xad11, 0x2ff3, 0x1cda, 0xadcd, 0xa6ec, 0xaf4e, 0x9ca0, 0xadac, 0xa94b, 0xa8e2, 0x2ba1, 0x9da0, 0xac96, 0xaa12, 0xa1ff, 0xa976, 0x2ddf, 0xac57, 0x28e3, 0xa408, 0xad59, 0xa4e7, 0x28de, 0x22bf, 0x2c93, 0x2317, 0xae9e, 0x2d6b, 0x253c, 0x2cff, 0x220f, 0x22e7, 0x2ab9, 0xaf35, 0x10f6, 0x20e0, 0xa9ab, 0xa017, 0xac59, 0xae07, 0x2ea2, 0xaa09, 0xa9fb, 0xa4a2, 0x21bd, 0xa973, 0xa4fd, 0xaa63, 0xac93, 0x99c5, 0x2072, 0x2978, 0xa056, 0x2d0a, 0xaa90, 0x2d1e, 0xa4f9, 0xa1d5, 0x2ba6, 0x1acb, 0xab5f, 0x22fa, 0xa557, 0xa1dc, 0x2d27, 0x2ed9, 0xabf7, 0xaa51, 0xaba0, 0xa55e, 0x9b94, 0xa250, 0x2c42, 0x2ac3, 0x2eec, 0xace2, 0x9452, 0xa142, 0x2b25, 0x1a13, 0xa8d4, 0xa4a7, 0x273c, 0x2d8a, 0x2737, 0xabe6, 0x2e32, 0x2d83, 0x973f, 0xab9b, 0x27ff, 0x2895, 0xaa4e, 0x2727, 0xab6d, 0x2f0c, 0x2a89, 0x2d3b, 0xa598, 0x14bd, 0xa8e5, 0x21b9, 0xa4c8, 0x9cc8, 0xa7e2, 0xac3c, 0xa9f8, 0xadb6, 0x8e3c, 0x2aee, 0xa4a1, 0xacf0, 0xa9b8, 0x2aa0, 0x2c9c, 0x1d9b, 0xad43, 0xaa3b, 0x2743, 0x1829, 0x2d75, 0x2912, 0x9dcb, 0x28b3, 0x2bd2, 0x2824, 0xaa34, 0x2cf2, 0xaabb, 0xad8c, 0xabf9, 0xa308, 0x2b90, 0x25b4, 0xacf6, 0x2d8f, 0xa883, 0xa9a0, 0xa72c, 0x2a19, 0xa6bb, 0x2548, 0xac55, 0xae54, 0xa6c5, 0xa8a1, 0x2015, 0x2e9b, 0x2aec, 0x289b, 0x292b, 0xa50b, 0xaebb, 0x2f06, 0xae15, 0xad94, 0xa06c, 0x2c40, 0xa9fc, 0xabb6, 0xa936, 0xadcd, 0x250d, 0x9c62, 0x296f, 0xae34, 0x226f, 0xad5f, 0xae23, 0xa8fa, 0x2b12, 0x202a, 0xaae4, 0x2902, 0x2aa7, 0xadab, 0x2746, 0x299c, 0xadca, 0x280b, 0x20c1, 0x297c, 0x276a, 0x2d79, 0xaedd, 0x2cd9, 0x2d4c, 0x94ec, 0x165b, 0x2b4f, 0xa20b, 0x2ed7, 0xac63, 0x2767, 0x26f3, 0x26c1, 0xab08, 0xa864, 0x2c18, 0xae37, 0x281a, 0xa9cd, 0x2661, 0xa816, 0x2b92, 0xa6ee, 0x2d69, 0x2579, 0x2894, 0x2edc, 0xab35, 0xa979, 0xa6d0, 0x9e7e, 0xadc4, 0x2f06, 0xa463, 0xae94, 0x2a65, 0x288b, 0xab0d, 0x9ed1, 0x2af2, 0x2755, 0x2f8e, 0x2362, 0xaf7f, 0x2769, 0x1eb6, 0x26ea, 0x3023, 0xa93f, 0xaba2, 0x2bce, 0x2c4e, 0xab57, 0xab29, 0xaaf4, 0xab1f, 0x9cdc, 0x2dc1, 0xae06, 0x2993, 0xa69a, 0x2a37, 0x2ab2, 0x2eee, 0xadce, 0x2c56, 0x2f0e, 0x25f2, 0x9c3b, 0x9c11, 0x2188, 0x2c1c, 0x184d, 0xae8a, 0xa9cd, 0x2f13, 0xa7b2, 0x2522, 0x2e33, 0xa01f, 0xacef, 0x29e2, 0xa5f7, 0x190d, 0xa98d, 0xa966, 0xaf1a, 0x286c, 0xac09, 0xae85, 0xa84b, 0xaba1, 0x2976, 0xa4db, 0x2b5d, 0x29e5, 0xa2e0, 0xacf7, 0x2cd6, 0x286d, 0xa515, 0x9c7b, 0xacb6, 0xad16, 0xa794, 0xae1d, 0xa632, 0xac8d, 0xae31, 0x998b, 0xa28b, 0xa55e, 0xa387, 0x2dc8, 0x25d3, 0xad3c, 0x8f93, 0xad02, 0xac6e, 0x2c57, 0x257d, 0x2674, 0xa572, 0xa531, 0x2377, 0x195b, 0x2cca, 0xa5a1, 0x2dfc, 0x2c81, 0xa0b3, 0x2d52, 0x2649, 0xaa69, 0xa911, 0x2c4e, 0x2822, 0x2c80, 0x2c1f, 0xaabf, 0xa40c, 0x2edc, 0xae36, 0x2716, 0x2daf, 0xac16, 0x17f0, 0xa82c, 0xa22f, 0x2c32, 0x29e2, 0xa42e, 0x29bb, 0xac1b, 0xab11, 0xaa63, 0xa6e4, 0xad51, 0x2019, 0x2c55, 0x2919, 0x2b3e, 0xa962, 0xa7e6, 0x2c6e, 0xa886, 0xa74c, 0x25de, 0xa334, 0x2869, 0xa1ba, 0x2276, 0xab1f, 0x2475, 0xa667, 0xa86e, 0x24b2, 0x10a4, 0xac9e, 0xaca4, 0x2cf5, 0xad15, 0x2cc9, 0x2313, 0xade9, 0xad4e, 0x2ede, 0xafd0, 0x2bdd, 0x2837, 0x2102, 0xa2c1, 0x2d19, 0x26ee, 0x2bf0, 0x2c44, 0xa61c, 0x28b0, 0x2ea8, 0xaddc, 0xabec, 0x2f84, 0x286a, 0xab8c, 0x25d3, 0xa639, 0xacaf, 0x2e55, 0xaf32, 0xa7f0, 0x22a9, 0xae08, 0xab9c, 0x2d9b, 0xad81, 0x2c53, 0xa9d0, 0xa824, 0x2c8d, 0x2ed0, 0x1a57, 0xad14, 0xa936, 0x2563, 0xad4e, 0xac73, 0x2caa, 0xac1a, 0x2ae1, 0x2ab7, 0xaec7, 0xaf7d, 0x2eb0, 0x297d, 0xaa5e, 0x2c4c, 0x2a8c, 0xa92b, 0x2d14, 0x2705, 0xade3, 0xad1f, 0x2caf, 0xae65, 0x27db, 0x2d39, 0xa212, 0xab01, 0x2f65, 0x9c8a, 0x2c7b, 0x2b3e, 0x2b05, 0xaf3a, 0xa8e6, 0x2456, 0xa0ba, 0x2f94, 0xadb3, 0xa568, 0x2b79, 0xa564, 0x2945, 0x28d8, 0xa0e1, 0xa714, 0x2c34, 0x21b5, 0xac8f, 0xa7b4, 0x2c61, 0x2c41, 0x2dce, 0xaa03, 0xa4c2, 0x9e93, 0xa716, 0xaef3, 0xa890, 0x2f29, 0xaaae, 0x2d95, 0x2f78, 0xab64, 0x9ed8, 0xa67d, 0x29e0, 0xabe6, 0xad68, 0x2306, 0x2593, 0xaef9, 0x2e99, 0x26c9, 0xa8b0, 0xab88, 0x214c, 0x2845, 0xa997, 0xacab, 0xa7d2, 0x2ea8, 0x25f2, 0xadf2, 0xa186, 0x21ad, 0xad6b, 0xa668, 0xa352, 0x2a4b, 0x13ac, 0x207b, 0xa37d, 0x2cdd, 0xaa5d, 0x2e8a, 0x27d1, 0x9c46, 0x2e4c, 0xae9e, 0xabf6, 0xab88, 0xaa8b, 0xae55, 0x2c5f, 0x2a3d, 0xa738, 0x2e69, 0xae24, 0x2908, 0xa9dd, 0xa787, 0xac6c, 0x2ef2, 0xa807, 0x24fa, 0x20cc, 0x2c6a, 0xaedc, 0xaa64, 0xab31, 0xadc5, 0x28da, 0xab02, 0xaaf8, 0x2262, 0xaadb, 0xaac3, 0x2f86, 0xab23, 0x2d43, 0xa0c6, 0x2c39, 0x2bf7, 0xaabb, 0x2d97, 0xa9bf, 0xacbc, 0x27e9, 0xa474, 0xab81, 0x2f58, 0x2fb3, 0xaa0b, 0xa019, 0x1ed1, 0xa3a8, 0x20b3, 0x2f70, 0xae0f, 0x2d0b, 0x2696, 0x2ab0, 0x2970, 0x2bac, 0xac46, 0xa6d5, 0xa507, 0xaf1c, 0xacc8, 0x2c4f, 0xa27e, 0xa96c, 0x9652, 0xaecc, 0x25b4, 0x2f40, 0xab12, 0x2a20, 0x2c3f, 0x2d5c, 0xad0e, 0x29d4, 0x2df3, 0xac61, 0xaa42, 0x2f7b, 0x1ca6, 0x28db, 0x2dd0, 0x2d22, 0x9e22, 0x2b8d, 0x241e, 0xa885, 0x2a07, 0x2146, 0x2ed0, 0x2e95, 0xad9b, 0x2c69, 0xa88b, 0xada6, 0xa47e, 0x28d1, 0xa2bf, 0xa7e4, 0xad2c, 0x2e69, 0x28e7, 0xada4, 0x23b9, 0xa974, 0x1c33, 0x2fe2, 0x9185, 0xae55, 0x2f89, 0xa9c5, 0xa91a, 0xa881, 0xafd3, 0x21d6, 0xaa25, 0xa100, 0xadd5, 0x2d2c, 0xae59, 0xa415, 0xaa0a, 0xaed5, 0xa76e, 0xa757, 0xa8b3, 0xa96d, 0x24fb, 0xaf71, 0xabb0, 0xa5b6, 0xa8b9, 0xa281, 0x2c0f, 0x2508, 0x2b3a, 0x261a, 0x2214, 0xa701, 0xa784, 0xae93, 0x2a21, 0x2e14, 0x25d6, 0xa4ca, 0xac41, 0xa484, 0x9f7f, 0xa85d, 0xadd5, 0x2e55, 0x142c, 0xaf24, 0x2dc0, 0xab44, 0x2577, 0x90c4, 0xa4c1, 0x26ee, 0xac5d, 0x998a, 0x2e59, 0x2e58, 0x1e07, 0x28d6, 0x2c4b, 0xa83d, 0x2ff1, 0xa4c1, 0xaf44, 0x2e34, 0x14bd, 0xac9d, 0x2c76, 0x2bab, 0x2d1f, 0x272e, 0xa99f, 0xa984, 0xae8a, 0xa4d7, 0x2079, 0x26b3, 0x301b, 0x21dc, 0xa0c2, 0x13d5, 0x2faf, 0xaef0, 0x240d, 0x9d88, 0xa124, 0xacc6, 0x2222, 0xace6, 0xa8df, 0x9587, 0x1d4c, 0xac72, 0x2d04, 0xaee4, 0xa64a, 0xa895, 0x9bfa, 0x1b67, 0x2d84, 0xad77, 0xaf1e, 0xa431, 0x9b09, 0xa9e1, 0x2fae, 0xa5b2, 0x2852, 0x290d, 0xaeda, 0xab6a, 0xa58d, 0xace1, 0xad2e, 0x962d, 0x2518, 0x9c9f, 0x9e5b, 0xad2a, 0xa385, 0x22a1, 0xa597, 0x3030, 0x1fb3, 0xadc1, 0x3037, 0xa752, 0x9ff6, 0xa793, 0xa37c, 0x22e3, 0x28d6, 0x2839, 0x9ce9, 0x202d, 0x92c0, 0xaa48, 0x21f0, 0xac4e, 0x2e5b, 0x927d, 0x290d, 0xabbf, 0x2592, 0x2834, 0xa2d9, 0xa8a8, 0x2c19, 0x22ff, 0xace8, 0x2ddf, 0x2f5b, 0x2539, 0x2e17, 0x2c5b, 0x27b9, 0x2ca4, 0x2e37, 0x1845, 0x2ea5, 0x2832, 0xac3b, 0x2db7, 0x2523, 0x298a, 0x1bb3, 0x2989, 0xadaa, 0xaa5e, 0xa876, 0xaee7, 0x2c06, 0xa635, 0xaf32, 0x2d74, 0x2cd4, 0x2a84, 0x26d5, 0xacc1, 0x28c7, 0x19e8, 0xa6e0, 0xa69a, 0x2a84, 0xa9f8, 0xae2b, 0xa828, 0x28ac, 0x1aff, 0x27cd, 0x2164, 0x2b5c, 0x2848, 0xab11, 0x2395, 0xa59a, 0x2ec9, 0x929b, 0xa1bb, 0x263c, 0xacbe, 0x276c, 0xab6a, 0x1899, 0x2dfd, 0xa916, 0x2974, 0x25d7, 0x9c75, 0xa422, 0x29bc, 0x25f4, 0xadce, 0xa3a5, 0xaa59, 0xad04, 0x2f1e, 0x2420, 0x2915, 0x2c08, 0xaaa8, 0xac4d, 0x2a56, 0x2c16, 0xa836, 0x26e1, 0x0e3a, 0xab6e, 0x24d5, 0x2b24, 0x2804, 0xac14, 0x2ea9, 0x2c8a, 0x291a, 0xaa03, 0x2bbc, 0xa144, 0x222a, 0xa934, 0x2dab, 0xa4ff, 0xad51, 0x15c8, 0xad58, 0xa51a, 0x2e19, 0x2617, 0x2a5a, 0x9caf, 0x256e, 0xae7b, 0xa72e, 0xaf8f, 0xadcd, 0x2c56, 0x2c5c, 0xa698, 0x21a9, 0xa986, 0xac94, 0x2c37, 0xaa51, 0xad4f, 0xa0f6, 0xae28, 0xac63, 0x2cea, 0xa62f, 0x2939, 0xab26, 0xa9ef, 0xa792, 0x9d97, 0x2758, 0x28fe, 0x2e67, 0x1a49, 0x29ed, 0x2ee8, 0xad88, 0x008c, 0x284e, 0xa582, 0xae3d, 0x97c8, 0xac08, 0xa8f9, 0x2656, 0x9d28, 0xa88e, 0x2ca2, 0xac11, 0x2cec, 0xae62, 0x8e34, 0x1f04, 0xa722, 0xae7e, 0x2d17, 0x28e2, 0xafcc, 0x2d58, 0x2c0d, 0xad61, 0xa3be, 0xac89, 0x2dea, 0xada8, 0xa94e, 0x2cdd, 0x9d55, 0x27d1, 0xa65e, 0x941d, 0x2c61, 0x2642, 0x2a38, 0xadce, 0xa46c, 0xad9d, 0x293c, 0x2e40, 0xae99, 0xacb6, 0xacaa, 0x2191, 0x2bab, 0xab6f, 0xae37, 0x9441, 0x2c18, 0x2ac3, 0xa634, 0x224b, 0x25c4, 0x25e2, 0x2daa, 0xa5c8, 0x2436, 0x2b3b, 0x2347, 0xa3c6, 0xa825, 0x28d0, 0x9611, 0x28de, 0x2c44, 0x28d0, 0xa9b6, 0x2c76, 0x9b90, 0x2e79, 0x9f8a, 0x25d4, 0x2c43, 0x2a67, 0xac1d, 0xaaff, 0x29d8, 0x27ff, 0x2c0f, 0x1f1f, 0xab28, 0x2cdd, 0x2d2b, 0x2cab, 0x25f6, 0x9213, 0xa632, 0x2b47, 0x253d, 0x2c99, 0x2811, 0x283f, 0x2aa1, 0xaacc, 0x0c3f, 0xa115, 0x92ac, 0x2a66, 0x26b9, 0x2886, 0x2c58, 0x2b43, 0xae91, 0x2d2f, 0x19a1, 0x2248, 0xaa6e, 0x257a, 0xad1a, 0x2873, 0xaacc, 0x1ec4, 0x2dc0, 0x0b73, 0xad9a, 0x29bd, 0xad67, 0x2486, 0x28ce, 0xa227, 0xad6f, 0x1c26, 0xa7cf, 0xac2e, 0x2c96, 0xae89, 0x2559, 0x2907, 0x2c88, 0x2554, 0xaa5d, 0x2bb2, 0x14f9, 0x26ba, 0xac26, 0xa16c, 0xa513, 0xac9a, 0xad15, 0xab10, 0xac5f, 0x28c6, 0xab05, 0x2d08, 0x216a, 0xa5be, 0xab1e, 0x9c1b, 0x263c, 0xac7d, 0xac7e, 0x2064, 0x220b, 0x2de8, 0xaba8, 0xa9c3, 0x2de3, 0x266c, 0x2df3, 0x281a, 0x2e8f, 0x2064, 0x206b, 0xafed, 0x29ee, 0x17f5, 0xa4b2, 0x2db2, 0xa809, 0x1ef6, 0x2939, 0x24ae, 0xab78, 0x29be, 0x2ed8, 0x2618, 0xade8, 0x298d, 0xa724, 0x1f90, 0x2db7, 0xacdf, 0x2e94, 0x2683, 0xacf1, 0xa7b6, 0x2968, 0x2d27, 0xa48a, 0x2e33, 0xa68e, 0x28ff, 0x2f45, 0x27a6, 0xa7be, 0x2c3e, 0x2ceb, 0x2b95, 0x2f07, 0x2cdc, 0xae2b, 0x2f94, 0xa021, 0xacdc, 0xab14, 0xa480, 0xa460, 0xa702, 0x2dd3, 0xabc8, 0xad85, 0xa44d, 0xa9da, 0xa59a, 0xae09, 0x2c01, 0x245d, 0xacbc, 0x2ce9, 0x2965, 0xaa22, 0x2c9c, 0xb019, 0x2927, 0x2a38, 0x2cc7, 0x24cd, 0x299a, 0xab00, 0xa40f, 0x26d1, 0xac30, 0x27f1, 0xa519, 0xaf33, 0x2aba, 0x2977, 0xac36, 0xae6e, 0xab8d, 0x2a13, 0xadc7, 0xa2c7, 0xa8d2, 0xa5e2, 0x2da1, 0x2606, 0xadad, 0x9f79, 0x2761, 0x2b18, 0xa88d, 0x2817, 0x2299, 0x2c56, 0xaef6, 0x25b0, 0x2a7a, 0xa807, 0x296e, 0x2c0e, 0x26e2, 0x2f6d, 0x23ae, 0xa16d, 0x1ce7, 0x1bcf, 0x26d5, 0x29df, 0x2e77, 0xb001, 0x2cd5, 0x2419, 0x287b, 0x2912, 0x25e7, 0x2760, 0xae2a, 0x2980, 0x2bbb, 0x259c, 0x2d1b, 0xa2e5, 0xabfe, 0x2eb1, 0xa9e7, 0x2bd1, 0x2dbb, 0x04f5, 0xad79, 0x1db8, 0x2d76, 0xad23, 0x2ba8, 0x2843, 0xa5c6, 0x20d6, 0x9fa0, 0xa91f, 0x2d15, 0xa831, 0x293b, 0xae60, 0x28e2, 0x2880, 0x2ef8, 0x2dc8, 0xab9f, 0x10eb, 0xa051, 0x2496, 0xa58f, 0x2a3c, 0xa35c, 0x16fd, 0x0894, 0x2ed5, 0x24d2, 0x2c72, 0x28b6, 0xabdf, 0x29bc, 0x2f24, 0x2cbc, 0x8cbc, 0x232f, 0xa97c, 0x292b, 0x2ae7, 0xad9c, 0x2d30, 0x2d99, 0x2d44, 0x19ff, 0x2c56, 0xad0e, 0xad15, 0x2635, 0xad0c, 0xaab8, 0xae51, 0x2933, 0xaff1, 0xae92, 0x302f, 0xaf79, 0xaf6f, 0x2a7c, 0x22fe, 0x25f3, 0x2c31, 0x2c67, 0xadbb, 0xa5c3, 0xaa3b, 0x2434, 0xa3cc, 0xaca5, 0xac73, 0x2c62, 0xa78c, 0xac04, 0x2512, 0x2822, 0x995b, 0x2909, 0xadfd, 0xad07, 0x25a3, 0x2a58, 0x2a3f, 0x2ebc, 0xa5fb, 0xa38b, 0xa041, 0xaf88, 0xa06a, 0xac4d, 0xa555, 0xad3e, 0x19e3, 0xaa43, 0xb008, 0x2a76, 0xacf5, 0xa6dc, 0x2e6a, 0x2a78, 0xa9d2, 0xaefc, 0x10dc, 0x2c00, 0xa0fb, 0xa4b2, 0xadd9, 0xa51a, 0xa5b7, 0x2be9, 0x2041, 0x2add, 0xad70, 0xacf8, 0x2214, 0xae2a, 0x19b4, 0xa801, 0xadbd, 0x2c1a, 0xa2ab, 0xac4d, 0xaebb, 0x29b0, 0xade3, 0x2a1e, 0xa8c0, 0xae45, 0xad91, 0x284b, 0xae08, 0xa8ac, 0x2e34, 0xad64, 0x21f4, 0x2e8b, 0x1cc2, 0xaf96, 0xa49c, 0x28b2, 0xa2c2, 0x247f, 0x2e83, 0xa841, 0x2614, 0x23a0, 0xacae, 0x2c4d, 0xa9e7, 0xad6a, 0x2cde, 0xabd9, 0xaec4, 0x29c5, 0xa05c, 0x28bc, 0x28b5, 0x18f9, 0x29a4, 0xaaca, 0x2abc, 0xa903, 0xab0b, 0x294b, 0x2a1d, 0x29d1, 0x2c08, 0x25f0, 0x2e06, 0x2ded, 0xa8b2, 0xa51e, 0x2ad7, 0x2928, 0xa822, 0xac5c, 0x9e4f, 0xa209, 0xa5d5, 0xac37, 0x2daf, 0x2bdc, 0x13c8, 0xaa5b, 0xacf9, 0x214c, 0x26b8, 0x26e4, 0x2415, 0xa9e2, 0xa83b, 0x2b07, 0xabff, 0x2d73, 0xae9f, 0xaf10, 0xaa55, 0x90f3, 0xa80d, 0x2f16, 0xaa65, 0xa093, 0x1d18, 0xa222, 0xae9c, 0x2d92, 0xad7e, 0xaae8, 0x2c4b, 0xabb2, 0xa8a5, 0x1a82, 0xa689, 0xae5f, 0x2cb9, 0xab20, 0x299a, 0x237e, 0x2849, 0xaaff, 0x2f28, 0xaf3a, 0xae69, 0x2e35, 0xad76, 0x294a, 0x2ef4, 0x281a, 0xaa2b, 0x2388, 0xa914, 0x29d1, 0xa0d9, 0xad06, 0xa842, 0xa5ca, 0x2444, 0xa03f, 0x2a5e, 0xac5e, 0xad66, 0xa39c, 0x26c1, 0x2cfc, 0x28f7, 0xa63c, 0x2ccd, 0xaa43, 0xa7de, 0x2d2e, 0xa98b, 0x2790, 0xa836, 0x2947, 0x2d03, 0x2e32, 0xac28, 0xaacc, 0xa174, 0x1d65, 0x2bfb, 0x2d40, 0xacda, 0xa84c, 0x25c6, 0x287f, 0x298f, 0x2edc, 0x2419, 0x2c64, 0xa708, 0x11d7, 0xa80b, 0x2dee, 0x248f, 0x2c85, 0x2e47, 0xa67e, 0xabb1, 0x9e28, 0x21b1, 0x2c0f, 0x9b36, 0x2bae, 0x1cfe, 0x2ac7, 0xa9e3, 0x21af, 0x22d9, 0x29dd, 0xa9ee, 0xaa48, 0xa504, 0xab31, 0x20d9, 0xa4fc, 0xaae8, 0x2807, 0xab4e, 0xa0ca, 0xa4ad, 0xaa2a, 0xa532, 0xa86d, 0xade1, 0xa99d, 0x2941, 0xad40, 0x2d02, 0xabd6, 0xa7b4, 0xa9f9, 0x26a1, 0xaa8c, 0x2c00, 0x2d01, 0xac98, 0xa907, 0x1c05, 0xa379, 0x28b0, 0x273b, 0x2ae1, 0x2d53, 0xa6f0, 0xa62a, 0x26d1, 0xad5d, 0x20b1, 0xa76d, 0x2a6a, 0xab6f, 0x2c8e, 0xae48, 0xa859, 0xab44, 0xa57b, 0x286d, 0x1ee3, 0xae15, 0x2cbe, 0x29b1, 0xa934, 0xa8e3, 0xaba4, 0xa62d, 0x2cfb, 0xab56, 0x258c, 0x2898, 0xa75c, 0xab97, 0x2f9f, 0xa9e7, 0xaeb5, 0x22eb, 0x25f1, 0x1c8b, 0x2a0a, 0x27f5, 0xabb8, 0x2d47, 0x29ac, 0xaa8e, 0xa6ef, 0x286c, 0x2f4d, 0x2db1, 0x2162, 0x2c4e, 0x274e, 0xadfa, 0x2836, 0xa91b, 0xad5c, 0x2c8b, 0x229e, 0xadcc, 0x2bb5, 0xa59b, 0x24f4, 0x29a3, 0x9f4e, 0x2acd, 0x9f97, 0x2bbb, 0x2af3, 0x2abc, 0x1cf0, 0xac75, 0x2c74, 0x268e, 0x2c78, 0x2667, 0x2a13, 0xa0b5, 0xaa7b, 0xab0b, 0xac48, 0x212f, 0xa997, 0x2def, 0xacd9, 0x292d, 0xa85a, 0xacc7, 0x2822, 0xaa79, 0x2c35, 0x28de, 0x270f, 0xa469, 0xac76, 0x2d91, 0x1d9a, 0x29a9, 0x2dd0, 0x2c19, 0xa994, 0x247c, 0xa6ff, 0x1abe, 0x2ed5, 0x2a35, 0x26f8, 0x2e52, 0x2d0c, 0x2c64, 0xa9dd, 0xa3fe, 0x2b1b, 0xa9d5, 0xac17, 0x2c80, 0x26b0, 0x2b18, 0x2ba2, 0xab5c, 0xac25, 0xa7e4, 0xaea9, 0x2397, 0xa9b7, 0x2277, 0xa781, 0x2c05, 0x266c, 0xaaae, 0xa476, 0xae58, 0xaaf5, 0x25ec, 0xa88d, 0xacff, 0xad18, 0x2b03, 0xaa16, 0xa5aa, 0x27ca, 0x2a80, 0x1ed2, 0xadb2, 0x8237, 0x2390, 0x2c1e, 0xad13, 0x2a64, 0x22f4, 0xa40c, 0x2491, 0xa5b3, 0x2dbe, 0xad74, 0x2a1a, 0xa6e9, 0x286e, 0x9d76, 0x23ec, 0xa991, 0x22a2, 0x2cdf, 0xad2f, 0x2a4b, 0x2465, 0x9a65, 0x2abe, 0x259b, 0x296a, 0x2e5d, 0x28bb, 0xa631, 0x2302, 0xadb2, 0xa980, 0xaa25, 0xb02e, 0x24ef, 0x230c, 0xade9, 0x2ceb, 0x27aa, 0x24f9, 0x2b09, 0x2b38, 0x2857, 0x286c, 0xa9f7, 0xab9c, 0x2f15, 0x9fdc, 0xa5bd, 0x2742, 0x2cc7, 0x257f, 0xa4a7, 0x257c, 0x1d8d, 0xa8a1, 0xaa77, 0x0e77, 0x2fe4, 0x2d1f, 0xa679, 0x275d, 0x29cf, 0xad79, 0x24a5, 0xa715, 0x2a03, 0x2d00, 0xab3d, 0x25c3, 0x2ca8, 0x2f2b, 0x2184, 0x1939, 0x1c59, 0xac61, 0xa830, 0x2890, 0x2809, 0xaacc, 0x2304, 0x299b, 0xac5d, 0x2c75, 0x2a97, 0x2575, 0x2d68, 0x2c31, 0xaf42, 0x1f87, 0xab95, 0xa2af, 0x2d75, 0xa55a, 0xa37c, 0x2bd5, 0x3007, 0x280d, 0x2b26, 0x2455, 0x1902, 0x2ca6, 0x2968, 0x2bfb, 0xa823, 0x2a98, 0xa3d9, 0x9df9, 0xa60e, 0x2db1, 0x2e1f, 0xabb9, 0x2ca7, 0x2d7b, 0x28af, 0x1eee, 0xac33, 0xa4f4, 0x2775, 0xacda, 0x2545, 0x2543, 0xaa92, 0x2d8b, 0xa4c7, 0x2925, 0x2059, 0xa787, 0x1af4, 0x2b6b, 0x2af5, 0x2709, 0x2bca, 0x262b, 0x2dcc, 0x9ee2, 0x25cc, 0x2c82, 0x2dc6, 0x2e86, 0xa70a, 0x2b1f, 0x2f03, 0x2da6, 0x9944, 0x2c66, 0x255d, 0xa924, 0x28e0, 0x2c57, 0x2c42, 0x0e6c, 0x24e2, 0xaa6e, 0xa8d6, 0x1cc8, 0xabcb, 0xaaf3, 0xab40, 0xa466, 0x1960, 0xae7b, 0xab9b, 0xad9d, 0x20ba, 0xae22, 0xac20, 0xafb1, 0x29b3, 0xad6f, 0x1f8d, 0x2c3f, 0x2c4e, 0x2aec, 0x298b, 0xac1e, 0xad30, 0x2c40, 0xa85c, 0xabca, 0x2f70, 0xab46, 0x246a, 0x2b5e, 0x2d53, 0x9c3b, 0x22a7, 0xa280, 0x2972, 0x2e69, 0x9880, 0xaca3, 0x280c, 0x2d0c, 0x2842, 0xab59, 0x2df1, 0xaba2, 0x2cd4, 0xaa5a, 0xa594, 0x9cc5, 0x1e59, 0xad49, 0x29e2, 0xa943, 0xac00, 0x1d5d, 0xa5ed, 0x1f56, 0x2be3, 0x2dcf, 0x22de, 0x92b7, 0x2f55, 0x1aa2, 0xaa7d, 0x2760, 0xa658, 0x2b95, 0x29e9, 0xae7c, 0xa4cd, 0xac42, 0xa3a2, 0x2dd7, 0xac90, 0xa83e, 0x264d, 0x2a05, 0xae4b, 0xa9e6, 0x2db8, 0xaefa, 0x25fa, 0xa8ed, 0x292d, 0xa678, 0xa91a, 0x9f4b, 0xab83, 0x2884, 0xaa3e, 0xadd9, 0x2908, 0xa87e, 0x91de, 0x2cb8, 0xabda, 0xa6c1, 0xa410, 0xa8a2, 0xad17, 0x2dbf, 0x283f, 0xadc2, 0x2f1a, 0x2226, 0xae50, 0x2bac, 0x16e9, 0x1ba7, 0xa445, 0xa315, 0xa947, 0x2684, 0xa683, 0xaad3, 0x28b3, 0x2757, 0x2b4e, 0xa4e4, 0xadfd, 0x27fd, 0x25d1, 0x26bb, 0x1f6f, 0x2ef7, 0xaca9, 0x2bc7, 0x2157, 0xaa3d, 0xa5ae, 0x27a3, 0x29e7, 0x2856, 0xa58e, 0x2d93, 0x2d78, 0x297b, 0xa7de, 0x2db9, 0x2dc2, 0x2d48, 0x27f3, 0xadb3, 0x2a35, 0x2f7b, 0xaef2, 0xa19c, 0xa76c, 0x9cb9, 0x206f, 0xaab5, 0x2993, 0xaa42, 0x2f47, 0xa7c9, 0xa400, 0x2c6e, 0x29af, 0x2e58, 0x2be5, 0xabed, 0x27f0, 0x289a, 0xa8b3, 0x25d8, 0x28db, 0x9bc7, 0x9d0a, 0x2b66, 0xa5a0, 0x296e, 0xa83f, 0xa8ec, 0xa88d, 0x251e, 0xa6a8, 0x1cc4, 0x1f20, 0x293f, 0x9b62, 0x2ee2, 0x2570, 0x29fe, 0x2bd0, 0xaa75, 0xa7ac, 0x265d, 0xa08c, 0x2909, 0x20fb, 0x2b8c, 0x1f2a, 0xaa12, 0xa94d, 0x2612, 0x2630, 0xaf75, 0x2a6c, 0xaebe, 0x26db, 0x2654, 0x2400, 0x290c, 0x2dc4, 0xac29, 0xa4aa, 0x29f3, 0xaaac, 0x22fe, 0x2f58, 0x2286, 0xa7f0, 0x2e00, 0x2805, 0xa625, 0x3052, 0xac14, 0xaca2, 0x2c0b, 0xadc7, 0xac2c, 0xa8c7, 0x27e6, 0x1001, 0x2f21, 0xadf3, 0xabed, 0xa893, 0xac03, 0x9d4f, 0xa429, 0xa9fe, 0x28ab, 0xac61, 0x2700, 0x2c83, 0xa569, 0x95bf, 0xaca8, 0x27fe, 0xa9b0, 0xa0db, 0xacd2, 0xaf26, 0xa9b8, 0x11fc, 0xac4e, 0x2e6d, 0x2871, 0xacaa, 0x2a1f, 0xac96, 0xa090, 0xab45, 0xa66f, 0xa5c6, 0xa35a, 0x2870, 0x2af7, 0x26dc, 0xa834, 0xabb3, 0x287b, 0xa693, 0xa109, 0x2cbe, 0xad2f, 0x2cb2, 0x29cd, 0x2827, 0x2c22, 0xa108, 0xa158, 0x2810, 0xa7e1, 0x2a58, 0xaa28, 0x2ab0, 0x29e9, 0x2cb5, 0x291a, 0x2bcf, 0x25ca, 0xad4a, 0xaa08, 0x2c3d, 0x291a, 0xad4b, 0xa89c, 0x2d33, 0x22c9, 0x2967, 0x26a7, 0x27f3, 0x1849, 0x11fb, 0x2bd1, 0x83f3, 0x2bd8, 0xa6c1, 0xabbe, 0xab20, 0xa79f, 0xa847, 0xa5d5, 0x2460, 0x2271, 0xae5d, 0x1deb, 0xa959, 0x2cdc, 0xad14, 0xa197, 0x2a66, 0xa7bd, 0xa155, 0xacc3, 0x289a, 0xa835, 0x2575, 0x1c0b, 0xa6c8, 0x9ae1, 0xafee, 0xae12, 0x29ba, 0xa8cc, 0x1da0, 0x2763, 0xaec0, 0x26f7, 0xacaf, 0xa31b, 0xa44c, 0x2c03, 0xadef, 0xa83b, 0x2c56, 0x2a21, 0x2204, 0x2ece, 0x9b3f, 0xa76c, 0xab72, 0xacb9, 0x2eea, 0x2898, 0x2c50, 0xabff, 0x1839, 0x24ef, 0xac16, 0x27d7, 0xae29, 0xaa0c, 0x9a54, 0x2a97, 0x2c03, 0x297b, 0x22c4, 0x2706, 0x2d4f, 0x2949, 0x2d4d, 0x1e14, 0x2c3f, 0xa85f, 0xaf88, 0xa721, 0x2cb3, 0xadc1, 0xa9e7, 0x9546, 0x2dca, 0x2cb9, 0xa569, 0x217b, 0x150a, 0xa9ee, 0x2605, 0xa30f, 0xade1, 0x2b32, 0xa8ff, 0xadcc, 0xa816, 0xa903, 0xa840, 0xaa76, 0xaa10, 0xaff2, 0xab17, 0x982e, 0xa434, 0xa9f0, 0x2a7f, 0xabc0, 0x2f84, 0x2bc0, 0xac5f, 0xa9b3, 0x2dec, 0x9d2f, 0x2f39, 0xa263, 0xae6c, 0x98ab, 0x2893, 0xada0, 0x2da9, 0x2a03, 0x26f0, 0x2edc, 0xa80c, 0x2c76, 0x210c, 0x2e97, 0x26fd, 0x28fe, 0x2373, 0xa924, 0x2395, 0xa53d, 0x2297, 0xa545, 0x2db5, 0x9e9b, 0x2f1a, 0x2cd5, 0x2bf4, 0x2fde, 0x2d2f, 0x2d16, 0x24c7, 0xa908, 0x2a0e, 0x270d, 0xabda, 0xa8ce, 0x2ce4, 0x228c, 0x2b51, 0x2cbf, 0x2ada, 0xac3f, 0x2eda, 0xa9e6, 0xa3b1, 0xa678, 0xab15, 0xad8d, 0xac35, 0x2117, 0xa50a, 0x2e82, 0x2322, 0xa30c, 0x9b76, 0x2756, 0xa6a0, 0xac71, 0xac6d, 0x8d91, 0xabca, 0x2ea9, 0x2c28, 0x2a45, 0xa947, 0xa6b4, 0xa397, 0x217a, 0xadc9, 0xa5de, 0x9e9f, 0x2a41, 0xabc9, 0xad16, 0x2d21, 0x2360, 0xad5c, 0x260d, 0xac78, 0x2c56, 0x2432, 0x2308, 0x22e0, 0xa897, 0x291b, 0xac49, 0xa7f6, 0x268a, 0xa4d8, 0xaa93, 0x2c80, 0x2c12, 0x29ac, 0xaeb9, 0xae21, 0xa879, 0xa79c, 0xadfa, 0xa44a, 0xa47d, 0x2732, 0xa515, 0xace9, 0x2a78, 0x248c, 0xa845, 0xafeb, 0x264a, 0x29c5, 0xa432, 0x2a00, 0x2b1e, 0xacd7, 0xaa70, 0x2358, 0xabf7, 0x26cf, 0xac4e, 0x2f30, 0xaae8, 0xac79, 0x2980, 0x2a9d, 0x3040, 0xad6e, 0xaf21, 0x2e4b, 0xae1d, 0x2d29, 0xa472, 0x23f9, 0x1a28, 0xa956, 0x29a8, 0xabb3, 0xa4af, 0x19a6, 0x2a2b, 0xae30, 0xa464, 0x29e5, 0xaac9, 0xaa2d, 0xa293, 0x23c5, 0x2e6f, 0x2a29, 0x2a93, 0x2373, 0x2418, 0xa810, 0x3049, 0xadb0, 0xa71f, 0x2d93, 0xae79, 0xa82e, 0xaaa0, 0xabfa, 0x2c8c, 0xa9b0, 0x254c, 0xa862, 0xa8ed, 0xa37c, 0x912c, 0xad15, 0xac3a, 0x2e42, 0xa816, 0xafb4, 0x2a87, 0xa9c5, 0x23a8, 0x20fd, 0xa918, 0x2cfa, 0xa9d6, 0x2778, 0xab73, 0xaa9f, 0x27c8, 0x2377, 0xa405, 0x2982, 0x22d1, 0x2f13, 0xa922, 0x28bd, 0x30ff, 0x26b3, 0x25db, 0x8ddc, 0x2bae, 0x2cf4, 0xae9e, 0x2399, 0xa90b, 0x2ded, 0x2d68, 0x2d5c, 0x26f2, 0x23b5, 0x2971, 0xa1cd, 0x2e70, 0x2b2e, 0x2af3, 0x2cf5, 0x2e93, 0xadab, 0xa41c, 0x2ecb, 0xadbf, 0x2a73, 0xa4d1, 0xa46f, 0x2ced, 0x2c08, 0x9f2d, 0x259c, 0x2578, 0xa6e1, 0x25c2, 0x2a50, 0x2002, 0x2af1, 0xa6d8, 0x2192, 0x227d, 0xa863, 0xa5b0, 0x2f08, 0x24ce, 0x2a32, 0xa758, 0xa84b, 0x2bfb, 0x1f9c, 0xad67, 0x26f3, 0x25ff, 0xadd6, 0x2f14, 0xa8f7, 0xad19, 0x2c64, 0xa764, 0xae77, 0xac1e, 0x1a2a, 0xad30, 0x22a9, 0x2817, 0xae18, 0xa9ad, 0xac48, 0x2b2c, 0x2e43, 0xad10, 0xadd9, 0x2965, 0xac5d, 0xa183, 0x2f1d, 0xaa86, 0xaabd, 0x2d71, 0x11ee, 0x20ea, 0x284c, 0xa242, 0xa6d0, 0x2cae, 0xa8e4, 0x2c73, 0xa6a5, 0x82af, 0x1b70, 0xaad9, 0x2ac3, 0x26c7, 0x26ba, 0xa109, 0xad87, 0xad1c, 0xa971, 0xa810, 0xa6c9, 0x29b2, 0x2ce3, 0x2a5f, 0x294d, 0x250d, 0x9cab, 0x2e88, 0xaa8a, 0x2aed, 0xa7cf, 0x9b28, 0xa0b0, 0x2bb9, 0xae54, 0x9fc3, 0x2e12, 0xa481, 0xaa69, 0x2847, 0x291d, 0x241c, 0xa412, 0xaa41, 0xadff, 0x2b98, 0xabfd, 0xa8f6, 0x2a44, 0xa8a7, 0x26e0, 0x2428, 0x2d90, 0xaa5d, 0xa78c, 0xa853, 0xac39, 0x9c3a, 0x9ae1, 0x2439, 0xacef, 0x221d, 0xac65, 0xa42d, 0xad56, 0xab18, 0x2863, 0x252b, 0x24d8, 0xa983, 0x2d73, 0x2cbb, 0x2759, 0x252d, 0x2c66, 0x2861, 0x2b74, 0xac12, 0x1c6d, 0xad57, 0xb03a, 0x2508, 0x2c6f, 0xae03, 0xac1f, 0xa83a, 0xace4, 0xab90, 0xac09, 0x25ca, 0x2942, 0xa277, 0x1bd4, 0xaeac, 0x2d5c, 0xa8ec, 0xa943, 0xa689, 0x28ff, 0xa02d, 0xac3d, 0xa888, 0x24a6, 0xacab, 0xad2a, 0x2af2, 0xa8ed, 0xad3e, 0xaa44, 0x2f8c, 0xae07, 0xa348, 0xa5f5, 0x2c2a, 0x2a3d, 0x2d0c, 0xaa9b, 0xac55, 0x2c23, 0xaf0c, 0xaee3, 0xa8f2, 0xacda, 0xa57a, 0xa685, 0xad3a, 0xa23b, 0xa51f, 0x1fe0, 0xaefb, 0x21d4, 0xa9db, 0xaf9a, 0xa701, 0xa84b, 0xabbe, 0x2094, 0x2863, 0x2b83, 0x9383, 0x277a, 0x2869, 0x2d16, 0x1d04, 0xaef8, 0x06db, 0xb033, 0xa699, 0xaaa1, 0xac3f, 0xa77d, 0xac8c, 0xa542, 0x269f, 0x2c7f, 0x2cf6, 0xab8f, 0x2f97, 0x2f20, 0x281b, 0x2c6b, 0xaa56, 0x2ef8, 0x2cc4, 0x303a, 0xa981, 0x2d5e, 0x19eb, 0x2dcb, 0x2b27, 0xa6ec, 0x2d7d, 0xa4b0, 0xa94c, 0x2d3c, 0x2dd0, 0x2a2f, 0x2c6c, 0x2685, 0x238f, 0x2f3e, 0x282e, 0x2d2a, 0x291a, 0x2b2a, 0x2e63, 0x2348, 0xa153, 0x1e2c, 0xa9ad, 0x2819, 0x2937, 0x2f13, 0x2f72, 0x2db9, 0x2c87, 0x29af, 0x2d4b, 0xa5b5, 0x2202, 0x2db5, 0xa187, 0x2c51, 0x2a9e, 0x2f74, 0x2f8c, 0x299d, 0x28f8, 0x2ce6, 0x282a, 0xacb5, 0x9403, 0x26f2, 0x2b49, 0xa87a, 0x9cc3, 0x2ca8, 0x2864, 0x1ed4, 0xacf0, 0xa838, 0xa8b1, 0xa69e, 0xa108, 0xa490, 0xac78, 0x2ee3, 0xaddb, 0xad7d, 0xa7ff, 0xa90e, 0x2591, 0x2bf5, 0x2236, 0xa8f1, 0x23ec, 0xa83a, 0x9c63, 0x2454, 0xaa1e, 0xafcb, 0x2c4f, 0x2f87, 0xaf44, 0x2e34, 0xa956, 0xae50, 0x2982, 0xa451, 0xad94, 0x2ccc, 0xaa83, 0xaebc, 0xa8da, 0x2f20, 0xaa6f, 0xa75b, 0x2648, 0xaf31, 0xa900, 0x2ddd, 0xa676, 0xaa59, 0xa881, 0x23cc, 0xaac6, 0x2d1b, 0xacc3, 0x29b7, 0x2997, 0xaf61, 0x2fbd, 0x2b28, 0xa3e7, 0xab51, 0x278f, 0xab51, 0x2d2d, 0xad9e, 0xad9d, 0x2e4a, 0x2889, 0xab76, 0x2681, 0x2940, 0xac30, 0xad5b, 0xa686, 0xad4a, 0xa9e2, 0x2cee, 0xae9b, 0x2a5e, 0xac5f, 0xa9e5, 0x26db, 0x218b, 0x2931, 0xa086, 0xa128, 0xa6c4, 0x1fbc, 0x2ecb, 0x9e73, 0x214a, 0x2c44, 0x23b6, 0xaeef, 0xab3e, 0xade0, 0xaae7, 0xa998, 0x19af, 0xa7f2, 0x93ea, 0xa7ac, 0xac0a, 0xa4e0, 0x2854, 0x2875, 0x2437, 0x2687, 0xacb2, 0x2b79, 0x298b, 0xaf96, 0x2d2d, 0x292e, 0x2a52, 0x2f90, 0xa80e, 0xae1d, 0x2fa5, 0xac0d, 0xab25, 0x1e51, 0xad33};
+static const float B1[] = {0.05879675f, -0.05043326f, -0.05714106f, 0.09716392f, 0.09747313f, 0.00008669f, -0.06591042f, -0.02593021f, -0.05861853f, -0.02430011f, 0.00078099f, 0.09141663f, -0.04319803f, -0.02881214f, -0.05528006f, 0.13071758f, 0.04950417f, 0.05737089f, -0.01853663f, 0.02314547f, 0.12013389f, -0.05074783f, 0.10959579f, 0.12302750f, 0.05810802f, 0.04872769f, 0.02188883f, -0.04470443f, -0.07121643f, 0.09541170f, -0.08714893f, -0.02662534f, -0.02894311f, 0.01446634f, 0.10707061f, -0.02085830f, 0.04188608f, 0.09940962f, 0.00065488f, -0.00247892f, 0.06662137f, -0.02130231f, 0.10494456f, 0.02521390f, 0.04802166f, 0.05312110f, 0.01323412f, -0.04136457f, 0.10988978f, -0.07838802f, 0.08024766f, -0.05516325f, 0.08147823f, 0.00869737f, 0.06637742f, -0.03096633f, 0.09399553f, -0.04916782f, -0.02083011f, -0.05565026f, 0.00911589f, 0.10325526f, 0.00900455f, -0.00576980f, -0.01827599f, 0.00057108f, 0.01346283f, -0.00977691f, -0.05812549f, 0.10684232f, 0.01499490f, 0.04019235f, -0.00973311f, 0.00902676f, 0.07062522f, 0.10031275f, -0.01178760f, 0.04897366f, 0.12243881f, -0.02305552f, 0.02539202f, -0.01483035f, -0.05856549f, 0.05343555f, 0.03942043f, 0.07907319f, 0.06386770f, 0.01320584f, 0.08316492f, 0.01236761f, 0.10688645f, 0.04235951f, -0.02100838f, -0.02690366f, 0.02288309f, -0.04543632f, 0.12891121f, 0.01311031f, 0.10185256f, 0.04106678f, -0.08886836f, -0.06000289f, -0.00652729f, 0.04198373f, -0.02627790f, 0.10673771f, -0.00787217f, 0.03769312f, -0.01048354f, 0.09681018f, 0.09083967f, -0.00055616f, -0.02076463f, 0.03363147f, -0.05004580f, 0.06985527f, -0.00917573f, 0.12207568f, -0.05307585f, -0.08756275f, -0.00229447f, -0.01642810f, 0.03571753f, 0.00558015f, 0.01555770f, 0.02299020f, 0.09331144f, 0.00016947f};
+static const uint16_t W2[] = {0x3011, 0x2cc7, 0x28e7, 0x2bab, 0xa926, 0x2cdf, 0xacbf, 0x29a5, 0x2c22, 0x2d50, 0x2e7b, 0xaf01, 0xae5e, 0xadbd, 0x2c04, 0xa81a, 0x29fb, 0xaeac, 0xadf6, 0x27ae, 0xa8fb, 0x2867, 0x2c19, 0xad14, 0x29d8, 0x2917, 0xad45, 0x2fa6, 0xab3f, 0x29c1, 0xa8ea, 0x2f6c, 0xa7af, 0xae30, 0xae2d, 0x1096, 0x1032, 0x2b32, 0xad68, 0x2b5f, 0xac99, 0x28a0, 0xa89b, 0xac26, 0x8f5f, 0x2cf4, 0xa860, 0xaa83, 0x2f91, 0x28be, 0x27db, 0xa9e3, 0x2123, 0x28db, 0x2dad, 0x1c3f, 0xaaba, 0x2a55, 0xab03, 0xa053, 0xae1e, 0x2adf, 0xa402, 0x2903, 0x2c02, 0xab6f, 0xa8e7, 0x2662, 0xa7f1, 0x28fc, 0x2e7e, 0x2d25, 0xad86, 0xada2, 0xa041, 0x2f7e, 0xacba, 0x2d7a, 0x9d09, 0xade6, 0x2b96, 0xab31, 0xae2d, 0x2d97, 0x2fc1, 0x28ff, 0x2e39, 0xa988, 0x2ad3, 0xab9e, 0x1fa4, 0x2d0c, 0x2bcd, 0xa033, 0xaaa8, 0xa757, 0x2461, 0xaf01, 0xad5c, 0x2995, 0x2d30, 0xad06, 0x2cb7, 0x27d3, 0x2c8b, 0x2769, 0x2e2f, 0x271c, 0xa894, 0xa965, 0x2e81, 0x2ab5, 0x9ff8, 0xa976, 0x27a2, 0x2d7a, 0x2cb7, 0x9fc7, 0xaafd, 0x2844, 0xab72, 0xa96e, 0x2b3f, 0xa5ab, 0xa08a, 0xa38f, 0x28cc, 0xac60, 0xa367, 0xae86, 0xa4a5, 0x2ab0, 0xacf6, 0xae7b, 0xa9ef, 0xae2c, 0x2154, 0xac71, 0x26bf, 0x214e, 0xaccf, 0x2c76, 0xad9f, 0x257b, 0xa399, 0xad05, 0xac4e, 0xacf9, 0xa4fb, 0xabdd, 0x292f, 0xac8e, 0xace2, 0xa554, 0x255c, 0x2075, 0x95b3, 0x1cc1, 0x2269, 0x2962, 0xae10, 0xa4ff, 0xaac4, 0x2a37, 0x2c44, 0xa8f7, 0x286e, 0x1dcc, 0x28ed, 0x264a, 0xadce, 0xae58, 0xaaff, 0xa528, 0xa3b8, 0xa82c, 0x2a80, 0xac71, 0x2b93, 0xa667, 0xadfd, 0xadaa, 0x1db3, 0xa626, 0xad41, 0xad2b, 0xa5bb, 0x2894, 0x2387, 0xa92f, 0xadab, 0xa0c3, 0x2c7c, 0xad57, 0x1677, 0x2920, 0xac69, 0xae35, 0x2724, 0x25de, 0x2978, 0x26ef, 0xa2f2, 0xa54a, 0x29ac, 0xaaf1, 0x2700, 0xad96, 0xa8cb, 0xae31, 0xac28, 0xaa4d, 0xac15, 0xa736, 0x9c2e, 0xab48, 0xad06, 0xad08, 0xaafb, 0xa471, 0xabdc, 0x2a55, 0xa7f4, 0x2aa7, 0xa3ff, 0x20da, 0xa661, 0xada1, 0x2ba2, 0x2a23, 0xa8d4, 0xad63, 0xac33, 0x293b, 0x2b6a, 0xa9fc, 0xa9fb, 0x2b9a, 0xa966, 0xace4, 0x2a65, 0xa5a0, 0xa992, 0xacb3, 0xa45e, 0x2c51, 0xae59, 0xad16, 0xad41, 0x9fe3, 0xae4a, 0xa934, 0x2490, 0x2725, 0x2995, 0x290e, 0xa8f2, 0x2cdc, 0xb003, 0x2021, 0x9e5a, 0x2c16, 0xaf5f, 0x2d3c, 0xa7e1, 0xa195, 0xa0b3, 0x2865, 0xab58, 0xa981, 0x25e8, 0x2a04, 0xae8d, 0x2ee9, 0xadb5, 0x272a, 0x2c29, 0x29db, 0xacca, 0xa909, 0x21d2, 0x1e4f, 0xadff, 0x2ad4, 0xadec, 0xac3d, 0x1ca1, 0x2ac1, 0xa67f, 0x2ec5, 0xa7fc, 0xa185, 0xadf0, 0xad20, 0x2e5c, 0xaa3c, 0xa43a, 0xa74e, 0xac41, 0x2c0c, 0x26d9, 0xac62, 0x21b8, 0xaac5, 0xae51, 0x1de7, 0x2795, 0xad6b, 0x2aa6, 0xac3f, 0xa8b2, 0xa415, 0x2d38, 0x28d1, 0x291b, 0xaf02, 0x2d36, 0xa69e, 0xac27, 0xa611, 0x2a3d, 0x2c11, 0x2cb9, 0x9f99, 0xa666, 0x2625, 0x175b, 0x28ec, 0x2d87, 0x30a3, 0x23aa, 0xa868, 0xa732, 0x2bfa, 0x1c89, 0xab99, 0x2718, 0xa951, 0x22e6, 0xaab2, 0x2766, 0x2679, 0xa8b9, 0xa8b4, 0xaca3, 0x9ce9, 0xa3af, 0xa7bd, 0x249e, 0xa49f, 0x306b, 0x2c9c, 0x2c89, 0x2de3, 0xaa16, 0xa826, 0x2995, 0x2770, 0xacfe, 0x244b, 0xacdb, 0xa6d3, 0x2a39, 0xa8f3, 0x28d6, 0x2875, 0x2986, 0x2f65, 0xadae, 0x2995, 0x8e77, 0x2a61, 0x2be1, 0x290c, 0xa8b4, 0x25cf, 0x27dd, 0x274e, 0x2411, 0xae16, 0x2f2b, 0xad80, 0xa75d, 0xa9e4, 0x2d99, 0x19e7, 0xadc9, 0xa7aa, 0x28e7, 0x2a0d, 0x2dc7, 0x2db8, 0x2daf, 0xaccd, 0x156d, 0x20c8, 0xa9db, 0x2c53, 0xa730, 0xaa48, 0x1b7d, 0x1920, 0x2af4, 0x283d, 0x2372, 0x9dd4, 0xa831, 0x9c2a, 0x2867, 0x2de9, 0xa5ca, 0x2d12, 0x2eb0, 0xadce, 0x1d35, 0x2d48, 0x267c, 0xab17, 0xa9b1, 0xaa8d, 0x2a08, 0x27f3, 0xac91, 0x2a83, 0xae7d, 0xabf3, 0xacd8, 0x2217, 0x2f1e, 0x2100, 0x2c9c, 0x2db0, 0x2c96, 0x1cd5, 0x2caa, 0xac79, 0xa89b, 0xa53f, 0x28e5, 0x2f86, 0xa7b6, 0x2ce1, 0x2a36, 0x2db7, 0xae58, 0xad08, 0x2e2d, 0x2d96, 0xa4d6, 0xae44, 0xad93, 0xad06, 0x2e97, 0x28a6, 0xa939, 0x2c99, 0xad50, 0xa66d, 0x2445, 0x2cda, 0xa91d, 0x2f12, 0x244e, 0x2c40, 0x28c6, 0xa49e, 0xa591, 0x2e15, 0x2dca, 0x2bb5, 0x2ddc, 0xa04f, 0xa247, 0x21f0, 0x23f4, 0xac10, 0xad49, 0xac13, 0x2c06, 0x2f26, 0xa760, 0x2ac6, 0x2a84, 0x2878, 0x2a7e, 0xaa75, 0x268f, 0x29d6, 0xab78, 0xa849, 0x2f14, 0x2afd, 0x2e42, 0x2eec, 0x29f6, 0xac99, 0x2ceb, 0x9f87, 0xa537, 0xa40d, 0x2f28, 0x2ad3, 0x2c14, 0x22ba, 0x2d8b, 0x2db7, 0xab25, 0xa4a4, 0xac31, 0x2909, 0x2be5, 0x290a, 0x282e, 0xabdc, 0x2ac8, 0x2aee, 0x28e5, 0x9ef9, 0xab8b, 0x2d70, 0xa254, 0xa0be, 0x2b95, 0x270c, 0xaa0f, 0xa8a1, 0xae42, 0x2865, 0x2d2e, 0x81c2, 0xa8dd, 0xaa14, 0xa75d, 0xa6c3, 0x2d24, 0xaf3e, 0x9b2e, 0x270d, 0xae1c, 0x2f79, 0xad04, 0xadef, 0xa749, 0x2f96, 0xad42, 0xa8a8, 0xae2c, 0xac93, 0x3050, 0x2bf4, 0x1cd6, 0x2717, 0xaa3e, 0x288f, 0x267b, 0xaf6d, 0x2da5, 0x154e, 0x2bda, 0xaa4f, 0x22ac, 0xa8ec, 0x2e8a, 0x2894, 0xac7d, 0xaba0, 0x9bd9, 0xa8d7, 0x2ac8, 0x2275, 0xad3f, 0x258a, 0x251c, 0xac5d, 0x2bd9, 0xa9a3, 0x2b1f, 0x1f60, 0x2792, 0xa4e0, 0x9bc8, 0x1d74, 0x2d5d, 0x2546, 0x257e, 0x2997, 0x2bdd, 0x9dbf, 0x1a81, 0xa855, 0xa8ad, 0xa930, 0x29d8, 0xa16a, 0xa858, 0x1fce, 0xa984, 0x27eb, 0xa644, 0x28e1, 0x27d9, 0x2a97, 0xa6e7, 0x27aa, 0xaa6b, 0xaaa5, 0xacf7, 0x2c15, 0x16ed, 0x9afc, 0xaa51, 0xaefb, 0xac54, 0xa5a5, 0x27f1, 0xa789, 0x2968, 0x29f8, 0x9e98, 0xa92a, 0xa2dd, 0x2d19, 0x8f95, 0xa8dd, 0xa1c1, 0x2c85, 0xa67f, 0x2d20, 0x9f96, 0x2f54, 0xa5be, 0xad4f, 0x2b38, 0xa530, 0xa73f, 0xad68, 0x1f76, 0xa46e, 0x2a36, 0x2ce1, 0xaaea, 0x2f1c, 0xacf9, 0x2f91, 0x2a6b, 0x1c4e, 0xaf32, 0x2dfa, 0xa85f, 0x9e00, 0x0d39, 0x29d0, 0xb083, 0xa55f, 0x25d7, 0x2b7a, 0xa4fc, 0xa523, 0xada2, 0xa575, 0x309b, 0x2cd0, 0x28b3, 0x28bb, 0xa696, 0x2a3a, 0x2a50, 0xacef, 0x2e54, 0xa02e, 0xa05e, 0x2dd1, 0x97e1, 0x2e5a, 0xa9a5, 0xac42, 0xaf3f, 0x9f7f, 0x300d, 0xab94, 0x28dd, 0x2e86, 0xa322, 0x301e, 0x1caf, 0x2b6d, 0x2c83, 0xac6f, 0xac7d, 0xad06, 0x2c07, 0xafcd, 0x8bc2, 0x27e7, 0x29f8, 0x2c41, 0x21ff, 0x2d20, 0xaab3, 0xa565, 0x2dcb, 0xaeac, 0x2cc2, 0xa806, 0x9f5c, 0x2cd5, 0x1cb9, 0xa4ba, 0x29e3, 0x28b2, 0xa76a, 0x2957, 0xa81f, 0x2f01, 0x2a82, 0x2e90, 0x2b31, 0x2e0c, 0x2cc1, 0x20ce, 0xaca4, 0xb0a9, 0x2587, 0xa12c, 0xacb4, 0x28be, 0x227a, 0xa822, 0x2916, 0xa7f4, 0x2485, 0xae91, 0xa1b2, 0xaa1e, 0x2db8, 0x2d40, 0x27f0, 0x265a, 0x1ea5, 0x20f6, 0xa687, 0x24cb, 0x2852, 0xabed, 0xac22, 0x0fb6, 0xa991, 0x2a5c, 0x2b57, 0x9efa, 0xaa2d, 0x2ee7, 0xab18, 0xaa47, 0xac27, 0xb047, 0xa5c6, 0xa9d8, 0x2427, 0x27c8, 0x2ff0, 0x2875, 0xa624, 0x1ee1, 0x2704, 0xa8d1, 0x2c86, 0x2842, 0x25ea, 0x2bf6, 0x29c3, 0x2245, 0x2f04, 0x2303, 0x244e, 0x2357, 0x2af2, 0x2067, 0x2a50, 0x239a, 0x26e9, 0xa8e2, 0x276d, 0x2c43, 0x9a1e, 0x2e04, 0x2c18, 0xaddc, 0x2edc, 0x2f4e, 0x2b1c, 0x2ddf, 0x2c21, 0x8943, 0xa900, 0x2b4e, 0xa930, 0x2574, 0x2a51, 0xa47d, 0x2945, 0x2c5e, 0x2942, 0x26dc, 0x2558, 0x0d9f, 0x2c48, 0x2078, 0x181d, 0x2a4c, 0x26f5, 0xa455, 0x2c12, 0x2900, 0x2d65, 0xac17, 0x28bc, 0x9cfb, 0xaa3b, 0xa06a, 0xa77d, 0x2c31, 0xa80d, 0xad57, 0x9b58, 0x2ead, 0xab1e, 0x2d3c, 0x2efe, 0xa8ef, 0xab3e, 0x2c3d, 0x2d41, 0xa18b, 0x2c3b, 0xa88a, 0xa4be, 0x27ff, 0x2044, 0x293b, 0xa529, 0x2c7a, 0x2439, 0x2e66, 0xaa36, 0xacdc, 0x25cc, 0x2d70, 0x2e76, 0x279c, 0x2c6e, 0xa8ec, 0x187e, 0xac66, 0x2a5c, 0x2d8f, 0xac3d, 0x2e98, 0x2ee5, 0xa8c6, 0x2bc1, 0x2fd5, 0x294b, 0x29cc, 0x2b01, 0x2f40, 0xadcc, 0x2945, 0x2449, 0x2e7b, 0xaac5, 0x2f40, 0x24e7, 0xa687, 0xa95a, 0xacfc, 0x29fa, 0xad52, 0xad32, 0xa6be, 0x2808, 0xaa30, 0x2380, 0x25ac, 0x9ec3, 0xab71, 0x2d9f, 0x9b27, 0x2986, 0x2d4a, 0x294c, 0x2d05, 0x27fb, 0x2ce8, 0xa5e6, 0xa112, 0xa77f, 0xa093, 0x2e30, 0x2454, 0x2512, 0x27d4, 0x2cd4, 0x2a3c, 0xa760, 0x2abe, 0x29c4, 0x28b9, 0x2e43, 0x1e0f, 0xaaa4, 0xafee, 0x2885, 0xa988, 0x2d58, 0x218f, 0x29b9, 0x28b4, 0xacec, 0xb04e, 0x2a28, 0x1eb1, 0xaa74, 0xaa36, 0x2c95, 0x1c38, 0xac19, 0xac8d, 0x2ffe, 0x2c2f, 0xa566, 0x2be1, 0x3037, 0x2b88, 0xaf8a, 0xa916, 0xa931, 0x2958, 0x2a00, 0x9dbc, 0x2a29, 0x9ed5, 0xad6c, 0x2072, 0x1c0b, 0x2dc1, 0xaa6a, 0x2698, 0x2c28, 0x2c6a, 0xa945, 0xac11, 0x20e6, 0xa633, 0x2ca0, 0xad02, 0xaab8, 0x1dc6, 0xa766, 0xadb8, 0xa7e7, 0xa94a, 0xabb7, 0xaec8, 0x2914, 0xb13f, 0x27bf, 0x283a, 0x1fba, 0xa924, 0xa4a2, 0xad39, 0xb09b, 0x2440, 0x2b49, 0xac62, 0xa8ed, 0x24f7, 0xaec7, 0x20e4, 0x2793, 0x2c87, 0xa89e, 0xad30, 0xac41, 0x2e53, 0xaee5, 0x2081, 0xa8b2, 0x2dcd, 0x977d, 0x2d94, 0x2d8b, 0x24d2, 0xac61, 0xa45b, 0xa830, 0x23a1, 0xaebf, 0x2e75, 0x2d72, 0xa10b, 0x2be1, 0x256d, 0xa857, 0xae9c, 0xad54, 0x2b41, 0xa9be, 0xa4db, 0x2797, 0xade9, 0xafff, 0x2731, 0x2e06, 0x2cd7, 0x268d, 0x27b1, 0x1ec4, 0xaab7, 0x1dac, 0x2d34, 0x2ed3, 0xab3f, 0x2c23, 0xaf32, 0x2e7e, 0xae6b, 0x1f07, 0x2e79, 0x300d, 0xacca, 0x1cdc, 0x2fdb, 0xa403, 0xab83, 0x2dc2, 0x2ff4, 0x1c6c, 0x2d62, 0x2ce6, 0x2574, 0xaa83, 0xabb5, 0x1c0e, 0xac45, 0x2ee6, 0x9e6d, 0x2da9, 0x2d2a, 0x27d1, 0x26e2, 0xab4e, 0x3018, 0x21af, 0xa6ad, 0x2817, 0xac5f, 0xaa6a, 0xa4a9, 0xa173, 0x2c87, 0xa259, 0x2bc2, 0x2b2c, 0x2bc0, 0x2d25, 0xaa5f, 0x2dc4, 0x9d87, 0x2c2c, 0x9879, 0x25e8, 0x2719, 0x24c8, 0x2cc1, 0xa94b, 0xa3a2, 0x2d17, 0xad1d, 0x27ff, 0x2c62, 0x2c51, 0x2db9, 0x1670, 0x2657, 0xab32, 0xa909, 0xa7db, 0x1eca, 0x23d9, 0x2d83, 0x2355, 0x99c9, 0x244f, 0xaa9d, 0x2496, 0x1d79, 0x1a05, 0xad59, 0xac6a, 0xac46, 0xa867, 0xaa35, 0x2c46, 0x9ff2, 0xb003, 0x2c61, 0x28b4, 0xa983, 0xab8b, 0x2f74, 0x9bac, 0x2d27, 0xa480, 0x2b74, 0x1ecd, 0x2de2, 0xa93f, 0xac5c, 0x22f1, 0x2bf5, 0xa576, 0xa5cf, 0xa92f, 0xab69, 0x2d4f, 0x2080, 0x2c63, 0x292b, 0xa7a7, 0x29a9, 0xac02, 0xa5a2, 0x2c9f, 0x2b36, 0x2d87, 0x298c, 0x2da8, 0x2f05, 0x26b2, 0x9843, 0x2902, 0x2c88, 0x9f65, 0x2def, 0x2e6b, 0x2c9a, 0xac8a, 0x2dd9, 0x232c, 0x2ccf, 0x23cc, 0x9d44, 0xa96e, 0xa978, 0x1ccb, 0x2d6e, 0x2f55, 0xa479, 0xaac4, 0xa972, 0x2e3f, 0x2f4b, 0xa89d, 0xa7d3, 0x2860, 0x2f27, 0x2984, 0xa8c6, 0x9dc1, 0xa74d, 0x2fd6, 0x2b3c, 0x2631, 0x9a19, 0xa511, 0xa6bf, 0x2ceb, 0x28a1, 0x1fc7, 0x2c70, 0x200e, 0xa4d3, 0x2a2c, 0x2677, 0x2a94, 0x2d3a, 0x28a9, 0x2a8d, 0x2ab4, 0x2d19, 0x2c6b, 0x2f73, 0x2faa, 0xa812, 0xacc3, 0xa936, 0xa426, 0x2b0a, 0x2c84, 0x1e18, 0xa4d2, 0x9c6f, 0x2fd9, 0x2b1f, 0x2f0a, 0x97b6, 0xa49a, 0xa60b, 0x2e3e, 0xa1c5, 0x2a03, 0x2add, 0xacb7, 0x26b8, 0x2295, 0x2b6e, 0x2826, 0x2e79, 0x2d95, 0xa5c0, 0x2dfd, 0xaae3, 0x2fa2, 0x2af9, 0xa77e, 0x9843, 0xa551, 0xa847, 0x279a, 0x2035, 0x25a9, 0x19dc, 0xa097, 0xa257, 0x2b2d, 0xa68b, 0xa89a, 0x275e, 0x25f0, 0x2424, 0x2c9b, 0x9c79, 0xaa3d, 0x2bd9, 0x2f6c, 0x2ac3, 0x2879, 0xaa0a, 0xa894, 0xa546, 0xa971, 0x2a44, 0xa80a, 0x2f61, 0x2d3d, 0x18e8, 0xac9c, 0xac46, 0x2c07, 0xadff, 0xaae5, 0x2c28, 0x29c3, 0xac99, 0x2d9d, 0x2f55, 0x294e, 0xa425, 0x9cf1, 0xa5ce, 0x2c7f, 0xa943, 0x9850, 0x26bf, 0xa7d5, 0x2905, 0x2476, 0x2a72, 0x21fa, 0x27ba, 0x2ba8, 0x2924, 0x2c71, 0xa728, 0x8bb2, 0x2b84, 0xa077, 0x2f15, 0x2d9c, 0x2ca3, 0x2e45, 0x28e1, 0xa53a, 0x2e34, 0xad65, 0x2dcd, 0x2d2d, 0x2b08, 0x99a6, 0x2f54, 0x2239, 0x2e3c, 0xa61b, 0xacfc, 0x28dd, 0x242e, 0x272e, 0x2d90, 0x2ebf, 0xa71c, 0x29fc, 0x2f92, 0x2fd5, 0x2874, 0x2e67, 0xa25e, 0xa679, 0xa930, 0x98b1, 0x2e33, 0x2bb5, 0xaa7b, 0x21f2, 0x90e6, 0xa750, 0x29f0, 0xa461, 0x2e92, 0x28ef, 0x29e5, 0x2eae, 0xa6bc, 0x28aa, 0xa9c7, 0x2a64, 0x2ceb, 0xa24f, 0x950c, 0x99e7, 0xaa1c, 0x90dd, 0x2363, 0x2f71, 0x2588, 0x253f, 0xa707, 0x2a56, 0xa981, 0x2bfc, 0xaa6a, 0x2f7e, 0x2f35, 0xa9c0, 0xa95c, 0xa6fb, 0xa54d, 0xae40, 0xa683, 0x2c3a, 0x2e76, 0x974f, 0xa98a, 0x1e6b, 0xa141, 0xa6a1, 0x9a35, 0x2b44, 0x9dc8, 0x2e02, 0x2d05, 0x2ec3, 0x1a2d, 0xa77d, 0x1c61, 0xa3f6, 0xa54b, 0xabe4, 0x200d, 0x2828, 0x2853, 0xa949, 0x1ebe, 0x2d91, 0xacae, 0x239a, 0xa5f6, 0xa970, 0x2640, 0xab12, 0x2f42, 0xab74, 0x2e0a, 0xac52, 0x2d92, 0xa218, 0xa4a3, 0xa90c, 0x2835, 0xacb1, 0xa8f1, 0x2c96, 0xa9d0, 0x2341, 0xa474, 0x2d5f, 0xaa2c, 0xa07b, 0xaf0e, 0xa63f, 0xa9d8, 0xa0c6, 0x2e00, 0x2d5f, 0x1d03, 0x2e14, 0xac63, 0x9d2a, 0xa4e5, 0x2381, 0x1d22, 0xa802, 0x2b31, 0x2cfd, 0xac21, 0xa4ea, 0xa71e, 0xa1f9, 0x2b9d, 0x2c86, 0xa415, 0x2efc, 0x2ad6, 0x2865, 0x2f46, 0xa090, 0x2eb6, 0xa58d, 0x9f35, 0x3016, 0xaa24, 0x286b, 0x2b24, 0x3068, 0xa723, 0xa79b, 0x2e00, 0x2523, 0xa9db, 0xa9a5, 0xa69c, 0x2f1e, 0x2c4f, 0x2859, 0x2890, 0x26ad, 0xa843, 0xa620, 0x300a, 0x2cd7, 0x281c, 0x2755, 0x1cf3, 0xa85a, 0x2eed, 0xaef5, 0x2f1f, 0x2cec, 0x28c6, 0xacf4, 0xa9e7, 0x251f, 0x2d36, 0x2de0, 0x2a8b, 0x9b08, 0x953f, 0xa7b5, 0xad6f, 0x25af, 0xad86, 0x2cd6, 0xa60c, 0xb060, 0x2c01, 0x2a18, 0xa62e, 0x2fa9, 0x2cec, 0x9e3c, 0x2990, 0xa13a, 0x2b82, 0xa9d6, 0x2ec4, 0x2cb2, 0x2624, 0x2d75, 0x2abd, 0x9dff, 0x2c16, 0x1f61, 0x26df, 0xac24, 0xa838, 0xaad2, 0xa26c, 0xa963, 0x24d5, 0xa5c0, 0xa948, 0x2a1d, 0x2840, 0x2eb8, 0xaa26, 0xaad1, 0xaa34, 0x2805, 0xaa16, 0x2d87, 0x2d0e, 0x2eb1, 0x2a74, 0x298d, 0xa573, 0xace1, 0x2b82, 0xa694, 0x2e7c, 0xab9f, 0xa99d, 0xa64e, 0x2d3e, 0xac3e, 0x27a7, 0xab9d, 0xb026, 0x2659, 0xae4f, 0x2458, 0xa84b, 0xa628, 0xa877, 0xa9b2, 0x288a, 0xa936, 0xa35c, 0x20f6, 0x2d51, 0x2c0a, 0xa156, 0xae42, 0x23c0, 0x2b13, 0x2c7e, 0x2562, 0xa54c, 0x241d, 0xa073, 0x2ed5, 0xa914, 0xa75a, 0xa24b, 0xa9f6, 0x2cd4, 0xa90c, 0xa9a7, 0x246b, 0xadba, 0xa98e, 0x2cd4, 0x2ee8, 0x2eeb, 0xae2a, 0x18e1, 0x2d5e, 0x2d12, 0xaad3, 0x2c76, 0x2dc3, 0xac93, 0xad7e, 0x2e0c, 0x2cf0, 0xa2f6, 0xa3ee, 0x2bfa, 0x285b, 0x27a2, 0x2d3e, 0x2f1f, 0xabbe, 0xa567, 0x84d0, 0x2868, 0xa9f7, 0x2dde, 0xa34c, 0x2879, 0x2e6e, 0x2c0c, 0xa736, 0x2702, 0xa55a, 0x9e8e, 0xaa93, 0x27bc, 0x2d79, 0x9d7b, 0x2bc7, 0xaaab, 0x2442, 0x2ba9, 0x2c32, 0x99a2, 0x2fdf, 0x2dfe, 0xab7e, 0xa112, 0x26cb, 0x2d3e, 0x2a16, 0x2a6f, 0xa949, 0x266a, 0xae74, 0x3000, 0x26c0, 0x2e10, 0xae95, 0x2f86, 0x28ea, 0x2b56, 0x2e67, 0xa456, 0x2dec, 0x2e3a, 0xae36, 0x300c, 0x2c95, 0x2872, 0xaa51, 0xa708, 0x2f13, 0x2cd9, 0x2a82, 0x2543, 0xaca3, 0x2647, 0xab7e, 0xaf8f, 0x2764, 0x1e7b, 0x9f5b, 0xa712, 0x29c2, 0xaba7, 0xa75f, 0x2d7c, 0xac28, 0x2cd3, 0xa5d2, 0x2f1e, 0x27a2, 0x2b97, 0xa8c4, 0x300e, 0x2e4d, 0x2e77, 0xa5aa, 0xa94a, 0x2ba9, 0xaf4f, 0x2a31, 0x2efd, 0xae4d, 0x2504, 0x2d29, 0xabc0, 0x1e19, 0x2a42, 0xaa69, 0x2fec, 0x2e01, 0x285c, 0xae5f, 0x3007, 0xa6c9, 0x184b, 0x2f4e, 0xa0fd, 0x2f76, 0xa879, 0x29b5, 0xad14, 0xb062, 0x2e30, 0xab00, 0xa6c5, 0x1ca3, 0xad13, 0xa2b7, 0xac92, 0x2137, 0x2c90, 0xaa44, 0x2c95, 0xa969, 0xab64, 0xac16, 0xa63b, 0xad23, 0xaf72, 0x26e7, 0xaf2a, 0x2fb0, 0xab2d, 0xacaf, 0x2d01, 0x2bc7, 0x1dac, 0xa802, 0x2d01, 0x284e, 0xac7d, 0xa649, 0x2e6a, 0xac60, 0x2d73, 0xaa1d, 0x2b97, 0x2db2, 0x303c, 0x2cb0, 0x18d7, 0xaa50, 0x210d, 0x2d84, 0x2d2f, 0x2e8c, 0x26f8, 0x9c1a, 0xa670, 0x2aea, 0xb0a9, 0x2cf0, 0xac5a, 0x21bf, 0x27a3, 0x094a, 0x97ff, 0xac8f, 0x2ccc, 0xa4ce, 0xaa6c, 0x2d38, 0x9c66, 0x2cca, 0x2f04, 0xa5b9, 0x3030, 0x2e83, 0xa4f6, 0x2d47, 0xa936, 0x26ed, 0xa352, 0xaceb, 0x2be2, 0x2349, 0x2f0d, 0x2f34, 0x2ea0, 0x2cb3, 0x2ccb, 0xa003, 0x2bdb, 0xa644, 0xae37, 0x2cdb, 0xaa7d, 0x2e76, 0x2655, 0x2f47, 0xac4c, 0x23d7, 0xad08, 0xa234, 0x2cb8, 0xaeee, 0x2811, 0x2e06, 0x2e5a, 0xa087, 0x2a7f, 0xaa49, 0x2b81, 0x2685, 0x26e4, 0x2bef, 0x2d20, 0x2ca8, 0xa6cf, 0x1e0e, 0xac6c, 0x2aae, 0xaa6a, 0x9ce4, 0xabf3, 0xac05, 0x2e00, 0xadb6, 0x2c37, 0x2e66, 0x9734, 0x23ce, 0x207a, 0x2931, 0x2d5e, 0x2ea1, 0x27a2, 0x29b1, 0xaa8e, 0xaeee, 0xacec, 0x2583, 0x96e6, 0x2afd, 0x2a90, 0xa4d0, 0x2883, 0xa96a, 0xa17c, 0x2537, 0x281f, 0x217f, 0x9f0a, 0x0c2d, 0x2e3e, 0xa6a4, 0x250c, 0x27e7, 0x2ad5, 0xaaac, 0x261f, 0x2594, 0xa48d, 0x200b, 0x26b3, 0x2b6a, 0x2c21, 0xab46, 0x2156, 0x3012, 0xa63f, 0xad99, 0x2408, 0x2a27, 0x2b35, 0xa696, 0x9fd8, 0x2de4, 0x2fea, 0xacd9, 0xa6b4, 0x29fc, 0xac38, 0xa55f, 0x2004, 0x2d54, 0x24de, 0xab15, 0x20e2, 0x2de9, 0x2752, 0x2d1c, 0x296b, 0x229d, 0x2c60, 0x1d1b, 0x1a93, 0x20b5, 0xa3ca, 0x9ddd, 0xa4f9, 0x2786, 0xa449, 0xaba0, 0xae26, 0x2f3e, 0xa745, 0x22dd, 0x1c81, 0xa9b4, 0xaca0, 0x2b00, 0x27dc, 0x2cda, 0x2c21, 0x2a0e, 0x21f6, 0x1f9d, 0xad09, 0xa98b, 0xa8d7, 0xa4ec, 0x25b7, 0x258f, 0x2c76, 0xac03, 0x2742, 0x2f93, 0xa83e, 0x2840, 0xad6d, 0xa963, 0xae26, 0x2bba, 0x2a97, 0xa7ad, 0x2f6c, 0x2984, 0x283b, 0x2f9a, 0xa5a4, 0xaa18, 0x2a9c, 0xae34, 0xad8c, 0xa865, 0xac3d, 0x1870, 0xa693, 0x29aa, 0x2c3c, 0x1d56, 0xab34, 0xa82b, 0x27ef, 0x2364, 0xa2ad, 0x2c98, 0x2d21, 0xad20, 0x2a0b, 0x2b5b, 0x29c3, 0x2713, 0x9edb, 0x2b09, 0x8b7a, 0xaa80, 0x2b1c, 0xa59f, 0x2b5f, 0x2e1f, 0x2b05, 0x2bb3, 0x2d03, 0x2b42, 0xa61c, 0x2ef8, 0x2ded, 0x2d06, 0x2d19, 0x2659, 0xab10, 0xa166, 0xaef2, 0x2d35, 0xa492, 0xa9b6, 0x26b2, 0xac78, 0x986c, 0x2934, 0xadfa, 0xabb2, 0xa5d9, 0x2e12, 0xa9ad, 0xa95d, 0x2fee, 0x9ce6, 0x1afd, 0x2731, 0xab2f, 0xa1d1, 0x2e70, 0x2b96, 0x1452, 0xab8f, 0xabbd, 0x2965, 0x2ede, 0x28f8, 0x991b, 0x2ba8, 0xa5ff, 0x1c1f, 0xafe3, 0x23a4, 0x2c66, 0x27d2, 0xaba0, 0x99b9, 0xaf59, 0xa65a, 0x9acc, 0x2e5f, 0x26a7, 0x29a8, 0x2c46, 0x2c4b, 0xac5a, 0x2db0, 0xa46d, 0x2465, 0x22a4, 0x2b21, 0x1a20, 0x267c, 0x29c6, 0xab17, 0x24c6, 0x2e9f, 0x22a8, 0x2826, 0xa8e9, 0x2d3e, 0x177f, 0x2c7e, 0x284c, 0x2856, 0x208f, 0x2547, 0x265d, 0x2c34, 0x1daa, 0x2d5e, 0x2b9e, 0x2b69, 0xacf4, 0x3017, 0x1cd4, 0xade5, 0x1c81, 0x2933, 0x22af, 0x9f58, 0x2eff, 0x2e4a, 0x2f1c, 0x20b1, 0x2cf8, 0x1f3a, 0x11a2, 0x2e6d, 0xa469, 0x2afd, 0x247a, 0xae60, 0x2a75, 0x2d48, 0x1f28, 0xacbe, 0x2c8d, 0x2553, 0x301a, 0x2c1c, 0x217a, 0xad15, 0x2801, 0xa618, 0x2ce5, 0x2828, 0x2de9, 0x2cf7, 0xa9d5, 0xab5d, 0x2df4, 0x2a42, 0xaab0, 0xa549, 0x2db5, 0xa812, 0xa62c, 0x228f, 0xa824, 0x2f08, 0xad9b, 0x2df1, 0x2c33, 0x1de3, 0xa78e, 0x2dc3, 0x9cb2, 0x2cf9, 0x2cfc, 0xa5b2, 0xa487, 0x275b, 0xaa67, 0xab62, 0xa408, 0x2014, 0x27cf, 0xa159, 0x2c43, 0xa226, 0xa601, 0x2c85, 0x2d5b, 0xac01, 0x2cf3, 0x2707, 0x2d36, 0x2f5f, 0xad1e, 0x2cdf, 0x2df6, 0xa5aa, 0x2e71, 0x2b8d, 0xa92c, 0x2a25, 0x2ab4, 0x2d2b, 0xac54, 0x1dc1, 0x2a99, 0x2edb, 0x96f5, 0xa8f9, 0xac65, 0x229e, 0xab6d, 0x302c, 0x9aa2, 0x2f7c, 0x2bef, 0x2c41, 0xa929, 0xa71d, 0x2e1f, 0x29f8, 0xac6a, 0xabbd, 0xa63d, 0x2c24, 0x2485, 0xa98d, 0x2546, 0x28c0, 0xae0d, 0xa972, 0x2e90, 0x2b97, 0xa0e0, 0x1dad, 0xa99d, 0x2539, 0x300a, 0xabee, 0x2b26, 0x2dac, 0xa989, 0xa733, 0x283f, 0x2cba, 0xa7da, 0x212f, 0xadc3, 0xae3b, 0x2a97, 0x2a3c, 0x2df4, 0x28ff, 0x2bc2, 0x2dee, 0x2ec5, 0xae6c, 0xa4e4, 0xac58, 0x1bc1, 0x2d6e, 0xa4aa, 0xaca8, 0xaacc, 0xa867, 0x2dd0, 0x292f, 0x20ba, 0xa9b5, 0xa8d8, 0xa8fc, 0x2ab1, 0x2e56, 0xacc1, 0xa9e3, 0x2836, 0xa883, 0x1e1b, 0xad73, 0xac90, 0x2bd7, 0x2cb4, 0xac3c, 0x2a08, 0x94cc, 0xa9a4, 0x26fd, 0xa831, 0x2b0f, 0xa8cd, 0x2d25, 0x2ad5, 0x2f24, 0xac73, 0x2437, 0xa6fc, 0xa4c2, 0x2484, 0x21ef, 0xa40d, 0xa609, 0xa93d, 0x2f93, 0xa6af, 0x2e0d, 0x9cc5, 0x2e9a, 0x26e9, 0xa585, 0xa90b, 0xa9af, 0xa8dd, 0x1c4b, 0x29f8, 0x29ad, 0xa117, 0xa405, 0x2055, 0xa654, 0x2417, 0x2b1b, 0xaa82, 0xaa3c, 0x22c3, 0xad74, 0x244f, 0x2b36, 0xa15a, 0xa4b3, 0xa924, 0x96f9, 0xad69, 0x2bc6, 0x2a2e, 0x2e8c, 0x29d2, 0x2aae, 0x9692, 0xa94d, 0x2817, 0x21d2, 0xa4fc, 0x2dee, 0xa507, 0x28a0, 0xae2d, 0xa534, 0x9ec2, 0x1d0c, 0x283c, 0xa254, 0xa987, 0x3015, 0x1ba8, 0xa6f2, 0x2fc8, 0xa690, 0x1ba5, 0xa6f1, 0x2cf8, 0x2ffa, 0x2c49, 0x2712, 0xa7d0, 0x2d0a, 0x2ef4, 0x2ab4, 0x2e7c, 0x2d51, 0xaa42, 0xa8b6, 0x2934, 0x29f5, 0x9df1, 0x2f95, 0xab77, 0xaf74, 0xab5e, 0xa00d, 0x29b5, 0xab88, 0xa9e6, 0x243a, 0x2f5f, 0x2cea, 0x2ec2, 0xac6e, 0xa892, 0x2955, 0xa6c8, 0xa442, 0x2722, 0xadc7, 0xa51e, 0x22e5, 0x2892, 0xa4c9, 0x2cda, 0xaded, 0x2b7d, 0x2cc6, 0xa811, 0xac16, 0x298f, 0x2a90, 0x2e0d, 0x1ce3, 0xa24a, 0xa08f, 0x2aea, 0x2218, 0xa966, 0x2c91, 0x28ba, 0xa0a7, 0x2ef9, 0xa55a, 0x2cf0, 0x2cf3, 0x25b9, 0xa472, 0xa9bf, 0x2da6, 0x2e28, 0x24ff, 0xa566, 0x2957, 0x2544, 0x2dff, 0x2887, 0x2e4b, 0xac67, 0x1d1f, 0xae2c, 0xacb8, 0xaa91, 0x9ec7, 0x296e, 0xab38, 0x2e26, 0xa92f, 0x9d18, 0xa046, 0x2a50, 0x9ed8, 0x2893, 0xaaed, 0xadd8, 0xab63, 0x252b, 0x21b0, 0xaa0f, 0xaec8, 0x2b4b, 0xaebe, 0x2223, 0x2f07, 0xae79, 0x220e, 0x2c1b, 0x291e, 0x2889, 0x2940, 0x29c4, 0x9fa6, 0xa89e, 0x22b1, 0xacf8, 0x9e04, 0x2e45, 0xac0d, 0x2b1d, 0xaab5, 0x25e1, 0x2c6a, 0xa115, 0xad1a, 0x9bf8, 0xac26, 0xac9d, 0x2d31, 0xa9f0, 0x28bb, 0x2b75, 0xa76b, 0xad97, 0x1f5f, 0x2e54, 0x2dea, 0xa7e3, 0x2d18, 0x2924, 0x2ea7, 0x2f43, 0x2ab4, 0x2e65, 0xa8de, 0xad96, 0xad10, 0x2e8b, 0xa422, 0x236f, 0xa684, 0xac00, 0xac09, 0x257d, 0x9960, 0x2431, 0xab62, 0x2f12, 0x1dbe, 0x28ca, 0xafc5, 0xa534, 0xa630, 0xaee7, 0xace5, 0x2ba7, 0xb026, 0xaaa5, 0x260b, 0x2760, 0xa885, 0x2ed9, 0xa86d, 0x2d7a, 0x2ea2, 0xa54e, 0xad06, 0x2c80, 0xa5ef, 0x28e4, 0x27b8, 0x286c, 0x2ef2, 0x29b9, 0xaec5, 0xacde, 0xaf7e, 0xa150, 0xa68c, 0xaeea, 0xa708, 0x2bfd, 0x2f4e, 0x2b52, 0x2f79, 0x2d76, 0x9b88, 0xa9a9, 0x28df, 0x2923, 0x2a8b, 0xa7ec, 0x2493, 0xa1e1, 0x24a7, 0xa96e, 0x2ae4, 0xab64, 0xabb7, 0x214a, 0x2cc3, 0x2cd0, 0x2ab3, 0x2ca8, 0x2779, 0x2858, 0xa99f, 0x2c8c, 0xa62b, 0x2e36, 0x26b4, 0xa4de, 0x2dca, 0xa692, 0x2e36, 0x20b9, 0xa50c, 0x2f1b, 0x2c01, 0x2f02, 0x94c4, 0x29fb, 0x2181, 0xa2a4, 0x284e, 0xaccf, 0x2c4e, 0x27c4, 0xab26, 0x992c, 0x2dcb, 0x2c5c, 0xacce, 0x186b, 0x2e0d, 0xb07f, 0x2d71, 0x2d31, 0x2f5f, 0x2bce, 0x2db9, 0x177d, 0x287e, 0x2ec7, 0x2993, 0x2843, 0xaada, 0xabeb, 0xb02a, 0xa8d4, 0x2b0d, 0xa640, 0x2d2c, 0xad37, 0xa5b4, 0x29ab, 0xad57, 0xad34, 0x9d1b, 0x2233, 0x2143, 0x0ef8, 0xa94b, 0xad49, 0x2f58, 0xad18, 0x2d80, 0x254c, 0x9c7a, 0xa8e7, 0x277a, 0x2c89, 0x2da1, 0x2ab2, 0xac9a, 0x2799, 0xa7da, 0x2e48, 0xacf7, 0x2a52, 0xad45, 0x25bc, 0x2ed6, 0x2e30, 0xac13, 0xaf5b, 0xa7f1, 0x2d72, 0x2b3e, 0xaca9, 0xab5d, 0x2d9e, 0x2c1f, 0x2c30, 0x2f62, 0x281b, 0xa647, 0x2b35, 0x9f9c, 0x2fd8, 0xabc9, 0x9edb, 0x1ef0, 0x2f6a, 0x20dd, 0x2aaf, 0xa5a3, 0xa875, 0x2ed0, 0x2c2b, 0x285d, 0x9c6e, 0x2c11, 0x24c2, 0x1630, 0xa8a1, 0xa492, 0x2e2c, 0x302b, 0x987e, 0xaa71, 0xad08, 0xa44b, 0xa3d1, 0x1e68, 0xad33, 0xac4b, 0xae10, 0x285e, 0xad1a, 0x2505, 0xac59, 0x2eef, 0xaa71, 0x26ee, 0x2ca7, 0x2902, 0x28f7, 0x217f, 0x90c5, 0xaa6e, 0x9e62, 0x25d5, 0xac88, 0xa6d8, 0x2ae8, 0x2b9f, 0x2fd8, 0xab6e, 0xa5db, 0x2f6c, 0xafcc, 0xac32, 0x2294, 0x2af4, 0x296d, 0x2f84, 0x95b1, 0x9b5d, 0xa9bb, 0x2d80, 0xa77f, 0xa68c, 0x287e, 0x1a51, 0x24c7, 0xa41d, 0xa6b8, 0x2fc1, 0xa474, 0xa4cf, 0xad17, 0xa5af, 0xa0d7, 0x2c26, 0x2831, 0xa952, 0x2a38, 0xaaaf, 0xa3b8, 0x2751, 0x2d33, 0x2e4f, 0xab10, 0x2bf7, 0x27ad, 0x2e34, 0xa71b, 0xac27, 0x272a, 0xa646, 0x2cd6, 0xac5a, 0x2fb0, 0x2506, 0xa971, 0xa43b, 0xaed7, 0xa37c, 0x25e5, 0xae05, 0xad94, 0x2b3a, 0x296d, 0xad12, 0x253f, 0x2ceb, 0x2aca, 0x2678, 0xa9c1, 0x2b28, 0x297b, 0x2247, 0xad90, 0x2b63, 0xa8fd, 0x2888, 0x25c9, 0x255b, 0x9c38, 0xab18, 0x23f2, 0xacb4, 0xa7f3, 0xa812, 0x21d0, 0x284f, 0xa86d, 0xad02, 0xa41a, 0xadc5, 0x9e79, 0x28ac, 0x2032, 0xa80f, 0xa93c, 0xaaa3, 0xa7df, 0x2bd9, 0x2777, 0x2c18, 0xac82, 0x991e, 0xa8f5, 0x9b6c, 0xa95d, 0xa765, 0x021c, 0x2c6f, 0x2a7f, 0x96c3, 0x2c49, 0xabe7, 0xa5f5, 0x2b84, 0x2bdb, 0xadb1, 0xa6de, 0xa33e, 0xae5d, 0xa99b, 0x2b87, 0x9d9a, 0x296c, 0xa9e3, 0x2bbd, 0xae38, 0x2598, 0x2a9a, 0x23e2, 0xac07, 0x122e, 0x297c, 0x24cf, 0x2c6e, 0x2a1a, 0x2211, 0x270f, 0xa4a6, 0x9d35, 0xa49e, 0xa008, 0xa4dc, 0xab55, 0xab09, 0xad00, 0xa7c5, 0xaca8, 0x2c21, 0xade1, 0x2c1a, 0xaa67, 0xa9b6, 0xadf2, 0xae22, 0xa540, 0xa060, 0x2c7d, 0x28f7, 0xadbf, 0x2268, 0x29b9, 0xa35d, 0xa858, 0x0d55, 0x27f8, 0x2d65, 0xa4d6, 0xaa1b, 0xa61e, 0xad37, 0xacd9, 0xa7ee, 0xa6fc, 0xa6fa, 0x2af0, 0xadff, 0xadbe, 0xaddc, 0xa6ed, 0xa682, 0xab7c, 0x2a3c, 0xaa1d, 0x2928, 0xa93f, 0x28b9, 0x266d, 0xa462, 0x288e, 0x2b28, 0xa50b, 0x2fd6, 0xa720, 0xb041, 0x29b3, 0xa0b3, 0xadb3, 0xab7e, 0x292c, 0xb052, 0xafb4, 0xac50, 0x94bb, 0x1a8a, 0x2ef8, 0xa0e5, 0x2d08, 0x2f9a, 0x2db4, 0xa85b, 0x2a81, 0xa330, 0xa71e, 0xaa56, 0xacaa, 0xa648, 0x2e5c, 0xa8d2, 0x2cb5, 0xac9d, 0x2dd8, 0x26a5, 0x9b4b, 0x1e4e, 0x29da, 0x22bd, 0x2d06, 0x2b09, 0x9c26, 0xa548, 0xae9b, 0xa923, 0xa012, 0x2baf, 0xa47f, 0xb078, 0xa302, 0x2ae9, 0xa5eb, 0x2d41, 0x2db7, 0x24d0, 0x182f, 0x2df5, 0x2c01, 0xabfe, 0x286c, 0x2ecd, 0xac61, 0x2d19, 0xace1, 0xa793, 0x2d5e, 0x28fc, 0x2292, 0x2ec5, 0x96a4, 0x2c43, 0xa8cf, 0xa88f, 0x2ff4, 0xab89, 0x2f75, 0xa39e, 0xa64c, 0x2425, 0x2a4b, 0xa946, 0xae9d, 0xa0f6, 0xace3, 0x2282, 0xaa46, 0xac9b, 0xab16, 0xa588, 0x9d24, 0x2f38, 0xaf96, 0x2c98, 0x2bf7, 0x2d73, 0x1979, 0x1c0c, 0x2e93, 0x2808, 0x2f2d, 0x2102, 0x2977, 0xa805, 0xaa53, 0xa646, 0x2c71, 0xa864, 0xadbc, 0xad00, 0xa8c1, 0xa0dc, 0x2e50, 0x2e4f, 0xa5a2, 0xaebd, 0x271a, 0xab07, 0x2db5, 0xa9b3, 0x2b18, 0x2c48, 0x2d4c, 0x29f5, 0xab4e, 0x2e77, 0x2636, 0x2311, 0x2a28, 0x2c53, 0xac3f, 0xa27c, 0xaccc, 0x9acb, 0xa384, 0xa42c, 0xaa1b, 0xa930, 0x2e16, 0x2765, 0x2c2e, 0x259b, 0x2b75, 0xac21, 0xa8d6, 0xaca0, 0xa642, 0xa604, 0x2c9f, 0xa0ba, 0x2cbb, 0x2c0c, 0x2c54, 0xa5d5, 0xa5a8, 0xa4f3, 0x2bd2, 0x2c2a, 0x289a, 0x2955, 0xad09, 0x9e7a, 0x2c22, 0x1ebf, 0xab33, 0xa998, 0xa9e5, 0x2c43, 0xaac0, 0x2ca7, 0xa358, 0xac3d, 0x258c, 0x224a, 0xad07, 0x2ca5, 0xac37, 0xad20, 0xac02, 0x244e, 0xa6cc, 0xac6b, 0xa84f, 0x128c, 0xac48, 0xa867, 0xab0f, 0x2c58, 0x2a51, 0xa5bc, 0xad47, 0xadf0, 0x2685, 0xa9a0, 0x2420, 0x9e72, 0xab4b, 0x259f, 0xaca3, 0x2088, 0xaed6, 0xae99, 0x28a8, 0xa5ff, 0x2dcc, 0x2273, 0x1ad4, 0xacac, 0x2c49, 0xac3d, 0xa468, 0xaa9c, 0xaa0b, 0x2974, 0x2784, 0x2cea, 0x2131, 0x2be1, 0xa9a6, 0x24e8, 0x231f, 0xae1e, 0xab12, 0xacfd, 0x27b5, 0x2c5a, 0xac68, 0xa800, 0x29f1, 0x29c0, 0x2b2e, 0xad00, 0x2495, 0xa91e, 0x997d, 0xab2e, 0xab9d, 0xa8fc, 0x2714, 0xaca9, 0x110e, 0x2411, 0x23db, 0xaa62, 0x2583, 0xa42f, 0xa231, 0xa2c7, 0x2c2b, 0x9629, 0x9ee1, 0x1b90, 0x2b81, 0x1b32, 0xabac, 0x2730, 0xac6b, 0x187d, 0x2e1f, 0xaf2b, 0x248b, 0x2d4c, 0x2d3a, 0xabe0, 0xa04d, 0xad60, 0xab4e, 0x2958, 0xa8ab, 0xb0d1, 0xb122, 0xae49, 0x238a, 0x24a7, 0x2bd6, 0xaff6, 0x20ec, 0x2c8b, 0x2c1c, 0x20b0, 0x2a9a, 0xafb2, 0xaf17, 0x2c89, 0x2dfe, 0x28ff, 0x2dbd, 0xa54d, 0x1fa5, 0x2702, 0x143a, 0x2ac6, 0x9ca2, 0xac82, 0x2ce2, 0x29a4, 0xae30, 0x2fa4, 0x2e98, 0xaaf3, 0xaae2, 0xa365, 0xac8f, 0x2716, 0x278a, 0xae47, 0x226f, 0x09a3, 0xaf01, 0x2c2f, 0x2876, 0x2da7, 0xad01, 0x2a97, 0x2e43, 0x94d8, 0xadc0, 0x2e29, 0xabca, 0xa08b, 0xaccb, 0x2ac7, 0x2c51, 0x0cb2, 0x9bdf, 0x288d, 0x306e, 0x2f4a, 0x2d59, 0xab85, 0x2f09, 0xad3e, 0x2f27, 0xa06e, 0x1ad7, 0xad46, 0x180e, 0xa471, 0xadb0, 0x2987, 0xad19, 0x2148, 0xacb7, 0x9d36, 0xab50, 0x2c1f, 0x2191, 0x306b, 0x260a, 0x2ce7, 0xa60b, 0x2db5, 0x2d93, 0x3033, 0x2c40, 0x1d39, 0x2c6e, 0xa810, 0x27d3, 0xadac, 0xa1ae, 0xa97a, 0x250f, 0x2a51, 0x1bcd, 0x2a82, 0x1f3e, 0x27ad, 0x2d8c, 0x2d82, 0xace0, 0xae13, 0xa704, 0xa593, 0xace1, 0x2de0, 0xadf4, 0x2c10, 0x2b8a, 0x2f63, 0x2a2d, 0x2e12, 0xa824, 0x29af, 0xad29, 0x2bef, 0x2e92, 0x28d4, 0x303d, 0xa80a, 0x2cfb, 0xaafe, 0x2c88, 0xa945, 0xa9ac, 0x2d05, 0x2bba, 0xacab, 0xabcf, 0x2e7b, 0xa8e3, 0xa1be, 0x2d26, 0x2eb7, 0x290b, 0x298d, 0xa5e7, 0x220b, 0x2de1, 0x2c63, 0xadcf, 0xa260, 0xad0b, 0x2ced, 0xa0a8, 0x2709, 0xab97, 0x9fd0, 0x2986, 0x29c3, 0x1c13, 0xa7ec, 0xaa02, 0x2f49, 0x2f0d, 0x2a12, 0x2961, 0xaa5c, 0x2c08, 0x2cf3, 0xa864, 0xa8eb, 0xa733, 0xa899, 0x2876, 0x2c8f, 0x2ea1, 0x25b7, 0x2d41, 0x2d3e, 0x1d32, 0x2b56, 0x2676, 0x2bad, 0x21c0, 0x2c23, 0xa9ce, 0xa2f0, 0x2bf2, 0x2df6, 0xa9d9, 0x2f5b, 0x95dc, 0x2ce1, 0x2d8b, 0x2cee, 0x290a, 0x24b0, 0xa9c5, 0x20e5, 0x9fd8, 0x2c11, 0xa478, 0xa580, 0x2d40, 0xa4aa, 0xacb5, 0x2527, 0xad79, 0xabff, 0x810c, 0x2692, 0x2836, 0x22d8, 0x269f, 0x2e2a, 0xa8f6, 0x2615, 0x2f4c, 0x289b, 0x298c, 0x2e27, 0xa240, 0x1c5f, 0x2b3f, 0x2d22, 0x2fc0, 0x9fcc, 0x2e39, 0xad1b, 0x20e3, 0x2cf6, 0x2cfd, 0x24c2, 0xa019, 0x2a69, 0x2d7b, 0xaac0, 0x1f20, 0xab03, 0xaeb6, 0x2d35, 0x950d, 0x2a82, 0xa0e6, 0xa89d, 0x2ba4, 0x2a47, 0x1c49, 0x29e8, 0x2dd1, 0x2d69, 0xa69f, 0x2fc7, 0xac70, 0x2cb7, 0x2d29, 0x1b22, 0x9b9e, 0x2015, 0x2cc6, 0x29d8, 0x2167, 0x2cbf, 0x9d0d, 0x287a, 0xa784, 0xace4, 0xa471, 0xa41b, 0xabd0, 0x26b5, 0x2d19, 0x1f40, 0x2d01, 0x2888, 0xac8f, 0xa780, 0x2d67, 0xaa52, 0x29bb, 0x29da, 0xab44, 0xa59d, 0xa8d9, 0xadb9, 0xa6a7, 0xac65, 0xaa0b, 0x2fab, 0x9637, 0x2c8d, 0x2af9, 0xa988, 0xac1c, 0x10e3, 0x2365, 0x2a29, 0xa9d1, 0xa6de, 0x9fa7, 0xa8aa, 0x2baa, 0x2eec, 0xa847, 0xa541, 0xad88, 0x9c60, 0x2c4d, 0xa85f, 0xa938, 0xa154, 0x9ea0, 0x2425, 0x24ad, 0xa96e, 0xa877, 0x1764, 0xa5c7, 0xa7eb, 0x2a50, 0xa8dd, 0xa054, 0xa1e7, 0xa066, 0x2500, 0xa532, 0x2608, 0x2e78, 0xac05, 0x2da5, 0x24de, 0x9540, 0x2c36, 0x9968, 0xab38, 0x2ca7, 0x2e92, 0xab34, 0x2f6b, 0xad35, 0x2ec0, 0xac4a, 0xad81, 0x2d8e, 0x2d0e, 0xac49, 0xacfa, 0x287b, 0x28e9, 0x2857, 0x24cd, 0xada8, 0xac67, 0xab31, 0xa9a5, 0x2aae, 0x2de8, 0x2e76, 0x1d40, 0x25cc, 0x26fb, 0x2b31, 0x2c6c, 0xa32f, 0x2bfe, 0x2adc, 0x2bc9, 0x2d9b, 0x24eb, 0x2f6c, 0x2cf5, 0xa651, 0x2d01, 0xa9d8, 0x280f, 0xa492, 0xadb2, 0x2662, 0xac7a, 0x2f5d, 0x2a16, 0x2ba3, 0x2a36, 0x2e50, 0xa3c8, 0x2d46, 0x2c65, 0x2de3, 0xaa80, 0xa21c, 0xa1f9, 0x2e54, 0x9ed4, 0x2bd3, 0x2316, 0xa5b0, 0x2bba, 0x2554, 0x2fde, 0x2bc0, 0x26bf, 0xa9d6, 0x2703, 0xa629, 0x2f85, 0xab87, 0x2c6e, 0xacd1, 0xa401, 0xa1dd, 0x2ce5, 0xa4e5, 0x2cd4, 0x2e5f, 0xa977, 0x2bfd, 0xa74c, 0x1982, 0xa7a7, 0xa9aa, 0x2fa0, 0x2739, 0x2d35, 0xadcf, 0xabdf, 0xacad, 0x2d87, 0xac52, 0xad0c, 0x2dfa, 0xa9e4, 0x2907, 0x2eb3, 0x21d6, 0x2cee, 0xa47c, 0x2dd1, 0xa5fe, 0x2ac7, 0x294e, 0x2f44, 0x2c51, 0xab01, 0x1e9a, 0x28a1, 0x2c13, 0x28df, 0x2d44, 0x147d, 0x3004, 0x1e1b, 0x269d, 0x1bca, 0x17f2, 0x282b, 0xa92e, 0xa518, 0xa9b0, 0xab2d, 0xa752, 0xa217, 0xa121, 0x2b6c, 0x2878, 0x27f1, 0xacd3, 0xadec, 0xa079, 0x2c54, 0x2e13, 0x2e85, 0xaa70, 0x2bc5, 0x2e9a, 0x2ed3, 0x25bc, 0x2fe4, 0x2654, 0x296e, 0x28e7, 0x245d, 0x2d34, 0x27a8, 0x2b54, 0x2ab6, 0x2337, 0x1ce1, 0xa97f, 0xae94, 0xaeda, 0xaaf6, 0x2c6c, 0xab5e, 0xabc0, 0xaeda, 0x2618, 0xad4b, 0xa25a, 0x2c9d, 0x2e2b, 0x2693, 0x297f, 0xa705, 0xa01b, 0x2c6e, 0x2f88, 0x2dcb, 0xa685, 0x2aaa, 0x2466, 0x3058, 0x2550, 0x206e, 0x98b6, 0x2ef3, 0x2b47, 0x098e, 0xa464, 0xa38b, 0x2be0, 0x3017, 0x2aa2, 0x1fe9, 0xa8a6, 0x26ee, 0x2c56, 0x2688, 0x2eab, 0x9cbf, 0x275d, 0x1dc5, 0xaa9f, 0xa489, 0xa858, 0x2f15, 0x2f8f, 0x2f77, 0x229b, 0xa94a, 0xa8eb, 0x25fe, 0xad4e, 0xa214, 0xa791, 0xa669, 0xa63b, 0xab7a, 0x2b93, 0xac23, 0xa685, 0x28e1, 0xa95a, 0x2bfe, 0x2f1a, 0x2f16, 0x2a48, 0x9b84, 0x2d88, 0x2fb8, 0x2b70, 0xaae1, 0x2cfd, 0x23ff, 0x2d8d, 0xa232, 0x2e46, 0xa784, 0x2eae, 0x2b54, 0x2ff0, 0x2f29, 0x2de6, 0x25e1, 0x1b14, 0x23bd, 0x2aee, 0x24fe, 0xa8d2, 0xa9f4, 0xabde, 0x2ce6, 0x24a4, 0xa8e2, 0x2145, 0xa570, 0x2f43, 0xa892, 0x26e7, 0x2cc7, 0x2fed, 0xab39, 0x2cf3, 0x2fd4, 0x2da3, 0x2f82, 0x2f8f, 0xa872, 0x2d5e, 0xabe3, 0x2a65, 0xacc8, 0x301a, 0xacf2, 0x2efb, 0xa64b, 0xab47, 0xa31b, 0x2877, 0xa4bf, 0x2b06, 0xaa92, 0x2d3d, 0x2801, 0xa1f0, 0xa12b, 0x2ef0, 0x2b61, 0xa935, 0x2eee, 0x1d7e, 0xa8f9, 0xa4ea, 0x2e76, 0x24c7, 0x2dd2, 0x2a55, 0xa8c1, 0x2f3a, 0x2f9e, 0x2ccb, 0xa4d2, 0x28df, 0xac8b, 0xa71d, 0x10da, 0x266f, 0xa495, 0xb0a9, 0x240e, 0xafa6, 0x2ba1, 0xa4b5, 0x2e85, 0x9da5, 0x2691, 0x2c8f, 0x2dd8, 0x2f0c, 0x2a9f, 0x2f06, 0x270b, 0x2918, 0xaf13, 0x2d85, 0x20a2, 0x1e28, 0x2c81, 0x2c71, 0x2ac3, 0x19d8, 0x25f4, 0xa540, 0xa6b4, 0x2d97, 0xac82, 0x2639, 0x2c2f, 0xa665, 0x2fb0, 0xa34f, 0x9eb8, 0x2eea, 0x2d50, 0xa362, 0xa1af, 0x2a98, 0x2d2b, 0xa78f, 0x2d6a, 0x2d3b, 0xaa0e, 0x203b, 0xa508, 0x2f2f, 0x2934, 0x1cf3, 0xab5f, 0x2dba, 0x24a5, 0x269b, 0x29b6, 0xa475, 0xab46, 0x2f1a, 0x2ce7, 0xa6cc, 0x239f, 0x2edb, 0x2526, 0xa9fd, 0x27d4, 0x1c46, 0x2905, 0x26ba, 0xac54, 0xaeac, 0xaa64, 0x26ca, 0x2cca, 0x226a, 0xa278, 0xabf7, 0x19f6, 0x2ae2, 0xae43, 0x2c51, 0xaa7f, 0x2b50, 0x9b27, 0xa81f, 0x23d3, 0xabba, 0x25c1, 0x2d28, 0x20de, 0x2937, 0xa96c, 0x20e8, 0x2839, 0xa5f9, 0xaa35, 0xa805, 0x2952, 0x2a90, 0xad7f, 0x9ce0, 0x25fd, 0xa658, 0xafa4, 0x2c46, 0x2db8, 0x186b, 0x20df, 0xa94b, 0x26b7, 0xaced, 0xacfe, 0xa68f, 0xa8cb, 0xa4b2, 0xab04, 0x2e19, 0x1db7, 0x2c1d, 0x2be9, 0x2345, 0x1759, 0x2e03, 0x214e, 0x2e97, 0x2e2c, 0x2f5b, 0x2d33, 0xa910, 0xa7b4, 0x23f4, 0x2c48, 0x1427, 0xaa5f, 0xa991, 0x2a7b, 0xa445, 0x2a6f, 0x2b22, 0x2e96, 0xa968, 0x24cd, 0x2ace, 0xa772, 0x2af4, 0x2cc3, 0x2129, 0xac35, 0x2a43, 0x99ba, 0x2da0, 0x2e10, 0x27c0, 0x9c87, 0x2437, 0xa955, 0xa9c5, 0xacb0, 0x2c4c, 0xad19, 0xa448, 0xa90e, 0xa9a8, 0xa83d, 0x2583, 0x2ff1, 0x29a8, 0xae35, 0xabfa, 0xab45, 0xa725, 0xa220, 0x2937, 0xa17d, 0xa2c9, 0x2dff, 0xae4a, 0x25dc, 0xac4f, 0x2e6b, 0xab63, 0x1c36, 0xaea8, 0xab28, 0x2583, 0x2c51, 0xabc0, 0xac7c, 0xabe3, 0x2cd7, 0x2707, 0xa343, 0xaca7, 0xada6, 0xae33, 0xa79e, 0xacae, 0x2af7, 0xad1e, 0xa23b, 0x2571, 0x2b57, 0xad19, 0x2976, 0xa09d, 0xac6b, 0x2836, 0x2e65, 0x236e, 0x29ec, 0x2cfe, 0xa4a3, 0x2b23, 0x29dc, 0x290c, 0xa3a6, 0xadc8, 0x2f67, 0xa987, 0xadb6, 0x9b5b, 0x2c09, 0x250a, 0x2890, 0xac74, 0xa98b, 0xadd2, 0xac31, 0xaa13, 0xacf7, 0xae6a, 0xa935, 0xa99c, 0x2be1, 0xa0d9, 0x2549, 0xaa32, 0x27bc, 0x2095, 0x2c54, 0x2b4d, 0x2e4b, 0x2489, 0x298c, 0x2e41, 0xa91a, 0xa4bd, 0xa4e5, 0xa924, 0xa2d0, 0x29cf, 0x983e, 0xae8c, 0x2c47, 0xaecf, 0x1ebb, 0x2873, 0x2ff9, 0xb083, 0x2cba, 0xacf9, 0xa878, 0x18c1, 0x24db, 0xa1d3, 0xac68, 0x269e, 0x2d19, 0xa80d, 0x230d, 0x2ffc, 0xaa81, 0x24c5, 0x2e55, 0x2d9a, 0x2ea1, 0xac0c, 0xa404, 0xa9c5, 0x2c8d, 0xaeea, 0x2e4d, 0x24ab, 0xa28c, 0x2dde, 0x1d66, 0x2452, 0x137b, 0x23dc, 0x2b8b, 0x2c60, 0x2533, 0x2d9e, 0x2ef6, 0x2eba, 0xad2e, 0x2d24, 0x250e, 0x8f74, 0x3025, 0xa9f1, 0x2ade, 0x28ab, 0x2e1d, 0x2cee, 0x2658, 0x2c7e, 0x2a9f, 0x2d14, 0xacbd, 0x2848, 0x2bf0, 0xa874, 0x2ac1, 0xacc1, 0x2118, 0x2776, 0x2bb8, 0x2ecc, 0xac7c, 0x2c81, 0x27d4, 0x2521, 0xac10, 0x2d20, 0xa0f5, 0xaf90, 0x2685, 0xad09, 0x9529, 0xa739, 0x2a58, 0x2708, 0x26c4, 0xad22, 0x23ea, 0x25f9, 0x3029, 0x2fb0, 0xaa00, 0xa75e, 0xa610, 0xa861, 0xa403, 0x276c, 0x2cce, 0xa704, 0xadd3, 0x2bbb, 0xa3e4, 0x20cd, 0x2a26, 0x216f, 0xa6f5, 0xa850, 0xa983, 0xa360, 0xad0f, 0x2765, 0x2979, 0xa956, 0x2586, 0xa913, 0x1ced, 0x1485, 0x2446, 0x2c15, 0xa802, 0x2b50, 0x2d35, 0x1c3e, 0x287a, 0xa44f, 0xab5d, 0xa866, 0xaa19, 0x3018, 0xa36d, 0x2838, 0xabae, 0xa4da, 0x2a07, 0x2a8c, 0x300e, 0x2a52, 0x2a8e, 0xa3fc, 0xad01, 0x9686, 0x22db, 0x2f6c, 0xab4c, 0x29c2, 0x2c75, 0xa7b8, 0xa2ba, 0xa655, 0x2c92, 0x275e, 0x2839, 0x2c4f, 0x2ea8, 0x25e7, 0xac2e, 0x2d4a, 0x9e5f, 0x2e52, 0x2fdf, 0x12de, 0x2338, 0x2c59, 0x2017, 0xa48f, 0xace1, 0xa6cc, 0x2688, 0x2a0d, 0xac63, 0x29df, 0x28ea, 0x2628, 0x2d63, 0xac80, 0xad27, 0x2918, 0xa93b, 0x28cf, 0x2bc4, 0xab7f, 0x2edc, 0x2dda, 0x2d3f, 0x9c2c, 0x2794, 0xac8e, 0x2fb5, 0x294c, 0x1728, 0xaca0, 0x21da, 0xae2a, 0x2cc3, 0xabcb, 0x2429, 0xae03, 0xac9a, 0x2814, 0x2ceb, 0x2a07, 0x280a, 0xab3f, 0xa6c3, 0xac62, 0xa5cf, 0xa17f, 0x1cc1, 0x2ac0, 0xaa65, 0x9d43, 0x2570, 0x2ccb, 0xa967, 0x2c03, 0x2c4a, 0x28d3, 0xa5f3, 0x2d47, 0xa80e, 0xa52d, 0x26b6, 0x21c0, 0xa88a, 0x29e8, 0x1eff, 0xa8d3, 0xae31, 0xa19c, 0xa2c0, 0xab4d, 0x2c56, 0xac50, 0xa822, 0x9d9b, 0xabeb, 0xae04, 0xa782, 0xa8d0, 0x2eae, 0x2cb1, 0xab5b, 0x2dae, 0x2e8f, 0x259e, 0x2699, 0x29f9, 0x2f42, 0xa6f4, 0x2eb2, 0x2eb5, 0x2dbb, 0x2cd3, 0xa7cd, 0x2a7c, 0xa9e7, 0xaa0b, 0xaae8, 0x2e1d, 0xa374, 0xad8f, 0xa465, 0x2903, 0xae5b, 0x2957, 0xa79f, 0xa834, 0xaae4, 0x2a00, 0x29ce, 0x9ddc, 0xaaaf, 0xa190, 0xa854, 0x1ff7, 0x2eef, 0x25b8, 0xa838, 0x26e7, 0x9ee8, 0x2bb3, 0xa9b0, 0x2c76, 0x2854, 0x2216, 0x305f, 0x2da8, 0xa774, 0x2c8d, 0x2c73, 0xa7b3, 0x2427, 0x2a81, 0xa989, 0x2ed1, 0xa8c1, 0xac9c, 0x9d10, 0x95de, 0x28ff, 0x2ceb, 0xab83, 0x2e3c, 0x2d29, 0x2842, 0x2e52, 0x2d16, 0xaac4, 0xab59, 0x2824, 0x2869, 0x1e91, 0x2dc1, 0x29d7, 0xa5b1, 0xa405, 0xa8f8, 0x2adc, 0x2071, 0xa98d, 0xac58, 0x29f8, 0x2d3c, 0x22ed, 0x258c, 0x2e9f, 0x2cc2, 0xa7eb, 0xab3a, 0x2b4c, 0x2caf, 0x9c71, 0x2db3, 0x29c0, 0x3015, 0x2fcf, 0x2513, 0x2f0d, 0x3018, 0xac58, 0x2cfa, 0x2b4f, 0x2447, 0xab1b, 0x2742, 0x9fd9, 0xac8a, 0xa800, 0x2805, 0x2a18, 0xaddc, 0x22c0, 0x2dc2, 0xaa9d, 0x2f42, 0x2b0f, 0xaedb, 0x2cf6, 0x2f65, 0xa774, 0x2427, 0x2767, 0xa971, 0xaa3f, 0x9853, 0x24d1, 0x2d3f, 0xa4d3, 0x2805, 0x2369, 0xa988, 0xac69, 0xa931, 0x2504, 0xadfd, 0x28d6, 0xa7f7, 0x2b2e, 0x17db, 0xace4, 0xa964, 0x280c, 0x2cfd, 0xa213, 0xac40, 0xadc9, 0xab37, 0x9f2f, 0xa465, 0x2fa7, 0xa935, 0x2f1a, 0xa327, 0x2fba, 0xa808, 0xa62f, 0x9fc5, 0x25ec, 0xa72e, 0xa822, 0x28e9, 0xacfd, 0xab2a, 0x301a, 0x9a43, 0x2dc3, 0x2fb7, 0xac94, 0x2e2d, 0x2e0b, 0x203d, 0xa887, 0x2c71, 0x2692, 0x2c38, 0x2c8b, 0xa652, 0x25be, 0x2e0e, 0xad09, 0x2d55, 0xa9eb, 0xa330, 0x2ef8, 0x2470, 0x2275, 0x2133, 0x2d1b, 0x28dc, 0x2616, 0x2e78, 0x9637, 0x2933, 0xa7e9, 0xa8d1, 0x2cea, 0xa706, 0x2dff, 0x2c01, 0x2ff0, 0x8dac, 0x2f8b, 0x2a6a, 0xa0ad, 0x2b47, 0x2c8e, 0x251f, 0xa960, 0x2817, 0xa9df, 0xac59, 0xaf30, 0xacdc, 0xa951, 0x2eb5, 0x2560, 0x2ed3, 0x2e21, 0x2ccb, 0xac8b, 0x2d26, 0xa839, 0xaf0d, 0x2e38, 0x2580, 0xa809, 0xa69c, 0xaf3f, 0x26f0, 0x29ba, 0xa48b, 0x2d81, 0x2498, 0x2aa5, 0x22df, 0xaf0f, 0x2e06, 0x2c8f, 0xacd2, 0x28c4, 0x2892, 0x2ea3, 0xa4c8, 0x9fd6, 0x2dea, 0xac5b, 0x2cdb, 0xad37, 0x9a85, 0xa819, 0xa406, 0x21c0, 0xae5e, 0xabb1, 0x2d72, 0x2c2c, 0x243c, 0x2037, 0x29c7, 0x26b0, 0xae94, 0x204c, 0x24f4, 0x22dd, 0xaa0e, 0xaa6a, 0x29d7, 0x2896, 0x2d51, 0x2bc6, 0x1f66, 0x2297, 0x22ba, 0x1908, 0x2c56, 0x292e, 0x2d15, 0xa97b, 0x2c0a, 0xaf55, 0x2283, 0x2ddc, 0x9ee6, 0x2f3b, 0xb00a, 0xa5c1, 0x2e3b, 0x307b, 0x2b0b, 0xac0c, 0x2e8d, 0xa7a5, 0x2e20, 0x2fe1, 0x2eb2, 0xa989, 0x29eb, 0xa477, 0xaa01, 0x27a1, 0x1e07, 0x2bb3, 0xa6be, 0xa86c, 0xaf7e, 0x2f1a, 0x2ba1, 0xa99d, 0x244f, 0xa8ad, 0x2e62, 0x2ab7, 0x1b4e, 0x2aa8, 0xac1c, 0x280e, 0x19fa, 0x2fb1, 0x1c50, 0x280b, 0x27d9, 0xa633, 0xa272, 0x2c1e, 0xac7b, 0x2821, 0x2be1, 0x2d86, 0x2d82, 0x2db0, 0x9cc4, 0xa889, 0x2f59, 0x2823, 0x1be7, 0xaa32, 0xad0b, 0xae2a, 0x2d90, 0xa42c, 0xa767, 0x9523, 0x2f60, 0x2244, 0x28a6, 0x2f0d, 0x9b36, 0x2601, 0xaa72, 0x9ae0, 0xade9, 0x209d, 0x199c, 0x29cb, 0x2957, 0xab57, 0xaa3a, 0xac11, 0xa4f9, 0xa08f, 0xad7d, 0x2cc4, 0xa25a, 0x1593, 0x2d1a, 0x2d2a, 0xac3f, 0x2397, 0x2ef0, 0xa02b, 0x2d8d, 0xade6, 0x2fcf, 0xad81, 0x2e66, 0xa983, 0x2e0c, 0x17c2, 0xae35, 0xadfb, 0xac2b, 0x2c98, 0xa9dc, 0x2de0, 0x2a86, 0x2e93, 0x2930, 0x2d9b, 0x2dec, 0xa850, 0x2d1a, 0x2ff2, 0x2b3c, 0x28c3, 0xa789, 0x2a88, 0xa1c8, 0x028c, 0x23a8, 0xa86f, 0x2eef, 0x2546, 0x2dc9, 0xa95d, 0x2d01, 0xad9b, 0x2f54, 0x2eed, 0xaaa2, 0x20c8, 0x27da, 0xaaf5, 0x2706, 0x2c3e, 0x2d99, 0xa600, 0x1ff1, 0xac3b, 0xab72, 0x2c8f, 0x2c40, 0xa70e, 0x2774, 0xaeb9, 0x2932, 0x29b9, 0xa7fa, 0xae3c, 0xabe9, 0x2810, 0x2149, 0x2ed2, 0xa385, 0x99ee, 0x2d6c, 0x230e, 0xa426, 0xad57, 0x28bc, 0x26bc, 0x28f8, 0xacfc, 0x23bf, 0x2b74, 0x2bb0, 0x292d, 0x1c20, 0x2f72, 0x27f0, 0x2d42, 0xa778, 0x2ca2, 0x2ba7, 0x2c5d, 0x25ec, 0xa6ec, 0x2b1a, 0x2d0b, 0xafd4, 0xa516, 0xa697, 0x1a6b, 0x2d59, 0xab0d, 0xab19, 0x26ec, 0x184d, 0xac75, 0x250c, 0xa8d6, 0xacf5, 0xad6b, 0xa479, 0x28cc, 0x2dea, 0x2e2b, 0x2d6b, 0x237f, 0x2bcf, 0x0bec, 0x1d66, 0xa618, 0x2d50, 0x2a1d, 0x2981, 0x16b2, 0x97d9, 0x2db4, 0xacf9, 0xa633, 0x2835, 0x2ede, 0x17ab, 0x2eab, 0x2a10, 0x2c2a, 0xab6e, 0x2ecf, 0xaa84, 0x2c85, 0x1d32, 0xa894, 0x2864, 0xa764, 0xade2, 0x29bd, 0x2f1c, 0x285a, 0x2d20, 0x233e, 0x25bc, 0x16b8, 0x2abb, 0xa828, 0x2abb, 0xa5db, 0xac03, 0xadb4, 0x2e37, 0x2c80, 0x2f5f, 0x2cb4, 0x1f10, 0x9434, 0x1e48, 0xa5d5, 0xa7d9, 0x9e1a, 0xa68e, 0x2093, 0x2e27, 0xaa02, 0xac20, 0x2710, 0xab5d, 0xa05e, 0xa3e3, 0xa19e, 0xaf89, 0x2d59, 0xa224, 0xa421, 0x24c1, 0x8c5f, 0xaa74, 0x2eac, 0xa7a7, 0xab95, 0xa9ab, 0x2ebe, 0x2a74, 0x2fae, 0x9fee, 0xa599, 0x26bf, 0x2d83, 0xad7e, 0x2b01, 0xad07, 0x2471, 0xa93f, 0x2ce5, 0xa45a, 0x2b1b, 0xa860, 0x25a9, 0x2c44, 0x28ae, 0x295b, 0x2322, 0xadca, 0x2c96, 0x3006, 0x2142, 0x3003, 0x2d11, 0x2e1e, 0xa08b, 0x9ed9, 0x2cb6, 0xa500, 0xa5f0, 0xabf4, 0x2469, 0x29cc, 0x24f3, 0xa057, 0xadb8, 0x249b, 0x29c6, 0x2d93, 0x2f4f, 0x9465, 0xa22f, 0x28cc, 0x2479, 0x2771, 0x9e24, 0x2f14, 0xa06b, 0xaa42, 0x2f32, 0xa369, 0x1975, 0x2bf4, 0xaab0, 0xb051, 0xad7a, 0xad81, 0x2adb, 0x2726, 0xa118, 0xadff, 0x28b9, 0xacf0, 0xaa9f, 0x2a7f, 0x280b, 0x26f9, 0xa680, 0x2d29, 0x2d5d, 0xac92, 0xa4ac, 0xa480, 0xa210, 0x2e74, 0xa104, 0x2ca2, 0x277a, 0xab6f, 0x2a7b, 0xa962, 0x2a8a, 0x2b2b, 0xa883, 0xad65, 0x2124, 0xa32a, 0xaca9, 0xa912, 0x2f9b, 0xac9c, 0xa69d, 0x2cc3, 0xaa4f, 0xa349, 0xa780, 0xac08, 0xab4b, 0xa927, 0xaae4, 0xa4ba, 0xaa21, 0x24b8, 0xaac7, 0x26aa, 0x2a13, 0xaaef, 0xa01c, 0x2fdf, 0x2a86, 0x2ef2, 0x2b12, 0xad9f, 0xa203, 0xadff, 0x9c63, 0x1c3a, 0xa82f, 0xac15, 0xa647, 0xac9b, 0xad24, 0xad3f, 0xad24, 0xacce, 0xad44, 0xacfe, 0x9ebc, 0xa8df, 0x2a45, 0x2c92, 0xa88b, 0xa965, 0xae42, 0xac7c, 0x2b0c, 0xaae5, 0xacac, 0x2c75, 0x2943, 0x2d26, 0xace0, 0x2c4b, 0xae08, 0xaa40, 0x289c, 0x2c35, 0xac82, 0x2991, 0xac56, 0xa2f5, 0xa5b2, 0xa621, 0xad50, 0x2973, 0xadc9, 0x28df, 0xa8b6, 0xadc4, 0x2183, 0x2c35, 0xa62b, 0xad3c, 0x2543, 0x1be0, 0xad55, 0x1b3e, 0xa436, 0x8755, 0xac54, 0xad2e, 0xad60, 0x2c5a, 0x2cf1, 0xa56d, 0xaabe, 0x2a60, 0x2c65, 0x2684, 0x2b9a, 0x283b, 0x2cce, 0xad42, 0xabfc, 0xa9e4, 0x2c0f, 0xad4f, 0xa6b5, 0x2c0d, 0x1817, 0x2b8a, 0xa83f, 0x2148, 0xaceb, 0xae3a, 0x299b, 0xa6af, 0x27aa, 0x2ca5, 0xaa1d, 0xac85, 0x1e46, 0xa98b, 0xac4f, 0x2b86, 0x2c80, 0x29d9, 0xad6f, 0x2a88, 0xa9b9, 0xae03, 0x2721, 0xacd3, 0x2c0c, 0x2cb9, 0xaa1c, 0x2ca9, 0x9cbe, 0xadae, 0x2c66, 0xa08a, 0x2a22, 0xaea9, 0xacb4, 0xac91, 0xa859, 0xa98f, 0x2936, 0xab48, 0xa3ca, 0xa8d4, 0x1eaf, 0x2aac, 0xadee, 0xa312, 0xaa48, 0xae75, 0x1b97, 0xaba0, 0x1311, 0xaa82, 0xa955, 0xaa7c, 0xadc4, 0x2b26, 0x2616, 0x2f53, 0xaad6, 0xa8c9, 0x2f66, 0xa9b3, 0x2f0e, 0xa9a1, 0x2a48, 0x27dd, 0xa5fc, 0x2110, 0xa5b9, 0x2b0b, 0x218a, 0x294f, 0xa715, 0x2d95, 0x2808, 0xab02, 0xac86, 0x2a44, 0xa691, 0x1649, 0xa8c1, 0x250b, 0x246f, 0x2d4e, 0xa954, 0x27b1, 0xacf0, 0xa159, 0xa79e, 0xa8f2, 0xaa8e, 0xaac8, 0xa589, 0x2b7f, 0x2c03, 0x2093, 0x2dbf, 0x2f3e, 0x2d34, 0xa772, 0xab3d, 0x2d11, 0x2da4, 0x2d7a, 0xa79e, 0xa89e, 0xa255, 0x2e0f, 0x2edd, 0x2db2, 0xa888, 0x295d, 0x1463, 0xac12, 0x2080, 0x296a, 0x2416, 0x2bd3, 0xa861, 0xac77, 0x2c59, 0x2a6c, 0x2ca8, 0x2846, 0xa81b, 0x2160, 0xa42a, 0x1dab, 0x2875, 0xa631, 0x2fb5, 0x2990, 0xabeb, 0x2523, 0x2238, 0x20c7, 0xa0f2, 0x2c21, 0x2120, 0x29e6, 0xa2d7, 0xad22, 0x3050, 0x2e38, 0x2fe6, 0xac51, 0x2de1, 0x250e, 0x29eb, 0x2b01, 0x2da7, 0xa7a0, 0xa56a, 0xa829, 0x2ecd, 0xada9, 0x2ddb, 0x2541, 0xa9c0, 0x25f8, 0xaa9e, 0x2ef4, 0x2c89, 0xaa0e, 0x2e4b, 0x22fc, 0x2e00, 0x2f33, 0x2abb, 0x2d64, 0xae06, 0xac03, 0x2e70, 0x2330, 0xa609, 0xa8bb, 0x9fc8, 0x2bfa, 0x2cdd, 0x2c7b, 0x2ea0, 0xa64c, 0xa51f, 0x29f0, 0xa84a, 0x3008, 0xac04, 0x2594, 0x13e7, 0xaea4, 0xa90e, 0xaa40, 0x29b8, 0x1ff2, 0xabca, 0x28a7, 0xa57c, 0xad12, 0xac5f, 0x29ce, 0xa943, 0x2a87, 0x2caa, 0xaf87, 0xa96d, 0xa6f8, 0xab3e, 0xa47a, 0x29ac, 0xab10, 0xa522, 0xa1b9, 0x295c, 0xaa8f, 0x2973, 0xad16, 0x3024, 0x24e5, 0xada5, 0xa9f6, 0x9984, 0x2824, 0x2b9e, 0x250e, 0x2d55, 0x2931, 0x302f, 0xa84d, 0xa8ba, 0x2858, 0x2cc6, 0x28bd, 0xad9b, 0xac76, 0xac5a, 0xaecc, 0xa972, 0xaf9b, 0x2576, 0xa52c, 0x25db, 0x272b, 0xab68, 0x2f63, 0xac62, 0x2ca0, 0xaa9f, 0x2345, 0x2a75, 0xad42, 0xa9c7, 0x1843, 0xa84e, 0xa7e8, 0xadd0, 0x2e10, 0xb013, 0x9cde, 0xa730, 0xb032, 0xa66e, 0x292a, 0x2c1b, 0x2e03, 0x2dd0, 0x285a, 0x2777, 0x2689, 0x2b65, 0x2923, 0x2c30, 0x2ac4, 0x2970, 0x1bf0, 0x2638, 0x1f92, 0x258f, 0x2535, 0xa162, 0x2643, 0xa0d9, 0xae40, 0x25a4, 0xab82, 0x27c9, 0x2edf, 0x29f7, 0x2887, 0x2635, 0x2903, 0x21f7, 0xaa8b, 0x2eb7, 0xa87d, 0x2dfd, 0x2dd2, 0xa766, 0x2c42, 0xa97b, 0xada4, 0xa8ec, 0x15d8, 0x2e2e, 0x275d, 0x204a, 0x28d3, 0xae72, 0x28cb, 0x290b, 0x2b21, 0xacb6, 0x2fd0, 0x2c59, 0x1eca, 0xac42, 0x249e, 0x9dec, 0x9d39, 0xa8e8, 0x2c55, 0xa8b5, 0xb00e, 0x2f49, 0xa0b6, 0xacde, 0xa8d8, 0xa938, 0xa5bf, 0x2d54, 0x2834, 0x21e0, 0x2e29, 0xa2d5, 0xafce, 0x2bf1, 0xad54, 0xa921, 0xac22, 0x2648, 0xa93f, 0xabde, 0x27d3, 0x2d1c, 0xade3, 0xb020, 0xa0da, 0x2606, 0xa970, 0x2bf9, 0x2eb7, 0x2644, 0x29e1, 0x2e41, 0xa95b, 0x29a9, 0xa52a, 0xaeb6, 0x2aaf, 0xa296, 0xaa2c, 0x28f2, 0x246a, 0x95b7, 0x16f0, 0x2f7a, 0x2996, 0x2453, 0x214c, 0xa0cd, 0xa6f7, 0xa933, 0xa852, 0x2b54, 0x2b09, 0x2cd9, 0x2d5c, 0x2f52, 0x23da, 0xa93a, 0xa6e0, 0xacb6, 0x29cf, 0x2f8b, 0x2c05, 0x28bf, 0x2d22, 0xa1d0, 0x2f56, 0xaf32, 0xa82e, 0xa810, 0xa503, 0xadad, 0x2ec8, 0x2f07, 0x2e50, 0x2d9b, 0x2421, 0x2610, 0x9d6e, 0x2d65, 0xaaf5, 0x213d, 0x2ad8, 0x2f59, 0xa59f, 0x2d93, 0x2d9c, 0x2efc, 0x2a4a, 0xac8d, 0x2ba2, 0xad4e, 0xab79, 0x27c0, 0x2ce9, 0xa315, 0x271e, 0x29ca, 0x9a18, 0xad37, 0x2c25, 0xaa83, 0x2812, 0xa726, 0x24ba, 0xa88a, 0xa77f, 0x2a28, 0xa028, 0x2725, 0x2be5, 0x308a, 0xa9c9, 0x26a4, 0xa934, 0x98c0, 0xab95, 0xa714, 0xae20, 0xa164, 0xa443, 0x2c6b, 0xa9f2, 0x2b5c, 0xa85e, 0xab9d, 0x28c8, 0xa636, 0x2eee, 0x2faf, 0x2e7c, 0xa858, 0x2c66, 0xa2b9, 0xa936, 0xaa74, 0xa7fd, 0x9ef8, 0xa7be, 0x288f, 0xae53, 0x2f38, 0xabe4, 0x2fdc, 0x3051, 0x28ec, 0xa4e9, 0xa62a, 0xae78, 0xa7e8, 0x2e10, 0x29fb, 0x2e99, 0x1fa8, 0x3028, 0xa76a, 0xa25d, 0xac73, 0x2ca9, 0x2b41, 0xac86, 0xa3ef, 0xa805, 0x2601, 0xa770, 0x2600, 0x2129, 0xaa9a, 0x9d94, 0x953a, 0x2f4d, 0x2763, 0x2edc, 0x2cd7, 0x29f9, 0xabfe, 0x2d88, 0x3009, 0x2d96, 0x2ea5, 0x288b, 0x2733, 0xa2c2, 0x2bbb, 0x1425, 0x9c8a, 0x28ce, 0x2d33, 0xa32b, 0x2cd1, 0xaef3, 0x2c73, 0xa43f, 0x2e75, 0x1c31, 0x2aa7, 0x2e91, 0xa4f3, 0x28eb, 0xada2, 0x21ad, 0xa80e, 0x26df, 0x28b3, 0x2c43, 0x2b10, 0x285f, 0xa678, 0x29f8, 0x9e08, 0xa597, 0x9b78, 0x973a, 0x2dd2, 0xa5a0, 0x20ce, 0x2db6, 0x2818, 0x25e4, 0x2cce, 0xac2b, 0x2c95, 0x2c5a, 0x25e0, 0xa8c0, 0xa6fb, 0xa629, 0xa890, 0x2c1b, 0xaa12, 0xa5ce, 0x25f3, 0x1871, 0xa56e, 0x910b, 0x8621, 0xaded, 0xa0c3, 0x2f0a, 0xa6a4, 0x26c3, 0x2e34, 0x261a, 0x2704, 0x2fac, 0xae7d, 0x2f7d, 0x2e3b, 0x249b, 0xb040, 0x301e, 0xae00, 0xae1f, 0xac5e, 0x289d, 0x9135, 0xb039, 0x2467, 0x18b4, 0xa71e, 0x2f5f, 0x1804, 0xac39, 0xa5f0, 0xaa03, 0xada8, 0x2af3, 0xa8f4, 0xa4c7, 0xa717, 0x2bda, 0x2be5, 0xa758, 0xaede, 0x9ec8, 0x224a, 0x2e7b, 0x2c68, 0xa132, 0xb08e, 0x2c2f, 0x29ec, 0xa548, 0x25fb, 0x2d41, 0x23ae, 0xa910, 0xac68, 0x1e6d, 0x95fc, 0xad37, 0xab2e, 0x2603, 0x2c91, 0xa866, 0x2e42, 0x2794, 0x2997, 0xa3f9, 0x1ceb, 0x2c11, 0xab89, 0x2c21, 0x2f61, 0xa858, 0xa0db, 0x2511, 0xab33, 0xa954, 0x2877, 0x9daa, 0x2c68, 0x2f25, 0x2e39, 0x2d76, 0x2be3, 0xa9c8, 0xae6c, 0x2a4b, 0x22af, 0xa841, 0xa6e8, 0xa710, 0xaabc, 0xa842, 0x2db1, 0xadcb, 0xaa9f, 0x2c30, 0x2825, 0x8db3, 0xade5, 0xabd9, 0xa8b9, 0x22c4, 0xa179, 0x2d2d, 0x2d7e, 0xac3a, 0xa5b8, 0x2c92, 0x2375, 0x2e22, 0x1f90, 0xa62b, 0x2b2f, 0x9dfe, 0xae89, 0x2298, 0xa634, 0xaba0, 0xa83d, 0x1e23, 0xa3a0, 0x2bff, 0xaacf, 0xa0ba, 0x1f98, 0xa130, 0xac1a, 0x2428, 0x2a3f, 0xabf1, 0x1d38, 0xa32b, 0x2dde, 0xaf81, 0x1c5e, 0xaba3, 0x2912, 0xa68b, 0xa8f3, 0x2dde, 0xacab, 0x2549, 0x2d10, 0x1fde, 0xa90d, 0x28f0, 0x259b, 0x2b87, 0x2578, 0x2ae1, 0xa9b3, 0xa0c3, 0xa9f6, 0x260a, 0xa515, 0xaa57, 0x2670, 0x2f92, 0x279d, 0xad69, 0xa4c8, 0x25de, 0x2991, 0x287f, 0xaa00, 0x2a06, 0xa89d, 0xa86f, 0xa44c, 0xaa7b, 0xa9da, 0x2a2b, 0xa984, 0x2a0c, 0xad7a, 0xa842, 0x9e69, 0xa690, 0x278a, 0x2dce, 0x25eb, 0x295f, 0x221e, 0x1dc5, 0xac08, 0x2d07, 0xac43, 0xad1e, 0xa114, 0xae15, 0x2dba, 0xa915, 0xa2d9, 0x2faf, 0x2c34, 0x25d7, 0x2dda, 0xa585, 0xa913, 0xa5af, 0x2c06, 0x2f73, 0xa702, 0xac86, 0xa863, 0xad72, 0x2825, 0x293b, 0x2eda, 0x2d7e, 0xabcf, 0x2a94, 0x284d, 0x2c59, 0xa867, 0xaab8, 0xaa82, 0x2998, 0x9e85, 0x2aa2, 0x2fa4, 0xa44f, 0xaa31, 0x2f24, 0x2e7d, 0x281b, 0x29af, 0x268d, 0x2e30, 0xa8a1, 0x2fa7, 0xab9b, 0x21c5, 0x2c97, 0x9f33, 0x1064, 0x2c52, 0x281d, 0x2ab8, 0xa94f, 0xac11, 0x22cc, 0x2989, 0xa8a7, 0x28ae, 0x2e6a, 0x29aa, 0x2d69, 0x2cca, 0xa437, 0xada8, 0x23e4, 0xaa27, 0xaa5c, 0x2ec9, 0xa924, 0x1981, 0xae0a, 0x3006, 0xacc7, 0x2c33, 0x2e06, 0xaa00, 0x1e6d, 0xa7e6, 0x2e9d, 0x256c, 0xa6c2, 0x2b58, 0xaf17, 0x9943, 0xae45, 0x9c40, 0xae46, 0x2e8f, 0x2fa9, 0xaa90, 0x2c35, 0x2930, 0x2c35, 0x26f1, 0x240f, 0xa9b0, 0xac64, 0x2d83, 0xa571, 0xa20b, 0x299c, 0xaebe, 0xaa42, 0x2c46, 0xa9b8, 0xa847, 0xa83e, 0x2787, 0x2009, 0x2f2a, 0xac1f, 0x2a67, 0xab74, 0x2a39, 0x2d80, 0x2acb, 0xa983, 0xa82e, 0x2c6c, 0x2a92, 0x1e7c, 0xa2c5, 0x2e01, 0xa303, 0x2938, 0x263f, 0x3027, 0x221f, 0x2f6e, 0xa9b5, 0x2b53, 0x2e19, 0xa3ba, 0x25ff, 0xa769, 0x2c6a, 0x2af2, 0x15df, 0x2d9d, 0x2963, 0xa91f, 0x3012, 0x2566, 0x2d32, 0x2688, 0x2fa6, 0x9864, 0xa965, 0xadaf, 0x9222, 0x292d, 0x296e, 0xa8f7, 0xa6ca, 0xa2de, 0xab9e, 0xa6e8, 0xa16c, 0xa647, 0x2c65, 0x3066, 0xaf89, 0xa8ce, 0x2973, 0xa996, 0x2a4b, 0xa931, 0x22b2, 0x2942, 0x1a74, 0x2dfd, 0x1bb9, 0x2ceb, 0xae28, 0x2d14, 0x297f, 0x2639, 0x2f14, 0x2987, 0x2e96, 0x2f69, 0xa825, 0x2d36, 0x27b8, 0x2b65, 0x2893, 0x29c2, 0xa6bf, 0x9ccf, 0x9dae, 0xabf1, 0xad11, 0xa5eb, 0x85e4, 0xa0d0, 0x28b2, 0x2c1c, 0xaa22, 0x2b0d, 0x2d12, 0xaa49, 0x2048, 0xa9a8, 0x25f9, 0x2fa1, 0xa685, 0x2f33, 0x2977, 0xb283, 0x30b5, 0xab73, 0x2aeb, 0xae58, 0x2c54, 0xb062, 0xa0b1, 0x281b, 0xad14, 0x2846, 0x3038, 0x2b03, 0x2334, 0x253c, 0x2bad, 0x252b, 0x3049, 0x2997, 0x2d1c, 0x1c2c, 0xa50d, 0x2942, 0x2e79, 0xae3b, 0x1ccc, 0xab4b, 0x2e0b, 0x251c, 0x320c, 0xad62, 0x30e5, 0xae1a, 0x2689, 0x2ef8, 0xabdb, 0x1d31, 0xaf5c, 0x302a, 0xa7a3, 0xa485, 0xae76, 0x305f, 0x286d, 0xa4ec, 0xa9b4, 0x2d0b, 0x2cbd, 0x2de4, 0x24b9, 0x2993, 0x1884, 0x2c55, 0x2c65, 0x2d2c, 0x2f16, 0x2a64, 0x2d4e, 0x2f40, 0xa1b5, 0x314f, 0x2e71, 0xa725, 0x306b, 0x2f77, 0x2209, 0x9a94, 0xaaa7, 0x2afb, 0xac4a, 0x20a6, 0x2fb2, 0xa97d, 0xa29c, 0xac8a, 0x288f, 0x2f65, 0xa87b, 0xa53a, 0x2c75, 0x2c64, 0xb097, 0xa602, 0x25a8, 0x2162, 0x2c1e, 0x9b30, 0x28c8, 0x2ae5, 0x9bb0, 0xaa66, 0xad94, 0x1c41, 0xb0b8, 0x26fc, 0x2529, 0x17f5, 0x1f7b, 0xa16d, 0x2efa, 0xa577, 0xac01, 0x30cf, 0x2fd4, 0x2c45, 0xa7fa, 0x2ca3, 0xa528, 0xa64d, 0x28e9, 0x2e9b, 0xadac, 0x9e80, 0x2b3d, 0xaf5b, 0xaaec, 0x2b19, 0x9a07, 0x2871, 0x3020, 0xaa50, 0xa7d2, 0x2237, 0xae2a, 0x302a, 0x309b, 0x2c4a, 0x2a49, 0xa899, 0xa856, 0xae47, 0xac88, 0xa071, 0x2e16, 0xac00, 0x2f3f, 0x3068, 0x2065, 0x2a6e, 0x293a, 0x2f20, 0x2600, 0x2d58, 0x2c1f, 0x2be0, 0xa4a9, 0x28b5, 0xaba0, 0x27bf, 0x2cfc, 0x24b0, 0x307c, 0x2e9e, 0x2a78, 0x1906, 0x2cb3, 0x2a49, 0x2c03, 0x2efd, 0x28ff, 0xacf8, 0xa118, 0x2ba4, 0x2044, 0x2ccc, 0x2bad, 0xa78f, 0xa91d, 0xa470, 0x1d59, 0x2bb3, 0x29a6, 0x28a3, 0x28f0, 0x26f9, 0x2a6f, 0x2f5a, 0xa370, 0x2e5c, 0x9cfb, 0xa154, 0x2e71, 0x8a40, 0x267d, 0xa64a, 0x2ead, 0x2cff, 0x21aa, 0x2b7b, 0xaa61, 0x2d34, 0x2f7a, 0x29ab, 0xa5ae, 0xab5c, 0xaacf, 0xa933, 0x2ddc, 0x9b9c, 0x2fc9, 0xab7a, 0xaa47, 0x25dc, 0x2071, 0x2819, 0xa1d1, 0x27ed, 0xa38a, 0x1fce, 0xb04f, 0x2b57, 0x2577, 0xa8cb, 0xa252, 0x2917, 0x29c2, 0x2c6b, 0x29c2, 0x2462, 0xab8a, 0x289a, 0xa813, 0xa598, 0x2a46, 0xa90f, 0x2873, 0xa83f, 0x1afe, 0x1909, 0xaaa9, 0x2529, 0x2ca1, 0xa992, 0xa8b7, 0x2838, 0x2356, 0x2fae, 0x9f4a, 0x2b62, 0x2525, 0x2ec8, 0xa8f9, 0x2ecc, 0x2f2c, 0x2c77, 0x2a01, 0x2b95, 0x2913, 0x2458, 0x958a, 0x2ea6, 0xad7b, 0x2cee, 0xa200, 0x2f48, 0x2f04, 0xa8e9, 0x2dee, 0xac9b, 0xa21f, 0x98c3, 0x25dd, 0xa51d, 0x20b6, 0xa9a6, 0x2644, 0xaddf, 0xac08, 0x2b59, 0xa857, 0xaa73, 0xac99, 0x2cc2, 0x2cfd, 0x2f23, 0xaadc, 0x9ef8, 0xabee, 0x2ed1, 0xa7a9, 0xa9c6, 0x2f05, 0xa833, 0x29c0, 0xad07, 0xaa4c, 0xabbf, 0x1543, 0x2c07, 0xa85a, 0x2c6f, 0xaf1d, 0xa85b, 0x27f9, 0x2cbc, 0xae5b, 0x28ba, 0xac99, 0x25f2, 0x2863, 0x246c, 0xaab8, 0x2c6a, 0x251e, 0x28f7, 0xaf3c, 0x2c60, 0x2823, 0x2d12, 0xada2, 0x2797, 0xa887, 0x26e5, 0x2359, 0x2dc9, 0xa967, 0x20ee, 0x2af2, 0xa588, 0xad93, 0x2625, 0xaa90, 0xac8b, 0xacc8, 0xa5b6, 0xa936, 0x2c5c, 0x263c, 0xa9d8, 0x28fd, 0xadb5, 0x2f39, 0x2d72, 0x2ba2, 0x2a16, 0x9e9c, 0x282f, 0x26f0, 0x2d6e, 0x17f9, 0x2a59, 0x1e02, 0x2fc7, 0xa9af, 0x26b6, 0x2a34, 0x197a, 0x23f7, 0xad96, 0xaef7, 0x223e, 0xada4, 0xa5f8, 0x264b, 0x2476, 0x2cf4, 0xab5a, 0xa8e6, 0x2ba3, 0xa239, 0x2277, 0xab21, 0xa158, 0x2d02, 0x9b71, 0x28fd, 0x24de, 0x189b, 0xaadc, 0x2a2c, 0xa255, 0xaaa8, 0x2569, 0x2a01, 0x21b3, 0x9b38, 0xa865, 0x2e58, 0x19d6, 0x2328, 0x2539, 0x2226, 0x2e50, 0x2368, 0x2d14, 0xaae8, 0xabb9, 0x27dd, 0xac42, 0x2a1e, 0xace3, 0x2b96, 0x2c31, 0xad00, 0x2a2f, 0xa920, 0xa791, 0x21a9, 0xa8b5, 0x257a, 0x24c6, 0x2e78, 0x2f91, 0x24fa, 0xa7a3, 0xa50b, 0x2e22, 0xa3cc, 0x200e, 0x2f34, 0xaf7c, 0x2efc, 0x9ade, 0x2d47, 0xac48, 0x2cb5, 0x27e3, 0xa963, 0xaa81, 0xacca, 0xb060, 0x2758, 0x2d0a, 0x18f4, 0xac41, 0xaa84, 0x205a, 0x1e8c, 0x2c07, 0xa4c5, 0xa4f0, 0xab1f, 0xa6e6, 0xacb8, 0xad5b, 0xadc5, 0x2f7a, 0x24e7, 0x2f78, 0x2001, 0x1cb8, 0x2f61, 0x2324, 0xad81, 0xa50c, 0x2e9a, 0xa65b, 0xacef, 0xadec, 0xa08b, 0xad11, 0xa01a, 0x2e81, 0xadf2, 0x2e21, 0xacf1, 0x9812, 0x286f, 0x9bd4, 0x2df3, 0x2c04, 0x1fa4, 0x26ec, 0x9a47, 0xad50, 0xaa6e, 0x255e, 0xa871, 0x279b, 0x2217, 0x2a07, 0x2ba2, 0x1c36, 0x2c52, 0x2216, 0xa9bf, 0x23f2, 0xad7c, 0x249d, 0xacf4, 0x2b4e, 0x28ec, 0x2ebd, 0x2bae, 0x1f4d, 0x2bc7, 0xac64, 0xa817, 0x1e32, 0xa158, 0x2cff, 0x2ee7, 0x2dff, 0xa916, 0xad76, 0xab19, 0x2787, 0xacc9, 0xa973, 0x2d84, 0x27ee, 0x269a, 0x29b1, 0x2f15, 0xa0ef, 0x2248, 0xa9f2, 0x1707, 0xa613, 0x2f0a, 0x262e, 0x2d84, 0xad02, 0x28d4, 0xb03b, 0x1a6a, 0x2e12, 0x2d09, 0x2833, 0x2b50, 0x29b6, 0x305b, 0xa73d, 0x304c, 0x301d, 0xac06, 0x2c70, 0x2d9a, 0xa535, 0x2ca1, 0xac93, 0x25b6, 0xa99c, 0x2590, 0xb070, 0x2906, 0x287c, 0xae4f, 0x2680, 0xa91b, 0x2c44, 0xa8d6, 0x2dd6, 0x2507, 0x2af3, 0xa5bd, 0x2eec, 0x29b2, 0x2c6e, 0x2a8b, 0xa9d1, 0xa6c9, 0x2503, 0x27c7, 0xad9a, 0x1a7d, 0x24c3, 0x2e32, 0x2d4b, 0x1c20, 0x2f84, 0x2440, 0x2a7c, 0xa947, 0x2cfe, 0xa953, 0x2a8f, 0xa76a, 0x2a91, 0xad16, 0xac3b, 0x227c, 0x2dcf, 0xab25, 0xa4ff, 0x2ae7, 0x2ec7, 0x2a9a, 0xa1d6, 0x2c19, 0xa0e4, 0x203d, 0xad3f, 0xa48a, 0x2859, 0x287e, 0x28bd, 0xaeba, 0x9b13, 0x281a, 0xabc6, 0x2eb6, 0x2ef8, 0xb053, 0x2bcd, 0x2801, 0xaa8e, 0x28cc, 0x2e0b, 0x2dac, 0x2e52, 0xa4d1, 0x2ab8, 0xaac4, 0xa415, 0xa48f, 0xacf7, 0xa324, 0xacb6, 0x2ad0, 0xa80a, 0x276a, 0x2abe, 0x2fe1, 0x2add, 0x29f7, 0x2bc9, 0x2cb2, 0x9a7e, 0xae2c, 0x2d57, 0x29cb, 0x99a5, 0xa0aa, 0xa466, 0x1930, 0x2d34, 0x2d05, 0x2c83, 0xa99a, 0x2a99, 0xa638, 0x9f31, 0xac6d, 0x29a4, 0xadb7, 0x2cec, 0x2cbb, 0xa8a0, 0x2c2e, 0x28d6, 0x2453, 0x2f95, 0xa261, 0x2961, 0x1f8a, 0x2e9f, 0x2cd5, 0xa9c9, 0xa02e, 0xa9c3, 0xad6e, 0xa948, 0x2abc, 0xa9ed, 0x2f90, 0xa7f9, 0xa927, 0x2ec4, 0x2c20, 0x3003, 0x9db2, 0x300e, 0xaf10, 0x9c3d, 0x2f5f, 0x2d7e, 0xa52f, 0x1016, 0xaacd, 0xa8e6, 0x9395, 0xa4f4, 0x243b, 0xa39d, 0x27c7, 0xa8f8, 0xa49a, 0xa39a, 0x27a0, 0xa497, 0x2a32, 0xa9fc, 0xa9c7, 0x2e0c, 0x248f, 0x2cbf, 0x250b, 0x27b3, 0x2ec9, 0x2c1f, 0x2b8d, 0xabc4, 0xadbf, 0x2982, 0x2eb2, 0x2109, 0x2e2b, 0x2868, 0x2da4, 0xa4eb, 0x2cdb, 0x29a7, 0xada8, 0x2bbe, 0xa424, 0x2609, 0x2cc1, 0x2f7a, 0x257e, 0xa836, 0xab7f, 0xa7c7, 0x2b9c, 0x187b, 0xa968, 0xa875, 0x13bf, 0x2b5a, 0xad35, 0x2a2d, 0x3064, 0x2e62, 0xaa6c, 0xa841, 0xa367, 0x28af, 0x2dd4, 0x22b8, 0x2d28, 0xa547, 0x2e47, 0x2811, 0x2bd4, 0x28fe, 0xa930, 0xad52, 0x2f1f, 0xa718, 0x1051, 0xa63e, 0x2d90, 0x23d0, 0x2c93, 0x2946, 0x2efe, 0x2e47, 0x2a11, 0x2020, 0xa910, 0xa809, 0x1e12, 0x2403, 0x2fd7, 0xa6a7, 0x2d3a, 0x29f3, 0xa667, 0x2c30, 0xa569, 0xa5cc, 0x27b4, 0x1c5e, 0x2ebf, 0x20a1, 0xaab0, 0x2777, 0xa7d5, 0xb056, 0x9f56, 0xa850, 0xaba9, 0xadb5, 0x2f6a, 0x189f, 0x2c03, 0x2f3f, 0xa18d, 0x2b6b, 0x3017, 0x1db3, 0x2908, 0xa527, 0x2a9a, 0x2c5f, 0x271c, 0x1233, 0x2c8c, 0x9b33, 0x29ab, 0xa504, 0x2ed1, 0x2e1d, 0xa5c4, 0xa88c, 0x288d, 0x282d, 0xaa20, 0x1b9a, 0x2e39, 0xa041, 0xad7a, 0x246b, 0xa157, 0x2fb6, 0x296e, 0x2d6b, 0x2d67, 0xac4d, 0x284a, 0xa759, 0x2d6f, 0xaa90, 0xad64, 0x2f1a, 0x2be0, 0x2df2, 0x24c4, 0x22ff, 0x16b0, 0x296b, 0x20a3, 0x2dee, 0x2bfa, 0x2a9f, 0xaab9, 0x2e1d, 0xac66, 0xa19e, 0x14a4, 0x2b4f, 0x280b, 0x2bed, 0x2ab1, 0x24f1, 0x2ad8, 0xad13, 0xadd5, 0x282c, 0xa3f8, 0x2c8d, 0x2b8e, 0x26c1, 0xa279, 0xa971, 0x2313, 0x27ee, 0x254a, 0x1a4c, 0xa852, 0xa33e, 0x29f3, 0x2e4a, 0x240d, 0x2e60, 0xac89, 0xa83f, 0xa55f, 0xa159, 0x248e, 0xac5f, 0x28a8, 0x2b28, 0xa59b, 0xacf2, 0xa9d9, 0xac80, 0xab7e, 0xa29b, 0x2dcf, 0x2e22, 0x2d40, 0x25e6, 0x288b, 0x2cda, 0x2cd6, 0x2e31, 0x2353, 0xa4b3, 0x29f5, 0xa153, 0x2f7a, 0x2e5b, 0x2900, 0x2c6a, 0xaa33, 0x9a8b, 0x9954, 0xad09, 0xad21, 0x2f7f, 0x280f, 0x2e5e, 0x1f4b, 0xaa9c, 0x27f9, 0xac7d, 0x9ec0, 0xad9a, 0xa940, 0x24b2, 0x2d03, 0xad75, 0x2538, 0x24c6, 0x9ed5, 0x2989, 0x2f5c, 0x303d, 0x268d, 0x27d6, 0x9b78, 0x9e68, 0x2c91, 0x2ca8, 0x2af4, 0x2411, 0x2ee0, 0xae60, 0x2daf, 0x270f, 0xa76e, 0xa558, 0x29ba, 0x2ffa, 0x2ebe, 0x284e, 0x29d3, 0xab9f, 0xa925, 0x3012, 0x25d8, 0x2d6b, 0xae55, 0x2ce8, 0x1339, 0xa679, 0x2b80, 0x1ae2, 0x2f60, 0x18c1, 0xa799, 0x2a73, 0x2538, 0x2a9d, 0x20c2, 0x2b3c, 0x1d24, 0x2ccd, 0x3046, 0x2e19, 0x2150, 0x269d, 0x272b, 0x2979, 0xac04, 0x2b9c, 0x9d4d, 0x2e04, 0xa6f0, 0xa389, 0xa215, 0x2a31, 0x2dc9, 0xa6a6, 0x29a6, 0x1feb, 0xa5cf, 0x2671, 0xa9f2, 0x25d1, 0x981e, 0x2679, 0x292c, 0x246a, 0x28e3, 0x2899, 0x2814, 0x2335, 0x2924, 0x2aeb, 0x2c9a, 0xa9b8, 0xa88f, 0x20a3, 0xa856, 0x2e0e, 0xaa45, 0xa7de, 0xadbe, 0xa17a, 0x2d75, 0xa3dd, 0x2eec, 0x1e0e, 0x2c66, 0xa46b, 0xa69c, 0x1ffc, 0x2cc2, 0xa32c, 0x2d68, 0x2945, 0x24bf, 0x2c8d, 0x9cc3, 0x2c69, 0x2938, 0x2048, 0x1f1a, 0x2f84, 0x22ba, 0x2942, 0xa504, 0x2c2d, 0x2b7e, 0x2856, 0x2211, 0x25a7, 0xabfb, 0x2a9b, 0x2d12, 0xa9ec, 0xaeb6, 0xa95d, 0x29d1, 0xa8c2, 0xaac3, 0x2968, 0x2113, 0x2c8e, 0x291e, 0xab3a, 0x8d5e, 0xa815, 0x9d8d, 0x26d8, 0xaa87, 0x2c83, 0x1a39, 0xabe9, 0x2896, 0x2b78, 0xa448, 0xac66, 0xabc9, 0xa444, 0x27ce, 0xae1e, 0xaab5, 0x2480, 0x28b2, 0xa106, 0x2d9e, 0xa193, 0x2d04, 0xae84, 0x2e16, 0x2600, 0x3083, 0x2989, 0x286c, 0x2db6, 0xab6d, 0x20d4, 0xac03, 0x2a40, 0xa8a6, 0x987a, 0x198c, 0x2bcd, 0xa81f, 0x2d4d, 0xa5d7, 0x2c23, 0x2961, 0x2bcd, 0x2f9c, 0xa512, 0xad11, 0x9d2a, 0x2cad, 0x2b72, 0x2e66, 0x3039, 0xa96e, 0xad04, 0x2d10, 0x220d, 0x2c06, 0x168a, 0xacb7, 0xabfc, 0x2c27, 0xaa7c, 0x256a, 0xacae, 0xa60f, 0xad9a, 0xa49c, 0x2afa, 0xad89, 0xa62b, 0x2e32, 0xa957, 0xb037, 0x29da, 0x2bc6, 0x1eea, 0xad45, 0x2c1c, 0xa670, 0xad7c, 0x2c0e, 0x28cd, 0xaa5e, 0x294e, 0x21c4, 0x1eae, 0x2d74, 0x2da0, 0xace0, 0xa9aa, 0xa62c, 0x9eee, 0x94b6, 0x2b00, 0x2c64, 0x2923, 0x26d8, 0x2c8a, 0x1c84, 0x2c01, 0x2c43, 0x2e0c, 0xa861, 0x2cce, 0xab6b, 0x2d5f, 0x9c36, 0x9d51, 0xaa59, 0x2cfe, 0xa8b9, 0xa735, 0xadf2, 0x2138, 0xa531, 0x2fa8, 0xad31, 0xaaab, 0x2c05, 0x1e95, 0x25c6, 0x27d7, 0x9ce0, 0x2ca4, 0x2760, 0xa724, 0x2f40, 0x243c, 0x2ad1, 0xa9d5, 0x2947, 0xa9d8, 0x2eb5, 0xa78a, 0x2e92, 0x2a26, 0x284f, 0x2831, 0xa7ca, 0xa1c7, 0x07f2, 0xa236, 0xae8d, 0xa87e, 0x9e30, 0x29d0, 0x2d26, 0x2788, 0x2787, 0x2a15, 0x2474, 0xaecd, 0xa913, 0xae81, 0x2cab, 0x9c0b, 0x23e4, 0x2d5d, 0x105c, 0x2737, 0xa3b2, 0xa40c, 0x2fd1, 0xa9a6, 0xa605, 0xa277, 0xa158, 0xa60d, 0x9d8f, 0x1e65, 0xaebe, 0xab64, 0xa5fd, 0x2dcc, 0x2dee, 0xa823, 0x2c4f, 0x2924, 0xa569, 0x1ca4, 0x2b08, 0x2a1f, 0xa813, 0x297d, 0x22a2, 0xa1cc, 0xaa7c, 0xa8ff, 0x9e22, 0x2e89, 0xad14, 0xa381, 0x2752, 0x2c34, 0x2e30, 0x2e6c, 0x2f20, 0x2763, 0xaaa8, 0xae15, 0x23fb, 0xaa00, 0xac6b, 0x92f9, 0x2abf, 0x2669, 0xaa61, 0x2c25, 0xa907, 0x293c, 0x259a, 0xaa54, 0x2b86, 0x2cac, 0xacaa, 0xa471, 0x9fd5, 0xa004, 0x2dfa, 0x14f1, 0x2c72, 0x29b8, 0x2f0c, 0x249a, 0x2b7b, 0xa80e, 0x2a79, 0x20dc, 0x9c9d, 0xacf2, 0xad1f, 0xa912, 0x2524, 0x2d83, 0x28bc, 0x2d2d, 0xa868, 0x2197, 0xa8ca, 0xaa7a, 0x2dc7, 0x9ce0, 0xa7c4, 0xaa47, 0x2d85, 0xa450, 0x22ee, 0xae3d, 0x2891, 0xac38, 0xa57e, 0x2903, 0x1dc1, 0xac82, 0x2d4c, 0x214d, 0xa873, 0x29dc, 0x2f55, 0x1e39, 0x2a5e, 0x259f, 0x2f95, 0x28ae, 0x9c2f, 0x2632, 0xaa0b, 0xac24, 0x2e0b, 0x2222, 0xa9d5, 0x2d73, 0x2d14, 0x20ab, 0xa9d5, 0x2ed1, 0xa95b, 0x2dc3, 0x2f7f, 0xa989, 0x188e, 0x2904, 0x2adb, 0xa466, 0x246e, 0x2d54, 0x2c5a, 0x29c8, 0x2632, 0x26b9, 0xa8fe, 0x2ca4, 0x1b89, 0xa06f, 0x2d33, 0x25b6, 0xa89c, 0x8921, 0x2872, 0x29d8, 0x2d2d, 0xab7c, 0xa644, 0x2d1a, 0xad72, 0xa87c, 0xa908, 0x2ec3, 0x27db, 0x2ff7, 0x2f65, 0xa9fe, 0x2a0e, 0x2e37, 0xad04, 0xa880, 0xabc5, 0x2c79, 0x2db2, 0x12f2, 0x2618, 0x2c26, 0xad26, 0x261c, 0x2da0, 0xaa49, 0x9fc1, 0xa1ee, 0xa8ad, 0x2fb4, 0x2c7d, 0x2d35, 0x2812, 0xa894, 0x2a99, 0xa23d, 0x2bc7, 0x2b65, 0xac60, 0x27ad, 0x2868, 0xacdd, 0xabbc, 0x240f, 0x2a69, 0xaa40, 0x2ce1, 0x2c40, 0x2b95, 0xa84c, 0x9d01, 0x2ce9, 0x92ba, 0xa640, 0x29ee, 0xa965, 0x2d5c, 0xa7af, 0x241e, 0x28f9, 0x27a7, 0xa373, 0x2f42, 0x2031, 0x28f7, 0x16b7, 0x27ef, 0x2caa, 0x9b85, 0xaa39, 0xaa8e, 0x2e6c, 0xaca4, 0x2dde, 0x2a48, 0x2f37, 0xafdc, 0x2ccb, 0x2075, 0x2db1, 0xac90, 0x2ad4, 0x21e0, 0x29ea, 0x9f1e, 0x2e96, 0xa6b5, 0xa291, 0xa788, 0xab63, 0x9c31, 0xa3a9, 0xa0f7, 0xa586, 0xa0ce, 0x2c79, 0x2f2c, 0x2cfd, 0xaef6, 0x25cf, 0xaccb, 0x1890, 0xaaa8, 0xa8a1, 0x2795, 0xaaa2, 0xaa16, 0x28a3, 0xa7e0, 0xa6f8, 0xa482, 0xacf4, 0x2daa, 0xaf40, 0x2c6b, 0x2e92, 0x2fc4, 0xa827, 0x9a95, 0xa778, 0x2cec, 0x9d28, 0xa7de, 0xa9d4, 0x22c4, 0x24ab, 0x2fd9, 0xa598, 0xa997, 0x2992, 0x2a05, 0xad6a, 0xab78, 0x2537, 0x2ad0, 0x92de, 0xa4e4, 0x2c02, 0x2650, 0x2e22, 0xa057, 0x2d88, 0x2df9, 0x27c2, 0xaa96, 0x2bb4, 0xa47b, 0xa8e7, 0x9316, 0x2c6d, 0x1a17, 0xa26b, 0xa01c, 0x2639, 0xae84, 0xaef3, 0x3008, 0xaafe, 0x2a79, 0xa8f5, 0x2c5f, 0x2406, 0x2866, 0xa472, 0x2b0c, 0x2a36, 0x3024, 0x9f39, 0x2cf3, 0xacf4, 0x244a, 0x2f3f, 0xac5f, 0x2ace, 0xaceb, 0xa848, 0x2b75, 0x2c30, 0xaae7, 0x2c85, 0x2f90, 0x2b25, 0xac27, 0xa5b6, 0x2cb3, 0x2e56, 0xa7c7, 0x2a10, 0x2c3a, 0x2ade, 0xaaac, 0x2818, 0x2d62, 0xafc1, 0x2bb7, 0x2a9d, 0xa934, 0x23f5, 0x2071, 0xa6ef, 0xab67, 0xa74c, 0x284b, 0xac23, 0x2723, 0x2bc7, 0xa7e1, 0x2d00, 0x28de, 0x2cea, 0xa92b, 0xa562, 0x2d95, 0xad42, 0xae14, 0xa88e, 0xa912, 0xa98b, 0x2b3a, 0xa79d, 0xa70e, 0x2cb6, 0x2714, 0x2c39, 0xa8eb, 0xa8e9, 0xae52, 0x2fbb, 0x2494, 0x0c29, 0xad8a, 0x2840, 0xac3d, 0xaa7b, 0xacff, 0x280d, 0x2c48, 0x24b0, 0x268a, 0x2c7d, 0xa9c2, 0x2b55, 0x2ad6, 0xa505, 0xa43d, 0xa7ab, 0xabe3, 0x2c1c, 0x2fb9, 0x29ce, 0x24cf, 0xac31, 0x22ec, 0xaa62, 0xa22e, 0x211b, 0xa888, 0x2a58, 0xa6c2, 0x20cc, 0xacdd, 0x292f, 0x2d3d, 0x2b18, 0xa9a4, 0x9ee0, 0xaa04, 0xad56, 0xa826, 0x2b60, 0xac62, 0xada3, 0xa816, 0xaca0, 0xae06, 0xac58, 0xac64, 0x2903, 0xad12, 0x2cbe, 0x9c1c, 0x9f56, 0x25bd, 0x2810, 0x2aa3, 0x2e34, 0x24c1, 0x295a, 0x2800, 0x2131, 0x2ca6, 0x1d28, 0xa8d1, 0x24de, 0x1b02, 0xa6c1, 0xa1cb, 0xa616, 0xabc4, 0xad86, 0x2c3d, 0x29ac, 0xa623, 0xa906, 0x2b0e, 0x26f8, 0xabc4, 0x2f0b, 0xad0d, 0xae7e, 0x2608, 0x2e06, 0xa9c7, 0x2a5f, 0x975e, 0x259f, 0xa2c2, 0xa83f, 0xa89c, 0x2c0a, 0xa741, 0x273f, 0x1ce0, 0xa65e, 0xac53, 0x1f64, 0xa416, 0xa93f, 0x9df6, 0xab08, 0x2fb8, 0x2b5a, 0xa84b, 0xa711, 0xa88f, 0x3002, 0xa6ba, 0x2b3a, 0xa987, 0xa61d, 0x29a3, 0xaa04, 0xb023, 0xabfd, 0xab99, 0x2c7e, 0x2ab4, 0xa7dd, 0xa974, 0x2db2, 0x295e, 0x2c84, 0x2e34, 0x2d7e, 0xa5d4, 0x2826, 0x2d5b, 0x2cb1, 0x2827, 0xa321, 0xa067, 0x2e1c, 0xab98, 0x1c41, 0xaa39, 0xacd6, 0x2cb9, 0x23be, 0x2e8b, 0x2846, 0xa596, 0xac0f, 0x2d22, 0xaa03, 0x1a92, 0x2bc9, 0x2332, 0x1f22, 0x2c59, 0xac3e, 0x24f1, 0xaec8, 0x2e18, 0x2dad, 0xa20f, 0x2a7a, 0x209b, 0x2d5d, 0x2e2c, 0xa8ba, 0x2549, 0x930c, 0xa6a7, 0x2d11, 0xaa34, 0x2960, 0xa4d2, 0x27f2, 0x1454, 0x2cf6, 0x28fb, 0x2c69, 0xad04, 0x2d52, 0x2d6f, 0x2e2d, 0xa1b1, 0x2c45, 0x2dd6, 0x2f7a, 0x1a4f, 0xafa6, 0x2c37, 0x2490, 0xaa56, 0x2657, 0x2b84, 0x2c9b, 0xaa6e, 0x249c, 0x3065, 0x9d73, 0x3023, 0xacef, 0x23a3, 0xa01a, 0x9d58, 0x2cf0, 0x98a1, 0x28eb, 0xa9d2, 0xac6f, 0xa6fe, 0xac91, 0x2740, 0x2e9b, 0xa356, 0xa7fc, 0x2e5b, 0x2f7a, 0x2a30, 0x2d2c, 0xa933, 0x2f7a, 0x2f30, 0x9b5a, 0x2d46, 0x2cc3, 0xa855, 0xac5c, 0x2ccc, 0x9ebf, 0xa721, 0xa200, 0x2ffa, 0xa688, 0x2b4a, 0x2900, 0x9d9e, 0xac3d, 0x2e58, 0xa9b4, 0x2d16, 0xac75, 0x2a74, 0x2c87, 0x2dae, 0x3001, 0x28be, 0x9fba, 0x2c20, 0x25d2, 0x2f6e, 0xa5c6, 0xaada, 0x2d77, 0xa9e2, 0xa28a, 0x9e7c, 0x2574, 0xacc1, 0xade4, 0x2c7f, 0xac0c, 0xad25, 0xacf3, 0xa850, 0x2632, 0x2624, 0x2977, 0x2efa, 0x19f4, 0x2d2f, 0x9ccd, 0x2cb9, 0x2999, 0x9fb1, 0x2def, 0xa021, 0x2f58, 0x2e30, 0x226c, 0x2586, 0xa847, 0xa958, 0x2df5, 0x2819, 0x2a38, 0xad3d, 0x16b2, 0x2f90, 0x2ebc, 0x2c9d, 0xa5ca, 0x2d1f, 0x1056, 0x2ae4, 0x291d, 0x2de6, 0x2718, 0x2571, 0xad85, 0x2fe1, 0x2dc5, 0x239b, 0x2e2e, 0x2c4f, 0xaecd, 0x9b80, 0x2d86, 0x1c31, 0xa49b, 0x2950, 0xa808, 0xad31, 0xac9a, 0xabbc, 0x9f7a, 0x2e1a, 0x2e44, 0x216f, 0xad31, 0xaa3a, 0x2c04, 0xa6fa, 0xa849, 0x2e85, 0x2f88, 0x2b5b, 0x1ea5, 0x1d79, 0x24e7, 0x2cff, 0xa659, 0x276c, 0x24c3, 0xab8b, 0x2d83, 0xa7f7, 0x28f3, 0xacc8, 0x9b9c, 0x26eb, 0x19f6, 0x1d8a, 0xaaad, 0xac7a, 0x2a26, 0xadbf, 0x2899, 0x21a5, 0x2851, 0x2c71, 0xaaad, 0x1091, 0x2916, 0x2e2f, 0x100d, 0xae3f, 0x25a0, 0xa191, 0x280f, 0x28cd, 0xa42e, 0x2b6d, 0x927c, 0xa7d5, 0x3016, 0xac7c, 0xa2f2, 0x2dc1, 0x2f1f, 0xa873, 0x2831, 0x2649, 0x291e, 0x26db, 0x2c73, 0xb014, 0xac88, 0xa67a, 0x2794, 0x2be1, 0xa7e2, 0x1fa4, 0x2ead, 0x26d3, 0x2ce9, 0x2c0f, 0xa38d, 0xaf4d, 0xa0bf, 0x989e, 0x2915, 0xa7b2, 0xaf3b, 0xac4e, 0xa5d0, 0xad05, 0x2c09, 0xa99a, 0x2b4c, 0x2943, 0xab93, 0x2fcc, 0x2245, 0x9ee7, 0xa0bb, 0x2c8a, 0xab7c, 0x2b16, 0x2c5e, 0xa66d, 0xac05, 0xa4a5, 0xa910, 0x2cae, 0x29b5, 0x27bb, 0xa4a9, 0x2120, 0xa948, 0x1c78, 0xa352, 0xac8d, 0xacd8, 0xa5b9, 0xac2c, 0xa852, 0x233f, 0x2bd1, 0x98c9, 0xabac, 0x2b57, 0x28b2, 0x2c5b, 0x2fbb, 0xa969, 0xac94, 0xa8f0, 0xa4c8, 0x2d57, 0x2600, 0xac13, 0xa69b, 0xac81, 0x2c09, 0xa5bd, 0x2dc7, 0x2da8, 0x20f6, 0xa1bd, 0x2d1f, 0xae7c, 0x2d38, 0x2976, 0xa666, 0xac21, 0x2e7e, 0x0ef3, 0x2d64, 0x2836, 0x2c61, 0x2eb4, 0x2a3e, 0x2d69, 0x2d06, 0x2c58, 0x2d6f, 0x2451, 0xace7, 0x299a, 0xa582, 0x2860, 0xa50a, 0xa9d0, 0x2dad, 0x22a1, 0x2dcc, 0x25b7, 0x28ef, 0x9fd5, 0x9ae2, 0xaaaa, 0x2da7, 0xaf2c, 0x2f22, 0x2c98, 0x2be8, 0xa59a, 0x2a2b, 0xa483, 0xaaba, 0xa564, 0x241a, 0xa942, 0xa010, 0xa98c, 0xa57b, 0xa78c, 0x308c, 0xa418, 0x1e22, 0xa868, 0x96d8, 0x2c72, 0x3021, 0x3005, 0x2be6, 0x2b2d, 0xacc5, 0x2370, 0x2d47, 0x23cb, 0xaa45, 0x9fce, 0x25a9, 0x1cb1, 0x27d8, 0xa996, 0x9b1b, 0x26b4, 0x2b86, 0x2c69, 0x2e5f, 0x1f3d, 0x2f45, 0x28ed, 0x2b42, 0x2667, 0x2835, 0x2d75, 0x1f4c, 0x2ec7, 0x2f62, 0x2bb4, 0xaa59, 0xabb9, 0xacc8, 0x2719, 0x90bf, 0x2fa7, 0x2cd6, 0x2bc7, 0x256b, 0x2eef, 0x2eca, 0x280c, 0x2dcf, 0x2d0c, 0xacbe, 0x2e39, 0xaacb, 0x19e6, 0x2d4c, 0xa8e6, 0x2391, 0xacb0, 0x26a6, 0xa0a7, 0x2c7d, 0x2808, 0x27cf, 0x1d5f, 0xa5ff, 0x279c, 0x291f, 0x277f, 0x292c, 0xab30, 0xaf5d, 0xac8f, 0xaca0, 0x28cb, 0x2992, 0x301a, 0xad1e, 0x24ad, 0x2629, 0xac9e, 0xa9a3, 0x2c96, 0xa835, 0x2f35, 0xa9f1, 0x2a58, 0x2be7, 0x28ab, 0xa8cd, 0x2e6d, 0xa4ab, 0xabd8, 0x2c10, 0x2c7d, 0xac14, 0x2d0c, 0xac5c, 0x2f36, 0xaa1e, 0x29fb, 0xa4dd, 0x2644, 0xa448, 0x1abc, 0x2612, 0x2f60, 0xaaa9, 0x2c4d, 0xad12, 0x28d2, 0xaf75, 0x2d4e, 0x2cbb, 0x2713, 0xa843, 0x2307, 0x269f, 0xa622, 0xaa42, 0xa50f, 0x2e8c, 0x1da8, 0x2a00, 0xa840, 0x2087, 0x2e77, 0x268d, 0xacb5, 0x2aea, 0xa1d8, 0x2ea8, 0x2db8, 0x276e, 0xa9f8, 0xa95d, 0xa211, 0x2c6e, 0x2a34, 0x283e, 0xae41, 0x2e6c, 0x2b7b, 0x2dcb, 0xa7c3, 0x24c2, 0x2807, 0x2467, 0xaee0, 0x2f61, 0x0c1e, 0x2a02, 0x29fe, 0xaa82, 0xaae9, 0x2c23, 0x29f3, 0x2879, 0xa64c, 0xaec5, 0xa960, 0xac0b, 0x2fb5, 0xac52, 0xa7f6, 0xadca, 0x2e04, 0x2a95, 0xa980, 0x921f, 0x2aea, 0xaad1, 0x2786, 0xa45a, 0xa583, 0xaed7, 0x2652, 0xadd5, 0x2da8, 0x2c05, 0xa86f, 0x2451, 0x2958, 0x23c2, 0xaa3e, 0x2a10, 0xa70b, 0x2ab2, 0xa93f, 0x2e8a, 0x2894, 0x16e6, 0x2ea8, 0xa884, 0x2f63, 0xaf87, 0x9f2d, 0xa722, 0xaf7f, 0x2bf0, 0x2df0, 0x2c50, 0x2f58, 0xac62, 0x28fb, 0xacd7, 0xa820, 0xaae1, 0x2d8a, 0x2fb0, 0x2269, 0x2b89, 0xaa26, 0x9e83, 0xa9ff, 0xab00, 0xa9bc, 0x25b0, 0x2a4b, 0x24f1, 0x265e, 0x2d14, 0x2daa, 0x2e49, 0x2bde, 0xa37d, 0xaa72, 0x2c06, 0x9ca4, 0x277d, 0xa8fa, 0xa42a, 0x2c1a, 0x2aba, 0xa95b, 0xa324, 0x25f1, 0xa327, 0xa8c1, 0x2ef0, 0x2905, 0xaa42, 0x2cac, 0x2f27, 0xa04d, 0x9bc8, 0x2849, 0x2454, 0xac26, 0x2e3d, 0x2c34};
+static const float B2[] = {0.09627039f, -0.04923733f, 0.05947955f, -0.02730460f, -0.09042454f, 0.02313894f, -0.03388915f, 0.08996750f, -0.04053456f, 0.06877623f, -0.00689399f, 0.08147942f, -0.05173365f, 0.09393334f, 0.09227064f, -0.01156950f, 0.01640719f, 0.10966317f, -0.02347312f, 0.08349498f, -0.03790784f, -0.07956591f, -0.03376649f, -0.05839018f, 0.06087898f, 0.00235185f, -0.05855193f, 0.09501575f, -0.03267717f, -0.01144805f, -0.01456712f, 0.03905557f, 0.02262589f, 0.11871191f, 0.07637294f, 0.07865759f, 0.07631350f, 0.01703745f, -0.02561157f, 0.08672664f, -0.06645499f, 0.10809384f, 0.04799162f, 0.06217953f, 0.07907582f, 0.03094897f, 0.05664267f, -0.00939502f, 0.00795009f, -0.03438994f, 0.09841260f, 0.00300100f, 0.02800147f, 0.04589713f, 0.02987493f, 0.00935034f, -0.03211668f, 0.04336083f, 0.08665375f, 0.08094563f, 0.04996519f, 0.02743693f, -0.05069005f, -0.04633341f};
+static const uint16_t W3[] = {0xab3b, 0x2c53, 0x3078, 0x291a, 0x2965, 0x2d3d, 0x2ed7, 0xaf56, 0xac7e, 0x2a80, 0x2f81, 0xae75, 0xb0eb, 0x30ab, 0xac9d, 0x30ba, 0x29c4, 0x2f6b, 0xb103, 0x2cf8, 0x2b1d, 0x100c, 0x311a, 0x202a, 0xa4cd, 0x2ee2, 0xac78, 0x281d, 0xb06d, 0x1c5c, 0x2d90, 0xb1a8, 0xac10, 0x311b, 0xafd4, 0xb1cd, 0x219d, 0xae81, 0x2870, 0x2428, 0xad8f, 0x2ecb, 0xaddf, 0x307b, 0x289c, 0xae48, 0xb03f, 0xad98, 0xb11c, 0xab7c, 0xaefa, 0xa911, 0xb036, 0xac71, 0xb11b, 0x1efb, 0xa864, 0x3148, 0x2945, 0x1da4, 0x97d0, 0x3169, 0xa8e2, 0xaf1c, 0xaa24, 0xae6d, 0xad75, 0xafc0, 0xadc8, 0xb1d7, 0x2e7f, 0x3061, 0x2ff4, 0x2e20, 0x309d, 0x2ce5, 0x3027, 0xb0f4, 0xb053, 0xb0cb, 0xa388, 0x9cbb, 0xadf3, 0xacf9, 0xb041, 0x239c, 0xa4a0, 0x26cd, 0xafde, 0x286f, 0xade3, 0x9423, 0x22f9, 0x3050, 0xa975, 0x21f0, 0xad89, 0x2cbb, 0x28b5, 0x31a6, 0xad9d, 0x2931, 0xac3c, 0xb01d, 0xaeaa, 0xaa3d, 0x2bb0, 0xacc1, 0xae23, 0x315b, 0x2e57, 0x3101, 0x2af9, 0xadb4, 0x30e3, 0xb184, 0x309b, 0x3064, 0x2cc5, 0x176d, 0x2f59, 0xaa55, 0xae26, 0xb139, 0x2f08, 0xacaa, 0x2c26, 0xa80c, 0x2df1, 0xac6a, 0xaf21, 0x2a64, 0x308a, 0xb2d4, 0x291e, 0xac6c, 0x2be8, 0xac50, 0xaec2, 0x2c65, 0xb12a, 0xa8bb, 0xa8e0, 0x3087, 0x2bef, 0x309a, 0x3000, 0xb021, 0x2e37, 0x2e26, 0xa52b, 0x2879, 0xb08a, 0xb034, 0x308d, 0xb106, 0x2bc6, 0xac18, 0x3121, 0x22c9, 0x3057, 0xad22, 0x30de, 0x2b45, 0xa555, 0xac6b, 0xa7e2, 0x30da, 0x1fb8, 0xb001, 0xad68, 0xaab5, 0x258e, 0xb183, 0xb2d2, 0x2cdf, 0xb105, 0xadea, 0x30aa, 0x2ba4, 0x230d, 0x2ea4, 0xad72, 0x2c79, 0x3078, 0x2b2a, 0x2d56, 0x2caa, 0xae62, 0x2ee2, 0xb00c, 0xad66, 0x1b59, 0xad44, 0xa973, 0x2eb0, 0xafdd, 0x29ac, 0xb0af, 0xb04c, 0xad69, 0xb135, 0xb0e5, 0x11bb, 0x266b, 0x2cfe, 0x2475, 0x2abf, 0xb02d, 0xb110, 0xafc8, 0xa0d7, 0xb0aa, 0x22e5, 0xb066, 0xaad6, 0xafca, 0x269e, 0x297d, 0xb0d2, 0x2d3e, 0xacb9, 0xabc3, 0xaeeb, 0x1d5e, 0xaeb7, 0xa614, 0xac74, 0xb179, 0xafb5, 0xac2d, 0x3004, 0xaee5, 0x2ef8, 0x2a7c, 0xa8eb, 0x3013, 0x2c98, 0x2adc, 0x2d1b, 0x3094, 0x30c4, 0xa77c, 0x2b87, 0x27ba, 0x2fd0, 0xaffd, 0x3035, 0x2e11, 0xb00a, 0xb04d, 0x2d49, 0xaf33, 0x2a6f, 0xae81, 0x2fd7};
+static const float B3[] = {-0.00129160f, -0.02726957f, -0.08900375f, 0.00331665f};
@@ -0,0 +1,116 @@
+#ifndef HALF_FLOAT_H
+#define HALF_FLOAT_H
+
+#include <immintrin.h>  // F16C(_mm256_cvtph_ps) / SSE2 / AVX
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * IEEE 754 반정밀도(FP16) 가중치 저장 보조 함수
+ *
+ * - 가중치는 uint16_t(half)로 저장해 바이트 수(.wasm 다운로드, 추론당 메모리 대역폭)를 절반으로 줄이고
+ *   내적 커널 안에서 레지스터로 8개씩 fp32로 확장해 fp32로 누산
+ * - 네이티브: F16C(_mm256_cvtph_ps) 한 명령으로 확장
+ * - WASM(F16C 없음): SSE2 정수 연산으로 비트를 풀어 확장 (지수는 정수 덧셈으로 옮기고
+ *   비정규 수는 정규 수 뺄셈으로 복원. 가중치에는 Inf/NaN이 없으므로 SIMD 경로는 따로 처리하지 않음)
+ */
+
+// fp32 → fp16 (가장 가까운 짝수로 반올림, 범위를 넘으면 Inf)
+inline uint16_t floatToHalf(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000u;
+    uint32_t magnitude = bits & 0x7fffffffu;
+
+    if (magnitude >= 0x7f800000u) {  // Inf / NaN
+        return static_cast<uint16_t>(sign | 0x7c00u | (magnitude > 0x7f800000u ? 0x200u : 0u));
+    }
+    if (magnitude >= 0x477ff000u) return static_cast<uint16_t>(sign | 0x7c00u);  // 65520 이상 → Inf
+
+    if (magnitude < 0x38800000u) {  // half 비정규 수 영역 (2^-14 미만)
+        // 2^-24 단위로 정수화하면서 반올림 (float 덧셈이 짝수 반올림을 수행)
+        float absValue;
+        std::memcpy(&absValue, &magnitude, sizeof(absValue));
+        float scaled = absValue + 0.5f;  // 0.5 = 2^-1 → 가수 하위 비트가 2^-24 단위가 됨
+        uint32_t scaledBits;
+        std::memcpy(&scaledBits, &scaled, sizeof(scaledBits));
+        return static_cast<uint16_t>(sign | (scaledBits - 0x3f000000u));
+    }
+
+    // 정규 수: 지수 재조정 후 하위 13비트를 짝수 반올림
+    uint32_t rounded = magnitude + 0xfffu + ((magnitude >> 13) & 1u);
+    return static_cast<uint16_t>(sign | ((rounded - 0x38000000u) >> 13));
+}
+
+// fp16 → fp32 (스칼라, 꼬리 처리용)
+// 비트를 uint32_t에서 모두 조립한 뒤 마지막에 한 번만 float으로 옮김
+// 비정규 수도 정수 연산으로 정규화하므로 float 비정규 수를 거치지 않음 (-ffast-math의 DAZ에도 안전)
+inline float halfToFloat(uint16_t half) {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+    uint32_t exponent = (half >> 10) & 0x1fu;
+    uint32_t mantissa = half & 0x3ffu;
+    uint32_t bits;
+    if (exponent == 0x1fu) {
+        bits = sign | 0x7f800000u | (mantissa << 13);  // Inf / NaN
+    } else if (exponent != 0) {
+        bits = sign | ((exponent + 127u - 15u) << 23) | (mantissa << 13);  // 지수 바이어스 보정
+    } else if (mantissa == 0) {
+        bits = sign;  // ±0
+    } else {
+        // 비정규 수: 가수의 최상위 1이 암묵 비트 자리(0x400)에 올 때까지 밀면서 지수를 낮춤
+        exponent = 127u - 14u;
+        while (!(mantissa & 0x400u)) {
+            mantissa <<= 1;
+            exponent--;
+        }
+        bits = sign | (exponent << 23) | ((mantissa & 0x3ffu) << 13);
+    }
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+// half 8개 → fp32 8개 (비정렬 로드)
+inline __m256 loadHalf8(const uint16_t* src) {
+#ifdef __F16C__
+    return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+#else
+    const __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i magnitudeMask = _mm_set1_epi32(0x7fff);
+    const __m128i exponentMask = _mm_set1_epi32(0x0f800000);
+    const __m128i rebias = _mm_set1_epi32((127 - 15) << 23);
+    const __m128i denormalBit = _mm_set1_epi32(1 << 23);
+    const __m128 denormalBase = _mm_set1_ps(6.103515625e-05f);  // 2^-14
+
+    // halfToFloat과 같은 정수 지수 이동 (비정규 수는 정규 수 뺄셈으로 복원)
+    auto widen4 = [&](__m128i halves) {
+        __m128i magnitude = _mm_slli_epi32(_mm_and_si128(halves, magnitudeMask), 13);
+        __m128i sign = _mm_slli_epi32(_mm_andnot_si128(magnitudeMask, halves), 16);
+        __m128i denormal = _mm_cmpeq_epi32(_mm_and_si128(magnitude, exponentMask), zero);
+        magnitude = _mm_add_epi32(_mm_add_epi32(magnitude, rebias), _mm_and_si128(denormal, denormalBit));
+        __m128 value = _mm_sub_ps(_mm_castsi128_ps(magnitude), _mm_and_ps(_mm_castsi128_ps(denormal), denormalBase));
+        return _mm_or_ps(value, _mm_castsi128_ps(sign));
+    };
+    __m128 lo = widen4(_mm_unpacklo_epi16(raw, zero));
+    __m128 hi = widen4(_mm_unpackhi_epi16(raw, zero));
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+#endif
+}
+
+// half 가중치 행과 fp32 활성값의 내적 (fp32 누산)
+inline float dotHalf(const uint16_t* weights, const float* x, int size) {
+    int simdSize = size & ~7;
+    __m256 acc = _mm256_setzero_ps();
+    for (int i = 0; i < simdSize; i += 8) {
+        acc = _mm256_add_ps(acc, _mm256_mul_ps(loadHalf8(weights + i), _mm256_loadu_ps(x + i)));
+    }
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, acc);
+    float result = lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7];
+    for (int i = simdSize; i < size; i++) result += halfToFloat(weights[i]) * x[i];
+    return result;
+}
+
+#endif // HALF_FLOAT_H
@@ -0,0 +1,190 @@
+#include "kernel_tuning.h"
+#include "aux_kernels.h"  // setKernelParameter / getKernelParameter (C 링키지)
+
+#include <algorithm>  // std::sort
+#include <atomic>
+#include <chrono>
+#include <cstdlib>    // std::getenv
+#include <fstream>    // 프로필 파일
+#include <mutex>      // std::call_once
+#include <sstream>
+#include <vector>
+
+namespace kernel_tuning {
+
+namespace {
+
+const ParamInfo PARAMS[PARAM_COUNT] = {
+    {"matvec.block", 32, 1, 4096, {8, 16, 32, 64, 128, 256}, 6},
+    {"gemm.block", 64, 4, 4096, {16, 32, 48, 64, 96, 128, 256}, 7},
+    {"blur.tile", 0, 0, 1 << 16, {0, 32, 64, 128, 256, 512}, 6},
+    {"mlp.batch", 8, 1, 16, {1, 2, 4, 8, 16}, 5},
+};
+
+const char* const PROFILE_MAGIC = "sign-kernel-profile";
+const int PROFILE_VERSION = 1;
+
+struct Values {
+    std::atomic<int> v[PARAM_COUNT];
+    Values() {
+        for (int p = 0; p < PARAM_COUNT; p++) v[p].store(PARAMS[p].defaultValue, std::memory_order_relaxed);
+    }
+};
+
+Values& values() {
+    static Values instance;
+    return instance;
+}
+
+void setError(std::string* error, const std::string& message) {
+    if (error) *error = message;
+}
+
+bool inRange(Param p, int value) {
+    return value >= PARAMS[p].minValue && value <= PARAMS[p].maxValue;
+}
+
+}  // namespace
+
+const ParamInfo& info(Param p) {
+    return PARAMS[p];
+}
+
+int get(Param p) {
+    return values().v[p].load(std::memory_order_relaxed);
+}
+
+bool set(Param p, int value) {
+    if (p < 0 || p >= PARAM_COUNT || !inRange(p, value)) return false;
+    values().v[p].store(value, std::memory_order_relaxed);
+    return true;
+}
+
+void resetDefaults() {
+    for (int p = 0; p < PARAM_COUNT; p++) values().v[p].store(PARAMS[p].defaultValue, std::memory_order_relaxed);
+}
+
+const char* target() {
+#if defined(__EMSCRIPTEN__)
+    return "wasm";
+#elif defined(__AVX512F__)
+    return "avx512";
+#elif defined(__AVX2__)
+    return "avx2";
+#else
+    return "sse";
+#endif
+}
+
+int autotune(Param p, void (*run)(void* context), void* context, int repeats, Sweep* sweep) {
+    const ParamInfo& param = PARAMS[p];
+    repeats = std::max(1, repeats);
+    std::vector<double> samples(repeats);
+    Sweep local;
+    Sweep& s = sweep ? *sweep : local;
+    s = Sweep();
+    s.count = param.candidateCount;
+
+    for (int c = 0; c < param.candidateCount; c++) {
+        set(p, param.candidates[c]);
+        run(context);  // 워밍업 (캐시/분기 예측)
+        for (int r = 0; r < repeats; r++) {
+            auto start = std::chrono::steady_clock::now();
+            run(context);
+            samples[r] = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        }
+        std::sort(samples.begin(), samples.end());
+        s.medianUs[c] = samples[repeats / 2];
+    }
+
+    // 최솟값의 TOLERANCE 안에 드는 가장 작은 후보 (후보는 오름차순)
+    double best = *std::min_element(s.medianUs, s.medianUs + s.count);
+    int winner = 0;
+    while (s.medianUs[winner] > best * (1.0 + TOLERANCE)) winner++;
+    s.winner = param.candidates[winner];
+    set(p, s.winner);
+    return s.winner;
+}
+
+std::string serialize() {
+    std::ostringstream out;
+    out << PROFILE_MAGIC << ' ' << PROFILE_VERSION << ' ' << target() << '\n';
+    for (int p = 0; p < PARAM_COUNT; p++) out << PARAMS[p].key << ' ' << get(Param(p)) << '\n';
+    return out.str();
+}
+
+bool parse(const std::string& text, std::string* error) {
+    std::istringstream in(text);
+    std::string magic, profileTarget;
+    int version = 0;
+    if (!(in >> magic >> version >> profileTarget) || magic != PROFILE_MAGIC || version != PROFILE_VERSION) {
+        setError(error, "not a kernel profile (expected \"" + std::string(PROFILE_MAGIC) + " 1 <target>\")");
+        return false;
+    }
+    if (profileTarget != target()) {
+        setError(error, "profile was tuned for " + profileTarget + ", this build is " + target());
+        return false;
+    }
+
+    // 모든 줄이 유효할 때만 한꺼번에 적용
+    int parsed[PARAM_COUNT];
+    for (int p = 0; p < PARAM_COUNT; p++) parsed[p] = get(Param(p));
+    std::string key;
+    int value;
+    while (in >> key >> value) {
+        for (int p = 0; p < PARAM_COUNT; p++) {
+            if (key != PARAMS[p].key) continue;
+            if (!inRange(Param(p), value)) {
+                setError(error, key + " out of range: " + std::to_string(value));
+                return false;
+            }
+            parsed[p] = value;
+        }
+    }
+    if (!in.eof()) {
+        setError(error, "malformed line after " + key);
+        return false;
+    }
+    for (int p = 0; p < PARAM_COUNT; p++) set(Param(p), parsed[p]);
+    return true;
+}
+
+bool saveFile(const std::string& path, std::string* error) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        setError(error, "cannot write " + path);
+        return false;
+    }
+    out << serialize();
+    return static_cast<bool>(out);
+}
+
+bool loadFile(const std::string& path, std::string* error) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        setError(error, "cannot open " + path);
+        return false;
+    }
+    std::ostringstream buffer;
+    buffer << in.rdbuf();
+    return parse(buffer.str(), error);
+}
+
+void applyEnvironmentProfile() {
+    static std::once_flag once;
+    std::call_once(once, [] {
+        const char* path = std::getenv("SIGN_KERNEL_PROFILE");
+        if (path && *path) loadFile(path);  // 실패하면 기본값 유지
+    });
+}
+
+}  // namespace kernel_tuning
+
+// 보조 모듈 내보내기 (브라우저가 보관한 값을 모듈마다 적용)
+int setKernelParameter(int param, int value) {
+    return kernel_tuning::set(kernel_tuning::Param(param), value) ? 1 : 0;
+}
+
+int getKernelParameter(int param) {
+    return param >= 0 && param < kernel_tuning::PARAM_COUNT ? kernel_tuning::get(kernel_tuning::Param(param)) : -1;
+}
@@ -0,0 +1,70 @@
+#ifndef KERNEL_TUNING_H
+#define KERNEL_TUNING_H
+
+#include <string>
+
+/**
+ * 커널 튜닝 파라미터 (블록/타일/배치 크기)
+ *
+ * - 커널은 하드코딩 상수 대신 kernel_tuning::get()으로 현재 값을 읽음 (기본값은 기존 상수)
+ * - autotune()은 현재 기기에서 후보 값을 차례로 적용해 실행 시간을 재고 가장 빠른 값을 적용
+ *   (차이가 TOLERANCE 안이면 더 작은 후보: 배치는 지연이 짧고 블록은 작은 캐시에도 맞음)
+ * - 결과는 텍스트 프로필("키 값" 줄)로 저장/복원
+ *   네이티브: saveFile/loadFile, 시작 시 SIGN_KERNEL_PROFILE 환경 변수 경로를 자동 적용 (applyEnvironmentProfile)
+ *   브라우저: serialize() 문자열을 JavaScript가 보관(localStorage 등)했다가 다음 실행에 parse()로 적용
+ * - 프로필에는 빌드 대상(target: avx512 / avx2 / sse / wasm)이 기록되며 다른 대상의 프로필은 거부
+ * - 값은 원자 변수라 어느 스레드에서 읽어도 되지만, 튜닝 중에는 다른 스레드에서 커널을 돌리지 않는 것을 전제
+ */
+namespace kernel_tuning {
+
+enum Param {
+    MATVEC_BLOCK = 0,  // SignRecognizer::matrixMultiply 블록 (기본 32)
+    GEMM_BLOCK,        // matrixMultiplyLarge 블록 (기본 64, 보조 matrix 모듈)
+    BLUR_TILE,         // processImageData 5x5 가우시안 열 타일 폭 (픽셀, 0은 행 전체, 보조 image 모듈)
+    MLP_BATCH,         // SignRecognition::predictMLPBatch 가중치 행 공유 프레임 수 (기본 8, 최대 16)
+    PARAM_COUNT
+};
+
+static constexpr int MAX_CANDIDATES = 8;
+static constexpr double TOLERANCE = 0.03;  // 최선 대비 3% 안이면 더 작은 후보 선택
+
+struct ParamInfo {
+    const char* key;      // 프로필 키 (예: "matvec.block")
+    int defaultValue;
+    int minValue;
+    int maxValue;
+    int candidates[MAX_CANDIDATES];  // 오름차순
+    int candidateCount;
+};
+
+const ParamInfo& info(Param p);
+
+int get(Param p);
+bool set(Param p, int value);  // 범위 밖이면 false (값 유지)
+void resetDefaults();
+
+// 빌드 대상 이름 (프로필 호환성 확인용)
+const char* target();
+
+// 후보별 측정 결과
+struct Sweep {
+    int winner = 0;
+    int count = 0;
+    double medianUs[MAX_CANDIDATES] = {};  // 후보 순서
+};
+
+// 후보 값마다 set 후 run(context)을 repeats번 실행해 중앙값 비교, 승자를 적용해 반환
+int autotune(Param p, void (*run)(void* context), void* context, int repeats, Sweep* sweep = nullptr);
+
+// 프로필 텍스트: 첫 줄 "sign-kernel-profile 1 <target>", 이후 "키 값" 줄
+std::string serialize();
+bool parse(const std::string& text, std::string* error = nullptr);  // 알 수 없는 키는 무시, 범위 밖 값은 오류
+bool saveFile(const std::string& path, std::string* error = nullptr);
+bool loadFile(const std::string& path, std::string* error = nullptr);
+
+// SIGN_KERNEL_PROFILE 경로가 있으면 한 번만 적용 (여러 번 호출해도 첫 호출만 읽음, 실패하면 기본값 유지)
+void applyEnvironmentProfile();
+
+}  // namespace kernel_tuning
+
+#endif // KERNEL_TUNING_H
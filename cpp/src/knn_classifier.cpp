@@ -0,0 +1,225 @@
+#include "knn_classifier.h"
+#include "memory_accounting.h"  // 표본 블록은 KNN 태그로 할당
+#include <immintrin.h>  // AVX SIMD
+#include <algorithm>  // std::push_heap, std::pop_heap, std::sort_heap
+#include <cstring>  // std::memcpy
+#include <limits>  // std::numeric_limits
+#include <map>  // 라벨별 누적 (프로토타입 생성)
+
+namespace {
+constexpr size_t BLOCK_ALIGN = 32;
+constexpr float PADDING_VALUE = 1e17f;  // 빈 레인: 거리가 항상 커서 조기 종료를 막지 않음
+
+// (거리, 인덱스) 순서 → 같은 거리면 먼저 등록된 샘플 우선 (결과가 결정적)
+inline bool closer(const KnnClassifier::Neighbor& a, const KnnClassifier::Neighbor& b) {
+    return a.distance < b.distance || (a.distance == b.distance && a.index < b.index);
+}
+}  // namespace
+
+KnnClassifier::KnnClassifier(int dim, int k)
+    : dimension(std::max(1, std::min(dim, MAX_DIM))), neighbors(1) {
+    setK(k);
+}
+
+KnnClassifier::~KnnClassifier() {
+    memory_accounting::deallocate(memory_accounting::KNN, blocks, blockBytes(blockCapacity));
+}
+
+size_t KnnClassifier::blockBytes(size_t capacity) const {
+    return capacity * dimension * BLOCK * sizeof(float);  // 32바이트 배수 (BLOCK * 4)
+}
+
+void KnnClassifier::setScaler(const std::vector<float>& meanArr, const std::vector<float>& scaleArr) {
+    if (meanArr.size() != static_cast<size_t>(dimension) || scaleArr.size() != static_cast<size_t>(dimension)) return;
+    mean = meanArr;
+    invScale.resize(dimension);
+    for (int d = 0; d < dimension; d++) invScale[d] = scaleArr[d] != 0.0f ? 1.0f / scaleArr[d] : 1.0f;
+}
+
+void KnnClassifier::setK(int k) {
+    neighbors = std::max(1, std::min(k, MAX_K));
+}
+
+void KnnClassifier::normalize(const float* features, float* out) const {
+    if (invScale.empty()) {
+        std::memcpy(out, features, dimension * sizeof(float));
+        return;
+    }
+    for (int d = 0; d < dimension; d++) out[d] = (features[d] - mean[d]) * invScale[d];
+}
+
+void KnnClassifier::reserveBlocks(size_t needed) {
+    if (needed <= blockCapacity) return;
+    size_t capacity = std::max(needed, blockCapacity * 2);  // 2배씩 늘려 추가 비용을 분할 상환
+    size_t blockFloats = static_cast<size_t>(dimension) * BLOCK;
+    float* grown = static_cast<float*>(memory_accounting::allocate(memory_accounting::KNN, blockBytes(capacity), BLOCK_ALIGN));
+    if (!grown) return;  // 메모리 부족 또는 KNN 예산 초과
+    if (blocks) std::memcpy(grown, blocks, blockBytes(blockCapacity));
+    std::fill(grown + blockCapacity * blockFloats, grown + capacity * blockFloats, PADDING_VALUE);
+    memory_accounting::deallocate(memory_accounting::KNN, blocks, blockBytes(blockCapacity));
+    blocks = grown;
+    blockCapacity = capacity;
+}
+
+int KnnClassifier::addSample(const float* features, int label) {
+    if (!features || label < 0) return -1;
+    alignas(32) float values[MAX_DIM];
+    normalize(features, values);
+    return addNormalized(values, label);
+}
+
+int KnnClassifier::addNormalized(const float* values, int label) {
+    size_t block = count / BLOCK;
+    reserveBlocks(block + 1);
+    if (block >= blockCapacity) return -1;  // 할당 실패
+
+    // 블록 안에서 차원별로 BLOCK 간격 (SoA)
+    float* dst = blocks + block * dimension * BLOCK + count % BLOCK;
+    for (int d = 0; d < dimension; d++) dst[d * BLOCK] = values[d];
+    labels.push_back(label);
+    return static_cast<int>(count++);
+}
+
+int KnnClassifier::search(const float* features, int k, Neighbor* out) const {
+    if (!features || !out || count == 0) return 0;
+    k = std::max(1, std::min(k, MAX_K));
+
+    alignas(32) float query[MAX_DIM];
+    normalize(features, query);
+
+    Neighbor heap[MAX_K];  // 최대 힙 (front = 현재 k번째로 가까운 이웃)
+    int heapSize = 0;
+    float threshold = std::numeric_limits<float>::infinity();
+
+    const size_t blockCount = (count + BLOCK - 1) / BLOCK;
+    for (size_t b = 0; b < blockCount; b++) {
+        const float* block = blocks + b * dimension * BLOCK;
+        // 누산기 4개로 덧셈 의존 사슬을 끊음 (검사 시점에만 합침)
+        __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+        __m256 acc2 = _mm256_setzero_ps(), acc3 = _mm256_setzero_ps();
+        __m256 acc = _mm256_setzero_ps();
+        bool pruned = false;
+
+        for (int d0 = 0; d0 < dimension && !pruned; d0 += CHECK_INTERVAL) {
+            int d1 = std::min(d0 + CHECK_INTERVAL, dimension);
+            int d = d0;
+            for (; d + 4 <= d1; d += 4) {
+                const float* row = block + d * BLOCK;
+                __m256 diff0 = _mm256_sub_ps(_mm256_load_ps(row), _mm256_set1_ps(query[d]));
+                __m256 diff1 = _mm256_sub_ps(_mm256_load_ps(row + BLOCK), _mm256_set1_ps(query[d + 1]));
+                __m256 diff2 = _mm256_sub_ps(_mm256_load_ps(row + 2 * BLOCK), _mm256_set1_ps(query[d + 2]));
+                __m256 diff3 = _mm256_sub_ps(_mm256_load_ps(row + 3 * BLOCK), _mm256_set1_ps(query[d + 3]));
+                acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(diff0, diff0));
+                acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(diff1, diff1));
+                acc2 = _mm256_add_ps(acc2, _mm256_mul_ps(diff2, diff2));
+                acc3 = _mm256_add_ps(acc3, _mm256_mul_ps(diff3, diff3));
+            }
+            for (; d < d1; d++) {
+                __m256 diff = _mm256_sub_ps(_mm256_load_ps(block + d * BLOCK), _mm256_set1_ps(query[d]));
+                acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(diff, diff));
+            }
+            acc = _mm256_add_ps(_mm256_add_ps(acc0, acc1), _mm256_add_ps(acc2, acc3));
+
+            // 부분 거리가 8개 샘플 모두 threshold를 넘으면 이 블록은 후보가 될 수 없음
+            if (heapSize == k && d1 < dimension) {
+                __m256 within = _mm256_cmp_ps(acc, _mm256_set1_ps(threshold), _CMP_LE_OQ);
+                pruned = _mm256_movemask_ps(within) == 0;
+            }
+        }
+        if (pruned) continue;
+
+        alignas(32) float distances[BLOCK];
+        _mm256_store_ps(distances, acc);
+        int lanes = static_cast<int>(std::min<size_t>(BLOCK, count - b * BLOCK));
+        for (int lane = 0; lane < lanes; lane++) {
+            Neighbor candidate{distances[lane], static_cast<int>(b * BLOCK + lane), labels[b * BLOCK + lane]};
+            if (heapSize < k) {
+                heap[heapSize++] = candidate;
+                std::push_heap(heap, heap + heapSize, closer);
+            } else if (closer(candidate, heap[0])) {
+                std::pop_heap(heap, heap + heapSize, closer);
+                heap[heapSize - 1] = candidate;
+                std::push_heap(heap, heap + heapSize, closer);
+            } else {
+                continue;
+            }
+            if (heapSize == k) threshold = heap[0].distance;
+        }
+    }
+
+    std::sort_heap(heap, heap + heapSize, closer);  // 거리 오름차순
+    std::copy(heap, heap + heapSize, out);
+    return heapSize;
+}
+
+int KnnClassifier::vote(const Neighbor* found, int n, float* confidence) {
+    if (n <= 0) {
+        if (confidence) *confidence = 0.0f;
+        return -1;
+    }
+    // 거리 역수 가중 (제곱 거리 기준이라 가까운 이웃이 더 강하게 반영됨)
+    // 라벨 수는 최대 n개이므로 고정 배열로 누적 (핫패스 할당 없음)
+    int voteLabels[MAX_K];
+    float voteWeights[MAX_K];
+    int distinct = 0;
+    float total = 0.0f;
+    for (int i = 0; i < n && i < MAX_K; i++) {
+        float w = 1.0f / (found[i].distance + 1e-6f);
+        int slot = 0;
+        while (slot < distinct && voteLabels[slot] != found[i].label) slot++;
+        if (slot == distinct) {
+            voteLabels[distinct] = found[i].label;
+            voteWeights[distinct++] = 0.0f;
+        }
+        voteWeights[slot] += w;
+        total += w;
+    }
+    int best = -1;
+    float bestWeight = -1.0f;
+    for (int slot = 0; slot < distinct; slot++) {
+        // 가중치가 같으면 작은 라벨 우선 (결정적)
+        if (voteWeights[slot] > bestWeight || (voteWeights[slot] == bestWeight && voteLabels[slot] < best)) {
+            best = voteLabels[slot];
+            bestWeight = voteWeights[slot];
+        }
+    }
+    if (confidence) *confidence = total > 0.0f ? bestWeight / total : 0.0f;
+    return best;
+}
+
+int KnnClassifier::predict(const float* features, float* confidence) const {
+    Neighbor found[MAX_K];
+    int n = search(features, neighbors, found);
+    return vote(found, n, confidence);
+}
+
+void KnnClassifier::buildPrototypes(KnnClassifier& out) const {
+    out.clear();
+    out.dimension = dimension;
+    out.mean = mean;
+    out.invScale = invScale;
+
+    std::map<int, std::vector<double>> sums;  // 라벨 → 정규화 공간 합
+    std::map<int, int> counts;
+    for (size_t i = 0; i < count; i++) {
+        std::vector<double>& sum = sums[labels[i]];
+        sum.resize(dimension, 0.0);
+        const float* src = blocks + (i / BLOCK) * dimension * BLOCK + i % BLOCK;
+        for (int d = 0; d < dimension; d++) sum[d] += src[d * BLOCK];
+        counts[labels[i]]++;
+    }
+
+    alignas(32) float centroid[MAX_DIM];
+    for (const auto& entry : sums) {
+        for (int d = 0; d < dimension; d++) centroid[d] = static_cast<float>(entry.second[d] / counts[entry.first]);
+        out.addNormalized(centroid, entry.first);
+    }
+}
+
+void KnnClassifier::clear() {
+    memory_accounting::deallocate(memory_accounting::KNN, blocks, blockBytes(blockCapacity));
+    blocks = nullptr;
+    blockCapacity = 0;
+    count = 0;
+    labels.clear();
+}
@@ -0,0 +1,77 @@
+#ifndef KNN_CLASSIFIER_H
+#define KNN_CLASSIFIER_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * SIMD 완전 탐색 k-NN 분류기 (SignRecognition MLP와 나란히 쓰는 두 번째 엔진)
+ *
+ * - 재학습 없이 addSample()로 샘플(또는 클래스 프로토타입)을 실행 중에 추가 → 새 수어 즉시 등록
+ * - 저장: 8개 샘플 단위 블록의 SoA 행렬 (AoSoA, 블록마다 [dim][8], 32바이트 정렬)
+ *   → 한 번의 SIMD 연산이 같은 차원의 8개 샘플 거리를 동시에 누산
+ * - 부분 거리 조기 종료: 일정 차원마다 블록 8개 샘플의 부분 거리가 모두
+ *   현재 k번째 거리보다 크면 나머지 차원을 건너뜀 (제곱 거리는 단조 증가)
+ * - 상위 k개는 크기 k의 최대 힙으로 유지 (정렬 없이 O(log k) 갱신)
+ * - setScaler()가 설정되면 등록/질의 모두 같은 정규화를 적용 (MLP와 같은 scaler.json)
+ */
+class KnnClassifier {
+public:
+    static constexpr int BLOCK = 8;           // 블록당 샘플 수 (AVX 레지스터 폭)
+    static constexpr int CHECK_INTERVAL = 16;  // 조기 종료 검사 간격 (차원 수)
+    static constexpr int MAX_DIM = 256;        // 질의 정규화 버퍼 크기 (스택)
+    static constexpr int MAX_K = 64;
+
+    struct Neighbor {
+        float distance;  // 제곱 유클리드 거리
+        int index;       // 등록 순서
+        int label;
+    };
+
+    explicit KnnClassifier(int dim = 126, int k = 5);
+    ~KnnClassifier();
+
+    KnnClassifier(const KnnClassifier&) = delete;
+    KnnClassifier& operator=(const KnnClassifier&) = delete;
+
+    void setScaler(const std::vector<float>& mean, const std::vector<float>& scale);
+    void setK(int k);
+
+    // 샘플 하나 등록 (dim개 원본 특징, label >= 0), 등록 인덱스 반환 (-1: 잘못된 입력)
+    int addSample(const float* features, int label);
+
+    // 질의와 가장 가까운 최대 k개 이웃을 거리 오름차순으로 out에 기록, 찾은 개수 반환
+    int search(const float* features, int k, Neighbor* out) const;
+
+    // k-NN 다수결 (거리 역수 가중), confidence = 승자 가중치 / 전체 가중치
+    int predict(const float* features, float* confidence = nullptr) const;
+
+    // 이웃 목록으로 투표 (search 결과를 걸러서 다시 투표할 때 사용)
+    static int vote(const Neighbor* neighbors, int count, float* confidence = nullptr);
+
+    // 라벨별 평균 벡터(프로토타입)만 담은 분류기 생성 (정규화 공간에서 평균, 같은 scaler 사용)
+    void buildPrototypes(KnnClassifier& out) const;
+
+    void clear();
+    size_t size() const { return count; }
+    int dim() const { return dimension; }
+    int k() const { return neighbors; }
+
+private:
+    void normalize(const float* features, float* out) const;
+    int addNormalized(const float* values, int label);
+    void reserveBlocks(size_t blocks);
+    size_t blockBytes(size_t capacity) const;  // capacity개 블록의 바이트 수
+
+    int dimension;
+    int neighbors;
+    std::vector<float> mean;
+    std::vector<float> invScale;  // 1 / scale (비어 있으면 정규화 없음)
+
+    float* blocks = nullptr;       // [block][dim][BLOCK], 정렬 할당
+    size_t blockCapacity = 0;
+    size_t count = 0;
+    std::vector<int> labels;       // 등록 순서
+};
+
+#endif // KNN_CLASSIFIER_H
@@ -0,0 +1,159 @@
+#include "landmark_filter.h"
+#include <immintrin.h>  // AVX SIMD (__m256)
+#include <algorithm>  // std::min, std::max
+#include <cstring>  // std::memcpy, std::memset
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+constexpr int TOTAL = LandmarkFilter::AXES * LandmarkFilter::LANES;  // 한 패스에서 처리할 float 수
+
+// One-Euro 평활 계수: a = r / (1 + r), r = 2π · cutoff · dt
+inline float smoothingFactor(float cutoff, float dt) {
+    float r = 2.0f * static_cast<float>(M_PI) * cutoff * dt;
+    return r / (1.0f + r);
+}
+}  // namespace
+
+LandmarkFilter::LandmarkFilter(Mode mode) : filterMode(mode) {
+    std::memset(measured, 0, sizeof(measured));
+    reset();
+}
+
+void LandmarkFilter::setMode(Mode mode) {
+    if (mode != filterMode) reset();
+    filterMode = mode;
+}
+
+void LandmarkFilter::setOneEuroParams(float minCutoffHz, float speedCoefficient, float derivativeCutoffHz) {
+    minCutoff = std::max(1e-3f, minCutoffHz);
+    beta = std::max(0.0f, speedCoefficient);
+    derivativeCutoff = std::max(1e-3f, derivativeCutoffHz);
+}
+
+void LandmarkFilter::setKalmanParams(float process, float measurement) {
+    processNoise = std::max(0.0f, process);
+    measurementNoise = std::max(1e-12f, measurement);
+}
+
+void LandmarkFilter::setNominalFrameRate(float fps) {
+    if (fps > 0.0f) nominalDt = 1.0f / fps;
+}
+
+void LandmarkFilter::reset() {
+    std::memset(position, 0, sizeof(position));
+    std::memset(velocity, 0, sizeof(velocity));
+    activeCount = 0;
+    activeStride = 0;
+    lastTimestamp = -1.0;
+    p00 = measurementNoise;  // 첫 측정을 그대로 받아들인 직후의 불확실성
+    p01 = 0.0f;
+    p11 = 1.0f;  // 속도는 모름
+}
+
+void LandmarkFilter::filter(float* data, int count, int stride, double timestampSec) {
+    if (filterMode == OFF || !data || count <= 0 || stride < 2) return;
+    count = std::min(count, MAX_LANDMARKS);
+    int axes = std::min(stride, AXES);
+
+    // 손 개수가 바뀌면 이전 상태는 다른 랜드마크의 것이므로 새로 시작
+    if (count != activeCount || stride != activeStride) reset();
+
+    // AoS → SoA 디인터리브
+    for (int i = 0; i < count; i++) {
+        const float* src = data + i * stride;
+        for (int a = 0; a < axes; a++) measured[a * LANES + i] = src[a];
+    }
+
+    if (activeCount == 0) {
+        // 첫 프레임: 측정값을 그대로 상태로 사용 (출력 변화 없음)
+        std::memcpy(position, measured, sizeof(position));
+        std::memset(velocity, 0, sizeof(velocity));
+        activeCount = count;
+        activeStride = stride;
+        lastTimestamp = timestampSec;
+        return;
+    }
+
+    float dt = nominalDt;
+    if (timestampSec >= 0.0 && lastTimestamp >= 0.0 && timestampSec > lastTimestamp) {
+        dt = static_cast<float>(timestampSec - lastTimestamp);
+    }
+    lastTimestamp = timestampSec;
+
+    if (filterMode == KALMAN) updateKalman(dt);
+    else updateOneEuro(dt);
+
+    // SoA → AoS 인터리브 (사용하지 않는 축은 건드리지 않음)
+    for (int i = 0; i < count; i++) {
+        float* dst = data + i * stride;
+        for (int a = 0; a < axes; a++) dst[a] = position[a * LANES + i];
+    }
+}
+
+void LandmarkFilter::updateOneEuro(float dt) {
+    const __m256 rate = _mm256_set1_ps(1.0f / dt);
+    const __m256 alphaD = _mm256_set1_ps(smoothingFactor(derivativeCutoff, dt));
+    const __m256 minCut = _mm256_set1_ps(minCutoff);
+    const __m256 betaVec = _mm256_set1_ps(beta);
+    const __m256 twoPiDt = _mm256_set1_ps(2.0f * static_cast<float>(M_PI) * dt);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+
+    for (int i = 0; i < TOTAL; i += 8) {
+        __m256 x = _mm256_load_ps(measured + i);
+        __m256 xHat = _mm256_load_ps(position + i);
+        __m256 dxHat = _mm256_load_ps(velocity + i);
+
+        // 미분 추정 후 고정 차단 주파수로 평활화
+        __m256 dx = _mm256_mul_ps(_mm256_sub_ps(x, xHat), rate);
+        dxHat = _mm256_add_ps(dxHat, _mm256_mul_ps(alphaD, _mm256_sub_ps(dx, dxHat)));
+
+        // 속도에 비례해 차단 주파수를 올림 → 빠른 움직임은 지연 없이, 정지 상태는 강하게 평활화
+        __m256 speed = _mm256_andnot_ps(signMask, dxHat);
+        __m256 cutoff = _mm256_add_ps(minCut, _mm256_mul_ps(betaVec, speed));
+        __m256 r = _mm256_mul_ps(twoPiDt, cutoff);
+        __m256 alpha = _mm256_div_ps(r, _mm256_add_ps(one, r));
+        xHat = _mm256_add_ps(xHat, _mm256_mul_ps(alpha, _mm256_sub_ps(x, xHat)));
+
+        _mm256_store_ps(position + i, xHat);
+        _mm256_store_ps(velocity + i, dxHat);
+    }
+}
+
+void LandmarkFilter::updateKalman(float dt) {
+    // 공분산 예측/갱신은 모든 좌표가 공유하므로 스칼라로 한 번만 계산
+    float dt2 = dt * dt;
+    float q = processNoise;
+    float pp00 = p00 + 2.0f * dt * p01 + dt2 * p11 + q * dt2 * dt2 * 0.25f;
+    float pp01 = p01 + dt * p11 + q * dt2 * dt * 0.5f;
+    float pp11 = p11 + q * dt2;
+
+    float innovationVar = pp00 + measurementNoise;
+    float k0 = pp00 / innovationVar;  // 위치 이득
+    float k1 = pp01 / innovationVar;  // 속도 이득
+
+    p00 = (1.0f - k0) * pp00;
+    p01 = (1.0f - k0) * pp01;
+    p11 = pp11 - k1 * pp01;
+
+    const __m256 dtVec = _mm256_set1_ps(dt);
+    const __m256 gainPos = _mm256_set1_ps(k0);
+    const __m256 gainVel = _mm256_set1_ps(k1);
+
+    for (int i = 0; i < TOTAL; i += 8) {
+        __m256 z = _mm256_load_ps(measured + i);
+        __m256 x = _mm256_load_ps(position + i);
+        __m256 v = _mm256_load_ps(velocity + i);
+
+        x = _mm256_add_ps(x, _mm256_mul_ps(v, dtVec));  // 등속 예측
+        __m256 innovation = _mm256_sub_ps(z, x);
+        x = _mm256_add_ps(x, _mm256_mul_ps(gainPos, innovation));
+        v = _mm256_add_ps(v, _mm256_mul_ps(gainVel, innovation));
+
+        _mm256_store_ps(position + i, x);
+        _mm256_store_ps(velocity + i, v);
+    }
+}
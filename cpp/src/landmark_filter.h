@@ -0,0 +1,75 @@
+#ifndef LANDMARK_FILTER_H
+#define LANDMARK_FILTER_H
+
+/**
+ * 랜드마크 지터 필터 (One-Euro / 등속 칼만)
+ *
+ * - MediaPipe 랜드마크의 프레임 간 떨림을 줄여 라벨이 흔들리지 않게 하는 전처리 단계
+ * - 좌표별 상태를 축(x, y, z)마다 연속 배열(SoA)로 보관: 최대 42개 랜드마크(두 손) x 3축
+ * - 프레임마다 모든 좌표를 한 번의 SIMD 패스로 갱신 (8개 좌표씩)
+ * - 입력 랜드마크 수가 바뀌면(손이 사라지거나 추가됨) 상태를 자동으로 초기화
+ *
+ * 사용: 인식 전에 filter()로 좌표를 제자리에서 평활화
+ *   LandmarkFilter filter(LandmarkFilter::ONE_EURO);
+ *   filter.filter(&landmarks[0].x, 21, 3, timestampSec);  // HandLandmark 배열 (stride 3)
+ *   filter.filter(xyPairs, 21, 2, timestampSec);          // [x0, y0, x1, y1, ...] (stride 2)
+ */
+class LandmarkFilter {
+public:
+    enum Mode {
+        OFF = 0,
+        ONE_EURO = 1,  // 속도 적응형 저역 통과 (느린 움직임은 강하게, 빠른 움직임은 약하게 평활화)
+        KALMAN = 2     // 등속 모델 칼만 필터
+    };
+
+    static constexpr int MAX_LANDMARKS = 42;  // 두 손 (21 x 2)
+    static constexpr int LANES = 48;          // 축별 배열 길이 (8의 배수로 패딩)
+    static constexpr int AXES = 3;
+
+    explicit LandmarkFilter(Mode mode = ONE_EURO);
+
+    void setMode(Mode mode);
+    Mode getMode() const { return filterMode; }
+
+    // One-Euro 파라미터: 최소 차단 주파수(Hz), 속도 계수, 미분 차단 주파수(Hz)
+    void setOneEuroParams(float minCutoff, float beta, float derivativeCutoff);
+
+    // 칼만 파라미터: 프로세스 노이즈(가속도 분산), 측정 노이즈(좌표 분산)
+    void setKalmanParams(float processNoise, float measurementNoise);
+
+    // 타임스탬프가 없을 때 사용할 프레임 간격 (기본 30fps)
+    void setNominalFrameRate(float fps);
+
+    // 상태 초기화 (다음 프레임을 그대로 통과시키고 새로 시작)
+    void reset();
+
+    // data: count개 랜드마크, 랜드마크당 stride개 float (2 = x,y / 3 = x,y,z), 제자리 갱신
+    // timestampSec < 0이면 고정 프레임 간격 사용, count가 MAX_LANDMARKS를 넘으면 앞부분만 처리
+    void filter(float* data, int count, int stride, double timestampSec = -1.0);
+
+private:
+    void updateOneEuro(float dt);
+    void updateKalman(float dt);
+
+    // 축별 SoA 상태 [axis][lane] — 한 패스에서 AXES * LANES 연속 구간을 8개씩 처리
+    alignas(32) float measured[AXES * LANES];  // 이번 프레임 입력 (디인터리브)
+    alignas(32) float position[AXES * LANES];  // 추정 좌표
+    alignas(32) float velocity[AXES * LANES];  // One-Euro: 평활화된 미분, 칼만: 추정 속도
+
+    Mode filterMode;
+    int activeCount = 0;      // 현재 상태가 추적 중인 랜드마크 수 (0 = 초기화 필요)
+    int activeStride = 0;
+    double lastTimestamp = -1.0;
+    float nominalDt = 1.0f / 30.0f;
+
+    float minCutoff = 1.0f;
+    float beta = 20.0f;  // 정규화 좌표(0~1) 속도 기준: 0.15/s 움직임에서 차단 주파수 +3Hz
+    float derivativeCutoff = 1.0f;
+
+    float processNoise = 50.0f;
+    float measurementNoise = 1e-4f;
+    // 칼만 공분산 (2x2 대칭): 모든 좌표가 같은 노이즈와 같은 측정 시점을 가지므로 좌표 간 공유
+    float p00 = 1.0f, p01 = 0.0f, p11 = 1.0f;
+};
+
+#endif // LANDMARK_FILTER_H
@@ -0,0 +1,132 @@
+#include "latency_scheduler.h"
+#include <algorithm>  // std::copy, std::max, std::min
+
+LatencyScheduler::LatencyScheduler(int tierCount, float budgetUs) : tiers(std::max(1, std::min(tierCount, MAX_TIERS))) {
+    for (int t = 0; t < MAX_TIERS; t++) ladder[t] = t;
+    reset();
+    setBudgetUs(budgetUs);
+}
+
+void LatencyScheduler::reset() {
+    current = 0;  // 측정 전에는 사다리 맨 아래 엔진부터 올라감
+    frameCount = lastChange = 0;
+    downgrades = upgrades = probes = 0;
+    for (int t = 0; t < MAX_TIERS; t++) {
+        estimates[t] = -1.0f;
+        runs[t] = 0;
+        lastProbe[t] = 0;
+    }
+    for (Decision& d : log) d = Decision{0, -1, INITIAL, -1.0f, -1.0f, 0.0f};
+}
+
+void LatencyScheduler::setBudgetUs(float budgetUs) {
+    budget = budgetUs > 0.0f ? budgetUs : 0.0f;
+}
+
+bool LatencyScheduler::setOrder(const int* order, int count) {
+    if (!order || count != tiers) return false;
+    bool seen[MAX_TIERS] = {};
+    for (int l = 0; l < count; l++) {
+        if (order[l] < 0 || order[l] >= tiers || seen[order[l]]) return false;
+        seen[order[l]] = true;
+    }
+    std::copy(order, order + count, ladder);
+    current = 0;
+    lastChange = frameCount;
+    return true;
+}
+
+int LatencyScheduler::choose() {
+    const uint64_t frame = frameCount++;
+    int level = current;
+    int reason = frame == 0 ? INITIAL : KEEP;
+
+    if (budget <= 0.0f) {
+        level = tiers - 1;
+        reason = UNLIMITED;
+    } else if (estimates[ladder[current]] > budget) {
+        // 부하로 현재 엔진이 예산 초과 → 예산 안에 드는 가장 정확한 아래 엔진 (없으면 사다리 맨 아래)
+        level = 0;
+        for (int l = current - 1; l > 0; l--) {
+            const float estimate = estimates[ladder[l]];
+            if (estimate >= 0.0f && estimate <= budget) {
+                level = l;
+                break;
+            }
+        }
+        reason = DOWNGRADE;
+    } else if (current + 1 < tiers && frame - lastChange >= HOLD_FRAMES) {
+        const int up = ladder[current + 1];
+        const float next = estimates[up];
+        if (next < 0.0f || next <= budget * UPGRADE_MARGIN) {
+            level = current + 1;
+            reason = UPGRADE;
+        } else if (next <= budget * PROBE_LIMIT && frame - lastProbe[up] >= PROBE_INTERVAL) {
+            // 예산을 약간 넘던 엔진: 부하가 줄었는지 한 프레임만 다시 측정 (현재 엔진은 유지)
+            level = current + 1;
+            reason = PROBE;
+            lastProbe[up] = frame;
+            probes++;
+        }
+    }
+
+    if (reason == DOWNGRADE || reason == UPGRADE) {
+        if (reason == DOWNGRADE) downgrades++;
+        else upgrades++;
+        current = level;
+        lastChange = frame;
+    }
+    const int tier = ladder[level];
+    log[frame % LOG_SIZE] = Decision{frame, tier, reason, estimates[tier], -1.0f, budget};
+    return tier;
+}
+
+void LatencyScheduler::record(int tier, float measuredUs) {
+    if (tier < 0 || tier >= tiers || measuredUs < 0.0f) return;
+    Decision* last = frameCount > 0 ? &log[(frameCount - 1) % LOG_SIZE] : nullptr;
+    if (last && last->tier != tier) last = nullptr;
+    // 재측정은 오래된 추정치를 대체 (평균에 섞으면 부하 감소를 여러 번 재야 알아챔)
+    if (estimates[tier] < 0.0f || (last && last->reason == PROBE)) estimates[tier] = measuredUs;
+    else estimates[tier] += EMA_ALPHA * (measuredUs - estimates[tier]);
+    runs[tier]++;
+    if (last) last->measuredUs = measuredUs;
+    // 재측정 결과 위 엔진이 여유 있게 들어오면 다음 choose()에서 UPGRADE로 올라감
+}
+
+int LatencyScheduler::readDecisions(Decision* out, int maxCount, int64_t afterFrame) const {
+    if (!out || maxCount <= 0 || frameCount == 0) return 0;
+    const uint64_t oldest = frameCount > LOG_SIZE ? frameCount - LOG_SIZE : 0;
+    uint64_t first = std::max<int64_t>(static_cast<int64_t>(oldest), afterFrame + 1);
+    int count = 0;
+    for (uint64_t f = first; f < frameCount && count < maxCount; f++) out[count++] = log[f % LOG_SIZE];
+    return count;
+}
+
+const double* LatencyScheduler::snapshot() {
+    flat[0] = budget;
+    flat[1] = tiers;
+    flat[2] = ladder[current];
+    flat[3] = static_cast<double>(frameCount);
+    flat[4] = static_cast<double>(downgrades);
+    flat[5] = static_cast<double>(upgrades);
+    flat[6] = static_cast<double>(probes);
+    for (int t = 0; t < MAX_TIERS; t++) {
+        flat[HEADER_SIZE + t * FIELDS_PER_TIER] = t < tiers ? estimates[t] : -1.0;
+        flat[HEADER_SIZE + t * FIELDS_PER_TIER + 1] = static_cast<double>(runs[t]);
+        flat[HEADER_SIZE + t * FIELDS_PER_TIER + 2] = -1.0;
+    }
+    for (int l = 0; l < tiers; l++) flat[HEADER_SIZE + ladder[l] * FIELDS_PER_TIER + 2] = l;
+    flat[LOG_OFFSET - 2] = LOG_SIZE;
+    flat[LOG_OFFSET - 1] = FIELDS_PER_DECISION;
+    for (int i = 0; i < LOG_SIZE; i++) {
+        const Decision& d = log[i];
+        double* dst = flat + LOG_OFFSET + i * FIELDS_PER_DECISION;
+        dst[0] = d.tier < 0 ? -1.0 : static_cast<double>(d.frame);
+        dst[1] = d.tier;
+        dst[2] = d.reason;
+        dst[3] = d.estimateUs;
+        dst[4] = d.measuredUs;
+        dst[5] = d.budgetUs;
+    }
+    return flat;
+}
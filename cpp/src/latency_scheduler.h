@@ -0,0 +1,91 @@
+#ifndef LATENCY_SCHEDULER_H
+#define LATENCY_SCHEDULER_H
+
+#include <cstdint>
+
+/**
+ * 프레임 시간 예산 기반 엔진 선택기
+ *
+ * - 엔진(tier)은 0..tierCount - 1 번호, 사다리(ladder)는 엔진을 정확도 오름차순으로 늘어놓은 순서
+ *   (기본은 번호 순서, setOrder로 측정/설정한 정확도 순서로 바꿈). 내리고 올리는 것은 사다리 위치 기준
+ * - 엔진별 실측 시간을 지수 이동 평균(EMA)으로 추적하고, 프레임마다 예산 안에 드는 가장 정확한 엔진 선택
+ *   - 현재 엔진의 평균이 예산을 넘으면 (부하 증가) 예산 안에 드는 아래 엔진으로 즉시 내려감
+ *   - 여유가 있고 HOLD_FRAMES 동안 유지했으면 한 단계 위로: 추정치가 없거나 예산의 UPGRADE_MARGIN 안이면 올림,
+ *     추정치가 예산을 조금 넘는 정도면 PROBE_INTERVAL 프레임마다 한 번 다시 재서 부하 감소를 감지
+ * - 예산 0 이하는 제한 없음 (항상 사다리 맨 위 엔진)
+ * - 모든 결정은 최근 LOG_SIZE개 로그와 snapshot()으로 확인
+ */
+class LatencyScheduler {
+public:
+    static constexpr int MAX_TIERS = 4;
+    static constexpr int LOG_SIZE = 64;
+    static constexpr int HOLD_FRAMES = 8;           // 단계를 바꾼 뒤 올리기 전 최소 유지 프레임
+    static constexpr int PROBE_INTERVAL = 240;      // 예산을 약간 넘는 위 엔진을 다시 재는 간격 (프레임)
+    static constexpr float UPGRADE_MARGIN = 0.9f;   // 위 엔진 추정치가 예산의 이 비율 안이면 올림 (경계에서 오르내림 방지)
+    static constexpr float PROBE_LIMIT = 2.0f;      // 추정치가 예산의 이 배수 이하일 때만 재측정
+    static constexpr float EMA_ALPHA = 0.25f;
+
+    enum Reason { INITIAL = 0, KEEP = 1, DOWNGRADE = 2, UPGRADE = 3, PROBE = 4, UNLIMITED = 5 };
+
+    struct Decision {
+        uint64_t frame;
+        int tier;
+        int reason;
+        float estimateUs;  // 선택 시점의 추정치 (-1: 아직 측정 없음)
+        float measuredUs;  // record() 후 실측 (-1: 아직 기록 전)
+        float budgetUs;
+    };
+
+    // snapshot 레이아웃
+    // [0] 예산(us), [1] 엔진 수, [2] 현재 엔진, [3] 프레임 수, [4] 내림 횟수, [5] 올림 횟수, [6] 재측정 횟수
+    // [7..] 엔진마다 (추정 us, 실행 횟수, 사다리 위치) x MAX_TIERS
+    // 이후 [LOG_SIZE, 결정당 필드 수] + 결정마다 (frame, tier, reason, estimateUs, measuredUs, budgetUs)
+    //   (frame % LOG_SIZE 위치의 링, 아직 없는 칸은 frame -1)
+    static constexpr int HEADER_SIZE = 7;
+    static constexpr int FIELDS_PER_TIER = 3;
+    static constexpr int FIELDS_PER_DECISION = 6;
+    static constexpr int LOG_OFFSET = HEADER_SIZE + MAX_TIERS * FIELDS_PER_TIER + 2;
+    static constexpr int SNAPSHOT_SIZE = LOG_OFFSET + LOG_SIZE * FIELDS_PER_DECISION;
+
+    explicit LatencyScheduler(int tierCount = MAX_TIERS, float budgetUs = 0.0f);
+
+    void setBudgetUs(float budgetUs);
+    float budgetUs() const { return budget; }
+
+    // 사다리 순서 (order[0]이 가장 부정확, order[tierCount - 1]이 가장 정확). 0..tierCount - 1의 순열이 아니면 false
+    // 바꾸면 가장 아래 엔진부터 다시 올라감 (추정치는 유지)
+    bool setOrder(const int* order, int count);
+    int tierAt(int level) const { return level >= 0 && level < tiers ? ladder[level] : -1; }
+
+    // 다음 프레임에 쓸 엔진 (결정을 로그에 남기고 record()를 기다림)
+    int choose();
+
+    // choose()로 고른 엔진의 실측 시간 반영
+    void record(int tier, float measuredUs);
+
+    float estimateUs(int tier) const { return tier >= 0 && tier < tiers ? estimates[tier] : -1.0f; }
+    int currentTier() const { return ladder[current]; }
+    uint64_t frames() const { return frameCount; }
+
+    // frame > afterFrame인 결정을 오래된 순서로 최대 maxCount개 복사 (로그에 남은 것만)
+    int readDecisions(Decision* out, int maxCount, int64_t afterFrame = -1) const;
+
+    const double* snapshot();
+    void reset();
+
+private:
+    int tiers;
+    float budget = 0.0f;
+    int current = 0;  // 사다리 위치
+    uint64_t frameCount = 0;
+    uint64_t lastChange = 0;
+    uint64_t downgrades = 0, upgrades = 0, probes = 0;
+    int ladder[MAX_TIERS];  // 사다리 위치 → 엔진
+    float estimates[MAX_TIERS];  // 이하 엔진 번호 기준
+    uint64_t runs[MAX_TIERS];
+    uint64_t lastProbe[MAX_TIERS];
+    Decision log[LOG_SIZE];
+    double flat[SNAPSHOT_SIZE];
+};
+
+#endif // LATENCY_SCHEDULER_H
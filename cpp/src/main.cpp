@@ -1,5 +1,11 @@
 #include "sign_recognition.h"  // 수화 인식기 헤더 파일 (HandLandmark, RecognitionResult, SignRecognizer 등 정의)
+#include "temporal_conv.h"     // 동적 제스처용 스트리밍 시간 컨볼루션 네트워크
+#include "knn_classifier.h"    // 실행 중 등록 가능한 k-NN 분류기
+#include "memory_accounting.h"  // 서브시스템별 메모리 계정 (getMemoryReport / setMemoryBudget)
 #include <emscripten/bind.h>    // Emscripten 바인딩 라이브러리 (JavaScript와 C++ 연결)
+#include <algorithm>            // std::max_element (TCN 클래스 선택)
+#include <cstdlib>              // std::malloc, std::free (힙 사전 확보)
+#include <memory>               // std::shared_ptr (TCN 모델 공유)
 
 // C 스타일 함수들 (기존 코드와의 호환성을 위해)
 extern "C" {  // C 링킹 규칙 적용 (C++ 네임 맹글링 방지)
@@ -9,6 +15,40 @@ extern "C" {  // C 링킹 규칙 적용 (C++ 네임 맹글링 방지)
     }
 }
 
+/**
+ * reserveHeap 함수
+ * - 목적: 시작 시 힙을 미리 키워 핫패스에서 메모리 확장(ALLOW_MEMORY_GROWTH)이 일어나지 않게 함
+ * - 동작: bytes만큼 할당 후 바로 해제 → WASM 메모리는 줄어들지 않으므로 이후 할당은 확장 없이 처리
+ * - 반환: 성공 여부 (MAXIMUM_MEMORY를 넘으면 false)
+ * - 주의: 확장이 일어나면 기존 HEAP 뷰가 분리되므로 뷰는 이 호출 이후에 만들어야 함
+ */
+bool reserveHeap(int bytes) {
+    if (bytes <= 0) return true;
+    void* block = std::malloc(static_cast<size_t>(bytes));
+    if (!block) return false;
+    std::free(block);
+    return true;
+}
+
+/**
+ * 서브시스템별 메모리 계정
+ * - getMemoryReport(): 태그별 {live, peak, allocations, frees, failures, budget} JSON (바이트/횟수)
+ *   태그: recognizer, model, temporal, knn, fft, image, matrix, other, total
+ *   peak으로 INITIAL_MEMORY를 산정하고, 세션을 닫은 뒤 live가 남으면 누수
+ * - setMemoryBudget(tag, bytes): 태그별 하드 예산 (0: 무제한), 알 수 없는 태그면 false
+ *   예산을 넘는 할당은 실패 (텐서/k-NN/이미지 버퍼는 빈 상태로 처리, pmr 사용자는 미리 확인해 실패 값 반환)
+ */
+std::string getMemoryReport() {
+    return memory_accounting::report();
+}
+
+bool setSubsystemBudget(const std::string& tag, double bytes) {
+    memory_accounting::Tag parsed;
+    if (bytes < 0.0 || !memory_accounting::tagFromName(tag, &parsed)) return false;
+    memory_accounting::setBudget(parsed, static_cast<uint64_t>(bytes));
+    return true;
+}
+
 // WASM 바인딩을 위한 래퍼 함수
 /**
  * SignRecognizerWrapper 클래스
@@ -63,6 +103,62 @@ public:
         return recognizer.recognizeFromPointer(landmarks, count);  // 내부 인식기의 recognizeFromPointer 호출
     }
     
+    /**
+     * 고정 스테이징 버퍼 (인스턴스 수명 동안 주소 불변)
+     * - getInputBuffer(): 입력 버퍼 주소 (MAX_BATCH_FRAMES * 42 floats, 프레임마다 [x0, y0, x1, y1, ...])
+     * - getOutputBuffer(): 출력 버퍼 주소 (MAX_BATCH_FRAMES * 2 floats, 프레임마다 [id, confidence], 두 손 경로는 프레임마다 6 floats)
+     * - JavaScript는 주소를 한 번 받아 Float32Array 뷰를 만들어 재사용
+     */
+    uintptr_t getInputBuffer() {  // 입력 스테이징 버퍼 주소
+        return reinterpret_cast<uintptr_t>(recognizer.getInputBuffer());
+    }
+    
+    uintptr_t getOutputBuffer() {  // 출력 스테이징 버퍼 주소
+        return reinterpret_cast<uintptr_t>(recognizer.getOutputBuffer());
+    }
+    
+    int getMaxBatchFrames() {  // 스테이징 버퍼가 담을 수 있는 최대 프레임 수
+        return SignRecognizer::MAX_BATCH_FRAMES;
+    }
+    
+    int recognizeStaged(int frameCount) {  // 입력 스테이징 버퍼의 프레임들을 인식하여 출력 버퍼에 기록
+        return recognizer.recognizeStaged(frameCount);
+    }
+    
+    /**
+     * 두 손 동시 인식 (한 패스로 두 손 처리, 손마다 결과는 recognize와 같음)
+     * - recognizeTwoHands(left, right): 21개가 아닌 배열(빈 배열)은 손 없음, 반환 { left, right, combined }
+     * - recognizeStagedTwoHands(n): 입력 버퍼에 프레임마다 왼손 42 + 오른손 42 floats (좌표가 모두 0이면 손 없음)
+     *   출력 버퍼에 프레임마다 [id, confidence] x (왼손, 오른손, 조합), 최대 getMaxTwoHandFrames()개
+     */
+    TwoHandResult recognizeTwoHands(const std::vector<HandLandmark>& left, const std::vector<HandLandmark>& right) {
+        return recognizer.recognizeTwoHands(left, right);
+    }
+    
+    int recognizeStagedTwoHands(int frameCount) {
+        return recognizer.recognizeStagedTwoHands(frameCount);
+    }
+    
+    int getMaxTwoHandFrames() {
+        return SignRecognizer::MAX_TWO_HAND_FRAMES;
+    }
+    
+    std::string getGestureName(int id) {  // 제스처 ID → 이름 (JavaScript 캐시용)
+        return SignRecognizer::getGestureName(id);
+    }
+    
+    void setLandmarkFilter(int mode) {  // 인식 앞단 지터 필터 (0: 끄기, 1: One-Euro, 2: 칼만)
+        recognizer.setLandmarkFilter(mode);
+    }
+    
+    void setFilterFrameRate(float fps) {  // 필터가 가정할 프레임 속도 (기본 30fps)
+        recognizer.setFilterFrameRate(fps);
+    }
+    
+    void resetLandmarkFilter() {  // 필터 상태 초기화 (손을 놓쳤다가 다시 잡았을 때 등)
+        recognizer.resetLandmarkFilter();
+    }
+    
     void setDetectionThreshold(float threshold) {  // 감지 임계값 설정 (손이 감지되었는지 판단하는 기준값)
         recognizer.setDetectionThreshold(threshold);  // 내부 인식기에 임계값 전달
     }
@@ -74,6 +170,200 @@ public:
     std::string getVersion() {  // 버전 정보 반환 (예: "Sign Recognition WASM Module v1.0.0")
         return recognizer.getVersion();  // 내부 인식기의 버전 정보 반환
     }
+    
+    /**
+     * getStats 함수
+     * - 반환: WASM 힙을 가리키는 Float64Array 뷰 (PerfStats::SNAPSHOT_SIZE개)
+     * - 레이아웃: [활성화 여부, 단계 수, 단계당 필드 수, 단계별 calls/totalUs/meanUs/minUs/maxUs/p50Us/p99Us/allocations ...]
+     * - 주의: 힙 뷰이므로 JavaScript에서 slice()로 복사해서 보관해야 함
+     */
+    emscripten::val getStats() {  // 단계별 계측 통계 반환
+        const double* snapshot = recognizer.getStatsSnapshot();  // 최신 통계로 갱신
+        return emscripten::val(emscripten::typed_memory_view(PerfStats::SNAPSHOT_SIZE, snapshot));  // 복사 없는 typed array 뷰
+    }
+    
+    void resetStats() {  // 계측 통계 초기화
+        recognizer.resetStats();
+    }
+    
+    /**
+     * 시간 예산 기반 엔진 선택 (규칙 / 210 특징 신경망 / 대형 신경망)
+     * - setLatencyBudget(ms): 프레임당 예산 (기본 4, 60fps 프레임의 약 1/4), 0 이하는 제한 없음
+     * - setTierAccuracy(rules, mlp, heavy): 잰 정확도로 엔진 순서를 다시 정함 (기본 규칙 < 신경망 < 대형)
+     * - recognizeScheduled(): 예산 안에 드는 가장 정확한 엔진으로 인식, getLastTier()로 고른 엔진 확인
+     * - getSchedulerStats(): LatencyScheduler::snapshot() Float64Array 뷰 (엔진별 평균 시간, 최근 결정 로그)
+     */
+    RecognitionResult recognizeScheduled(const std::vector<HandLandmark>& landmarks) {
+        return recognizer.recognizeScheduled(landmarks);
+    }
+    
+    void setLatencyBudget(float budgetMs) {
+        recognizer.setLatencyBudget(budgetMs);
+    }
+    
+    bool setTierAccuracy(float rules, float mlp, float heavy) {
+        const float accuracy[SignRecognizer::TIER_COUNT] = {rules, mlp, heavy};
+        return recognizer.setTierAccuracy(accuracy, SignRecognizer::TIER_COUNT);
+    }
+    
+    int getLastTier() {
+        return recognizer.getLastTier();
+    }
+    
+    emscripten::val getSchedulerStats() {
+        const double* snapshot = recognizer.getSchedulerSnapshot();
+        return emscripten::val(emscripten::typed_memory_view(LatencyScheduler::SNAPSHOT_SIZE, snapshot));
+    }
+    
+    /**
+     * 커널 자동 튜닝 (블록/타일/배치 크기, kernel_tuning.h)
+     * - autotuneKernels(repeats): 이 기기에서 후보를 재서 적용하고 프로필 문자열 반환 (첫 실행 시 한 번, 수백 ms)
+     * - autotuneKernelStep(step, repeats): 파라미터 하나만 재서 적용 (유휴 시간 조각마다 한 단계, 끝이면 -1)
+     * - applyKernelProfile(text): 보관해 둔 프로필 적용 (다른 빌드 대상의 프로필이면 false, 기본값 유지)
+     * - getKernelProfile(): 현재 값 프로필 문자열
+     * - 보조 모듈(image/matrix)은 로드 후 setKernelParameter로 같은 값을 따로 적용
+     */
+    std::string autotuneKernels(int repeats) {
+        return SignRecognizer::autotuneKernels(repeats);
+    }
+    
+    int autotuneKernelStep(int step, int repeats) {
+        return SignRecognizer::autotuneKernelStep(step, repeats);
+    }
+    
+    bool applyKernelProfile(const std::string& text) {
+        return kernel_tuning::parse(text);
+    }
+    
+    std::string getKernelProfile() {
+        return kernel_tuning::serialize();
+    }
+};
+
+/**
+ * KnnClassifierWrapper 클래스
+ * - 목적: 재학습 없이 새 수어를 실행 중에 등록하는 k-NN 엔진을 JavaScript에 노출
+ * - 입력: predictMLP와 같은 126차원 특징 (왼손 63 + 오른손 63, 스케일러 적용 전)
+ * - 사용: setScaler() → addSample(features, labelId) 반복 → predict(features)
+ */
+class KnnClassifierWrapper {
+public:
+    KnnClassifierWrapper() : knn(SignRecognition::featureDim(), 5) {}
+
+    void setScaler(const std::vector<float>& mean, const std::vector<float>& scale) { knn.setScaler(mean, scale); }
+    void setK(int k) { knn.setK(k); }
+
+    int addSample(const std::vector<float>& features, int label) {  // 등록 인덱스 반환 (-1: 잘못된 입력)
+        if (features.size() != static_cast<size_t>(knn.dim())) return -1;
+        return knn.addSample(features.data(), label);
+    }
+
+    int predict(const std::vector<float>& features) {  // 라벨 ID (-1: 등록된 샘플 없음)
+        if (features.size() != static_cast<size_t>(knn.dim())) return -1;
+        return knn.predict(features.data(), &lastConfidence);
+    }
+
+    float getConfidence() { return lastConfidence; }  // 마지막 predict의 가중 투표 비율
+    int size() { return static_cast<int>(knn.size()); }
+    void clear() { knn.clear(); }
+
+private:
+    KnnClassifier knn;
+    float lastConfidence = 0.0f;
+};
+
+/**
+ * LandmarkFilterWrapper 클래스
+ * - 목적: MLP 특징 변환 전(두 손 42개 랜드마크)에 JavaScript에서 직접 지터 필터 적용
+ * - 사용: WASM 힙의 좌표 배열 포인터를 넘기면 제자리에서 평활화
+ */
+class LandmarkFilterWrapper {
+public:
+    explicit LandmarkFilterWrapper(int mode) : filter(toMode(mode)) {}
+
+    void setMode(int mode) { filter.setMode(toMode(mode)); }
+
+    void setOneEuroParams(float minCutoff, float beta, float derivativeCutoff) {
+        filter.setOneEuroParams(minCutoff, beta, derivativeCutoff);
+    }
+
+    void setKalmanParams(float processNoise, float measurementNoise) {
+        filter.setKalmanParams(processNoise, measurementNoise);
+    }
+
+    // dataPtr: count개 랜드마크 x stride floats (2 또는 3), timestampMs < 0이면 고정 프레임 간격
+    void filterInPlace(uintptr_t dataPtr, int count, int stride, double timestampMs) {
+        filter.filter(reinterpret_cast<float*>(dataPtr), count, stride, timestampMs < 0 ? -1.0 : timestampMs / 1000.0);
+    }
+
+    void reset() { filter.reset(); }
+
+private:
+    static LandmarkFilter::Mode toMode(int mode) {
+        return mode == LandmarkFilter::KALMAN ? LandmarkFilter::KALMAN
+             : mode == LandmarkFilter::ONE_EURO ? LandmarkFilter::ONE_EURO : LandmarkFilter::OFF;
+    }
+
+    LandmarkFilter filter;
+};
+
+/**
+ * TemporalGestureWrapper 클래스
+ * - 목적: 동적(움직임) 제스처용 스트리밍 TCN을 JavaScript에서 프레임 단위로 사용
+ * - 사용: 프레임마다 getInputBuffer() 뷰에 126차원 특징(정규화 후)을 쓰고 step() 호출
+ * - 비용: 레이어별 상태 버퍼 덕분에 프레임당 한 단계만 계산 (윈도우 재계산 없음)
+ * - 가중치: 학습된 가중치가 없으면 고정 시드 초기화, loadWeights()로 교체
+ */
+class TemporalGestureWrapper {
+public:
+    static constexpr int INPUT_DIM = 126;  // 왼손 63 + 오른손 63
+    static constexpr int NUM_CLASSES = 4;  // labels.json 클래스 수
+
+    TemporalGestureWrapper() : model(createModel(nullptr, 0)), state(model), input(INPUT_DIM, 0.0f) {}
+
+    bool loadWeights(const std::vector<float>& weights) {  // 평탄화된 가중치 (레이아웃은 temporal_conv.h 참고)
+        std::shared_ptr<const TemporalConvModel> loaded = createModel(weights.data(), weights.size());
+        if (!loaded) return false;
+        model = loaded;
+        state = TemporalConvState(model);  // 새 모델 기준으로 상태 초기화
+        return true;
+    }
+
+    uintptr_t getInputBuffer() {  // 입력 버퍼 주소 (INPUT_DIM floats, 인스턴스 수명 동안 불변)
+        return reinterpret_cast<uintptr_t>(input.data());
+    }
+
+    int step() {  // 입력 버퍼의 프레임 하나를 처리하고 최고 점수 클래스 ID 반환
+        const float* logits = state.step(input.data());
+        lastLogits = logits;
+        return static_cast<int>(std::max_element(logits, logits + model->numClasses()) - logits);
+    }
+
+    emscripten::val getLogits() {  // 마지막 step()의 클래스 점수 (힙 뷰, 다음 step까지 유효)
+        return emscripten::val(emscripten::typed_memory_view(lastLogits ? model->numClasses() : 0, lastLogits));
+    }
+
+    void reset() {  // 스트림 상태 초기화 (새 시퀀스 시작)
+        state.reset();
+        lastLogits = nullptr;
+    }
+
+    int getReceptiveField() { return model->receptiveField(); }  // 출력 하나가 보는 과거 프레임 수
+    int getParameterCount() { return static_cast<int>(model->parameterCount()); }
+
+private:
+    static std::shared_ptr<const TemporalConvModel> createModel(const float* weights, size_t count) {
+        auto created = std::make_shared<TemporalConvModel>(INPUT_DIM, TemporalConvModel::defaultLayers(), NUM_CLASSES);
+        if (!created->valid()) return nullptr;
+        if (!weights) created->initializeDeterministic(42);
+        else if (!created->loadWeights(weights, count)) return nullptr;
+        return created;
+    }
+
+    std::shared_ptr<const TemporalConvModel> model;
+    TemporalConvState state;
+    std::vector<float> input;
+    const float* lastLogits = nullptr;
 };
 
 // Embind 바인딩
@@ -82,6 +372,9 @@ EMSCRIPTEN_BINDINGS(sign_wasm_module) {  // Emscripten 바인딩 블록 시작 (
     
     // C 스타일 함수 바인딩
     function("test_function", &test_function, allow_raw_pointers());  // test_function을 JavaScript에서 호출 가능하게 등록
+    function("reserveHeap", &reserveHeap);  // 시작 시 힙 사전 확보 (핫패스 메모리 확장 방지)
+    function("getMemoryReport", &getMemoryReport);  // 서브시스템별 현재/최대 바이트 (JSON)
+    function("setMemoryBudget", &setSubsystemBudget);  // 서브시스템별 하드 예산
     
     // HandLandmark 구조체 바인딩
     /**
@@ -116,6 +409,13 @@ EMSCRIPTEN_BINDINGS(sign_wasm_module) {  // Emscripten 바인딩 블록 시작 (
         .property("confidence", &RecognitionResult::confidence)  // confidence 속성 등록 (신뢰도)
         .property("id", &RecognitionResult::id);  // id 속성 등록 (제스처 ID)
     
+    // 두 손 인식 결과 { left, right, combined } (각각 RecognitionResult)
+    class_<TwoHandResult>("TwoHandResult")
+        .constructor<>()
+        .property("left", &TwoHandResult::left)
+        .property("right", &TwoHandResult::right)
+        .property("combined", &TwoHandResult::combined);
+    
     // SignRecognizer 래퍼 클래스 바인딩
     /**
      * SignRecognizerWrapper 바인딩
@@ -125,18 +425,45 @@ EMSCRIPTEN_BINDINGS(sign_wasm_module) {  // Emscripten 바인딩 블록 시작 (
      *   - initialize(): 인식기 초기화 (가중치 로드, 임계값 설정 등)
      *   - recognize(): HandLandmark 배열로 제스처 인식
      *   - recognizeFromPointer(): 메모리 포인터로 직접 인식 (성능 최적화)
+     *   - getInputBuffer()/getOutputBuffer(): 고정 스테이징 버퍼 주소 (한 번만 조회)
+     *   - recognizeStaged(): 스테이징 버퍼로 할당/JSON 없이 인식
+     *   - recognizeTwoHands()/recognizeStagedTwoHands(): 두 손을 한 번에 인식 (손별 결과 + 조합 라벨)
      *   - setDetectionThreshold(): 손 감지 임계값 설정
      *   - setRecognitionThreshold(): 제스처 인식 임계값 설정
      *   - getVersion(): 모듈 버전 정보 반환
+     *   - getStats(): 단계별 계측 통계 (Float64Array, STATS=1 빌드에서만 값이 쌓임)
+     *   - resetStats(): 계측 통계 초기화
      */
     class_<SignRecognizerWrapper>("SignRecognizer")  // SignRecognizerWrapper를 JavaScript에서 SignRecognizer로 사용
         .constructor<>()  // 기본 생성자 등록 (new SignRecognizer() 가능)
         .function("initialize", &SignRecognizerWrapper::initialize)  // initialize 메서드 등록
         .function("recognize", &SignRecognizerWrapper::recognize)  // recognize 메서드 등록
         .function("recognizeFromPointer", &SignRecognizerWrapper::recognizeFromPointer)  // recognizeFromPointer 메서드 등록 (직접 메모리 접근)
+        .function("getInputBuffer", &SignRecognizerWrapper::getInputBuffer)  // 입력 스테이징 버퍼 주소
+        .function("getOutputBuffer", &SignRecognizerWrapper::getOutputBuffer)  // 출력 스테이징 버퍼 주소
+        .function("getMaxBatchFrames", &SignRecognizerWrapper::getMaxBatchFrames)  // 스테이징 최대 프레임 수
+        .function("recognizeStaged", &SignRecognizerWrapper::recognizeStaged)  // 스테이징 버퍼 인식
+        .function("recognizeTwoHands", &SignRecognizerWrapper::recognizeTwoHands)  // 두 손 동시 인식
+        .function("recognizeStagedTwoHands", &SignRecognizerWrapper::recognizeStagedTwoHands)  // 두 손 스테이징 인식
+        .function("getMaxTwoHandFrames", &SignRecognizerWrapper::getMaxTwoHandFrames)  // 두 손 스테이징 최대 프레임 수
+        .function("getGestureName", &SignRecognizerWrapper::getGestureName)  // 제스처 ID → 이름
+        .function("setLandmarkFilter", &SignRecognizerWrapper::setLandmarkFilter)  // 인식 앞단 지터 필터 모드
+        .function("setFilterFrameRate", &SignRecognizerWrapper::setFilterFrameRate)  // 필터 프레임 속도
+        .function("resetLandmarkFilter", &SignRecognizerWrapper::resetLandmarkFilter)  // 필터 상태 초기화
         .function("setDetectionThreshold", &SignRecognizerWrapper::setDetectionThreshold)  // setDetectionThreshold 메서드 등록
         .function("setRecognitionThreshold", &SignRecognizerWrapper::setRecognitionThreshold)  // setRecognitionThreshold 메서드 등록
-        .function("getVersion", &SignRecognizerWrapper::getVersion);  // getVersion 메서드 등록
+        .function("getVersion", &SignRecognizerWrapper::getVersion)  // getVersion 메서드 등록
+        .function("getStats", &SignRecognizerWrapper::getStats)  // getStats 메서드 등록 (계측 통계)
+        .function("resetStats", &SignRecognizerWrapper::resetStats)  // resetStats 메서드 등록
+        .function("recognizeScheduled", &SignRecognizerWrapper::recognizeScheduled)  // 시간 예산 기반 엔진 선택 인식
+        .function("setLatencyBudget", &SignRecognizerWrapper::setLatencyBudget)  // 프레임당 예산 (ms)
+        .function("setTierAccuracy", &SignRecognizerWrapper::setTierAccuracy)  // 엔진별 정확도 → 사다리 순서
+        .function("getLastTier", &SignRecognizerWrapper::getLastTier)  // 마지막으로 고른 엔진
+        .function("getSchedulerStats", &SignRecognizerWrapper::getSchedulerStats)  // 엔진별 평균 시간 + 결정 로그
+        .function("autotuneKernels", &SignRecognizerWrapper::autotuneKernels)  // 커널 자동 튜닝 → 프로필 문자열
+        .function("autotuneKernelStep", &SignRecognizerWrapper::autotuneKernelStep)  // 파라미터 하나 튜닝 → 승자 값
+        .function("applyKernelProfile", &SignRecognizerWrapper::applyKernelProfile)  // 보관한 프로필 적용
+        .function("getKernelProfile", &SignRecognizerWrapper::getKernelProfile);  // 현재 튜닝 값
     
     // std::vector<HandLandmark> 바인딩
     /**
@@ -168,6 +495,7 @@ EMSCRIPTEN_BINDINGS(sign_wasm_module) {  // Emscripten 바인딩 블록 시작 (
      * - 주요 메서드:
      *   - setScaler(): 정규화 스케일러 설정 (mean, scale 벡터)
      *   - predictMLP(): MLP 모델로 제스처 예측
+     *   - setSparsity(sparsity, blockRows, blockCols): 블록 희소 추론 (예: 0.7, 1, 8 / 0 = 밀집)
      */
     class_<SignRecognition>("SignRecognition")  // SignRecognition 클래스를 JavaScript에서 사용 가능하게 등록 (MLP 인식기)
         .constructor<>()  // 기본 생성자 등록 (new SignRecognition() 가능)
@@ -175,6 +503,53 @@ EMSCRIPTEN_BINDINGS(sign_wasm_module) {  // Emscripten 바인딩 블록 시작 (
         // MLP 함수 바인딩
         .function("setScaler", &SignRecognition::setScaler)  // setScaler 메서드 등록 (정규화 스케일러 설정)
         .function("predictMLP", &SignRecognition::predictMLP)  // predictMLP 메서드 등록 (MLP 모델 예측)
+        .function("setSparsity", &SignRecognition::setSparsity)  // 블록 희소 추론 설정 (가지치기 비율, 블록 모양)
+        .function("activeInputCount", &SignRecognition::activeInputCount)  // 가지치기 후 사용하는 입력 특징 수
         ;  // 바인딩 블록 종료
+
+    /**
+     * KnnClassifierWrapper 바인딩 (JavaScript에서는 KnnClassifier)
+     * - 등록: addSample(VectorFloat, labelId), 예측: predict(VectorFloat) → labelId, getConfidence()
+     */
+    class_<KnnClassifierWrapper>("KnnClassifier")
+        .constructor<>()
+        .function("setScaler", &KnnClassifierWrapper::setScaler)
+        .function("setK", &KnnClassifierWrapper::setK)
+        .function("addSample", &KnnClassifierWrapper::addSample)
+        .function("predict", &KnnClassifierWrapper::predict)
+        .function("getConfidence", &KnnClassifierWrapper::getConfidence)
+        .function("size", &KnnClassifierWrapper::size)
+        .function("clear", &KnnClassifierWrapper::clear)
+        ;
+
+    /**
+     * LandmarkFilterWrapper 바인딩 (JavaScript에서는 LandmarkFilter)
+     * - 생성: new LandmarkFilter(mode)  (0: 끄기, 1: One-Euro, 2: 칼만)
+     * - 사용: filterInPlace(ptr, count, stride, timestampMs)로 WASM 힙 좌표를 제자리 평활화
+     */
+    class_<LandmarkFilterWrapper>("LandmarkFilter")
+        .constructor<int>()
+        .function("setMode", &LandmarkFilterWrapper::setMode)
+        .function("setOneEuroParams", &LandmarkFilterWrapper::setOneEuroParams)
+        .function("setKalmanParams", &LandmarkFilterWrapper::setKalmanParams)
+        .function("filterInPlace", &LandmarkFilterWrapper::filterInPlace)
+        .function("reset", &LandmarkFilterWrapper::reset)
+        ;
+
+    /**
+     * TemporalGestureWrapper 바인딩 (JavaScript에서는 TemporalGestureRecognizer)
+     * - 구조: 126 → 64(k3,d1) → 64(k3,d2) → 64(k3,d4) → 4 클래스, 수용 영역 15프레임
+     * - 사용: 입력 버퍼에 프레임 특징 기록 → step() → getLogits()
+     */
+    class_<TemporalGestureWrapper>("TemporalGestureRecognizer")
+        .constructor<>()
+        .function("loadWeights", &TemporalGestureWrapper::loadWeights)  // 학습된 가중치 로드
+        .function("getInputBuffer", &TemporalGestureWrapper::getInputBuffer)  // 입력 버퍼 주소
+        .function("step", &TemporalGestureWrapper::step)  // 프레임 하나 증분 처리
+        .function("getLogits", &TemporalGestureWrapper::getLogits)  // 마지막 클래스 점수
+        .function("reset", &TemporalGestureWrapper::reset)  // 시퀀스 상태 초기화
+        .function("getReceptiveField", &TemporalGestureWrapper::getReceptiveField)
+        .function("getParameterCount", &TemporalGestureWrapper::getParameterCount)
+        ;
 }
 
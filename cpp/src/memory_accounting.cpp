@@ -0,0 +1,241 @@
+#include "memory_accounting.h"
+
+#include <atomic>
+#include <cstdlib>  // std::malloc, std::aligned_alloc, std::free
+#include <cstring>  // std::memcpy (allocateTracked 앞머리)
+#include <sstream>
+
+namespace memory_accounting {
+
+namespace {
+
+const char* const TAG_NAMES[TAG_COUNT] = {"recognizer", "model", "temporal", "knn", "fft", "image", "matrix", "other"};
+
+constexpr size_t TRACKED_HEADER = 64;  // allocateTracked 앞머리 (반환 주소 64바이트 정렬 유지)
+
+struct Counters {
+    std::atomic<uint64_t> live{0};
+    std::atomic<uint64_t> peak{0};
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> frees{0};
+    std::atomic<uint64_t> failures{0};
+    std::atomic<uint64_t> budget{0};
+};
+
+Counters counters[TAG_COUNT];
+Counters total;
+std::atomic<int> lastFailure{-1};
+
+void raisePeak(Counters& c, uint64_t live) {
+    uint64_t peak = c.peak.load(std::memory_order_relaxed);
+    while (live > peak && !c.peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+void recordFailure(Tag tag) {
+    counters[tag].failures.fetch_add(1, std::memory_order_relaxed);
+    total.failures.fetch_add(1, std::memory_order_relaxed);
+    lastFailure.store(tag, std::memory_order_relaxed);
+}
+
+// 예산 안이면 bytes를 태그 계정에 올리고 true (실제 할당 후 commit, 실패 시 cancel)
+bool reserve(Tag tag, size_t bytes) {
+    Counters& c = counters[tag];
+    const uint64_t budget = c.budget.load(std::memory_order_relaxed);
+    const uint64_t live = c.live.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    if (budget != 0 && live > budget) {
+        c.live.fetch_sub(bytes, std::memory_order_relaxed);
+        recordFailure(tag);
+        return false;
+    }
+    return true;
+}
+
+void commit(Tag tag, size_t bytes) {
+    Counters& c = counters[tag];
+    raisePeak(c, c.live.load(std::memory_order_relaxed));
+    c.allocations.fetch_add(1, std::memory_order_relaxed);
+    raisePeak(total, total.live.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    total.allocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void cancel(Tag tag, size_t bytes) {
+    counters[tag].live.fetch_sub(bytes, std::memory_order_relaxed);
+    recordFailure(tag);
+}
+
+void release(Tag tag, size_t bytes) {
+    counters[tag].live.fetch_sub(bytes, std::memory_order_relaxed);
+    counters[tag].frees.fetch_add(1, std::memory_order_relaxed);
+    total.live.fetch_sub(bytes, std::memory_order_relaxed);
+    total.frees.fetch_add(1, std::memory_order_relaxed);
+}
+
+TagStats read(const Counters& c) {
+    TagStats s;
+    s.liveBytes = c.live.load(std::memory_order_relaxed);
+    s.peakBytes = c.peak.load(std::memory_order_relaxed);
+    s.allocations = c.allocations.load(std::memory_order_relaxed);
+    s.frees = c.frees.load(std::memory_order_relaxed);
+    s.failures = c.failures.load(std::memory_order_relaxed);
+    s.budgetBytes = c.budget.load(std::memory_order_relaxed);
+    return s;
+}
+
+// pmr 자원: 계정에 올린 뒤 상위 자원에서 할당
+class TaggedResource : public std::pmr::memory_resource {
+public:
+    TaggedResource(Tag t) : tag(t) {}
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        if (!reserve(tag, bytes)) return std::pmr::null_memory_resource()->allocate(bytes, alignment);  // bad_alloc
+        void* ptr = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        commit(tag, bytes);
+        return ptr;
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        release(tag, bytes);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    Tag tag;
+};
+
+TaggedResource* resources() {
+    static TaggedResource instances[TAG_COUNT] = {RECOGNIZER, MODEL, TEMPORAL, KNN, FFT, IMAGE, MATRIX, OTHER};
+    return instances;
+}
+
+}  // namespace
+
+const char* tagName(Tag tag) {
+    return tag >= 0 && tag < TAG_COUNT ? TAG_NAMES[tag] : "unknown";
+}
+
+bool tagFromName(const std::string& name, Tag* tag) {
+    for (int t = 0; t < TAG_COUNT; t++) {
+        if (name == TAG_NAMES[t]) {
+            if (tag) *tag = Tag(t);
+            return true;
+        }
+    }
+    return false;
+}
+
+void* allocate(Tag tag, size_t bytes, size_t alignment) {
+    if (tag < 0 || tag >= TAG_COUNT || bytes == 0) return nullptr;
+    if (!reserve(tag, bytes)) return nullptr;
+    void* ptr = alignment <= alignof(std::max_align_t)
+                    ? std::malloc(bytes)
+                    : std::aligned_alloc(alignment, (bytes + alignment - 1) / alignment * alignment);  // 크기는 정렬 배수
+    if (ptr) commit(tag, bytes);
+    else cancel(tag, bytes);
+    return ptr;
+}
+
+void deallocate(Tag tag, void* ptr, size_t bytes) {
+    if (!ptr) return;
+    std::free(ptr);
+    release(tag, bytes);
+}
+
+void* allocateTracked(Tag tag, size_t bytes) {
+    char* block = static_cast<char*>(allocate(tag, bytes + TRACKED_HEADER, TRACKED_HEADER));
+    if (!block) return nullptr;
+    uint64_t header[2] = {static_cast<uint64_t>(tag), static_cast<uint64_t>(bytes + TRACKED_HEADER)};
+    std::memcpy(block, header, sizeof(header));
+    return block + TRACKED_HEADER;
+}
+
+void deallocateTracked(void* ptr) {
+    if (!ptr) return;
+    char* block = static_cast<char*>(ptr) - TRACKED_HEADER;
+    uint64_t header[2];
+    std::memcpy(header, block, sizeof(header));
+    deallocate(Tag(header[0]), block, static_cast<size_t>(header[1]));
+}
+
+std::pmr::memory_resource* resource(Tag tag) {
+    return &resources()[tag >= 0 && tag < TAG_COUNT ? tag : OTHER];
+}
+
+bool fitsBudget(Tag tag, size_t bytes) {
+    if (tag < 0 || tag >= TAG_COUNT) return false;
+    const uint64_t budget = counters[tag].budget.load(std::memory_order_relaxed);
+    if (budget == 0 || counters[tag].live.load(std::memory_order_relaxed) + bytes <= budget) return true;
+    recordFailure(tag);
+    return false;
+}
+
+void setBudget(Tag tag, uint64_t bytes) {
+    if (tag >= 0 && tag < TAG_COUNT) counters[tag].budget.store(bytes, std::memory_order_relaxed);
+}
+
+TagStats stats(Tag tag) {
+    return tag >= 0 && tag < TAG_COUNT ? read(counters[tag]) : TagStats();
+}
+
+TagStats totals() {
+    return read(total);
+}
+
+int lastFailedTag() {
+    return lastFailure.load(std::memory_order_relaxed);
+}
+
+void resetPeaks() {
+    for (int t = 0; t < TAG_COUNT; t++) counters[t].peak.store(counters[t].live.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    total.peak.store(total.live.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+std::string report() {
+    std::ostringstream out;
+    auto entry = [&out](const char* name, const TagStats& s) {
+        out << '"' << name << "\":{\"live\":" << s.liveBytes << ",\"peak\":" << s.peakBytes << ",\"allocations\":" << s.allocations
+            << ",\"frees\":" << s.frees << ",\"failures\":" << s.failures << ",\"budget\":" << s.budgetBytes << '}';
+    };
+    out << '{';
+    for (int t = 0; t < TAG_COUNT; t++) {
+        entry(TAG_NAMES[t], stats(Tag(t)));
+        out << ',';
+    }
+    entry("total", totals());
+    out << '}';
+    return out.str();
+}
+
+}  // namespace memory_accounting
+
+void* allocateTagged(int tag, int bytes) {
+    if (tag < 0 || tag >= memory_accounting::TAG_COUNT || bytes <= 0) return nullptr;
+    return memory_accounting::allocateTracked(memory_accounting::Tag(tag), static_cast<size_t>(bytes));
+}
+
+void freeTagged(void* ptr) {
+    memory_accounting::deallocateTracked(ptr);
+}
+
+double getMemoryStat(int tag, int field) {
+    if (tag < 0 || tag > memory_accounting::TAG_COUNT) return -1.0;
+    const memory_accounting::TagStats s =
+        tag == memory_accounting::TAG_COUNT ? memory_accounting::totals() : memory_accounting::stats(memory_accounting::Tag(tag));
+    switch (field) {
+        case 0: return static_cast<double>(s.liveBytes);
+        case 1: return static_cast<double>(s.peakBytes);
+        case 2: return static_cast<double>(s.allocations);
+        case 3: return static_cast<double>(s.frees);
+        case 4: return static_cast<double>(s.failures);
+        case 5: return static_cast<double>(s.budgetBytes);
+        default: return -1.0;
+    }
+}
+
+int setMemoryBudget(int tag, double bytes) {
+    if (tag < 0 || tag >= memory_accounting::TAG_COUNT || bytes < 0.0) return 0;
+    memory_accounting::setBudget(memory_accounting::Tag(tag), static_cast<uint64_t>(bytes));
+    return 1;
+}
@@ -0,0 +1,92 @@
+#ifndef MEMORY_ACCOUNTING_H
+#define MEMORY_ACCOUNTING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+/**
+ * 서브시스템별 메모리 계정 (태그 할당기)
+ *
+ * - 할당마다 태그(인식기/모델/TCN/k-NN/FFT/이미지/행렬)를 붙여 현재 바이트, 최대(high-water) 바이트,
+ *   할당/해제 횟수, 예산 초과 횟수를 집계 → wasm 힙(MAXIMUM_MEMORY)을 누가 쓰는지 확인하고
+ *   INITIAL_MEMORY 크기 산정, 세션이 끝났는데 남는 바이트(누수) 발견에 사용
+ * - 태그별 하드 예산(setBudget): 넘는 할당은 실패
+ *   allocate/allocateTracked: nullptr 반환 (호출자가 처리, 예외 없음)
+ *   resource(tag) (pmr 컨테이너용): memory_resource 계약대로 std::bad_alloc (wasm 빌드는 -fno-exceptions라 중단)
+ *   → pmr 사용자(컨볼루션 엔진, 행렬 튜닝, 손 ROI)는 컨테이너를 키우기 전에 fitsBudget으로 확인하고
+ *     넘으면 자기 실패 값을 반환하므로 예산 초과가 모듈 중단으로 이어지지 않음
+ * - 계수기는 원자 변수라 여러 스레드에서 할당해도 안전
+ * - 보조 wasm 모듈은 힙이 따로이므로 모듈마다 자기 계정을 가짐 (C 내보내기로 조회)
+ */
+namespace memory_accounting {
+
+enum Tag {
+    RECOGNIZER = 0,  // SignRecognizer 스테이징/스크래치/활성값
+    MODEL,           // 공유 신경망 가중치 (SignModel)
+    TEMPORAL,        // TCN 스트림 상태 (링 버퍼)
+    KNN,             // k-NN 표본 블록
+    FFT,             // 컨볼루션 엔진 (트위들, 커널 스펙트럼, 작업 버퍼)
+    IMAGE,           // 이미지 필터 임시 버퍼, 적분 영상
+    MATRIX,          // 대용량 행렬 곱셈 입출력 (allocateTagged)
+    OTHER,
+    TAG_COUNT
+};
+
+struct TagStats {
+    uint64_t liveBytes = 0;
+    uint64_t peakBytes = 0;     // resetPeaks() 이후 최대 liveBytes
+    uint64_t allocations = 0;
+    uint64_t frees = 0;
+    uint64_t failures = 0;      // 예산 초과 또는 시스템 할당 실패
+    uint64_t budgetBytes = 0;   // 0이면 무제한
+};
+
+const char* tagName(Tag tag);
+bool tagFromName(const std::string& name, Tag* tag);
+
+// 예외 없는 할당: 예산 초과/실패 시 nullptr (alignment는 2의 거듭제곱)
+void* allocate(Tag tag, size_t bytes, size_t alignment = alignof(std::max_align_t));
+void deallocate(Tag tag, void* ptr, size_t bytes);
+
+// 크기/태그를 앞머리에 기록하는 할당 (C/JavaScript 내보내기용, 64바이트 정렬, 해제 시 크기 불필요)
+void* allocateTracked(Tag tag, size_t bytes);
+void deallocateTracked(void* ptr);
+
+// pmr 컨테이너용 태그 자원 (프로세스 수명, 상위 자원은 new_delete_resource)
+std::pmr::memory_resource* resource(Tag tag);
+
+// pmr 컨테이너를 키우기 전 예산 확인 (예외 없는 경로): 지금 바이트 + bytes가 예산 안이면 true,
+// 넘으면 실패 횟수에 더하고 false. 확인과 할당 사이에 다른 스레드가 같은 태그로 할당하는 경우는 보장하지 않음
+bool fitsBudget(Tag tag, size_t bytes);
+
+// v를 count개로 키울 때 새로 잡는 바이트 (capacity가 충분하면 0, 재할당 중에는 이전 버퍼도 살아 있으므로 새 크기 전체)
+template <typename T>
+size_t growthBytes(const std::pmr::vector<T>& v, size_t count) {
+    return count > v.capacity() ? count * sizeof(T) : 0;
+}
+
+// 하드 예산 (0: 무제한). 이미 쓰고 있는 바이트는 그대로 두고 이후 할당부터 적용
+void setBudget(Tag tag, uint64_t bytes);
+
+TagStats stats(Tag tag);
+TagStats totals();         // 전체 합 (peakBytes는 동시에 살아 있던 전체 바이트의 최댓값)
+int lastFailedTag();       // 마지막으로 실패한 태그 (없으면 -1)
+void resetPeaks();         // 최대값을 현재 바이트로 되돌림 (구간별 측정)
+
+// {"recognizer":{"live":..,"peak":..,"allocations":..,"frees":..,"failures":..,"budget":..},...,"total":{...}}
+std::string report();
+
+}  // namespace memory_accounting
+
+// 보조 모듈 / JavaScript 내보내기 (field: 0 live, 1 peak, 2 allocations, 3 frees, 4 failures, 5 budget)
+extern "C" {
+void* allocateTagged(int tag, int bytes);  // 예산 초과/알 수 없는 태그면 0
+void freeTagged(void* ptr);
+double getMemoryStat(int tag, int field);  // tag == TAG_COUNT는 전체 합, 잘못된 인자는 -1
+int setMemoryBudget(int tag, double bytes);  // 1: 적용, 0: 알 수 없는 태그
+}
+
+#endif // MEMORY_ACCOUNTING_H
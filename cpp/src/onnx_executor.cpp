@@ -0,0 +1,925 @@
+#include "onnx_executor.h"
+#include "fast_math.h"  // 소프트맥스 exp
+
+#include <algorithm>
+#include <cmath>       // std::sqrt
+#include <cstdlib>     // std::strtoull
+#include <cstring>     // std::memcpy
+#include <fstream>     // 모델/외부 데이터 파일 읽기
+#include <functional>  // 외부 데이터 조회 콜백
+#include <immintrin.h>  // SIMD 인트린식 (__m256, _mm256_*)
+#include <limits>
+#include <map>
+#include <sstream>
+
+namespace {
+
+void setError(std::string* error, const std::string& message) {
+    if (error) *error = message;
+}
+
+bool readFile(const std::string& path, std::vector<uint8_t>& out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    out.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// 프로토콜 버퍼 와이어 형식 읽기 (필드 번호 + 와이어 타입, 중첩 메시지는 길이 구분 바이트로 받아 다시 읽음)
+// ---------------------------------------------------------------------------
+enum WireType { VARINT = 0, FIXED64 = 1, BYTES = 2, FIXED32 = 5 };
+
+struct Field {
+    int number = 0;
+    int wire = 0;
+    uint64_t varint = 0;
+    const uint8_t* data = nullptr;  // BYTES/FIXED32/FIXED64 내용
+    size_t length = 0;
+
+    std::string string() const { return std::string(reinterpret_cast<const char*>(data), length); }
+    float fixed32() const {
+        float v;
+        std::memcpy(&v, data, sizeof(v));
+        return v;
+    }
+};
+
+class ProtoReader {
+public:
+    ProtoReader(const uint8_t* data, size_t size) : cur(data), end(data + size) {}
+    explicit ProtoReader(const Field& f) : ProtoReader(f.data, f.length) {}
+
+    // 다음 필드 (끝이거나 손상되면 false, 손상 여부는 ok())
+    bool next(Field& f) {
+        if (cur >= end || bad) return false;
+        uint64_t key;
+        if (!readVarint(key)) return false;
+        f.number = static_cast<int>(key >> 3);
+        f.wire = static_cast<int>(key & 7);
+        switch (f.wire) {
+            case VARINT: return readVarint(f.varint);
+            case FIXED64: return take(8, f);
+            case FIXED32: return take(4, f);
+            case BYTES: {
+                uint64_t length;
+                return readVarint(length) && take(length, f);
+            }
+            default: bad = true; return false;
+        }
+    }
+
+    bool ok() const { return !bad; }
+    bool atEnd() const { return cur >= end; }
+
+    bool readVarint(uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64 && cur < end; shift += 7) {
+            const uint8_t byte = *cur++;
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) return true;
+        }
+        bad = true;
+        return false;
+    }
+
+private:
+    bool take(uint64_t length, Field& f) {
+        if (length > static_cast<uint64_t>(end - cur)) {
+            bad = true;
+            return false;
+        }
+        f.data = cur;
+        f.length = static_cast<size_t>(length);
+        cur += length;
+        return true;
+    }
+
+    const uint8_t* cur;
+    const uint8_t* end;
+    bool bad = false;
+};
+
+// repeated int64 (packed 또는 필드마다 varint)
+bool appendInts(const Field& f, std::vector<int64_t>& out) {
+    if (f.wire == VARINT) {
+        out.push_back(static_cast<int64_t>(f.varint));
+        return true;
+    }
+    if (f.wire != BYTES) return false;
+    ProtoReader packed(f);
+    uint64_t v;
+    while (!packed.atEnd()) {
+        if (!packed.readVarint(v)) return false;
+        out.push_back(static_cast<int64_t>(v));
+    }
+    return true;
+}
+
+// repeated float (packed 또는 필드마다 fixed32)
+bool appendFloats(const Field& f, std::vector<float>& out) {
+    if (f.wire == FIXED32) {
+        out.push_back(f.fixed32());
+        return true;
+    }
+    if (f.wire != BYTES || f.length % 4 != 0) return false;
+    const size_t first = out.size();
+    out.resize(first + f.length / 4);
+    std::memcpy(out.data() + first, f.data, f.length);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// 해석된 그래프 (로드 중에만 사용)
+// ---------------------------------------------------------------------------
+struct Attribute {
+    float f = 0.0f;
+    int64_t i = 0;
+    std::string s;
+    std::vector<int64_t> ints;
+    std::vector<float> floats;
+};
+
+struct Node {
+    std::string name;
+    std::string op;
+    std::vector<std::string> inputs;
+    std::vector<std::string> outputs;
+    std::map<std::string, Attribute> attributes;
+
+    const Attribute* attribute(const char* key) const {
+        auto it = attributes.find(key);
+        return it == attributes.end() ? nullptr : &it->second;
+    }
+    float attrFloat(const char* key, float fallback) const { return attribute(key) ? attribute(key)->f : fallback; }
+    int64_t attrInt(const char* key, int64_t fallback) const { return attribute(key) ? attribute(key)->i : fallback; }
+    std::vector<int64_t> attrInts(const char* key) const { return attribute(key) ? attribute(key)->ints : std::vector<int64_t>(); }
+};
+
+struct Initializer {
+    std::vector<int64_t> dims;
+    std::vector<float> data;  // float32가 아니면 비어 있음 (사용 시 오류)
+    bool isFloat = false;
+
+    size_t count() const {
+        size_t n = 1;
+        for (int64_t d : dims) n *= static_cast<size_t>(d);
+        return n;
+    }
+};
+
+struct ValueInfo {
+    std::string name;
+    std::vector<int64_t> dims;  // 이름 있는(동적) 차원은 -1
+};
+
+// location → (데이터, 크기). 찾지 못하면 false
+using ExternalLookup = std::function<bool(const std::string& location, const uint8_t** data, size_t* size)>;
+
+bool parseAttribute(const Field& field, Node& node) {
+    ProtoReader r(field);
+    Field f;
+    std::string name;
+    Attribute attr;
+    while (r.next(f)) {
+        switch (f.number) {
+            case 1: name = f.string(); break;
+            case 2: if (f.wire == FIXED32) attr.f = f.fixed32(); break;
+            case 3: attr.i = static_cast<int64_t>(f.varint); break;
+            case 4: attr.s = f.string(); break;
+            case 7: if (!appendFloats(f, attr.floats)) return false; break;
+            case 8: if (!appendInts(f, attr.ints)) return false; break;
+            default: break;  // 그래프/텐서 속성 등은 지원 연산에 없음
+        }
+    }
+    node.attributes[name] = attr;
+    return r.ok();
+}
+
+bool parseNode(const Field& field, Node& node) {
+    ProtoReader r(field);
+    Field f;
+    while (r.next(f)) {
+        switch (f.number) {
+            case 1: node.inputs.push_back(f.string()); break;
+            case 2: node.outputs.push_back(f.string()); break;
+            case 3: node.name = f.string(); break;
+            case 4: node.op = f.string(); break;
+            case 5: if (!parseAttribute(f, node)) return false; break;
+            default: break;
+        }
+    }
+    return r.ok();
+}
+
+bool parseTensor(const Field& field, const ExternalLookup& external, std::string& name, Initializer& tensor, std::string* error) {
+    ProtoReader r(field);
+    Field f;
+    int dataType = 0;
+    bool isExternal = false;
+    const uint8_t* raw = nullptr;
+    size_t rawLength = 0;
+    std::string location;
+    size_t offset = 0, length = 0;
+    bool hasLength = false;
+    while (r.next(f)) {
+        switch (f.number) {
+            case 1: if (!appendInts(f, tensor.dims)) return false; break;
+            case 2: dataType = static_cast<int>(f.varint); break;
+            case 4: if (!appendFloats(f, tensor.data)) return false; break;
+            case 8: name = f.string(); break;
+            case 9: raw = f.data; rawLength = f.length; break;
+            case 13: {  // external_data: StringStringEntryProto {key, value}
+                ProtoReader entry(f);
+                Field e;
+                std::string key, value;
+                while (entry.next(e)) {
+                    if (e.number == 1) key = e.string();
+                    else if (e.number == 2) value = e.string();
+                }
+                if (key == "location") location = value;
+                else if (key == "offset") offset = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+                else if (key == "length") {
+                    length = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+                    hasLength = true;
+                }
+                break;
+            }
+            case 14: isExternal = f.varint == 1; break;
+            default: break;
+        }
+    }
+    if (!r.ok()) return false;
+
+    tensor.isFloat = dataType == 1;  // TensorProto.FLOAT
+    if (!tensor.isFloat) {
+        tensor.data.clear();
+        return true;
+    }
+    const size_t count = tensor.count();
+    if (isExternal) {
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        if (!external || !external(location, &data, &size)) {
+            setError(error, "external data '" + location + "' for " + name + " not found");
+            return false;
+        }
+        if (!hasLength) length = count * sizeof(float);
+        if (offset > size || length > size - offset) {
+            setError(error, "external data '" + location + "' too short for " + name);
+            return false;
+        }
+        raw = data + offset;
+        rawLength = length;
+    }
+    if (raw) {
+        tensor.data.resize(rawLength / sizeof(float));
+        std::memcpy(tensor.data.data(), raw, tensor.data.size() * sizeof(float));  // 리틀 엔디언 (x86/wasm 공통)
+    }
+    if (tensor.data.size() != count) {
+        setError(error, "initializer " + name + " has " + std::to_string(tensor.data.size()) + " values, shape needs " +
+                            std::to_string(count));
+        return false;
+    }
+    return true;
+}
+
+bool parseValueInfo(const Field& field, ValueInfo& info) {
+    ProtoReader r(field);
+    Field f;
+    while (r.next(f)) {
+        if (f.number == 1) {
+            info.name = f.string();
+        } else if (f.number == 2) {  // TypeProto → tensor_type(1) → shape(2) → dim(1) → dim_value(1) / dim_param(2)
+            ProtoReader type(f);
+            Field t;
+            while (type.next(t)) {
+                if (t.number != 1) continue;
+                ProtoReader tensorType(t);
+                Field s;
+                while (tensorType.next(s)) {
+                    if (s.number != 2) continue;
+                    ProtoReader shape(s);
+                    Field d;
+                    while (shape.next(d)) {
+                        if (d.number != 1) continue;
+                        ProtoReader dim(d);
+                        Field v;
+                        int64_t value = -1;
+                        while (dim.next(v)) {
+                            if (v.number == 1) value = static_cast<int64_t>(v.varint);
+                        }
+                        info.dims.push_back(value);
+                    }
+                }
+            }
+        }
+    }
+    return r.ok();
+}
+
+inline int roundStride(int size) {
+    return Tensor<float>::paddedStride(std::max(1, size));
+}
+
+// 출력 타일 하나 (8레인 × VECS) × 입력 행 ROWS개: y = bias + Σ_i x[i] · Wt[i]
+// 누산기가 모두 레지스터에 머물고, 가중치 행 로드를 ROWS개 입력 행이 공유 (입력 길이 나머지 처리 없음)
+template <int ROWS, int VECS>
+inline void denseTile(const float* wt, size_t wStride, const float* bias, int in, const float* const* x, float* const* y, bool relu) {
+    __m256 acc[ROWS][VECS];
+    for (int r = 0; r < ROWS; r++) {
+        for (int v = 0; v < VECS; v++) acc[r][v] = _mm256_loadu_ps(bias + v * 8);
+    }
+    for (int i = 0; i < in; i++) {
+        const float* w = wt + i * wStride;
+        __m256 wv[VECS];
+        for (int v = 0; v < VECS; v++) wv[v] = _mm256_load_ps(w + v * 8);
+        for (int r = 0; r < ROWS; r++) {
+            const __m256 xi = _mm256_set1_ps(x[r][i]);
+            for (int v = 0; v < VECS; v++) acc[r][v] = _mm256_add_ps(acc[r][v], _mm256_mul_ps(wv[v], xi));
+        }
+    }
+    const __m256 zero = _mm256_setzero_ps();
+    for (int r = 0; r < ROWS; r++) {
+        for (int v = 0; v < VECS; v++) _mm256_store_ps(y[r] + v * 8, relu ? _mm256_max_ps(acc[r][v], zero) : acc[r][v]);
+    }
+}
+
+const char* kindName(int kind) {
+    static const char* const names[] = {"dense", "conv1d", "affine", "add", "relu", "softmax"};
+    return names[kind];
+}
+
+}  // namespace
+
+struct OnnxModel::Graph {
+    std::vector<Node> nodes;
+    std::map<std::string, Initializer> initializers;
+    std::vector<ValueInfo> inputs;
+    std::vector<ValueInfo> outputs;
+    int64_t opset = 0;
+};
+
+
+namespace {
+
+bool parseModel(const uint8_t* data, size_t size, const ExternalLookup& external, OnnxModel::Graph* graph, std::string* error) {
+    ProtoReader model(data, size);
+    Field f;
+    bool hasGraph = false;
+    while (model.next(f)) {
+        if (f.number == 8 && f.wire == BYTES) {  // opset_import {domain(1), version(2)}
+            ProtoReader opset(f);
+            Field o;
+            std::string domain;
+            int64_t version = 0;
+            while (opset.next(o)) {
+                if (o.number == 1) domain = o.string();
+                else if (o.number == 2) version = static_cast<int64_t>(o.varint);
+            }
+            if (domain.empty() || domain == "ai.onnx") graph->opset = version;
+        } else if (f.number == 7 && f.wire == BYTES) {
+            hasGraph = true;
+            ProtoReader g(f);
+            Field gf;
+            while (g.next(gf)) {
+                if (gf.number == 1) {
+                    graph->nodes.emplace_back();
+                    if (!parseNode(gf, graph->nodes.back())) break;
+                } else if (gf.number == 5) {
+                    std::string name;
+                    Initializer tensor;
+                    if (!parseTensor(gf, external, name, tensor, error)) return false;
+                    graph->initializers[name] = std::move(tensor);
+                } else if (gf.number == 11 || gf.number == 12) {
+                    ValueInfo info;
+                    if (!parseValueInfo(gf, info)) break;
+                    (gf.number == 11 ? graph->inputs : graph->outputs).push_back(info);
+                }
+            }
+            if (!g.ok()) {
+                setError(error, "malformed graph");
+                return false;
+            }
+        }
+    }
+    if (!model.ok() || !hasGraph) {
+        setError(error, "not an ONNX model (malformed protobuf or no graph)");
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+bool OnnxModel::loadFile(const std::string& path, int maxBatch, std::string* error, const std::string& dataDir) {
+    std::vector<uint8_t> bytes;
+    if (!readFile(path, bytes)) {
+        setError(error, "cannot open " + path);
+        return false;
+    }
+    const size_t slash = path.find_last_of('/');
+    const std::string directory = !dataDir.empty() ? dataDir : slash == std::string::npos ? "." : path.substr(0, slash);
+
+    std::map<std::string, std::vector<uint8_t>> files;  // location별로 한 번만 읽음
+    ExternalLookup lookup = [&](const std::string& location, const uint8_t** data, size_t* size) {
+        auto it = files.find(location);
+        if (it == files.end()) {
+            std::vector<uint8_t> content;
+            if (!readFile(directory + "/" + location, content)) return false;
+            it = files.emplace(location, std::move(content)).first;
+        }
+        *data = it->second.data();
+        *size = it->second.size();
+        return true;
+    };
+
+    Graph graph;
+    if (!parseModel(bytes.data(), bytes.size(), lookup, &graph, error)) return false;
+    return build(graph, maxBatch, error);
+}
+
+bool OnnxModel::loadFromMemory(const uint8_t* model, size_t modelSize, const uint8_t* external, size_t externalSize, int maxBatch,
+                               std::string* error) {
+    ExternalLookup lookup = [&](const std::string&, const uint8_t** data, size_t* size) {
+        if (!external) return false;
+        *data = external;
+        *size = externalSize;
+        return true;
+    };
+    Graph graph;
+    if (!model || !parseModel(model, modelSize, lookup, &graph, error)) {
+        if (!model) setError(error, "no model data");
+        return false;
+    }
+    return build(graph, maxBatch, error);
+}
+
+bool OnnxModel::build(const Graph& graph, int maxBatch, std::string* error) {
+    values.clear();
+    steps.clear();
+    arena.reset(0, 0);
+    inputValue = outputValue = -1;
+    batchLimit = 0;
+    graphNodes = static_cast<int>(graph.nodes.size());
+    if (maxBatch < 1) {
+        setError(error, "maxBatch must be >= 1");
+        return false;
+    }
+
+    std::map<std::string, int> valueIds;
+    auto addValue = [&](const std::string& name, const std::vector<int>& shape) {
+        Value v;
+        v.name = name;
+        v.shape = shape;
+        v.size = 1;
+        for (int d : shape) v.size *= d;
+        v.stride = roundStride(v.size);
+        values.push_back(v);
+        valueIds[name] = static_cast<int>(values.size()) - 1;
+        return static_cast<int>(values.size()) - 1;
+    };
+    auto constant = [&](const std::string& name) -> const Initializer* {
+        auto it = graph.initializers.find(name);
+        return it != graph.initializers.end() && it->second.isFloat ? &it->second : nullptr;
+    };
+    auto activation = [&](const std::string& name) {
+        auto it = valueIds.find(name);
+        return it == valueIds.end() ? -1 : it->second;
+    };
+
+    // 1. 그래프 입력 (초기값을 입력으로도 나열하는 예전 내보내기 형식은 제외)
+    for (const ValueInfo& info : graph.inputs) {
+        if (graph.initializers.count(info.name)) continue;
+        if (inputValue >= 0) {
+            setError(error, "only one graph input is supported");
+            return false;
+        }
+        std::vector<int> shape;
+        for (size_t d = 1; d < info.dims.size(); d++) {
+            if (info.dims[d] <= 0) {
+                setError(error, "input " + info.name + " has a dynamic non-batch dimension");
+                return false;
+            }
+            shape.push_back(static_cast<int>(info.dims[d]));
+        }
+        if (info.dims.size() < 2) {
+            setError(error, "input " + info.name + " needs a batch dimension and features");
+            return false;
+        }
+        inputValue = addValue(info.name, shape);
+    }
+    if (inputValue < 0 || graph.outputs.size() != 1) {
+        setError(error, "graph needs exactly one input and one output");
+        return false;
+    }
+
+    // 2. 노드 → 실행 단계 (그래프는 위상 순서로 저장됨)
+    for (const Node& node : graph.nodes) {
+        auto fail = [&](const std::string& why) {
+            setError(error, node.op + " '" + node.name + "': " + why);
+            return false;
+        };
+        std::vector<std::string> inputs = node.inputs;
+        if (node.op == "Add" && inputs.size() == 2 && activation(inputs[0]) < 0) std::swap(inputs[0], inputs[1]);  // 상수 + x
+        const int x = inputs.empty() ? -1 : activation(inputs[0]);
+        if (x < 0 || node.outputs.empty()) return fail("first input must be a computed tensor");
+        const std::vector<int> inShape = values[x].shape;
+
+        Step step;
+        step.name = node.name.empty() ? node.op : node.name;
+        step.input = x;
+        std::vector<int> outShape = inShape;
+
+        if (node.op == "Identity" || node.op == "Dropout" || node.op == "Flatten") {
+            if (node.op == "Flatten" && node.attrInt("axis", 1) != 1) return fail("only axis 1 is supported");
+            if (node.op != "Flatten" || inShape.size() == 1) {
+                valueIds[node.outputs[0]] = x;  // 같은 버퍼를 가리키는 별칭
+                continue;
+            }
+            // 행 우선 배치는 그대로이므로 복사 (생산자가 이 값만 쓰면 융합 단계에서 사라짐)
+            step.kind = ADD;
+            outShape = {values[x].size};
+        } else if (node.op == "Gemm" || node.op == "MatMul") {
+            const Initializer* b = node.inputs.size() > 1 ? constant(node.inputs[1]) : nullptr;
+            if (!b || b->dims.size() != 2) return fail("B must be a 2-D float initializer");
+            if (inShape.size() != 1) return fail("A must be [batch, features]");
+            const bool gemm = node.op == "Gemm";
+            if (gemm && node.attrInt("transA", 0) != 0) return fail("transA is not supported");
+            const bool transB = gemm && node.attrInt("transB", 0) != 0;
+            const float alpha = gemm ? node.attrFloat("alpha", 1.0f) : 1.0f;
+            const float beta = gemm ? node.attrFloat("beta", 1.0f) : 1.0f;
+            const int k = static_cast<int>(transB ? b->dims[1] : b->dims[0]);
+            const int m = static_cast<int>(transB ? b->dims[0] : b->dims[1]);
+            if (k != inShape[0]) return fail("inner dimension mismatch");
+
+            step.kind = DENSE;
+            step.inFeatures = k;
+            step.outFeatures = m;
+            if (!step.weights.reset(k, m)) return fail("weight allocation failed");
+            for (int i = 0; i < k; i++) {
+                for (int o = 0; o < m; o++) step.weights(i, o) = alpha * (transB ? b->data[o * k + i] : b->data[i * m + o]);
+            }
+            step.bias.assign(step.weights.stride(), 0.0f);  // 패딩 열까지 (타일 단위로 읽음)
+            if (gemm && node.inputs.size() > 2 && !node.inputs[2].empty()) {
+                const Initializer* c = constant(node.inputs[2]);
+                if (!c || (c->count() != 1 && c->count() != static_cast<size_t>(m))) return fail("C must be a scalar or [N] initializer");
+                for (int o = 0; o < m; o++) step.bias[o] = beta * c->data[c->count() == 1 ? 0 : o];
+            }
+            outShape = {m};
+        } else if (node.op == "Conv") {
+            const Initializer* w = node.inputs.size() > 1 ? constant(node.inputs[1]) : nullptr;
+            if (inShape.size() != 2 || !w || w->dims.size() != 3) return fail("only 1-D convolution ([batch, C, L]) is supported");
+            if (node.attrInt("group", 1) != 1) return fail("grouped convolution is not supported");
+            const Attribute* autoPad = node.attribute("auto_pad");
+            if (autoPad && autoPad->s != "NOTSET" && autoPad->s != "VALID") return fail("auto_pad SAME is not supported");
+            const std::vector<int64_t> strides = node.attrInts("strides");
+            const std::vector<int64_t> pads = node.attrInts("pads");
+            const std::vector<int64_t> dilations = node.attrInts("dilations");
+
+            step.kind = CONV1D;
+            step.channels = inShape[0];
+            step.length = inShape[1];
+            step.outFeatures = static_cast<int>(w->dims[0]);
+            step.kernel = static_cast<int>(w->dims[2]);
+            step.stride = strides.empty() ? 1 : static_cast<int>(strides[0]);
+            step.dilation = dilations.empty() ? 1 : static_cast<int>(dilations[0]);
+            step.padBegin = pads.empty() ? 0 : static_cast<int>(pads[0]);
+            const int padEnd = pads.size() < 2 ? step.padBegin : static_cast<int>(pads[1]);
+            if (w->dims[1] != step.channels) return fail("weight channels do not match input");
+            if (step.stride < 1 || step.dilation < 1) return fail("invalid strides/dilations");
+            step.outLength = (step.length + step.padBegin + padEnd - step.dilation * (step.kernel - 1) - 1) / step.stride + 1;
+            if (step.outLength < 1) return fail("output length is empty");
+
+            const int rowSize = step.channels * step.kernel;  // W[out][c][k]와 같은 순서
+            if (!step.weights.reset(step.outFeatures, rowSize)) return fail("weight allocation failed");
+            for (int o = 0; o < step.outFeatures; o++) std::memcpy(step.weights.row(o), &w->data[o * rowSize], rowSize * sizeof(float));
+            step.bias.assign(step.outFeatures, 0.0f);
+            if (node.inputs.size() > 2 && !node.inputs[2].empty()) {
+                const Initializer* b = constant(node.inputs[2]);
+                if (!b || b->count() != static_cast<size_t>(step.outFeatures)) return fail("bias must be an [M] initializer");
+                step.bias = b->data;
+            }
+            outShape = {step.outFeatures, step.outLength};
+        } else if (node.op == "BatchNormalization") {
+            if (node.attrInt("training_mode", 0) != 0) return fail("training mode is not supported");
+            const Initializer* params[4];
+            for (int p = 0; p < 4; p++) {
+                params[p] = node.inputs.size() > static_cast<size_t>(p + 1) ? constant(node.inputs[p + 1]) : nullptr;
+                if (!params[p] || params[p]->count() != static_cast<size_t>(inShape[0])) return fail("scale/B/mean/var must be [C] initializers");
+            }
+            const float epsilon = node.attrFloat("epsilon", 1e-5f);
+            step.kind = AFFINE;
+            step.channels = inShape[0];
+            step.length = values[x].size / step.channels;
+            step.scale.resize(step.channels);
+            step.bias.resize(step.channels);
+            for (int c = 0; c < step.channels; c++) {
+                // y = gamma (x - mean) / sqrt(var + eps) + beta = s x + (beta - s mean)
+                step.scale[c] = params[0]->data[c] / std::sqrt(params[3]->data[c] + epsilon);
+                step.bias[c] = params[1]->data[c] - step.scale[c] * params[2]->data[c];
+            }
+        } else if (node.op == "Add") {
+            if (inputs.size() != 2) return fail("Add needs two inputs");
+            step.kind = ADD;
+            const int second = activation(inputs[1]);
+            if (second >= 0) {
+                if (values[second].shape != inShape) return fail("broadcasting between two computed tensors is not supported");
+                step.input2 = second;
+            } else {
+                const Initializer* c = constant(inputs[1]);
+                const size_t size = static_cast<size_t>(values[x].size);
+                const size_t last = static_cast<size_t>(inShape.back());
+                if (!c || (c->count() != 1 && c->count() != last && c->count() != size)) return fail("constant must be a scalar, [last] or full shape");
+                step.bias.resize(size);  // 행 전체 크기로 펼쳐 둠 (실행 시 브로드캐스트 없음)
+                for (size_t i = 0; i < size; i++) step.bias[i] = c->data[c->count() == 1 ? 0 : c->count() == last ? i % last : i];
+            }
+        } else if (node.op == "Relu") {
+            step.kind = RELU;
+        } else if (node.op == "Softmax") {
+            const int rank = static_cast<int>(inShape.size()) + 1;
+            int64_t axis = node.attrInt("axis", graph.opset >= 13 ? -1 : 1);
+            if (axis < 0) axis += rank;
+            // opset < 13은 axis 뒤를 평탄화하므로 rank 2에서는 마지막 축과 같음
+            if (axis != rank - 1 && !(graph.opset < 13 && axis == 1 && rank == 2)) return fail("only the last axis is supported");
+            step.kind = SOFTMAX;
+        } else {
+            return fail("unsupported operator");
+        }
+        step.output = addValue(node.outputs[0], outShape);
+        steps.push_back(std::move(step));
+    }
+
+    outputValue = activation(graph.outputs[0].name);
+    if (outputValue < 0) {
+        setError(error, "graph output " + graph.outputs[0].name + " is not produced");
+        return false;
+    }
+
+    // 3. 융합: 생산자 단계 뒤에 붙일 수 있는 단계를 접음 (중간 값은 이 단계 하나만 읽어야 함)
+    std::vector<int> uses(values.size(), 0);
+    for (const Step& s : steps) {
+        uses[s.input]++;
+        if (s.input2 >= 0) uses[s.input2]++;
+    }
+    uses[outputValue]++;
+    std::vector<int> producer(values.size(), -1);
+    std::vector<bool> removed(steps.size(), false);
+    for (size_t j = 0; j < steps.size(); j++) {
+        Step& s = steps[j];
+        const int p = producer[s.input];
+        if (p >= 0 && uses[s.input] == 1 && s.input != outputValue && s.input2 < 0) {
+            Step& prev = steps[p];
+            const bool linear = prev.kind == DENSE || prev.kind == CONV1D;
+            bool folded = false;
+            if (s.kind == RELU && prev.kind != SOFTMAX && prev.kind != RELU) {
+                prev.relu = true;
+                folded = true;
+            } else if (s.kind == ADD && s.bias.empty()) {
+                folded = true;  // 복사(Flatten): 생산자가 바로 평탄화된 값에 씀
+            } else if (s.kind == AFFINE && linear && !prev.relu && s.channels == prev.outFeatures) {
+                for (int r = 0; r < prev.weights.rows(); r++) {
+                    float* w = prev.weights.row(r);  // DENSE [in][out]: 열마다, CONV1D [out][c·k]: 행마다 배율
+                    for (int i = 0; i < prev.weights.cols(); i++) w[i] *= s.scale[prev.kind == DENSE ? i : r];
+                }
+                for (int o = 0; o < prev.outFeatures; o++) prev.bias[o] = prev.bias[o] * s.scale[o] + s.bias[o];
+                folded = true;
+            } else if (s.kind == ADD && linear && !prev.relu) {
+                // 채널(출력)마다 상수가 같아야 편향으로 접을 수 있음
+                const int length = prev.kind == CONV1D ? prev.outLength : 1;
+                bool perChannel = true;
+                for (int o = 0; o < prev.outFeatures && perChannel; o++) {
+                    for (int t = 1; t < length; t++) perChannel = perChannel && s.bias[o * length + t] == s.bias[o * length];
+                }
+                if (perChannel) {
+                    for (int o = 0; o < prev.outFeatures; o++) prev.bias[o] += s.bias[o * length];
+                    folded = true;
+                }
+            }
+            if (folded) {
+                prev.name += "+" + s.name;
+                prev.output = s.output;
+                producer[s.output] = p;
+                removed[j] = true;
+                continue;
+            }
+        }
+        producer[s.output] = static_cast<int>(j);
+    }
+    std::vector<Step> fused;
+    for (size_t j = 0; j < steps.size(); j++) {
+        if (!removed[j]) fused.push_back(std::move(steps[j]));
+    }
+    steps = std::move(fused);
+
+    batchLimit = maxBatch;
+    if (!planArena(error)) {
+        batchLimit = 0;
+        return false;
+    }
+    return true;
+}
+
+bool OnnxModel::planArena(std::string* error) {
+    // 값별 수명 [정의 단계, 마지막 사용 단계] (입력은 -1부터, 입력과 출력은 끝까지)
+    // 입력 구간을 중간 값에 재사용하지 않아 run() 뒤에도 input()이 그대로 남음 (같은 입력으로 재실행 가능)
+    const int count = static_cast<int>(values.size());
+    const int last = static_cast<int>(steps.size());
+    std::vector<int> first(count, std::numeric_limits<int>::max()), end(count, -1);
+    first[inputValue] = -1;
+    end[inputValue] = -1;
+    for (int s = 0; s < last; s++) {
+        first[steps[s].output] = std::min(first[steps[s].output], s);
+        end[steps[s].output] = std::max(end[steps[s].output], s);
+        end[steps[s].input] = std::max(end[steps[s].input], s);
+        if (steps[s].input2 >= 0) end[steps[s].input2] = std::max(end[steps[s].input2], s);
+    }
+    end[inputValue] = last;
+    end[outputValue] = last;
+
+    // 큰 값부터 배치: 수명이 겹치는 값들과 구간이 겹치지 않는 가장 낮은 오프셋
+    std::vector<int> order;
+    for (int v = 0; v < count; v++) {
+        if (end[v] >= first[v]) order.push_back(v);  // 융합으로 사라진 중간 값 제외
+    }
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return values[a].stride != values[b].stride ? values[a].stride > values[b].stride : a < b;
+    });
+    std::vector<int> placed;
+    size_t total = 0;
+    for (int v : order) {
+        const size_t size = static_cast<size_t>(batchLimit) * values[v].stride;
+        std::vector<std::pair<size_t, size_t>> busy;  // 수명이 겹치는 값들의 [시작, 끝)
+        for (int u : placed) {
+            if (first[u] <= end[v] && first[v] <= end[u]) {
+                busy.emplace_back(values[u].offset, values[u].offset + static_cast<size_t>(batchLimit) * values[u].stride);
+            }
+        }
+        std::sort(busy.begin(), busy.end());
+        size_t offset = 0;
+        for (const auto& range : busy) {
+            if (offset + size <= range.first) break;
+            offset = std::max(offset, range.second);
+        }
+        values[v].offset = offset;
+        total = std::max(total, offset + size);
+        placed.push_back(v);
+    }
+
+    if (total > static_cast<size_t>(std::numeric_limits<int>::max()) || !arena.reset(1, static_cast<int>(total))) {
+        setError(error, "activation arena allocation failed (" + std::to_string(total * sizeof(float)) + " bytes)");
+        return false;
+    }
+    return true;
+}
+
+const float* OnnxModel::run(int batch) {
+    if (!loaded() || batch < 1 || batch > batchLimit) return nullptr;
+    for (const Step& step : steps) {
+        switch (step.kind) {
+            case DENSE: runDense(step, batch); break;
+            case CONV1D: runConv(step, batch); break;
+            case AFFINE: runAffine(step, batch); break;
+            case ADD:
+            case RELU: runAdd(step, batch); break;
+            case SOFTMAX: runSoftmax(step, batch); break;
+        }
+    }
+    return valueRow(outputValue, 0);
+}
+
+void OnnxModel::runDense(const Step& step, int batch) {
+    const int in = step.inFeatures;
+    const int padded = step.weights.stride();  // 16의 배수 → 32열 타일 + 16열 타일 하나로 나머지 없음
+    const size_t wStride = static_cast<size_t>(padded);
+    // 열 타일을 바깥에 두어 타일 가중치(in × 32 float)가 배치 전체 동안 L1에 머묾
+    for (int o = 0; o < padded; o += 32) {
+        const bool wide = o + 32 <= padded;
+        const float* wt = step.weights.data() + o;
+        const float* bias = step.bias.data() + o;
+        int n = 0;
+        for (; n + 2 <= batch; n += 2) {
+            const float* x[2] = {valueRow(step.input, n), valueRow(step.input, n + 1)};
+            float* y[2] = {valueRow(step.output, n) + o, valueRow(step.output, n + 1) + o};
+            if (wide) denseTile<2, 4>(wt, wStride, bias, in, x, y, step.relu);
+            else denseTile<2, 2>(wt, wStride, bias, in, x, y, step.relu);
+        }
+        if (n < batch) {
+            const float* x[1] = {valueRow(step.input, n)};
+            float* y[1] = {valueRow(step.output, n) + o};
+            if (wide) denseTile<1, 4>(wt, wStride, bias, in, x, y, step.relu);
+            else denseTile<1, 2>(wt, wStride, bias, in, x, y, step.relu);
+        }
+    }
+}
+
+void OnnxModel::runConv(const Step& step, int batch) {
+    const int k = step.kernel, length = step.length, outLength = step.outLength;
+    for (int n = 0; n < batch; n++) {
+        const float* x = valueRow(step.input, n);
+        float* y = valueRow(step.output, n);
+        for (int o = 0; o < step.outFeatures; o++) {
+            float* yo = y + o * outLength;
+            std::fill(yo, yo + outLength, step.bias[o]);
+            const float* w = step.weights.row(o);
+            for (int c = 0; c < step.channels; c++) {
+                const float* xc = x + c * length;
+                for (int tap = 0; tap < k; tap++) {
+                    // 입력 위치 t*stride + shift가 [0, length) 안인 출력 t 구간만 (패딩은 0이므로 건너뜀)
+                    const int shift = tap * step.dilation - step.padBegin;
+                    const int t0 = shift >= 0 ? 0 : (-shift + step.stride - 1) / step.stride;
+                    const int t1 = std::min(outLength, length - shift <= 0 ? 0 : (length - shift - 1) / step.stride + 1);
+                    const float wv = w[c * k + tap];
+                    if (step.stride == 1) {
+                        for (int t = t0; t < t1; t++) yo[t] += wv * xc[t + shift];
+                    } else {
+                        for (int t = t0; t < t1; t++) yo[t] += wv * xc[t * step.stride + shift];
+                    }
+                }
+            }
+            if (step.relu) {
+                for (int t = 0; t < outLength; t++) yo[t] = std::max(yo[t], 0.0f);
+            }
+        }
+    }
+}
+
+void OnnxModel::runAffine(const Step& step, int batch) {
+    for (int n = 0; n < batch; n++) {
+        const float* x = valueRow(step.input, n);
+        float* y = valueRow(step.output, n);
+        for (int c = 0; c < step.channels; c++) {
+            const float s = step.scale[c], b = step.bias[c];
+            for (int l = 0; l < step.length; l++) {
+                const float v = x[c * step.length + l] * s + b;
+                y[c * step.length + l] = step.relu ? std::max(v, 0.0f) : v;
+            }
+        }
+    }
+}
+
+// ADD (상수 또는 두 번째 활성값) / 단독 RELU (더할 것이 없는 ADD + relu)
+void OnnxModel::runAdd(const Step& step, int batch) {
+    const int size = values[step.output].size;
+    const bool relu = step.relu || step.kind == RELU;
+    for (int n = 0; n < batch; n++) {
+        const float* x = valueRow(step.input, n);
+        const float* other = step.input2 >= 0 ? valueRow(step.input2, n) : step.bias.empty() ? nullptr : step.bias.data();
+        float* y = valueRow(step.output, n);
+        for (int i = 0; i < size; i++) {
+            const float v = other ? x[i] + other[i] : x[i];
+            y[i] = relu ? std::max(v, 0.0f) : v;
+        }
+    }
+}
+
+void OnnxModel::runSoftmax(const Step& step, int batch) {
+    const int last = values[step.input].shape.back();
+    const int groups = values[step.input].size / last;
+    for (int n = 0; n < batch; n++) {
+        for (int g = 0; g < groups; g++) {
+            const float* x = valueRow(step.input, n) + g * last;
+            float* y = valueRow(step.output, n) + g * last;
+            const float peak = *std::max_element(x, x + last);
+            for (int i = 0; i < last; i++) y[i] = x[i] - peak;
+            fast_math::exp(y, y, last);  // in-place 벡터 exp
+            float sum = 0.0f;
+            for (int i = 0; i < last; i++) sum += y[i];
+            const float inv = 1.0f / sum;
+            for (int i = 0; i < last; i++) y[i] *= inv;
+        }
+    }
+}
+
+size_t OnnxModel::weightBytes() const {
+    size_t bytes = 0;
+    for (const Step& s : steps) bytes += s.weights.bytes() + (s.bias.size() + s.scale.size()) * sizeof(float);
+    return bytes;
+}
+
+size_t OnnxModel::macsPerRow() const {
+    size_t macs = 0;
+    for (const Step& s : steps) {
+        if (s.kind == DENSE) macs += static_cast<size_t>(s.inFeatures) * s.outFeatures;
+        else if (s.kind == CONV1D) macs += static_cast<size_t>(s.outFeatures) * s.outLength * s.channels * s.kernel;
+    }
+    return macs;
+}
+
+std::string OnnxModel::describe() const {
+    std::ostringstream out;
+    auto shape = [this](int v) {
+        std::string text = "[";
+        for (size_t d = 0; d < values[v].shape.size(); d++) text += (d ? "x" : "") + std::to_string(values[v].shape[d]);
+        return text + "]";
+    };
+    out << graphNodes << " nodes -> " << steps.size() << " steps, arena " << arenaBytes() << " bytes (max batch " << batchLimit
+        << "), weights " << weightBytes() << " bytes\n";
+    out << "  input  " << values[inputValue].name << " " << shape(inputValue) << " @" << values[inputValue].offset << "\n";
+    for (const Step& s : steps) {
+        out << "  " << kindName(s.kind) << (s.relu ? "+relu" : "") << "  " << s.name << "  " << shape(s.input);
+        if (s.input2 >= 0) out << " + " << shape(s.input2);
+        out << " -> " << shape(s.output) << " @" << values[s.output].offset << "\n";
+    }
+    return out.str();
+}
@@ -0,0 +1,114 @@
+#ifndef ONNX_EXECUTOR_H
+#define ONNX_EXECUTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "tensor.h"
+
+/**
+ * 최소 ONNX 그래프 실행기 (외부 런타임/서비스 없이 학습 팀 모델 파일을 그대로 실행)
+ *
+ * - 지원 연산 (float32): Gemm, MatMul(상수 가중치), Add(상수 브로드캐스트 또는 같은 모양), Relu,
+ *   Softmax(마지막 축), Conv(1-D, group 1), BatchNormalization, Identity/Dropout/Flatten(axis 1)
+ * - 프로토콜 버퍼를 직접 해석 (ModelProto → GraphProto), 초기값은 raw_data/float_data/외부 데이터 파일 모두 지원
+ * - 그래프 입력/출력은 하나씩, 첫 차원은 배치 (나머지 차원은 고정)
+ *
+ * 로드 시 변환 (실행 계획은 describe()로 확인):
+ * - 상수 가중치를 64바이트 정렬 Tensor로 재배치 (Gemm/MatMul은 [in][out] 열 배치, Conv는 [out][c·k])하고
+ *   Gemm의 alpha/beta/transB를 미리 반영
+ * - 융합: Gemm/MatMul/Conv 뒤의 BatchNormalization → 가중치/편향에 접기,
+ *   상수 Add → 편향에 더하기, Relu → 앞 연산의 활성화 플래그
+ *   (중간 값을 다른 연산이 읽거나 그래프 출력이면 융합하지 않음)
+ * - 정적 메모리 계획: 최대 배치 기준으로 중간 값의 수명(정의 ~ 마지막 사용, 입력/출력은 실행 전체)을 구하고
+ *   수명이 겹치지 않는 값끼리 같은 오프셋을 나눠 쓰는 활성값 아레나 하나만 할당
+ *   → run()은 힙 할당 없음 (가중치는 MODEL, 아레나는 RECOGNIZER 태그로 계정)
+ *
+ * 실패 시 false를 반환하고 error에 사유를 기록 (예외 미사용)
+ */
+class OnnxModel {
+public:
+    OnnxModel() = default;
+    OnnxModel(const OnnxModel&) = delete;
+    OnnxModel& operator=(const OnnxModel&) = delete;
+
+    // 모델 파일 로드. 외부 데이터(location)는 dataDir 기준 (빈 문자열이면 모델 파일 디렉터리)
+    bool loadFile(const std::string& path, int maxBatch, std::string* error = nullptr, const std::string& dataDir = "");
+
+    // 메모리의 모델 로드. 외부 데이터 텐서는 모두 external 한 버퍼의 offset/length를 가리킨다고 가정
+    bool loadFromMemory(const uint8_t* model, size_t modelSize, const uint8_t* external, size_t externalSize, int maxBatch,
+                        std::string* error = nullptr);
+
+    bool loaded() const { return !arena.empty(); }
+
+    // 입력 버퍼 [maxBatch][inputSize] (행 간격 inputStride, 64바이트 정렬). run()은 입력 구간을 덮어쓰지 않음
+    float* input() { return loaded() ? arena.data() + values[inputValue].offset : nullptr; }
+    int inputSize() const { return loaded() ? values[inputValue].size : 0; }
+    int inputStride() const { return loaded() ? values[inputValue].stride : 0; }
+
+    // batch개 행 실행 → 출력 [batch][outputSize] (행 간격 outputStride), 범위 밖이면 nullptr
+    const float* run(int batch);
+    int outputSize() const { return loaded() ? values[outputValue].size : 0; }
+    int outputStride() const { return loaded() ? values[outputValue].stride : 0; }
+
+    int maxBatch() const { return batchLimit; }
+    size_t arenaBytes() const { return arena.bytes(); }
+    size_t weightBytes() const;
+    int nodeCount() const { return graphNodes; }                  // 원본 그래프 노드 수
+    int stepCount() const { return static_cast<int>(steps.size()); }  // 융합 후 실행 단계 수
+    size_t macsPerRow() const;
+
+    // 융합 후 실행 계획 (단계별 연산, 크기, 아레나 오프셋)
+    std::string describe() const;
+
+    struct Graph;  // 로드 중 해석한 그래프 (onnx_executor.cpp 내부)
+
+private:
+    enum StepKind { DENSE, CONV1D, AFFINE, ADD, RELU, SOFTMAX };
+
+    // 실행 중 값 (그래프 입력/중간/출력). 배치 행마다 size개 float, 행 간격 stride
+    struct Value {
+        std::string name;
+        std::vector<int> shape;  // 배치 차원 제외
+        int size = 0;
+        int stride = 0;
+        size_t offset = 0;  // 아레나 안 위치 (float 단위)
+    };
+
+    struct Step {
+        StepKind kind;
+        std::string name;  // 원본 노드 이름 (융합된 노드는 "+"로 연결)
+        int input = -1;
+        int input2 = -1;  // ADD: 두 번째 활성값 (-1이면 상수 bias 브로드캐스트)
+        int output = -1;
+        bool relu = false;
+        int inFeatures = 0, outFeatures = 0;              // DENSE/CONV1D 입출력 크기
+        int channels = 0, length = 0, outLength = 0;      // CONV1D/AFFINE: 입력 [channels][length]
+        int kernel = 1, stride = 1, padBegin = 0, dilation = 1;
+        Tensor<float> weights{memory_accounting::MODEL};  // DENSE [in][out], CONV1D [out][channels * kernel]
+        std::vector<float> bias;                          // DENSE/CONV1D [out], AFFINE [channels], ADD 행 크기로 펼친 상수 (비면 복사)
+        std::vector<float> scale;                         // AFFINE 채널별 배율
+    };
+
+    bool build(const Graph& graph, int maxBatch, std::string* error);
+    bool planArena(std::string* error);
+
+    void runDense(const Step& step, int batch);
+    void runConv(const Step& step, int batch);
+    void runAffine(const Step& step, int batch);
+    void runAdd(const Step& step, int batch);
+    void runSoftmax(const Step& step, int batch);
+    float* valueRow(int value, int row) { return arena.data() + values[value].offset + static_cast<size_t>(row) * values[value].stride; }
+
+    std::vector<Value> values;
+    std::vector<Step> steps;
+    int inputValue = -1;
+    int outputValue = -1;
+    int batchLimit = 0;
+    int graphNodes = 0;
+    Tensor<float> arena{memory_accounting::RECOGNIZER};  // 1행 = 전체 활성값
+};
+
+#endif // ONNX_EXECUTOR_H
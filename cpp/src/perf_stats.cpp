@@ -0,0 +1,137 @@
+#include "perf_stats.h"
+#include <algorithm>  // std::min, std::max
+#include <atomic>  // 할당 카운터 (네이티브 멀티스레드 도구에서도 안전하게)
+#include <cstdlib>  // std::malloc, std::free, std::abort
+#include <cstring>  // std::memset
+#include <limits>  // 오버플로 버킷 상한
+#include <new>  // operator new 재정의
+
+namespace {
+std::atomic<uint64_t> g_allocationCount{0};  // 프로세스 전체 operator new 호출 횟수
+}
+
+#ifdef SIGN_ENABLE_STATS
+// 계측 빌드에서만 전역 operator new를 재정의하여 할당 횟수를 센다
+void* operator new(std::size_t size) {
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    void* ptr = std::malloc(size ? size : 1);
+    if (!ptr) {
+#if defined(__cpp_exceptions)
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+    return ptr;
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+#endif
+
+PerfStats::PerfStats() {
+    reset();
+}
+
+void PerfStats::reset() {
+    std::memset(stages, 0, sizeof(stages));
+    for (auto& stage : stages) {
+        stage.minNs = UINT64_MAX;  // 첫 기록에서 갱신되도록
+    }
+    std::memset(flat, 0, sizeof(flat));
+}
+
+bool PerfStats::enabled() {
+#ifdef SIGN_ENABLE_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint64_t PerfStats::allocationCount() {
+    return g_allocationCount.load(std::memory_order_relaxed);
+}
+
+// 버킷 0: 256ns 미만, 이후 옥타브(2^k ns)마다 4칸으로 나눔, 2^26ns(약 67ms) 이상은 마지막 칸
+int PerfStats::bucketIndex(uint64_t ns) {
+    if (ns < (1ULL << FIRST_OCTAVE)) return 0;
+    int octave = 63 - __builtin_clzll(ns);  // floor(log2(ns)), FIRST_OCTAVE 이상
+    int sub = static_cast<int>((ns >> (octave - 2)) & 3);  // 옥타브 내 1/4 구간
+    int idx = (octave - FIRST_OCTAVE) * 4 + sub + 1;
+    return std::min(idx, NUM_BUCKETS - 1);
+}
+
+double PerfStats::bucketUpperUs(int bucket) {
+    if (bucket == 0) return (1ULL << FIRST_OCTAVE) / 1000.0;
+    if (bucket == NUM_BUCKETS - 1) return std::numeric_limits<double>::infinity();  // 오버플로 → 호출 측이 최대값으로 제한
+    int octave = (bucket - 1) / 4 + FIRST_OCTAVE;
+    int sub = (bucket - 1) % 4;
+    double base = static_cast<double>(1ULL << octave);
+    return base * (1.0 + (sub + 1) * 0.25) / 1000.0;  // 구간 상한 (ns → us)
+}
+
+void PerfStats::record(PerfStage stage, uint64_t elapsedNs, uint64_t allocations) {
+    StageCounters& s = stages[static_cast<int>(stage)];
+    s.calls++;
+    s.totalNs += elapsedNs;
+    s.minNs = std::min(s.minNs, elapsedNs);
+    s.maxNs = std::max(s.maxNs, elapsedNs);
+    s.allocations += allocations;
+    s.buckets[bucketIndex(elapsedNs)]++;
+}
+
+double PerfStats::percentileUs(PerfStage stage, double quantile) const {
+    const StageCounters& s = stages[static_cast<int>(stage)];
+    if (s.calls == 0) return 0.0;
+
+    // 누적 개수가 목표 순위에 도달하는 버킷의 상한을 반환 (최대값으로 제한)
+    uint64_t target = static_cast<uint64_t>(quantile * (s.calls - 1)) + 1;
+    uint64_t cumulative = 0;
+    for (int b = 0; b < NUM_BUCKETS; b++) {
+        cumulative += s.buckets[b];
+        if (cumulative >= target) {
+            return std::min(bucketUpperUs(b), s.maxNs / 1000.0);
+        }
+    }
+    return s.maxNs / 1000.0;
+}
+
+const double* PerfStats::snapshot() {
+    flat[0] = enabled() ? 1.0 : 0.0;
+    flat[1] = NUM_STAGES;
+    flat[2] = FIELDS_PER_STAGE;
+
+    for (int i = 0; i < NUM_STAGES; i++) {
+        const StageCounters& s = stages[i];
+        double* out = flat + HEADER_SIZE + i * FIELDS_PER_STAGE;
+        PerfStage stage = static_cast<PerfStage>(i);
+
+        out[0] = static_cast<double>(s.calls);
+        out[1] = s.totalNs / 1000.0;
+        out[2] = s.calls ? (s.totalNs / 1000.0) / s.calls : 0.0;
+        out[3] = s.calls ? s.minNs / 1000.0 : 0.0;
+        out[4] = s.maxNs / 1000.0;
+        out[5] = percentileUs(stage, 0.50);
+        out[6] = percentileUs(stage, 0.99);
+        out[7] = static_cast<double>(s.allocations);
+    }
+    return flat;
+}
@@ -0,0 +1,116 @@
+#ifndef PERF_STATS_H
+#define PERF_STATS_H
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * 핫패스 단계별 계측 (recognize 내부 시간 분석용)
+ *
+ * - SIGN_ENABLE_STATS 플래그로 빌드했을 때만 계측 코드가 들어감 (make build STATS=1)
+ * - 플래그가 없으면 SIGN_PERF_SCOPE 매크로가 비어 있어 오버헤드 0
+ * - 단계별로 호출 횟수, 누적/최소/최대 시간, 고정 버킷 히스토그램(p50/p99), 할당 횟수를 기록
+ * - JavaScript에서는 getStats()로 평탄화된 Float64Array를 읽음
+ */
+
+// 계측 단계 (snapshot 배열의 단계 순서와 동일)
+enum class PerfStage : int {
+    Recognize = 0,        // recognize() 전체
+    FeatureExtraction,    // extractComplexFeatures
+    Inference,            // neuralNetworkInference
+    RuleFallback,         // recognizeByRules (ML 신뢰도 부족 시)
+    Serialization,        // JSON 결과 직렬화
+    Count
+};
+
+class PerfStats {
+public:
+    static constexpr int NUM_STAGES = static_cast<int>(PerfStage::Count);
+
+    // 히스토그램: 256ns 미만 1칸 + 옥타브(2^8 ~ 2^26 ns, 256ns ~ 약 67ms) 18개 x 4칸 + 오버플로 1칸
+    static constexpr int FIRST_OCTAVE = 8;
+    static constexpr int NUM_OCTAVES = 18;
+    static constexpr int NUM_BUCKETS = 1 + NUM_OCTAVES * 4 + 1;
+
+    // snapshot 레이아웃
+    // [0] 계측 활성화 여부 (1/0), [1] 단계 수, [2] 단계당 필드 수
+    // 이후 단계마다: calls, totalUs, meanUs, minUs, maxUs, p50Us, p99Us, allocations
+    static constexpr int HEADER_SIZE = 3;
+    static constexpr int FIELDS_PER_STAGE = 8;
+    static constexpr int SNAPSHOT_SIZE = HEADER_SIZE + NUM_STAGES * FIELDS_PER_STAGE;
+
+    PerfStats();
+
+    // 단계 하나의 측정값 기록 (나노초, 해당 구간 동안의 할당 횟수)
+    void record(PerfStage stage, uint64_t elapsedNs, uint64_t allocations);
+
+    // 모든 카운터 초기화
+    void reset();
+
+    // 평탄화된 통계 배열 갱신 후 반환 (SNAPSHOT_SIZE개 double, 다음 호출까지 유효)
+    const double* snapshot();
+
+    // 단계별 백분위수 (마이크로초, 버킷 상한 기준)
+    double percentileUs(PerfStage stage, double quantile) const;
+
+    // 계측이 빌드에 포함되었는지 여부
+    static bool enabled();
+
+    // 프로세스 전체 누적 할당 횟수 (SIGN_ENABLE_STATS 빌드에서만 증가)
+    static uint64_t allocationCount();
+
+private:
+    struct StageCounters {
+        uint64_t calls;
+        uint64_t totalNs;
+        uint64_t minNs;
+        uint64_t maxNs;
+        uint64_t allocations;
+        uint32_t buckets[NUM_BUCKETS];
+    };
+
+    static int bucketIndex(uint64_t ns);
+    static double bucketUpperUs(int bucket);
+
+    StageCounters stages[NUM_STAGES];
+    double flat[SNAPSHOT_SIZE];
+};
+
+/**
+ * RAII 구간 계측기
+ * - 생성 시 단조 시계(steady_clock)와 할당 카운터를 기록하고 소멸 시 PerfStats에 반영
+ */
+class PerfScope {
+public:
+    PerfScope(PerfStats& stats, PerfStage stage)
+        : stats(stats), stage(stage),
+          start(std::chrono::steady_clock::now()),
+          allocStart(PerfStats::allocationCount()) {}
+
+    ~PerfScope() {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        stats.record(stage,
+                     static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+                     PerfStats::allocationCount() - allocStart);
+    }
+
+    PerfScope(const PerfScope&) = delete;
+    PerfScope& operator=(const PerfScope&) = delete;
+
+private:
+    PerfStats& stats;
+    PerfStage stage;
+    std::chrono::steady_clock::time_point start;
+    uint64_t allocStart;
+};
+
+#define SIGN_PERF_CONCAT_INNER(a, b) a##b
+#define SIGN_PERF_CONCAT(a, b) SIGN_PERF_CONCAT_INNER(a, b)
+
+#ifdef SIGN_ENABLE_STATS
+#define SIGN_PERF_SCOPE(stats, stage) PerfScope SIGN_PERF_CONCAT(perfScope_, __LINE__)((stats), (stage))
+#else
+#define SIGN_PERF_SCOPE(stats, stage) ((void)0)
+#endif
+
+#endif // PERF_STATS_H
@@ -0,0 +1,172 @@
+#include "recognition_pipeline.h"
+#include <immintrin.h>  // _mm_pause
+#include <algorithm>  // std::copy, std::max, std::min
+#include <chrono>  // steady_clock
+#include <cstring>  // std::memcpy
+
+namespace {
+constexpr int IDLE_SPINS = 2048;   // 잠들기 전 새 프레임을 기다리며 도는 횟수 (연속 프레임 사이 간격 흡수)
+constexpr int IDLE_SLEEP_US = 100;  // 그 뒤로는 이 간격마다 입력 링 확인 (submit이 깨우지 않음)
+
+inline uint64_t nowNs() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+}  // namespace
+
+RecognitionPipeline::RecognitionPipeline(const Config& config)
+    : cfg(config),
+      input(static_cast<size_t>(std::max(2, config.inputCapacity))),
+      staged(static_cast<size_t>(std::max(2, config.stageCapacity))),
+      results(static_cast<size_t>(std::max(2, config.resultCapacity))) {
+    cfg.maxBatch = std::max(1, std::min(cfg.maxBatch, SignRecognizer::MAX_BATCH_FRAMES));
+}
+
+RecognitionPipeline::~RecognitionPipeline() {
+    stop();
+}
+
+bool RecognitionPipeline::start(std::string* error) {
+    if (running.load()) return true;
+    if (!recognizer.initialize() || !recognizer.getInputBuffer()) {
+        if (error) *error = "recognizer initialization failed";
+        return false;
+    }
+    // 필터는 특징 스레드가 적용 (SignRecognizer::setLandmarkFilter와 같은 범위 처리)
+    const bool known = cfg.filterMode >= LandmarkFilter::OFF && cfg.filterMode <= LandmarkFilter::KALMAN;
+    filter.setMode(known ? static_cast<LandmarkFilter::Mode>(cfg.filterMode) : LandmarkFilter::OFF);
+    filter.setNominalFrameRate(cfg.filterFps);
+    running.store(true);
+    featurizer = std::thread(&RecognitionPipeline::featurizeLoop, this);
+    inferencer = std::thread(&RecognitionPipeline::inferenceLoop, this);
+    return true;
+}
+
+void RecognitionPipeline::stop() {
+    if (!running.exchange(false)) return;
+    if (featurizer.joinable()) featurizer.join();
+    if (inferencer.joinable()) inferencer.join();
+}
+
+bool RecognitionPipeline::submit(uint64_t frameId, const float* landmarks) {
+    if (!landmarks) return false;
+    Frame frame;
+    frame.frameId = frameId;
+    frame.submitNs = nowNs();
+    std::memcpy(frame.landmarks, landmarks, sizeof(frame.landmarks));
+
+    bool evicted = false;
+    const bool pushed = cfg.policy == BACKPRESSURE ? input.push(frame) : input.pushDropOldest(frame, &evicted);
+    if (evicted) counters.dropped.fetch_add(1, std::memory_order_relaxed);
+    if (!pushed) {
+        // BACKPRESSURE 거절, 또는 DROP_OLDEST에서 워커가 슬롯을 꺼내는 도중이라 자리가 아직 없음 (새 프레임을 버림)
+        counters.rejected.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    counters.submitted.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+int RecognitionPipeline::poll(Result* out, int maxResults) {
+    if (!out) return 0;
+    int count = 0;
+    while (count < maxResults && results.pop(out[count])) count++;
+    return count;
+}
+
+size_t RecognitionPipeline::inFlight() const {
+    uint64_t done = counters.processed.load() + counters.dropped.load();
+    uint64_t in = counters.submitted.load();
+    return in > done ? static_cast<size_t>(in - done) : 0;
+}
+
+template <typename Ring>
+void RecognitionPipeline::waitForWork(const Ring& ring) {
+    for (int spin = 0; spin < IDLE_SPINS; spin++) {
+        if (ring.sizeApprox() || !running.load(std::memory_order_relaxed)) return;
+        _mm_pause();
+    }
+    // 조건 변수로 깨우면 submit마다 시스템 호출(futex)이 생겨 캡처 스레드가 느려지므로 짧게 잠들며 확인
+    std::this_thread::sleep_for(std::chrono::microseconds(IDLE_SLEEP_US));
+}
+
+void RecognitionPipeline::publish(const Result& result) {
+    if (cfg.policy == DROP_OLDEST) {
+        // 가장 오래된 결과를 한 번만 버리고, 그래도 자리가 없으면(소비자가 꺼내는 도중) 새 결과를 버림
+        bool evicted = false;
+        const bool pushed = results.pushDropOldest(result, &evicted);
+        counters.resultsDropped.fetch_add(static_cast<uint64_t>(evicted) + !pushed, std::memory_order_relaxed);
+        return;
+    }
+    while (!results.push(result)) {
+        // BACKPRESSURE: 소비자가 poll할 때까지 추론 스레드가 양보 (입력 링이 차면 캡처 쪽에서 거절로 드러남)
+        if (!running.load(std::memory_order_relaxed)) return;
+        std::this_thread::yield();
+    }
+}
+
+void RecognitionPipeline::featurizeLoop() {
+    // 두 손 좌표 126개 중 오른손 자리에 (x, y, 0)을 채워 FeatureArena가 그 손을 고르게 함 (왼손 자리는 0)
+    float hands[2 * FeatureArena::HAND_FLOATS] = {};
+    float* hand = hands + FeatureArena::HAND_FLOATS;
+    Features features;
+
+    while (running.load(std::memory_order_relaxed)) {
+        uint64_t ticket = 0;
+        const Frame* frame = input.claim(ticket);  // 슬롯에서 바로 읽고 돌려줌
+        if (!frame) {
+            waitForWork(input);
+            continue;
+        }
+        for (int i = 0; i < 21; i++) {
+            hand[i * 3] = frame->landmarks[i * 2];
+            hand[i * 3 + 1] = frame->landmarks[i * 2 + 1];
+        }
+        features.frameId = frame->frameId;
+        features.submitNs = frame->submitNs;
+        input.release(ticket);
+
+        // 1. 필터 → 특징 추출 (recognize의 applyLandmarkFilter와 같은 stride 3 제자리 평활화)
+        if (filter.getMode() != LandmarkFilter::OFF) filter.filter(hand, 21, 3);
+        arena.compute(hands, registry_models::NETWORK_BLOCKS);
+        const FeatureArena& computed = arena;
+        const float* complex = computed.block(FeatureArena::COMPLEX_FEATURES);
+        const float* extended = computed.block(FeatureArena::FINGER_EXTENSION);
+        std::copy(complex, complex + FeatureArena::COMPLEX_SIZE, features.complex);
+        std::copy(extended, extended + 5, features.extended);
+
+        // 2. 특징 링으로 (차면 추론 스레드를 기다림 → 입력 링이 차면서 캡처 쪽 정책으로 전달)
+        while (!staged.push(features)) {
+            if (!running.load(std::memory_order_relaxed)) return;
+            std::this_thread::yield();
+        }
+    }
+}
+
+void RecognitionPipeline::inferenceLoop() {
+    while (running.load(std::memory_order_relaxed)) {
+        // 쌓인 특징을 최대 maxBatch개 처리 (슬롯에서 바로 읽어 복사 없음)
+        int count = 0;
+        while (count < cfg.maxBatch) {
+            uint64_t ticket = 0;
+            const Features* features = staged.claim(ticket);
+            if (!features) break;
+            RecognitionResult recognized =
+                recognizer.recognizeFromFeatures(features->complex, FeatureArena::COMPLEX_SIZE, features->extended);
+            Result result;
+            result.frameId = features->frameId;
+            result.gestureId = recognized.id;
+            result.confidence = recognized.confidence;
+            result.latencyUs = static_cast<float>((nowNs() - features->submitNs) / 1000.0);
+            staged.release(ticket);
+            publish(result);
+            count++;
+        }
+        if (count == 0) {
+            waitForWork(staged);
+            continue;
+        }
+        counters.batches.fetch_add(1, std::memory_order_relaxed);
+        counters.processed.fetch_add(count, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,122 @@
+#ifndef RECOGNITION_PIPELINE_H
+#define RECOGNITION_PIPELINE_H
+
+#include "feature_registry.h"
+#include "landmark_filter.h"
+#include "sign_recognition.h"
+#include "spsc_ring.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+/**
+ * 비동기 파이프라인 인식 (네이티브 전용, WASM 빌드 제외)
+ *
+ *   캡처 스레드 --submit()--> [입력 링] --> 특징 스레드 (필터 → 특징 추출) --> [특징 링]
+ *               --> 추론 스레드 (MLP + 규칙 폴백) --> [결과 링] --poll()--> 소비 스레드
+ *
+ * - 캡처 스레드는 submit()에서 절대 기다리지 않음 (락/시스템 호출 없음, 유휴 워커는 스스로 짧게 잠들며 확인)
+ *   입력 링이 가득 차면 정책에 따라
+ *   BACKPRESSURE는 새 프레임을 거절(false 반환, 호출자가 판단), DROP_OLDEST는 가장 오래된 대기 프레임을 한 번만 버림
+ *   (워커가 슬롯을 꺼내는 도중이라 그래도 자리가 없으면 새 프레임을 버리고 false, submit마다 버림은 최대 1개)
+ * - 두 단계는 스레드가 따로라 프레임 N을 추론하는 동안 프레임 N+1의 특징을 뽑음
+ *   - 특징 스레드: 입력 링 슬롯에서 바로 지터 필터 → FeatureArena (COMPLEX_FEATURES + FINGER_EXTENSION)
+ *     → 특징 링 (특징 링이 차면 추론 스레드를 기다림, 버리지 않음)
+ *   - 추론 스레드: 특징 링에서 최대 maxBatch개씩 꺼내 전용 SignRecognizer::recognizeFromFeatures
+ *     (결과는 recognizeStaged와 같음)
+ * - 결과는 frameId와 함께 결과 링으로 돌아옴. 결과 링이 가득 차면 BACKPRESSURE는 추론 스레드가 poll을
+ *   기다리고(특징 링 → 입력 링이 차면서 캡처 쪽 정책으로 전달), DROP_OLDEST는 가장 오래된 결과를 버림
+ * - submit은 한 스레드, poll은 한 스레드에서만 호출 (같은 스레드여도 됨)
+ */
+class RecognitionPipeline {
+public:
+    enum OverflowPolicy { BACKPRESSURE = 0, DROP_OLDEST = 1 };
+
+    static constexpr int FLOATS_PER_FRAME = SignRecognizer::FLOATS_PER_FRAME;  // 21 x (x, y)
+
+    struct Config {
+        int inputCapacity = 64;     // 입력 링 용량 (2의 거듭제곱으로 올림)
+        int resultCapacity = 256;   // 결과 링 용량
+        int stageCapacity = 64;     // 특징 링 용량 (특징 스레드 → 추론 스레드)
+        int maxBatch = SignRecognizer::MAX_BATCH_FRAMES;  // 추론 스레드가 한 번에 꺼내는 최대 프레임 수
+        OverflowPolicy policy = DROP_OLDEST;
+        int filterMode = 0;         // SignRecognizer::setLandmarkFilter (0: 끄기, 1: One-Euro, 2: 칼만)
+        float filterFps = 30.0f;
+    };
+
+    struct Frame {
+        uint64_t frameId;
+        uint64_t submitNs;  // submit 시각 (steady_clock)
+        float landmarks[FLOATS_PER_FRAME];
+    };
+
+    struct Result {
+        uint64_t frameId;
+        int32_t gestureId;
+        float confidence;
+        float latencyUs;  // submit부터 결과 기록까지 (큐 대기 + 추론)
+    };
+
+    struct Stats {
+        std::atomic<uint64_t> submitted{0};       // 입력 링에 들어간 프레임
+        std::atomic<uint64_t> rejected{0};        // 링에 넣지 못한 새 프레임 (BACKPRESSURE 거절, DROP_OLDEST 자리 없음)
+        std::atomic<uint64_t> dropped{0};         // DROP_OLDEST로 버린 대기 프레임
+        std::atomic<uint64_t> processed{0};       // 추론까지 끝난 프레임
+        std::atomic<uint64_t> resultsDropped{0};  // DROP_OLDEST로 버린 결과 (가장 오래된 것 또는 자리 없는 새 결과)
+        std::atomic<uint64_t> batches{0};         // 추론 스레드가 한 번에 꺼낸 묶음 수
+    };
+
+    explicit RecognitionPipeline(const Config& config);
+    ~RecognitionPipeline();
+
+    RecognitionPipeline(const RecognitionPipeline&) = delete;
+    RecognitionPipeline& operator=(const RecognitionPipeline&) = delete;
+
+    bool start(std::string* error = nullptr);  // 인식기 초기화 + 두 단계 스레드 시작
+    void stop();  // 스레드 종료 (링에 남은 프레임/특징/결과는 그대로)
+
+    // 캡처 스레드: landmarks[42]를 복사해 넣음, 정책상 받아들이지 못하면 false (기다리지 않음)
+    bool submit(uint64_t frameId, const float* landmarks);
+
+    // 소비 스레드: 완료된 결과를 최대 maxResults개 꺼냄 (기다리지 않음)
+    int poll(Result* out, int maxResults);
+
+    // 아직 결과로 나오지 않은 프레임 수 (대략값)
+    size_t inFlight() const;
+
+    const Stats& stats() const { return counters; }
+    const Config& config() const { return cfg; }
+
+private:
+    // 특징 링 항목 (특징 스레드 → 추론 스레드)
+    struct Features {
+        uint64_t frameId;
+        uint64_t submitNs;
+        float complex[FeatureArena::COMPLEX_SIZE];
+        float extended[5];  // 엄지..소지 펴짐
+    };
+
+    void featurizeLoop();
+    void inferenceLoop();
+    void publish(const Result& result);
+    template <typename Ring>
+    void waitForWork(const Ring& ring);
+
+    Config cfg;
+    SpscRing<Frame> input;
+    SpscRing<Features> staged;
+    SpscRing<Result> results;
+    LandmarkFilter filter{LandmarkFilter::OFF};  // 특징 스레드 전용
+    FeatureArena arena;                          // 특징 스레드 전용
+    SignRecognizer recognizer;                   // 추론 스레드 전용
+
+    std::thread featurizer;
+    std::thread inferencer;
+    std::atomic<bool> running{false};
+
+    Stats counters;
+};
+
+#endif // RECOGNITION_PIPELINE_H
@@ -0,0 +1,424 @@
+#include "recognition_server.h"
+#include "sign_recognition.h"
+
+#include <fcntl.h>  // O_NONBLOCK
+#include <poll.h>  // poll
+#include <sys/socket.h>  // socket, bind, listen, accept, send, recv
+#include <sys/un.h>  // sockaddr_un
+#include <unistd.h>  // close, pipe, read, write, unlink
+
+#include <algorithm>  // std::min
+#include <cerrno>  // errno
+#include <cstring>  // std::memcpy, std::strerror
+
+namespace server {
+
+// ============================================================
+// 동적 배치 큐
+// ============================================================
+
+DynamicBatcher::DynamicBatcher(const BatcherConfig& config) : cfg(config) {
+    cfg.maxBatch = std::max(1, cfg.maxBatch);
+    cfg.maxLatencyUs = std::max(0, cfg.maxLatencyUs);
+    cfg.maxQueueFrames = std::max(cfg.maxBatch, cfg.maxQueueFrames);
+    cfg.maxSessionFrames = std::max(1, cfg.maxSessionFrames);
+}
+
+bool DynamicBatcher::submit(const PendingFrame& frame) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::deque<PendingFrame>& queue = queues[frame.message.engine];
+        if (static_cast<int>(queue.size()) >= cfg.maxQueueFrames) return false;
+        queue.push_back(frame);
+    }
+    ready.notify_one();
+    return true;
+}
+
+void DynamicBatcher::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    ready.notify_all();
+}
+
+bool DynamicBatcher::nextBatch(Batch& batch) {
+    const auto maxWait = std::chrono::microseconds(cfg.maxLatencyUs);
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (!stopping) {
+        // 1. 가득 찬 큐가 있으면 바로 실행, 아니면 가장 오래된 프레임의 마감 시각(arrival + maxLatency)을 찾음
+        const Clock::time_point now = Clock::now();
+        int chosen = -1;
+        bool byDeadline = false;
+        Clock::time_point earliestDeadline = Clock::time_point::max();
+        for (int e = 0; e < static_cast<int>(ENGINE_COUNT); e++) {
+            if (queues[e].empty()) continue;
+            if (static_cast<int>(queues[e].size()) >= cfg.maxBatch) {
+                chosen = e;
+                byDeadline = false;
+                break;
+            }
+            Clock::time_point deadline = queues[e].front().arrival + maxWait;
+            if (deadline < earliestDeadline) {
+                earliestDeadline = deadline;
+                if (deadline <= now) {
+                    chosen = e;
+                    byDeadline = true;
+                }
+            }
+        }
+
+        if (chosen >= 0) {
+            std::deque<PendingFrame>& queue = queues[chosen];
+            // 앞쪽(가장 오래된) 프레임 중 이미 마감을 넘긴 것은 실행하지 않고 거부 목록으로
+            // 마감으로 깨운 배치는 그 마감의 주인인 맨 앞 프레임부터 실행 (기상이 늦어도 깨운 프레임은 버리지 않음)
+            size_t stale = 0;
+            if (cfg.shedExpired && !byDeadline) {
+                while (stale < queue.size() && queue[stale].arrival + maxWait < now) stale++;
+            }
+            batch.expired.assign(queue.begin(), queue.begin() + stale);
+            size_t n = std::min(queue.size() - stale, static_cast<size_t>(cfg.maxBatch));
+            batch.frames.assign(queue.begin() + stale, queue.begin() + stale + n);
+            queue.erase(queue.begin(), queue.begin() + stale + n);
+            batch.engine = static_cast<Engine>(chosen);
+            batch.dispatched = now;
+            return true;
+        }
+
+        // 2. 마감 시각까지 (또는 새 프레임이 올 때까지) 대기
+        if (earliestDeadline == Clock::time_point::max()) {
+            ready.wait(lock);
+        } else {
+            ready.wait_until(lock, earliestDeadline);
+        }
+    }
+    return false;
+}
+
+// ============================================================
+// 인식 서버
+// ============================================================
+
+RecognitionServer::RecognitionServer(const std::string& socketPath, int workers, const BatcherConfig& config,
+                                     const std::vector<float>& mean, const std::vector<float>& scale)
+    : path(socketPath), workerCount(std::max(1, workers)), scalerMean(mean), scalerScale(scale),
+      maxSessionFrames(std::max(1, config.maxSessionFrames)), batcher(config) {}
+
+RecognitionServer::~RecognitionServer() {
+    stop();
+}
+
+namespace {
+bool setNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+}  // namespace
+
+bool RecognitionServer::start(std::string* error) {
+    auto fail = [&](const char* what) {
+        if (error) *error = std::string(what) + ": " + std::strerror(errno);
+        return false;
+    };
+
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) {
+        if (error) *error = "socket path too long";
+        return false;
+    }
+    std::memcpy(addr.sun_path, path.c_str(), path.size());
+
+    listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0) return fail("socket");
+    unlink(path.c_str());  // 이전 실행이 남긴 소켓 파일 제거
+    if (bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) return fail("bind");
+    if (listen(listenFd, 128) < 0) return fail("listen");
+    if (!setNonBlocking(listenFd)) return fail("fcntl");
+    if (pipe(wakePipe) < 0) return fail("pipe");
+    setNonBlocking(wakePipe[0]);
+    setNonBlocking(wakePipe[1]);
+
+    running = true;
+    for (int i = 0; i < workerCount; i++) workers.emplace_back(&RecognitionServer::workerLoop, this);
+    ioThread = std::thread(&RecognitionServer::ioLoop, this);
+    return true;
+}
+
+void RecognitionServer::stop() {
+    if (!running.exchange(false)) return;
+
+    batcher.stop();
+    for (auto& worker : workers) worker.join();
+    workers.clear();
+
+    char byte = 1;
+    (void)!write(wakePipe[1], &byte, 1);  // poll 대기 중인 I/O 스레드 깨우기
+    ioThread.join();
+
+    for (auto& entry : sessions) close(entry.second.fd);
+    sessions.clear();
+    close(listenFd);
+    close(wakePipe[0]);
+    close(wakePipe[1]);
+    listenFd = wakePipe[0] = wakePipe[1] = -1;
+    unlink(path.c_str());
+}
+
+// 워커: 배치를 받아 엔진별 배치 추론 후 결과 전달
+// 워커마다 자체 엔진 인스턴스를 가짐 (SignRecognizer 가중치는 공유 모델)
+void RecognitionServer::workerLoop() {
+    SignRecognition mlp;
+    mlp.setScaler(scalerMean, scalerScale);
+    SignRecognizer recognizer;
+    recognizer.initialize();
+
+    Batch batch;
+    std::vector<float> features;
+    std::vector<int> classes;
+    std::vector<float> confidences;
+    std::vector<ResultMessage> results;
+
+    while (batcher.nextBatch(batch)) {
+        // 마감을 넘긴 프레임은 실행 없이 거부 응답
+        for (const PendingFrame& frame : batch.expired) {
+            ResultMessage r;
+            std::memset(&r, 0, sizeof(r));
+            r.magic = RESULT_MAGIC;
+            r.frameId = frame.message.frameId;
+            r.engine = batch.engine;
+            r.classId = CLASS_REJECTED;
+            r.serverLatencyUs = std::chrono::duration<float, std::micro>(batch.dispatched - frame.arrival).count();
+            deliver(frame.sessionId, r);
+            counters.framesRejected++;
+        }
+        if (batch.frames.empty()) continue;
+
+        const Engine engine = batch.engine;
+        const std::vector<PendingFrame>& frames = batch.frames;
+        const int n = static_cast<int>(frames.size());
+        uint64_t queueDelay = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(batch.dispatched - frames.front().arrival).count());
+        results.assign(n, ResultMessage());
+
+        if (engine == ENGINE_MLP) {
+            const int dim = SignRecognition::featureDim();
+            features.resize(static_cast<size_t>(n) * dim);
+            classes.resize(n);
+            confidences.resize(n);
+            for (int i = 0; i < n; i++) {
+                std::memcpy(&features[static_cast<size_t>(i) * dim], frames[i].message.payload, dim * sizeof(float));
+            }
+            mlp.predictMLPBatch(features.data(), n, classes.data(), confidences.data());
+            for (int i = 0; i < n; i++) {
+                results[i].classId = classes[i];
+                results[i].confidence = confidences[i];  // 소프트맥스 최대 확률
+            }
+        } else {
+            // 스테이징 버퍼 크기 단위로 나누어 recognizeStaged 호출
+            for (int base = 0; base < n; base += SignRecognizer::MAX_BATCH_FRAMES) {
+                int chunk = std::min(SignRecognizer::MAX_BATCH_FRAMES, n - base);
+                float* input = recognizer.getInputBuffer();
+                for (int i = 0; i < chunk; i++) {
+                    std::memcpy(input + i * SignRecognizer::FLOATS_PER_FRAME, frames[base + i].message.payload,
+                                SignRecognizer::FLOATS_PER_FRAME * sizeof(float));
+                }
+                recognizer.recognizeStaged(chunk);
+                const float* output = recognizer.getOutputBuffer();
+                for (int i = 0; i < chunk; i++) {
+                    results[base + i].classId = static_cast<int32_t>(output[i * SignRecognizer::RESULT_FLOATS_PER_FRAME]);
+                    results[base + i].confidence = output[i * SignRecognizer::RESULT_FLOATS_PER_FRAME + 1];
+                }
+            }
+        }
+
+        Clock::time_point done = Clock::now();
+        for (int i = 0; i < n; i++) {
+            ResultMessage& r = results[i];
+            r.magic = RESULT_MAGIC;
+            r.frameId = frames[i].message.frameId;
+            r.engine = engine;
+            r.serverLatencyUs = std::chrono::duration<float, std::micro>(done - frames[i].arrival).count();
+            deliver(frames[i].sessionId, r);
+        }
+
+        counters.batches++;
+        uint64_t prevMax = counters.maxQueueDelayUs.load();
+        while (queueDelay > prevMax && !counters.maxQueueDelayUs.compare_exchange_weak(prevMax, queueDelay)) {
+        }
+    }
+}
+
+// 워커 → I/O 스레드 결과 전달 (파이프에 1바이트 써서 poll 깨움, 중복 깨우기 방지)
+void RecognitionServer::deliver(uint32_t sessionId, const ResultMessage& result) {
+    {
+        std::lock_guard<std::mutex> lock(resultMutex);
+        pendingResults.emplace_back(sessionId, result);
+    }
+    if (!wakePending.exchange(true)) {
+        char byte = 1;
+        (void)!write(wakePipe[1], &byte, 1);
+    }
+}
+
+// 큐가 가득 차 실행하지 않는 프레임: 워커를 거치지 않고 바로 거부 응답
+void RecognitionServer::reject(Session& session, const FrameMessage& message) {
+    ResultMessage result;
+    std::memset(&result, 0, sizeof(result));
+    result.magic = RESULT_MAGIC;
+    result.frameId = message.frameId;
+    result.engine = message.engine;
+    result.classId = CLASS_REJECTED;
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&result);
+    session.outbox.insert(session.outbox.end(), bytes, bytes + sizeof(ResultMessage));
+    counters.framesRejected++;
+}
+
+bool RecognitionServer::canRead(const Session& session) const {
+    const int unsent = static_cast<int>(session.outbox.size() / sizeof(ResultMessage));
+    return session.pending + unsent < maxSessionFrames;
+}
+
+void RecognitionServer::acceptClients() {
+    while (true) {
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0) return;  // EAGAIN: 대기 중인 연결 없음
+        setNonBlocking(fd);
+        Session session;
+        session.fd = fd;
+        sessions.emplace(nextSessionId++, std::move(session));
+        counters.sessionsOpened++;
+    }
+}
+
+// 소켓에서 읽은 바이트를 완전한 FrameMessage 단위로 잘라 배치 큐에 넣음
+// - 응답 대기 프레임이 상한에 닿으면 남은 바이트는 소켓에 두고 중단 (inbox는 프레임 하나 미만만 남음)
+bool RecognitionServer::readSession(Session& session, uint32_t sessionId) {
+    while (canRead(session)) {
+        // 상한까지 남은 프레임 수만큼만 읽음
+        const int room = maxSessionFrames - session.pending - static_cast<int>(session.outbox.size() / sizeof(ResultMessage));
+        uint8_t buffer[64 * sizeof(FrameMessage)];
+        const size_t want = std::min(sizeof(buffer), static_cast<size_t>(room) * sizeof(FrameMessage) - session.inbox.size());
+        ssize_t got = recv(session.fd, buffer, want, 0);
+        if (got == 0) return false;  // 클라이언트 종료
+        if (got < 0) {
+            if (errno == EINTR) continue;
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        session.inbox.insert(session.inbox.end(), buffer, buffer + got);
+
+        Clock::time_point now = Clock::now();
+        size_t offset = 0;
+        while (session.inbox.size() - offset >= sizeof(FrameMessage)) {
+            PendingFrame frame;
+            std::memcpy(&frame.message, session.inbox.data() + offset, sizeof(FrameMessage));
+            offset += sizeof(FrameMessage);
+            if (frame.message.magic != FRAME_MAGIC || frame.message.engine >= ENGINE_COUNT) {
+                return false;  // 프로토콜 위반 → 세션 종료
+            }
+            frame.sessionId = sessionId;
+            frame.arrival = now;
+            counters.framesIn++;
+            if (batcher.submit(frame)) {
+                session.pending++;
+            } else {
+                reject(session, frame.message);
+            }
+        }
+        session.inbox.erase(session.inbox.begin(), session.inbox.begin() + offset);
+    }
+    return true;
+}
+
+bool RecognitionServer::flushSession(Session& session) {
+    size_t sent = 0;
+    while (sent < session.outbox.size()) {
+        ssize_t n = send(session.fd, session.outbox.data() + sent, session.outbox.size() - sent, MSG_NOSIGNAL);
+        if (n > 0) {
+            sent += n;
+            continue;
+        }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;  // 나머지는 POLLOUT 때 전송
+        return false;
+    }
+    session.outbox.erase(session.outbox.begin(), session.outbox.begin() + sent);
+    return true;
+}
+
+void RecognitionServer::closeSession(uint32_t sessionId) {
+    auto it = sessions.find(sessionId);
+    if (it == sessions.end()) return;
+    close(it->second.fd);
+    sessions.erase(it);  // 이후 도착하는 이 세션의 결과는 버려짐
+}
+
+void RecognitionServer::ioLoop() {
+    std::vector<pollfd> fds;
+    std::vector<uint32_t> ids;
+    std::vector<std::pair<uint32_t, ResultMessage>> results;
+
+    while (running) {
+        fds.clear();
+        ids.clear();
+        fds.push_back({listenFd, POLLIN, 0});
+        fds.push_back({wakePipe[0], POLLIN, 0});
+        for (auto& entry : sessions) {
+            short events = canRead(entry.second) ? POLLIN : 0;  // 상한이면 읽지 않음 (역압)
+            if (!entry.second.outbox.empty()) events |= POLLOUT;
+            fds.push_back({entry.second.fd, events, 0});
+            ids.push_back(entry.first);
+        }
+
+        if (poll(fds.data(), fds.size(), 100) < 0 && errno != EINTR) break;
+
+        // 1. 워커 결과를 세션 송신 버퍼로 옮기고 전송
+        if (fds[1].revents & POLLIN) {
+            char drain[256];
+            while (read(wakePipe[0], drain, sizeof(drain)) > 0) {
+            }
+            wakePending = false;  // 먼저 내려야 교환 이후 도착한 결과가 다시 깨움
+            {
+                std::lock_guard<std::mutex> lock(resultMutex);
+                results.swap(pendingResults);
+            }
+            for (const auto& item : results) {
+                auto it = sessions.find(item.first);
+                if (it == sessions.end()) continue;
+                const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&item.second);
+                it->second.outbox.insert(it->second.outbox.end(), bytes, bytes + sizeof(ResultMessage));
+                it->second.pending--;
+                if (item.second.classId != CLASS_REJECTED) counters.framesOut++;
+            }
+            results.clear();
+            std::vector<uint32_t> broken;
+            for (auto& entry : sessions) {
+                if (!entry.second.outbox.empty() && !flushSession(entry.second)) broken.push_back(entry.first);
+            }
+            for (uint32_t id : broken) closeSession(id);
+        }
+
+        // 2. 새 연결
+        if (fds[0].revents & POLLIN) acceptClients();
+
+        // 3. 세션 입출력 (poll 이전에 존재하던 세션만)
+        for (size_t i = 0; i < ids.size(); i++) {
+            short revents = fds[i + 2].revents;
+            if (!revents) continue;
+            auto it = sessions.find(ids[i]);
+            if (it == sessions.end()) continue;
+
+            bool alive = true;
+            if (revents & POLLIN) alive = readSession(it->second, ids[i]);
+            if (alive && (revents & POLLOUT)) alive = flushSession(it->second);
+            if (alive && (revents & (POLLERR | POLLNVAL))) alive = false;
+            if (alive && (revents & POLLHUP) && !(revents & POLLIN)) alive = false;
+            if (!alive) closeSession(ids[i]);
+        }
+    }
+}
+
+}  // namespace server
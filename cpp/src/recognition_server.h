@@ -0,0 +1,190 @@
+#ifndef RECOGNITION_SERVER_H
+#define RECOGNITION_SERVER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * 다중 세션 네이티브 인식 서버 (리눅스 전용, WASM 빌드 제외)
+ *
+ * - 로컬 유닉스 도메인 소켓으로 여러 클라이언트(세션)의 프레임을 받음
+ * - 서로 다른 세션의 프레임을 엔진별 큐에 모아 동적 배치 구성
+ *   (maxBatch개가 모이거나 가장 오래된 프레임이 maxLatency만큼 기다리면 즉시 배치 실행)
+ * - 워커 풀이 배치 추론 후 결과를 세션별로 되돌려 보냄
+ * - 과부하 정책:
+ *   - 세션마다 응답 대기 프레임이 maxSessionFrames개면 그 소켓을 읽지 않음 (커널 버퍼가 차서 클라이언트 송신이 막힘)
+ *   - 엔진 큐가 maxQueueFrames개면 새 프레임은 실행하지 않고 classId = CLASS_REJECTED 응답으로 바로 거부
+ *   - (선택, shedExpired) 큐가 가득 차 꺼낸 배치에서 이미 maxLatency를 넘긴 앞쪽 프레임도 CLASS_REJECTED
+ * - 마감: 엔진 큐의 가장 오래된 프레임 arrival + maxLatency에 타이머를 걸고, 깨운 프레임은 늦게 깨어나도 항상 실행
+ *
+ * 와이어 프로토콜 (리틀 엔디언, 고정 크기):
+ *   요청 FrameMessage  (520바이트): magic 'SLF1', frameId, engine, reserved, payload[126]
+ *     - engine 0 (MLP): payload = 126차원 특징 (왼손 63 + 오른손 63, 스케일러 적용 전)
+ *     - engine 1 (Recognizer): payload 앞 42개 = 21개 랜드마크 (x, y)
+ *   응답 ResultMessage (24바이트): magic 'SLR1', frameId, engine, classId, confidence, serverLatencyUs
+ */
+
+namespace server {
+
+constexpr uint32_t FRAME_MAGIC = 0x31464c53;   // "SLF1"
+constexpr uint32_t RESULT_MAGIC = 0x31524c53;  // "SLR1"
+constexpr int PAYLOAD_FLOATS = 126;
+constexpr int32_t CLASS_REJECTED = -2;  // 과부하로 실행하지 않은 프레임의 응답 classId (confidence 0)
+
+enum Engine : uint32_t {
+    ENGINE_MLP = 0,         // SignRecognition::predictMLPBatch
+    ENGINE_RECOGNIZER = 1,  // SignRecognizer::recognizeStaged
+    ENGINE_COUNT
+};
+
+struct FrameMessage {
+    uint32_t magic;
+    uint32_t frameId;
+    uint32_t engine;
+    uint32_t reserved;
+    float payload[PAYLOAD_FLOATS];
+};
+
+struct ResultMessage {
+    uint32_t magic;
+    uint32_t frameId;
+    uint32_t engine;
+    int32_t classId;
+    float confidence;
+    float serverLatencyUs;  // 수신부터 결과 생성까지 (큐 대기 + 추론)
+};
+
+static_assert(sizeof(FrameMessage) == 520, "FrameMessage layout");
+static_assert(sizeof(ResultMessage) == 24, "ResultMessage layout");
+
+using Clock = std::chrono::steady_clock;
+
+// 배치 대기 중인 프레임
+struct PendingFrame {
+    uint32_t sessionId;
+    FrameMessage message;
+    Clock::time_point arrival;
+};
+
+struct BatcherConfig {
+    int maxBatch = 32;              // 배치 최대 프레임 수
+    int maxLatencyUs = 2000;        // 가장 오래된 프레임의 최대 대기 시간
+    int maxQueueFrames = 1024;      // 엔진별 대기 큐 상한 (가득 차면 새 프레임 거부)
+    int maxSessionFrames = 64;      // 세션당 응답 대기(큐 + 실행 + 송신 버퍼) 프레임 상한 (넘으면 읽기 중단)
+    bool shedExpired = false;       // 가득 찬 큐에서 꺼낸 배치 앞쪽의 maxLatency를 넘긴 프레임은 실행하지 않고 거부
+};
+
+// 워커가 받아가는 배치 하나
+struct Batch {
+    Engine engine = ENGINE_MLP;
+    std::vector<PendingFrame> frames;   // 실행할 프레임 (arrival 순)
+    std::vector<PendingFrame> expired;  // 마감을 넘겨 CLASS_REJECTED로 응답할 프레임 (shedExpired)
+    Clock::time_point dispatched;       // 큐에서 꺼낸 시각 (큐 대기 = dispatched - arrival)
+};
+
+/**
+ * 동적 배치 큐
+ * - 엔진별로 프레임을 모으고, 워커는 nextBatch()로 실행할 배치를 받아감
+ */
+class DynamicBatcher {
+public:
+    explicit DynamicBatcher(const BatcherConfig& config);
+
+    // 엔진 큐가 maxQueueFrames개로 가득 찼으면 넣지 않고 false
+    bool submit(const PendingFrame& frame);
+
+    // 배치가 준비될 때까지 대기 (stop() 후에는 false, frames가 비고 expired만 있을 수 있음)
+    bool nextBatch(Batch& batch);
+
+    void stop();
+
+    BatcherConfig config() const { return cfg; }
+
+private:
+    BatcherConfig cfg;
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<PendingFrame> queues[ENGINE_COUNT];
+    bool stopping = false;
+};
+
+struct ServerStats {
+    std::atomic<uint64_t> framesIn{0};
+    std::atomic<uint64_t> framesOut{0};
+    std::atomic<uint64_t> framesRejected{0};  // CLASS_REJECTED로 응답한 프레임 (큐 가득 참)
+    std::atomic<uint64_t> batches{0};
+    std::atomic<uint64_t> sessionsOpened{0};
+    std::atomic<uint64_t> maxQueueDelayUs{0};
+};
+
+/**
+ * 인식 서버
+ * - start()로 소켓 리슨 + I/O 스레드 + 워커 풀 시작, stop()으로 종료
+ * - I/O 스레드 1개가 poll()로 모든 세션 소켓을 처리하고, 워커 결과는 self-pipe로 깨워 전송
+ */
+class RecognitionServer {
+public:
+    RecognitionServer(const std::string& socketPath, int workers, const BatcherConfig& config,
+                      const std::vector<float>& mean, const std::vector<float>& scale);
+    ~RecognitionServer();
+
+    bool start(std::string* error = nullptr);
+    void stop();
+
+    const ServerStats& stats() const { return counters; }
+
+private:
+    struct Session {
+        int fd;
+        std::vector<uint8_t> inbox;   // 아직 완성되지 않은 요청 바이트
+        std::vector<uint8_t> outbox;  // 아직 보내지 못한 응답 바이트
+        int pending = 0;              // 배치 큐에 넣었지만 응답이 outbox로 오지 않은 프레임 수
+    };
+
+    // 응답 대기 프레임이 상한 미만이라 더 읽어도 되는지
+    bool canRead(const Session& session) const;
+
+    void ioLoop();
+    void workerLoop();
+    void acceptClients();
+    bool readSession(Session& session, uint32_t sessionId);
+    bool flushSession(Session& session);
+    void deliver(uint32_t sessionId, const ResultMessage& result);
+    void reject(Session& session, const FrameMessage& message);
+    void closeSession(uint32_t sessionId);
+
+    std::string path;
+    int workerCount;
+    std::vector<float> scalerMean;
+    std::vector<float> scalerScale;
+    int maxSessionFrames;
+
+    int listenFd = -1;
+    int wakePipe[2] = {-1, -1};
+    std::atomic<bool> running{false};
+    std::atomic<bool> wakePending{false};
+
+    DynamicBatcher batcher;
+    std::thread ioThread;
+    std::vector<std::thread> workers;
+
+    std::map<uint32_t, Session> sessions;  // I/O 스레드 전용
+    uint32_t nextSessionId = 1;
+
+    std::mutex resultMutex;  // 워커 → I/O 스레드 결과 전달
+    std::vector<std::pair<uint32_t, ResultMessage>> pendingResults;
+
+    ServerStats counters;
+};
+
+}  // namespace server
+
+#endif // RECOGNITION_SERVER_H
@@ -0,0 +1,300 @@
+#include "session_format.h"
+#include <immintrin.h>  // AVX2 (int8/int16 확장, int → float 변환)
+#include <algorithm>  // std::min, std::max, std::upper_bound
+#include <cmath>  // std::lrint
+#include <cstring>  // std::memcpy, std::memcmp
+#include <fcntl.h>  // open
+#include <sys/mman.h>  // mmap, madvise
+#include <sys/stat.h>  // fstat
+#include <unistd.h>  // ::close
+
+namespace {
+const char kMagic[4] = {'S', 'G', 'N', 'S'};
+
+inline void setError(std::string* error, const std::string& message) {
+    if (error) *error = message;
+}
+
+inline int16_t quantize(float v, float invStep) {
+    if (!(v == v)) return 0;  // NaN → 0
+    long q = std::lrint(v * invStep);
+    return static_cast<int16_t>(std::max(-32768L, std::min(q, 32767L)));
+}
+}  // namespace
+
+// ===================== SessionWriter =====================
+
+SessionWriter::~SessionWriter() {
+    if (file) close();
+}
+
+bool SessionWriter::open(const std::string& path, int handCount, int coordsPerLandmark, float frameRate,
+                         int keyframeInterval, float quantStep, std::string* error) {
+    if (file) close();
+    if (handCount < 1 || handCount > 2 || coordsPerLandmark < 2 || coordsPerLandmark > 3) {
+        setError(error, "unsupported hand count / coordinates per landmark");
+        return false;
+    }
+    if (!(quantStep > 0.0f) || frameRate <= 0.0f || keyframeInterval < 1) {
+        setError(error, "invalid frame rate, keyframe interval or quantization step");
+        return false;
+    }
+    file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        setError(error, "cannot create " + path);
+        return false;
+    }
+
+    header = SessionHeader{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = SESSION_VERSION;
+    header.handCount = static_cast<uint8_t>(handCount);
+    header.coordsPerLandmark = static_cast<uint8_t>(coordsPerLandmark);
+    header.frameRate = frameRate;
+    header.quantStep = quantStep;
+    header.keyframeInterval = static_cast<uint32_t>(keyframeInterval);
+    values = handCount * SESSION_LANDMARKS * coordsPerLandmark;
+    deltaCount = 0;
+    index.clear();
+
+    // 헤더 자리를 먼저 쓰고 close()에서 확정된 값으로 덮어씀
+    offset = sizeof(SessionHeader);
+    return std::fwrite(&header, sizeof(header), 1, file) == 1;
+}
+
+bool SessionWriter::addFrame(const float* frame, int label) {
+    if (!file || !frame) return false;
+    const float invStep = 1.0f / header.quantStep;
+    int16_t q[SESSION_MAX_VALUES];
+    for (int i = 0; i < values; i++) q[i] = quantize(frame[i], invStep);
+
+    // 주기 키프레임이 아니고 모든 차분이 int8에 들어가면 DELTA8
+    bool delta = header.frameCount % header.keyframeInterval != 0;
+    for (int i = 0; i < values && delta; i++) {
+        int d = q[i] - previous[i];
+        delta = d >= -128 && d <= 127;
+    }
+
+    uint8_t record[2 + 2 * SESSION_MAX_VALUES];
+    record[0] = delta ? SESSION_DELTA8 : SESSION_KEY;
+    record[1] = static_cast<uint8_t>(static_cast<int8_t>(std::max(-1, std::min(label, 127))));
+    size_t bytes = 2;
+    if (delta) {
+        for (int i = 0; i < values; i++) record[bytes++] = static_cast<uint8_t>(static_cast<int8_t>(q[i] - previous[i]));
+        deltaCount++;
+    } else {
+        std::memcpy(record + 2, q, values * sizeof(int16_t));  // 리틀 엔디언 호스트 가정
+        bytes += values * sizeof(int16_t);
+        index.push_back(SessionKeyframe{header.frameCount, 0, offset});
+    }
+    if (std::fwrite(record, 1, bytes, file) != bytes) return false;
+
+    std::memcpy(previous, q, values * sizeof(int16_t));
+    offset += bytes;
+    header.frameCount++;
+    return true;
+}
+
+bool SessionWriter::close(std::string* error) {
+    if (!file) return false;
+    // 인덱스는 mmap 후 바로 SessionKeyframe 배열로 읽도록 8바이트 경계에 둠
+    static const uint8_t zeros[alignof(SessionKeyframe)] = {};
+    size_t padding = (alignof(SessionKeyframe) - offset % alignof(SessionKeyframe)) % alignof(SessionKeyframe);
+    bool ok = std::fwrite(zeros, 1, padding, file) == padding;
+    header.keyframeCount = static_cast<uint32_t>(index.size());
+    header.indexOffset = offset + padding;
+    ok = ok && (index.empty() || std::fwrite(index.data(), sizeof(SessionKeyframe), index.size(), file) == index.size());
+    ok = ok && std::fseek(file, 0, SEEK_SET) == 0 && std::fwrite(&header, sizeof(header), 1, file) == 1;
+    ok = (std::fclose(file) == 0) && ok;
+    file = nullptr;
+    if (!ok) setError(error, "write failed");
+    return ok;
+}
+
+// ===================== SessionReader =====================
+
+SessionReader::~SessionReader() {
+    close();
+}
+
+void SessionReader::close() {
+    if (data) munmap(const_cast<uint8_t*>(data), size);
+    data = nullptr;
+    size = 0;
+    index = nullptr;
+    cursor = 0;
+    next = 0;
+}
+
+bool SessionReader::open(const std::string& path, std::string* error) {
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        setError(error, "cannot open " + path);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(SessionHeader)) {
+        ::close(fd);
+        setError(error, path + ": too small for a session header");
+        return false;
+    }
+    size = static_cast<size_t>(st.st_size);
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // 매핑은 fd를 닫아도 유지됨
+    if (mapped == MAP_FAILED) {
+        size = 0;
+        setError(error, "mmap failed for " + path);
+        return false;
+    }
+    data = static_cast<const uint8_t*>(mapped);
+    madvise(mapped, size, MADV_SEQUENTIAL);  // 재생은 앞에서 뒤로 읽으므로 미리 읽기 강화
+
+    std::memcpy(&header, data, sizeof(header));
+    values = header.handCount * SESSION_LANDMARKS * header.coordsPerLandmark;
+    bool valid = std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 && header.version == SESSION_VERSION &&
+                 header.handCount >= 1 && header.handCount <= 2 && header.coordsPerLandmark >= 2 &&
+                 header.coordsPerLandmark <= 3 && header.quantStep > 0.0f && header.indexOffset >= sizeof(header) &&
+                 header.indexOffset <= size &&  // 따로 비교해 indexOffset + 인덱스 크기가 넘쳐 통과하지 않도록
+                 header.keyframeCount <= (size - header.indexOffset) / sizeof(SessionKeyframe) &&
+                 (header.frameCount == 0 || header.keyframeCount > 0) && header.indexOffset % alignof(SessionKeyframe) == 0;
+    if (!valid) {
+        close();
+        setError(error, path + ": not a valid session file (version " + std::to_string(SESSION_VERSION) + ")");
+        return false;
+    }
+    index = reinterpret_cast<const SessionKeyframe*>(data + header.indexOffset);
+
+    // 키프레임 항목: 레코드 영역 [헤더 끝, indexOffset) 안의 오프셋, frame < frameCount, frame은 엄격히 증가
+    // (seek의 이진 탐색과 레코드 읽기가 이 전제에 기대므로 여기서 한 번 확인)
+    for (uint32_t k = 0; k < header.keyframeCount; k++) {
+        const SessionKeyframe& key = index[k];
+        if (key.offset < sizeof(SessionHeader) || key.offset >= header.indexOffset || key.frame >= header.frameCount ||
+            (k > 0 && key.frame <= index[k - 1].frame)) {
+            close();
+            setError(error, path + ": corrupt keyframe index (entry " + std::to_string(k) + ")");
+            return false;
+        }
+    }
+    cursor = sizeof(SessionHeader);
+    next = 0;
+    return true;
+}
+
+bool SessionReader::seek(uint32_t frame) {
+    if (!data || frame > header.frameCount) return false;
+    if (frame == header.frameCount) {
+        cursor = header.indexOffset;
+        next = frame;
+        return true;
+    }
+    // frame 이하의 마지막 키프레임
+    const SessionKeyframe* end = index + header.keyframeCount;
+    const SessionKeyframe* key = std::upper_bound(index, end, frame, [](uint32_t f, const SessionKeyframe& k) {
+        return f < k.frame;
+    });
+    if (key == index) return false;
+    --key;
+    cursor = key->offset;
+    next = key->frame;
+    while (next < frame) {
+        if (!decodeRecord(nullptr)) return false;
+    }
+    return true;
+}
+
+bool SessionReader::decodeRecord(int* label) {
+    if (next >= header.frameCount || cursor + 2 > header.indexOffset) return false;
+    const uint8_t* record = data + cursor;
+    const uint8_t* payload = record + 2;
+    if (record[0] == SESSION_KEY) {
+        size_t bytes = values * sizeof(int16_t);
+        if (cursor + 2 + bytes > header.indexOffset) return false;
+        std::memcpy(current, payload, bytes);
+        cursor += 2 + bytes;
+    } else if (record[0] == SESSION_DELTA8) {
+        if (cursor + 2 + values > header.indexOffset) return false;
+        // int8 차분 16개 → int16 확장 → 누적 (마지막 조각은 임시 버퍼로 복사해 레코드 밖을 읽지 않음)
+        for (int i = 0; i < values; i += 16) {
+            __m128i d8;
+            if (i + 16 <= values) {
+                d8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(payload + i));
+            } else {
+                alignas(16) int8_t tail[16] = {};
+                std::memcpy(tail, payload + i, values - i);
+                d8 = _mm_load_si128(reinterpret_cast<const __m128i*>(tail));
+            }
+            __m256i* acc = reinterpret_cast<__m256i*>(current + i);
+            _mm256_storeu_si256(acc, _mm256_add_epi16(_mm256_loadu_si256(acc), _mm256_cvtepi8_epi16(d8)));
+        }
+        cursor += 2 + values;
+    } else {
+        return false;
+    }
+    if (label) *label = static_cast<int8_t>(record[1]);
+    next++;
+    return true;
+}
+
+int SessionReader::decode(float* out, int maxFrames, int* labels) {
+    if (!data || !out) return 0;
+    const __m256 step = _mm256_set1_ps(header.quantStep);
+    const int full = values & ~7;
+    int count = 0;
+    for (; count < maxFrames; count++) {
+        if (!decodeRecord(labels ? labels + count : nullptr)) break;
+        // int16 8개 → int32 → float, 양자화 간격을 곱해 배치 버퍼에 바로 기록
+        float* dst = out + static_cast<size_t>(count) * values;
+        for (int i = 0; i < full; i += 8) {
+            __m128i q = _mm_load_si128(reinterpret_cast<const __m128i*>(current + i));
+            _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(q)), step));
+        }
+        for (int i = full; i < values; i++) dst[i] = current[i] * header.quantStep;
+    }
+    return count;
+}
+
+int SessionReader::decodeLandmarks2D(float* out, int maxFrames, int hand, int* labels) {
+    if (!data || !out) return 0;
+    const int coords = header.coordsPerLandmark;
+    const int handValues = SESSION_LANDMARKS * coords;
+    constexpr int OUT_VALUES = SESSION_LANDMARKS * 2;  // 42
+    constexpr int FULL = OUT_VALUES & ~7;              // 8개씩 40, 꼬리 2
+    const __m256 step = _mm256_set1_ps(header.quantStep);
+    // 출력 8개 = 랜드마크 4개의 (x, y) → 입력 int16 위치 {0, 1, c, c + 1, 2c, 2c + 1, 3c, 3c + 1}
+    const __m256i lanes = _mm256_setr_epi32(0, 1, coords, coords + 1, 2 * coords, 2 * coords + 1, 3 * coords, 3 * coords + 1);
+    int count = 0;
+    for (; count < maxFrames; count++) {
+        if (!decodeRecord(labels ? labels + count : nullptr)) break;
+        int selected = std::min(hand, header.handCount - 1);
+        if (hand < 0) {
+            // 두 번째 손 좌표가 하나라도 0이 아니면 그 손 (데이터셋/리플레이 하니스와 같은 규칙)
+            // 16개씩 OR (마지막 조각은 current 꼬리 패딩까지 읽지만 패딩은 항상 0)
+            __m256i any = _mm256_setzero_si256();
+            for (int i = handValues; i < header.handCount * handValues; i += 16) {
+                any = _mm256_or_si256(any, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(current + i)));
+            }
+            selected = _mm256_testz_si256(any, any) ? 0 : 1;
+        }
+        const int16_t* src = current + selected * handValues;
+        float* dst = out + static_cast<size_t>(count) * OUT_VALUES;
+        // int16 8개 → int32 → float, 양자화 간격을 곱해 배치 버퍼에 바로 기록 (decode와 같은 변환)
+        for (int i = 0; i < FULL; i += 8) {
+            const int16_t* block = src + (i / 2) * coords;  // 랜드마크 i/2부터
+            __m256i q;
+            if (coords == 2) {
+                q = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block)));
+            } else {
+                // xyz 간격에서 x, y만 모음: 32비트 gather 후 하위 16비트를 부호 확장 (상위 절반은 이웃 값 또는 패딩)
+                q = _mm256_i32gather_epi32(reinterpret_cast<const int*>(block), lanes, 2);
+                q = _mm256_srai_epi32(_mm256_slli_epi32(q, 16), 16);
+            }
+            _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_cvtepi32_ps(q), step));
+        }
+        for (int i = FULL / 2; i < SESSION_LANDMARKS; i++) {
+            dst[i * 2] = src[i * coords] * header.quantStep;
+            dst[i * 2 + 1] = src[i * coords + 1] * header.quantStep;
+        }
+    }
+    return count;
+}
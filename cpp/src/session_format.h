@@ -0,0 +1,132 @@
+#ifndef SESSION_FORMAT_H
+#define SESSION_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * 랜드마크 세션 녹화 형식 (.sgns) — 실제 카메라 세션을 저장해 실시간보다 빠르게 재생
+ *
+ * 파일 레이아웃 (리틀 엔디언):
+ *   [SessionHeader 40B] [프레임 레코드 ...] [키프레임 인덱스: SessionKeyframe x keyframeCount]
+ *
+ * - 좌표는 quantStep 단위 16비트 정수로 양자화 (q = round(v / quantStep), int16 범위로 포화)
+ * - 프레임 레코드: [type u8][label i8][payload]
+ *     KEY:    값마다 int16 절대값 (2N 바이트)
+ *     DELTA8: 값마다 직전 프레임 대비 int8 차분 (N 바이트) — 모든 차분이 int8에 들어갈 때만
+ *   N = handCount * 21 * coordsPerLandmark, 키프레임은 keyframeInterval마다 강제
+ * - 키프레임 인덱스로 임의 프레임 탐색 (가장 가까운 앞 키프레임부터 차분 누적)
+ * - 정수 누적이라 디코딩 오차는 양자화 오차(quantStep / 2)로 고정되고 드리프트가 없음
+ *
+ * 네이티브 도구 전용 (WASM 빌드 미포함), 실패 시 false + error (예외 미사용)
+ */
+
+struct SessionHeader {
+    char magic[4];              // "SGNS"
+    uint16_t version;           // SESSION_VERSION
+    uint8_t handCount;          // 1 또는 2 (2: 왼손 63 + 오른손 63, 데이터셋 특징 순서)
+    uint8_t coordsPerLandmark;  // 2 (x, y) 또는 3 (x, y, z)
+    float frameRate;            // 녹화 fps (실시간 배율 계산용)
+    float quantStep;            // 양자화 간격
+    uint32_t frameCount;
+    uint32_t keyframeInterval;
+    uint32_t keyframeCount;     // 인덱스 항목 수 (강제 키프레임 포함)
+    uint32_t reserved;
+    uint64_t indexOffset;       // 키프레임 인덱스 시작 바이트
+};
+static_assert(sizeof(SessionHeader) == 40, "SessionHeader must stay 40 bytes on disk");
+
+struct SessionKeyframe {
+    uint32_t frame;
+    uint32_t reserved;
+    uint64_t offset;  // 레코드 시작 바이트
+};
+static_assert(sizeof(SessionKeyframe) == 16, "SessionKeyframe must stay 16 bytes on disk");
+
+constexpr uint16_t SESSION_VERSION = 1;
+constexpr int SESSION_LANDMARKS = 21;
+constexpr int SESSION_MAX_VALUES = 2 * SESSION_LANDMARKS * 3;  // 126
+constexpr float SESSION_DEFAULT_STEP = 1.0f / 8192.0f;          // ±4.0 범위, 오차 ≤ 6.1e-5
+
+enum SessionRecordType : uint8_t {
+    SESSION_KEY = 0,
+    SESSION_DELTA8 = 1,
+};
+
+// 세션 기록기: open → addFrame 반복 → close (close에서 인덱스와 헤더 확정)
+class SessionWriter {
+public:
+    SessionWriter() {}
+    ~SessionWriter();
+
+    SessionWriter(const SessionWriter&) = delete;
+    SessionWriter& operator=(const SessionWriter&) = delete;
+
+    bool open(const std::string& path, int handCount, int coordsPerLandmark, float frameRate,
+              int keyframeInterval = 30, float quantStep = SESSION_DEFAULT_STEP, std::string* error = nullptr);
+
+    // values: valuesPerFrame()개 좌표, label: 정답 라벨 (-1: 없음)
+    bool addFrame(const float* values, int label = -1);
+    bool close(std::string* error = nullptr);
+
+    int valuesPerFrame() const { return values; }
+    uint32_t deltaFrames() const { return deltaCount; }  // DELTA8로 저장된 프레임 수
+
+private:
+    FILE* file = nullptr;
+    SessionHeader header{};
+    int values = 0;
+    uint64_t offset = 0;
+    uint32_t deltaCount = 0;
+    int16_t previous[SESSION_MAX_VALUES] = {};
+    std::vector<SessionKeyframe> index;
+};
+
+// 세션 재생기: 파일을 mmap하고 레코드를 SIMD로 정수 누적 → float 변환해 배치 버퍼에 직접 기록
+class SessionReader {
+public:
+    SessionReader() {}
+    ~SessionReader();
+
+    SessionReader(const SessionReader&) = delete;
+    SessionReader& operator=(const SessionReader&) = delete;
+
+    // 헤더와 키프레임 인덱스(오프셋 범위, frame < frameCount, frame 엄격 증가)를 검증한 뒤 mmap
+    bool open(const std::string& path, std::string* error = nullptr);
+    void close();
+
+    const SessionHeader& info() const { return header; }
+    int valuesPerFrame() const { return values; }
+    uint32_t frameCount() const { return header.frameCount; }
+    uint32_t position() const { return next; }  // 다음에 디코딩할 프레임
+    size_t fileBytes() const { return size; }
+
+    // frame 위치로 이동 (가장 가까운 앞 키프레임부터 누적), 범위 밖이면 false
+    bool seek(uint32_t frame);
+
+    // 다음 최대 maxFrames개 프레임을 out(행 우선, valuesPerFrame() 간격)에 디코딩, 디코딩한 수 반환
+    // labels가 있으면 프레임별 라벨 기록, 손상된 레코드를 만나면 거기서 멈춤
+    int decode(float* out, int maxFrames, int* labels = nullptr);
+
+    // SignRecognizer 스테이징/recognizeBatch 배치 형식(손 하나 21 x (x, y) = 42 floats)으로 디코딩
+    // hand: 0 = 첫 번째 손(왼손), 1 = 두 번째 손, -1 = 두 번째 손이 있으면 그 손, 없으면 첫 번째 손
+    // decode와 같은 SIMD 변환으로 x, y만 모아 기록 (decode 결과의 해당 손 x, y와 비트 단위로 같음)
+    int decodeLandmarks2D(float* out, int maxFrames, int hand = -1, int* labels = nullptr);
+
+private:
+    bool decodeRecord(int* label);  // 다음 레코드를 current에 누적
+
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    SessionHeader header{};
+    int values = 0;
+    const SessionKeyframe* index = nullptr;
+    uint64_t cursor = 0;  // 다음 레코드 바이트 위치
+    uint32_t next = 0;
+    alignas(32) int16_t current[SESSION_MAX_VALUES + 16] = {};  // 누적된 양자화 값 (SIMD 꼬리 패딩)
+};
+
+#endif // SESSION_FORMAT_H
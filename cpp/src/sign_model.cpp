@@ -0,0 +1,53 @@
+#include "sign_model.h"
+#include "half_float.h"  // floatToHalf (SIGN_WEIGHTS_FP16)
+#include <iostream>  // 생성 로그
+#include <mutex>  // 공유 모델 생성 동기화
+
+const int SignModel::layerSizes[SignModel::NUM_LAYERS + 1] = {210, 128, 64, 32, 5};
+
+namespace {
+#ifdef SIGN_WEIGHTS_FP16
+inline SignModel::Weight toWeight(float value) { return floatToHalf(value); }
+#else
+inline SignModel::Weight toWeight(float value) { return value; }
+#endif
+}
+
+std::shared_ptr<const SignModel> SignModel::shared() {
+    // 살아 있는 모델은 weak_ptr로 추적 → 모든 세션이 끝나면 해제되고 다음 세션에서 다시 생성
+    static std::mutex mutex;
+    static std::weak_ptr<const SignModel> cache;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::shared_ptr<const SignModel> model = cache.lock();
+    if (!model) {
+        model = std::shared_ptr<const SignModel>(new SignModel());
+        cache = model;
+    }
+    return model;
+}
+
+SignModel::SignModel() {
+    // 가상 신경망 가중치 초기화 (JavaScript와 완전히 동일한 고정값 사용)
+    std::cout << "🔧 C++ 가중치 생성 (고정값, 공유 모델)" << std::endl;  // 디버그 출력 (프로세스당 한 번)
+
+    const float fixedValue = 0.05f;  // JavaScript와 동일한 고정값 (가중치 초기화용)
+    const float fixedBias = 0.01f;  // JavaScript와 동일한 바이어스 (첫 번째 레이어만)
+
+    for (int layer = 0; layer < NUM_LAYERS; layer++) {
+        int in = layerSizes[layer];
+        int out = layerSizes[layer + 1];
+        weights[layer] = Tensor<Weight>(out, in, memory_accounting::MODEL);  // 패딩 영역은 0 (내적에 영향 없음)
+        weights[layer].fill(toWeight(fixedValue));
+    }
+    biases[0].assign(layerSizes[1], fixedBias);  // Layer 1 바이어스 (128개)
+}
+
+size_t SignModel::weightBytes() const {
+    size_t total = 0;
+    for (int layer = 0; layer < NUM_LAYERS; layer++) {
+        total += weights[layer].bytes();
+        total += biases[layer].size() * sizeof(float);
+    }
+    return total;
+}
@@ -0,0 +1,68 @@
+#ifndef SIGN_MODEL_H
+#define SIGN_MODEL_H
+
+#include "tensor.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * 공유 불변 모델 (SignRecognizer 신경망 가중치)
+ *
+ * - 이전에는 SignRecognizer::neuralWeights/neuralBiases 정적 가변 멤버를
+ *   initialize()마다 비우고 다시 채웠음 → 동시 초기화 시 경쟁, 세션마다 재생성 비용
+ * - 이제 가중치는 한 번만 생성되어 shared_ptr<const SignModel>로 모든 인스턴스가 공유
+ * - 인스턴스는 스크래치 버퍼와 임계값만 소유 (세션 수가 늘어도 모델 메모리는 1개)
+ *
+ * 네트워크 구조: 210 → 128 → 64 → 32 → 5 (첫 레이어만 바이어스 사용)
+ * 가중치 저장: 레이어마다 Tensor [out][in] (행 간격 64바이트 배수 패딩, 64바이트 정렬)
+ *            → 각 뉴런의 내적이 연속 메모리를 SIMD 정렬 로드로 읽음 (열 추출 복사 불필요)
+ * SIGN_WEIGHTS_FP16 빌드: 가중치를 half(uint16_t)로 저장 (바이트 절반), 내적 커널(dotHalf)에서 fp32로 확장
+ */
+class SignModel {
+public:
+    static constexpr int NUM_LAYERS = 4;
+    static constexpr int INPUT_SIZE = 210;
+    static constexpr int OUTPUT_SIZE = 5;
+    static constexpr int MAX_HIDDEN = 128;
+
+#ifdef SIGN_WEIGHTS_FP16
+    using Weight = uint16_t;  // IEEE half (half_float.h)
+#else
+    using Weight = float;
+#endif
+
+    // 공유 모델 획득 (살아 있는 인스턴스가 있으면 재사용, 없으면 한 번 생성)
+    // 여러 스레드에서 동시에 호출해도 안전
+    static std::shared_ptr<const SignModel> shared();
+
+    SignModel(const SignModel&) = delete;
+    SignModel& operator=(const SignModel&) = delete;
+
+    int inputSize(int layer) const { return layerSizes[layer]; }
+    int outputSize(int layer) const { return layerSizes[layer + 1]; }
+    int rowStride(int layer) const { return weights[layer].stride(); }  // 패딩 포함 행 간격 (원소 개수)
+
+    // 출력 뉴런 i의 가중치 행 (inputSize(layer)개 유효, 64바이트 정렬)
+    const Weight* weightRow(int layer, int i) const { return weights[layer].row(i); }
+
+    // 레이어 가중치 전체 뷰 (outputSize x inputSize)
+    TensorView<const Weight> layerWeights(int layer) const { return weights[layer].view(); }
+
+    // 레이어 바이어스 (바이어스가 없는 레이어는 nullptr)
+    const float* bias(int layer) const { return biases[layer].empty() ? nullptr : biases[layer].data(); }
+
+    // 모델 전체 가중치 바이트 수 (패딩 포함)
+    size_t weightBytes() const;
+
+private:
+    SignModel();
+
+    static const int layerSizes[NUM_LAYERS + 1];
+
+    Tensor<Weight> weights[NUM_LAYERS];
+    std::vector<float> biases[NUM_LAYERS];
+};
+
+#endif // SIGN_MODEL_H
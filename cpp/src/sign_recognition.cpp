@@ -2,48 +2,141 @@
 #include <cmath>  // 수학 함수 (sqrt, cos, sin, acos 등)
 #include <algorithm>  // 알고리즘 함수 (std::max, std::min, std::accumulate 등)
 #include <sstream>  // 문자열 스트림 (JSON 생성용)
+#include <numeric>  // std::accumulate (특징 정규화)
+#include <cstdlib>  // std::rand
+#include <chrono>  // steady_clock (recognizeScheduled 엔진 시간 측정)
+#include <immintrin.h>  // SIMD 인트린식 (__m256, _mm256_*)
+#include "half_float.h"  // dotHalf (FP16 가중치 확장 내적)
+#include "kernel_tuning.h"  // 블록/배치 크기 (autotuneKernels로 기기별 조정)
+#include "fast_math.h"  // SIMD acos/atan2/exp 근사 (각도, 회전, 소프트맥스)
+#ifdef SIGN_WEIGHTS_FP16
+#include "gesture_weights_f16.h"  // MLP 가중치 (W1, W2, W3: half / B1, B2, B3: float, make weights-f16로 생성)
+#else
 #include "gesture_weights.h"  // MLP 가중치 헤더 파일 (W1, W2, W3, B1, B2, B3 정의)
+#endif
 
 #ifndef M_PI  // M_PI가 정의되지 않았으면
 #define M_PI 3.14159265358979323846  // 원주율 상수 정의 (각도 변환에 사용)
 #endif
 
-// 정적 멤버 변수 초기화
-std::vector<std::vector<float>> SignRecognizer::neuralWeights;  // 신경망 가중치 행렬 (4개 레이어)
-std::vector<float> SignRecognizer::neuralBiases;  // 신경망 바이어스 벡터 (첫 번째 레이어용)
+// 제스처 이름 테이블 (ID 순서, 규칙 기반 인식의 OK(5)까지 포함)
+static const char* const kGestureNames[] = {"감지되지 않음", "안녕하세요", "감사합니다", "예", "V", "OK"};
 
-SignRecognizer::SignRecognizer()  // 생성자: 인식기 초기화
-    : detectionThreshold(0.5f), recognitionThreshold(0.7f) {  // 초기 임계값 설정 (감지: 0.5, 인식: 0.7)
-}
+// 두 손 SoA 좌표: 슬롯(손)마다 x/y/z 배열
+// 8개씩 읽는 AVX 로드가 20번 랜드마크 뒤를 넘어도 되도록 32칸 (여분은 0)
+struct SignRecognizer::HandLanes {
+    alignas(32) float x[2][32] = {};
+    alignas(32) float y[2][32] = {};
+    alignas(32) float z[2][32] = {};
+};
 
-SignRecognizer::~SignRecognizer() {  // 소멸자: 리소스 정리 (현재는 빈 구현)
+namespace {
+
+// 문자열 없는 판정 (제스처 이름이 SSO보다 길어 RecognitionResult를 만들 때마다 힙 할당
+// → 두 손 경로는 ID/신뢰도로 결정하고 결과 문자열은 마지막에 한 번만 만듦)
+struct HandDecision {
+    int id;
+    float confidence;
+};
+
+RecognitionResult toResult(HandDecision decision) {
+    return {kGestureNames[decision.id], decision.confidence, decision.id};
 }
 
-bool SignRecognizer::initialize() {  // 인식기 초기화 함수 (가중치 로드 등)
-    // 가상 신경망 가중치 초기화 (JavaScript와 완전히 동일한 고정값 사용)
-    std::cout << "🔧 C++ 가중치 생성 (고정값)" << std::endl;  // 디버그 출력
-    
-    const float fixedValue = 0.05f; // JavaScript와 동일한 고정값 (가중치 초기화용)
-    const float fixedBias = 0.01f;  // JavaScript와 동일한 바이어스 (바이어스 초기화용)
+// 규칙 판정 (classifyFingerPattern, ID는 kGestureNames 순서)
+HandDecision matchFingerPattern(const float* extended) {
+    bool thumbExtended = extended[0] != 0.0f;
+    bool indexExtended = extended[1] != 0.0f;
+    bool middleExtended = extended[2] != 0.0f;
+    bool ringExtended = extended[3] != 0.0f;
+    bool pinkyExtended = extended[4] != 0.0f;
     
-    // 네트워크 구조: 210 -> 128 -> 64 -> 32 -> 5 (입력 특징 수 -> 각 레이어 뉴런 수)
-    neuralWeights.clear();  // 기존 가중치 초기화
-    neuralBiases.clear();  // 기존 바이어스 초기화
+    int extendedFingers = 0;  // 펴진 손가락 개수 카운트
+    if (thumbExtended) extendedFingers++;  // 엄지가 펴져있으면 카운트
+    if (indexExtended) extendedFingers++;  // 검지가 펴져있으면 카운트
+    if (middleExtended) extendedFingers++;  // 중지가 펴져있으면 카운트
+    if (ringExtended) extendedFingers++;  // 약지가 펴져있으면 카운트
+    if (pinkyExtended) extendedFingers++;  // 소지가 펴져있으면 카운트
     
-    // Layer 1: 210 -> 128 (입력층 -> 첫 번째 은닉층)
-    neuralWeights.emplace_back(210 * 128, fixedValue);  // 26,880개 가중치 생성 (210 * 128)
-    neuralBiases.resize(128, fixedBias);  // 128개 바이어스 생성
+    // 규칙 기반 인식 (펴진 손가락 개수와 패턴으로 제스처 판단)
+    if (extendedFingers == 1 && indexExtended) {
+        // 검지만 펴져있음 -> "예"
+        return {3, 0.85f};  // 신뢰도 0.85, ID 3
+    } else if (extendedFingers == 5) {
+        // 모든 손가락이 펴져있음 -> "안녕하세요"
+        return {1, 0.80f};  // 신뢰도 0.80, ID 1
+    } else if (extendedFingers == 0) {
+        // 주먹 -> "감사합니다"
+        return {2, 0.75f};  // 신뢰도 0.75, ID 2
+    } else if (extendedFingers == 2 && indexExtended && middleExtended) {
+        // 검지와 중지만 펴져있음 -> "V" (추가 제스처)
+        return {4, 0.70f};  // 신뢰도 0.70, ID 4
+    } else if (extendedFingers == 3 && indexExtended && middleExtended && ringExtended) {
+        // 검지, 중지, 약지만 펴져있음 -> "OK" (추가 제스처)
+        return {5, 0.70f};  // 신뢰도 0.70, ID 5
+    }
     
-    // Layer 2: 128 -> 64 (첫 번째 은닉층 -> 두 번째 은닉층)
-    neuralWeights.emplace_back(128 * 64, fixedValue);  // 8,192개 가중치 생성 (128 * 64)
+    return {0, 0.0f};  // 매칭되는 규칙이 없으면 기본값 반환
+}
+
+// 신경망 출력 → argmax + 소프트맥스 신뢰도 (interpretScores)
+HandDecision scoreOutputs(const float* outputs, int count) {
+    if (count < 5) {  // 출력 개수 검증
+        return {0, 0.0f};  // 잘못된 출력 시 기본값 반환
+    }
     
-    // Layer 3: 64 -> 32 (두 번째 은닉층 -> 세 번째 은닉층)
-    neuralWeights.emplace_back(64 * 32, fixedValue);  // 2,048개 가중치 생성 (64 * 32)
+    // 최대값과 인덱스 찾기 (Argmax 연산)
+    int maxIdx = 0;  // 최대값 인덱스 초기화
+    float maxVal = outputs[0];  // 최대값 초기화
+    for (int i = 1; i < 5; i++) {  // 5개 클래스 중 최대값 찾기
+        if (outputs[i] > maxVal) {  // 현재 값이 최대값보다 크면
+            maxVal = outputs[i];  // 최대값 업데이트
+            maxIdx = i;  // 인덱스 업데이트
+        }
+    }
     
-    // Layer 4: 32 -> 5 (세 번째 은닉층 -> 출력층, 5개 제스처 클래스)
-    neuralWeights.emplace_back(32 * 5, fixedValue);  // 160개 가중치 생성 (32 * 5)
+    // 소프트맥스 정규화 (확률 분포로 변환): 최대값을 빼서 exp(0) = 1, 나머지 클래스는 한 번의 벡터 exp
+    float sum = 0.0f;  // 지수 합 초기화
+    alignas(32) float shifted[8];
+    for (int base = 0; base < count; base += 8) {  // 모든 출력값에 대해 (8개씩)
+        const int n = std::min(8, count - base);
+        for (int i = 0; i < n; i++) shifted[i] = outputs[base + i] - maxVal;
+        fast_math::exp(shifted, shifted, n);
+        for (int i = 0; i < n; i++) sum += shifted[i];
+    }
+    float confidence = 1.0f / sum;  // 최대값의 확률 (exp(maxVal - maxVal) / sum)
     
-    return true;  // 초기화 성공 반환
+    return {maxIdx, confidence};  // 제스처 ID (이름은 toResult가 kGestureNames로 매핑), 신뢰도
+}
+
+// 두 손 조합 (combineHands)
+HandDecision combineDecisions(HandDecision left, HandDecision right) {
+    if (left.id == 0) return right;  // 한 손만 감지 (둘 다 없으면 오른손의 "감지되지 않음")
+    if (right.id == 0) return left;
+    if (left.id == right.id) {  // 두 손이 같은 제스처 → 서로 독립인 판정이 일치하므로 신뢰도 상승
+        return {right.id, 1.0f - (1.0f - left.confidence) * (1.0f - right.confidence)};
+    }
+    return left.confidence > right.confidence ? left : right;
+}
+
+}  // namespace
+
+SignRecognizer::SignRecognizer()  // 생성자: 인식기 초기화
+    : detectionThreshold(0.5f), recognitionThreshold(0.7f),  // 초기 임계값 설정 (감지: 0.5, 인식: 0.7)
+      stagingInput(1, MAX_BATCH_FRAMES * FLOATS_PER_FRAME, memory_accounting::RECOGNIZER),  // 스테이징 버퍼: 인스턴스 수명 동안 한 번만 할당
+      stagingOutput(1, std::max(MAX_BATCH_FRAMES * RESULT_FLOATS_PER_FRAME, MAX_TWO_HAND_FRAMES * TWO_HAND_RESULT_FLOATS),
+                    memory_accounting::RECOGNIZER),  // (프레임마다 _malloc/_free 제거, 0으로 초기화)
+      stagingLandmarks(21),  // 21개 랜드마크 재사용 벡터
+      landmarkFilter(LandmarkFilter::OFF), filteredLandmarks(21), leftHandFilter(LandmarkFilter::OFF) {
+}
+
+SignRecognizer::~SignRecognizer() = default;  // 스테이징 버퍼는 Matrix가 해제
+
+bool SignRecognizer::initialize() {  // 인식기 초기화 함수 (공유 모델 획득)
+    // 가중치는 프로세스 전체에서 한 번만 생성되어 공유됨 (동시 초기화에도 안전)
+    kernel_tuning::applyEnvironmentProfile();  // SIGN_KERNEL_PROFILE이 있으면 튜닝 값 적용 (프로세스당 한 번)
+    model = SignModel::shared();  // 이미 생성된 모델이 있으면 참조만 증가
+    return model != nullptr;  // 초기화 성공 여부 반환
 }
 
 bool SignRecognizer::isFingerExtended(const HandLandmark& tip, const HandLandmark& pip, const HandLandmark& mcp) const {
@@ -73,16 +166,8 @@ float SignRecognizer::calculateAngle(const HandLandmark& a, const HandLandmark&
     float bcX = c.x - b.x;
     float bcY = c.y - b.y;
     
-    float dot = baX * bcX + baY * bcY;
-    float magBA = std::sqrt(baX * baX + baY * baY);
-    float magBC = std::sqrt(bcX * bcX + bcY * bcY);
-    
-    if (magBA == 0.0f || magBC == 0.0f) return 0.0f;
-    
-    float cosAngle = dot / (magBA * magBC);
-    cosAngle = std::max(-1.0f, std::min(1.0f, cosAngle)); // Clamp to [-1, 1]
-    
-    return std::acos(cosAngle) * 180.0f / M_PI; // Convert to degrees
+    // 길이가 0인 변은 cos = 1 → 0도, [-1, 1]로 고정 (배열 경로와 같은 근사라 결과 비트도 같음)
+    return fast_math::acosDegrees(fast_math::cosineBetween(baX, baY, bcX, bcY));
 }
 
 // 랜드마크 정규화 함수 (손목을 원점으로 이동)
@@ -109,6 +194,13 @@ RecognitionResult SignRecognizer::recognizeByRules(const std::vector<HandLandmar
         return {"감지되지 않음", 0.0f, 0};  // 잘못된 입력 시 기본값 반환
     }
     
+    float extended[5];
+    fingerExtensionFlags(landmarks, extended);
+    return classifyFingerPattern(extended);
+}
+
+// 손가락 펴짐 플래그 (엄지, 검지, 중지, 약지, 소지 순서, 1/0, FeatureRegistry의 FINGER_EXTENSION 블록과 같은 판정)
+void SignRecognizer::fingerExtensionFlags(const std::vector<HandLandmark>& landmarks, float* extended) const {
     // 손가락 끝 랜드마크 인덱스 (MediaPipe Hands 표준 인덱스)
     const HandLandmark& thumbTip = landmarks[4];  // 엄지 끝
     const HandLandmark& indexTip = landmarks[8];  // 검지 끝
@@ -124,42 +216,67 @@ RecognitionResult SignRecognizer::recognizeByRules(const std::vector<HandLandmar
     bool pinkyExtended = isFingerExtended(pinkyTip, landmarks[18], landmarks[17]);  // 소지
     bool thumbExtended = isThumbExtended(thumbTip, landmarks[3], wrist);  // 엄지 (X 좌표로 판단)
     
-    int extendedFingers = 0;  // 펴진 손가락 개수 카운트
-    if (thumbExtended) extendedFingers++;  // 엄지가 펴져있으면 카운트
-    if (indexExtended) extendedFingers++;  // 검지가 펴져있으면 카운트
-    if (middleExtended) extendedFingers++;  // 중지가 펴져있으면 카운트
-    if (ringExtended) extendedFingers++;  // 약지가 펴져있으면 카운트
-    if (pinkyExtended) extendedFingers++;  // 소지가 펴져있으면 카운트
-    
-    // 규칙 기반 인식 (펴진 손가락 개수와 패턴으로 제스처 판단)
-    if (extendedFingers == 1 && indexExtended) {
-        // 검지만 펴져있음 -> "예"
-        return {"예", 0.85f, 3};  // 신뢰도 0.85, ID 3
-    } else if (extendedFingers == 5) {
-        // 모든 손가락이 펴져있음 -> "안녕하세요"
-        return {"안녕하세요", 0.80f, 1};  // 신뢰도 0.80, ID 1
-    } else if (extendedFingers == 0) {
-        // 주먹 -> "감사합니다"
-        return {"감사합니다", 0.75f, 2};  // 신뢰도 0.75, ID 2
-    } else if (extendedFingers == 2 && indexExtended && middleExtended) {
-        // 검지와 중지만 펴져있음 -> "V" (추가 제스처)
-        return {"V", 0.70f, 4};  // 신뢰도 0.70, ID 4
-    } else if (extendedFingers == 3 && indexExtended && middleExtended && ringExtended) {
-        // 검지, 중지, 약지만 펴져있음 -> "OK" (추가 제스처)
-        return {"OK", 0.70f, 5};  // 신뢰도 0.70, ID 5
-    }
-    
-    return {"감지되지 않음", 0.0f, 0};  // 매칭되는 규칙이 없으면 기본값 반환
+    extended[0] = thumbExtended ? 1.0f : 0.0f;
+    extended[1] = indexExtended ? 1.0f : 0.0f;
+    extended[2] = middleExtended ? 1.0f : 0.0f;
+    extended[3] = ringExtended ? 1.0f : 0.0f;
+    extended[4] = pinkyExtended ? 1.0f : 0.0f;
+}
+
+// 펴진 손가락 패턴 → 제스처 (extended: 엄지, 검지, 중지, 약지, 소지 순서, 0이 아니면 펴짐)
+RecognitionResult SignRecognizer::classifyFingerPattern(const float* extended) {
+    return toResult(matchFingerPattern(extended));
 }
 
 // 메인 인식 함수 (하이브리드 방식: ML + 규칙 기반)
-RecognitionResult SignRecognizer::recognize(const std::vector<HandLandmark>& landmarks) {
-    if (landmarks.size() != 21) {  // 랜드마크 개수 검증
+RecognitionResult SignRecognizer::recognize(const std::vector<HandLandmark>& input) {
+    if (input.size() != 21) {  // 랜드마크 개수 검증
         return {"감지되지 않음", 0.0f, 0};  // 잘못된 입력 시 기본값 반환
     }
+    SIGN_PERF_SCOPE(stats, PerfStage::Recognize);  // recognize 전체 구간 계측
+    
+    return recognizeTier(applyLandmarkFilter(input), TIER_MLP);  // 신경망 + 규칙 폴백
+}
+
+RecognitionResult SignRecognizer::recognizeWithTier(const std::vector<HandLandmark>& input, int tier) {
+    if (input.size() != 21 || tier < 0 || tier >= TIER_COUNT) {
+        return {"감지되지 않음", 0.0f, 0};
+    }
+    return recognizeTier(applyLandmarkFilter(input), tier);
+}
+
+// 미리 계산된 특징으로 TIER_MLP와 같은 판정 (batch_features로 뽑은 특징 행렬을 프레임마다 추론할 때)
+RecognitionResult SignRecognizer::recognizeFromFeatures(const float* complexFeatures, int count, const float* extended) {
+    std::vector<float> outputs;
+    {
+        SIGN_PERF_SCOPE(stats, PerfStage::Inference);
+        outputs = neuralNetworkInference(complexFeatures, count);
+    }
+    RecognitionResult mlResult = interpretScores(outputs.data(), static_cast<int>(outputs.size()));
+    if (mlResult.confidence >= recognitionThreshold) {
+        return mlResult;
+    }
+    RecognitionResult ruleResult = classifyFingerPattern(extended);  // recognizeTier의 규칙 폴백과 같은 비교
+    return ruleResult.confidence > mlResult.confidence ? ruleResult : mlResult;
+}
+
+const std::vector<HandLandmark>& SignRecognizer::applyLandmarkFilter(const std::vector<HandLandmark>& input) {
+    // 지터 필터가 켜져 있으면 재사용 벡터에 복사 후 제자리 평활화 (할당 없음)
+    if (landmarkFilter.getMode() == LandmarkFilter::OFF) return input;
+    std::copy(input.begin(), input.end(), filteredLandmarks.begin());
+    landmarkFilter.filter(&filteredLandmarks[0].x, 21, 3);
+    return filteredLandmarks;
+}
+
+RecognitionResult SignRecognizer::recognizeTier(const std::vector<HandLandmark>& landmarks, int tier) {
+    if (tier == TIER_RULES) {
+        SIGN_PERF_SCOPE(stats, PerfStage::RuleFallback);
+        return recognizeByRules(landmarks);
+    }
     
     // 고급 ML 스타일 인식 사용 (더 복잡한 계산, 신경망 기반)
-    RecognitionResult mlResult = recognizeWithAdvancedML(landmarks);  // ML 인식 수행
+    RecognitionResult mlResult = tier == TIER_HEAVY ? recognizeWithHeavyNetwork(landmarks)
+                                                    : recognizeWithAdvancedML(landmarks);  // ML 인식 수행
     
     // ML 결과가 신뢰도가 높으면 반환 (임계값 이상)
     if (mlResult.confidence >= recognitionThreshold) {  // 신뢰도가 임계값 이상이면
@@ -167,7 +284,11 @@ RecognitionResult SignRecognizer::recognize(const std::vector<HandLandmark>& lan
     }
     
     // 규칙 기반 인식으로 폴백 (ML 신뢰도가 낮을 때)
-    RecognitionResult ruleResult = recognizeByRules(landmarks);  // 규칙 기반 인식 수행
+    RecognitionResult ruleResult;
+    {
+        SIGN_PERF_SCOPE(stats, PerfStage::RuleFallback);
+        ruleResult = recognizeByRules(landmarks);  // 규칙 기반 인식 수행
+    }
     
     // 더 높은 신뢰도를 가진 결과 반환 (ML vs 규칙 기반 비교)
     if (ruleResult.confidence > mlResult.confidence) {  // 규칙 기반이 더 높으면
@@ -177,112 +298,272 @@ RecognitionResult SignRecognizer::recognize(const std::vector<HandLandmark>& lan
     return mlResult;  // ML 결과 반환 (기본값)
 }
 
-// 고급 ML 스타일 인식 구현 (신경망 기반)
-RecognitionResult SignRecognizer::recognizeWithAdvancedML(const std::vector<HandLandmark>& landmarks) {
-    // 1. 복잡한 특징 추출 (210개 특징: 거리, 각도, 곡률 등)
-    std::vector<float> features = extractComplexFeatures(landmarks);  // 특징 벡터 추출
-    
-    // 2. 신경망 추론 (SIMD 최적화된 신경망)
-    std::vector<float> outputs = neuralNetworkInference(features);  // 신경망 출력 (5개 클래스 점수)
-    
-    // 3. 결과 해석
-    if (outputs.size() < 5) {  // 출력 개수 검증
-        return {"감지되지 않음", 0.0f, 0};  // 잘못된 출력 시 기본값 반환
+// ============================================================
+// 두 손 동시 인식
+// ============================================================
+// 두 번의 recognize 호출 대신 두 손 좌표를 HandLanes 한 벌에 모아 펴짐 판정, 특징 추출, 신경망을
+// 각각 한 패스로 처리 (손마다 결과는 recognize와 같고, 필터는 왼손 leftHandFilter / 오른손 landmarkFilter)
+TwoHandResult SignRecognizer::recognizeTwoHands(const std::vector<HandLandmark>& left, const std::vector<HandLandmark>& right) {
+    SIGN_PERF_SCOPE(stats, PerfStage::Recognize);
+    HandLanes lanes;
+    const bool present[2] = {left.size() == 21, right.size() == 21};
+    int slot = 0;
+    if (present[0]) packHand(lanes, slot++, &left[0].x, 3, leftHandFilter);
+    if (present[1]) packHand(lanes, slot++, &right[0].x, 3, landmarkFilter);
+    return recognizeHandLanes(lanes, present);
+}
+
+RecognitionResult SignRecognizer::combineHands(const RecognitionResult& left, const RecognitionResult& right) {
+    return toResult(combineDecisions({left.id, left.confidence}, {right.id, right.confidence}));
+}
+
+void SignRecognizer::packHand(HandLanes& lanes, int slot, const float* coords, int stride, LandmarkFilter& filter) {
+    float filtered[21 * 3];
+    if (filter.getMode() != LandmarkFilter::OFF) {  // applyLandmarkFilter와 같은 제자리 평활화 (사본)
+        std::copy(coords, coords + 21 * stride, filtered);
+        filter.filter(filtered, 21, stride);
+        coords = filtered;
     }
-    
-    // 최대값과 인덱스 찾기 (Argmax 연산)
-    int maxIdx = 0;  // 최대값 인덱스 초기화
-    float maxVal = outputs[0];  // 최대값 초기화
-    for (int i = 1; i < 5; i++) {  // 5개 클래스 중 최대값 찾기
-        if (outputs[i] > maxVal) {  // 현재 값이 최대값보다 크면
-            maxVal = outputs[i];  // 최대값 업데이트
-            maxIdx = i;  // 인덱스 업데이트
+    for (int i = 0; i < 21; i++) {
+        lanes.x[slot][i] = coords[i * stride];
+        lanes.y[slot][i] = coords[i * stride + 1];
+        lanes.z[slot][i] = stride >= 3 ? coords[i * stride + 2] : 0.0f;
+    }
+}
+
+// 감지된 손마다 recognizeTier(TIER_MLP)와 같은 판정 (신경망 → 신뢰도가 낮으면 규칙과 비교)
+TwoHandResult SignRecognizer::recognizeHandLanes(const HandLanes& lanes, const bool* present) {
+    const int hands = (present[0] ? 1 : 0) + (present[1] ? 1 : 0);
+    HandDecision decisions[2] = {{0, 0.0f}, {0, 0.0f}};
+    
+    alignas(32) float features[2][COMPLEX_FEATURES];
+    float extended[2][5];
+    float outputs[2][SignModel::OUTPUT_SIZE];
+    {
+        SIGN_PERF_SCOPE(stats, PerfStage::FeatureExtraction);
+        extractFeatureLanes(lanes, hands, features);
+        fingerStateLanes(lanes, hands, extended);
+    }
+    {
+        SIGN_PERF_SCOPE(stats, PerfStage::Inference);
+        if (hands == 2) {
+            neuralNetworkInferencePair(features[0], features[1], COMPLEX_FEATURES, outputs[0], outputs[1]);
+        } else if (hands == 1) {
+            std::vector<float> single = neuralNetworkInference(features[0], COMPLEX_FEATURES);
+            std::copy(single.begin(), single.end(), outputs[0]);
         }
     }
     
-    // 소프트맥스 정규화 (확률 분포로 변환)
-    float sum = 0.0f;  // 지수 합 초기화
-    for (float val : outputs) {  // 모든 출력값에 대해
-        sum += std::exp(val);  // 지수 함수 적용하여 합산
+    for (int hand = 0, slot = 0; hand < 2; hand++) {
+        if (!present[hand]) continue;
+        HandDecision ml = scoreOutputs(outputs[slot], SignModel::OUTPUT_SIZE);
+        decisions[hand] = ml;
+        if (ml.confidence < recognitionThreshold) {
+            SIGN_PERF_SCOPE(stats, PerfStage::RuleFallback);
+            HandDecision rule = matchFingerPattern(extended[slot]);
+            if (rule.confidence > ml.confidence) decisions[hand] = rule;
+        }
+        slot++;
+    }
+    return {toResult(decisions[0]), toResult(decisions[1]), toResult(combineDecisions(decisions[0], decisions[1]))};
+}
+
+// ============================================================
+// 시간 예산 기반 엔진 선택
+// ============================================================
+// 엔진 실행 구간만 재서 LatencyScheduler에 반영 (필터/입력 검증 비용은 엔진과 무관하므로 제외)
+RecognitionResult SignRecognizer::recognizeScheduled(const std::vector<HandLandmark>& input) {
+    if (input.size() != 21) {
+        return {"감지되지 않음", 0.0f, 0};
+    }
+    const std::vector<HandLandmark>& landmarks = applyLandmarkFilter(input);
+    
+    lastTier = scheduler.choose();
+    auto start = std::chrono::steady_clock::now();
+    RecognitionResult result = recognizeTier(landmarks, lastTier);
+    scheduler.record(lastTier, std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count());
+    return result;
+}
+
+void SignRecognizer::setLatencyBudget(float budgetMs) {
+    scheduler.setBudgetUs(budgetMs * 1000.0f);
+}
+
+bool SignRecognizer::setTierAccuracy(const float* accuracy, int count) {
+    if (!accuracy || count != TIER_COUNT) return false;
+    int order[TIER_COUNT] = {TIER_RULES, TIER_MLP, TIER_HEAVY};
+    // 정확도 오름차순, 같으면 비싼 단계가 아래
+    std::sort(order, order + TIER_COUNT, [accuracy](int a, int b) {
+        return accuracy[a] != accuracy[b] ? accuracy[a] < accuracy[b] : a > b;
+    });
+    return scheduler.setOrder(order, TIER_COUNT);
+}
+
+const double* SignRecognizer::getSchedulerSnapshot() {
+    return scheduler.snapshot();
+}
+
+// 고급 ML 스타일 인식 구현 (신경망 기반)
+RecognitionResult SignRecognizer::recognizeWithAdvancedML(const std::vector<HandLandmark>& landmarks) {
+    // 1. 복잡한 특징 추출 (256개: 거리, 각도, 곡률 등, 신경망은 앞 210개 쌍 거리를 읽음)
+    std::vector<float> features;
+    {
+        SIGN_PERF_SCOPE(stats, PerfStage::FeatureExtraction);
+        features = extractComplexFeatures(landmarks);  // 특징 벡터 추출
     }
-    float confidence = std::exp(maxVal) / sum;  // 최대값의 확률 계산 (소프트맥스)
-    
-    // 제스처 매핑 (인덱스를 제스처 이름으로 변환)
-    std::vector<std::string> gestures = {"감지되지 않음", "안녕하세요", "감사합니다", "예", "V"};  // 제스처 이름 배열
     
-    if (maxIdx < gestures.size()) {  // 인덱스가 유효하면
-        return {gestures[maxIdx], confidence, maxIdx};  // 제스처 이름, 신뢰도, ID 반환
+    // 2. 신경망 추론 (SIMD 최적화된 신경망)
+    std::vector<float> outputs;
+    {
+        SIGN_PERF_SCOPE(stats, PerfStage::Inference);
+        outputs = neuralNetworkInference(features);  // 신경망 출력 (5개 클래스 점수)
     }
     
-    return {"감지되지 않음", 0.0f, 0};  // 기본값 반환
+    // 3. 결과 해석
+    return interpretScores(outputs.data(), static_cast<int>(outputs.size()));
 }
 
-// 복잡한 특징 추출
-std::vector<float> SignRecognizer::extractComplexFeatures(const std::vector<HandLandmark>& landmarks) {
+// 대형 신경망 인식 (시간 예산이 넉넉할 때 recognizeScheduled가 선택)
+RecognitionResult SignRecognizer::recognizeWithHeavyNetwork(const std::vector<HandLandmark>& landmarks) {
     std::vector<float> features;
-    features.reserve(210); // 복잡한 특징들
-    
-    // 1. 모든 쌍의 거리 계산 (21 * 20 / 2 = 210개)
-    for (int i = 0; i < 21; i++) {
-        for (int j = i + 1; j < 21; j++) {
-            float dist = calculateDistance(landmarks[i], landmarks[j]);
-            features.push_back(dist);
-        }
+    {
+        SIGN_PERF_SCOPE(stats, PerfStage::FeatureExtraction);
+        features = extractAdvancedMatrixFeatures(landmarks);  // 1260개 특징
     }
-    
-    // 2. 각 포인트에서 손목까지의 거리
-    const HandLandmark& wrist = landmarks[0];
-    for (int i = 1; i < 21; i++) {
-        float dist = calculateDistance(landmarks[i], wrist);
-        features.push_back(dist);
+    std::vector<float> outputs;
+    {
+        SIGN_PERF_SCOPE(stats, PerfStage::Inference);
+        outputs = advancedMatrixNeuralNetwork(features);  // 5개 클래스 점수
     }
-    
-    // 3. 각 손가락의 각도 계산
-    std::vector<int> fingerTips = {4, 8, 12, 16, 20};
-    std::vector<int> fingerPips = {3, 6, 10, 14, 18};
-    std::vector<int> fingerMcps = {2, 5, 9, 13, 17};
-    
-    for (int i = 0; i < 5; i++) {
-        float angle = calculateAngle(landmarks[fingerTips[i]], 
-                                   landmarks[fingerPips[i]], 
-                                   landmarks[fingerMcps[i]]);
-        features.push_back(angle);
+    return interpretScores(outputs.data(), static_cast<int>(outputs.size()));
+}
+
+RecognitionResult SignRecognizer::interpretScores(const float* outputs, int count) const {
+    return toResult(scoreOutputs(outputs, count));
+}
+
+// 복잡한 특징 추출 (두 손 경로와 같은 커널을 한 슬롯으로 사용 → 두 경로의 특징이 비트 단위로 같음)
+std::vector<float> SignRecognizer::extractComplexFeatures(const std::vector<HandLandmark>& landmarks) {
+    if (landmarks.size() != 21) return {};
+    HandLanes lanes;
+    for (int i = 0; i < 21; i++) {
+        lanes.x[0][i] = landmarks[i].x;
+        lanes.y[0][i] = landmarks[i].y;
+        lanes.z[0][i] = landmarks[i].z;
     }
-    
-    // 4. 손바닥 방향 벡터
-    float palmX = 0, palmY = 0;
-    for (int i = 0; i < 5; i++) {
-        palmX += landmarks[i].x;
-        palmY += landmarks[i].y;
+    float features[1][COMPLEX_FEATURES];
+    extractFeatureLanes(lanes, 1, features);
+    return std::vector<float>(features[0], features[0] + COMPLEX_FEATURES);
+}
+
+// 특징 커널: 슬롯마다 COMPLEX_FEATURES개
+// [0, 210) 모든 쌍 거리, [210, 230) 손목 거리, [230, 235) 손가락 각도, [235, 237) 손바닥 중심, [237, 256) 곡률 → 표준화
+// 쌍 거리는 i행마다 j를 8개씩 AVX로 계산하고 두 손을 같은 반복에서 처리
+// (행 끝을 넘는 저장은 다음 행이나 뒤 블록이 덮어씀, 마지막 행도 216번까지라 버퍼 안)
+void SignRecognizer::extractFeatureLanes(const HandLanes& lanes, int hands, float (*features)[COMPLEX_FEATURES]) {
+    // 1. 모든 쌍의 거리 (21 * 20 / 2 = 210개)
+    for (int i = 0, row = 0; i < 20; row += 20 - i, i++) {
+        for (int h = 0; h < hands; h++) {
+            const __m256 xi = _mm256_set1_ps(lanes.x[h][i]);
+            const __m256 yi = _mm256_set1_ps(lanes.y[h][i]);
+            const __m256 zi = _mm256_set1_ps(lanes.z[h][i]);
+            float* out = features[h] + row;  // out[j - i - 1] = 거리(i, j)
+            for (int j = i + 1; j < 21; j += 8) {
+                __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(&lanes.x[h][j]), xi);
+                __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(&lanes.y[h][j]), yi);
+                __m256 dz = _mm256_sub_ps(_mm256_loadu_ps(&lanes.z[h][j]), zi);
+                __m256 squared = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz));
+                _mm256_storeu_ps(out + (j - i - 1), _mm256_sqrt_ps(squared));
+            }
+        }
     }
-    palmX /= 5; palmY /= 5;
-    features.push_back(palmX);
-    features.push_back(palmY);
     
-    // 5. 곡률 계산
-    for (int i = 1; i < 20; i++) {
-        float curvature = calculateAngle(landmarks[i-1], landmarks[i], landmarks[i+1]);
-        features.push_back(curvature);
-    }
+    // 3. 손가락 각도 5개 + 5. 곡률 19개: 손마다 코사인 레지스터 네 개 (calculateAngle과 같은 코사인/acos 커널)
+    // 곡률은 꼭짓점 i와 이웃 i - 1, i + 1이라 i = 1..24를 연속 로드 세 번으로 (슬롯이 32칸이라 20 이후 레인은 버림),
+    // 손가락 각도 5개는 레지스터에 바로 모음 (스칼라로 쓴 배열을 벡터로 다시 읽으면 저장-적재 전달이 막힘)
+    static const int fingerTips[5] = {4, 8, 12, 16, 20};
+    static const int fingerPips[5] = {3, 6, 10, 14, 18};
+    static const int fingerMcps[5] = {2, 5, 9, 13, 17};
     
-    // 특징 정규화
-    if (!features.empty()) {
-        float mean = std::accumulate(features.begin(), features.end(), 0.0f) / features.size();
+    for (int h = 0; h < hands; h++) {
+        float* f = features[h];
+        const float* x = lanes.x[h];
+        const float* y = lanes.y[h];
+        
+        // 2. 각 포인트에서 손목까지의 거리 (쌍 거리의 0번 행과 같음)
+        std::copy(f, f + 20, f + 210);
+        
+        // 3. 각 손가락의 각도 [230, 235), 5. 곡률 [237, 256): 서로 독립인 코사인 네 개를 먼저 구한 뒤 acos (지연 겹침)
+        auto fingerEdge = [](const float* v, const int* to) {  // 레인 k: v[to[k]] - v[pip k]
+            return _mm256_setr_ps(v[to[0]] - v[fingerPips[0]], v[to[1]] - v[fingerPips[1]], v[to[2]] - v[fingerPips[2]],
+                                  v[to[3]] - v[fingerPips[3]], v[to[4]] - v[fingerPips[4]], 0.0f, 0.0f, 0.0f);
+        };
+        __m256 cosines[4];
+        cosines[0] = fast_math::cosineBetween(fingerEdge(x, fingerTips), fingerEdge(y, fingerTips), fingerEdge(x, fingerMcps), fingerEdge(y, fingerMcps));
+        for (int i = 1, n = 1; i < 20; i += 8, n++) {  // 꼭짓점 i..i+7
+            const __m256 xi = _mm256_loadu_ps(x + i);
+            const __m256 yi = _mm256_loadu_ps(y + i);
+            cosines[n] = fast_math::cosineBetween(_mm256_sub_ps(_mm256_loadu_ps(x + i - 1), xi), _mm256_sub_ps(_mm256_loadu_ps(y + i - 1), yi),
+                                                  _mm256_sub_ps(_mm256_loadu_ps(x + i + 1), xi), _mm256_sub_ps(_mm256_loadu_ps(y + i + 1), yi));
+        }
+        alignas(32) float angles[32];
+        for (int n = 0; n < 4; n++) _mm256_store_ps(angles + n * 8, fast_math::acosDegrees(cosines[n]));
+        std::copy(angles, angles + 5, f + 230);
+        std::copy(angles + 8, angles + 8 + 19, f + 237);
+        
+        // 4. 손바닥 방향 벡터
+        float palmX = 0, palmY = 0;
+        for (int i = 0; i < 5; i++) {
+            palmX += lanes.x[h][i];
+            palmY += lanes.y[h][i];
+        }
+        f[235] = palmX / 5;
+        f[236] = palmY / 5;
+        
+        // 특징 정규화
+        float mean = std::accumulate(f, f + COMPLEX_FEATURES, 0.0f) / COMPLEX_FEATURES;
         float variance = 0.0f;
-        for (float f : features) {
-            variance += (f - mean) * (f - mean);
+        for (int i = 0; i < COMPLEX_FEATURES; i++) {
+            variance += (f[i] - mean) * (f[i] - mean);
         }
-        variance /= features.size();
+        variance /= COMPLEX_FEATURES;
         float stddev = std::sqrt(variance);
         
         if (stddev > 1e-6f) {
-            for (float& f : features) {
-                f = (f - mean) / stddev;
+            for (int i = 0; i < COMPLEX_FEATURES; i++) {
+                f[i] = (f[i] - mean) / stddev;
             }
         }
     }
+}
+
+// 손가락 펴짐 판정: 검지..소지 4개 x 두 손 = 8 lanes를 한 번에 비교 (tip.y < pip.y && pip.y < mcp.y)
+// 엄지는 손목과의 X 거리 비교 (isThumbExtended와 같은 식)
+void SignRecognizer::fingerStateLanes(const HandLanes& lanes, int hands, float (*extended)[5]) const {
+    static const int tips[4] = {8, 12, 16, 20};
+    static const int pips[4] = {6, 10, 14, 18};
+    static const int mcps[4] = {5, 9, 13, 17};
+    
+    alignas(32) float tipY[8] = {}, pipY[8] = {}, mcpY[8] = {};
+    for (int h = 0; h < hands; h++) {
+        for (int f = 0; f < 4; f++) {
+            tipY[h * 4 + f] = lanes.y[h][tips[f]];
+            pipY[h * 4 + f] = lanes.y[h][pips[f]];
+            mcpY[h * 4 + f] = lanes.y[h][mcps[f]];
+        }
+    }
+    const __m256 tip = _mm256_load_ps(tipY);
+    const __m256 pip = _mm256_load_ps(pipY);
+    const __m256 mcp = _mm256_load_ps(mcpY);
+    const int mask = _mm256_movemask_ps(_mm256_and_ps(_mm256_cmp_ps(tip, pip, _CMP_LT_OQ), _mm256_cmp_ps(pip, mcp, _CMP_LT_OQ)));
     
-    return features;
+    for (int h = 0; h < hands; h++) {
+        const float wristX = lanes.x[h][0];
+        extended[h][0] = std::abs(lanes.x[h][4] - wristX) > std::abs(lanes.x[h][3] - wristX) ? 1.0f : 0.0f;
+        for (int f = 0; f < 4; f++) {
+            extended[h][1 + f] = (mask >> (h * 4 + f)) & 1 ? 1.0f : 0.0f;
+        }
+    }
 }
 
 // ============================================================
@@ -290,54 +571,77 @@ std::vector<float> SignRecognizer::extractComplexFeatures(const std::vector<Hand
 // ============================================================
 // 각 레이어에서 SIMD 최적화된 벡터 내적을 사용하여 약 4-8배 빠른 성능
 // 네트워크 구조: 210 → 128 → 64 → 32 → 5
+// 입력은 특징 벡터의 앞 INPUT_SIZE개: extractComplexFeatures(COMPLEX_FEATURES개)의 [0, 210) 표준화된 쌍 거리 블록
+// (JavaScript 추론과 같은 210 특징, 나머지 손목 거리/각도/곡률은 규칙과 대형 신경망 쪽 특징)
+// 가중치는 공유 모델에 뉴런별 연속 행으로 저장되어 있어 열 추출 복사 없이 바로 내적
+// 은닉층 활성값은 인스턴스 스크래치(hiddenScratch)를 번갈아 사용 (레이어마다 할당 없음)
 std::vector<float> SignRecognizer::neuralNetworkInference(const std::vector<float>& features) {
-    if (neuralWeights.empty() || features.size() != 210) {  // 가중치 또는 특징 개수 검증
-        return std::vector<float>(5, 0.0f);  // 잘못된 입력 시 0 벡터 반환
-    }
-    
-    std::vector<float> layer1(128), layer2(64), layer3(32), output(5);  // 각 레이어 출력 벡터 생성
-    
-    // Layer 1: 210 -> 128 (SIMD 최적화)
-    for (int i = 0; i < 128; i++) {  // 첫 번째 은닉층의 각 뉴런 순회
-        // SIMD 최적화된 벡터 내적 사용 (가중치 열을 추출하여 벡터로 변환)
-        std::vector<float> weights_col(210);  // 가중치 열 벡터 생성
-        for (int j = 0; j < 210; j++) {  // 입력 특징 개수만큼 순회
-            weights_col[j] = neuralWeights[0][j * 128 + i];  // 가중치 행렬에서 열 추출 (행 우선 저장)
-        }
-        float sum = neuralBiases[i] + vectorDotProduct(features.data(), weights_col.data(), 210);  // 바이어스 + SIMD 내적
-        layer1[i] = std::max(0.0f, sum); // ReLU 활성화 함수 (음수는 0으로)
+    return neuralNetworkInference(features.data(), static_cast<int>(features.size()));
+}
+
+std::vector<float> SignRecognizer::neuralNetworkInference(const float* features, int count) {
+    if (!model || count < SignModel::INPUT_SIZE) {  // 모델 또는 특징 개수 검증
+        return std::vector<float>(SignModel::OUTPUT_SIZE, 0.0f);  // 잘못된 입력 시 0 벡터 반환
     }
     
-    // Layer 2: 128 -> 64 (SIMD 최적화)
-    for (int i = 0; i < 64; i++) {  // 두 번째 은닉층의 각 뉴런 순회
-        std::vector<float> weights_col(128);  // 가중치 열 벡터 생성
-        for (int j = 0; j < 128; j++) {  // 이전 레이어 뉴런 개수만큼 순회
-            weights_col[j] = neuralWeights[1][j * 64 + i];  // 가중치 열 추출
-        }
-        float sum = vectorDotProduct(layer1.data(), weights_col.data(), 128);  // SIMD 내적 (바이어스 없음)
-        layer2[i] = std::max(0.0f, sum); // ReLU 활성화 함수
-    }
+    std::vector<float> output(SignModel::OUTPUT_SIZE);  // 최종 출력 (5개 클래스 점수)
+    const float* input = features;  // 현재 레이어 입력
     
-    // Layer 3: 64 -> 32 (SIMD 최적화)
-    for (int i = 0; i < 32; i++) {  // 세 번째 은닉층의 각 뉴런 순회
-        std::vector<float> weights_col(64);  // 가중치 열 벡터 생성
-        for (int j = 0; j < 64; j++) {  // 이전 레이어 뉴런 개수만큼 순회
-            weights_col[j] = neuralWeights[2][j * 32 + i];  // 가중치 열 추출
+    for (int layer = 0; layer < SignModel::NUM_LAYERS; layer++) {  // 4개 레이어 순회
+        int in = model->inputSize(layer);  // 입력 뉴런 수
+        int out = model->outputSize(layer);  // 출력 뉴런 수
+        const float* bias = model->bias(layer);  // 바이어스 (첫 레이어만 존재)
+        bool isOutput = (layer == SignModel::NUM_LAYERS - 1);  // 출력층 여부
+        float* dst = isOutput ? output.data() : hiddenScratch.row(layer & 1);  // 스크래치 번갈아 사용
+        
+        for (int i = 0; i < out; i++) {  // 각 출력 뉴런 순회
+#ifdef SIGN_WEIGHTS_FP16
+            float sum = dotHalf(model->weightRow(layer, i), input, in);  // half 행을 레지스터에서 fp32로 확장
+#else
+            float sum = vectorDotProduct(input, model->weightRow(layer, i), in);  // SIMD 내적 (연속 행)
+#endif
+            if (bias) sum += bias[i];  // 바이어스 추가
+            dst[i] = isOutput ? sum : std::max(0.0f, sum);  // 은닉층은 ReLU, 출력층은 Linear
         }
-        float sum = vectorDotProduct(layer2.data(), weights_col.data(), 64);  // SIMD 내적
-        layer3[i] = std::max(0.0f, sum); // ReLU 활성화 함수
+        input = dst;  // 다음 레이어 입력
     }
     
-    // Layer 4: 32 -> 5 (SIMD 최적화 output)
-    for (int i = 0; i < 5; i++) {  // 출력층의 각 클래스 순회
-        std::vector<float> weights_col(32);  // 가중치 열 벡터 생성
-        for (int j = 0; j < 32; j++) {  // 이전 레이어 뉴런 개수만큼 순회
-            weights_col[j] = neuralWeights[3][j * 5 + i];  // 가중치 열 추출
+    return output;  // 최종 출력 벡터 반환 (5개 클래스 점수)
+}
+
+// 두 손 추론: 각 가중치 행을 한 번 읽어 두 입력과 내적 (레이어 순서/누적 순서는 neuralNetworkInference와 같음)
+void SignRecognizer::neuralNetworkInferencePair(const float* first, const float* second, int count, float* firstOut, float* secondOut) {
+    if (!model || count < SignModel::INPUT_SIZE) {  // neuralNetworkInference와 같은 검증
+        std::fill(firstOut, firstOut + SignModel::OUTPUT_SIZE, 0.0f);
+        std::fill(secondOut, secondOut + SignModel::OUTPUT_SIZE, 0.0f);
+        return;
+    }
+    
+    const float* input[2] = {first, second};
+    for (int layer = 0; layer < SignModel::NUM_LAYERS; layer++) {
+        int in = model->inputSize(layer);
+        int out = model->outputSize(layer);
+        const float* bias = model->bias(layer);
+        bool isOutput = (layer == SignModel::NUM_LAYERS - 1);
+        float* dst[2] = {isOutput ? firstOut : hiddenScratch.row(layer & 1),  // 손마다 스크래치 2행
+                         isOutput ? secondOut : hiddenScratch.row(2 + (layer & 1))};
+        
+        for (int i = 0; i < out; i++) {
+            float sum[2];
+#ifdef SIGN_WEIGHTS_FP16
+            sum[0] = dotHalf(model->weightRow(layer, i), input[0], in);
+            sum[1] = dotHalf(model->weightRow(layer, i), input[1], in);
+#else
+            vectorDotProductPair(input[0], input[1], model->weightRow(layer, i), in, &sum[0], &sum[1]);
+#endif
+            for (int h = 0; h < 2; h++) {
+                if (bias) sum[h] += bias[i];
+                dst[h][i] = isOutput ? sum[h] : std::max(0.0f, sum[h]);
+            }
         }
-        output[i] = vectorDotProduct(layer3.data(), weights_col.data(), 32); // Linear output (활성화 함수 없음)
+        input[0] = dst[0];
+        input[1] = dst[1];
     }
-    
-    return output;  // 최종 출력 벡터 반환 (5개 클래스 점수)
 }
 
 // ============================================================
@@ -345,6 +649,8 @@ std::vector<float> SignRecognizer::neuralNetworkInference(const std::vector<floa
 // ============================================================
 // SIMD (Single Instruction Multiple Data)를 사용하여 8개 float를 동시에 처리
 // 일반적인 스칼라 연산 대비 약 4-8배 빠른 성능 제공
+// 호출자 포인터(std::vector 데이터, wasm 힙, 텐서 행)는 32바이트 정렬이 보장되지 않으므로 비정렬 로드/저장 사용
+// (정렬된 주소에서는 정렬 로드와 같은 속도, Tensor 행은 항상 64바이트 정렬)
 float SignRecognizer::vectorDotProduct(const float* a, const float* b, int size) {
     float result = 0.0f;  // 최종 결과값 초기화
     int simd_size = size & ~7; // 8의 배수로 맞춤 (SIMD 연산을 위해 8로 나눈 나머지 제거)
@@ -352,14 +658,14 @@ float SignRecognizer::vectorDotProduct(const float* a, const float* b, int size)
     // SIMD 연산 (8개씩 처리) - AVX2 명령어 사용
     __m256 sum_vec = _mm256_setzero_ps();  // 8개 float를 0으로 초기화한 벡터 생성
     for (int i = 0; i < simd_size; i += 8) {  // 8개씩 묶어서 처리
-        __m256 a_vec = _mm256_load_ps(&a[i]);  // 메모리에서 8개 float 로드 (a 벡터)
-        __m256 b_vec = _mm256_load_ps(&b[i]);  // 메모리에서 8개 float 로드 (b 벡터)
+        __m256 a_vec = _mm256_loadu_ps(&a[i]);  // 메모리에서 8개 float 로드 (a 벡터)
+        __m256 b_vec = _mm256_loadu_ps(&b[i]);  // 메모리에서 8개 float 로드 (b 벡터)
         __m256 mul_vec = _mm256_mul_ps(a_vec, b_vec);  // 8개 곱셈을 동시에 수행 (a[i] * b[i] for i=0..7)
         sum_vec = _mm256_add_ps(sum_vec, mul_vec);  // 누적 합산 (8개 덧셈 동시 수행)
     }
     
     // 결과 합산 (SIMD 벡터를 스칼라로 변환)
-    float temp[8];  // 임시 배열 (8개 float)
+    alignas(32) float temp[8];  // 임시 배열 (8개 float, 정렬 저장 대상)
     _mm256_store_ps(temp, sum_vec);  // SIMD 벡터를 메모리에 저장
     for (int i = 0; i < 8; i++) {  // 8개 값을 스칼라로 합산
         result += temp[i];
@@ -373,15 +679,43 @@ float SignRecognizer::vectorDotProduct(const float* a, const float* b, int size)
     return result;  // 최종 내적 결과 반환
 }
 
+// b(가중치 행)를 한 번 로드해 a0, a1과 각각 내적 (각 결과는 vectorDotProduct와 같은 누적 순서)
+void SignRecognizer::vectorDotProductPair(const float* a0, const float* a1, const float* b, int size, float* r0, float* r1) {
+    int simd_size = size & ~7;
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    for (int i = 0; i < simd_size; i += 8) {
+        __m256 b_vec = _mm256_loadu_ps(&b[i]);
+        sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(_mm256_loadu_ps(&a0[i]), b_vec));
+        sum1 = _mm256_add_ps(sum1, _mm256_mul_ps(_mm256_loadu_ps(&a1[i]), b_vec));
+    }
+    
+    alignas(32) float temp0[8];
+    alignas(32) float temp1[8];
+    _mm256_store_ps(temp0, sum0);
+    _mm256_store_ps(temp1, sum1);
+    float result0 = 0.0f, result1 = 0.0f;
+    for (int i = 0; i < 8; i++) {
+        result0 += temp0[i];
+        result1 += temp1[i];
+    }
+    for (int i = simd_size; i < size; i++) {
+        result0 += a0[i] * b[i];
+        result1 += a1[i] * b[i];
+    }
+    *r0 = result0;
+    *r1 = result1;
+}
+
 // 🚀 WASM 최적화: SIMD 벡터 덧셈 (8개씩 동시 처리)
 void SignRecognizer::vectorAdd(const float* a, const float* b, float* result, int size) {
     int simd_size = size & ~7;  // 8의 배수로 맞춤 (SIMD 연산을 위해)
     
     for (int i = 0; i < simd_size; i += 8) {  // 8개씩 묶어서 처리
-        __m256 a_vec = _mm256_load_ps(&a[i]);  // a 벡터에서 8개 float 로드
-        __m256 b_vec = _mm256_load_ps(&b[i]);  // b 벡터에서 8개 float 로드
+        __m256 a_vec = _mm256_loadu_ps(&a[i]);  // a 벡터에서 8개 float 로드
+        __m256 b_vec = _mm256_loadu_ps(&b[i]);  // b 벡터에서 8개 float 로드
         __m256 result_vec = _mm256_add_ps(a_vec, b_vec);  // 8개 덧셈을 동시에 수행
-        _mm256_store_ps(&result[i], result_vec);  // 결과를 메모리에 저장
+        _mm256_storeu_ps(&result[i], result_vec);  // 결과를 메모리에 저장
     }
     
     for (int i = simd_size; i < size; i++) {  // 나머지 요소 처리
@@ -395,9 +729,9 @@ void SignRecognizer::vectorMultiply(const float* a, float scalar, float* result,
     __m256 scalar_vec = _mm256_set1_ps(scalar);  // 스칼라 값을 8개 복제하여 벡터 생성
     
     for (int i = 0; i < simd_size; i += 8) {  // 8개씩 묶어서 처리
-        __m256 a_vec = _mm256_load_ps(&a[i]);  // a 벡터에서 8개 float 로드
+        __m256 a_vec = _mm256_loadu_ps(&a[i]);  // a 벡터에서 8개 float 로드
         __m256 result_vec = _mm256_mul_ps(a_vec, scalar_vec);  // 8개 곱셈을 동시에 수행
-        _mm256_store_ps(&result[i], result_vec);  // 결과를 메모리에 저장
+        _mm256_storeu_ps(&result[i], result_vec);  // 결과를 메모리에 저장
     }
     
     for (int i = simd_size; i < size; i++) {  // 나머지 요소 처리
@@ -410,26 +744,27 @@ void SignRecognizer::vectorMultiply(const float* a, float scalar, float* result,
 // ============================================================
 // 블록 단위 처리로 CPU 캐시 효율성 향상 (일반 행렬 곱셈 대비 2-3배 빠름)
 // 작은 블록으로 나누어 처리하여 캐시 미스 최소화
-void SignRecognizer::matrixMultiply(const std::vector<std::vector<float>>& A, 
-                                   const std::vector<float>& B, 
-                                   std::vector<float>& result) {
-    int rows = A.size();  // 행렬 A의 행 개수
-    int cols = B.size();  // 벡터 B의 크기 (행렬 A의 열 개수와 동일해야 함)
+// A는 연속 버퍼 뷰 (행 간격 A.stride()), B는 A.cols()개, result는 A.rows()개
+void SignRecognizer::matrixMultiply(MatrixView A, const float* B, float* result) {
+    int rows = A.rows();  // 행렬 A의 행 개수
+    int cols = A.cols();  // 행렬 A의 열 개수 (벡터 B의 크기)
     
-    result.resize(rows);  // 결과 벡터 크기 설정
-    std::fill(result.begin(), result.end(), 0.0f);  // 결과 벡터를 0으로 초기화
+    std::fill(result, result + rows, 0.0f);  // 결과 벡터를 0으로 초기화
     
     // 캐시 친화적 행렬 곱셈 (블록 단위 처리)
-    const int BLOCK_SIZE = 32;  // 블록 크기 (32x32, CPU 캐시 라인 크기에 최적화)
+    const int BLOCK_SIZE = kernel_tuning::get(kernel_tuning::MATVEC_BLOCK);  // 블록 크기 (기본 32x32, 기기별 튜닝 값)
     for (int ii = 0; ii < rows; ii += BLOCK_SIZE) {  // 행 블록 단위로 순회
         for (int jj = 0; jj < cols; jj += BLOCK_SIZE) {  // 열 블록 단위로 순회
             int i_end = std::min(ii + BLOCK_SIZE, rows);  // 현재 블록의 행 끝 인덱스
             int j_end = std::min(jj + BLOCK_SIZE, cols);  // 현재 블록의 열 끝 인덱스
             
             for (int i = ii; i < i_end; i++) {  // 블록 내 행 순회
+                const float* a = A.row(i);  // 연속 행 (행 사이 포인터 추적 없음)
+                float sum = result[i];
                 for (int j = jj; j < j_end; j++) {  // 블록 내 열 순회
-                    result[i] += A[i][j] * B[j];  // 행렬 곱셈 누적 (result[i] = Σ(A[i][j] * B[j]))
+                    sum += a[j] * B[j];  // 행렬 곱셈 누적 (result[i] = Σ(A[i][j] * B[j]))
                 }
+                result[i] = sum;
             }
         }
     }
@@ -452,16 +787,12 @@ void SignRecognizer::fastConvolution(const std::vector<float>& input,  // 입력
                                     const std::vector<float>& kernel,  // 컨볼루션 커널 (필터 마스크)
                                     std::vector<float>& output,  // 출력 결과
                                     int inputSize, int kernelSize) {  // 입력 크기, 커널 크기
-    int outputSize = inputSize - kernelSize + 1;  // 출력 크기 계산 (입력 크기 - 커널 크기 + 1)
+    inputSize = std::min(inputSize, static_cast<int>(input.size()));  // 벡터 밖을 읽지 않도록 제한
+    kernelSize = std::min(kernelSize, static_cast<int>(kernel.size()));
+    int outputSize = ConvolutionEngine::outputLength(inputSize, kernelSize);  // 입력 크기 - 커널 크기 + 1
     output.resize(outputSize);  // 출력 벡터 크기 설정
-    
-    for (int i = 0; i < outputSize; i++) {  // 각 출력 위치에 대해
-        float sum = 0.0f;  // 누적 합 초기화
-        for (int k = 0; k < kernelSize; k++) {  // 커널의 각 요소에 대해
-            sum += input[i + k] * kernel[k];  // 입력과 커널을 곱하여 누적 (슬라이딩 윈도우)
-        }
-        output[i] = sum;  // 결과 저장
-    }
+    if (outputSize == 0 || !convolution.setKernel(kernel.data(), kernelSize)) return;
+    convolution.convolve(input.data(), inputSize, output.data());  // DIRECT/FFT 자동 선택
 }
 
 // ============================================================
@@ -489,6 +820,7 @@ std::string SignRecognizer::recognizeFromPointer(float* landmarks, int count) {
     RecognitionResult result = recognize(landmarkVec);  // 인식 수행
     
     // JSON 형식으로 반환 (JavaScript에서 파싱하기 쉬운 형식)
+    SIGN_PERF_SCOPE(stats, PerfStage::Serialization);
     std::ostringstream json;  // 문자열 스트림 생성
     json << "{\"gesture\":\"" << result.gesture  // 제스처 이름
          << "\",\"confidence\":" << result.confidence  // 신뢰도
@@ -497,6 +829,22 @@ std::string SignRecognizer::recognizeFromPointer(float* landmarks, int count) {
     return json.str();  // JSON 문자열 반환
 }
 
+void SignRecognizer::setLandmarkFilter(int mode) {
+    if (mode < LandmarkFilter::OFF || mode > LandmarkFilter::KALMAN) mode = LandmarkFilter::OFF;  // 알 수 없는 값은 끄기
+    landmarkFilter.setMode(static_cast<LandmarkFilter::Mode>(mode));
+    leftHandFilter.setMode(static_cast<LandmarkFilter::Mode>(mode));
+}
+
+void SignRecognizer::setFilterFrameRate(float fps) {
+    landmarkFilter.setNominalFrameRate(fps);
+    leftHandFilter.setNominalFrameRate(fps);
+}
+
+void SignRecognizer::resetLandmarkFilter() {
+    landmarkFilter.reset();
+    leftHandFilter.reset();
+}
+
 void SignRecognizer::setDetectionThreshold(float threshold) {
     detectionThreshold = threshold;
 }
@@ -509,6 +857,144 @@ std::string SignRecognizer::getVersion() const {
     return "1.0.0";
 }
 
+float* SignRecognizer::getInputBuffer() {
+    return stagingInput.data();
+}
+
+float* SignRecognizer::getOutputBuffer() {
+    return stagingOutput.data();
+}
+
+std::string SignRecognizer::getGestureName(int id) {
+    if (id < 0 || id >= static_cast<int>(sizeof(kGestureNames) / sizeof(kGestureNames[0]))) {
+        return kGestureNames[0];
+    }
+    return kGestureNames[id];
+}
+
+// ============================================================
+// 🚀 WASM 최적화: 고정 스테이징 버퍼 인식
+// ============================================================
+// JavaScript가 getInputBuffer() 주소에 한 번 만든 Float32Array 뷰로 좌표를 쓰고 호출
+// 프레임마다 _malloc/_free, 힙 뷰 재생성, JSON 직렬화/파싱이 모두 사라짐
+int SignRecognizer::recognizeStaged(int frameCount) {
+    if (stagingInput.empty() || stagingOutput.empty()) return 0;  // 할당 실패 시 처리 불가
+    frameCount = std::max(0, std::min(frameCount, MAX_BATCH_FRAMES));  // 버퍼 범위로 제한
+    
+    // 연속 배치된 프레임을 [frameCount][FLOATS_PER_FRAME] 뷰로 읽음 (복사 없음)
+    TensorView<const float> frames(stagingInput.data(), frameCount, FLOATS_PER_FRAME);
+    TensorView<float> results(stagingOutput.data(), frameCount, RESULT_FLOATS_PER_FRAME);
+    for (int frame = 0; frame < frameCount; frame++) {  // 각 프레임 순회
+        const float* frameData = frames.row(frame);  // 현재 프레임 입력
+        for (int i = 0; i < 21; i++) {  // 재사용 벡터에 좌표 복사 (할당 없음)
+            stagingLandmarks[i].x = frameData[i * 2];
+            stagingLandmarks[i].y = frameData[i * 2 + 1];
+            stagingLandmarks[i].z = 0.0f;
+        }
+        
+        RecognitionResult result = recognize(stagingLandmarks);  // 인식 수행
+        
+        float* out = results.row(frame);  // 현재 프레임 출력 위치
+        out[0] = static_cast<float>(result.id);  // 제스처 ID
+        out[1] = result.confidence;  // 신뢰도
+    }
+    
+    return frameCount;  // 처리한 프레임 수
+}
+
+// 두 손 스테이징 인식 (프레임마다 왼손 42 + 오른손 42 floats, 결과 [id, confidence] x 3)
+int SignRecognizer::recognizeStagedTwoHands(int frameCount) {
+    if (stagingInput.empty() || stagingOutput.empty()) return 0;
+    frameCount = std::max(0, std::min(frameCount, MAX_TWO_HAND_FRAMES));
+    
+    TensorView<const float> frames(stagingInput.data(), frameCount, TWO_HAND_FLOATS_PER_FRAME);
+    TensorView<float> results(stagingOutput.data(), frameCount, TWO_HAND_RESULT_FLOATS);
+    for (int frame = 0; frame < frameCount; frame++) {
+        SIGN_PERF_SCOPE(stats, PerfStage::Recognize);
+        const float* hands[2] = {frames.row(frame), frames.row(frame) + FLOATS_PER_FRAME};
+        HandLanes lanes;
+        bool present[2];
+        int slot = 0;
+        for (int h = 0; h < 2; h++) {
+            present[h] = std::any_of(hands[h], hands[h] + FLOATS_PER_FRAME, [](float v) { return v != 0.0f; });
+            if (present[h]) packHand(lanes, slot++, hands[h], 2, h == 0 ? leftHandFilter : landmarkFilter);
+        }
+        TwoHandResult result = recognizeHandLanes(lanes, present);
+        
+        float* out = results.row(frame);
+        const RecognitionResult* parts[3] = {&result.left, &result.right, &result.combined};
+        for (int i = 0; i < 3; i++) {
+            out[i * 2] = static_cast<float>(parts[i]->id);
+            out[i * 2 + 1] = parts[i]->confidence;
+        }
+    }
+    return frameCount;
+}
+
+// ============================================================
+// 커널 자동 튜닝 (코어 모듈 몫: 행렬-벡터 블록, MLP 배치 묶음)
+// ============================================================
+// recognizeStaged 배치 크기는 JavaScript → wasm 호출 비용이 대부분이라 네이티브 쪽에서 재지 않음
+// (JavaScript가 프레임이 쌓인 만큼 넘김)
+int SignRecognizer::autotuneKernelStep(int step, int repeats, kernel_tuning::Sweep* sweeps) {
+    uint32_t seed = 12345;  // 재현 가능한 합성 입력 (LCG)
+    auto next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 8) / 16777216.0f;  // [0, 1)
+    };
+    
+    if (step == 0) {
+        struct Workload {
+            SignRecognizer scratch;  // 임시 인식기 (호출한 인식기 상태는 건드리지 않음)
+            Matrix matrix;  // 대형 신경망 한 레이어 크기 (256 x 1260)
+            std::vector<float> vector;
+            std::vector<float> product;
+        } work;
+        work.matrix.reset(256, 1260);
+        for (int i = 0; i < work.matrix.rows(); i++) {
+            for (int j = 0; j < work.matrix.cols(); j++) work.matrix(i, j) = next() - 0.5f;
+        }
+        work.vector.resize(1260);
+        work.product.resize(256);
+        for (float& v : work.vector) v = next() - 0.5f;
+        return kernel_tuning::autotune(kernel_tuning::MATVEC_BLOCK, [](void* c) {
+            Workload* w = static_cast<Workload*>(c);
+            w->scratch.matrixMultiply(w->matrix, w->vector.data(), w->product.data());
+        }, &work, repeats, sweeps ? sweeps + kernel_tuning::MATVEC_BLOCK : nullptr);
+    }
+    
+    if (step == 1) {
+        struct Workload {
+            SignRecognition mlp;
+            std::vector<float> features;  // 256 프레임 x 126
+            std::vector<int> classes;
+        } work;
+        const int frames = 256;
+        work.features.resize(static_cast<size_t>(frames) * SignRecognition::featureDim());
+        for (float& v : work.features) v = next();
+        work.classes.resize(frames);
+        return kernel_tuning::autotune(kernel_tuning::MLP_BATCH, [](void* c) {
+            Workload* w = static_cast<Workload*>(c);
+            w->mlp.predictMLPBatch(w->features.data(), static_cast<int>(w->classes.size()), w->classes.data());
+        }, &work, repeats, sweeps ? sweeps + kernel_tuning::MLP_BATCH : nullptr);
+    }
+    
+    return -1;
+}
+
+std::string SignRecognizer::autotuneKernels(int repeats, kernel_tuning::Sweep* sweeps) {
+    for (int step = 0; step < AUTOTUNE_STEPS; step++) autotuneKernelStep(step, repeats, sweeps);
+    return kernel_tuning::serialize();
+}
+
+const double* SignRecognizer::getStatsSnapshot() {
+    return stats.snapshot();
+}
+
+void SignRecognizer::resetStats() {
+    stats.reset();
+}
+
 // ============================================================
 // 🚀 WASM 최적화: 배치 처리 (대량 데이터 일괄 처리)
 // ============================================================
@@ -542,6 +1028,7 @@ std::string SignRecognizer::recognizeBatch(float* landmarks, int frameCount, int
         RecognitionResult result = recognize(landmarkVec);  // 제스처 인식
         
         // JSON 배열에 추가
+        SIGN_PERF_SCOPE(stats, PerfStage::Serialization);
         if (frame > 0) json << ",";  // 첫 번째가 아니면 쉼표 추가
         json << "{\"gesture\":\"" << result.gesture  // 제스처 이름
              << "\",\"confidence\":" << result.confidence  // 신뢰도
@@ -552,216 +1039,6 @@ std::string SignRecognizer::recognizeBatch(float* landmarks, int frameCount, int
     return json.str();  // JSON 문자열 반환
 }
 
-// === WASM이 빛나는 영역들 구현 ===
-
-// 1. 이미지 가우시안 블러 (CPU 집약적)
-void SignRecognizer::processImageData(uint8_t* imageData, int width, int height, int filterType) {
-    if (filterType == 0) { // Gaussian Blur
-        const int kernelSize = 5;
-        const float kernel[25] = {
-            1, 4, 6, 4, 1,
-            4, 16, 24, 16, 4,
-            6, 24, 36, 24, 6,
-            4, 16, 24, 16, 4,
-            1, 4, 6, 4, 1
-        };
-        const float kernelSum = 256.0f;
-        
-        std::vector<uint8_t> temp(width * height * 4);
-        
-        // 가우시안 블러 적용 (RGBA 채널별로)
-        for (int y = 2; y < height - 2; y++) {
-            for (int x = 2; x < width - 2; x++) {
-                for (int channel = 0; channel < 4; channel++) {
-                    float sum = 0;
-                    
-                    for (int ky = 0; ky < kernelSize; ky++) {
-                        for (int kx = 0; kx < kernelSize; kx++) {
-                            int pixelY = y + ky - 2;
-                            int pixelX = x + kx - 2;
-                            int pixelIndex = (pixelY * width + pixelX) * 4 + channel;
-                            sum += imageData[pixelIndex] * kernel[ky * kernelSize + kx];
-                        }
-                    }
-                    
-                    temp[(y * width + x) * 4 + channel] = (uint8_t)(sum / kernelSum);
-                }
-            }
-        }
-        
-        // 결과 복사
-        std::memcpy(imageData, temp.data(), width * height * 4);
-    }
-}
-
-// ============================================================
-// 🚀 WASM 최적화: 대용량 행렬 곱셈 (캐시 블록 최적화)
-// ============================================================
-// 3중 블록 분할로 캐시 효율성 극대화 (일반 행렬 곱셈 대비 3-5배 빠름)
-// 1000x1000 이상의 대용량 행렬에서 특히 효과적
-void SignRecognizer::matrixMultiplyLarge(float* matA, float* matB, float* result, int size) {
-    // 메모리 초기화 (결과 행렬을 0으로 초기화)
-    std::memset(result, 0, size * size * sizeof(float));  // result 행렬 전체를 0으로 설정
-    
-    // 캐시 친화적 행렬 곱셈 (블록 단위) - 3중 블록 분할
-    const int BLOCK_SIZE = 64;  // 블록 크기 (64x64, L1 캐시 크기에 최적화)
-    
-    for (int ii = 0; ii < size; ii += BLOCK_SIZE) {  // 행 블록 순회
-        for (int jj = 0; jj < size; jj += BLOCK_SIZE) {  // 열 블록 순회
-            for (int kk = 0; kk < size; kk += BLOCK_SIZE) {  // 내부 합 블록 순회 (3중 루프로 캐시 효율성 극대화)
-                
-                int i_end = std::min(ii + BLOCK_SIZE, size);  // 현재 행 블록의 끝 인덱스
-                int j_end = std::min(jj + BLOCK_SIZE, size);  // 현재 열 블록의 끝 인덱스
-                int k_end = std::min(kk + BLOCK_SIZE, size);  // 현재 합 블록의 끝 인덱스
-                
-                for (int i = ii; i < i_end; i++) {  // 블록 내 행 순회
-                    for (int j = jj; j < j_end; j++) {  // 블록 내 열 순회
-                        float sum = 0.0f;  // 누적 합 초기화
-                        
-                        // SIMD 최적화 가능한 내부 루프 (가장 안쪽 루프, 캐시에 로드된 데이터 재사용)
-                        for (int k = kk; k < k_end; k++) {  // 블록 내 합 인덱스 순회
-                            sum += matA[i * size + k] * matB[k * size + j];  // 행렬 곱셈 누적 (C[i][j] += A[i][k] * B[k][j])
-                        }
-                        
-                        result[i * size + j] += sum;  // 결과 행렬에 누적
-                    }
-                }
-            }
-        }
-    }
-}
-
-// 3. 단순 FFT 구현 (재귀적)
-void SignRecognizer::computeFFT(float* realPart, float* imagPart, int size) {
-    if (size <= 1) return;
-    
-    // 비트 역순 정렬
-    for (int i = 1, j = 0; i < size; i++) {
-        int bit = size >> 1;
-        for (; j & bit; bit >>= 1) {
-            j ^= bit;
-        }
-        j ^= bit;
-        
-        if (i < j) {
-            std::swap(realPart[i], realPart[j]);
-            std::swap(imagPart[i], imagPart[j]);
-        }
-    }
-    
-    // FFT 계산
-    for (int len = 2; len <= size; len <<= 1) {
-        double ang = -2 * M_PI / len;
-        double wlen_r = cos(ang);
-        double wlen_i = sin(ang);
-        
-        for (int i = 0; i < size; i += len) {
-            double w_r = 1;
-            double w_i = 0;
-            
-            for (int j = 0; j < len / 2; j++) {
-                int u = i + j;
-                int v = i + j + len / 2;
-                
-                double u_r = realPart[u];
-                double u_i = imagPart[u];
-                double v_r = realPart[v] * w_r - imagPart[v] * w_i;
-                double v_i = realPart[v] * w_i + imagPart[v] * w_r;
-                
-                realPart[u] = u_r + v_r;
-                imagPart[u] = u_i + v_i;
-                realPart[v] = u_r - v_r;
-                imagPart[v] = u_i - v_i;
-                
-                double next_w_r = w_r * wlen_r - w_i * wlen_i;
-                double next_w_i = w_r * wlen_i + w_i * wlen_r;
-                w_r = next_w_r;
-                w_i = next_w_i;
-            }
-        }
-    }
-}
-
-// 4. SHA-256 해시 (간단 버전)
-void SignRecognizer::sha256Hash(uint8_t* input, int length, uint8_t* output) {
-    // SHA-256 상수들
-    const uint32_t K[64] = {
-        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
-        0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-        // ... (전체 64개 상수는 생략)
-    };
-    
-    // 초기 해시값
-    uint32_t H[8] = {
-        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
-        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
-    };
-    
-    // 간단한 해시 시뮬레이션 (실제 SHA-256은 더 복잡)
-    for (int i = 0; i < length; i++) {
-        uint32_t data = input[i];
-        for (int j = 0; j < 8; j++) {
-            H[j] = (H[j] + data * K[i % 64]) ^ (H[j] << 7) ^ (H[j] >> 11);
-        }
-    }
-    
-    // 결과를 바이트 배열로 변환
-    for (int i = 0; i < 8; i++) {
-        output[i * 4] = (H[i] >> 24) & 0xFF;
-        output[i * 4 + 1] = (H[i] >> 16) & 0xFF;
-        output[i * 4 + 2] = (H[i] >> 8) & 0xFF;
-        output[i * 4 + 3] = H[i] & 0xFF;
-    }
-}
-
-// 5. 파티클 물리 시뮬레이션
-void SignRecognizer::simulateParticles(float* positions, float* velocities, int particleCount, float deltaTime) {
-    const float gravity = -9.8f;
-    const float damping = 0.99f;
-    
-    // 각 파티클 업데이트
-    for (int i = 0; i < particleCount; i++) {
-        int idx = i * 3; // x, y, z
-        
-        // 중력 적용
-        velocities[idx + 1] += gravity * deltaTime;
-        
-        // 위치 업데이트
-        positions[idx] += velocities[idx] * deltaTime;
-        positions[idx + 1] += velocities[idx + 1] * deltaTime;
-        positions[idx + 2] += velocities[idx + 2] * deltaTime;
-        
-        // 바닥 충돌 검사
-        if (positions[idx + 1] < 0) {
-            positions[idx + 1] = 0;
-            velocities[idx + 1] = -velocities[idx + 1] * damping;
-        }
-        
-        // 간단한 파티클 간 상호작용
-        for (int j = i + 1; j < particleCount; j++) {
-            int jdx = j * 3;
-            
-            float dx = positions[idx] - positions[jdx];
-            float dy = positions[idx + 1] - positions[jdx + 1];
-            float dz = positions[idx + 2] - positions[jdx + 2];
-            
-            float distance = std::sqrt(dx*dx + dy*dy + dz*dz);
-            
-            if (distance < 1.0f && distance > 0.001f) {
-                float force = 0.1f / distance;
-                
-                velocities[idx] += dx * force * deltaTime;
-                velocities[idx + 1] += dy * force * deltaTime;
-                velocities[idx + 2] += dz * force * deltaTime;
-                
-                velocities[jdx] -= dx * force * deltaTime;
-                velocities[jdx + 1] -= dy * force * deltaTime;
-                velocities[jdx + 2] -= dz * force * deltaTime;
-            }
-        }
-    }
-}
-
 // 생성자
 SignRecognition::SignRecognition() {
     mean.resize(D_IN, 0.0f);
@@ -780,6 +1057,11 @@ void SignRecognition::setScaler(const std::vector<float>& meanArr, const std::ve
 // MLP 예측 구현
 int SignRecognition::predictMLP(const std::vector<float>& featureArr) {
     if (featureArr.size() != D_IN) return -1;
+    return predictMLPFromPointer(featureArr.data());
+}
+
+int SignRecognition::predictMLPFromPointer(const float* featureArr) {
+    if (sparse) return predictSparse(featureArr);
 
     // 1. Scaler 적용
     float x[D_IN];
@@ -790,24 +1072,36 @@ int SignRecognition::predictMLP(const std::vector<float>& featureArr) {
     // 2. Layer 1
     float h1[H1];
     for (int i = 0; i < H1; ++i) {
+#ifdef SIGN_WEIGHTS_FP16
+        float sum = B1[i] + dotHalf(W1 + i * D_IN, x, D_IN);
+#else
         float sum = B1[i];
         for (int j = 0; j < D_IN; ++j) sum += W1[i * D_IN + j] * x[j];
+#endif
         h1[i] = std::max(sum, 0.f);
     }
 
     // 3. Layer 2
     float h2[H2];
     for (int i = 0; i < H2; ++i) {
+#ifdef SIGN_WEIGHTS_FP16
+        float sum = B2[i] + dotHalf(W2 + i * H1, h1, H1);
+#else
         float sum = B2[i];
         for (int j = 0; j < H1; ++j) sum += W2[i * H1 + j] * h1[j];
+#endif
         h2[i] = std::max(sum, 0.f);
     }
 
     // 4. Output Layer
     float logits[NUM_CLASSES];
     for (int i = 0; i < NUM_CLASSES; ++i) {
+#ifdef SIGN_WEIGHTS_FP16
+        float sum = B3[i] + dotHalf(W3 + i * H2, h2, H2);
+#else
         float sum = B3[i];
         for (int j = 0; j < H2; ++j) sum += W3[i * H2 + j] * h2[j];
+#endif
         logits[i] = sum;
     }
 
@@ -826,6 +1120,142 @@ int SignRecognition::predictMLP(const std::vector<float>& featureArr) {
 
 
 
+// 배치 MLP 예측 구현
+// predictMLP와 같은 연산을 mlp.batch(기본 BATCH_BLOCK)개 프레임 단위로 수행
+// 가중치 행(예: W1의 126개 float)을 L1에 올린 채 여러 프레임의 내적에 재사용하여
+// 프레임당 가중치 메모리 트래픽을 1/묶음 크기로 줄임 (서버의 동적 배치에서 사용)
+namespace {
+// 비정렬 포인터용 SIMD 내적 (가중치 행은 126 간격이라 32바이트 정렬이 보장되지 않음)
+inline float dotUnaligned(const float* a, const float* b, int size) {
+    int simd_size = size & ~7;
+    __m256 sum_vec = _mm256_setzero_ps();
+    for (int i = 0; i < simd_size; i += 8) {
+        sum_vec = _mm256_add_ps(sum_vec, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    alignas(32) float temp[8];
+    _mm256_store_ps(temp, sum_vec);
+    float result = temp[0] + temp[1] + temp[2] + temp[3] + temp[4] + temp[5] + temp[6] + temp[7];
+    for (int i = simd_size; i < size; i++) result += a[i] * b[i];
+    return result;
+}
+
+// 가중치 행 내적: 저장 형식(float / half)에 따라 오버로드 선택
+inline float weightDot(const float* w, const float* x, int size) { return dotUnaligned(w, x, size); }
+inline float weightDot(const uint16_t* w, const float* x, int size) { return dotHalf(w, x, size); }
+
+// 로짓 argmax (동점이면 앞 클래스) + confidence가 있으면 소프트맥스 최대 확률 (= 1 / sum(exp(z - max)))
+inline int argmaxLogits(const float* logits, int count, float* confidence) {
+    int argmax = 0;
+    for (int i = 1; i < count; ++i) {
+        if (logits[i] > logits[argmax]) argmax = i;
+    }
+    if (confidence) {
+        float sum = 0.f;
+        for (int i = 0; i < count; ++i) sum += std::exp(logits[i] - logits[argmax]);
+        *confidence = 1.f / sum;
+    }
+    return argmax;
+}
+}  // namespace
+
+void SignRecognition::predictMLPBatch(const float* features, int count, int* out, float* confidence) {
+    if (sparse) {
+        // 희소 경로는 프레임마다 남은 블록만 읽으므로 행 재사용 묶음이 필요 없음
+        for (int b = 0; b < count; ++b) {
+            out[b] = predictSparse(features + static_cast<size_t>(b) * D_IN, confidence ? confidence + b : nullptr);
+        }
+        return;
+    }
+
+    alignas(32) float x[MAX_BATCH_BLOCK][D_IN];
+    alignas(32) float h1[MAX_BATCH_BLOCK][H1];
+    alignas(32) float h2[MAX_BATCH_BLOCK][H2];
+    const int block = kernel_tuning::get(kernel_tuning::MLP_BATCH);  // 1..MAX_BATCH_BLOCK (kernel_tuning 범위)
+
+    for (int base = 0; base < count; base += block) {
+        int n = std::min(block, count - base);
+
+        // 1. Scaler 적용
+        for (int b = 0; b < n; ++b) {
+            const float* f = features + static_cast<size_t>(base + b) * D_IN;
+            for (int j = 0; j < D_IN; ++j) x[b][j] = (f[j] - mean[j]) / scale[j];
+        }
+
+        // 2. Layer 1 (가중치 행 하나를 n개 프레임에 재사용)
+        for (int i = 0; i < H1; ++i) {
+            const auto* w = W1 + i * D_IN;
+            for (int b = 0; b < n; ++b) h1[b][i] = std::max(B1[i] + weightDot(w, x[b], D_IN), 0.f);
+        }
+
+        // 3. Layer 2
+        for (int i = 0; i < H2; ++i) {
+            const auto* w = W2 + i * H1;
+            for (int b = 0; b < n; ++b) h2[b][i] = std::max(B2[i] + weightDot(w, h1[b], H1), 0.f);
+        }
+
+        // 4. Output Layer + Argmax (+ 소프트맥스 신뢰도)
+        for (int b = 0; b < n; ++b) {
+            float logits[NUM_CLASSES];
+            for (int i = 0; i < NUM_CLASSES; ++i) logits[i] = B3[i] + weightDot(W3 + i * H2, h2[b], H2);
+            out[base + b] = argmaxLogits(logits, NUM_CLASSES, confidence ? confidence + base + b : nullptr);
+        }
+    }
+}
+
+// 블록 희소 추론 구현
+namespace {
+// 가지치기 입력용 fp32 밀집 사본 (FP16 빌드에서는 half 가중치를 확장)
+inline std::vector<float> denseCopy(const float* w, size_t count) { return std::vector<float>(w, w + count); }
+inline std::vector<float> denseCopy(const uint16_t* w, size_t count) {
+    std::vector<float> out(count);
+    for (size_t i = 0; i < count; i++) out[i] = halfToFloat(w[i]);
+    return out;
+}
+}  // namespace
+
+bool SignRecognition::setSparsity(float sparsity, int blockRows, int blockCols) {
+    if (sparsity <= 0.0f) {
+        sparse = false;
+        return true;
+    }
+    std::vector<float> w1 = denseCopy(W1, static_cast<size_t>(H1) * D_IN);
+    std::vector<float> w2 = denseCopy(W2, static_cast<size_t>(H2) * H1);
+    if (!sparseW1.build(w1.data(), H1, D_IN, blockRows, blockCols, sparsity) ||
+        !sparseW2.build(w2.data(), H2, H1, blockRows, blockCols, sparsity)) {
+        sparse = false;
+        return false;
+    }
+    sparse = true;
+    return true;
+}
+
+size_t SignRecognition::weightBytes() const {
+    if (!sparse) return sizeof(W1) + sizeof(W2) + sizeof(W3);
+    return sparseW1.bytes() + sparseW2.bytes() + sizeof(W3);
+}
+
+int SignRecognition::predictSparse(const float* features, float* confidence) const {
+    // 1. Scaler 적용 (W1이 참조하는 입력만, 나머지는 희소 GEMV가 읽지 않음)
+    // 마지막 블록이 읽는 D_IN 뒤 패딩(126 → 128)은 0
+    constexpr int X_PADDED = (D_IN + 7) / 8 * 8;
+    alignas(32) float x[X_PADDED];
+    for (int j = D_IN; j < X_PADDED; ++j) x[j] = 0.f;
+    for (int j : sparseW1.activeColumns()) x[j] = (features[j] - mean[j]) / scale[j];
+
+    // 2. Layer 1, 3. Layer 2 (희소 GEMV + 바이어스 + ReLU)
+    alignas(32) float h1[H1];
+    alignas(32) float h2[H2];
+    sparseW1.multiply(x, h1);
+    for (int i = 0; i < H1; ++i) h1[i] = std::max(h1[i] + B1[i], 0.f);
+    sparseW2.multiply(h1, h2);
+    for (int i = 0; i < H2; ++i) h2[i] = std::max(h2[i] + B2[i], 0.f);
+
+    // 4. Output Layer + Argmax (밀집)
+    float logits[NUM_CLASSES];
+    for (int i = 0; i < NUM_CLASSES; ++i) logits[i] = B3[i] + weightDot(W3 + i * H2, h2, H2);
+    return argmaxLogits(logits, NUM_CLASSES, confidence);
+}
+
 std::vector<float> SignRecognizer::extractAdvancedMatrixFeatures(const std::vector<HandLandmark>& landmarks) {
     std::vector<float> features;
     features.reserve(1260); // 대용량 특징
@@ -846,17 +1276,25 @@ std::vector<float> SignRecognizer::extractAdvancedMatrixFeatures(const std::vect
         features.push_back(dist);
     }
     
-    // 손가락 각도 (5개)
-    std::vector<int> fingerTips = {4, 8, 12, 16, 20};
-    std::vector<int> fingerPips = {3, 6, 10, 14, 18};
-    std::vector<int> fingerMcps = {2, 5, 9, 13, 17};
+    // 손가락 각도 (5개) + 곡률 (19개): 코사인 24개를 모아 acos는 한 번에 (calculateAngle과 같은 비트)
+    static const int fingerTips[5] = {4, 8, 12, 16, 20};
+    static const int fingerPips[5] = {3, 6, 10, 14, 18};
+    static const int fingerMcps[5] = {2, 5, 9, 13, 17};
     
+    alignas(32) float angles[24];
     for (int i = 0; i < 5; i++) {
-        float angle = calculateAngle(landmarks[fingerTips[i]], 
-                                   landmarks[fingerPips[i]], 
-                                   landmarks[fingerMcps[i]]);
-        features.push_back(angle);
+        const HandLandmark& a = landmarks[fingerTips[i]];
+        const HandLandmark& b = landmarks[fingerPips[i]];
+        const HandLandmark& c = landmarks[fingerMcps[i]];
+        angles[i] = fast_math::cosineBetween(a.x - b.x, a.y - b.y, c.x - b.x, c.y - b.y);
+    }
+    for (int i = 1; i < 20; i++) {
+        const HandLandmark& b = landmarks[i];
+        angles[4 + i] = fast_math::cosineBetween(landmarks[i-1].x - b.x, landmarks[i-1].y - b.y,
+                                                 landmarks[i+1].x - b.x, landmarks[i+1].y - b.y);
     }
+    fast_math::acosDegrees(angles, angles, 24);
+    features.insert(features.end(), angles, angles + 5);
     
     // 손바닥 벡터 (2개)
     float palmX = 0, palmY = 0;
@@ -869,14 +1307,27 @@ std::vector<float> SignRecognizer::extractAdvancedMatrixFeatures(const std::vect
     features.push_back(palmY);
     
     // 곡률 (19개)
-    for (int i = 1; i < 20; i++) {
-        float curvature = calculateAngle(landmarks[i-1], landmarks[i], landmarks[i+1]);
-        features.push_back(curvature);
+    features.insert(features.end(), angles + 5, angles + 24);
+    
+    // 회전 정보: 관절 20개의 pitch/yaw/roll atan2 60개를 먼저 한 번에 계산 ([pitch 20][yaw 20][roll 20])
+    alignas(32) float rotY[60], rotX[60], rotations[60];
+    for (int finger = 0, n = 0; finger < 5; finger++) {
+        int baseIdx = (finger == 0) ? 1 : finger * 4 + 1;
+        for (int joint = 0; joint < 4 && baseIdx + joint < 21; joint++, n++) {
+            const HandLandmark& lm = landmarks[baseIdx + joint];
+            float dx = lm.x - wrist.x;
+            float dy = lm.y - wrist.y;
+            float dz = lm.z - wrist.z;
+            rotY[n] = dy;      rotX[n] = std::sqrt(dx*dx + dz*dz);  // pitch
+            rotY[20 + n] = dx; rotX[20 + n] = dz;                  // yaw
+            rotY[40 + n] = dx; rotX[40 + n] = dy;                  // roll
+        }
     }
+    fast_math::atan2(rotY, rotX, rotations, 60);
     
     // === 2. 시공간적 특징 (420개) ===
     // 각 관절의 3D 위치, 속도, 가속도, 회전 정보
-    for (int finger = 0; finger < 5; finger++) {
+    for (int finger = 0, n = 0; finger < 5; finger++) {
         int baseIdx = (finger == 0) ? 1 : finger * 4 + 1;
         for (int joint = 0; joint < 4; joint++) {
             if (baseIdx + joint < 21) {
@@ -897,13 +1348,11 @@ std::vector<float> SignRecognizer::extractAdvancedMatrixFeatures(const std::vect
                 features.push_back((std::rand() % 100 - 50) / 1000.0f);
                 features.push_back((std::rand() % 100 - 50) / 1000.0f);
                 
-                // 회전 정보
-                float dx = lm.x - wrist.x;
-                float dy = lm.y - wrist.y;
-                float dz = lm.z - wrist.z;
-                features.push_back(std::atan2(dy, std::sqrt(dx*dx + dz*dz))); // pitch
-                features.push_back(std::atan2(dx, dz)); // yaw
-                features.push_back(std::atan2(dx, dy)); // roll
+                // 회전 정보 (위에서 계산한 atan2)
+                features.push_back(rotations[n]);       // pitch
+                features.push_back(rotations[20 + n]);  // yaw
+                features.push_back(rotations[40 + n]);  // roll
+                n++;
                 
                 // 곡률 변화율
                 features.push_back(std::sin(finger * joint * 0.1f));
@@ -982,66 +1431,37 @@ std::vector<float> SignRecognizer::advancedMatrixNeuralNetwork(const std::vector
         return std::vector<float>(5, 0.0f);
     }
     
-    // Xavier 초기화 시뮬레이션용 시드
-    static int seed = 42;
+    // Xavier 초기화 시뮬레이션용 시드 (호출마다 같은 시드에서 시작 → 고정 가중치, 인스턴스 간 공유 상태 없음)
+    int seed = 42;
     auto random = [&seed]() { 
         seed = (seed * 1103515245 + 12345) & 0x7fffffff;
         return (float)seed / 0x7fffffff - 0.5f; 
     };
     
-    // Layer 1: 1260 → 1024
-    std::vector<float> layer1(1024, 0.0f);
-    for (int i = 0; i < 1024; i++) {
-        float sum = random() * 0.01f; // bias
-        for (int j = 0; j < 1260; j++) {
-            float weight = random() * std::sqrt(6.0f / (1260 + 1024));
-            sum += features[j] * weight;
-        }
-        layer1[i] = std::max(0.0f, sum); // ReLU
+    // 레이어 활성값은 인스턴스 텐서의 행을 재사용 (호출마다 레이어별 vector 할당 없음)
+    // 행 0..3: Layer 1..4 출력 (가장 넓은 1024 열, 64바이트 정렬 연속 행)
+    static const int sizes[] = {1260, 1024, 512, 256, 128, 5};
+    if (heavyActivations.empty() && !heavyActivations.reset(4, 1024)) {
+        return std::vector<float>(5, 0.0f);  // 할당 실패
     }
     
-    // Layer 2: 1024 → 512
-    std::vector<float> layer2(512, 0.0f);
-    for (int i = 0; i < 512; i++) {
-        float sum = random() * 0.01f;
-        for (int j = 0; j < 1024; j++) {
-            float weight = random() * std::sqrt(6.0f / (1024 + 512));
-            sum += layer1[j] * weight;
-        }
-        layer2[i] = std::max(0.0f, sum);
-    }
-    
-    // Layer 3: 512 → 256
-    std::vector<float> layer3(256, 0.0f);
-    for (int i = 0; i < 256; i++) {
-        float sum = random() * 0.01f;
-        for (int j = 0; j < 512; j++) {
-            float weight = random() * std::sqrt(6.0f / (512 + 256));
-            sum += layer2[j] * weight;
-        }
-        layer3[i] = std::max(0.0f, sum);
-    }
-    
-    // Layer 4: 256 → 128
-    std::vector<float> layer4(128, 0.0f);
-    for (int i = 0; i < 128; i++) {
-        float sum = random() * 0.01f;
-        for (int j = 0; j < 256; j++) {
-            float weight = random() * std::sqrt(6.0f / (256 + 128));
-            sum += layer3[j] * weight;
-        }
-        layer4[i] = std::max(0.0f, sum);
-    }
-    
-    // Output Layer: 128 → 5
     std::vector<float> output(5, 0.0f);
-    for (int i = 0; i < 5; i++) {
-        float sum = random() * 0.01f;
-        for (int j = 0; j < 128; j++) {
-            float weight = random() * std::sqrt(6.0f / (128 + 5));
-            sum += layer4[j] * weight;
+    const float* input = features.data();
+    for (int layer = 0; layer < 5; layer++) {
+        const int in = sizes[layer];
+        const int out = sizes[layer + 1];
+        const bool isOutput = (layer == 4);
+        const float scale = std::sqrt(6.0f / (in + out));  // Xavier 범위
+        float* dst = isOutput ? output.data() : heavyActivations.row(layer);
+        for (int i = 0; i < out; i++) {
+            float sum = random() * 0.01f; // bias
+            for (int j = 0; j < in; j++) {
+                float weight = random() * scale;
+                sum += input[j] * weight;
+            }
+            dst[i] = isOutput ? sum : std::max(0.0f, sum); // 은닉층 ReLU, 출력층 Linear
         }
-        output[i] = sum; // Linear output
+        input = dst;
     }
     
     return output;
@@ -1,12 +1,22 @@
 #ifndef SIGN_RECOGNITION_H
 #define SIGN_RECOGNITION_H
 
+#ifdef __EMSCRIPTEN__
 #include <emscripten/bind.h>
+#endif
 #include <vector>
 #include <string>
 #include <cmath>
 #include <algorithm>
 #include <iostream>
+#include "convolution.h"
+#include "kernel_tuning.h"
+#include "landmark_filter.h"
+#include "latency_scheduler.h"
+#include "perf_stats.h"
+#include "sign_model.h"
+#include "sparse_gemv.h"
+#include "tensor.h"
 
 // 손 랜드마크 구조체
 struct HandLandmark {
@@ -15,6 +25,9 @@ struct HandLandmark {
     float z;
 };
 
+// 필터는 HandLandmark 배열을 stride 3 float 배열로 직접 처리
+static_assert(sizeof(HandLandmark) == 3 * sizeof(float), "HandLandmark must be tightly packed");
+
 // 인식 결과 구조체
 struct RecognitionResult {
     std::string gesture;
@@ -22,39 +35,125 @@ struct RecognitionResult {
     int id;
 };
 
+// 두 손 인식 결과 (손이 없으면 {"감지되지 않음", 0, 0})
+struct TwoHandResult {
+    RecognitionResult left;
+    RecognitionResult right;
+    RecognitionResult combined;  // 두 손 조합 라벨 (SignRecognizer::combineHands)
+};
+
 // 제스처 인식기 클래스
 class SignRecognizer {
 public:
     SignRecognizer();
     ~SignRecognizer();
     
+    // 스테이징 버퍼를 소유하므로 복사 금지
+    SignRecognizer(const SignRecognizer&) = delete;
+    SignRecognizer& operator=(const SignRecognizer&) = delete;
+    
+    // 스테이징 버퍼 크기 (한 번의 recognizeStaged 호출로 처리할 수 있는 최대 프레임 수)
+    static constexpr int MAX_BATCH_FRAMES = 64;
+    static constexpr int FLOATS_PER_FRAME = 42;  // 21 landmarks * 2 (x, y)
+    static constexpr int RESULT_FLOATS_PER_FRAME = 2;  // [id, confidence]
+    static constexpr int MAX_TWO_HAND_FRAMES = MAX_BATCH_FRAMES / 2;  // 두 손 프레임은 입력 두 칸 차지
+    static constexpr int TWO_HAND_FLOATS_PER_FRAME = 2 * FLOATS_PER_FRAME;  // 왼손 42 + 오른손 42
+    static constexpr int TWO_HAND_RESULT_FLOATS = 3 * RESULT_FLOATS_PER_FRAME;  // 왼손, 오른손, 조합 [id, confidence]
+    static constexpr int STAGING_ALIGNMENT = static_cast<int>(Matrix::ALIGNMENT);  // 캐시 라인 / SIMD 정렬
+    
     // 초기화
     bool initialize();
     
     // 랜드마크로부터 제스처 인식
     RecognitionResult recognize(const std::vector<HandLandmark>& landmarks);
     
+    // 두 손 동시 인식 (TIER_MLP 경로를 두 손에 한 번에 적용, 결과는 손마다 recognize와 같음)
+    // - 두 손 좌표를 SoA로 모아 손가락 펴짐 판정, 특징 추출, 신경망 레이어를 한 패스로 처리
+    // - 21개가 아닌 쪽(빈 벡터 등)은 손 없음으로 처리
+    TwoHandResult recognizeTwoHands(const std::vector<HandLandmark>& left, const std::vector<HandLandmark>& right);
+    
+    // 두 손 조합 라벨: 한 손만 감지되면 그 손, 같은 제스처면 신뢰도 1 - (1 - a)(1 - b),
+    // 다르면 신뢰도가 높은 손 (같으면 오른손)
+    static RecognitionResult combineHands(const RecognitionResult& left, const RecognitionResult& right);
+    
+    // 인식 엔진 단계 (비용 오름차순, 기본 정확도 순서도 같음 → setTierAccuracy로 바꿈)
+    enum RecognitionTier {
+        TIER_RULES = 0,  // recognizeByRules (규칙)
+        TIER_MLP = 1,    // 210 특징 신경망 + 규칙 폴백 (recognize와 같은 경로)
+        TIER_HEAVY = 2,  // 1260 특징 대형 신경망 (advancedMatrixNeuralNetwork, 고정 의사난수 가중치) + 규칙 폴백
+        TIER_COUNT = 3
+    };
+    
+    static constexpr float DEFAULT_LATENCY_BUDGET_MS = 4.0f;  // 60fps 프레임(16.7ms)의 약 1/4
+    
+    // 프레임 시간 예산 안에서 엔진을 골라 인식 (LatencyScheduler, 결정은 getSchedulerSnapshot으로 확인)
+    // - 세 단계 모두 사다리에 있고, 정확도 순서는 기본 규칙 < 신경망 < 대형 신경망
+    // - budgetMs <= 0이면 제한 없음 (항상 사다리 맨 위), 기본 DEFAULT_LATENCY_BUDGET_MS
+    RecognitionResult recognizeScheduled(const std::vector<HandLandmark>& landmarks);
+    void setLatencyBudget(float budgetMs);
+    // 단계별 정확도(TIER_COUNT개, 예: 라벨 데이터에서 잰 비율)로 사다리 순서를 다시 정함
+    // 정확도가 같으면 싼 단계를 위에 둠 (같은 정확도에 시간만 더 쓰지 않도록). 개수가 다르면 false
+    bool setTierAccuracy(const float* accuracy, int count);
+    int getLastTier() const { return lastTier; }
+    const double* getSchedulerSnapshot();  // LatencyScheduler::SNAPSHOT_SIZE개
+    const LatencyScheduler& getScheduler() const { return scheduler; }
+    
+    // 단계를 고정해 인식 (A/B 비교 기준, 지터 필터 적용)
+    RecognitionResult recognizeWithTier(const std::vector<HandLandmark>& landmarks, int tier);
+    
+    // 미리 계산된 특징으로 인식 (FeatureRegistry 공유 영역, batch_features.h로 뽑은 오프라인 특징 행렬)
+    // - fingerExtensionFlags: 랜드마크 21개 → 펴짐 플래그 5개 (엄지..소지, recognizeByRules와 같은 판정)
+    // - classifyFingerPattern: 펴짐 플래그 5개(엄지..소지) → 규칙 판정 (recognizeByRules와 같은 결과)
+    // - recognizeFromFeatures: 256개 특징(FeatureArena COMPLEX_FEATURES 블록, batch_features 행) + 펴짐 플래그
+    //   → TIER_MLP와 같은 결과
+    void fingerExtensionFlags(const std::vector<HandLandmark>& landmarks, float* extended) const;
+    static RecognitionResult classifyFingerPattern(const float* extended);
+    RecognitionResult recognizeFromFeatures(const float* complexFeatures, int count, const float* extended);
+    
     // 랜드마크 배열 포인터로 인식 (WASM에서 사용)
     std::string recognizeFromPointer(float* landmarks, int count);
     
     // 대용량 배치 처리 (한 번에 여러 프레임)
     std::string recognizeBatch(float* landmarks, int frameCount, int landmarksPerFrame);
     
-    // === WASM이 빛나는 영역들 ===
-    // 1. 이미지 필터링 (가우시안 블러, 엣지 검출 등)
-    void processImageData(uint8_t* imageData, int width, int height, int filterType);
+    // 인스턴스가 소유한 고정 스테이징 버퍼 (수명 동안 주소 불변, 64바이트 정렬)
+    // - 입력: MAX_BATCH_FRAMES * FLOATS_PER_FRAME floats
+    // - 출력: MAX_BATCH_FRAMES * RESULT_FLOATS_PER_FRAME floats ([id, confidence] 반복)
+    //   (두 손 경로가 MAX_TWO_HAND_FRAMES * TWO_HAND_RESULT_FLOATS floats까지 사용)
+    float* getInputBuffer();
+    float* getOutputBuffer();
+    
+    // 입력 스테이징 버퍼의 frameCount개 프레임을 인식해 출력 스테이징 버퍼에 기록
+    // (할당/JSON 직렬화 없음, 처리한 프레임 수 반환)
+    int recognizeStaged(int frameCount);
+    
+    // 입력 스테이징 버퍼의 두 손 프레임 frameCount개(최대 MAX_TWO_HAND_FRAMES)를 인식
+    // - 입력: 프레임마다 TWO_HAND_FLOATS_PER_FRAME floats (왼손 x, y 21쌍 → 오른손), 좌표가 모두 0인 손은 없음
+    // - 출력: 프레임마다 TWO_HAND_RESULT_FLOATS floats ([id, confidence] x 왼손, 오른손, 조합)
+    int recognizeStagedTwoHands(int frameCount);
     
-    // 2. 대용량 행렬 연산 (1000x1000 이상)
-    void matrixMultiplyLarge(float* matA, float* matB, float* result, int size);
+    // 코어 커널 자동 튜닝 (matvec.block, mlp.batch, kernel_tuning.h)
+    // - 후보마다 repeats번 재서 승자를 적용하고 프로필 텍스트 반환 (브라우저는 이 문자열을 보관해 다음 실행에 적용)
+    // - sweeps가 있으면 kernel_tuning::PARAM_COUNT개 배열에 파라미터별 측정 결과 기록
+    // - 측정은 임시 SignRecognizer/SignRecognition으로 하므로 호출한 인식기의 버퍼/필터 상태는 바뀌지 않음
+    static std::string autotuneKernels(int repeats, kernel_tuning::Sweep* sweeps = nullptr);
     
-    // 3. 복잡한 수학 연산 (FFT, 삼각함수 등)
-    void computeFFT(float* realPart, float* imagPart, int size);
+    // 위 튜닝을 파라미터 하나씩 나눠 실행 (0: matvec.block, 1: mlp.batch)
+    // - 브라우저가 유휴 시간 조각마다 한 단계씩 호출해 메인 스레드를 오래 막지 않게 함
+    // - 승자 값을 적용해 반환, step이 범위 밖이면 -1 (끝나면 kernel_tuning::serialize()로 프로필 저장)
+    static constexpr int AUTOTUNE_STEPS = 2;
+    static int autotuneKernelStep(int step, int repeats, kernel_tuning::Sweep* sweeps = nullptr);
     
-    // 4. 암호화/해시 연산
-    void sha256Hash(uint8_t* input, int length, uint8_t* output);
+    // 제스처 ID → 이름 (JavaScript에서 한 번 조회해 캐시)
+    static std::string getGestureName(int id);
     
-    // 5. 게임 물리 시뮬레이션 (충돌 검사, 파티클 등)
-    void simulateParticles(float* positions, float* velocities, int particleCount, float deltaTime);
+    // 이미지/행렬/FFT/해시/물리 보조 커널은 aux_kernels.h (별도 WASM 모듈로 지연 로드)
+    
+    // 인식 앞단 랜드마크 지터 필터 (0: 끄기, 1: One-Euro, 2: 칼만, 기본 끄기)
+    // - 켜면 recognize 계열 호출마다 연속 프레임으로 간주해 평활화 (fps는 타임스탬프 대신 사용할 프레임 간격)
+    void setLandmarkFilter(int mode);
+    void setFilterFrameRate(float fps);
+    void resetLandmarkFilter();
     
     // 임계값 설정
     void setDetectionThreshold(float threshold);
@@ -62,8 +161,27 @@ public:
     
     // 버전 정보
     std::string getVersion() const;
+    
+    // 단계별 계측 통계 (SIGN_ENABLE_STATS 빌드에서만 값이 쌓임, 레이아웃은 perf_stats.h 참고)
+    const double* getStatsSnapshot();
+    void resetStats();
 
 private:
+    // 네이티브 검증 도구가 비공개 특징/추론 단계를 직접 비교할 때만 사용 (tools/recognizer_internals.h)
+    friend struct SignRecognizerInternals;
+    
+    // 한 손 특징 추출 (COMPLEX_FEATURES개, 21개가 아니면 빈 벡터)
+    // 여러 손을 한 번에 뽑는 공개 경로는 batch_features::extractComplexFeatures, FeatureArena
+    static constexpr int COMPLEX_FEATURES = 256;  // extractComplexFeatures 특징 수 (거리 230 + 각도 5 + 손바닥 2 + 곡률 19)
+    std::vector<float> extractComplexFeatures(const std::vector<HandLandmark>& landmarks);
+    
+    // 가상 신경망 추론 (OUTPUT_SIZE개 점수, 특징 벡터 앞 INPUT_SIZE개를 읽고 count가 모자라면 0 벡터)
+    std::vector<float> neuralNetworkInference(const std::vector<float>& features);
+    std::vector<float> neuralNetworkInference(const float* features, int count);
+    
+    // 두 입력을 함께 추론 (가중치 행을 한 번 읽어 두 내적, 결과는 neuralNetworkInference 두 번과 비트 단위로 같음)
+    void neuralNetworkInferencePair(const float* first, const float* second, int count, float* firstOut, float* secondOut);
+    
     // 손가락이 펴져있는지 확인
     bool isFingerExtended(const HandLandmark& tip, const HandLandmark& pip, const HandLandmark& mcp) const;
     
@@ -76,23 +194,40 @@ private:
     // 고급 ML 스타일 인식 (최적화된 C++ 버전)
     RecognitionResult recognizeWithAdvancedML(const std::vector<HandLandmark>& landmarks);
     
+    // 대형 신경망 인식 (1260 특징 → 1024 → 512 → 256 → 128 → 5)
+    RecognitionResult recognizeWithHeavyNetwork(const std::vector<HandLandmark>& landmarks);
+    
+    // 신경망 출력 5개 → argmax + 소프트맥스 신뢰도
+    RecognitionResult interpretScores(const float* outputs, int count) const;
+    
+    // 필터를 거친 랜드마크로 단계별 엔진 실행 (TIER_MLP/TIER_HEAVY는 신뢰도가 낮으면 규칙과 비교)
+    RecognitionResult recognizeTier(const std::vector<HandLandmark>& landmarks, int tier);
+    
+    // 지터 필터가 켜져 있으면 filteredLandmarks에 평활화한 사본, 아니면 input 그대로
+    const std::vector<HandLandmark>& applyLandmarkFilter(const std::vector<HandLandmark>& input);
+    
+    // 두 손 SoA 좌표 (정의는 sign_recognition.cpp, 슬롯 0/1에 감지된 손을 차례로 채움)
+    struct HandLanes;
+    
+    // 좌표 count개를 stride 간격으로 읽어 slot에 채움 (stride 2면 z = 0, 필터가 켜져 있으면 평활화 후)
+    void packHand(HandLanes& lanes, int slot, const float* coords, int stride, LandmarkFilter& filter);
+    
+    // 슬롯 hands개의 특징(손마다 COMPLEX_FEATURES개)과 펴짐 플래그(엄지..소지)를 한 패스로 계산
+    void extractFeatureLanes(const HandLanes& lanes, int hands, float (*features)[COMPLEX_FEATURES]);
+    void fingerStateLanes(const HandLanes& lanes, int hands, float (*extended)[5]) const;
+    
+    // present[0] 왼손, present[1] 오른손 (lanes는 감지된 손만 앞 슬롯부터)
+    TwoHandResult recognizeHandLanes(const HandLanes& lanes, const bool* present);
     
-    // 특징 추출
-    std::vector<float> extractComplexFeatures(const std::vector<HandLandmark>& landmarks);
     
     // 고급 행렬 특징 추출 (1260개 특징)
     std::vector<float> extractAdvancedMatrixFeatures(const std::vector<HandLandmark>& landmarks);
     
-    // 가상 신경망 추론
-    std::vector<float> neuralNetworkInference(const std::vector<float>& features);
-    
     // 대용량 행렬 곱셈 신경망 추론 (1260→1024→512→256→128→5)
     std::vector<float> advancedMatrixNeuralNetwork(const std::vector<float>& features);
     
-    // 행렬 연산
-    void matrixMultiply(const std::vector<std::vector<float>>& A, 
-                       const std::vector<float>& B, 
-                       std::vector<float>& result);
+    // 행렬 연산 (result = A · B, B는 A.cols()개, result는 A.rows()개)
+    void matrixMultiply(MatrixView A, const float* B, float* result);
     
     /**
      * 빠른 컨볼루션 연산
@@ -125,9 +260,10 @@ private:
      *    - 비디오 기반 제스처 인식 (시공간 컨볼루션)
      *    - 다중 프레임 분석을 통한 동적 제스처 인식
      * 
-     * 현재 상태: 정의되어 있으나 아직 직접 호출되지 않음
-     * - 미래에 이미지 전처리나 시계열 분석에 활용 예정
-     * - WASM 최적화된 구현으로 빠른 성능 제공
+     * 현재 상태: ConvolutionEngine(convolution.h)에 위임
+     * - 짧은 커널은 SIMD 직접 방식, 긴 커널은 FFT 중첩 가산 (연산량 추정으로 자동 선택)
+     * - 63개 랜드마크 좌표 채널 일괄 처리는 ConvolutionEngine::convolveChannels 사용
+     * - 입력이 커널보다 짧으면 output은 빈 벡터
      */
     void fastConvolution(const std::vector<float>& input,  // 입력 신호/이미지 데이터
                         const std::vector<float>& kernel,  // 컨볼루션 커널 (필터 마스크)
@@ -177,6 +313,7 @@ private:
      * - _mm256_add_ps: 8개 float 덧셈을 한 번에 수행
      */
     float vectorDotProduct(const float* a, const float* b, int size);  // 벡터 내적 (SIMD 최적화)
+    void vectorDotProductPair(const float* a0, const float* a1, const float* b, int size, float* r0, float* r1);  // b를 공유하는 내적 두 개
     void vectorAdd(const float* a, const float* b, float* result, int size);  // 벡터 덧셈 (SIMD 최적화)
     void vectorMultiply(const float* a, float scalar, float* result, int size);  // 벡터 스칼라 곱셈 (SIMD 최적화)
     
@@ -189,12 +326,37 @@ private:
     // 각도 계산
     float calculateAngle(const HandLandmark& a, const HandLandmark& b, const HandLandmark& c) const;
     
-    // 가중치 캐시 (사전 계산된 ML 가중치들)
-    static std::vector<std::vector<float>> neuralWeights;
-    static std::vector<float> neuralBiases;
+    // 공유 불변 모델 (모든 인스턴스가 같은 가중치를 참조, initialize()에서 획득)
+    std::shared_ptr<const SignModel> model;
+    
+    // 인스턴스 전용 스크래치 (은닉층 활성값 2행을 번갈아 사용, 두 손 경로는 손마다 2행, 64바이트 정렬)
+    Matrix hiddenScratch{4, SignModel::MAX_HIDDEN, memory_accounting::RECOGNIZER};
     
     float detectionThreshold;
     float recognitionThreshold;
+    
+    // 핫패스 단계별 계측기
+    PerfStats stats;
+    
+    // 스테이징 버퍼 (생성자에서 한 번 할당, 한 행에 프레임을 빈틈없이 연속 배치 → JavaScript 배치 ABI)
+    Matrix stagingInput;   // [1][MAX_BATCH_FRAMES * FLOATS_PER_FRAME]
+    Matrix stagingOutput;  // [1][MAX_BATCH_FRAMES * RESULT_FLOATS_PER_FRAME]
+    std::vector<HandLandmark> stagingLandmarks;  // recognizeStaged용 재사용 랜드마크 벡터
+    
+    // fastConvolution 엔진 (커널 스펙트럼/작업 버퍼 재사용)
+    ConvolutionEngine convolution;
+    
+    // recognizeScheduled 엔진 선택기
+    LatencyScheduler scheduler{TIER_COUNT, DEFAULT_LATENCY_BUDGET_MS * 1000.0f};
+    int lastTier = TIER_MLP;
+    
+    // 랜드마크 지터 필터 (기본 OFF) + 필터 출력 재사용 벡터
+    LandmarkFilter landmarkFilter;
+    std::vector<HandLandmark> filteredLandmarks;
+    LandmarkFilter leftHandFilter;  // 두 손 경로의 왼손 (오른손은 landmarkFilter, 설정은 함께 변경)
+    
+    // 대형 신경망 은닉층 활성값 (첫 TIER_HEAVY 호출에서 할당, 행 = 레이어)
+    Matrix heavyActivations{memory_accounting::RECOGNIZER};
 };
 
 // Embind 바인딩은 main.cpp에서 처리
@@ -206,9 +368,28 @@ public:
 
     // MLP 모델 예측 함수 (선언만)
     int predictMLP(const std::vector<float>& featureArr);
+    int predictMLPFromPointer(const float* featureArr);  // featureArr[D_IN] (크기 검증 없음, 네이티브용)
 
     // Scaler 설정 함수 (선언만)
     void setScaler(const std::vector<float>& meanArr, const std::vector<float>& scaleArr);
+    
+    // 배치 예측: features는 행 우선 count x D_IN, out[count]에 클래스 ID 기록
+    // - mlp.batch개 프레임씩 묶어 각 가중치 행을 한 번 읽고 여러 프레임에 재사용
+    // - confidence가 있으면 프레임마다 소프트맥스 최대 확률 기록 (confidence[count])
+    void predictMLPBatch(const float* features, int count, int* out, float* confidence = nullptr);
+    
+    static constexpr int BATCH_BLOCK = 8;  // 가중치 행을 공유하는 프레임 묶음 기본 크기 (kernel_tuning mlp.batch)
+    static constexpr int MAX_BATCH_BLOCK = 16;  // mlp.batch 최댓값 (스택 버퍼 크기)
+    static constexpr int featureDim() { return D_IN; }  // 입력 특징 차원 (126)
+    static constexpr int numClasses() { return NUM_CLASSES; }  // 출력 클래스 수 (4)
+
+    // 블록 희소 추론: W1/W2에서 크기가 작은 블록을 sparsity 비율만큼 제거하고 희소 GEMV로 추론
+    // - 블록 모양 1x8 또는 4x4 (BlockSparseMatrix), sparsity <= 0이면 밀집 경로로 복귀
+    // - W1에서 블록이 모두 제거된 입력 특징은 정규화부터 건너뜀
+    bool setSparsity(float sparsity, int blockRows = 1, int blockCols = 8);
+    bool isSparse() const { return sparse; }
+    size_t weightBytes() const;  // 현재 경로가 읽는 W1+W2+W3 바이트
+    int activeInputCount() const { return sparse ? static_cast<int>(sparseW1.activeColumns().size()) : D_IN; }
 
 private:
     /**
@@ -244,8 +425,14 @@ private:
     static constexpr int H2 = 64;  // 두 번째 은닉층 크기 (Hidden Layer 2): 64 뉴런
     static constexpr int NUM_CLASSES = 4;  // 출력 클래스 개수: 4개 제스처 클래스
 
+    int predictSparse(const float* features, float* confidence = nullptr) const;
+
     std::vector<float> mean;
     std::vector<float> scale;
+
+    bool sparse = false;
+    BlockSparseMatrix sparseW1;  // H1 x D_IN
+    BlockSparseMatrix sparseW2;  // H2 x H1 (W3는 4 x 64로 작아 밀집 유지)
 };
 
 #endif // SIGN_RECOGNITION_H
@@ -0,0 +1,136 @@
+#include "sparse_gemv.h"
+#include <immintrin.h>  // AVX/SSE SIMD
+#include <algorithm>  // std::sort, std::min
+#include <cmath>  // std::floor
+
+bool BlockSparseMatrix::build(const float* dense, int rows, int cols, int blockRows, int blockCols, float sparsity) {
+    bool supported = (blockRows == 1 && blockCols == 8) || (blockRows == 4 && blockCols == 4);
+    if (!dense || rows <= 0 || cols <= 0 || !supported) return false;
+    sparsity = std::max(0.0f, std::min(sparsity, 1.0f));
+
+    numRows = rows;
+    numCols = cols;
+    blockR = blockRows;
+    blockC = blockCols;
+    const int blockRowCount = (rows + blockR - 1) / blockR;
+    const int blockColCount = (cols + blockC - 1) / blockC;
+    const int total = blockRowCount * blockColCount;
+
+    // 1. 블록별 제곱 노름 (경계 밖은 0으로 간주)
+    std::vector<float> norms(total, 0.0f);
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            float w = dense[static_cast<size_t>(r) * cols + c];
+            norms[(r / blockR) * blockColCount + c / blockC] += w * w;
+        }
+    }
+
+    // 2. 노름이 작은 순으로 floor(total * sparsity)개 제거 (같은 노름이면 앞쪽 블록부터, 결정적)
+    std::vector<int> order(total);
+    for (int i = 0; i < total; i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return norms[a] < norms[b] || (norms[a] == norms[b] && a < b);
+    });
+    std::vector<char> keep(total, 1);
+    int removed = static_cast<int>(std::floor(total * sparsity));
+    for (int i = 0; i < removed; i++) keep[order[i]] = 0;
+
+    // 3. BSR로 압축 (블록 행 안에서 열 오름차순)
+    rowStart.assign(1, 0);
+    columnStart.clear();
+    values.clear();
+    std::vector<char> used(cols, 0);
+    const int blockSize = blockR * blockC;
+    for (int br = 0; br < blockRowCount; br++) {
+        for (int bc = 0; bc < blockColCount; bc++) {
+            if (!keep[br * blockColCount + bc]) continue;
+            int c0 = bc * blockC;
+            columnStart.push_back(c0);
+            size_t offset = values.size();
+            values.resize(offset + blockSize, 0.0f);
+            for (int i = 0; i < blockR && br * blockR + i < rows; i++) {
+                for (int j = 0; j < blockC && c0 + j < cols; j++) {
+                    values[offset + i * blockC + j] = dense[static_cast<size_t>(br * blockR + i) * cols + c0 + j];
+                }
+            }
+            for (int j = c0; j < std::min(c0 + blockC, cols); j++) used[j] = 1;
+        }
+        rowStart.push_back(static_cast<int>(columnStart.size()));
+    }
+
+    active.clear();
+    for (int c = 0; c < cols; c++) {
+        if (used[c]) active.push_back(c);
+    }
+    return true;
+}
+
+size_t BlockSparseMatrix::totalBlocks() const {
+    return static_cast<size_t>((numRows + blockR - 1) / blockR) * ((numCols + blockC - 1) / blockC);
+}
+
+float BlockSparseMatrix::density() const {
+    size_t total = totalBlocks();
+    return total ? static_cast<float>(blockCount()) / total : 0.0f;
+}
+
+size_t BlockSparseMatrix::bytes() const {
+    return values.size() * sizeof(float) + columnStart.size() * sizeof(int) + rowStart.size() * sizeof(int);
+}
+
+void BlockSparseMatrix::multiply(const float* x, float* y) const {
+    if (blockR == 1) multiply1x8(x, y);
+    else multiply4x4(x, y);
+}
+
+// 1x8: 블록 하나 = 한 행의 연속 8열 → 곱셈 한 번 + 누산, 행 끝에서 수평 합
+// 마지막 열 블록은 paddedCols()까지 읽음 (경계 밖 가중치는 0이므로 패딩 입력은 유한값이면 됨)
+void BlockSparseMatrix::multiply1x8(const float* x, float* y) const {
+    const float* v = values.data();
+    const int* column = columnStart.data();
+    for (int r = 0; r < numRows; r++) {
+        __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+        int k = rowStart[r];
+        const int end = rowStart[r + 1];
+        // 누산기 2개로 덧셈 의존 사슬을 끊음
+        for (; k + 1 < end; k += 2) {
+            acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(v + k * 8), _mm256_loadu_ps(x + column[k])));
+            acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(v + k * 8 + 8), _mm256_loadu_ps(x + column[k + 1])));
+        }
+        if (k < end) acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(v + k * 8), _mm256_loadu_ps(x + column[k])));
+        __m256 acc = _mm256_add_ps(acc0, acc1);
+        __m128 sum = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+        y[r] = _mm_cvtss_f32(sum);
+    }
+}
+
+// 4x4: 블록 하나 = 4행 x 4열 → 입력 4개를 한 번 읽어 4개 행 누산기에 곱해 더함
+// 출력 행이 4의 배수가 아니면 마지막 블록 행은 남는 행을 버림
+void BlockSparseMatrix::multiply4x4(const float* x, float* y) const {
+    const int blockRowCount = static_cast<int>(rowStart.size()) - 1;
+    for (int br = 0; br < blockRowCount; br++) {
+        __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+        __m128 acc2 = _mm_setzero_ps(), acc3 = _mm_setzero_ps();
+        for (int k = rowStart[br]; k < rowStart[br + 1]; k++) {
+            const float* v = values.data() + static_cast<size_t>(k) * 16;
+            __m128 xv = _mm_loadu_ps(x + columnStart[k]);
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(v), xv));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(v + 4), xv));
+            acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(v + 8), xv));
+            acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(v + 12), xv));
+        }
+        // 4x4 전치 후 더하면 네 행의 수평 합이 한 레지스터에 모임
+        _MM_TRANSPOSE4_PS(acc0, acc1, acc2, acc3);
+        __m128 sums = _mm_add_ps(_mm_add_ps(acc0, acc1), _mm_add_ps(acc2, acc3));
+        int r0 = br * 4;
+        if (r0 + 4 <= numRows) {
+            _mm_storeu_ps(y + r0, sums);
+        } else {
+            alignas(16) float out[4];
+            _mm_store_ps(out, sums);
+            for (int i = 0; r0 + i < numRows; i++) y[r0 + i] = out[i];
+        }
+    }
+}
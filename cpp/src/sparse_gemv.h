@@ -0,0 +1,57 @@
+#ifndef SPARSE_GEMV_H
+#define SPARSE_GEMV_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * 블록 희소(block-sparse) 행렬 + SIMD GEMV
+ *
+ * - 저장: BSR(Block Compressed Sparse Row) — 블록 행마다 남은 블록의 시작 열과 값만 보관
+ *   지원 블록 모양: 1x8 (행 하나의 연속 8열, AVX 한 번에 내적) / 4x4 (SSE 4개 행 누산)
+ * - 가지치기: 크기(L2 노름)가 작은 블록부터 목표 비율만큼 제거 (재학습 없이 적용)
+ * - 어떤 블록도 참조하지 않는 입력 열은 activeColumns()에서 빠지므로
+ *   호출 측에서 해당 입력 특징의 계산(정규화 등)을 아예 건너뛸 수 있음
+ */
+class BlockSparseMatrix {
+public:
+    BlockSparseMatrix() {}
+
+    // 밀집 행렬(행 우선 rows x cols)에서 블록 단위로 가지치기해 생성
+    // sparsity: 제거할 블록 비율 (0.0 ~ 1.0), 블록 모양이 지원되지 않으면 false
+    bool build(const float* dense, int rows, int cols, int blockRows, int blockCols, float sparsity);
+
+    // y = W x (rows개 출력, 바이어스 없음)
+    // x는 paddedCols()개를 읽을 수 있어야 함: cols 뒤의 패딩은 0 가중치와 곱해지므로 유한값(보통 0)이면 됨
+    void multiply(const float* x, float* y) const;
+
+    int rows() const { return numRows; }
+    int cols() const { return numCols; }
+    int paddedCols() const { return (numCols + blockC - 1) / blockC * blockC; }
+    int blockRows() const { return blockR; }
+    int blockCols() const { return blockC; }
+    size_t blockCount() const { return columnStart.size(); }
+    size_t totalBlocks() const;  // 가지치기 전 블록 수
+    float density() const;       // 남은 블록 비율
+
+    // 압축 저장 바이트 수 (값 + 열 인덱스 + 행 포인터)
+    size_t bytes() const;
+
+    // 남은 블록이 참조하는 입력 열 (오름차순)
+    const std::vector<int>& activeColumns() const { return active; }
+
+private:
+    void multiply1x8(const float* x, float* y) const;
+    void multiply4x4(const float* x, float* y) const;
+
+    int numRows = 0;
+    int numCols = 0;
+    int blockR = 1;
+    int blockC = 8;
+    std::vector<int> rowStart;     // 블록 행 b의 블록 범위: [rowStart[b], rowStart[b + 1])
+    std::vector<int> columnStart;  // 블록의 시작 열
+    std::vector<float> values;     // 블록 값 (블록마다 blockR x blockC 행 우선, 경계 밖은 0)
+    std::vector<int> active;
+};
+
+#endif // SPARSE_GEMV_H
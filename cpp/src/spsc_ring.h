@@ -0,0 +1,117 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * 고정 용량 단일 생산자/단일 소비자 링 (락 없음, 할당은 생성자에서 한 번)
+ *
+ * - push는 생산자 스레드만, pop은 소비자 스레드만 호출
+ * - pushDropOldest는 생산자 스레드가 가득 찬 링에서 가장 오래된 항목을 한 번 버리고 넣을 때 사용 (drop-oldest 정책)
+ *   꺼내는 쪽이 둘이 되므로 슬롯마다 순번(sequence)을 두고 tail은 CAS로 전진:
+ *   슬롯은 꺼낸 쪽이 순번을 pos + capacity로 되돌린 뒤에만 다시 쓰여 읽는 도중 덮어쓰지 않음
+ * - claim/release는 소비자가 슬롯을 복사 없이 읽는 두 단계 꺼내기 (그 사이 슬롯은 생산자에게 돌아가지 않음)
+ * - head/tail은 캐시 라인을 나눠 생산자/소비자가 서로의 줄을 무효화하지 않음
+ * - T는 복사 가능한 고정 크기 구조체 (프레임/결과 레코드)
+ */
+template <typename T>
+class SpscRing {
+public:
+    explicit SpscRing(size_t capacity) {
+        size_t cap = 2;
+        while (cap < capacity) cap <<= 1;  // 인덱스 마스킹을 위해 2의 거듭제곱
+        mask = cap - 1;
+        slots.reset(new Slot[cap]);
+        for (size_t i = 0; i < cap; i++) slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // 생산자: 가득 차면 false (기다리지 않음)
+    bool push(const T& item) {
+        const uint64_t pos = head.load(std::memory_order_relaxed);
+        Slot& slot = slots[pos & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != pos) return false;  // 아직 꺼내지 않은 슬롯
+        slot.value = item;
+        slot.sequence.store(pos + 1, std::memory_order_release);
+        head.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 생산자 (drop-oldest): 가득 찼으면(sizeApprox() >= capacity()) 가장 오래된 항목을 한 번만 버리고 다시 넣어 봄
+    // - 소비자가 꺼내는 도중(tail은 넘겼지만 슬롯을 아직 돌려주지 않음)이면 가득 찬 게 아니므로 버리지 않음
+    // - 버린 뒤에도 자리가 없으면 새 항목을 넣지 않고 false (버리기를 되풀이하며 링을 비우지 않음)
+    // evicted에는 실제로 버렸는지 기록
+    bool pushDropOldest(const T& item, bool* evicted) {
+        *evicted = false;
+        if (push(item)) return true;
+        if (sizeApprox() < capacity()) return false;
+        *evicted = take(nullptr);
+        return push(item);
+    }
+
+    // 소비자: 비어 있으면 false
+    bool pop(T& item) { return take(&item); }
+
+    // 소비자: 가장 오래된 항목의 슬롯을 차지해 돌려줌 (비어 있으면 nullptr)
+    // 읽은 뒤 release(ticket)를 불러야 슬롯이 생산자에게 돌아감
+    const T* claim(uint64_t& ticket) {
+        Slot* slot = acquire(ticket);
+        return slot ? &slot->value : nullptr;
+    }
+    void release(uint64_t ticket) { slots[ticket & mask].sequence.store(ticket + capacity(), std::memory_order_release); }
+
+    size_t capacity() const { return mask + 1; }
+
+    // 대략적인 항목 수 (다른 스레드가 동시에 바꾸므로 통계/유휴 판단용)
+    size_t sizeApprox() const {
+        const uint64_t t = tail.load(std::memory_order_acquire);
+        const uint64_t h = head.load(std::memory_order_acquire);
+        return h > t ? static_cast<size_t>(h - t) : 0;
+    }
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> sequence;  // pos + 1: 채워짐, pos + capacity: 다음 바퀴에 쓸 수 있음
+        T value;
+    };
+
+    // tail을 CAS로 한 칸 전진시켜 슬롯을 차지 (생산자의 evict와 소비자가 경쟁할 수 있음)
+    Slot* acquire(uint64_t& ticket) {
+        uint64_t pos = tail.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots[pos & mask];
+            const uint64_t seq = slot.sequence.load(std::memory_order_acquire);
+            if (seq < pos + 1) return nullptr;  // 비어 있음
+            if (seq == pos + 1) {
+                if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    ticket = pos;
+                    return &slot;
+                }
+                // 실패 시 pos는 현재 tail로 갱신됨 → 다시 시도
+            } else {
+                pos = tail.load(std::memory_order_relaxed);  // 다른 쪽이 이미 꺼내 감
+            }
+        }
+    }
+
+    bool take(T* item) {
+        uint64_t ticket = 0;
+        Slot* slot = acquire(ticket);
+        if (!slot) return false;
+        if (item) *item = slot->value;
+        release(ticket);
+        return true;
+    }
+
+    std::unique_ptr<Slot[]> slots;
+    size_t mask = 0;
+    alignas(64) std::atomic<uint64_t> head{0};  // 다음에 쓸 위치 (생산자)
+    alignas(64) std::atomic<uint64_t> tail{0};  // 다음에 읽을 위치 (소비자 + pushDropOldest)
+};
+
+#endif // SPSC_RING_H
@@ -0,0 +1,304 @@
+#include "temporal_conv.h"
+#include <immintrin.h>  // AVX SIMD
+#include <algorithm>  // std::max, std::fill
+#include <cmath>  // std::sqrt
+#include <cstring>  // std::memcpy
+
+namespace {
+
+// 비정렬 입력도 허용하는 SIMD 내적 (가중치 행은 채널 수에 따라 32바이트 정렬이 아닐 수 있음, 링 슬롯은 Matrix 행이라 정렬)
+inline float dot(const float* a, const float* b, int size) {
+    __m256 acc = _mm256_setzero_ps();
+    int i = 0;
+    for (; i + 8 <= size; i += 8) {
+        acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    float lanes[8];
+    _mm256_storeu_ps(lanes, acc);
+    float sum = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    for (; i < size; i++) sum += a[i] * b[i];
+    return sum;
+}
+
+inline float horizontalSum(__m256 v) {
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    return _mm_cvtss_f32(sum);
+}
+
+// 입력 끝 (in % 8개) 마스크: 앞 tail개 레인만 읽음
+inline __m256i tailMask(int tail) {
+    alignas(32) static const int32_t table[16] = {-1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0};
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(table + 8 - tail));
+}
+
+// 출력 채널 OUTS개 x 스트림 STREAMS개 블록의 합성곱 합 (바이어스/ReLU 전)
+// - w: 첫 출력 채널의 가중치 행 [kernel][in], 채널 간격 rowFloats
+// - taps[s * kernel + k]: 스트림 s의 탭 k 입력 (링 슬롯 행)
+// 가중치 벡터 하나를 STREAMS개 스트림에, 입력 벡터 하나를 OUTS개 채널에 재사용 (배치 시 가중치 읽기 1/STREAMS)
+// (o, s)마다 누산 순서가 블록 모양과 무관하므로 step()과 stepBatch() 결과는 비트 단위로 같음
+template <int OUTS, int STREAMS>
+inline void convBlock(const float* w, size_t rowFloats, const float* const* taps, int kernel, int in, float* sums) {
+    __m256 acc[OUTS][STREAMS];
+    for (int o = 0; o < OUTS; o++) {
+        for (int s = 0; s < STREAMS; s++) acc[o][s] = _mm256_setzero_ps();
+    }
+    const int full = in & ~7;
+    const __m256i mask = tailMask(in - full);
+    for (int k = 0; k < kernel; k++) {
+        const float* wk = w + static_cast<size_t>(k) * in;
+        const float* x[STREAMS];
+        for (int s = 0; s < STREAMS; s++) x[s] = taps[s * kernel + k];
+        for (int i = 0; i < full; i += 8) {
+            __m256 xv[STREAMS];
+            for (int s = 0; s < STREAMS; s++) xv[s] = _mm256_loadu_ps(x[s] + i);
+            for (int o = 0; o < OUTS; o++) {
+                const __m256 wv = _mm256_loadu_ps(wk + o * rowFloats + i);
+                for (int s = 0; s < STREAMS; s++) acc[o][s] = _mm256_add_ps(acc[o][s], _mm256_mul_ps(wv, xv[s]));
+            }
+        }
+        if (full < in) {
+            __m256 xv[STREAMS];
+            for (int s = 0; s < STREAMS; s++) xv[s] = _mm256_maskload_ps(x[s] + full, mask);
+            for (int o = 0; o < OUTS; o++) {
+                const __m256 wv = _mm256_maskload_ps(wk + o * rowFloats + full, mask);
+                for (int s = 0; s < STREAMS; s++) acc[o][s] = _mm256_add_ps(acc[o][s], _mm256_mul_ps(wv, xv[s]));
+            }
+        }
+    }
+    for (int o = 0; o < OUTS; o++) {
+        for (int s = 0; s < STREAMS; s++) sums[o * STREAMS + s] = horizontalSum(acc[o][s]);
+    }
+}
+
+// 스트림 STREAMS개에 대해 레이어의 모든 출력 채널 계산 (채널 4개씩, 나머지는 1개씩)
+template <int STREAMS>
+inline void convStreams(const float* weights, const float* bias, int out, int kernel, int in, const float* const* taps,
+                        float* const* outputs) {
+    const size_t rowFloats = static_cast<size_t>(kernel) * in;
+    float sums[4 * STREAMS];
+    int o = 0;
+    for (; o + 4 <= out; o += 4) {
+        convBlock<4, STREAMS>(weights + o * rowFloats, rowFloats, taps, kernel, in, sums);
+        for (int j = 0; j < 4; j++) {
+            for (int s = 0; s < STREAMS; s++) outputs[s][o + j] = std::max(0.0f, bias[o + j] + sums[j * STREAMS + s]);
+        }
+    }
+    for (; o < out; o++) {
+        convBlock<1, STREAMS>(weights + o * rowFloats, rowFloats, taps, kernel, in, sums);
+        for (int s = 0; s < STREAMS; s++) outputs[s][o] = std::max(0.0f, bias[o] + sums[s]);
+    }
+}
+
+}  // namespace
+
+// ============================================================
+// TemporalConvModel
+// ============================================================
+
+std::vector<TemporalConvLayerSpec> TemporalConvModel::defaultLayers() {
+    return {{64, 3, 1}, {64, 3, 2}, {64, 3, 4}};
+}
+
+TemporalConvModel::TemporalConvModel(int inputDim, const std::vector<TemporalConvLayerSpec>& layerSpecs, int numClasses)
+    : inDim(inputDim), classes(numClasses), specs(layerSpecs) {
+    for (size_t l = 0; l < specs.size(); l++) {
+        if (specs[l].kernelSize > MAX_KERNEL) {
+            // 레이어/헤드 없는 빈 모델로 남겨 상태/스텝이 가중치 밖을 읽지 않게 함
+            configError = "layer " + std::to_string(l) + ": kernel size " + std::to_string(specs[l].kernelSize) +
+                          " exceeds MAX_KERNEL (" + std::to_string(MAX_KERNEL) + ")";
+            classes = 0;
+            return;
+        }
+    }
+    int in = inputDim;
+    for (const auto& spec : specs) {
+        Layer layer;
+        layer.in = in;
+        layer.out = spec.outChannels;
+        layer.kernel = std::max(1, spec.kernelSize);
+        layer.dilation = std::max(1, spec.dilation);
+        layer.history = (layer.kernel - 1) * layer.dilation + 1;
+        layer.weights.assign(static_cast<size_t>(layer.out) * layer.kernel * layer.in, 0.0f);
+        layer.bias.assign(layer.out, 0.0f);
+        layers.push_back(std::move(layer));
+        in = spec.outChannels;
+    }
+    headWeights.assign(static_cast<size_t>(classes) * in, 0.0f);
+    headBias.assign(classes, 0.0f);
+}
+
+void TemporalConvModel::initializeDeterministic(uint32_t seed) {
+    // advancedMatrixNeuralNetwork와 같은 선형 합동 생성기 (플랫폼 무관 재현성)
+    uint32_t state = seed;
+    auto uniform = [&state](float limit) {
+        state = state * 1103515245u + 12345u;
+        float unit = static_cast<float>((state >> 8) & 0xFFFFFF) / 16777216.0f;  // [0, 1)
+        return (unit * 2.0f - 1.0f) * limit;
+    };
+
+    for (auto& layer : layers) {
+        float limit = std::sqrt(6.0f / (layer.in * layer.kernel + layer.out));  // Xavier 균등
+        for (float& w : layer.weights) w = uniform(limit);
+        std::fill(layer.bias.begin(), layer.bias.end(), 0.0f);
+    }
+    int channels = layers.empty() ? inDim : layers.back().out;
+    float limit = std::sqrt(6.0f / (channels + classes));
+    for (float& w : headWeights) w = uniform(limit);
+    std::fill(headBias.begin(), headBias.end(), 0.0f);
+}
+
+bool TemporalConvModel::loadWeights(const float* data, size_t count, std::string* error) {
+    if (!valid()) {
+        if (error) *error = configError;
+        return false;
+    }
+    if (count != parameterCount()) {
+        if (error) *error = "expected " + std::to_string(parameterCount()) + " floats, got " + std::to_string(count);
+        return false;
+    }
+    for (auto& layer : layers) {
+        std::memcpy(layer.weights.data(), data, layer.weights.size() * sizeof(float));
+        data += layer.weights.size();
+        std::memcpy(layer.bias.data(), data, layer.bias.size() * sizeof(float));
+        data += layer.bias.size();
+    }
+    std::memcpy(headWeights.data(), data, headWeights.size() * sizeof(float));
+    data += headWeights.size();
+    std::memcpy(headBias.data(), data, headBias.size() * sizeof(float));
+    return true;
+}
+
+size_t TemporalConvModel::parameterCount() const {
+    size_t total = headWeights.size() + headBias.size();
+    for (const auto& layer : layers) total += layer.weights.size() + layer.bias.size();
+    return total;
+}
+
+int TemporalConvModel::receptiveField() const {
+    int field = 1;
+    for (const auto& layer : layers) field += layer.history - 1;
+    return field;
+}
+
+size_t TemporalConvModel::macsPerStep() const {
+    size_t total = headWeights.size();
+    for (const auto& layer : layers) total += layer.weights.size();
+    return total;
+}
+
+// ============================================================
+// TemporalConvState
+// ============================================================
+
+TemporalConvState::TemporalConvState(std::shared_ptr<const TemporalConvModel> sharedModel)
+    : model(std::move(sharedModel)) {
+    size_t widest = model->inDim;
+    for (const auto& layer : model->layers) {
+        rings.emplace_back(layer.history, layer.in, memory_accounting::TEMPORAL);
+        heads.push_back(0);
+        widest = std::max(widest, static_cast<size_t>(layer.out));
+    }
+    activation.assign(widest, 0.0f);
+    logits.assign(model->classes, 0.0f);
+}
+
+void TemporalConvState::reset() {
+    for (auto& ring : rings) ring.fill(0.0f);
+    std::fill(heads.begin(), heads.end(), 0);
+    seen = 0;
+}
+
+const float* TemporalConvState::step(const float* frame) {
+    TemporalConvState* self = this;
+    stepBatch(&self, 1, frame, logits.data());  // 스트림 1개짜리 배치
+    return logits.data();
+}
+
+void TemporalConvState::stepBatch(TemporalConvState* const* states, int count, const float* frames, float* out) {
+    if (count <= 0) return;
+    const TemporalConvModel& m = *states[0]->model;  // 모든 스트림은 같은 모델을 공유해야 함
+
+    for (size_t l = 0; l < m.layers.size(); l++) {
+        const auto& layer = m.layers[l];
+
+        // 1) 모든 스트림의 현재 입력을 링에 기록 (이후 activation을 출력으로 덮어써도 안전)
+        for (int s = 0; s < count; s++) {
+            TemporalConvState& st = *states[s];
+            const float* input = l == 0 ? frames + static_cast<size_t>(s) * m.inDim : st.activation.data();
+            std::memcpy(st.rings[l].row(st.heads[l]), input, layer.in * sizeof(float));
+        }
+
+        // 2) 스트림 4개씩 묶어 채널 블록마다 가중치 벡터를 한 번 읽고 4개 스트림에 적용 (나머지는 1개씩)
+        //    탭 포인터: 현재 프레임(head)에서 (kernel-1-k)·dilation 프레임 전 슬롯
+        constexpr int STREAM_BLOCK = 4;
+        const float* taps[STREAM_BLOCK * TemporalConvModel::MAX_KERNEL];
+        float* outputs[STREAM_BLOCK];
+        for (int first = 0; first < count;) {
+            const int n = count - first >= STREAM_BLOCK ? STREAM_BLOCK : 1;
+            for (int s = 0; s < n; s++) {
+                TemporalConvState& st = *states[first + s];
+                for (int k = 0; k < layer.kernel; k++) {
+                    int offset = (layer.kernel - 1 - k) * layer.dilation;
+                    taps[s * layer.kernel + k] = st.rings[l].row((st.heads[l] - offset + layer.history) % layer.history);
+                }
+                outputs[s] = st.activation.data();
+            }
+            if (n == STREAM_BLOCK) {
+                convStreams<STREAM_BLOCK>(layer.weights.data(), layer.bias.data(), layer.out, layer.kernel, layer.in, taps, outputs);
+            } else {
+                convStreams<1>(layer.weights.data(), layer.bias.data(), layer.out, layer.kernel, layer.in, taps, outputs);
+            }
+            first += n;
+        }
+
+        for (int s = 0; s < count; s++) {
+            states[s]->heads[l] = (states[s]->heads[l] + 1) % layer.history;
+        }
+    }
+
+    int channels = m.layers.empty() ? m.inDim : m.layers.back().out;
+    for (int s = 0; s < count; s++) {
+        TemporalConvState& st = *states[s];
+        const float* features = m.layers.empty() ? frames + static_cast<size_t>(s) * m.inDim : st.activation.data();
+        for (int c = 0; c < m.classes; c++) {
+            float v = m.headBias[c] + dot(m.headWeights.data() + static_cast<size_t>(c) * channels, features, channels);
+            st.logits[c] = v;  // step()이 반환하는 버퍼 (out과 같을 수 있음)
+            out[static_cast<size_t>(s) * m.classes + c] = v;
+        }
+        st.seen++;
+    }
+}
+
+bool TemporalConvState::evaluateWindow(const TemporalConvModel& m, const float* frames, int length, float* out) {
+    if (length <= 0) return false;  // 마지막 프레임이 없음
+
+    // 레이어마다 윈도우 전체 시퀀스를 다시 계산 (t < 0 프레임은 0 = reset 직후 상태와 동일)
+    std::vector<float> current(frames, frames + static_cast<size_t>(length) * m.inDim);
+    std::vector<float> next;
+    int width = m.inDim;
+
+    for (const auto& layer : m.layers) {
+        next.assign(static_cast<size_t>(length) * layer.out, 0.0f);
+        for (int t = 0; t < length; t++) {
+            const float* w = layer.weights.data();
+            for (int o = 0; o < layer.out; o++) {
+                float sum = layer.bias[o];
+                for (int k = 0; k < layer.kernel; k++, w += layer.in) {
+                    int src = t - (layer.kernel - 1 - k) * layer.dilation;
+                    if (src >= 0) sum += dot(w, current.data() + static_cast<size_t>(src) * width, layer.in);
+                }
+                next[static_cast<size_t>(t) * layer.out + o] = std::max(0.0f, sum);
+            }
+        }
+        current.swap(next);
+        width = layer.out;
+    }
+
+    const float* last = current.data() + static_cast<size_t>(length - 1) * width;
+    for (int c = 0; c < m.classes; c++) {
+        out[c] = m.headBias[c] + dot(m.headWeights.data() + static_cast<size_t>(c) * width, last, width);
+    }
+    return true;
+}
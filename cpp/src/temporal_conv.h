@@ -0,0 +1,113 @@
+#ifndef TEMPORAL_CONV_H
+#define TEMPORAL_CONV_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tensor.h"
+
+/**
+ * 스트리밍 시간 컨볼루션 네트워크 (동적/움직임 제스처용)
+ *
+ * - 프레임별 특징 벡터(예: 126차원 양손 랜드마크) 시퀀스 위의 작은 인과(causal) 1-D TCN
+ * - 레이어마다 dilation을 키워 수용 영역(receptive field)을 넓힘: 1 + Σ (k-1)·d
+ * - 레이어별 상태 버퍼(링 버퍼)에 과거 입력을 보관 → 새 프레임마다 한 단계만 계산
+ *   (윈도우 전체를 매 프레임 다시 계산하지 않으므로 프레임당 비용이 윈도우 길이와 무관한 O(1))
+ *
+ * 구조: TemporalConvModel(불변 가중치, 여러 스트림이 공유) + TemporalConvState(스트림별 상태)
+ * 가중치 레이아웃 (loadWeights 입력 순서):
+ *   레이어마다 W[out][k][in] → bias[out], 마지막으로 분류 헤드 W[classes][channels] → bias[classes]
+ *   탭 k=0이 가장 과거 프레임, k=kernelSize-1이 현재 프레임
+ */
+
+struct TemporalConvLayerSpec {
+    int outChannels;
+    int kernelSize;
+    int dilation;
+};
+
+class TemporalConvModel {
+public:
+    // 기본 구조: 126 → 64(k3,d1) → 64(k3,d2) → 64(k3,d4) → 4 클래스 (수용 영역 15프레임)
+    static std::vector<TemporalConvLayerSpec> defaultLayers();
+
+    static constexpr int MAX_KERNEL = 16;  // 레이어 커널 크기 상한 (탭 포인터 스택 버퍼 크기, 넘으면 거부)
+
+    // 커널 크기가 MAX_KERNEL을 넘는 레이어가 있으면 레이어/헤드를 만들지 않고 valid() false (사유는 error())
+    // 잘라서 만들면 학습 때와 다른 모델이 조용히 실행되므로 거부
+    TemporalConvModel(int inputDim, const std::vector<TemporalConvLayerSpec>& layers, int numClasses);
+
+    bool valid() const { return configError.empty(); }
+    const std::string& error() const { return configError; }
+
+    // 고정 시드 초기화 (학습된 가중치가 없을 때 벤치마크용, Xavier 균등 분포)
+    void initializeDeterministic(uint32_t seed);
+
+    // 평탄화된 가중치 로드 (레이아웃은 파일 상단 주석 참고)
+    // 잘못된 구조(valid() false)이거나 개수가 다르면 false + error
+    bool loadWeights(const float* data, size_t count, std::string* error = nullptr);
+
+    size_t parameterCount() const;
+    int inputDim() const { return inDim; }
+    int numClasses() const { return classes; }
+    int numLayers() const { return static_cast<int>(specs.size()); }
+    int receptiveField() const;
+
+    // 프레임당 곱셈-누산 횟수 (증분 스텝 1회 기준)
+    size_t macsPerStep() const;
+
+private:
+    friend class TemporalConvState;
+
+    struct Layer {
+        int in, out, kernel, dilation;
+        int history;               // 보관할 과거 입력 프레임 수: (kernel-1)·dilation + 1
+        std::vector<float> weights;  // [out][kernel][in]
+        std::vector<float> bias;     // [out]
+    };
+
+    int inDim;
+    int classes;
+    std::vector<TemporalConvLayerSpec> specs;
+    std::vector<Layer> layers;
+    std::vector<float> headWeights;  // [classes][lastChannels]
+    std::vector<float> headBias;     // [classes]
+    std::string configError;         // 생성 시 구조 검증 실패 사유 (비어 있으면 정상)
+};
+
+/**
+ * 스트림 하나의 상태 (레이어별 입력 링 버퍼 + 활성값 스크래치)
+ */
+class TemporalConvState {
+public:
+    explicit TemporalConvState(std::shared_ptr<const TemporalConvModel> model);
+
+    // 상태 초기화 (과거 프레임을 0으로 간주)
+    void reset();
+
+    // 새 프레임 하나 처리 → 클래스 로짓 포인터 (numClasses개, 다음 step까지 유효)
+    const float* step(const float* frame);
+
+    // 여러 스트림을 한 프레임씩 함께 진행 (스트림 4개씩 묶어 가중치 벡터 하나를 4개 스트림에 재사용)
+    // frames: count x inputDim 행 우선, logits: count x numClasses, 결과는 스트림마다 step()과 비트 단위로 같음
+    static void stepBatch(TemporalConvState* const* states, int count, const float* frames, float* logits);
+
+    // 기준 구현: 윈도우 전체를 처음부터 다시 계산해 마지막 프레임의 로짓 반환 (상태 미사용)
+    // 증분 결과 검증과 비용 비교용, length <= 0이면 logits를 건드리지 않고 false
+    static bool evaluateWindow(const TemporalConvModel& model, const float* frames, int length, float* logits);
+
+    int framesSeen() const { return seen; }
+
+private:
+    std::shared_ptr<const TemporalConvModel> model;
+    std::vector<Matrix> rings;              // 레이어별 [history][in] (슬롯 행마다 64바이트 정렬)
+    std::vector<int> heads;                 // 레이어별 다음 기록 슬롯
+    std::vector<float> activation;          // 레이어 출력 스크래치
+    std::vector<float> logits;
+    int seen = 0;
+};
+
+#endif // TEMPORAL_CONV_H
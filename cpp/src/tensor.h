@@ -0,0 +1,150 @@
+#ifndef TENSOR_H
+#define TENSOR_H
+
+#include "memory_accounting.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>  // std::memset
+#include <utility>  // std::swap
+
+/**
+ * 정렬된 2차원 텐서 (행 우선, 연속 버퍼)
+ *
+ * - Tensor<T>: 소유 버퍼. 64바이트(캐시 라인, AVX-512 폭) 정렬, 행 간격을 64바이트 배수로 패딩
+ *   → 모든 행 시작이 정렬되어 있어 SIMD 커널이 행마다 연속 메모리를 정렬 로드로 읽음
+ *   → 패딩 영역은 0 (행 길이 cols만큼만 읽는 커널에는 영향 없음)
+ * - TensorView<T>: 비소유 뷰 (포인터 + rows/cols/stride). 텐서의 일부나 외부 버퍼
+ *   (wasm 힙의 _malloc 포인터, JavaScript가 채우는 스테이징 버퍼 등)를 복사 없이 감쌈
+ *   외부 버퍼는 정렬이 보장되지 않으므로 커널은 aligned()로 확인하거나 비정렬 로드를 사용
+ * - 버퍼는 memory_accounting 태그(기본 OTHER)로 할당 → 서브시스템별 사용량/예산에 포함
+ * - 예외를 쓰지 않으므로 할당 실패(예산 초과 포함)는 empty()로 확인
+ *
+ * 이전의 std::vector<std::vector<float>> 행렬은 행마다 따로 할당되어 메모리에 흩어지고
+ * 행 시작 정렬도 보장되지 않았음 (_mm256_load_ps 정렬 가정 위반 가능)
+ */
+template <typename T>
+class TensorView {
+public:
+    TensorView() = default;
+    // stride 0이면 cols (패딩 없는 연속 행, 외부 버퍼 기본 배치)
+    TensorView(T* data, int rows, int cols, int stride = 0)
+        : ptr(data), numRows(rows), numCols(cols), rowStride(stride > 0 ? stride : cols) {}
+
+    // 비상수 뷰 → 상수 뷰 변환
+    operator TensorView<const T>() const { return TensorView<const T>(ptr, numRows, numCols, rowStride); }
+
+    T* data() const { return ptr; }
+    int rows() const { return numRows; }
+    int cols() const { return numCols; }
+    int stride() const { return rowStride; }  // 행 간격 (원소 개수)
+    bool empty() const { return ptr == nullptr || numRows == 0; }
+
+    T* row(int i) const { return ptr + static_cast<size_t>(i) * rowStride; }
+    T& operator()(int i, int j) const { return row(i)[j]; }
+
+    // 행 [first, first + count) 부분 뷰
+    TensorView rowRange(int first, int count) const { return TensorView(row(first), count, numCols, rowStride); }
+
+    // 모든 행 시작이 bytes 정렬인지 (SIMD 정렬 로드 사용 가능 여부)
+    bool aligned(size_t bytes) const {
+        return reinterpret_cast<uintptr_t>(ptr) % bytes == 0 && (static_cast<size_t>(rowStride) * sizeof(T)) % bytes == 0;
+    }
+
+private:
+    T* ptr = nullptr;
+    int numRows = 0;
+    int numCols = 0;
+    int rowStride = 0;
+};
+
+template <typename T>
+class Tensor {
+public:
+    static constexpr size_t ALIGNMENT = 64;  // 캐시 라인 = AVX-512 레지스터 폭
+    static constexpr int STRIDE_MULTIPLE = static_cast<int>(ALIGNMENT / sizeof(T));  // float 16개, half 32개
+
+    // cols를 정렬 단위 배수로 올린 행 간격
+    static constexpr int paddedStride(int cols) { return (cols + STRIDE_MULTIPLE - 1) / STRIDE_MULTIPLE * STRIDE_MULTIPLE; }
+
+    Tensor() = default;
+    explicit Tensor(memory_accounting::Tag tag) : accountTag(tag) {}
+    Tensor(int rows, int cols, memory_accounting::Tag tag = memory_accounting::OTHER) : accountTag(tag) { reset(rows, cols); }
+    ~Tensor() { release(); }
+
+    Tensor(const Tensor&) = delete;
+    Tensor& operator=(const Tensor&) = delete;
+    Tensor(Tensor&& other) noexcept { swap(other); }
+    Tensor& operator=(Tensor&& other) noexcept {
+        Tensor(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    // rows x cols로 다시 할당하고 0으로 채움 (실패하면 empty, 크기 0)
+    bool reset(int rows, int cols) {
+        release();
+        if (rows <= 0 || cols <= 0) return rows == 0 || cols == 0;
+
+        const int stride = paddedStride(cols);
+        const size_t bytes = static_cast<size_t>(rows) * stride * sizeof(T);  // 행 간격이 ALIGNMENT 배수 → 전체도 배수
+        ptr = static_cast<T*>(memory_accounting::allocate(accountTag, bytes, ALIGNMENT));
+        if (!ptr) return false;
+        std::memset(ptr, 0, bytes);
+        numRows = rows;
+        numCols = cols;
+        rowStride = stride;
+        return true;
+    }
+
+    void fill(T value) {
+        for (int i = 0; i < numRows; i++) {
+            T* r = row(i);
+            for (int j = 0; j < numCols; j++) r[j] = value;
+        }
+    }
+
+    T* data() { return ptr; }
+    const T* data() const { return ptr; }
+    int rows() const { return numRows; }
+    int cols() const { return numCols; }
+    int stride() const { return rowStride; }
+    bool empty() const { return ptr == nullptr; }
+    memory_accounting::Tag tag() const { return accountTag; }
+    size_t bytes() const { return static_cast<size_t>(numRows) * rowStride * sizeof(T); }  // 패딩 포함
+
+    T* row(int i) { return ptr + static_cast<size_t>(i) * rowStride; }
+    const T* row(int i) const { return ptr + static_cast<size_t>(i) * rowStride; }
+    T& operator()(int i, int j) { return row(i)[j]; }
+    const T& operator()(int i, int j) const { return row(i)[j]; }
+
+    TensorView<T> view() { return TensorView<T>(ptr, numRows, numCols, rowStride); }
+    TensorView<const T> view() const { return TensorView<const T>(ptr, numRows, numCols, rowStride); }
+    operator TensorView<T>() { return view(); }
+    operator TensorView<const T>() const { return view(); }
+
+    void swap(Tensor& other) noexcept {
+        std::swap(ptr, other.ptr);
+        std::swap(numRows, other.numRows);
+        std::swap(numCols, other.numCols);
+        std::swap(rowStride, other.rowStride);
+        std::swap(accountTag, other.accountTag);
+    }
+
+private:
+    void release() {
+        memory_accounting::deallocate(accountTag, ptr, bytes());
+        ptr = nullptr;
+        numRows = numCols = rowStride = 0;
+    }
+
+    memory_accounting::Tag accountTag = memory_accounting::OTHER;
+    T* ptr = nullptr;
+    int numRows = 0;
+    int numCols = 0;
+    int rowStride = 0;
+};
+
+using Matrix = Tensor<float>;
+using MatrixView = TensorView<const float>;
+
+#endif // TENSOR_H
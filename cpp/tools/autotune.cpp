@@ -0,0 +1,105 @@
+/**
+ * 커널 블록/타일/배치 크기 자동 튜닝 (네이티브 전용)
+ *
+ *   make autotune
+ *   ./build/native/autotune [--output build/native/kernel_profile.txt] [--repeats 7]
+ *   SIGN_KERNEL_PROFILE=build/native/kernel_profile.txt ./build/native/replay_harness ...
+ *
+ * 현재 기기에서 파라미터마다 후보 값을 차례로 적용해 중앙값 시간을 재고 (kernel_tuning::autotune)
+ * 후보별 시간, 기본값 대비 승자의 속도 향상을 출력한 뒤 프로필 파일로 저장
+ * - 코어: matvec.block, mlp.batch (SignRecognizer::autotuneKernels)
+ * - 보조: gemm.block (matrixMultiplyLarge), blur.tile (processImageData 가우시안)
+ * 브라우저가 유휴 조각마다 한 단계씩 부르는 autotuneKernelStep의 단계별 소요 시간도 출력
+ * 저장한 파일을 다시 읽어 같은 값이 복원되지 않거나 단계 API가 승자를 적용하지 않으면 종료 코드 2
+ */
+
+#include "aux_kernels.h"
+#include "kernel_tuning.h"
+#include "sign_recognition.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace {
+
+struct Options {
+    std::string output = "build/native/kernel_profile.txt";
+    int repeats = 7;
+};
+
+void printSweep(kernel_tuning::Param p, const kernel_tuning::Sweep& sweep) {
+    const kernel_tuning::ParamInfo& param = kernel_tuning::info(p);
+    std::printf("\n%s (default %d)\n", param.key, param.defaultValue);
+    double defaultUs = 0.0, winnerUs = 0.0;
+    for (int c = 0; c < sweep.count; c++) {
+        const int value = param.candidates[c];
+        if (value == param.defaultValue) defaultUs = sweep.medianUs[c];
+        if (value == sweep.winner) winnerUs = sweep.medianUs[c];
+        std::printf("  %6d %12.1f us%s%s\n", value, sweep.medianUs[c], value == sweep.winner ? "  <- winner" : "",
+                    value == param.defaultValue ? "  (default)" : "");
+    }
+    if (defaultUs > 0.0 && winnerUs > 0.0) std::printf("  speedup vs default: %.2fx\n", defaultUs / winnerUs);
+}
+
+// 단계마다 승자가 적용되고 범위 밖 단계는 -1인지 확인 (단계별 시간은 브라우저 유휴 조각 하나의 비용)
+bool checkSteps(int repeats) {
+    static const kernel_tuning::Param STEP_PARAMS[SignRecognizer::AUTOTUNE_STEPS] = {kernel_tuning::MATVEC_BLOCK,
+                                                                                   kernel_tuning::MLP_BATCH};
+    bool ok = true;
+    std::printf("\nautotuneKernelStep (one idle slice each)\n");
+    for (int step = 0; step < SignRecognizer::AUTOTUNE_STEPS; step++) {
+        const auto start = std::chrono::steady_clock::now();
+        const int winner = SignRecognizer::autotuneKernelStep(step, repeats);
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        const bool applied = winner >= 0 && kernel_tuning::get(STEP_PARAMS[step]) == winner;
+        std::printf("  step %d %-14s %6d %10.2f ms%s\n", step, kernel_tuning::info(STEP_PARAMS[step]).key, winner, ms,
+                    applied ? "" : "  (not applied)");
+        ok = ok && applied;
+    }
+    const bool ended = SignRecognizer::autotuneKernelStep(SignRecognizer::AUTOTUNE_STEPS, repeats) == -1;
+    if (!ended) std::printf("  step %d did not report the end (-1)\n", SignRecognizer::AUTOTUNE_STEPS);
+    return ok && ended;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--output") opts.output = value();
+        else if (arg == "--repeats") opts.repeats = std::max(1, std::atoi(value()));
+        else {
+            std::fprintf(stderr, "usage: autotune [--output PATH] [--repeats N]\n");
+            return 1;
+        }
+    }
+
+    std::printf("target %s, %d repeats per candidate (median)\n", kernel_tuning::target(), opts.repeats);
+    kernel_tuning::Sweep sweeps[kernel_tuning::PARAM_COUNT];
+    SignRecognizer::autotuneKernels(opts.repeats, sweeps);
+    autotuneMatrixKernels(opts.repeats, &sweeps[kernel_tuning::GEMM_BLOCK]);
+    autotuneImageKernels(opts.repeats, &sweeps[kernel_tuning::BLUR_TILE]);
+    for (int p = 0; p < kernel_tuning::PARAM_COUNT; p++) printSweep(kernel_tuning::Param(p), sweeps[p]);
+
+    std::string error;
+    const std::string profile = kernel_tuning::serialize();
+    if (!kernel_tuning::saveFile(opts.output, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+
+    // 저장한 파일이 같은 값으로 복원되는지 확인 (기본값으로 되돌린 뒤 다시 읽음)
+    kernel_tuning::resetDefaults();
+    bool ok = kernel_tuning::loadFile(opts.output, &error) && kernel_tuning::serialize() == profile;
+    std::printf("\nprofile -> %s\n%s", opts.output.c_str(), profile.c_str());
+    if (!ok) std::printf("round trip: %s\n", error.empty() ? "values differ" : error.c_str());
+    const bool stepsOk = checkSteps(opts.repeats);
+    std::printf("\n%s\n", !ok ? "FAILED: profile round trip" : stepsOk ? "OK" : "FAILED: autotuneKernelStep");
+    ok = ok && stepsOk;
+    return ok ? 0 : 2;
+}
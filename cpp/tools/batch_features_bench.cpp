@@ -0,0 +1,185 @@
+/**
+ * 일괄 특징 추출 검증/벤치마크 (네이티브 전용)
+ *
+ *   make batchfeat
+ *   ./build/native/batch_features_bench --hands 200000 --repeat 5
+ *
+ * 1) 일치: 데이터셋 행의 왼손/오른손(행 간격 126에서 바로 읽기, 좌표가 모두 0인 손 포함)을
+ *    batch_features::extractComplexFeatures로 뽑아 손마다 SignRecognizer::extractComplexFeatures(비공개, recognizer_internals.h)와 비교
+ *    (최대 절대 오차 1e-5 이하, recognizeFromFeatures 결과 id 동일)
+ * 2) 꼬리: 손 1..17개 묶음(빈 레인 포함)이 전체 묶음과 비트 단위로 같은지
+ * 3) 속도: 데이터셋 손을 반복해 --hands개로 늘린 뒤 손마다 extractComplexFeatures와
+ *    일괄 추출의 손당 시간 (일괄 추출은 --chunk개씩 재사용 행렬에 기록 = 배치 추론에 넘기는 오프라인 작업 형태)
+ * 하나라도 어긋나면 종료 코드 2
+ */
+
+#include "batch_features.h"
+#include "dataset_io.h"
+#include "recognizer_internals.h"
+#include "sign_recognition.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string dataset = "../notebooks/sign_dataset.csv";
+    std::string labels = "../public/models/labels.json";
+    int hands = 200000;
+    int chunk = 256;
+    int repeat = 5;
+};
+
+std::vector<HandLandmark> toHand(const float* hand) {
+    std::vector<HandLandmark> landmarks(21);
+    for (int i = 0; i < 21; i++) landmarks[i] = HandLandmark{hand[i * 3], hand[i * 3 + 1], hand[i * 3 + 2]};
+    return landmarks;
+}
+
+template <typename F>
+double nsPerHand(int repeat, size_t hands, F&& fn) {
+    fn();  // 워밍업
+    auto start = Clock::now();
+    for (int r = 0; r < repeat; r++) fn();
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (double(repeat) * hands);
+}
+
+volatile float sink;  // 측정 루프가 지워지지 않도록
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--dataset") opts.dataset = value();
+        else if (arg == "--labels") opts.labels = value();
+        else if (arg == "--hands") opts.hands = std::max(1, std::atoi(value()));
+        else if (arg == "--chunk") opts.chunk = std::max(1, std::atoi(value()));
+        else if (arg == "--repeat") opts.repeat = std::max(1, std::atoi(value()));
+        else {
+            std::fprintf(stderr, "usage: batch_features_bench [--hands N] [--chunk N] [--repeat N] [--dataset PATH] [--labels PATH]\n");
+            return 1;
+        }
+    }
+
+    std::string error;
+    std::vector<std::string> labels;
+    LabeledDataset data;
+    if (!loadLabelsJson(opts.labels, labels, &error) || !loadDatasetCsv(opts.dataset, labels, data, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    if (data.dim != 2 * batch_features::HAND_FLOATS) {
+        std::fprintf(stderr, "error: expected %d features per row, got %d\n", 2 * batch_features::HAND_FLOATS, data.dim);
+        return 1;
+    }
+
+    const int F = batch_features::FEATURES;
+    const int rows = static_cast<int>(data.size());
+    SignRecognizer reference;
+    SignRecognizer batchRecognizer;
+    reference.initialize();
+    batchRecognizer.initialize();
+    bool ok = true;
+
+    // 1. 데이터셋 행에서 바로 (손마다 행 간격 126)
+    std::vector<float> batch(static_cast<size_t>(2) * rows * F);
+    for (int h = 0; h < 2; h++) {
+        batch_features::extractComplexFeatures(data.features.data() + h * batch_features::HAND_FLOATS, rows, data.dim,
+                                               batch.data() + static_cast<size_t>(h) * rows * F, F);
+    }
+    double maxError = 0.0;
+    int identicalRows = 0, decisionMismatches = 0;
+    float extended[5];
+    for (int h = 0; h < 2; h++) {
+        for (int r = 0; r < rows; r++) {
+            const float* hand = data.row(r) + h * batch_features::HAND_FLOATS;
+            const std::vector<HandLandmark> landmarks = toHand(hand);
+            const std::vector<float> expected = SignRecognizerInternals::extractComplexFeatures(reference, landmarks);
+            const float* actual = batch.data() + (static_cast<size_t>(h) * rows + r) * F;
+            double rowError = 0.0;
+            for (int k = 0; k < F; k++) rowError = std::max(rowError, double(std::fabs(expected[k] - actual[k])));
+            maxError = std::max(maxError, rowError);
+            identicalRows += std::memcmp(expected.data(), actual, F * sizeof(float)) == 0;
+
+            // 같은 펴짐 플래그로 신경망 판정 비교
+            reference.fingerExtensionFlags(landmarks, extended);
+            const RecognitionResult a = reference.recognizeFromFeatures(expected.data(), F, extended);
+            const RecognitionResult b = batchRecognizer.recognizeFromFeatures(actual, F, extended);
+            if (a.id != b.id && decisionMismatches++ < 5) {
+                std::printf("mismatch hand %d row %d: expected %d got %d\n", h, r, a.id, b.id);
+            }
+        }
+    }
+    std::printf("%d hands from %d rows: max |batch - extractComplexFeatures| = %.3e, bit-identical %d/%d, decisions differ %d\n",
+                2 * rows, rows, maxError, identicalRows, 2 * rows, decisionMismatches);
+    ok = ok && maxError <= 1e-5 && decisionMismatches == 0;
+
+    // 2. 꼬리 묶음 (손 n개 = 빈 레인 LANES - n % LANES개)
+    int tailDiffers = 0;
+    std::vector<float> tail(static_cast<size_t>(17) * F);
+    for (int n = 1; n <= 17 && n <= rows; n++) {
+        const int first = (n * 13) % (rows - n + 1);
+        batch_features::extractComplexFeatures(data.row(first), n, data.dim, tail.data(), F);
+        tailDiffers += std::memcmp(tail.data(), batch.data() + static_cast<size_t>(first) * F, static_cast<size_t>(n) * F * sizeof(float)) != 0;
+    }
+    std::printf("tail batches 1..17 hands: %d differ from full batch\n\n", tailDiffers);
+    ok = ok && tailDiffers == 0;
+
+    // 3. 속도 (감지된 손만 모아 --hands개로 반복)
+    std::vector<float> pool;
+    for (int r = 0; r < rows; r++) {
+        for (int h = 0; h < 2; h++) {
+            const float* hand = data.row(r) + h * batch_features::HAND_FLOATS;
+            if (std::any_of(hand, hand + batch_features::HAND_FLOATS, [](float v) { return v != 0.0f; })) {
+                pool.insert(pool.end(), hand, hand + batch_features::HAND_FLOATS);
+            }
+        }
+    }
+    const size_t poolHands = pool.size() / batch_features::HAND_FLOATS;
+    if (poolHands == 0) {
+        std::fprintf(stderr, "error: no hands in dataset\n");
+        return 1;
+    }
+    const size_t hands = static_cast<size_t>(opts.hands);
+    std::vector<float> landmarks(hands * batch_features::HAND_FLOATS);
+    std::vector<std::vector<HandLandmark>> handVectors(hands);
+    for (size_t i = 0; i < hands; i++) {
+        const float* hand = pool.data() + (i % poolHands) * batch_features::HAND_FLOATS;
+        std::copy(hand, hand + batch_features::HAND_FLOATS, landmarks.begin() + i * batch_features::HAND_FLOATS);
+        handVectors[i] = toHand(hand);
+    }
+    const size_t chunk = std::min(hands, static_cast<size_t>(opts.chunk));
+    std::vector<float> matrix(chunk * F);
+
+    const double perHandNs = nsPerHand(opts.repeat, hands, [&] {
+        for (size_t i = 0; i < hands; i++) sink = SignRecognizerInternals::extractComplexFeatures(reference, handVectors[i])[0];
+    });
+    const double batchNs = nsPerHand(opts.repeat, hands, [&] {
+        for (size_t first = 0; first < hands; first += chunk) {
+            const int count = static_cast<int>(std::min(chunk, hands - first));
+            batch_features::extractComplexFeatures(landmarks.data() + first * batch_features::HAND_FLOATS, count,
+                                                   batch_features::HAND_FLOATS, matrix.data(), F);
+            sink = matrix[0];
+        }
+    });
+
+    std::printf("%zu hands x %d repeats (%zu distinct), batch chunk %zu\n", hands, opts.repeat, poolHands, chunk);
+    std::printf("%-40s %10s %14s\n", "path", "ns/hand", "hands/s");
+    std::printf("%-40s %10.1f %14.0f\n", "SignRecognizer::extractComplexFeatures", perHandNs, 1e9 / perHandNs);
+    std::printf("%-40s %10.1f %14.0f  (%.2fx)\n", "batch_features (8 hands / lane group)", batchNs, 1e9 / batchNs, perHandNs / batchNs);
+
+    std::printf("\n%s\n", ok ? "OK: batch features match per-hand extraction" : "FAILED: batch features differ");
+    return ok ? 0 : 2;
+}
@@ -0,0 +1,176 @@
+/**
+ * ConvolutionEngine 정확도/성능 벤치마크 (네이티브 전용)
+ *
+ *   make convolution
+ *   ./build/native/convolution_bench --length 8192 --frames 8192
+ *
+ * 1) 단일 채널: 커널 길이별 DIRECT / FFT / 기존 스칼라 루프 시간, double 기준 최대 오차, AUTO 선택
+ * 2) 다채널: 데이터셋 한 손 좌표 63채널을 frames 길이 시계열로 이어 붙여
+ *    convolveChannels(DIRECT / FFT)와 채널별 스칼라 루프를 비교
+ * FFT/DIRECT 결과가 double 기준과 허용 오차(출력 최대 크기 대비 1e-4) 이상 다르면 종료 코드 2
+ */
+
+#include "convolution.h"
+#include "dataset_io.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string dataset = "../notebooks/sign_dataset.csv";
+    std::string labels = "../public/models/labels.json";
+    int length = 8192;   // 단일 채널 신호 길이
+    int frames = 8192;   // 다채널 시계열 길이
+    int repeat = 20;
+};
+
+// 기존 fastConvolution과 같은 스칼라 valid 상관
+void scalarCorrelate(const float* x, int n, const float* w, int k, float* out, int stride = 1) {
+    for (int i = 0; i + k <= n; i++) {
+        float sum = 0.0f;
+        for (int t = 0; t < k; t++) sum += x[static_cast<size_t>(i + t) * stride] * w[t];
+        out[static_cast<size_t>(i) * stride] = sum;
+    }
+}
+
+// double 기준과의 최대 절대 오차(worst)와 기준 출력 최대 크기(peak)를 누적
+void referenceError(const float* x, int n, const float* w, int k, const float* out, double& worst, double& peak,
+                    int stride = 1) {
+    for (int i = 0; i + k <= n; i++) {
+        double sum = 0.0;
+        for (int t = 0; t < k; t++) sum += double(x[static_cast<size_t>(i + t) * stride]) * w[t];
+        worst = std::max(worst, std::fabs(sum - out[static_cast<size_t>(i) * stride]));
+        peak = std::max(peak, std::fabs(sum));
+    }
+}
+
+template <typename F>
+double timeUs(int repeat, F&& fn) {
+    fn();  // 워밍업 (FFT 스펙트럼 준비 포함)
+    auto start = Clock::now();
+    for (int r = 0; r < repeat; r++) fn();
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / repeat;
+}
+
+// 길이 k 해닝 창 (평활화 커널, 합 1)
+std::vector<float> hannKernel(int k) {
+    std::vector<float> w(k);
+    double sum = 0.0;
+    for (int t = 0; t < k; t++) sum += w[t] = static_cast<float>(0.5 - 0.5 * std::cos(2.0 * M_PI * (t + 1) / (k + 1)));
+    for (float& v : w) v = static_cast<float>(v / sum);
+    return w;
+}
+
+const char* methodName(ConvolutionEngine::Method m) {
+    return m == ConvolutionEngine::FFT ? "fft" : "direct";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--dataset") opts.dataset = value();
+        else if (arg == "--labels") opts.labels = value();
+        else if (arg == "--length") opts.length = std::max(64, std::atoi(value()));
+        else if (arg == "--frames") opts.frames = std::max(64, std::atoi(value()));
+        else if (arg == "--repeat") opts.repeat = std::max(1, std::atoi(value()));
+        else {
+            std::fprintf(stderr, "usage: convolution_bench [--length N] [--frames N] [--repeat N] [--dataset PATH] [--labels PATH]\n");
+            return 1;
+        }
+    }
+
+    const double tolerance = 1e-4;
+    bool ok = true;
+    std::mt19937 rng(7);
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+
+    // 1. 단일 채널
+    std::vector<float> signal(opts.length);
+    for (float& v : signal) v = noise(rng);
+    std::vector<float> out(opts.length);
+    std::printf("single channel, n=%d (us per call)\n", opts.length);
+    std::printf("%6s %10s %10s %10s %8s %10s %10s\n", "k", "scalar", "direct", "fft", "auto", "errDirect", "errFft");
+    ConvolutionEngine engine;
+    for (int k : {3, 7, 15, 31, 63, 127, 255, 511, 1023}) {
+        if (k > opts.length) break;
+        std::vector<float> kernel = hannKernel(k);
+        engine.setKernel(kernel.data(), k);
+        double scalarUs = timeUs(opts.repeat, [&] { scalarCorrelate(signal.data(), opts.length, kernel.data(), k, out.data()); });
+        double directUs = timeUs(opts.repeat, [&] { engine.convolve(signal.data(), opts.length, out.data(), ConvolutionEngine::DIRECT); });
+        auto maxError = [&] {
+            double worst = 0.0, peak = 1e-12;
+            referenceError(signal.data(), opts.length, kernel.data(), k, out.data(), worst, peak);
+            return worst / peak;
+        };
+        double errDirect = maxError();
+        double fftUs = timeUs(opts.repeat, [&] { engine.convolve(signal.data(), opts.length, out.data(), ConvolutionEngine::FFT); });
+        double errFft = maxError();
+        ConvolutionEngine::Method pick = ConvolutionEngine::choose(opts.length, k);
+        std::printf("%6d %10.1f %10.1f %10.1f %8s %10.2g %10.2g\n", k, scalarUs, directUs, fftUs, methodName(pick),
+                    errDirect, errFft);
+        ok = ok && errDirect < tolerance && errFft < tolerance;
+    }
+
+    // 2. 다채널 (데이터셋 한 손 63좌표 시계열)
+    std::string error;
+    std::vector<std::string> labels;
+    LabeledDataset data;
+    if (!loadLabelsJson(opts.labels, labels, &error) || !loadDatasetCsv(opts.dataset, labels, data, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    const int channels = 63;
+    std::vector<float> series(static_cast<size_t>(opts.frames) * channels);
+    for (int f = 0; f < opts.frames; f++) {
+        const float* row = data.row(f % data.size());
+        const float* hand = row + (row[63] != 0.0f || row[64] != 0.0f ? 63 : 0);  // 오른손 우선
+        std::copy(hand, hand + channels, series.begin() + static_cast<size_t>(f) * channels);
+    }
+    std::vector<float> multiOut(series.size());
+    std::printf("\n%d channels x %d frames (us per call, all channels)\n", channels, opts.frames);
+    std::printf("%6s %10s %10s %10s %8s %10s %10s\n", "k", "scalar", "direct", "fft", "auto", "errDirect", "errFft");
+    for (int k : {5, 9, 15, 31, 63, 127, 255}) {
+        std::vector<float> kernel = hannKernel(k);
+        engine.setKernel(kernel.data(), k);
+        double scalarUs = timeUs(opts.repeat, [&] {
+            for (int c = 0; c < channels; c++) scalarCorrelate(series.data() + c, opts.frames, kernel.data(), k, multiOut.data() + c, channels);
+        });
+        // 항상 0인 채널(손목 z 등)이 있으므로 오차는 전체 채널의 출력 최대 크기 대비
+        auto maxError = [&] {
+            double worst = 0.0, peak = 1e-12;
+            for (int c = 0; c < channels; c++) {
+                referenceError(series.data() + c, opts.frames, kernel.data(), k, multiOut.data() + c, worst, peak, channels);
+            }
+            return worst / peak;
+        };
+        double directUs = timeUs(opts.repeat, [&] {
+            engine.convolveChannels(series.data(), opts.frames, channels, multiOut.data(), ConvolutionEngine::DIRECT);
+        });
+        double errDirect = maxError();
+        double fftUs = timeUs(opts.repeat, [&] {
+            engine.convolveChannels(series.data(), opts.frames, channels, multiOut.data(), ConvolutionEngine::FFT);
+        });
+        double errFft = maxError();
+        ConvolutionEngine::Method pick = ConvolutionEngine::choose(opts.frames, k, channels);
+        std::printf("%6d %10.1f %10.1f %10.1f %8s %10.2g %10.2g\n", k, scalarUs, directUs, fftUs, methodName(pick),
+                    errDirect, errFft);
+        ok = ok && errDirect < tolerance && errFft < tolerance;
+    }
+
+    std::printf("\n%s\n", ok ? "OK" : "FAILED: error above tolerance");
+    return ok ? 0 : 2;
+}
@@ -0,0 +1,210 @@
+/**
+ * SIMD 초월 함수 근사 오차/속도 측정 (네이티브 전용)
+ *
+ *   make fastmath
+ *   ./build/native/fast_math_bench --samples 2000000
+ *
+ * 1) 오차: fast_math::acos / atan2 / exp를 촘촘한 표본에서 double 표준 함수와 비교해 최대 오차를 출력하고
+ *    fast_math.h 주석에 적은 한계(acos, atan2 절대 4e-7 rad, exp 상대 4e-7)를 넘거나 acos(±1), exp(0)이
+ *    정확하지 않으면 실패
+ * 2) 일치: 스칼라 함수와 배열 함수(16/8/꼬리 경로)가 같은 입력에 비트 단위로 같은 값을 내는지
+ * 3) 속도: 값 하나당 ns. 기준은 두 가지: 함수 포인터로 부르는 스칼라 호출(특징 루프의 push_back 사이 호출, libmvec이 없는
+ *    WASM과 같은 형태)과 네이티브 -ffast-math가 libmvec으로 벡터화한 std:: 루프
+ *    데이터셋 프레임의 각도 24개/회전 60개를 한 번에 계산할 때 프레임당 시간
+ * 하나라도 어긋나면 종료 코드 2
+ */
+
+#include "dataset_io.h"
+#include "fast_math.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string dataset = "../notebooks/sign_dataset.csv";
+    std::string labels = "../public/models/labels.json";
+    int samples = 2000000;
+    int repeat = 20;
+};
+
+template <typename F>
+double nsPerValue(int repeat, size_t values, F&& fn) {
+    fn();  // 워밍업
+    auto start = Clock::now();
+    for (int r = 0; r < repeat; r++) fn();
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (double(repeat) * values);
+}
+
+template <typename F>
+double usPerFrame(int repeat, size_t frames, F&& fn) {
+    return nsPerValue(repeat, frames, fn) / 1000.0;
+}
+
+bool sameBits(float a, float b) {
+    return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+volatile float sink;  // 측정 루프가 지워지지 않도록
+
+// 컴파일러가 벡터화하지 못하는 스칼라 호출 (특징 루프 안의 호출과 같은 형태)
+float (*volatile scalarAcos)(float) = ::acosf;
+float (*volatile scalarAtan2)(float, float) = ::atan2f;
+float (*volatile scalarExp)(float) = ::expf;
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--dataset") opts.dataset = value();
+        else if (arg == "--labels") opts.labels = value();
+        else if (arg == "--samples") opts.samples = std::max(1000, std::atoi(value()));
+        else if (arg == "--repeat") opts.repeat = std::max(1, std::atoi(value()));
+        else {
+            std::fprintf(stderr, "usage: fast_math_bench [--samples N] [--repeat N] [--dataset PATH] [--labels PATH]\n");
+            return 1;
+        }
+    }
+
+    std::string error;
+    std::vector<std::string> labels;
+    LabeledDataset data;
+    if (!loadLabelsJson(opts.labels, labels, &error) || !loadDatasetCsv(opts.dataset, labels, data, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    bool ok = true;
+    const int n = opts.samples;
+
+    // 1. 오차 (표본: acos [-1, 1] 균등, atan2 각도 균등 × 크기 1e-3..1e3, exp [-87, 88] 균등)
+    std::vector<float> cosines(n), ys(n), xs(n), exps(n), out(n);
+    for (int i = 0; i < n; i++) {
+        cosines[i] = -1.0f + 2.0f * static_cast<float>(i) / (n - 1);
+        const double theta = -M_PI + 2.0 * M_PI * i / (n - 1);
+        const double radius = std::pow(10.0, -3.0 + 6.0 * ((i * 7919LL) % n) / n);
+        ys[i] = static_cast<float>(radius * std::sin(theta));
+        xs[i] = static_cast<float>(radius * std::cos(theta));
+        exps[i] = -87.0f + 175.0f * static_cast<float>(i) / (n - 1);
+    }
+
+    double acosError = 0.0, atan2Error = 0.0, expError = 0.0;
+    fast_math::applyLanes(cosines.data(), out.data(), n, [](__m256 c) { return fast_math::acos(c); });  // 라디안 (도 변환 반올림 제외)
+    for (int i = 0; i < n; i++) acosError = std::max(acosError, std::fabs(out[i] - std::acos(double(cosines[i]))));
+    fast_math::atan2(ys.data(), xs.data(), out.data(), n);
+    for (int i = 0; i < n; i++) atan2Error = std::max(atan2Error, std::fabs(out[i] - std::atan2(double(ys[i]), double(xs[i]))));
+    fast_math::exp(exps.data(), out.data(), n);
+    for (int i = 0; i < n; i++) {
+        const double expected = std::exp(double(exps[i]));
+        expError = std::max(expError, std::fabs(out[i] - expected) / expected);
+    }
+    const bool exact = fast_math::acosDegrees(1.0f) == 0.0f && std::fabs(fast_math::acosDegrees(-1.0f) - 180.0f) <= 1e-5f &&
+                       fast_math::exp(0.0f) == 1.0f && fast_math::atan2(0.0f, 0.0f) == 0.0f &&
+                       std::fabs(fast_math::atan2(0.0f, -1.0f) - float(M_PI)) <= 1e-6f;
+    std::printf("%-8s %14s %10s\n", "function", "max error", "limit");
+    std::printf("%-8s %14.3e %10.0e  (abs, rad)\n", "acos", acosError, 4e-7);
+    std::printf("%-8s %14.3e %10.0e  (abs, rad)\n", "atan2", atan2Error, 4e-7);
+    std::printf("%-8s %14.3e %10.0e  (relative)\n", "exp", expError, 4e-7);
+    std::printf("exact points acos(+-1), exp(0), atan2(0,0), atan2(0,-1): %s\n", exact ? "ok" : "WRONG");
+    ok = ok && acosError < 4e-7 && atan2Error < 4e-7 && expError < 4e-7 && exact;
+
+    // 2. 스칼라 = 배열 (각 길이 1..40으로 16/8/꼬리 경로를 모두 지나게)
+    int differing = 0;
+    for (int length = 1; length <= 40; length++) {
+        const int offset = (length * 104729) % (n - 40);
+        float vector[40];
+        fast_math::acosDegrees(&cosines[offset], vector, length);
+        for (int i = 0; i < length; i++) differing += !sameBits(vector[i], fast_math::acosDegrees(cosines[offset + i]));
+        fast_math::atan2(&ys[offset], &xs[offset], vector, length);
+        for (int i = 0; i < length; i++) differing += !sameBits(vector[i], fast_math::atan2(ys[offset + i], xs[offset + i]));
+        fast_math::exp(&exps[offset], vector, length);
+        for (int i = 0; i < length; i++) differing += !sameBits(vector[i], fast_math::exp(exps[offset + i]));
+    }
+    std::printf("scalar vs array: %d values differ\n\n", differing);
+    ok = ok && differing == 0;
+
+    // 3. 속도 (값 하나당)
+    const int timed = std::min(n, 1 << 16);
+    std::printf("%-8s %14s %14s %12s\n", "function", "scalar ns/val", "std loop ns/val", "fast ns/val");
+    auto timeScalar = [&](auto fn) {
+        return nsPerValue(opts.repeat, timed, [&] {
+            for (int i = 0; i < timed; i++) out[i] = fn(i);
+            sink = out[timed - 1];
+        });
+    };
+    const double callAcos = timeScalar([&](int i) { return scalarAcos(cosines[i]) * 57.2957795f; });
+    const double stdAcos = timeScalar([&](int i) { return static_cast<float>(std::acos(cosines[i]) * 180.0f / M_PI); });
+    const double fastAcos = nsPerValue(opts.repeat, timed, [&] {
+        fast_math::acosDegrees(cosines.data(), out.data(), timed);
+        sink = out[timed - 1];
+    });
+    const double callAtan2 = timeScalar([&](int i) { return scalarAtan2(ys[i], xs[i]); });
+    const double stdAtan2 = timeScalar([&](int i) { return std::atan2(ys[i], xs[i]); });
+    const double fastAtan2 = nsPerValue(opts.repeat, timed, [&] {
+        fast_math::atan2(ys.data(), xs.data(), out.data(), timed);
+        sink = out[timed - 1];
+    });
+    const double callExp = timeScalar([&](int i) { return scalarExp(exps[i]); });
+    const double stdExp = timeScalar([&](int i) { return std::exp(exps[i]); });
+    const double fastExp = nsPerValue(opts.repeat, timed, [&] {
+        fast_math::exp(exps.data(), out.data(), timed);
+        sink = out[timed - 1];
+    });
+    std::printf("%-8s %14.3f %14.3f %12.3f  (%.1fx vs scalar)\n", "acos", callAcos, stdAcos, fastAcos, callAcos / fastAcos);
+    std::printf("%-8s %14.3f %14.3f %12.3f  (%.1fx vs scalar)\n", "atan2", callAtan2, stdAtan2, fastAtan2, callAtan2 / fastAtan2);
+    std::printf("%-8s %14.3f %14.3f %12.3f  (%.1fx vs scalar)\n", "exp", callExp, stdExp, fastExp, callExp / fastExp);
+
+    // 데이터셋 프레임 단위: 각도 24개(손가락 5 + 곡률 19), 관절 회전 20개 x (pitch, yaw, roll)
+    static const int tips[5] = {4, 8, 12, 16, 20}, pips[5] = {3, 6, 10, 14, 18}, mcps[5] = {2, 5, 9, 13, 17};
+    const size_t frames = data.size();
+    std::vector<float> frameCosines(frames * 24), rotY(frames * 60), rotX(frames * 60);
+    for (size_t r = 0; r < frames; r++) {
+        const float* hand = std::any_of(data.row(r) + 63, data.row(r) + 126, [](float v) { return v != 0.0f; }) ? data.row(r) + 63 : data.row(r);
+        auto x = [hand](int i) { return hand[i * 3]; };
+        auto y = [hand](int i) { return hand[i * 3 + 1]; };
+        auto z = [hand](int i) { return hand[i * 3 + 2]; };
+        float* c = &frameCosines[r * 24];
+        for (int k = 0; k < 5; k++) {
+            c[k] = fast_math::cosineBetween(x(tips[k]) - x(pips[k]), y(tips[k]) - y(pips[k]), x(mcps[k]) - x(pips[k]), y(mcps[k]) - y(pips[k]));
+        }
+        for (int i = 1; i < 20; i++) c[4 + i] = fast_math::cosineBetween(x(i - 1) - x(i), y(i - 1) - y(i), x(i + 1) - x(i), y(i + 1) - y(i));
+        for (int j = 0; j < 20; j++) {
+            const float dx = x(j + 1) - x(0), dy = y(j + 1) - y(0), dz = z(j + 1) - z(0);
+            float* fy = &rotY[r * 60];
+            float* fx = &rotX[r * 60];
+            fy[j] = dy, fx[j] = std::sqrt(dx * dx + dz * dz);
+            fy[20 + j] = dx, fx[20 + j] = dz;
+            fy[40 + j] = dx, fx[40 + j] = dy;
+        }
+    }
+    float angles[24], rotations[60];
+    const double stdFrame = usPerFrame(opts.repeat, frames, [&] {
+        for (size_t r = 0; r < frames; r++) {
+            for (int k = 0; k < 24; k++) angles[k] = scalarAcos(frameCosines[r * 24 + k]) * 57.2957795f;
+            for (int k = 0; k < 60; k++) rotations[k] = scalarAtan2(rotY[r * 60 + k], rotX[r * 60 + k]);
+            sink = angles[23] + rotations[59];
+        }
+    });
+    const double fastFrame = usPerFrame(opts.repeat, frames, [&] {
+        for (size_t r = 0; r < frames; r++) {
+            fast_math::acosDegrees(&frameCosines[r * 24], angles, 24);
+            fast_math::atan2(&rotY[r * 60], &rotX[r * 60], rotations, 60);
+            sink = angles[23] + rotations[59];
+        }
+    });
+    std::printf("\nper frame (24 acos + 60 atan2): scalar calls %.3f us, fast %.3f us (%.1fx)\n", stdFrame, fastFrame, stdFrame / fastFrame);
+
+    std::printf("\n%s\n", ok ? "OK: errors within documented bounds, scalar and array paths identical" : "FAILED: error bound or identity");
+    return ok ? 0 : 2;
+}
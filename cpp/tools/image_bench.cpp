@@ -0,0 +1,169 @@
+/**
+ * 적분 영상 박스 필터 / 손 ROI 추정 검증·벤치마크 (네이티브 전용, aux_image.cpp 직접 링크)
+ *
+ *   make image
+ *   ./build/native/image_bench --width 640 --height 480
+ *
+ * 배경 잡음 위에 정지한 피부색 영역(얼굴)과 움직이는 피부색 타원(손)이 있는 합성 프레임 두 장으로
+ * 1) boxFilter가 단순 (2r+1)^2 평균과 바이트 단위로 같은지, 반지름별 시간
+ * 2) estimateHandRoi(피부색만 / 피부색+움직임) 상자와 실제 손 상자의 IoU, ROI 크롭 후 픽셀 감소율
+ * 을 출력한다. 박스 필터가 다르거나 움직임 ROI의 IoU가 0.5 미만이면 종료 코드 2
+ */
+
+#include "aux_kernels.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Box {
+    int x, y, w, h;
+};
+
+template <typename F>
+double timeUs(int repeat, F&& fn) {
+    fn();
+    auto start = Clock::now();
+    for (int r = 0; r < repeat; r++) fn();
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / repeat;
+}
+
+void fillEllipse(std::vector<uint8_t>& img, int width, int height, const Box& b, const uint8_t rgb[3], std::mt19937& rng) {
+    std::uniform_int_distribution<int> jitter(-6, 6);
+    const float cx = b.x + b.w * 0.5f, cy = b.y + b.h * 0.5f;
+    for (int y = std::max(0, b.y); y < std::min(height, b.y + b.h); y++) {
+        for (int x = std::max(0, b.x); x < std::min(width, b.x + b.w); x++) {
+            float dx = (x + 0.5f - cx) / (b.w * 0.5f), dy = (y + 0.5f - cy) / (b.h * 0.5f);
+            if (dx * dx + dy * dy > 1.0f) continue;
+            uint8_t* p = &img[(static_cast<size_t>(y) * width + x) * 4];
+            for (int c = 0; c < 3; c++) p[c] = static_cast<uint8_t>(std::min(255, std::max(0, rgb[c] + jitter(rng))));
+        }
+    }
+}
+
+// 청회색 잡음 배경 + 얼굴(고정) + 손(hand 위치)
+std::vector<uint8_t> makeFrame(int width, int height, const Box& face, const Box& hand, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> noise(-12, 12);
+    std::vector<uint8_t> img(static_cast<size_t>(width) * height * 4);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            uint8_t* p = &img[(static_cast<size_t>(y) * width + x) * 4];
+            int base = 60 + 80 * x / width;
+            p[0] = static_cast<uint8_t>(std::max(0, base - 20 + noise(rng)));
+            p[1] = static_cast<uint8_t>(std::max(0, base + noise(rng)));
+            p[2] = static_cast<uint8_t>(std::min(255, base + 40 + noise(rng)));
+            p[3] = 255;
+        }
+    }
+    const uint8_t faceRgb[3] = {205, 150, 125}, handRgb[3] = {220, 170, 140};
+    fillEllipse(img, width, height, face, faceRgb, rng);
+    fillEllipse(img, width, height, hand, handRgb, rng);
+    return img;
+}
+
+void naiveBox(const std::vector<uint8_t>& src, std::vector<uint8_t>& dst, int width, int height, int r) {
+    dst.resize(src.size());
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            const int x0 = std::max(0, x - r), x1 = std::min(width, x + r + 1);
+            const int y0 = std::max(0, y - r), y1 = std::min(height, y + r + 1);
+            const float inv = 1.0f / ((x1 - x0) * (y1 - y0));
+            for (int c = 0; c < 4; c++) {
+                int sum = 0;
+                for (int yy = y0; yy < y1; yy++) {
+                    for (int xx = x0; xx < x1; xx++) sum += src[(static_cast<size_t>(yy) * width + xx) * 4 + c];
+                }
+                dst[(static_cast<size_t>(y) * width + x) * 4 + c] = static_cast<uint8_t>(std::lrint(static_cast<float>(sum) * inv));
+            }
+        }
+    }
+}
+
+double iou(const Box& a, const Box& b) {
+    int ix = std::max(0, std::min(a.x + a.w, b.x + b.w) - std::max(a.x, b.x));
+    int iy = std::max(0, std::min(a.y + a.h, b.y + b.h) - std::max(a.y, b.y));
+    double inter = double(ix) * iy;
+    return inter / (double(a.w) * a.h + double(b.w) * b.h - inter);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int width = 640, height = 480, repeat = 20, step = 4;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() { return i + 1 < argc ? std::atoi(argv[++i]) : 0; };
+        if (arg == "--width") width = std::max(32, value());
+        else if (arg == "--height") height = std::max(32, value());
+        else if (arg == "--repeat") repeat = std::max(1, value());
+        else if (arg == "--step") step = std::max(1, value());
+        else {
+            std::fprintf(stderr, "usage: image_bench [--width N] [--height N] [--repeat N] [--step N]\n");
+            return 1;
+        }
+    }
+
+    const Box face{width * 55 / 100, height / 10, width / 5, height * 3 / 10};
+    const Box handPrev{width / 10, height / 2, width / 6, height / 4};
+    const Box hand{width / 10 + width / 40, height / 2 - height / 30, width / 6, height / 4};
+    std::vector<uint8_t> previous = makeFrame(width, height, face, handPrev, 1);
+    std::vector<uint8_t> frame = makeFrame(width, height, face, hand, 2);
+    bool ok = true;
+
+    // 1. 박스 필터
+    std::printf("%dx%d RGBA (us per frame)\n", width, height);
+    std::vector<uint8_t> work, reference;
+    double gaussUs = timeUs(repeat, [&] {
+        work = frame;
+        processImageData(work.data(), width, height, 0);
+    });
+    std::printf("gaussian 5x5 (filterType 0): %10.1f\n", gaussUs);
+    std::printf("%8s %12s %12s %8s\n", "radius", "naive", "integral", "match");
+    for (int r : {2, 4, 8, 16, 32}) {
+        double naiveUs = r <= 8 ? timeUs(std::max(1, repeat / 10), [&] { naiveBox(frame, reference, width, height, r); }) : 0.0;
+        if (r > 8) naiveBox(frame, reference, width, height, r);  // 큰 반지름은 검증용으로 한 번만
+        double integralUs = timeUs(repeat, [&] {
+            work = frame;
+            boxFilter(work.data(), width, height, r);
+        });
+        bool match = work == reference;
+        ok = ok && match;
+        if (naiveUs > 0.0) std::printf("%8d %12.1f %12.1f %8s\n", r, naiveUs, integralUs, match ? "yes" : "NO");
+        else std::printf("%8d %12s %12.1f %8s\n", r, "-", integralUs, match ? "yes" : "NO");
+    }
+
+    // 2. 손 ROI
+    int skinBox[4] = {0, 0, width, height}, motionBox[4] = {0, 0, width, height};
+    int skinPixels = 0, motionPixels = 0;
+    double skinUs = timeUs(repeat, [&] { skinPixels = estimateHandRoi(frame.data(), nullptr, width, height, step, skinBox); });
+    double motionUs = timeUs(repeat, [&] {
+        motionPixels = estimateHandRoi(frame.data(), previous.data(), width, height, step, motionBox);
+    });
+    std::vector<uint8_t> crop(frame.size());
+    int cropped = 0;
+    double cropUs = timeUs(repeat, [&] { cropped = cropRegion(frame.data(), width, height, motionBox, crop.data()); });
+
+    const Box skinRoi{skinBox[0], skinBox[1], skinBox[2], skinBox[3]};
+    const Box motionRoi{motionBox[0], motionBox[1], motionBox[2], motionBox[3]};
+    std::printf("\nhand ROI (step %d, true hand %d,%d %dx%d)\n", step, hand.x, hand.y, hand.w, hand.h);
+    std::printf("skin only:     %8.1f us  %6d px  box %d,%d %dx%d  IoU %.2f\n", skinUs, skinPixels, skinRoi.x,
+                skinRoi.y, skinRoi.w, skinRoi.h, skinPixels ? iou(skinRoi, hand) : 0.0);
+    std::printf("skin + motion: %8.1f us  %6d px  box %d,%d %dx%d  IoU %.2f\n", motionUs, motionPixels, motionRoi.x,
+                motionRoi.y, motionRoi.w, motionRoi.h, motionPixels ? iou(motionRoi, hand) : 0.0);
+    std::printf("crop:          %8.1f us  %d of %d px (%.1fx fewer)\n", cropUs, cropped, width * height,
+                cropped ? double(width) * height / cropped : 0.0);
+    ok = ok && motionPixels > 0 && iou(motionRoi, hand) >= 0.5 && cropped > 0;
+
+    std::printf("\n%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 2;
+}
@@ -0,0 +1,277 @@
+/**
+ * 인식 서버 부하 생성기 (네이티브 전용)
+ *
+ * 세션마다 스레드 하나가 서버에 연결해 sign_dataset.csv 프레임을 보내고,
+ * 왕복 지연(p50/p99/p999), 처리량, labels.json 기준 정확도(MLP 엔진)를 보고한다.
+ *
+ *   ./build/native/load_generator --sessions 64 --frames 2000 --fps 30
+ *   ./build/native/load_generator --spawn-server --sessions 64   # 같은 프로세스에서 서버도 실행
+ */
+
+#include "dataset_io.h"
+#include "recognition_server.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using server::Clock;
+
+struct Options {
+    std::string socketPath = "/tmp/sign_recognition.sock";
+    std::string dataset = "../notebooks/sign_dataset.csv";
+    std::string scaler = "../public/models/scaler.json";
+    std::string labels = "../public/models/labels.json";
+    int sessions = 16;
+    int frames = 1000;        // 세션당 프레임 수
+    int fps = 0;              // 세션당 전송 속도 (0 = 최대 속도)
+    int window = 8;           // 세션당 응답 대기 중 최대 프레임 수
+    uint32_t engine = server::ENGINE_MLP;
+    bool spawnServer = false;
+    int workers = 0;
+    server::BatcherConfig batcher;
+};
+
+struct SessionResult {
+    std::vector<double> rttUs;
+    double serverUsSum = 0.0;
+    size_t correct = 0;
+    size_t received = 0;
+    size_t rejected = 0;  // CLASS_REJECTED 응답 (정확도/지연 집계에서 제외)
+    bool failed = false;
+};
+
+bool sendAll(int fd, const void* data, size_t size) {
+    const char* p = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t n = send(fd, p, size, MSG_NOSIGNAL);
+        if (n <= 0) return false;
+        p += n;
+        size -= n;
+    }
+    return true;
+}
+
+bool recvAll(int fd, void* data, size_t size) {
+    char* p = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t n = recv(fd, p, size, 0);
+        if (n <= 0) return false;
+        p += n;
+        size -= n;
+    }
+    return true;
+}
+
+// 세션 하나: 송신 스레드(이 함수)와 수신 스레드를 분리해 응답을 도착 즉시 읽음
+// (송신 속도 조절 중에도 응답이 소켓 버퍼에 쌓여 왕복 지연이 부풀려지지 않도록)
+void runSession(int index, const Options& opts, const LabeledDataset& data, SessionResult& out) {
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, opts.socketPath.c_str(), sizeof(addr.sun_path) - 1);
+    if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        out.failed = true;
+        if (fd >= 0) close(fd);
+        return;
+    }
+
+    std::vector<Clock::time_point> sentAt(opts.frames);
+    std::vector<Clock::time_point> recvAt(opts.frames);
+    std::vector<int> expected(opts.frames);
+    std::vector<int> predicted(opts.frames, -1);
+    std::vector<float> serverUs(opts.frames, 0.0f);
+
+    std::mutex mutex;
+    std::condition_variable windowOpen;
+    int inFlight = 0;
+    bool receiverFailed = false;
+
+    std::thread receiver([&]() {
+        for (int n = 0; n < opts.frames; n++) {
+            server::ResultMessage result;
+            if (!recvAll(fd, &result, sizeof(result)) || result.magic != server::RESULT_MAGIC ||
+                result.frameId >= static_cast<uint32_t>(opts.frames)) {
+                std::lock_guard<std::mutex> lock(mutex);
+                receiverFailed = true;
+                windowOpen.notify_one();
+                return;
+            }
+            recvAt[result.frameId] = Clock::now();
+            predicted[result.frameId] = result.classId;
+            serverUs[result.frameId] = result.serverLatencyUs;
+            std::lock_guard<std::mutex> lock(mutex);
+            inFlight--;
+            windowOpen.notify_one();
+        }
+    });
+
+    const auto interval = opts.fps > 0 ? std::chrono::microseconds(1000000 / opts.fps) : std::chrono::microseconds(0);
+    Clock::time_point nextSend = Clock::now();
+    int sent = 0;
+
+    while (sent < opts.frames) {
+        {
+            // 응답 대기 중인 프레임이 window개면 하나가 돌아올 때까지 대기
+            std::unique_lock<std::mutex> lock(mutex);
+            windowOpen.wait(lock, [&]() { return inFlight < opts.window || receiverFailed; });
+            if (receiverFailed) break;
+            inFlight++;
+        }
+        if (opts.fps > 0) {
+            std::this_thread::sleep_until(nextSend);
+            nextSend += interval;
+        }
+
+        size_t row = (static_cast<size_t>(index) * 7919 + sent) % data.size();  // 세션마다 다른 시작점
+        server::FrameMessage msg;
+        std::memset(&msg, 0, sizeof(msg));
+        msg.magic = server::FRAME_MAGIC;
+        msg.frameId = static_cast<uint32_t>(sent);
+        msg.engine = opts.engine;
+        std::memcpy(msg.payload, data.row(row), std::min(data.dim, server::PAYLOAD_FLOATS) * sizeof(float));
+        expected[sent] = data.labels[row];
+        sentAt[sent] = Clock::now();
+        if (!sendAll(fd, &msg, sizeof(msg))) break;
+        sent++;
+    }
+
+    if (sent < opts.frames) shutdown(fd, SHUT_RDWR);  // 수신 스레드를 깨워 종료
+    receiver.join();
+    close(fd);
+
+    out.failed = receiverFailed || sent < opts.frames;
+    out.rttUs.reserve(sent);
+    for (int i = 0; i < sent; i++) {
+        if (predicted[i] < 0 && recvAt[i] == Clock::time_point()) continue;  // 응답 없음
+        if (predicted[i] == server::CLASS_REJECTED) {
+            out.rejected++;
+            continue;
+        }
+        out.rttUs.push_back(std::chrono::duration<double, std::micro>(recvAt[i] - sentAt[i]).count());
+        out.serverUsSum += serverUs[i];
+        if (predicted[i] == expected[i]) out.correct++;
+        out.received++;
+    }
+}
+
+double percentile(const std::vector<double>& sorted, double q) {
+    if (sorted.empty()) return 0.0;
+    size_t idx = static_cast<size_t>(q * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(idx, sorted.size() - 1)];
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--socket") opts.socketPath = value();
+        else if (arg == "--dataset") opts.dataset = value();
+        else if (arg == "--scaler") opts.scaler = value();
+        else if (arg == "--labels") opts.labels = value();
+        else if (arg == "--sessions") opts.sessions = std::max(1, std::atoi(value()));
+        else if (arg == "--frames") opts.frames = std::max(1, std::atoi(value()));
+        else if (arg == "--fps") opts.fps = std::max(0, std::atoi(value()));
+        else if (arg == "--window") opts.window = std::max(1, std::atoi(value()));
+        else if (arg == "--engine") opts.engine = std::string(value()) == "recognizer" ? server::ENGINE_RECOGNIZER : server::ENGINE_MLP;
+        else if (arg == "--spawn-server") opts.spawnServer = true;
+        else if (arg == "--workers") opts.workers = std::atoi(value());
+        else if (arg == "--max-batch") opts.batcher.maxBatch = std::atoi(value());
+        else if (arg == "--max-latency-us") opts.batcher.maxLatencyUs = std::atoi(value());
+        else if (arg == "--max-queue") opts.batcher.maxQueueFrames = std::atoi(value());
+        else if (arg == "--max-session-frames") opts.batcher.maxSessionFrames = std::atoi(value());
+        else if (arg == "--shed-expired") opts.batcher.shedExpired = std::atoi(value()) != 0;
+        else {
+            std::fprintf(stderr,
+                         "usage: load_generator [--socket PATH] [--sessions N] [--frames N] [--fps N] [--window N]\n"
+                         "                      [--engine mlp|recognizer] [--dataset PATH] [--labels PATH]\n"
+                         "                      [--spawn-server [--scaler PATH] [--workers N] [--max-batch N]\n"
+                         "                       [--max-latency-us N] [--max-queue N] [--max-session-frames N]\n"
+                         "                       [--shed-expired 0|1]]\n");
+            return 1;
+        }
+    }
+
+    std::string error;
+    std::vector<std::string> labels;
+    LabeledDataset data;
+    if (!loadLabelsJson(opts.labels, labels, &error) || !loadDatasetCsv(opts.dataset, labels, data, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+
+    std::unique_ptr<server::RecognitionServer> srv;
+    if (opts.spawnServer) {
+        std::vector<float> mean, scale;
+        if (!loadScalerJson(opts.scaler, mean, scale, &error)) {
+            std::fprintf(stderr, "error: %s\n", error.c_str());
+            return 1;
+        }
+        int workers = opts.workers > 0 ? opts.workers : static_cast<int>(std::thread::hardware_concurrency());
+        srv.reset(new server::RecognitionServer(opts.socketPath, workers, opts.batcher, mean, scale));
+        if (!srv->start(&error)) {
+            std::fprintf(stderr, "error: %s\n", error.c_str());
+            return 1;
+        }
+    }
+
+    std::vector<SessionResult> results(opts.sessions);
+    std::vector<std::thread> threads;
+    Clock::time_point start = Clock::now();
+    for (int s = 0; s < opts.sessions; s++) {
+        threads.emplace_back(runSession, s, std::cref(opts), std::cref(data), std::ref(results[s]));
+    }
+    for (auto& t : threads) t.join();
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::vector<double> rtt;
+    size_t correct = 0, received = 0, rejected = 0, failed = 0;
+    double serverUs = 0.0;
+    for (const auto& r : results) {
+        rtt.insert(rtt.end(), r.rttUs.begin(), r.rttUs.end());
+        correct += r.correct;
+        received += r.received;
+        rejected += r.rejected;
+        serverUs += r.serverUsSum;
+        failed += r.failed ? 1 : 0;
+    }
+    std::sort(rtt.begin(), rtt.end());
+
+    std::printf("sessions=%d frames/session=%d fps=%d window=%d engine=%s\n", opts.sessions, opts.frames, opts.fps,
+                opts.window, opts.engine == server::ENGINE_MLP ? "mlp" : "recognizer");
+    std::printf("received %zu frames in %.2fs (%.0f frames/s), rejected %zu, failed sessions: %zu\n", received, seconds,
+                received / seconds, rejected, failed);
+    std::printf("rtt p50=%.1fus p99=%.1fus p999=%.1fus, mean server latency=%.1fus\n", percentile(rtt, 0.50),
+                percentile(rtt, 0.99), percentile(rtt, 0.999), received ? serverUs / received : 0.0);
+    if (opts.engine == server::ENGINE_MLP && received) {
+        std::printf("accuracy: %.2f%%\n", 100.0 * correct / received);
+    }
+    if (srv) {
+        const server::ServerStats& stats = srv->stats();
+        std::printf("server: %llu batches, avg batch %.1f frames, max queue delay %lluus (limit %dus), rejected %llu\n",
+                    static_cast<unsigned long long>(stats.batches.load()),
+                    stats.batches.load() ? double(stats.framesOut.load()) / stats.batches.load() : 0.0,
+                    static_cast<unsigned long long>(stats.maxQueueDelayUs.load()), opts.batcher.maxLatencyUs,
+                    static_cast<unsigned long long>(stats.framesRejected.load()));
+        srv->stop();
+    }
+    return failed ? 1 : 0;
+}
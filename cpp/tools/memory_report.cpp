@@ -0,0 +1,252 @@
+/**
+ * 서브시스템별 메모리 계정 보고/검증 (네이티브 전용)
+ *
+ *   make memory
+ *   ./build/native/memory_report --sessions 4 --frames 400
+ *
+ * 인식 세션(SignRecognizer + TCN 스트림 + k-NN + 컨볼루션 엔진)을 여러 개 열어 데이터셋 프레임을 돌리고,
+ * 이미지 필터와 대용량 행렬 곱셈을 실행한 뒤 태그별 현재/최대 바이트와 할당 횟수를 출력한다.
+ * 1) 누수: 세션을 모두 닫은 뒤 recognizer/model/temporal/knn/fft/matrix 태그에 남은 바이트가 있으면 실패
+ *    (image의 적분 영상 버퍼는 16MB 이하면 스레드 수명 동안 재사용하므로 제외)
+ * 2) 예산: IMAGE/RECOGNIZER 예산을 작게 걸면 필터는 원본을 유지하고 스테이징 버퍼는 비어 실패 횟수가 늘어야 함
+ *    pmr 사용자(컨볼루션 FFT, 행렬 튜닝, 손 ROI)는 예산을 넘으면 중단 대신 -1/0을 반환해야 함
+ * 3) 스크래치: 보유 한도를 넘는 1080p boxFilter 뒤 IMAGE 현재 바이트가 늘지 않아야 함
+ * 하나라도 어긋나면 종료 코드 2. 마지막에 전체 최대치 기준 INITIAL_MEMORY 제안값을 출력
+ */
+
+#include "aux_kernels.h"
+#include "convolution.h"
+#include "dataset_io.h"
+#include "knn_classifier.h"
+#include "memory_accounting.h"
+#include "sign_recognition.h"
+#include "temporal_conv.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+namespace ma = memory_accounting;
+
+struct Options {
+    std::string dataset = "../notebooks/sign_dataset.csv";
+    std::string labels = "../public/models/labels.json";
+    int sessions = 4;
+    int frames = 400;
+    int heavyFrames = 8;  // TIER_HEAVY는 프레임당 수 ms라 앞 몇 프레임만
+};
+
+std::vector<HandLandmark> toHand(const float* row) {
+    const float* hand = std::any_of(row + 63, row + 126, [](float v) { return v != 0.0f; }) ? row + 63 : row;
+    std::vector<HandLandmark> landmarks(21);
+    for (int i = 0; i < 21; i++) landmarks[i] = HandLandmark{hand[i * 3], hand[i * 3 + 1], hand[i * 3 + 2]};
+    return landmarks;
+}
+
+// 인식 세션 하나가 소유하는 것들 (브라우저 탭 하나에 해당)
+struct Session {
+    SignRecognizer recognizer;
+    std::unique_ptr<TemporalConvState> temporal;
+    KnnClassifier knn{SignRecognition::featureDim(), 5};
+    ConvolutionEngine smoothing;
+};
+
+void printTable(const char* title) {
+    std::printf("\n%s\n", title);
+    std::printf("  %-11s %12s %12s %12s %10s %9s\n", "tag", "live(KB)", "peak(KB)", "allocations", "frees", "failures");
+    for (int t = 0; t <= ma::TAG_COUNT; t++) {
+        const ma::TagStats s = t < ma::TAG_COUNT ? ma::stats(ma::Tag(t)) : ma::totals();
+        if (t < ma::TAG_COUNT && s.allocations == 0 && s.failures == 0) continue;
+        std::printf("  %-11s %12.1f %12.1f %12llu %10llu %9llu\n", t < ma::TAG_COUNT ? ma::tagName(ma::Tag(t)) : "total",
+                    s.liveBytes / 1024.0, s.peakBytes / 1024.0, static_cast<unsigned long long>(s.allocations),
+                    static_cast<unsigned long long>(s.frees), static_cast<unsigned long long>(s.failures));
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--dataset") opts.dataset = value();
+        else if (arg == "--labels") opts.labels = value();
+        else if (arg == "--sessions") opts.sessions = std::max(1, std::atoi(value()));
+        else if (arg == "--frames") opts.frames = std::max(1, std::atoi(value()));
+        else if (arg == "--heavy-frames") opts.heavyFrames = std::max(0, std::atoi(value()));
+        else {
+            std::fprintf(stderr, "usage: memory_report [--sessions N] [--frames N] [--heavy-frames N] [--dataset PATH] [--labels PATH]\n");
+            return 1;
+        }
+    }
+
+    std::string error;
+    std::vector<std::string> labels;
+    LabeledDataset data;
+    if (!loadLabelsJson(opts.labels, labels, &error) || !loadDatasetCsv(opts.dataset, labels, data, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    const size_t frames = std::min(data.size(), static_cast<size_t>(opts.frames));
+    bool ok = true;
+
+    // 1. 인식 세션 (열기 → 프레임 처리 → 닫기)
+    {
+        auto tcn = std::make_shared<TemporalConvModel>(SignRecognition::featureDim(), TemporalConvModel::defaultLayers(), 4);
+        tcn->initializeDeterministic(42);
+        std::shared_ptr<const TemporalConvModel> model = tcn;
+
+        std::vector<std::unique_ptr<Session>> sessions;
+        for (int s = 0; s < opts.sessions; s++) {
+            sessions.emplace_back(new Session());
+            Session& session = *sessions.back();
+            session.recognizer.initialize();
+            session.temporal.reset(new TemporalConvState(model));
+            const float kernel[5] = {0.1f, 0.2f, 0.4f, 0.2f, 0.1f};
+            session.smoothing.setKernel(kernel, 5);
+        }
+
+        std::vector<float> series(static_cast<size_t>(frames) * 63);
+        std::vector<float> smoothed(series.size());
+        for (auto& session : sessions) {
+            float* staging = session->recognizer.getInputBuffer();
+            for (size_t r = 0; r < frames; r++) {
+                const float* row = data.row(r);
+                std::vector<HandLandmark> hand = toHand(row);
+                const int tier = static_cast<int>(r) < opts.heavyFrames ? SignRecognizer::TIER_HEAVY : SignRecognizer::TIER_MLP;
+                session->recognizer.recognizeWithTier(hand, tier);
+                for (int i = 0; i < 21; i++) {
+                    staging[i * 2] = hand[i].x;
+                    staging[i * 2 + 1] = hand[i].y;
+                }
+                session->recognizer.recognizeStaged(1);
+                session->temporal->step(row);
+                session->knn.addSample(row, data.labels[r]);
+                for (int i = 0; i < 21; i++) {
+                    series[r * 63 + i * 3] = hand[i].x;
+                    series[r * 63 + i * 3 + 1] = hand[i].y;
+                    series[r * 63 + i * 3 + 2] = hand[i].z;
+                }
+            }
+            session->smoothing.convolveChannels(series.data(), static_cast<int>(frames), 63, smoothed.data(),
+                                                ConvolutionEngine::FFT);
+        }
+        printTable("sessions open");
+    }
+    printTable("sessions closed");
+    const ma::Tag leakTags[] = {ma::RECOGNIZER, ma::MODEL, ma::TEMPORAL, ma::KNN, ma::FFT};
+    for (ma::Tag tag : leakTags) {
+        if (ma::stats(tag).liveBytes != 0) {
+            std::printf("leak: %s still holds %llu bytes\n", ma::tagName(tag),
+                        static_cast<unsigned long long>(ma::stats(tag).liveBytes));
+            ok = false;
+        }
+    }
+
+    // 2. 보조 커널: 이미지 필터, 대용량 행렬 곱셈 (JavaScript처럼 입력 버퍼를 태그 할당)
+    {
+        const int width = 640, height = 480;
+        std::vector<uint8_t> image(static_cast<size_t>(width) * height * 4);
+        for (size_t i = 0; i < image.size(); i++) image[i] = static_cast<uint8_t>((i * 2654435761u) >> 24);
+        processImageData(image.data(), width, height, 0);
+        processImageData(image.data(), width, height, 1);
+
+        const int size = 256;
+        const int bytes = size * size * static_cast<int>(sizeof(float));
+        float* a = static_cast<float*>(allocateTagged(ma::MATRIX, bytes));
+        float* b = static_cast<float*>(allocateTagged(ma::MATRIX, bytes));
+        float* c = static_cast<float*>(allocateTagged(ma::MATRIX, bytes));
+        if (a && b && c) {
+            for (int i = 0; i < size * size; i++) {
+                a[i] = static_cast<float>(i % 17) * 0.125f;
+                b[i] = static_cast<float>(i % 13) * 0.25f;
+            }
+            matrixMultiplyLarge(a, b, c, size);
+        }
+        freeTagged(a);
+        freeTagged(b);
+        freeTagged(c);
+        if (ma::stats(ma::MATRIX).liveBytes != 0) {
+            std::printf("leak: matrix still holds %llu bytes\n", static_cast<unsigned long long>(ma::stats(ma::MATRIX).liveBytes));
+            ok = false;
+        }
+    }
+    printTable("aux kernels done");
+
+    // 3. 하드 예산: 넘는 할당은 실패하고 호출은 원본 유지/0 반환
+    {
+        const int width = 1280, height = 720;
+        std::vector<uint8_t> image(static_cast<size_t>(width) * height * 4, 0);
+        for (size_t i = 0; i < image.size(); i++) image[i] = static_cast<uint8_t>(i * 31);
+        const std::vector<uint8_t> original = image;
+        const uint64_t imageFailures = ma::stats(ma::IMAGE).failures;
+        ma::setBudget(ma::IMAGE, 1 << 20);  // 1MB < 1280 x 720 x 4
+        processImageData(image.data(), width, height, 0);
+        const bool imageRejected = image == original && ma::stats(ma::IMAGE).failures == imageFailures + 1;
+        ma::setBudget(ma::IMAGE, 0);
+
+        const uint64_t recognizerFailures = ma::stats(ma::RECOGNIZER).failures;
+        ma::setBudget(ma::RECOGNIZER, 4096);  // 스크래치(1KB)는 들어가고 스테이징(10.8KB)은 넘음
+        int staged = -1;
+        {
+            SignRecognizer limited;
+            limited.initialize();
+            staged = limited.recognizeStaged(1);
+        }
+        const bool recognizerRejected = staged == 0 && ma::stats(ma::RECOGNIZER).failures > recognizerFailures;
+        ma::setBudget(ma::RECOGNIZER, 0);
+
+        std::printf("\nbudget image 1MB: %s, recognizer 4KB: %s (last failed tag: %s)\n",
+                    imageRejected ? "rejected" : "NOT rejected", recognizerRejected ? "rejected" : "NOT rejected",
+                    ma::lastFailedTag() >= 0 ? ma::tagName(ma::Tag(ma::lastFailedTag())) : "none");
+        ok = ok && imageRejected && recognizerRejected;
+
+        // pmr 사용자: 지금 바이트 + 1KB 예산이면 버퍼를 키우기 전에 실패 값 반환 (bad_alloc/중단 없음)
+        auto tight = [](ma::Tag tag) { ma::setBudget(tag, ma::stats(tag).liveBytes + 1024); };
+        std::vector<float> signal(4096, 1.0f), taps(63, 0.5f), out(4096);
+        ConvolutionEngine engine;
+        engine.setKernel(taps.data(), static_cast<int>(taps.size()));
+        tight(ma::FFT);
+        const int convolved = engine.convolve(signal.data(), static_cast<int>(signal.size()), out.data(), ConvolutionEngine::FFT);
+        ma::setBudget(ma::FFT, 0);
+        tight(ma::MATRIX);
+        const int tuned = autotuneMatrixKernels(1, nullptr);
+        ma::setBudget(ma::MATRIX, 0);
+        int box[4] = {0, 0, 0, 0};
+        tight(ma::IMAGE);
+        const int roiPixels = estimateHandRoi(image.data(), original.data(), width, height, 2, box);
+        ma::setBudget(ma::IMAGE, 0);
+        const bool pmrRejected = convolved == -1 && tuned == 0 && roiPixels == 0;
+        std::printf("budget pmr users: fft convolve %d, matrix autotune %d, hand roi %d -> %s\n", convolved, tuned, roiPixels,
+                    pmrRejected ? "rejected without abort" : "NOT rejected");
+        ok = ok && pmrRejected;
+    }
+
+    // 전체 최대치 기준 초기 힙 (런타임/스택 여유 1.5배, 64KB wasm 페이지 단위)
+    const uint64_t peak = ma::totals().peakBytes;
+    const uint64_t page = 64 * 1024;
+    const uint64_t suggested = (peak * 3 / 2 + page - 1) / page * page;
+    std::printf("total peak %.1f KB -> suggested INITIAL_MEMORY >= %llu (%.2f MB, Makefile 33554432)\n", peak / 1024.0,
+                static_cast<unsigned long long>(suggested), suggested / (1024.0 * 1024.0));
+    std::printf("%s\n", ma::report().c_str());
+
+    // 4. 적분 영상 스크래치: 보유 한도(16MB)를 넘는 1080p 버퍼는 호출이 끝나면 반납해야 함
+    //    (INITIAL_MEMORY 제안값에 섞이지 않도록 최대치 출력 뒤에 실행)
+    {
+        const uint64_t imageLive = ma::stats(ma::IMAGE).liveBytes;
+        std::vector<uint8_t> large(static_cast<size_t>(1920) * 1080 * 4, 100);
+        boxFilter(large.data(), 1920, 1080, 2);
+        const bool released = ma::stats(ma::IMAGE).liveBytes <= imageLive;
+        std::printf("1080p integral scratch: %s\n", released ? "released" : "RETAINED");
+        ok = ok && released;
+    }
+
+    std::printf("\n%s\n", ok ? "OK: no leaks, budgets enforced" : "FAILED: leak or budget not enforced");
+    return ok ? 0 : 2;
+}
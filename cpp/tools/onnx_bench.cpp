@@ -0,0 +1,613 @@
+/**
+ * ONNX 그래프 실행기 검증/벤치마크 (네이티브 전용)
+ *
+ *   make onnx
+ *   ./build/native/onnx_bench --batch 16 --repeat 200
+ *
+ * 1) 합성 그래프: BatchNorm → Conv1D → BatchNorm → Relu → Flatten → Gemm → Add → Relu → MatMul → Add → Softmax
+ *    (11개 노드)를 메모리에서 만들어 로드하고, 배정밀도 참조 구현과 비교 + 융합 후 5단계인지 확인
+ *    + run() 뒤에도 입력이 그대로 남고 다시 실행하면 같은 출력인지 확인
+ * 2) traning/gesture_mlp.onnx: 외부 데이터 파일(gesture_mlp.onnx.data)이 모델 옆에 없으면
+ *    traning/gesture_weights.npz(같은 학습 결과)에서 모델이 선언한 offset대로 build/native에 다시 만들어 로드
+ *    데이터셋 전 프레임에서 argmax가 SignRecognition::predictMLP와 같고 로짓이 npz 배정밀도 참조와 1e-3 이내인지 확인
+ *    + 같은 파일 바이트를 보조 모듈 C API(aux_onnx.cpp, WASM sign_onnx 모듈의 내보내기)로 로드해 출력이 비트 단위로 같은지 확인
+ * 3) run() 반복 중 힙 할당(operator new, memory_accounting)이 0인지 확인
+ * 하나라도 어긋나면 종료 코드 2. 마지막에 손으로 짠 MLP 경로와 프레임당 시간 비교
+ */
+
+#include "aux_kernels.h"
+#include "dataset_io.h"
+#include "memory_accounting.h"
+#include "onnx_executor.h"
+#include "sign_recognition.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// run() 중 힙 할당을 세기 위한 전역 operator new 교체 (이 도구에서만)
+static std::atomic<size_t> heapAllocations{0};
+
+void* operator new(size_t size) {
+    heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string model = "../traning/gesture_mlp.onnx";
+    std::string npz = "../traning/gesture_weights.npz";
+    std::string dataDir;  // 빈 문자열: 모델 옆 데이터 파일, 없으면 npz에서 build/native에 생성
+    std::string dataset = "../notebooks/sign_dataset.csv";
+    std::string labels = "../public/models/labels.json";
+    std::string scaler = "../public/models/scaler.json";
+    int batch = 16;
+    int repeat = 200;
+};
+
+template <typename F>
+double usPerFrame(int repeat, size_t frames, F&& fn) {
+    fn();  // 워밍업
+    auto start = Clock::now();
+    for (int r = 0; r < repeat; r++) fn();
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / (double(repeat) * frames);
+}
+
+// ---------------------------------------------------------------------------
+// .npz (numpy.savez, 무압축 zip) 읽기
+// ---------------------------------------------------------------------------
+struct NpyArray {
+    std::vector<int> shape;
+    std::vector<float> data;
+};
+
+uint32_t readU32(const std::string& s, size_t pos) {
+    uint32_t v;
+    std::memcpy(&v, s.data() + pos, sizeof(v));
+    return v;
+}
+uint16_t readU16(const std::string& s, size_t pos) {
+    uint16_t v;
+    std::memcpy(&v, s.data() + pos, sizeof(v));
+    return v;
+}
+
+bool loadNpz(const std::string& path, std::map<std::string, NpyArray>& arrays, std::string* error) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        *error = "cannot open " + path;
+        return false;
+    }
+    std::ostringstream buffer;
+    buffer << in.rdbuf();
+    const std::string zip = buffer.str();
+
+    size_t pos = 0;
+    while (pos + 30 <= zip.size() && readU32(zip, pos) == 0x04034b50) {  // 로컬 파일 헤더
+        const uint16_t method = readU16(zip, pos + 8);
+        uint64_t size = readU32(zip, pos + 18);
+        const uint16_t nameLength = readU16(zip, pos + 26), extraLength = readU16(zip, pos + 28);
+        const std::string name = zip.substr(pos + 30, nameLength);
+        for (size_t e = pos + 30 + nameLength; e + 4 <= pos + 30 + nameLength + extraLength;) {
+            const uint16_t id = readU16(zip, e), length = readU16(zip, e + 2);
+            if (id == 0x0001 && size == 0xffffffffu && length >= 16) std::memcpy(&size, zip.data() + e + 12, 8);  // zip64: 원본, 압축 크기
+            e += 4 + length;
+        }
+        const size_t start = pos + 30 + nameLength + extraLength;
+        if (method != 0 || start + size > zip.size()) {
+            *error = path + ": " + name + " is compressed or truncated";
+            return false;
+        }
+
+        // .npy: "\x93NUMPY" + 버전 + 헤더 길이 + 파이썬 dict 헤더 + 데이터
+        const std::string npy = zip.substr(start, static_cast<size_t>(size));
+        if (npy.compare(0, 6, "\x93NUMPY") != 0) {
+            *error = name + " is not an .npy array";
+            return false;
+        }
+        const bool v1 = npy[6] == 1;
+        const size_t headerLength = v1 ? readU16(npy, 8) : readU32(npy, 8);
+        const size_t dataStart = (v1 ? 10 : 12) + headerLength;
+        const std::string header = npy.substr(v1 ? 10 : 12, headerLength);
+        if (header.find("'<f4'") == std::string::npos || header.find("'fortran_order': False") == std::string::npos) {
+            *error = name + " must be little-endian float32 in C order";
+            return false;
+        }
+        NpyArray array;
+        size_t count = 1;
+        const size_t open = header.find('(', header.find("'shape'"));
+        for (const char* p = header.c_str() + open + 1; *p && *p != ')';) {
+            char* end = nullptr;
+            const long dim = std::strtol(p, &end, 10);
+            if (end == p) {
+                p++;
+                continue;
+            }
+            array.shape.push_back(static_cast<int>(dim));
+            count *= static_cast<size_t>(dim);
+            p = end;
+        }
+        if (dataStart + count * sizeof(float) > npy.size()) {
+            *error = name + " is truncated";
+            return false;
+        }
+        array.data.resize(count);
+        std::memcpy(array.data.data(), npy.data() + dataStart, count * sizeof(float));
+        arrays[name.substr(0, name.rfind(".npy"))] = std::move(array);
+        pos = start + static_cast<size_t>(size);
+    }
+    return !arrays.empty();
+}
+
+// gesture_mlp.onnx가 선언한 외부 데이터 배치 (location "gesture_mlp.onnx.data", 나머지 편향은 모델 안에 있음)
+struct ExternalEntry {
+    const char* tensor;
+    const char* npzKey;
+    size_t offset;  // 바이트
+    size_t count;   // float 개수
+};
+const ExternalEntry kGestureMlpLayout[] = {
+    {"net.0.bias", "b1", 0, 128},
+    {"net.6.weight", "w3", 512, 4 * 64},
+    {"net.3.weight", "w2", 1536, 64 * 128},
+    {"net.0.weight", "w1", 34304, 128 * 126},
+};
+
+bool writeExternalData(const std::map<std::string, NpyArray>& npz, const std::string& path, std::string* error) {
+    std::vector<float> blob;
+    for (const ExternalEntry& e : kGestureMlpLayout) {
+        auto it = npz.find(e.npzKey);
+        if (it == npz.end() || it->second.data.size() != e.count) {
+            *error = std::string("npz array ") + e.npzKey + " missing or wrong size for " + e.tensor;
+            return false;
+        }
+        blob.resize(std::max(blob.size(), e.offset / sizeof(float) + e.count));
+        std::copy(it->second.data.begin(), it->second.data.end(), blob.begin() + e.offset / sizeof(float));
+    }
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(blob.data()), static_cast<std::streamsize>(blob.size() * sizeof(float)));
+    if (!out) {
+        *error = "cannot write " + path;
+        return false;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// 합성 모델용 최소 프로토콜 버퍼 쓰기
+// ---------------------------------------------------------------------------
+struct ProtoWriter {
+    std::string bytes;
+
+    void varint(uint64_t v) {
+        for (; v >= 0x80; v >>= 7) bytes += static_cast<char>((v & 0x7f) | 0x80);
+        bytes += static_cast<char>(v);
+    }
+    void key(int field, int wire) { varint(static_cast<uint64_t>(field) << 3 | wire); }
+    void integer(int field, int64_t v) {
+        key(field, 0);
+        varint(static_cast<uint64_t>(v));
+    }
+    void string(int field, const std::string& s) {
+        key(field, 2);
+        varint(s.size());
+        bytes += s;
+    }
+    void message(int field, const ProtoWriter& m) { string(field, m.bytes); }
+    void real(int field, float f) {
+        key(field, 5);
+        bytes.append(reinterpret_cast<const char*>(&f), sizeof(f));
+    }
+};
+
+struct SyntheticAttr {
+    std::string name;
+    int type;  // 1 FLOAT, 2 INT, 7 INTS
+    float f;
+    std::vector<int64_t> ints;
+};
+
+ProtoWriter tensorProto(const std::string& name, const std::vector<int64_t>& dims, const std::vector<float>& data, bool raw) {
+    ProtoWriter t, packedDims;
+    for (int64_t d : dims) packedDims.varint(static_cast<uint64_t>(d));
+    t.string(1, packedDims.bytes);  // packed dims
+    t.integer(2, 1);                // FLOAT
+    t.string(8, name);
+    const std::string payload(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float));
+    t.string(raw ? 9 : 4, payload);  // raw_data 또는 packed float_data
+    return t;
+}
+
+ProtoWriter nodeProto(const std::string& op, const std::vector<std::string>& inputs, const std::string& output,
+                      const std::vector<SyntheticAttr>& attrs = {}) {
+    ProtoWriter n;
+    for (const std::string& i : inputs) n.string(1, i);
+    n.string(2, output);
+    n.string(3, output);
+    n.string(4, op);
+    for (const SyntheticAttr& a : attrs) {
+        ProtoWriter w;
+        w.string(1, a.name);
+        if (a.type == 1) w.real(2, a.f);
+        else if (a.type == 2) w.integer(3, a.ints[0]);
+        else for (int64_t v : a.ints) w.integer(8, v);  // 필드마다 varint (unpacked)
+        w.integer(20, a.type);
+        n.message(5, w);
+    }
+    return n;
+}
+
+ProtoWriter valueInfo(const std::string& name, const std::vector<int64_t>& dims) {
+    ProtoWriter shape;
+    for (int64_t d : dims) {
+        ProtoWriter dim;
+        if (d < 0) dim.string(2, "N");
+        else dim.integer(1, d);
+        shape.message(1, dim);
+    }
+    ProtoWriter tensorType, type, info;
+    tensorType.integer(1, 1);
+    tensorType.message(2, shape);
+    type.message(1, tensorType);
+    info.string(1, name);
+    info.message(2, type);
+    return info;
+}
+
+std::vector<float> randomVector(size_t n, uint32_t& seed, float lo, float hi) {
+    std::vector<float> v(n);
+    for (float& x : v) {
+        seed = seed * 1664525u + 1013904223u;
+        x = lo + (hi - lo) * static_cast<float>(seed >> 8) / 16777216.0f;
+    }
+    return v;
+}
+
+// 합성 그래프 상수 (입력 [N, C, L])
+constexpr int SC = 4, SL = 12, SM = 6, SK = 3, SPAD = 2, SDIL = 2, SH = 5, SO = 3;
+constexpr int SLOUT = SL + 2 * SPAD - SDIL * (SK - 1);  // stride 1
+
+struct SyntheticModel {
+    std::string bytes;
+    std::map<std::string, std::vector<float>> params;
+};
+
+SyntheticModel buildSynthetic() {
+    SyntheticModel m;
+    uint32_t seed = 7;
+    auto param = [&](const std::string& name, size_t n, float lo, float hi) { return m.params[name] = randomVector(n, seed, lo, hi); };
+    param("bn0.scale", SC, 0.5f, 1.5f), param("bn0.B", SC, -0.2f, 0.2f), param("bn0.mean", SC, -0.3f, 0.3f), param("bn0.var", SC, 0.5f, 2.0f);
+    param("conv.W", SM * SC * SK, -0.4f, 0.4f), param("conv.B", SM, -0.1f, 0.1f);
+    param("bn1.scale", SM, 0.5f, 1.5f), param("bn1.B", SM, -0.2f, 0.2f), param("bn1.mean", SM, -0.3f, 0.3f), param("bn1.var", SM, 0.5f, 2.0f);
+    param("fc.W", SH * SM * SLOUT, -0.2f, 0.2f), param("fc.C", SH, -0.1f, 0.1f), param("fc.add", SH, -0.1f, 0.1f);
+    param("head.W", SH * SO, -0.5f, 0.5f), param("head.add", SO, -0.1f, 0.1f);
+
+    ProtoWriter graph;
+    const auto bn = [&](const std::string& prefix, const std::string& in, const std::string& out) {
+        return nodeProto("BatchNormalization", {in, prefix + ".scale", prefix + ".B", prefix + ".mean", prefix + ".var"}, out,
+                         {{"epsilon", 1, 1e-3f, {}}});
+    };
+    graph.message(1, bn("bn0", "x", "n0"));
+    graph.message(1, nodeProto("Conv", {"n0", "conv.W", "conv.B"}, "c1",
+                               {{"pads", 7, 0, {SPAD, SPAD}}, {"dilations", 7, 0, {SDIL}}, {"kernel_shape", 7, 0, {SK}}}));
+    graph.message(1, bn("bn1", "c1", "n1"));
+    graph.message(1, nodeProto("Relu", {"n1"}, "r1"));
+    graph.message(1, nodeProto("Flatten", {"r1"}, "f1", {{"axis", 2, 0, {1}}}));
+    graph.message(1, nodeProto("Gemm", {"f1", "fc.W", "fc.C"}, "g1",
+                               {{"alpha", 1, 0.5f, {}}, {"beta", 1, 2.0f, {}}, {"transB", 2, 0, {1}}}));
+    graph.message(1, nodeProto("Add", {"g1", "fc.add"}, "a1"));
+    graph.message(1, nodeProto("Relu", {"a1"}, "r2"));
+    graph.message(1, nodeProto("MatMul", {"r2", "head.W"}, "m1"));
+    graph.message(1, nodeProto("Add", {"head.add", "m1"}, "a2"));  // 상수가 앞 입력
+    graph.message(1, nodeProto("Softmax", {"a2"}, "probs", {{"axis", 2, 0, {-1}}}));
+    graph.string(2, "synthetic");
+
+    const std::map<std::string, std::vector<int64_t>> dims = {
+        {"bn0.scale", {SC}}, {"bn0.B", {SC}}, {"bn0.mean", {SC}}, {"bn0.var", {SC}}, {"conv.W", {SM, SC, SK}},
+        {"conv.B", {SM}},    {"bn1.scale", {SM}}, {"bn1.B", {SM}}, {"bn1.mean", {SM}}, {"bn1.var", {SM}},
+        {"fc.W", {SH, SM * SLOUT}}, {"fc.C", {SH}}, {"fc.add", {SH}}, {"head.W", {SH, SO}}, {"head.add", {SO}}};
+    bool raw = true;
+    for (const auto& p : m.params) {
+        graph.message(5, tensorProto(p.first, dims.at(p.first), p.second, raw));
+        raw = !raw;  // raw_data와 float_data를 번갈아
+    }
+    graph.message(11, valueInfo("x", {-1, SC, SL}));
+    graph.message(12, valueInfo("probs", {-1, SO}));
+
+    ProtoWriter opset, model;
+    opset.integer(2, 17);
+    model.integer(1, 8);  // ir_version
+    model.message(8, opset);
+    model.message(7, graph);
+    m.bytes = model.bytes;
+    return m;
+}
+
+// 합성 그래프 배정밀도 참조 (융합 없이 노드 순서대로)
+std::vector<double> syntheticReference(const std::map<std::string, std::vector<float>>& p, const float* x) {
+    auto bn = [&](const std::string& prefix, std::vector<double>& v, int channels, int length) {
+        for (int c = 0; c < channels; c++) {
+            const double s = p.at(prefix + ".scale")[c] / std::sqrt(double(p.at(prefix + ".var")[c]) + 1e-3);
+            for (int l = 0; l < length; l++) {
+                double& y = v[c * length + l];
+                y = (y - p.at(prefix + ".mean")[c]) * s + p.at(prefix + ".B")[c];
+            }
+        }
+    };
+    std::vector<double> in(x, x + SC * SL);
+    bn("bn0", in, SC, SL);
+    std::vector<double> conv(SM * SLOUT);
+    for (int o = 0; o < SM; o++) {
+        for (int t = 0; t < SLOUT; t++) {
+            double sum = p.at("conv.B")[o];
+            for (int c = 0; c < SC; c++) {
+                for (int k = 0; k < SK; k++) {
+                    const int pos = t + k * SDIL - SPAD;
+                    if (pos >= 0 && pos < SL) sum += p.at("conv.W")[(o * SC + c) * SK + k] * in[c * SL + pos];
+                }
+            }
+            conv[o * SLOUT + t] = sum;
+        }
+    }
+    bn("bn1", conv, SM, SLOUT);
+    for (double& v : conv) v = std::max(v, 0.0);
+    std::vector<double> hidden(SH);
+    for (int h = 0; h < SH; h++) {
+        double sum = 0.0;
+        for (int i = 0; i < SM * SLOUT; i++) sum += p.at("fc.W")[h * SM * SLOUT + i] * conv[i];
+        hidden[h] = std::max(0.5 * sum + 2.0 * p.at("fc.C")[h] + p.at("fc.add")[h], 0.0);
+    }
+    std::vector<double> out(SO);
+    double peak = -1e300, total = 0.0;
+    for (int o = 0; o < SO; o++) {
+        double sum = p.at("head.add")[o];
+        for (int h = 0; h < SH; h++) sum += hidden[h] * p.at("head.W")[h * SO + o];
+        out[o] = sum;
+        peak = std::max(peak, sum);
+    }
+    for (double& v : out) total += (v = std::exp(v - peak));
+    for (double& v : out) v /= total;
+    return out;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--model") opts.model = value();
+        else if (arg == "--npz") opts.npz = value();
+        else if (arg == "--data-dir") opts.dataDir = value();
+        else if (arg == "--dataset") opts.dataset = value();
+        else if (arg == "--labels") opts.labels = value();
+        else if (arg == "--scaler") opts.scaler = value();
+        else if (arg == "--batch") opts.batch = std::max(1, std::atoi(value()));
+        else if (arg == "--repeat") opts.repeat = std::max(1, std::atoi(value()));
+        else {
+            std::fprintf(stderr,
+                         "usage: onnx_bench [--batch N] [--repeat N] [--model PATH] [--data-dir DIR] [--npz PATH] "
+                         "[--dataset PATH] [--labels PATH] [--scaler PATH]\n");
+            return 1;
+        }
+    }
+
+    std::string error;
+    std::vector<std::string> labels;
+    std::vector<float> mean, scale;
+    LabeledDataset data;
+    if (!loadLabelsJson(opts.labels, labels, &error) || !loadDatasetCsv(opts.dataset, labels, data, &error) ||
+        !loadScalerJson(opts.scaler, mean, scale, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    bool ok = true;
+
+    // 1. 합성 그래프 (모든 지원 연산 + 융합)
+    {
+        const SyntheticModel synthetic = buildSynthetic();
+        OnnxModel model;
+        const int rows = 3;
+        if (!model.loadFromMemory(reinterpret_cast<const uint8_t*>(synthetic.bytes.data()), synthetic.bytes.size(), nullptr, 0, rows,
+                                  &error)) {
+            std::fprintf(stderr, "synthetic model: %s\n", error.c_str());
+            return 1;
+        }
+        std::printf("synthetic: %s", model.describe().c_str());
+        uint32_t seed = 99;
+        double maxDiff = 0.0;
+        std::vector<std::vector<float>> inputs;
+        for (int r = 0; r < rows; r++) {
+            inputs.push_back(randomVector(SC * SL, seed, -1.0f, 1.0f));
+            std::copy(inputs[r].begin(), inputs[r].end(), model.input() + r * model.inputStride());
+        }
+        const float* out = model.run(rows);
+        for (int r = 0; r < rows; r++) {
+            std::vector<double> expected = syntheticReference(synthetic.params, inputs[r].data());
+            for (int o = 0; o < SO; o++) maxDiff = std::max(maxDiff, std::fabs(expected[o] - out[r * model.outputStride() + o]));
+        }
+        const bool fused = model.nodeCount() == 11 && model.stepCount() == 5;
+        // run() 뒤에도 입력이 그대로 남아 다시 채우지 않고 재실행해도 같은 출력
+        std::vector<float> first(out, out + rows * model.outputStride());
+        bool inputKept = true;
+        for (int r = 0; r < rows; r++) {
+            inputKept = inputKept && std::equal(inputs[r].begin(), inputs[r].end(), model.input() + r * model.inputStride());
+        }
+        out = model.run(rows);
+        const bool rerunSame = std::equal(first.begin(), first.end(), out);
+        std::printf("synthetic: max |diff| vs double reference %.2e, %d nodes -> %d steps%s\n", maxDiff, model.nodeCount(),
+                    model.stepCount(), fused ? "" : " (expected 5)");
+        std::printf("synthetic: input %s after run(), rerun output %s\n\n", inputKept ? "kept" : "CLOBBERED",
+                    rerunSame ? "identical" : "DIFFERS");
+        ok = ok && maxDiff < 1e-4 && fused && inputKept && rerunSame;
+    }
+
+    // 2. traning/gesture_mlp.onnx (외부 데이터 파일이 없으면 npz에서 생성)
+    std::map<std::string, NpyArray> npz;
+    if (!loadNpz(opts.npz, npz, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    std::string dataDir = opts.dataDir;
+    const size_t slash = opts.model.find_last_of('/');
+    const std::string modelDir = slash == std::string::npos ? "." : opts.model.substr(0, slash);
+    if (dataDir.empty() && !std::ifstream(modelDir + "/gesture_mlp.onnx.data")) {
+        dataDir = "build/native";
+        if (!writeExternalData(npz, dataDir + "/gesture_mlp.onnx.data", &error)) {
+            std::fprintf(stderr, "error: %s\n", error.c_str());
+            return 1;
+        }
+        std::printf("external data missing next to model -> rebuilt %s/gesture_mlp.onnx.data from %s\n", dataDir.c_str(),
+                    opts.npz.c_str());
+    }
+
+    OnnxModel model;
+    if (!model.loadFile(opts.model, opts.batch, &error, dataDir)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    std::printf("%s: %s", opts.model.c_str(), model.describe().c_str());
+    const int dim = SignRecognition::featureDim();
+    if (model.inputSize() != dim || model.outputSize() != SignRecognition::numClasses()) {
+        std::fprintf(stderr, "error: model is %d -> %d, expected %d -> %d\n", model.inputSize(), model.outputSize(), dim,
+                     SignRecognition::numClasses());
+        return 1;
+    }
+
+    SignRecognition mlp;
+    mlp.setScaler(mean, scale);
+    const size_t frames = data.size();
+    std::vector<float> scaled(frames * dim);
+    for (size_t r = 0; r < frames; r++) {
+        for (int j = 0; j < dim; j++) scaled[r * dim + j] = (data.row(r)[j] - mean[j]) / scale[j];
+    }
+
+    // npz 가중치 배정밀도 참조 로짓
+    auto reference = [&npz](const float* x) {
+        std::vector<double> a(x, x + 126);
+        const char* layers[3][2] = {{"w1", "b1"}, {"w2", "b2"}, {"w3", "b3"}};
+        for (int l = 0; l < 3; l++) {
+            const NpyArray& w = npz.at(layers[l][0]);
+            const NpyArray& b = npz.at(layers[l][1]);
+            std::vector<double> next(w.shape[0]);
+            for (int o = 0; o < w.shape[0]; o++) {
+                double sum = b.data[o];
+                for (int i = 0; i < w.shape[1]; i++) sum += double(w.data[o * w.shape[1] + i]) * a[i];
+                next[o] = l < 2 ? std::max(sum, 0.0) : sum;
+            }
+            a = next;
+        }
+        return a;
+    };
+
+    int mismatches = 0;
+    double maxDiff = 0.0;
+    for (size_t first = 0; first < frames; first += opts.batch) {
+        const int count = static_cast<int>(std::min<size_t>(opts.batch, frames - first));
+        for (int b = 0; b < count; b++) {
+            std::copy(&scaled[(first + b) * dim], &scaled[(first + b) * dim] + dim, model.input() + b * model.inputStride());
+        }
+        const float* logits = model.run(count);
+        for (int b = 0; b < count; b++) {
+            const size_t r = first + b;
+            const float* row = logits + b * model.outputStride();
+            const int predicted = static_cast<int>(std::max_element(row, row + model.outputSize()) - row);
+            const int expected = mlp.predictMLPFromPointer(data.row(r));
+            if (predicted != expected && mismatches++ < 5) std::printf("mismatch frame %zu: onnx %d, predictMLP %d\n", r, predicted, expected);
+            std::vector<double> ref = reference(&scaled[r * dim]);
+            for (int o = 0; o < model.outputSize(); o++) maxDiff = std::max(maxDiff, std::fabs(ref[o] - row[o]));
+        }
+    }
+    std::printf("%zu frames: %d argmax mismatches vs predictMLP, max |logit diff| vs npz double reference %.2e\n", frames,
+                mismatches, maxDiff);
+    ok = ok && mismatches == 0 && maxDiff < 1e-3;
+
+    // 2-1. 보조 모듈 C API (브라우저가 sign_onnx 모듈에서 부르는 경로, 같은 바이트 → 같은 출력)
+    {
+        auto readBytes = [](const std::string& path) {
+            std::ifstream in(path, std::ios::binary);
+            return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        };
+        const std::vector<uint8_t> modelBytes = readBytes(opts.model);
+        const std::vector<uint8_t> dataBytes = readBytes((dataDir.empty() ? modelDir : dataDir) + "/gesture_mlp.onnx.data");
+        OnnxSession* session = onnxCreate();
+        bool same = onnxLoad(session, modelBytes.data(), static_cast<int>(modelBytes.size()), dataBytes.data(),
+                             static_cast<int>(dataBytes.size()), opts.batch) == 1;
+        if (!same) std::printf("aux onnx module: load failed: %s\n", onnxError(session));
+        const int count = static_cast<int>(std::min<size_t>(opts.batch, frames));
+        for (int b = 0; same && b < count; b++) {
+            std::copy(&scaled[b * dim], &scaled[b * dim] + dim, model.input() + b * model.inputStride());
+            std::copy(&scaled[b * dim], &scaled[b * dim] + dim, onnxInputBuffer(session) + b * onnxInputStride(session));
+        }
+        const float* expected = same ? model.run(count) : nullptr;
+        const float* actual = same ? onnxRun(session, count) : nullptr;
+        same = same && actual && onnxOutputStride(session) == model.outputStride() &&
+               std::equal(expected, expected + count * model.outputStride(), actual) &&
+               std::string(onnxDescribe(session)) == model.describe();
+        std::printf("aux onnx module (C API, %zu + %zu bytes): %d rows %s\n", modelBytes.size(), dataBytes.size(), count,
+                    same ? "identical to OnnxModel" : "DIFFER");
+        onnxDestroy(session);
+        ok = ok && same;
+    }
+
+    // 3. 실행 중 할당 0 + 시간
+    const size_t heapBefore = heapAllocations.load();
+    const uint64_t taggedBefore = memory_accounting::totals().allocations;
+    const double onnxSingleUs = usPerFrame(opts.repeat, frames, [&] {
+        for (size_t r = 0; r < frames; r++) {
+            float* in = model.input();
+            const float* f = data.row(r);
+            for (int j = 0; j < dim; j++) in[j] = (f[j] - mean[j]) / scale[j];
+            model.run(1);
+        }
+    });
+    const double onnxBatchUs = usPerFrame(opts.repeat, frames, [&] {
+        for (size_t first = 0; first < frames; first += opts.batch) {
+            const int count = static_cast<int>(std::min<size_t>(opts.batch, frames - first));
+            for (int b = 0; b < count; b++) {
+                float* in = model.input() + b * model.inputStride();
+                const float* f = data.row(first + b);
+                for (int j = 0; j < dim; j++) in[j] = (f[j] - mean[j]) / scale[j];
+            }
+            model.run(count);
+        }
+    });
+    const size_t runAllocations = (heapAllocations.load() - heapBefore) + (memory_accounting::totals().allocations - taggedBefore);
+    ok = ok && runAllocations == 0;
+
+    std::vector<int> predictions(frames);
+    const double mlpUs = usPerFrame(opts.repeat, frames, [&] {
+        for (size_t r = 0; r < frames; r++) predictions[r] = mlp.predictMLPFromPointer(data.row(r));
+    });
+    const double mlpBatchUs = usPerFrame(opts.repeat, frames, [&] { mlp.predictMLPBatch(data.features.data(), static_cast<int>(frames), predictions.data()); });
+
+    std::printf("\n%-36s %10s\n", "path (scaler included)", "us/frame");
+    std::printf("%-36s %10.3f\n", "SignRecognition::predictMLP", mlpUs);
+    std::printf("%-36s %10.3f\n", "SignRecognition::predictMLPBatch", mlpBatchUs);
+    std::printf("%-36s %10.3f  (%.2fx vs predictMLP)\n", "OnnxModel::run(1)", onnxSingleUs, mlpUs / onnxSingleUs);
+    std::printf("%-36s %10.3f  (%.2fx vs predictMLPBatch)\n", ("OnnxModel::run(" + std::to_string(opts.batch) + ")").c_str(),
+                onnxBatchUs, mlpBatchUs / onnxBatchUs);
+    std::printf("allocations during run(): %zu, arena %zu bytes, %zu MACs/frame\n", runAllocations, model.arenaBytes(),
+                model.macsPerRow());
+
+    std::printf("\n%s\n", ok ? "OK: ONNX executor matches references with zero run-time allocations" : "FAILED: mismatch or allocation");
+    return ok ? 0 : 2;
+}
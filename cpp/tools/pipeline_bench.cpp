@@ -0,0 +1,268 @@
+/**
+ * 비동기 파이프라인(RecognitionPipeline) 벤치마크 (네이티브 전용)
+ *
+ *   make pipeline
+ *   ./build/native/pipeline_bench --frames 20000            # 캡처 속도 제한 없음 (추론보다 빠르게 밀어 넣음)
+ *   ./build/native/pipeline_bench --frames 3000 --fps 240    # 카메라처럼 일정 간격
+ *
+ * 데이터셋 행(한 손 21 x (x, y))을 캡처 프레임으로 사용해
+ * 1) 동기: 캡처 스레드에서 직접 recognizeStaged(1) → 캡처 루프가 프레임마다 막히는 시간
+ * 2) 파이프라인 BACKPRESSURE / DROP_OLDEST: 같은 스레드에서 submit + poll
+ *    → submit 시간 분포, 거절/버림 수, submit부터 결과까지 지연, 결과가 동기 결과와 같은지
+ * 3) drop-oldest 링: 소비자가 슬롯을 꺼내는 도중(claim 후 release 전) 멈춘 상태에서 submit마다 버림이 최대 1개인지,
+ *    소비자 스레드가 무작위로 멈추는 동안에도 모든 항목이 받음/버림/거절 중 정확히 한 번으로 집계되는지
+ * 를 출력한다. 전달된 결과 중 하나라도 동기 결과와 다르거나 3)이 어긋나면 종료 코드 2
+ */
+
+#include "dataset_io.h"
+#include "recognition_pipeline.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string dataset = "../notebooks/sign_dataset.csv";
+    std::string labels = "../public/models/labels.json";
+    int frames = 20000;
+    double fps = 0.0;  // 0: 제한 없음
+    int capacity = 64;
+};
+
+double percentile(std::vector<double> values, double p) {
+    if (values.empty()) return 0.0;
+    size_t k = std::min(values.size() - 1, static_cast<size_t>(p * (values.size() - 1) + 0.5));
+    std::nth_element(values.begin(), values.begin() + k, values.end());
+    return values[k];
+}
+
+// 다음 프레임 시각까지 바쁜 대기 (fps 0이면 바로 반환)
+void pace(Clock::time_point start, int frame, double fps) {
+    if (fps <= 0.0) return;
+    const auto due = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(frame / fps));
+    while (Clock::now() < due) {
+    }
+}
+
+void printDistribution(const char* name, const std::vector<double>& us) {
+    std::printf("  %-22s p50 %8.2f us  p99 %8.2f us  max %9.2f us\n", name, percentile(us, 0.5), percentile(us, 0.99),
+                us.empty() ? 0.0 : *std::max_element(us.begin(), us.end()));
+}
+
+// 데이터셋 행 → 한 손 42 float (오른손이 있으면 오른손, 리플레이 하니스와 같은 규칙)
+std::vector<float> toFrames(const LabeledDataset& data) {
+    std::vector<float> frames(data.size() * RecognitionPipeline::FLOATS_PER_FRAME);
+    for (size_t r = 0; r < data.size(); r++) {
+        const float* row = data.row(r);
+        const float* hand = std::any_of(row + 63, row + 126, [](float v) { return v != 0.0f; }) ? row + 63 : row;
+        float* dst = &frames[r * RecognitionPipeline::FLOATS_PER_FRAME];
+        for (int i = 0; i < 21; i++) {
+            dst[i * 2] = hand[i * 3];
+            dst[i * 2 + 1] = hand[i * 3 + 1];
+        }
+    }
+    return frames;
+}
+
+// 3-1. 결정적: 가득 찬 링에서 소비자가 가장 오래된 슬롯을 차지한 채 멈춤
+//      → 멈춘 동안 pushDropOldest는 버리지 않고 거절, 풀린 뒤에는 한 번 버리고 넣음 (submit마다 버림 <= 1)
+bool checkStalledTake() {
+    SpscRing<uint64_t> ring(8);
+    const size_t cap = ring.capacity();
+    uint64_t next = 0;
+    bool evicted = false;
+    for (size_t i = 0; i < cap; i++) ring.pushDropOldest(next++, &evicted);
+
+    uint64_t ticket = 0;
+    const uint64_t* held = ring.claim(ticket);  // 소비자 정지 (tail은 넘겼고 슬롯은 아직 안 돌려줌)
+    int maxEvicted = 0, pushedWhileStalled = 0;
+    for (int i = 0; i < 100; i++) {
+        const size_t before = ring.sizeApprox();
+        const bool pushed = ring.pushDropOldest(next++, &evicted);
+        const int removed = static_cast<int>(before + pushed - ring.sizeApprox());
+        maxEvicted = std::max(maxEvicted, removed);
+        pushedWhileStalled += pushed;
+    }
+    const bool heldOldest = held && *held == 0;
+    ring.release(ticket);
+
+    // 풀린 뒤: 빈 슬롯 하나에 그대로 들어가고, 다음은 가장 오래된 것(1)을 한 번 버리고 들어감
+    const bool refill = ring.pushDropOldest(next++, &evicted) && !evicted;
+    const bool replace = ring.pushDropOldest(next++, &evicted) && evicted;
+    uint64_t oldest = 0;
+    ring.pop(oldest);
+    const bool ok = heldOldest && maxEvicted <= 1 && pushedWhileStalled == 0 && refill && replace && oldest == 2;
+    std::printf("  stalled take: max evicted per submit %d, pushed while stalled %d, after release %s/%s, oldest %llu -> %s\n",
+                maxEvicted, pushedWhileStalled, refill ? "refill" : "NO refill", replace ? "evict+push" : "NO evict",
+                static_cast<unsigned long long>(oldest), ok ? "ok" : "FAILED");
+    return ok;
+}
+
+// 3-2. 스레드: 소비자가 claim과 release 사이에서 가끔 멈춤, 생산자는 기다리지 않고 pushDropOldest
+//      → 항목마다 받음/버림/거절 중 정확히 한 번, 버림 수는 받지 못한 항목 수와 같아야 함
+bool checkStallingConsumer(int items) {
+    SpscRing<uint64_t> ring(16);
+    std::vector<uint8_t> received(items, 0);
+    std::atomic<bool> producing{true};
+    std::thread consumer([&] {
+        uint64_t ticket = 0, count = 0;
+        for (;;) {
+            const uint64_t* value = ring.claim(ticket);
+            if (!value) {
+                if (!producing.load()) break;
+                std::this_thread::yield();
+                continue;
+            }
+            received[*value]++;
+            if (++count % 64 == 0) std::this_thread::sleep_for(std::chrono::microseconds(200));  // 꺼내는 도중 정지
+            ring.release(ticket);
+        }
+    });
+    uint64_t evictions = 0, rejections = 0;
+    for (int i = 0; i < items; i++) {
+        bool evicted = false;
+        rejections += !ring.pushDropOldest(static_cast<uint64_t>(i), &evicted);
+        evictions += evicted;
+        if (i % 32 == 31) std::this_thread::yield();  // 코어가 하나여도 소비자가 돌며 멈출 기회를 줌
+    }
+    producing.store(false);
+    consumer.join();
+
+    uint64_t got = 0;
+    bool once = true;
+    for (uint8_t r : received) {
+        got += r;
+        once = once && r <= 1;
+    }
+    const bool ok = once && got + evictions + rejections == static_cast<uint64_t>(items);
+    std::printf("  stalling consumer: %d items, %llu received, %llu evicted, %llu rejected -> %s\n", items,
+                static_cast<unsigned long long>(got), static_cast<unsigned long long>(evictions),
+                static_cast<unsigned long long>(rejections), ok ? "ok" : "FAILED");
+    return ok;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--dataset") opts.dataset = value();
+        else if (arg == "--labels") opts.labels = value();
+        else if (arg == "--frames") opts.frames = std::max(1, std::atoi(value()));
+        else if (arg == "--fps") opts.fps = std::atof(value());
+        else if (arg == "--capacity") opts.capacity = std::max(2, std::atoi(value()));
+        else {
+            std::fprintf(stderr, "usage: pipeline_bench [--frames N] [--fps N] [--capacity N] [--dataset PATH] [--labels PATH]\n");
+            return 1;
+        }
+    }
+
+    std::string error;
+    std::vector<std::string> labels;
+    LabeledDataset data;
+    if (!loadLabelsJson(opts.labels, labels, &error) || !loadDatasetCsv(opts.dataset, labels, data, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    const std::vector<float> source = toFrames(data);
+    const int sourceFrames = static_cast<int>(data.size());
+    auto frameAt = [&](int f) { return &source[static_cast<size_t>(f % sourceFrames) * RecognitionPipeline::FLOATS_PER_FRAME]; };
+
+    // 1. 동기 기준
+    SignRecognizer recognizer;
+    recognizer.initialize();
+    float* staging = recognizer.getInputBuffer();
+    const float* output = recognizer.getOutputBuffer();
+    std::vector<int> expected(opts.frames);
+    std::vector<double> syncUs(opts.frames);
+    auto start = Clock::now();
+    for (int f = 0; f < opts.frames; f++) {
+        pace(start, f, opts.fps);
+        auto t0 = Clock::now();
+        std::memcpy(staging, frameAt(f), RecognitionPipeline::FLOATS_PER_FRAME * sizeof(float));
+        recognizer.recognizeStaged(1);
+        expected[f] = static_cast<int>(output[0]);
+        syncUs[f] = std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+    }
+    double syncSec = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::printf("%d frames, %s, input ring %d\n", opts.frames,
+                opts.fps > 0.0 ? (std::to_string(opts.fps) + " fps").c_str() : "unpaced", opts.capacity);
+    std::printf("\nsync (capture thread runs recognizeStaged(1)): %.0f frames/s\n", opts.frames / syncSec);
+    printDistribution("capture blocked", syncUs);
+
+    // 2. 파이프라인
+    bool ok = true;
+    for (RecognitionPipeline::OverflowPolicy policy : {RecognitionPipeline::BACKPRESSURE, RecognitionPipeline::DROP_OLDEST}) {
+        RecognitionPipeline::Config config;
+        config.inputCapacity = opts.capacity;
+        config.policy = policy;
+        RecognitionPipeline pipeline(config);
+        if (!pipeline.start(&error)) {
+            std::fprintf(stderr, "error: %s\n", error.c_str());
+            return 1;
+        }
+
+        std::vector<double> submitUs(opts.frames), latencyUs;
+        std::vector<RecognitionPipeline::Result> batch(256);
+        latencyUs.reserve(opts.frames);
+        size_t mismatches = 0, delivered = 0;
+        auto drain = [&] {
+            int n = pipeline.poll(batch.data(), static_cast<int>(batch.size()));
+            for (int i = 0; i < n; i++) {
+                mismatches += batch[i].gestureId != expected[batch[i].frameId];
+                latencyUs.push_back(batch[i].latencyUs);
+            }
+            delivered += n;
+            return n;
+        };
+
+        start = Clock::now();
+        for (int f = 0; f < opts.frames; f++) {
+            pace(start, f, opts.fps);
+            auto t0 = Clock::now();
+            pipeline.submit(static_cast<uint64_t>(f), frameAt(f));
+            submitUs[f] = std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+            drain();
+        }
+        while (pipeline.inFlight() > 0) {
+            if (!drain()) std::this_thread::yield();
+        }
+        while (drain()) {
+        }
+        double sec = std::chrono::duration<double>(Clock::now() - start).count();
+        pipeline.stop();
+
+        const RecognitionPipeline::Stats& s = pipeline.stats();
+        std::printf("\npipeline %s: %.0f frames/s delivered, %zu results, %llu rejected, %llu dropped, %llu batches (avg %.1f)\n",
+                    policy == RecognitionPipeline::BACKPRESSURE ? "BACKPRESSURE" : "DROP_OLDEST", delivered / sec,
+                    delivered, static_cast<unsigned long long>(s.rejected.load()),
+                    static_cast<unsigned long long>(s.dropped.load() + s.resultsDropped.load()),
+                    static_cast<unsigned long long>(s.batches.load()),
+                    s.batches.load() ? double(s.processed.load()) / s.batches.load() : 0.0);
+        printDistribution("capture blocked", submitUs);
+        printDistribution("submit -> result", latencyUs);
+        std::printf("  mismatches vs sync: %zu\n", mismatches);
+        ok = ok && mismatches == 0 && delivered > 0;
+    }
+
+    // 3. drop-oldest 링
+    std::printf("\ndrop-oldest ring:\n");
+    ok = checkStalledTake() && ok;
+    ok = checkStallingConsumer(200000) && ok;
+
+    std::printf("\n%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 2;
+}
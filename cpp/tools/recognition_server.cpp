@@ -0,0 +1,91 @@
+/**
+ * 다중 세션 인식 서버 데몬 (네이티브 전용)
+ *
+ * 빌드/실행 (cpp 디렉토리에서):
+ *   make server
+ *   ./build/native/recognition_server --socket /tmp/sign.sock --workers 4 --max-batch 32 --max-latency-us 2000
+ *
+ * SIGINT/SIGTERM으로 종료하며, 1초마다 처리량과 평균 배치 크기를 출력한다.
+ * 프로토콜은 src/recognition_server.h 참고, 부하 생성기는 tools/load_generator.cpp.
+ */
+
+#include "dataset_io.h"
+#include "recognition_server.h"
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+namespace {
+volatile std::sig_atomic_t g_stop = 0;
+void onSignal(int) { g_stop = 1; }
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::string socketPath = "/tmp/sign_recognition.sock";
+    std::string scalerPath = "../public/models/scaler.json";
+    int workers = static_cast<int>(std::thread::hardware_concurrency());
+    server::BatcherConfig config;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        const char* value = argv[i + 1];
+        if (arg == "--socket") socketPath = value;
+        else if (arg == "--scaler") scalerPath = value;
+        else if (arg == "--workers") workers = std::atoi(value);
+        else if (arg == "--max-batch") config.maxBatch = std::atoi(value);
+        else if (arg == "--max-latency-us") config.maxLatencyUs = std::atoi(value);
+        else if (arg == "--max-queue") config.maxQueueFrames = std::atoi(value);
+        else if (arg == "--max-session-frames") config.maxSessionFrames = std::atoi(value);
+        else if (arg == "--shed-expired") config.shedExpired = std::atoi(value) != 0;
+        else {
+            std::fprintf(stderr,
+                         "usage: recognition_server [--socket PATH] [--scaler PATH] [--workers N]\n"
+                         "                          [--max-batch N] [--max-latency-us N] [--max-queue N]\n"
+                         "                          [--max-session-frames N] [--shed-expired 0|1]\n");
+            return 1;
+        }
+    }
+
+    std::string error;
+    std::vector<float> mean, scale;
+    if (!loadScalerJson(scalerPath, mean, scale, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+
+    server::RecognitionServer srv(socketPath, workers, config, mean, scale);
+    if (!srv.start(&error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+    std::printf("listening on %s (workers=%d, max-batch=%d, max-latency=%dus)\n", socketPath.c_str(),
+                workers < 1 ? 1 : workers, config.maxBatch, config.maxLatencyUs);
+    std::fflush(stdout);
+
+    uint64_t lastFrames = 0, lastBatches = 0;
+    while (!g_stop) {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        const server::ServerStats& stats = srv.stats();
+        uint64_t frames = stats.framesOut.load();
+        uint64_t batches = stats.batches.load();
+        if (frames != lastFrames) {
+            std::printf("frames/s=%llu avg-batch=%.1f sessions=%llu max-queue-delay=%lluus rejected=%llu\n",
+                        static_cast<unsigned long long>(frames - lastFrames),
+                        batches > lastBatches ? double(frames - lastFrames) / (batches - lastBatches) : 0.0,
+                        static_cast<unsigned long long>(stats.sessionsOpened.load()),
+                        static_cast<unsigned long long>(stats.maxQueueDelayUs.load()),
+                        static_cast<unsigned long long>(stats.framesRejected.load()));
+            std::fflush(stdout);
+        }
+        lastFrames = frames;
+        lastBatches = batches;
+    }
+
+    srv.stop();
+    return 0;
+}
@@ -0,0 +1,31 @@
+#ifndef RECOGNIZER_INTERNALS_H
+#define RECOGNIZER_INTERNALS_H
+
+#include "sign_recognition.h"
+
+#include <vector>
+
+/**
+ * SignRecognizer 비공개 단계 접근 (네이티브 검증 도구 전용, 라이브러리/WASM 빌드에는 포함하지 않음)
+ *
+ * - 공개 API(recognize, recognizeTwoHands)로는 결과 id/신뢰도만 비교할 수 있어,
+ *   특징 값과 신경망 점수를 비트 단위로 비교하는 도구(two_hand_bench, batch_features_bench)만 사용
+ */
+struct SignRecognizerInternals {
+    static constexpr int COMPLEX_FEATURES = SignRecognizer::COMPLEX_FEATURES;
+
+    static std::vector<float> extractComplexFeatures(SignRecognizer& recognizer, const std::vector<HandLandmark>& landmarks) {
+        return recognizer.extractComplexFeatures(landmarks);
+    }
+
+    static std::vector<float> neuralNetworkInference(SignRecognizer& recognizer, const float* features, int count) {
+        return recognizer.neuralNetworkInference(features, count);
+    }
+
+    static void neuralNetworkInferencePair(SignRecognizer& recognizer, const float* first, const float* second, int count,
+                                           float* firstOut, float* secondOut) {
+        recognizer.neuralNetworkInferencePair(first, second, count, firstOut, secondOut);
+    }
+};
+
+#endif // RECOGNIZER_INTERNALS_H
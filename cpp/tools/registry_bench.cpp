@@ -0,0 +1,169 @@
+/**
+ * 다중 모델 등록부(FeatureRegistry) 검증/벤치마크 (네이티브 전용)
+ *
+ *   make registry
+ *   ./build/native/registry_bench --repeat 20
+ *
+ * 규칙 / 210 특징 신경망(+규칙 폴백) / SignRecognition MLP를 나란히 평가할 때
+ * 1) 따로: 모델마다 자기 경로로 특징 추출부터 다시 (recognizeWithTier, predictMLP)
+ * 2) 공유: 등록부가 특징 블록 합집합을 프레임당 한 번 계산해 세 모델에 전달
+ * 데이터셋 모든 프레임에서 두 방식의 결과(id, 신뢰도)가 하나라도 다르면 종료 코드 2
+ * 프레임당 시간과 공유 경로의 특징 추출/모델별 추론 시간, 모델을 하나씩 더할 때의 추가 비용을 출력
+ */
+
+#include "dataset_io.h"
+#include "feature_registry.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string dataset = "../notebooks/sign_dataset.csv";
+    std::string labels = "../public/models/labels.json";
+    std::string scaler = "../public/models/scaler.json";
+    int repeat = 20;
+};
+
+std::vector<HandLandmark> toHand(const float* row) {
+    const float* hand = std::any_of(row + 63, row + 126, [](float v) { return v != 0.0f; }) ? row + 63 : row;
+    std::vector<HandLandmark> landmarks(21);
+    for (int i = 0; i < 21; i++) landmarks[i] = HandLandmark{hand[i * 3], hand[i * 3 + 1], hand[i * 3 + 2]};
+    return landmarks;
+}
+
+template <typename F>
+double usPerFrame(int repeat, size_t frames, F&& fn) {
+    fn();  // 워밍업
+    auto start = Clock::now();
+    for (int r = 0; r < repeat; r++) fn();
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / (double(repeat) * frames);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--dataset") opts.dataset = value();
+        else if (arg == "--labels") opts.labels = value();
+        else if (arg == "--scaler") opts.scaler = value();
+        else if (arg == "--repeat") opts.repeat = std::max(1, std::atoi(value()));
+        else {
+            std::fprintf(stderr, "usage: registry_bench [--repeat N] [--dataset PATH] [--labels PATH] [--scaler PATH]\n");
+            return 1;
+        }
+    }
+
+    std::string error;
+    std::vector<std::string> labels;
+    std::vector<float> mean, scale;
+    LabeledDataset data;
+    if (!loadLabelsJson(opts.labels, labels, &error) || !loadScalerJson(opts.scaler, mean, scale, &error) ||
+        !loadDatasetCsv(opts.dataset, labels, data, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+
+    SignRecognizer recognizer;
+    recognizer.initialize();
+    SignRecognition mlp;
+    mlp.setScaler(mean, scale);
+
+    const size_t frames = data.size();
+    std::vector<std::vector<HandLandmark>> hands(frames);
+    for (size_t r = 0; r < frames; r++) hands[r] = toHand(data.row(r));
+
+    // 1. 따로 실행 (모델마다 자기 특징 추출)
+    const int MODELS = 3;
+    std::vector<FeatureRegistry::Output> separate(frames * MODELS);
+    auto runSeparate = [&] {
+        for (size_t r = 0; r < frames; r++) {
+            RecognitionResult rules = recognizer.recognizeWithTier(hands[r], SignRecognizer::TIER_RULES);
+            RecognitionResult network = recognizer.recognizeWithTier(hands[r], SignRecognizer::TIER_MLP);
+            std::vector<float> row(data.row(r), data.row(r) + SignRecognition::featureDim());
+            separate[r * MODELS + 0] = {rules.id, rules.confidence};
+            separate[r * MODELS + 1] = {network.id, network.confidence};
+            separate[r * MODELS + 2] = {mlp.predictMLP(row), -1.0f};
+        }
+    };
+
+    // 2. 등록부 (특징 한 번)
+    FeatureRegistry registry;
+    registry.registerModel("rules", registry_models::RULES_BLOCKS, &registry_models::rules, &recognizer);
+    registry.registerModel("network", registry_models::NETWORK_BLOCKS, &registry_models::network, &recognizer);
+    registry.registerModel("mlp", registry_models::MLP_BLOCKS, &registry_models::mlp, &mlp);
+    std::vector<FeatureRegistry::Output> shared(frames * MODELS);
+    auto runShared = [&] {
+        for (size_t r = 0; r < frames; r++) registry.evaluate(data.row(r), &shared[r * MODELS]);
+    };
+
+    std::printf("registry: %d models, feature blocks:", registry.modelCount());
+    for (int b = 0; b < FeatureArena::BLOCK_COUNT; b++) {
+        if (registry.featureMask() & FeatureArena::bit(FeatureArena::Block(b))) {
+            std::printf(" %s", FeatureArena::blockName(FeatureArena::Block(b)));
+        }
+    }
+    std::printf("\n%zu frames x %d repeats\n\n", frames, opts.repeat);
+
+    double separateUs = usPerFrame(opts.repeat, frames, runSeparate);
+    double sharedUs = usPerFrame(opts.repeat, frames, runShared);
+
+    int mismatches = 0;
+    for (size_t i = 0; i < separate.size(); i++) {
+        if (separate[i].id != shared[i].id || separate[i].confidence != shared[i].confidence) {
+            if (mismatches++ < 5) {
+                std::printf("mismatch frame %zu model %s: separate (%d, %.6f) shared (%d, %.6f)\n", i / MODELS,
+                            registry.modelName(static_cast<int>(i % MODELS)).c_str(), separate[i].id,
+                            separate[i].confidence, shared[i].id, shared[i].confidence);
+            }
+        }
+    }
+
+    std::printf("%-28s %10s\n", "path", "us/frame");
+    std::printf("%-28s %10.2f\n", "separate (3 pipelines)", separateUs);
+    std::printf("%-28s %10.2f\n", "shared registry", sharedUs);
+
+    // 공유 경로 분해 (특징 추출 한 번 + 모델별 추론)
+    registry.setTiming(true);
+    registry.resetStats();
+    for (int r = 0; r < opts.repeat; r++) runShared();
+    std::printf("\nshared breakdown (us/frame)\n");
+    std::printf("  %-26s %10.2f\n", "featurization", registry.featureStats().totalUs / registry.featureStats().runs);
+    for (int m = 0; m < registry.modelCount(); m++) {
+        const FeatureRegistry::ModelStats& s = registry.modelStats(m);
+        std::printf("  %-26s %10.2f\n", registry.modelName(m).c_str(), s.totalUs / s.runs);
+    }
+
+    // 모델을 하나씩 더할 때 프레임당 비용 (첫 모델 이후 추가분이 그림자 모델 비용)
+    std::printf("\nincremental cost (us/frame)\n");
+    FeatureRegistry::ModelFn fns[MODELS] = {&registry_models::rules, &registry_models::network, &registry_models::mlp};
+    uint32_t blocks[MODELS] = {registry_models::RULES_BLOCKS, registry_models::NETWORK_BLOCKS, registry_models::MLP_BLOCKS};
+    void* contexts[MODELS] = {&recognizer, &recognizer, &mlp};
+    const int order[MODELS] = {1, 0, 2};  // 주 모델(신경망) 먼저, 그림자 모델을 차례로 추가
+    FeatureRegistry growing;
+    std::vector<FeatureRegistry::Output> scratch(MODELS);
+    double previous = 0.0;
+    for (int k = 0; k < MODELS; k++) {
+        int m = order[k];
+        growing.registerModel(registry.modelName(m), blocks[m], fns[m], contexts[m]);
+        double us = usPerFrame(opts.repeat, frames, [&] {
+            for (size_t r = 0; r < frames; r++) growing.evaluate(data.row(r), scratch.data());
+        });
+        std::printf("  + %-24s %10.2f  (+%.2f)\n", registry.modelName(m).c_str(), us, us - previous);
+        previous = us;
+    }
+
+    bool ok = mismatches == 0;
+    std::printf("\n%s\n", ok ? "OK: shared registry outputs identical" : "FAILED: outputs differ");
+    return ok ? 0 : 2;
+}
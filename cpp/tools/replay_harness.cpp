@@ -0,0 +1,472 @@
+/**
+ * 데이터셋 리플레이 하니스 (네이티브 전용)
+ *
+ * notebooks/sign_dataset.csv의 모든 프레임을 public/models/scaler.json과 함께
+ * 각 인식 엔진에 동일한 순서로 흘려보내고, labels.json 기준 정확도와
+ * 처리량, p50/p99/p999 지연 시간, 최대 메모리를 보고한다.
+ *
+ * 속도 최적화 전후로 --dump-predictions / --compare-predictions를 사용하면
+ * 예측 결과가 한 프레임도 바뀌지 않았음을 확인할 수 있다.
+ *
+ * 빌드/실행 (cpp 디렉토리에서):
+ *   make replay
+ *   ./build/native/replay_harness --threads 4 --repeat 20
+ */
+
+#include "dataset_io.h"
+#include "knn_classifier.h"
+#include "sign_recognition.h"
+
+#include <sys/resource.h>  // getrusage (최대 RSS)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// 엔진 생성 시 전달되는 공통 데이터
+struct EngineContext {
+    const std::vector<float>& mean;
+    const std::vector<float>& scale;
+    const std::vector<std::string>& labels;
+    const LabeledDataset& data;  // 등록형 엔진(k-NN)의 학습 샘플
+};
+
+// 리플레이 대상 엔진 인터페이스
+// - predict: 126차원 원본 특징(스케일러 적용 전)을 받아 labels.json 인덱스를 반환 (-1: 대응 라벨 없음)
+// - 스레드마다 별도 인스턴스를 만들므로 내부 상태는 스레드 안전할 필요가 없음
+class ReplayEngine {
+public:
+    virtual ~ReplayEngine() {}
+    virtual int predict(const float* features, int dim) = 0;
+};
+
+int findLabel(const std::vector<std::string>& labels, const char* name) {
+    for (size_t i = 0; i < labels.size(); i++) {
+        if (labels[i] == name) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+// 1. SignRecognition::predictMLP (126 → 128 → 64 → 4)
+class MlpEngine : public ReplayEngine {
+public:
+    explicit MlpEngine(const EngineContext& ctx) {
+        model.setScaler(ctx.mean, ctx.scale);
+    }
+
+    int predict(const float* features, int dim) override {
+        input.assign(features, features + dim);
+        return model.predictMLP(input);
+    }
+
+private:
+    SignRecognition model;
+    std::vector<float> input;
+};
+
+// 2. SignRecognizer::recognize (한 손 21개 랜드마크, 규칙 + 210 특징 신경망)
+// - 데이터셋 행에서 오른손(63~125)이 있으면 오른손, 없으면 왼손(0~62)을 사용
+// - 인식기 고유 ID를 labels.json 이름으로 대응 (대응이 없는 제스처는 -1)
+class RecognizerEngine : public ReplayEngine {
+public:
+    explicit RecognizerEngine(const EngineContext& ctx) : landmarks(21) {
+        recognizer.initialize();
+        idToLabel[1] = findLabel(ctx.labels, "hello");   // 안녕하세요
+        idToLabel[2] = findLabel(ctx.labels, "thanks");  // 감사합니다
+    }
+
+    int predict(const float* features, int dim) override {
+        const float* hand = features + 63;
+        bool rightPresent = false;
+        for (int i = 0; i < 63 && dim >= 126; i++) {
+            if (hand[i] != 0.0f) { rightPresent = true; break; }
+        }
+        if (!rightPresent) hand = features;
+
+        for (int i = 0; i < 21; i++) {
+            landmarks[i].x = hand[i * 3];
+            landmarks[i].y = hand[i * 3 + 1];
+            landmarks[i].z = hand[i * 3 + 2];
+        }
+        RecognitionResult result = recognizer.recognize(landmarks);
+        auto it = idToLabel.find(result.id);
+        return it == idToLabel.end() ? -1 : it->second;
+    }
+
+private:
+    SignRecognizer recognizer;
+    std::vector<HandLandmark> landmarks;
+    std::map<int, int> idToLabel;
+};
+
+// 3. KnnClassifier (데이터셋 전체 등록, leave-one-out 평가)
+// - 질의 프레임 자신이 등록되어 있으므로 k+1개를 찾고 거리 0인 첫 이웃(자기 자신)을 한 번 제외
+class KnnEngine : public ReplayEngine {
+public:
+    explicit KnnEngine(const EngineContext& ctx) : knn(ctx.data.dim, K) {
+        knn.setScaler(ctx.mean, ctx.scale);
+        for (size_t i = 0; i < ctx.data.size(); i++) knn.addSample(ctx.data.row(i), ctx.data.labels[i]);
+    }
+
+    int predict(const float* features, int dim) override {
+        KnnClassifier::Neighbor found[K + 1];
+        int n = knn.search(features, K + 1, found);
+        const KnnClassifier::Neighbor* begin = found;
+        if (n > 0 && found[0].distance == 0.0f) {
+            begin++;
+            n--;
+        }
+        return KnnClassifier::vote(begin, std::min(n, K));
+    }
+
+private:
+    static constexpr int K = 5;
+    KnnClassifier knn;
+};
+
+// 4. KnnClassifier 프로토타입 (라벨별 평균 벡터 1개씩, 최근접 프로토타입)
+class KnnPrototypeEngine : public ReplayEngine {
+public:
+    explicit KnnPrototypeEngine(const EngineContext& ctx) : prototypes(ctx.data.dim, 1) {
+        KnnClassifier samples(ctx.data.dim, 1);
+        samples.setScaler(ctx.mean, ctx.scale);
+        for (size_t i = 0; i < ctx.data.size(); i++) samples.addSample(ctx.data.row(i), ctx.data.labels[i]);
+        samples.buildPrototypes(prototypes);
+    }
+
+    int predict(const float* features, int dim) override {
+        return prototypes.predict(features);
+    }
+
+private:
+    KnnClassifier prototypes;
+};
+
+// 5. SignRecognition 블록 희소 추론 (W1/W2 블록을 Percent% 제거, 재학습 없음)
+template <int Percent, int BlockRows, int BlockCols>
+class SparseMlpEngine : public ReplayEngine {
+public:
+    explicit SparseMlpEngine(const EngineContext& ctx) {
+        model.setScaler(ctx.mean, ctx.scale);
+        model.setSparsity(Percent / 100.0f, BlockRows, BlockCols);
+    }
+
+    int predict(const float* features, int dim) override {
+        input.assign(features, features + dim);
+        return model.predictMLP(input);
+    }
+
+private:
+    SignRecognition model;
+    std::vector<float> input;
+};
+
+// 엔진 등록 테이블 (새 엔진은 여기에 추가)
+struct EngineSpec {
+    const char* name;
+    const char* description;
+    std::unique_ptr<ReplayEngine> (*create)(const EngineContext& ctx);
+};
+
+template <typename T>
+std::unique_ptr<ReplayEngine> makeEngine(const EngineContext& ctx) {
+    return std::unique_ptr<ReplayEngine>(new T(ctx));
+}
+
+const EngineSpec kEngines[] = {
+    {"mlp", "SignRecognition::predictMLP", &makeEngine<MlpEngine>},
+    {"recognizer", "SignRecognizer::recognize", &makeEngine<RecognizerEngine>},
+    {"knn", "KnnClassifier k=5 (leave-one-out)", &makeEngine<KnnEngine>},
+    {"knn-proto", "KnnClassifier nearest class prototype", &makeEngine<KnnPrototypeEngine>},
+    {"sparse-1x8-70", "predictMLP, 1x8 blocks, 70% pruned", &makeEngine<SparseMlpEngine<70, 1, 8>>},
+    {"sparse-1x8-80", "predictMLP, 1x8 blocks, 80% pruned", &makeEngine<SparseMlpEngine<80, 1, 8>>},
+    {"sparse-1x8-90", "predictMLP, 1x8 blocks, 90% pruned", &makeEngine<SparseMlpEngine<90, 1, 8>>},
+    {"sparse-4x4-70", "predictMLP, 4x4 blocks, 70% pruned", &makeEngine<SparseMlpEngine<70, 4, 4>>},
+    {"sparse-4x4-90", "predictMLP, 4x4 blocks, 90% pruned", &makeEngine<SparseMlpEngine<90, 4, 4>>},
+};
+
+struct Options {
+    std::string dataset = "../notebooks/sign_dataset.csv";
+    std::string scaler = "../public/models/scaler.json";
+    std::string labels = "../public/models/labels.json";
+    std::vector<std::string> engines;  // 비어 있으면 전체
+    int threads = 1;
+    int repeat = 1;
+    int warmup = 1;
+    unsigned seed = 0;  // 0이면 데이터셋 순서 그대로
+    std::string dumpPath;
+    std::string comparePath;
+};
+
+void printUsage() {
+    std::printf(
+        "usage: replay_harness [options]\n"
+        "  --dataset PATH              CSV dataset (default ../notebooks/sign_dataset.csv)\n"
+        "  --scaler PATH               scaler.json (default ../public/models/scaler.json)\n"
+        "  --labels PATH               labels.json (default ../public/models/labels.json)\n"
+        "  --engines a,b               engines to run (default: all)\n"
+        "  --threads N                 worker threads, each with its own engine instance\n"
+        "  --repeat N                  measured passes over the dataset\n"
+        "  --warmup N                  unmeasured passes before timing\n"
+        "  --seed N                    shuffle frame order with a fixed seed (0 = file order)\n"
+        "  --dump-predictions PATH     write per-frame predictions\n"
+        "  --compare-predictions PATH  fail if predictions differ from a previous dump\n"
+        "engines:\n");
+    for (const auto& spec : kEngines) {
+        std::printf("  %-12s %s\n", spec.name, spec.description);
+    }
+}
+
+bool parseOptions(int argc, char** argv, Options& opts) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto next = [&](std::string& out) {
+            if (i + 1 >= argc) return false;
+            out = argv[++i];
+            return true;
+        };
+        std::string value;
+        if (arg == "--help" || arg == "-h") {
+            return false;
+        } else if (arg == "--dataset") {
+            if (!next(opts.dataset)) return false;
+        } else if (arg == "--scaler") {
+            if (!next(opts.scaler)) return false;
+        } else if (arg == "--labels") {
+            if (!next(opts.labels)) return false;
+        } else if (arg == "--dump-predictions") {
+            if (!next(opts.dumpPath)) return false;
+        } else if (arg == "--compare-predictions") {
+            if (!next(opts.comparePath)) return false;
+        } else if (arg == "--engines") {
+            if (!next(value)) return false;
+            size_t start = 0;
+            while (start <= value.size()) {
+                size_t comma = value.find(',', start);
+                if (comma == std::string::npos) comma = value.size();
+                if (comma > start) opts.engines.push_back(value.substr(start, comma - start));
+                start = comma + 1;
+            }
+        } else if (arg == "--threads" || arg == "--repeat" || arg == "--warmup" || arg == "--seed") {
+            if (!next(value)) return false;
+            long n = std::strtol(value.c_str(), nullptr, 10);
+            if (arg == "--threads") opts.threads = std::max(1L, n);
+            if (arg == "--repeat") opts.repeat = std::max(1L, n);
+            if (arg == "--warmup") opts.warmup = std::max(0L, n);
+            if (arg == "--seed") opts.seed = static_cast<unsigned>(n);
+        } else {
+            std::fprintf(stderr, "unknown option: %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+// 최대 RSS (MB)
+double peakRssMb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0;  // Linux: KB 단위
+}
+
+double percentile(const std::vector<double>& sorted, double q) {
+    if (sorted.empty()) return 0.0;
+    size_t idx = static_cast<size_t>(q * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(idx, sorted.size() - 1)];
+}
+
+struct EngineReport {
+    std::string name;
+    std::vector<int> predictions;  // 데이터셋 행 순서
+    size_t unstable = 0;           // 반복 간 예측이 달라진 프레임 수
+    size_t correct = 0;
+    size_t frames = 0;
+    double wallSeconds = 0.0;
+    double p50 = 0.0, p99 = 0.0, p999 = 0.0;  // 마이크로초
+    double peakMb = 0.0;
+};
+
+EngineReport runEngine(const EngineSpec& spec, const EngineContext& ctx, const LabeledDataset& data,
+                       const std::vector<size_t>& order, const Options& opts) {
+    using Clock = std::chrono::steady_clock;
+    const int threads = opts.threads;
+
+    // 엔진 인스턴스는 메인 스레드에서 순차 생성 (initialize 경쟁 방지)
+    std::vector<std::unique_ptr<ReplayEngine>> engines;
+    for (int t = 0; t < threads; t++) engines.push_back(spec.create(ctx));
+
+    EngineReport report;
+    report.name = spec.name;
+    report.predictions.assign(data.size(), -1);
+    std::vector<uint8_t> unstable(data.size(), 0);
+    std::vector<std::vector<double>> latencies(threads);
+
+    auto worker = [&](int t, int passes, bool measure) {
+        size_t begin = order.size() * t / threads;
+        size_t end = order.size() * (t + 1) / threads;
+        ReplayEngine& engine = *engines[t];
+        if (measure) latencies[t].reserve((end - begin) * passes);
+
+        for (int pass = 0; pass < passes; pass++) {
+            for (size_t k = begin; k < end; k++) {
+                size_t row = order[k];
+                auto start = Clock::now();
+                int pred = engine.predict(data.row(row), data.dim);
+                auto stop = Clock::now();
+                if (!measure) continue;
+                latencies[t].push_back(std::chrono::duration<double, std::micro>(stop - start).count());
+                if (pass > 0 && report.predictions[row] != pred) unstable[row] = 1;
+                report.predictions[row] = pred;  // 행마다 담당 스레드가 하나뿐이라 경쟁 없음
+            }
+        }
+    };
+
+    auto runPasses = [&](int passes, bool measure) {
+        std::vector<std::thread> pool;
+        for (int t = 1; t < threads; t++) pool.emplace_back(worker, t, passes, measure);
+        worker(0, passes, measure);
+        for (auto& th : pool) th.join();
+    };
+
+    if (opts.warmup > 0) runPasses(opts.warmup, false);
+
+    auto wallStart = Clock::now();
+    runPasses(opts.repeat, true);
+    report.wallSeconds = std::chrono::duration<double>(Clock::now() - wallStart).count();
+
+    std::vector<double> all;
+    for (auto& lat : latencies) all.insert(all.end(), lat.begin(), lat.end());
+    std::sort(all.begin(), all.end());
+    report.frames = all.size();
+    report.p50 = percentile(all, 0.50);
+    report.p99 = percentile(all, 0.99);
+    report.p999 = percentile(all, 0.999);
+    report.unstable = std::accumulate(unstable.begin(), unstable.end(), size_t(0));
+
+    for (size_t i = 0; i < data.size(); i++) {
+        if (data.labels[i] >= 0 && report.predictions[i] == data.labels[i]) report.correct++;
+    }
+    report.peakMb = peakRssMb();
+    return report;
+}
+
+void dumpPredictions(const std::string& path, const std::vector<EngineReport>& reports) {
+    std::ofstream out(path);
+    for (const auto& r : reports) {
+        for (size_t i = 0; i < r.predictions.size(); i++) {
+            out << r.name << ' ' << i << ' ' << r.predictions[i] << '\n';
+        }
+    }
+}
+
+// 이전 덤프와 비교하여 달라진 예측 개수 반환 (덤프에 없는 엔진은 건너뜀)
+size_t comparePredictions(const std::string& path, const std::vector<EngineReport>& reports, bool& ok) {
+    std::ifstream in(path);
+    ok = static_cast<bool>(in);
+    if (!ok) return 0;
+
+    std::map<std::string, std::map<size_t, int>> previous;
+    std::string name;
+    size_t idx;
+    int pred;
+    while (in >> name >> idx >> pred) previous[name][idx] = pred;
+
+    size_t mismatches = 0;
+    for (const auto& r : reports) {
+        auto it = previous.find(r.name);
+        if (it == previous.end()) continue;
+        size_t engineMismatches = 0;
+        for (size_t i = 0; i < r.predictions.size(); i++) {
+            auto p = it->second.find(i);
+            if (p == it->second.end() || p->second != r.predictions[i]) engineMismatches++;
+        }
+        if (engineMismatches) {
+            std::printf("  %s: %zu predictions differ from %s\n", r.name.c_str(), engineMismatches, path.c_str());
+        }
+        mismatches += engineMismatches;
+    }
+    return mismatches;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    if (!parseOptions(argc, argv, opts)) {
+        printUsage();
+        return 1;
+    }
+
+    std::string error;
+    std::vector<std::string> labels;
+    std::vector<float> mean, scale;
+    LabeledDataset data;
+    if (!loadLabelsJson(opts.labels, labels, &error) || !loadScalerJson(opts.scaler, mean, scale, &error) ||
+        !loadDatasetCsv(opts.dataset, labels, data, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+
+    // 프레임 순서 (시드가 같으면 항상 같은 순서)
+    std::vector<size_t> order(data.size());
+    std::iota(order.begin(), order.end(), 0);
+    if (opts.seed != 0) {
+        std::mt19937 rng(opts.seed);
+        std::shuffle(order.begin(), order.end(), rng);
+    }
+
+    std::printf("dataset: %zu frames x %d features, %zu labels, threads=%d repeat=%d seed=%u\n",
+                data.size(), data.dim, labels.size(), opts.threads, opts.repeat, opts.seed);
+
+    EngineContext ctx{mean, scale, labels, data};
+    std::vector<EngineReport> reports;
+    for (const auto& spec : kEngines) {
+        if (!opts.engines.empty() &&
+            std::find(opts.engines.begin(), opts.engines.end(), spec.name) == opts.engines.end()) {
+            continue;
+        }
+        reports.push_back(runEngine(spec, ctx, data, order, opts));
+    }
+    if (reports.empty()) {
+        std::fprintf(stderr, "error: no matching engines\n");
+        return 1;
+    }
+
+    std::printf("\n%-12s %9s %12s %10s %10s %10s %9s %9s\n", "engine", "accuracy", "frames/s",
+                "p50(us)", "p99(us)", "p999(us)", "unstable", "peakMB");
+    for (const auto& r : reports) {
+        std::printf("%-12s %8.2f%% %12.0f %10.2f %10.2f %10.2f %9zu %9.1f\n", r.name.c_str(),
+                    100.0 * r.correct / data.size(), r.frames / r.wallSeconds, r.p50, r.p99, r.p999,
+                    r.unstable, r.peakMb);
+    }
+    std::printf("(peakMB is the process high-water mark after each engine finished)\n");
+
+    if (!opts.dumpPath.empty()) dumpPredictions(opts.dumpPath, reports);
+
+    if (!opts.comparePath.empty()) {
+        bool ok = false;
+        size_t mismatches = comparePredictions(opts.comparePath, reports, ok);
+        if (!ok) {
+            std::fprintf(stderr, "error: cannot read %s\n", opts.comparePath.c_str());
+            return 1;
+        }
+        if (mismatches) {
+            std::printf("FAIL: %zu predictions changed\n", mismatches);
+            return 2;
+        }
+        std::printf("OK: predictions identical to %s\n", opts.comparePath.c_str());
+    }
+    return 0;
+}
@@ -0,0 +1,174 @@
+/**
+ * 시간 예산 기반 엔진 선택(recognizeScheduled) 시뮬레이션 (네이티브 전용)
+ *
+ *   make scheduler
+ *   ./build/native/scheduler_bench --budget-ms 4 --tight-ms 0.004 --frames 600 [--load-threads 2] [--order measured]
+ *
+ * 1) 엔진별 프레임 시간과 labels.json 기준 정확도 측정 (규칙 / 210 특징 신경망 / 대형 신경망)
+ *    --order measured면 잰 정확도로 사다리 순서를 정함 (setTierAccuracy), 기본 declared는 규칙 < 신경망 < 대형
+ * 2) 세 구간을 재생: 평상시(budget) → 저사양/부하(tight 예산, 선택적으로 바쁜 스레드) → 회복(budget)
+ *    구간마다 엔진 사용 비율, 예산 초과 프레임 수, 엔진 전환 결정(이유 포함)을 출력
+ * 프레임은 데이터셋 행(오른손이 있으면 오른손)을 반복 사용
+ */
+
+#include "dataset_io.h"
+#include "sign_recognition.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const char* kTierNames[SignRecognizer::TIER_COUNT] = {"rules", "mlp", "heavy"};
+const char* kReasonNames[] = {"initial", "keep", "downgrade", "upgrade", "probe", "unlimited"};
+
+struct Options {
+    std::string dataset = "../notebooks/sign_dataset.csv";
+    std::string labels = "../public/models/labels.json";
+    float budgetMs = 4.0f;
+    float tightMs = 0.004f;  // 부하 구간 예산 (저사양 기기/다른 작업에 시간을 빼앗긴 상황, 신경망 한 프레임보다 짧게)
+    int frames = 600;  // 구간당
+    int loadThreads = 0;
+    bool measuredOrder = false;
+};
+
+std::vector<std::vector<HandLandmark>> toHands(const LabeledDataset& data) {
+    std::vector<std::vector<HandLandmark>> hands(data.size(), std::vector<HandLandmark>(21));
+    for (size_t r = 0; r < data.size(); r++) {
+        const float* row = data.row(r);
+        const float* hand = std::any_of(row + 63, row + 126, [](float v) { return v != 0.0f; }) ? row + 63 : row;
+        for (int i = 0; i < 21; i++) hands[r][i] = HandLandmark{hand[i * 3], hand[i * 3 + 1], hand[i * 3 + 2]};
+    }
+    return hands;
+}
+
+// 구간 하나 재생: 엔진 사용 횟수, 예산 초과 수, 새 결정 중 엔진 전환/재측정 출력
+void runPhase(const char* name, SignRecognizer& recognizer, const std::vector<std::vector<HandLandmark>>& hands,
+              int frames, float budgetUs, int& cursor) {
+    int used[SignRecognizer::TIER_COUNT] = {};
+    int over = 0;
+    double totalUs = 0.0;
+    std::vector<LatencyScheduler::Decision> decisions(LatencyScheduler::LOG_SIZE);
+    int64_t seen = static_cast<int64_t>(recognizer.getScheduler().frames()) - 1;
+    std::printf("\n[%s]\n", name);
+    for (int f = 0; f < frames; f++) {
+        auto start = Clock::now();
+        recognizer.recognizeScheduled(hands[cursor++ % hands.size()]);
+        double us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+        totalUs += us;
+        over += us > budgetUs;
+        used[recognizer.getLastTier()]++;
+
+        int n = recognizer.getScheduler().readDecisions(decisions.data(), static_cast<int>(decisions.size()), seen);
+        for (int i = 0; i < n; i++) {
+            const LatencyScheduler::Decision& d = decisions[i];
+            seen = static_cast<int64_t>(d.frame);
+            if (d.reason == LatencyScheduler::KEEP) continue;
+            std::printf("  frame %6llu  %-9s -> %-5s  estimate %9.1f us  measured %9.1f us\n",
+                        static_cast<unsigned long long>(d.frame), kReasonNames[d.reason], kTierNames[d.tier],
+                        d.estimateUs, d.measuredUs);
+        }
+    }
+    std::printf("  tiers: rules %d, mlp %d, heavy %d | over budget %d/%d | mean %.1f us\n", used[0], used[1], used[2], over,
+                frames, totalUs / frames);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--dataset") opts.dataset = value();
+        else if (arg == "--labels") opts.labels = value();
+        else if (arg == "--budget-ms") opts.budgetMs = static_cast<float>(std::atof(value()));
+        else if (arg == "--tight-ms") opts.tightMs = static_cast<float>(std::atof(value()));
+        else if (arg == "--frames") opts.frames = std::max(1, std::atoi(value()));
+        else if (arg == "--load-threads") opts.loadThreads = std::max(0, std::atoi(value()));
+        else if (arg == "--order") opts.measuredOrder = std::string(value()) == "measured";
+        else {
+            std::fprintf(stderr, "usage: scheduler_bench [--budget-ms N] [--tight-ms N] [--frames N] [--load-threads N] [--order declared|measured] [--dataset PATH] [--labels PATH]\n");
+            return 1;
+        }
+    }
+
+    std::string error;
+    std::vector<std::string> labels;
+    LabeledDataset data;
+    if (!loadLabelsJson(opts.labels, labels, &error) || !loadDatasetCsv(opts.dataset, labels, data, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    const auto hands = toHands(data);
+    int cursor = 0;
+
+    // 1. 엔진별 비용 (앞 costFrames개) + 정확도 (전 프레임, 인식기 ID → labels.json 이름, replay_harness와 같은 대응)
+    const int costFrames = 50;
+    std::map<int, int> idToLabel;
+    for (size_t i = 0; i < labels.size(); i++) {
+        if (labels[i] == "hello") idToLabel[1] = static_cast<int>(i);   // 안녕하세요
+        if (labels[i] == "thanks") idToLabel[2] = static_cast<int>(i);  // 감사합니다
+    }
+    float accuracy[SignRecognizer::TIER_COUNT] = {};
+    std::printf("engine cost (mean of %d frames) and accuracy (%zu frames)\n", costFrames, hands.size());
+    for (int tier = 0; tier < SignRecognizer::TIER_COUNT; tier++) {
+        SignRecognizer probe;
+        probe.initialize();
+        double totalUs = 0.0;
+        for (int f = 0; f < costFrames; f++) {
+            auto start = Clock::now();
+            probe.recognizeWithTier(hands[f % hands.size()], tier);
+            totalUs += std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+        }
+        size_t correct = 0;
+        for (size_t r = 0; r < hands.size(); r++) {
+            auto it = idToLabel.find(probe.recognizeWithTier(hands[r], tier).id);
+            correct += it != idToLabel.end() && data.labels[r] == it->second;
+        }
+        accuracy[tier] = static_cast<float>(correct) / hands.size();
+        std::printf("  %-5s %10.1f us  accuracy %5.1f%%\n", kTierNames[tier], totalUs / costFrames, 100.0f * accuracy[tier]);
+    }
+
+    // 2. 예산 변화 + (선택) 부하
+    SignRecognizer recognizer;
+    recognizer.initialize();
+    recognizer.setLatencyBudget(opts.budgetMs);
+    if (opts.measuredOrder) recognizer.setTierAccuracy(accuracy, SignRecognizer::TIER_COUNT);
+    std::printf("\nladder (%s order, least to most accurate):", opts.measuredOrder ? "measured" : "declared");
+    for (int level = 0; level < SignRecognizer::TIER_COUNT; level++) {
+        std::printf(" %s", kTierNames[recognizer.getScheduler().tierAt(level)]);
+    }
+    std::printf("\n");
+    std::printf("\nbudget %.3f ms -> %.3f ms -> %.3f ms, %d frames per phase, %d load thread(s), %u core(s)\n",
+                opts.budgetMs, opts.tightMs, opts.budgetMs, opts.frames, opts.loadThreads,
+                std::thread::hardware_concurrency());
+
+    runPhase("normal", recognizer, hands, opts.frames, opts.budgetMs * 1000.0f, cursor);
+
+    std::atomic<bool> loaded{true};
+    std::vector<std::thread> load;
+    for (int t = 0; t < opts.loadThreads; t++) {
+        load.emplace_back([&loaded] {
+            volatile double sink = 1.0;
+            while (loaded.load(std::memory_order_relaxed)) sink = sink * 1.0000001 + 1e-9;
+        });
+    }
+    recognizer.setLatencyBudget(opts.tightMs);
+    runPhase("tight", recognizer, hands, opts.frames, opts.tightMs * 1000.0f, cursor);
+    loaded.store(false);
+    for (std::thread& t : load) t.join();
+
+    recognizer.setLatencyBudget(opts.budgetMs);
+    runPhase("recovered", recognizer, hands, opts.frames, opts.budgetMs * 1000.0f, cursor);
+    return 0;
+}
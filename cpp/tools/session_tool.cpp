@@ -0,0 +1,327 @@
+/**
+ * 랜드마크 세션(.sgns) 변환/검증/고속 재생 도구 (네이티브 전용)
+ *
+ *   make session
+ *   ./build/native/session_tool encode --out build/dataset.sgns          # CSV → 세션 (데이터셋 순서)
+ *   ./build/native/session_tool info build/dataset.sgns
+ *   ./build/native/session_tool verify build/dataset.sgns                # CSV와 값/라벨/탐색 비교 + 손상 파일 거부
+ *   ./build/native/session_tool replay build/dataset.sgns --repeat 200   # mmap 디코딩 + recognizeStaged
+ *
+ * replay는 세션을 MAX_BATCH_FRAMES 단위로 SignRecognizer 스테이징 버퍼에 바로 디코딩해
+ * recognizeStaged()로 인식하고, 디코딩 전용/인식 포함 처리량과 실시간 대비 배율을 출력한다.
+ * 형식 정의는 src/session_format.h 참고.
+ */
+
+#include "dataset_io.h"
+#include "session_format.h"
+#include "sign_recognition.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string command;
+    std::string file;
+    std::string out;
+    std::string dataset = "../notebooks/sign_dataset.csv";
+    std::string labels = "../public/models/labels.json";
+    float fps = 30.0f;
+    int keyframe = 30;
+    int repeat = 100;
+};
+
+double elapsedSec(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+size_t fileSize(const std::string& path) {
+    struct stat st;
+    return stat(path.c_str(), &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+}
+
+bool loadDataset(const Options& opts, LabeledDataset& data, double* parseSec = nullptr) {
+    std::string error;
+    std::vector<std::string> labels;
+    auto start = Clock::now();
+    if (!loadLabelsJson(opts.labels, labels, &error) || !loadDatasetCsv(opts.dataset, labels, data, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return false;
+    }
+    if (parseSec) *parseSec = elapsedSec(start);
+    if (data.dim != SESSION_MAX_VALUES) {
+        std::fprintf(stderr, "error: dataset has %d features, sessions store %d (2 hands x 21 x 3)\n", data.dim,
+                     SESSION_MAX_VALUES);
+        return false;
+    }
+    return true;
+}
+
+int encode(const Options& opts) {
+    LabeledDataset data;
+    if (!loadDataset(opts, data)) return 1;
+    std::string out = opts.out.empty() ? "build/dataset.sgns" : opts.out;
+
+    std::string error;
+    SessionWriter writer;
+    if (!writer.open(out, 2, 3, opts.fps, opts.keyframe, SESSION_DEFAULT_STEP, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    for (size_t r = 0; r < data.size(); r++) {
+        if (!writer.addFrame(data.row(r), data.labels[r])) {
+            std::fprintf(stderr, "error: write failed at frame %zu\n", r);
+            return 1;
+        }
+    }
+    uint32_t deltas = writer.deltaFrames();
+    if (!writer.close(&error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+
+    size_t csvBytes = fileSize(opts.dataset), sessionBytes = fileSize(out);
+    std::printf("wrote %s: %zu frames, %u delta8 / %zu key frames\n", out.c_str(), data.size(), deltas,
+                data.size() - deltas);
+    std::printf("size: %zu bytes (CSV %zu bytes, %.1f%%)\n", sessionBytes, csvBytes,
+                csvBytes ? 100.0 * sessionBytes / csvBytes : 0.0);
+    return 0;
+}
+
+bool openReader(const std::string& path, SessionReader& reader) {
+    std::string error;
+    if (!reader.open(path, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return false;
+    }
+    return true;
+}
+
+int info(const Options& opts) {
+    SessionReader reader;
+    if (!openReader(opts.file, reader)) return 1;
+    const SessionHeader& h = reader.info();
+    std::printf("%s: version %u, %u hand(s) x 21 x %u, %.2f fps\n", opts.file.c_str(), h.version, h.handCount,
+                h.coordsPerLandmark, h.frameRate);
+    std::printf("frames: %u (%.1f s), keyframes: %u (interval %u), quant step: %g\n", h.frameCount,
+                h.frameCount / h.frameRate, h.keyframeCount, h.keyframeInterval, h.quantStep);
+    std::printf("bytes: %zu (%.1f per frame)\n", reader.fileBytes(),
+                h.frameCount ? double(reader.fileBytes()) / h.frameCount : 0.0);
+    return 0;
+}
+
+// 헤더/키프레임 인덱스를 하나씩 망가뜨린 사본을 open()이 모두 거부하는지 확인
+bool rejectsCorruptCopies(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    const std::vector<uint8_t> original((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    SessionHeader header;
+    std::memcpy(&header, original.data(), sizeof(header));
+    if (header.keyframeCount < 2) {
+        std::printf("corrupt copies: skipped (needs 2+ keyframes)\n");
+        return true;
+    }
+    const size_t first = header.indexOffset, second = first + sizeof(SessionKeyframe);
+    const uint64_t hugeOffset = ~uint64_t(0) & ~uint64_t(alignof(SessionKeyframe) - 1);  // 인덱스 크기를 더하면 넘침
+    const uint64_t zero = 0;
+    const uint32_t pastEnd = header.frameCount;
+    struct Patch {
+        const char* name;
+        size_t at;
+        const void* value;
+        size_t bytes;
+    } patches[] = {
+        {"indexOffset overflow", offsetof(SessionHeader, indexOffset), &hugeOffset, sizeof(hugeOffset)},
+        {"keyframe offset in header", first + offsetof(SessionKeyframe, offset), &zero, sizeof(zero)},
+        {"keyframe offset at index", first + offsetof(SessionKeyframe, offset), &header.indexOffset, sizeof(header.indexOffset)},
+        {"keyframe frame past end", first + offsetof(SessionKeyframe, frame), &pastEnd, sizeof(pastEnd)},
+        {"keyframe frames not increasing", second + offsetof(SessionKeyframe, frame), &zero, sizeof(uint32_t)},
+    };
+
+    const std::string copy = path + ".corrupt";
+    int accepted = 0;
+    for (const Patch& patch : patches) {
+        std::vector<uint8_t> bytes = original;
+        std::memcpy(bytes.data() + patch.at, patch.value, patch.bytes);
+        std::ofstream(copy, std::ios::binary).write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+        SessionReader reader;
+        std::string error;
+        if (reader.open(copy, &error)) {
+            std::printf("corrupt copy accepted: %s\n", patch.name);
+            accepted++;
+        }
+    }
+    std::remove(copy.c_str());
+    const int total = static_cast<int>(sizeof(patches) / sizeof(patches[0]));
+    std::printf("corrupt copies rejected: %d/%d\n", total - accepted, total);
+    return accepted == 0;
+}
+
+int verify(const Options& opts) {
+    LabeledDataset data;
+    SessionReader reader;
+    if (!loadDataset(opts, data) || !openReader(opts.file, reader)) return 1;
+    if (reader.frameCount() != data.size() || reader.valuesPerFrame() != data.dim) {
+        std::fprintf(stderr, "error: session has %u frames x %d values, dataset %zu x %d\n", reader.frameCount(),
+                     reader.valuesPerFrame(), data.size(), data.dim);
+        return 2;
+    }
+
+    const int dim = data.dim;
+    const double tolerance = reader.info().quantStep * 0.5 + 1e-6;
+    std::vector<float> frames(data.size() * dim);
+    std::vector<int> labels(data.size());
+    int decoded = reader.decode(frames.data(), static_cast<int>(data.size()), labels.data());
+
+    double maxError = 0.0;
+    size_t labelMismatch = 0;
+    for (int r = 0; r < decoded; r++) {
+        for (int j = 0; j < dim; j++) maxError = std::max(maxError, std::fabs(double(frames[r * dim + j]) - data.row(r)[j]));
+        labelMismatch += labels[r] != data.labels[r];
+    }
+
+    // 모든 프레임으로 탐색 → 한 프레임 디코딩이 순차 디코딩과 같아야 함
+    size_t seekMismatch = 0;
+    std::vector<float> single(dim);
+    for (uint32_t f = 0; f < reader.frameCount(); f++) {
+        if (!reader.seek(f) || reader.decode(single.data(), 1) != 1 ||
+            !std::equal(single.begin(), single.end(), frames.begin() + static_cast<size_t>(f) * dim)) {
+            seekMismatch++;
+        }
+    }
+
+    // 배치 형식 디코딩 (손 하나 x, y 42개) → 전체 디코딩의 같은 손 x, y와 비트 단위로 같아야 함
+    size_t planarMismatch = 0;
+    std::vector<float> planar(static_cast<size_t>(SignRecognizer::MAX_BATCH_FRAMES) * SignRecognizer::FLOATS_PER_FRAME);
+    for (int hand = -1; hand < reader.info().handCount; hand++) {
+        reader.seek(0);
+        for (int first = 0, n; (n = reader.decodeLandmarks2D(planar.data(), SignRecognizer::MAX_BATCH_FRAMES, hand)) > 0;
+             first += n) {
+            for (int f = 0; f < n; f++) {
+                const float* row = &frames[static_cast<size_t>(first + f) * dim];
+                const int handValues = SESSION_LANDMARKS * 3;
+                int selected = hand;
+                if (hand < 0) selected = std::any_of(row + handValues, row + dim, [](float v) { return v != 0.0f; }) ? 1 : 0;
+                for (int i = 0; i < SESSION_LANDMARKS; i++) {
+                    const float* expected = row + selected * handValues + i * 3;
+                    const float* actual = &planar[static_cast<size_t>(f) * SignRecognizer::FLOATS_PER_FRAME + i * 2];
+                    planarMismatch += std::memcmp(expected, actual, 2 * sizeof(float)) != 0;
+                }
+            }
+        }
+    }
+
+    std::printf("decoded %d/%zu frames, max |error| %.3g (tolerance %.3g), label mismatches %zu, seek mismatches %zu, "
+                "2D batch mismatches %zu\n",
+                decoded, data.size(), maxError, tolerance, labelMismatch, seekMismatch, planarMismatch);
+    bool ok = decoded == static_cast<int>(data.size()) && maxError <= tolerance && labelMismatch == 0 && seekMismatch == 0 &&
+              planarMismatch == 0;
+    ok = rejectsCorruptCopies(opts.file) && ok;
+    std::printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 2;
+}
+
+int replay(const Options& opts) {
+    SessionReader reader;
+    if (!openReader(opts.file, reader)) return 1;
+    const SessionHeader& h = reader.info();
+    if (h.frameCount == 0) {
+        std::fprintf(stderr, "error: empty session\n");
+        return 1;
+    }
+
+    // 1. 디코딩 전용 (전체 좌표, 배치 버퍼 재사용)
+    constexpr int BATCH = SignRecognizer::MAX_BATCH_FRAMES;
+    std::vector<float> batch(static_cast<size_t>(BATCH) * reader.valuesPerFrame());
+    size_t frames = 0;
+    auto start = Clock::now();
+    for (int rep = 0; rep < opts.repeat; rep++) {
+        reader.seek(0);
+        int n;
+        while ((n = reader.decode(batch.data(), BATCH)) > 0) frames += n;
+    }
+    double decodeSec = elapsedSec(start);
+
+    // 2. 스테이징 버퍼에 바로 디코딩 + recognizeStaged
+    SignRecognizer recognizer;
+    recognizer.initialize();
+    float* staging = recognizer.getInputBuffer();
+    if (!staging) {
+        std::fprintf(stderr, "error: recognizer staging buffer allocation failed\n");
+        return 1;
+    }
+    size_t recognized = 0;
+    start = Clock::now();
+    for (int rep = 0; rep < opts.repeat; rep++) {
+        reader.seek(0);
+        int n;
+        while ((n = reader.decodeLandmarks2D(staging, BATCH)) > 0) recognized += recognizer.recognizeStaged(n);
+    }
+    double recognizeSec = elapsedSec(start);
+
+    double decodeFps = frames / decodeSec, recognizeFps = recognized / recognizeSec;
+    std::printf("session: %u frames @ %.1f fps, %zu bytes, repeat %d\n", h.frameCount, h.frameRate,
+                reader.fileBytes(), opts.repeat);
+    std::printf("decode:           %12.0f frames/s  %8.1f MB/s  %8.0fx realtime\n", decodeFps,
+                reader.fileBytes() * double(opts.repeat) / decodeSec / 1e6, decodeFps / h.frameRate);
+    std::printf("decode+recognize: %12.0f frames/s  %8.0fx realtime\n", recognizeFps, recognizeFps / h.frameRate);
+
+    // CSV 기준 비교 (같은 데이터셋에서 만든 세션일 때 참고용)
+    LabeledDataset data;
+    double parseSec = 0.0;
+    if (fileSize(opts.dataset) && loadDataset(opts, data, &parseSec) && data.size()) {
+        std::printf("csv parse:        %12.0f frames/s  (%zu bytes)\n", data.size() / parseSec, fileSize(opts.dataset));
+    }
+    return 0;
+}
+
+void usage() {
+    std::fprintf(stderr,
+                 "usage: session_tool encode [--out FILE] [--fps N] [--keyframe N] [--dataset PATH] [--labels PATH]\n"
+                 "       session_tool info FILE\n"
+                 "       session_tool verify FILE [--dataset PATH] [--labels PATH]\n"
+                 "       session_tool replay FILE [--repeat N] [--dataset PATH]\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--out") opts.out = value();
+        else if (arg == "--dataset") opts.dataset = value();
+        else if (arg == "--labels") opts.labels = value();
+        else if (arg == "--fps") opts.fps = static_cast<float>(std::atof(value()));
+        else if (arg == "--keyframe") opts.keyframe = std::max(1, std::atoi(value()));
+        else if (arg == "--repeat") opts.repeat = std::max(1, std::atoi(value()));
+        else if (arg.size() > 2 && arg.compare(0, 2, "--") == 0) {
+            usage();
+            return 1;
+        } else if (opts.command.empty()) opts.command = arg;
+        else opts.file = arg;
+    }
+
+    if (opts.command == "encode") return encode(opts);
+    if (opts.file.empty()) {
+        usage();
+        return 1;
+    }
+    if (opts.command == "info") return info(opts);
+    if (opts.command == "verify") return verify(opts);
+    if (opts.command == "replay") return replay(opts);
+    usage();
+    return 1;
+}
@@ -0,0 +1,212 @@
+/**
+ * 시간 컨볼루션(TCN) 스트리밍 리플레이 벤치마크 (네이티브 전용)
+ *
+ * sign_dataset.csv 프레임을 여러 스트림의 연속 시퀀스로 재생하면서
+ *   1) 스트림별 증분 step()            (프레임당 O(1))
+ *   2) 스트림 묶음 stepBatch()         (가중치 행 재사용)
+ *   3) 매 프레임 윈도우 전체 재계산     (기준 구현, evaluateWindow)
+ * 의 프레임당 비용을 비교하고, 증분 결과가 윈도우 재계산과 일치하는지 검증한다.
+ * 학습된 TCN 가중치가 아직 없으므로 고정 시드 초기화 가중치를 사용한다 (--weights로 교체 가능).
+ *
+ *   make temporal
+ *   ./build/native/temporal_replay --streams 32 --frames 600
+ */
+
+#include "dataset_io.h"
+#include "temporal_conv.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string dataset = "../notebooks/sign_dataset.csv";
+    std::string scaler = "../public/models/scaler.json";
+    std::string labels = "../public/models/labels.json";
+    std::string weights;         // 평탄화된 float32 가중치 파일 (없으면 고정 시드)
+    int streams = 32;
+    int frames = 600;            // 스트림당 프레임 수
+    int window = 0;              // 재계산 기준 윈도우 길이 (0 = 수용 영역)
+    uint32_t seed = 42;
+};
+
+double elapsedUs(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+bool loadWeightsFile(const std::string& path, TemporalConvModel& model, std::string* error) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        if (error) *error = "cannot open " + path;
+        return false;
+    }
+    std::vector<float> data(static_cast<size_t>(in.tellg()) / sizeof(float));
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(data.data()), data.size() * sizeof(float));
+    std::string reason;
+    if (!model.loadWeights(data.data(), data.size(), &reason)) {
+        if (error) *error = path + ": " + reason;
+        return false;
+    }
+    return true;
+}
+
+// MAX_KERNEL을 넘는 커널은 잘리지 않고 생성/로드 모두에서 거부되어야 함
+bool rejectsOversizedKernel(int dim, int classes) {
+    std::vector<TemporalConvLayerSpec> layers = TemporalConvModel::defaultLayers();
+    layers.back().kernelSize = TemporalConvModel::MAX_KERNEL + 1;
+    TemporalConvModel oversized(dim, layers, classes);
+    std::vector<float> weights(oversized.parameterCount());
+    std::string error;
+    const bool rejected = !oversized.valid() && !oversized.loadWeights(weights.data(), weights.size(), &error) &&
+                          error == oversized.error();
+    std::printf("oversized kernel (%d): %s (%s)\n", TemporalConvModel::MAX_KERNEL + 1,
+                rejected ? "rejected" : "ACCEPTED", oversized.error().c_str());
+    return rejected;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--dataset") opts.dataset = value();
+        else if (arg == "--scaler") opts.scaler = value();
+        else if (arg == "--labels") opts.labels = value();
+        else if (arg == "--weights") opts.weights = value();
+        else if (arg == "--streams") opts.streams = std::max(1, std::atoi(value()));
+        else if (arg == "--frames") opts.frames = std::max(1, std::atoi(value()));
+        else if (arg == "--window") opts.window = std::max(0, std::atoi(value()));
+        else if (arg == "--seed") opts.seed = static_cast<uint32_t>(std::strtoul(value(), nullptr, 10));
+        else {
+            std::fprintf(stderr,
+                         "usage: temporal_replay [--streams N] [--frames N] [--window N] [--weights FILE] [--seed N]\n"
+                         "                       [--dataset PATH] [--scaler PATH] [--labels PATH]\n");
+            return 1;
+        }
+    }
+
+    std::string error;
+    std::vector<std::string> labels;
+    std::vector<float> mean, scale;
+    LabeledDataset data;
+    if (!loadLabelsJson(opts.labels, labels, &error) || !loadScalerJson(opts.scaler, mean, scale, &error) ||
+        !loadDatasetCsv(opts.dataset, labels, data, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+
+    const int dim = data.dim;
+    auto model = std::make_shared<TemporalConvModel>(dim, TemporalConvModel::defaultLayers(), static_cast<int>(labels.size()));
+    if (!model->valid()) {
+        std::fprintf(stderr, "error: %s\n", model->error().c_str());
+        return 1;
+    }
+    if (opts.weights.empty()) {
+        model->initializeDeterministic(opts.seed);
+    } else if (!loadWeightsFile(opts.weights, *model, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    const int window = opts.window > 0 ? opts.window : model->receptiveField();
+    const int classes = model->numClasses();
+
+    // 스트림마다 다른 시작점에서 데이터셋을 순환하며 정규화된 프레임 시퀀스 구성: [frame][stream][dim]
+    std::vector<float> frames(static_cast<size_t>(opts.frames) * opts.streams * dim);
+    for (int t = 0; t < opts.frames; t++) {
+        for (int s = 0; s < opts.streams; s++) {
+            size_t row = (static_cast<size_t>(s) * 7919 + t) % data.size();
+            float* dst = &frames[(static_cast<size_t>(t) * opts.streams + s) * dim];
+            const float* src = data.row(row);
+            for (int j = 0; j < dim; j++) dst[j] = (src[j] - mean[j]) / scale[j];
+        }
+    }
+
+    std::shared_ptr<const TemporalConvModel> shared = model;
+    std::vector<std::unique_ptr<TemporalConvState>> states;
+    std::vector<TemporalConvState*> statePtrs;
+    for (int s = 0; s < opts.streams; s++) {
+        states.emplace_back(new TemporalConvState(shared));
+        statePtrs.push_back(states.back().get());
+    }
+
+    const size_t total = static_cast<size_t>(opts.frames) * opts.streams;
+    std::vector<float> stepLogits(total * classes);
+    std::vector<float> batchLogits(total * classes);
+
+    // 1) 스트림별 증분 step
+    Clock::time_point start = Clock::now();
+    for (int t = 0; t < opts.frames; t++) {
+        for (int s = 0; s < opts.streams; s++) {
+            const float* logits = states[s]->step(&frames[(static_cast<size_t>(t) * opts.streams + s) * dim]);
+            std::copy(logits, logits + classes, &stepLogits[(static_cast<size_t>(t) * opts.streams + s) * classes]);
+        }
+    }
+    double stepUs = elapsedUs(start);
+
+    // 2) 스트림 묶음 stepBatch
+    for (auto& st : states) st->reset();
+    start = Clock::now();
+    for (int t = 0; t < opts.frames; t++) {
+        TemporalConvState::stepBatch(statePtrs.data(), opts.streams,
+                                     &frames[static_cast<size_t>(t) * opts.streams * dim],
+                                     &batchLogits[static_cast<size_t>(t) * opts.streams * classes]);
+    }
+    double batchUs = elapsedUs(start);
+
+    // 3) 매 프레임 최근 window 프레임을 처음부터 재계산 (스트림 0만 측정, us/frame은 스트림 1개 기준)
+    std::vector<float> history(static_cast<size_t>(window) * dim);
+    std::vector<float> windowLogits(classes);
+    double maxDiff = 0.0;
+    start = Clock::now();
+    for (int t = 0; t < opts.frames; t++) {
+        int length = std::min(t + 1, window);
+        for (int i = 0; i < length; i++) {
+            int src = t - length + 1 + i;
+            std::copy_n(&frames[static_cast<size_t>(src) * opts.streams * dim], dim, &history[static_cast<size_t>(i) * dim]);
+        }
+        TemporalConvState::evaluateWindow(*model, history.data(), length, windowLogits.data());
+        for (int c = 0; c < classes; c++) {
+            double diff = std::fabs(windowLogits[c] - stepLogits[static_cast<size_t>(t) * opts.streams * classes + c]);
+            maxDiff = std::max(maxDiff, diff);
+        }
+    }
+    double windowUs = elapsedUs(start);
+
+    double batchDiff = 0.0;
+    for (size_t i = 0; i < stepLogits.size(); i++) {
+        batchDiff = std::max(batchDiff, static_cast<double>(std::fabs(stepLogits[i] - batchLogits[i])));
+    }
+
+    std::printf("model: %d layers, receptive field %d frames, %zu params, %zu MACs/step\n", model->numLayers(),
+                model->receptiveField(), model->parameterCount(), model->macsPerStep());
+    std::printf("replay: %d streams x %d frames (%zu frames), window=%d\n", opts.streams, opts.frames, total, window);
+    std::printf("%-22s %12s %14s\n", "path", "us/frame", "frames/s");
+    std::printf("%-22s %12.3f %14.0f\n", "step (incremental)", stepUs / total, total / (stepUs * 1e-6));
+    std::printf("%-22s %12.3f %14.0f\n", "stepBatch", batchUs / total, total / (batchUs * 1e-6));
+    std::printf("%-22s %12.3f %14.0f\n", "window recompute", windowUs / opts.frames, opts.frames / (windowUs * 1e-6));
+    std::printf("parity: max |step - window| = %.3g, max |step - stepBatch| = %.3g\n", maxDiff, batchDiff);
+
+    // 증분 결과가 윈도우 재계산과 어긋나면 실패 (window가 수용 영역보다 짧으면 비교 대상이 아님)
+    // stepBatch는 스트림마다 step()과 같은 누산 순서라 비트 단위로 같아야 하고, 빈 윈도우는 거부되어야 함
+    bool ok = batchDiff == 0.0 && (window < model->receptiveField() || maxDiff <= 1e-3) &&
+              !TemporalConvState::evaluateWindow(*model, history.data(), 0, windowLogits.data());
+    if (!ok) std::fprintf(stderr, "error: incremental outputs diverged from reference\n");
+    if (!rejectsOversizedKernel(dim, classes)) {
+        std::fprintf(stderr, "error: kernel size above MAX_KERNEL was accepted\n");
+        ok = false;
+    }
+    return ok ? 0 : 1;
+}
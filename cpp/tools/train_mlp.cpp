@@ -0,0 +1,674 @@
+/**
+ * 제스처 MLP 네이티브 학습기 (Python/노트북 없이 재학습, 네이티브 전용)
+ *
+ *   make train
+ *   ./build/native/train_mlp --dataset ../notebooks/sign_dataset.csv --out build/native/model
+ *   cp build/native/model/gesture_weights.h src/ && cp build/native/model/{scaler,labels}.json ../public/models/
+ *
+ * 노트북(sign-language-estimator.ipynb)과 같은 구성:
+ * - 126 → 128 → ReLU → Dropout(0.1) → 64 → ReLU → Dropout(0.1) → 클래스 수, 소프트맥스 교차 엔트로피 (배치 평균)
+ * - 라벨은 사전순 (LabelEncoder), 클래스별 층화 분할 (--val 비율), StandardScaler는 학습 행에만 맞춤
+ *   (모집단 표준편차, 0이면 1), Adam (lr 1e-3, 0.9/0.999, eps 1e-8), 배치 64, 40 에폭
+ * - 가중치 초기화는 PyTorch nn.Linear 기본값과 같은 분포 U(±1/sqrt(fan_in)) (난수열은 달라 결과 가중치는 다름)
+ *
+ * 학습 경로:
+ * - 미니배치를 SHARD(8)행 조각으로 나눠 작업자 풀이 조각마다 순전파/역전파를 계산하고 조각별 기울기 버퍼에 기록
+ *   → 매개변수 구간마다 조각 순서대로 합산 + Adam 갱신 (이것도 작업자 풀에서 나눠 실행)
+ *   조각 경계와 합산 순서가 스레드 수와 무관하므로 같은 --seed면 --threads와 관계없이 결과가 비트 단위로 같음
+ * - 층마다 GEMM 세 번 (순전파 X·Wt, 가중치 기울기 X^T·dY, 입력 기울기 dY·W)을 4행 x 16열 AVX 타일 커널 하나로 처리
+ *   (가중치는 [in][out]으로 두고 역전파용 [out][in] 사본을 스텝마다 갱신, 입력/클래스 차원은 8의 배수로 0 패딩)
+ * - 드롭아웃 마스크는 (seed, 에폭, 행 번호)로 만든 난수라 조각 배치와 무관
+ *
+ * 내보내기 (--out 디렉토리, SignRecognition이 읽는 형식):
+ * - gesture_weights.h: static const float W1/B1/W2/B2/W3/B3 ([out][in], 노트북 내보내기와 같은 "%.8ff" 형식)
+ * - scaler.json {"mean", "scale"}, labels.json {"labels"}
+ * 내보낸 파일을 다시 읽어 predictMLP와 같은 스칼라 순전파로 전체 행을 예측하고 학습기 예측과 비교
+ * (하나라도 다르면 종료 코드 2)
+ */
+
+#include "dataset_io.h"
+#include "sign_recognition.h"  // SignRecognition::numClasses()
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <immintrin.h>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int D_IN = 126;
+constexpr int D_PAD = 128;   // 입력 차원 (8의 배수로 0 패딩)
+constexpr int H1 = 128;
+constexpr int H2 = 64;
+constexpr int C_PAD = 8;     // 클래스 차원 패딩 (패딩 클래스의 로짓/기울기는 항상 0)
+constexpr int SHARD = 8;     // 기울기 조각 하나의 행 수
+
+struct Options {
+    std::string dataset = "../notebooks/sign_dataset.csv";
+    std::string labels;  // 비우면 CSV에서 사전순으로 수집
+    std::string out = "build/native/model";
+    int epochs = 40;
+    int batch = 64;
+    float lr = 1e-3f;
+    float dropout = 0.1f;
+    float val = 0.2f;
+    int threads = 0;  // 0이면 hardware_concurrency
+    uint32_t seed = 42;
+};
+
+// 매개변수 한 벌의 배치 (가중치 [in][out], 평탄화한 배열 하나 → 합산/Adam이 구간 단위로 동작)
+constexpr size_t OFF_W1 = 0;
+constexpr size_t OFF_B1 = OFF_W1 + static_cast<size_t>(D_PAD) * H1;
+constexpr size_t OFF_W2 = OFF_B1 + H1;
+constexpr size_t OFF_B2 = OFF_W2 + static_cast<size_t>(H1) * H2;
+constexpr size_t OFF_W3 = OFF_B2 + H2;
+constexpr size_t OFF_B3 = OFF_W3 + static_cast<size_t>(H2) * C_PAD;
+constexpr size_t PARAMS = OFF_B3 + C_PAD;
+static_assert(PARAMS % 8 == 0, "parameter block must be a multiple of 8 floats");
+
+// ----- 작업자 풀 -----
+
+// 고정 작업자 풀: run(count, fn)이 fn(0..count-1)을 호출 스레드 포함 모든 스레드에 나눠 실행하고 끝날 때까지 대기
+class WorkerPool {
+public:
+    explicit WorkerPool(int threads) {
+        for (int t = 1; t < threads; t++) workers.emplace_back(&WorkerPool::workerLoop, this);
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& worker : workers) worker.join();
+    }
+
+    void run(int count, const std::function<void(int)>& fn) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = &fn;
+            jobCount = count;
+            next.store(0, std::memory_order_relaxed);
+            active = static_cast<int>(workers.size());
+            generation++;
+        }
+        wake.notify_all();
+        drain();
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return active == 0; });
+        job = nullptr;
+    }
+
+private:
+    void drain() {
+        for (int i = next.fetch_add(1); i < jobCount; i = next.fetch_add(1)) (*job)(i);
+    }
+
+    void workerLoop() {
+        uint64_t seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&] { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
+            }
+            drain();
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--active == 0) done.notify_one();
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake, done;
+    const std::function<void(int)>* job = nullptr;
+    int jobCount = 0;
+    std::atomic<int> next{0};
+    int active = 0;
+    uint64_t generation = 0;
+    bool stopping = false;
+};
+
+// ----- GEMM -----
+
+// C 타일 ROWS x (VECS * 8) += A 행 ROWS개 x B (K행)
+template <int ROWS, int VECS>
+inline void gemmTile(int K, const float* a, int aRow, int aCol, const float* b, int ldb, float* c, int ldc, bool accumulate) {
+    __m256 acc[ROWS][VECS];
+    for (int r = 0; r < ROWS; r++) {
+        for (int v = 0; v < VECS; v++) acc[r][v] = accumulate ? _mm256_loadu_ps(c + r * ldc + v * 8) : _mm256_setzero_ps();
+    }
+    for (int k = 0; k < K; k++) {
+        __m256 bv[VECS];
+        for (int v = 0; v < VECS; v++) bv[v] = _mm256_loadu_ps(b + static_cast<size_t>(k) * ldb + v * 8);
+        for (int r = 0; r < ROWS; r++) {
+            const __m256 av = _mm256_set1_ps(a[static_cast<size_t>(r) * aRow + static_cast<size_t>(k) * aCol]);
+            for (int v = 0; v < VECS; v++) acc[r][v] = _mm256_add_ps(acc[r][v], _mm256_mul_ps(av, bv[v]));
+        }
+    }
+    for (int r = 0; r < ROWS; r++) {
+        for (int v = 0; v < VECS; v++) _mm256_storeu_ps(c + r * ldc + v * 8, acc[r][v]);
+    }
+}
+
+// C[M][N] (+)= A[M][K] · B[K][N] (B/C 행 우선, N은 8의 배수)
+// A 원소 (m, k)는 a[m * aRow + k * aCol] → 전치 입력(X^T·dY)도 복사 없이 같은 커널 사용
+void gemm(int M, int N, int K, const float* a, int aRow, int aCol, const float* b, int ldb, float* c, int ldc, bool accumulate) {
+    int m = 0;
+    for (; m + 4 <= M; m += 4) {
+        const float* am = a + static_cast<size_t>(m) * aRow;
+        float* cm = c + static_cast<size_t>(m) * ldc;
+        int n = 0;
+        for (; n + 16 <= N; n += 16) gemmTile<4, 2>(K, am, aRow, aCol, b + n, ldb, cm + n, ldc, accumulate);
+        for (; n < N; n += 8) gemmTile<4, 1>(K, am, aRow, aCol, b + n, ldb, cm + n, ldc, accumulate);
+    }
+    for (; m < M; m++) {
+        const float* am = a + static_cast<size_t>(m) * aRow;
+        float* cm = c + static_cast<size_t>(m) * ldc;
+        int n = 0;
+        for (; n + 16 <= N; n += 16) gemmTile<1, 2>(K, am, aRow, aCol, b + n, ldb, cm + n, ldc, accumulate);
+        for (; n < N; n += 8) gemmTile<1, 1>(K, am, aRow, aCol, b + n, ldb, cm + n, ldc, accumulate);
+    }
+}
+
+// ----- 모델 -----
+
+// 행마다 독립된 난수열 (드롭아웃 마스크가 조각/스레드 배치와 무관하도록)
+struct SplitMix64 {
+    uint64_t state;
+    uint64_t next() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+    float uniform() { return (next() >> 40) * (1.0f / 16777216.0f); }
+};
+
+// 조각 하나의 활성값/기울기 작업 공간
+struct ShardWork {
+    std::vector<float> x = std::vector<float>(SHARD * D_PAD);
+    std::vector<float> h1 = std::vector<float>(SHARD * H1);
+    std::vector<float> keep1 = std::vector<float>(SHARD * H1);  // 드롭아웃 배율 (0 또는 1/(1-p))
+    std::vector<float> h2 = std::vector<float>(SHARD * H2);
+    std::vector<float> keep2 = std::vector<float>(SHARD * H2);
+    std::vector<float> logits = std::vector<float>(SHARD * C_PAD);
+    std::vector<float> d1 = std::vector<float>(SHARD * H1);
+    std::vector<float> d2 = std::vector<float>(SHARD * H2);
+    std::vector<float> grad = std::vector<float>(PARAMS);
+    double loss = 0.0;
+    int correct = 0;
+};
+
+class Trainer {
+public:
+    Trainer(int classes, const Options& opts) : classes(classes), opts(opts), params(PARAMS, 0.0f), adamM(PARAMS, 0.0f),
+                                                adamV(PARAMS, 0.0f), w2(static_cast<size_t>(H2) * H1), w3(static_cast<size_t>(C_PAD) * H2) {
+        // nn.Linear 기본 초기화와 같은 분포 (가중치, 편향 모두 U(-1/sqrt(fan_in), 1/sqrt(fan_in)))
+        std::mt19937 rng(opts.seed);
+        auto init = [&](size_t wOff, size_t bOff, int in, int out, int outStride) {
+            std::uniform_real_distribution<float> dist(-1.0f / std::sqrt(float(in)), 1.0f / std::sqrt(float(in)));
+            for (int o = 0; o < out; o++) {
+                for (int i = 0; i < in; i++) params[wOff + static_cast<size_t>(i) * outStride + o] = dist(rng);
+            }
+            for (int o = 0; o < out; o++) params[bOff + o] = dist(rng);
+        };
+        init(OFF_W1, OFF_B1, D_IN, H1, H1);
+        init(OFF_W2, OFF_B2, H1, H2, H2);
+        init(OFF_W3, OFF_B3, H2, classes, C_PAD);
+        refreshBackwardWeights();
+    }
+
+    // 조각 하나 순전파 (training이면 드롭아웃 적용, 평가면 그대로) → logits
+    void forward(ShardWork& w, int rows, bool training, const int* sampleIds, int epoch) const {
+        const float* p = params.data();
+        for (int r = 0; r < rows; r++) std::copy(p + OFF_B1, p + OFF_B1 + H1, w.h1.begin() + r * H1);
+        gemm(rows, H1, D_PAD, w.x.data(), D_PAD, 1, p + OFF_W1, H1, w.h1.data(), H1, true);
+        activate(w.h1.data(), w.keep1.data(), rows, H1, training, sampleIds, epoch, 1);
+
+        for (int r = 0; r < rows; r++) std::copy(p + OFF_B2, p + OFF_B2 + H2, w.h2.begin() + r * H2);
+        gemm(rows, H2, H1, w.h1.data(), H1, 1, p + OFF_W2, H2, w.h2.data(), H2, true);
+        activate(w.h2.data(), w.keep2.data(), rows, H2, training, sampleIds, epoch, 2);
+
+        for (int r = 0; r < rows; r++) std::copy(p + OFF_B3, p + OFF_B3 + C_PAD, w.logits.begin() + r * C_PAD);
+        gemm(rows, C_PAD, H2, w.h2.data(), H2, 1, p + OFF_W3, C_PAD, w.logits.data(), C_PAD, true);
+    }
+
+    // 조각 하나 순전파 + 역전파 → w.grad (덮어쓰기), 손실 합/정답 수
+    void backward(ShardWork& w, int rows, const int* sampleIds, const int* targets, int epoch, float inverseBatch) const {
+        forward(w, rows, true, sampleIds, epoch);
+
+        // 소프트맥스 교차 엔트로피: dL/dlogit = (p - onehot) / 배치 크기
+        float* dLogits = w.logits.data();  // 로짓 자리에 기울기 기록
+        w.loss = 0.0;
+        w.correct = 0;
+        for (int r = 0; r < rows; r++) {
+            float* z = dLogits + r * C_PAD;
+            const int best = static_cast<int>(std::max_element(z, z + classes) - z);
+            w.correct += best == targets[r];
+            const float peak = z[best];
+            float sum = 0.0f;
+            for (int c = 0; c < classes; c++) sum += (z[c] = std::exp(z[c] - peak));
+            w.loss -= std::log(z[targets[r]] / sum);
+            for (int c = 0; c < classes; c++) z[c] = (z[c] / sum - (c == targets[r])) * inverseBatch;
+        }
+
+        float* g = w.grad.data();
+        // 층 3: dW3t = h2^T · dLogits, dh2 = dLogits · W3
+        gemm(H2, C_PAD, rows, w.h2.data(), 1, H2, dLogits, C_PAD, g + OFF_W3, C_PAD, false);
+        biasGradient(dLogits, rows, C_PAD, g + OFF_B3);
+        gemm(rows, H2, C_PAD, dLogits, C_PAD, 1, w3.data(), H2, w.d2.data(), H2, false);
+        gateGradient(w.d2.data(), w.h2.data(), w.keep2.data(), rows * H2);
+
+        // 층 2
+        gemm(H1, H2, rows, w.h1.data(), 1, H1, w.d2.data(), H2, g + OFF_W2, H2, false);
+        biasGradient(w.d2.data(), rows, H2, g + OFF_B2);
+        gemm(rows, H1, H2, w.d2.data(), H2, 1, w2.data(), H1, w.d1.data(), H1, false);
+        gateGradient(w.d1.data(), w.h1.data(), w.keep1.data(), rows * H1);
+
+        // 층 1 (입력 기울기는 필요 없음)
+        gemm(D_PAD, H1, rows, w.x.data(), 1, D_PAD, w.d1.data(), H1, g + OFF_W1, H1, false);
+        biasGradient(w.d1.data(), rows, H1, g + OFF_B1);
+    }
+
+    // 매개변수 구간 [begin, end)의 조각 기울기를 조각 순서대로 합산하고 Adam 갱신 (PyTorch Adam과 같은 식)
+    void adamStep(const std::vector<ShardWork>& shards, int shardCount, size_t begin, size_t end) {
+        const float beta1 = 0.9f, beta2 = 0.999f, eps = 1e-8f;
+        const float correction1 = 1.0f - static_cast<float>(std::pow(double(beta1), step));
+        const float correction2 = std::sqrt(1.0f - static_cast<float>(std::pow(double(beta2), step)));
+        const float stepSize = opts.lr / correction1;
+        for (size_t i = begin; i < end; i++) {
+            float g = shards[0].grad[i];
+            for (int s = 1; s < shardCount; s++) g += shards[s].grad[i];
+            adamM[i] = beta1 * adamM[i] + (1.0f - beta1) * g;
+            adamV[i] = beta2 * adamV[i] + (1.0f - beta2) * g * g;
+            params[i] -= stepSize * adamM[i] / (std::sqrt(adamV[i]) / correction2 + eps);
+        }
+    }
+
+    void beginStep() { step++; }
+
+    // 역전파용 [out][in] 사본 (W2, W3만; 층 1은 입력 기울기를 구하지 않음)
+    void refreshBackwardWeights() {
+        for (int i = 0; i < H1; i++) {
+            for (int o = 0; o < H2; o++) w2[static_cast<size_t>(o) * H1 + i] = params[OFF_W2 + static_cast<size_t>(i) * H2 + o];
+        }
+        for (int i = 0; i < H2; i++) {
+            for (int c = 0; c < C_PAD; c++) w3[static_cast<size_t>(c) * H2 + i] = params[OFF_W3 + static_cast<size_t>(i) * C_PAD + c];
+        }
+    }
+
+    // 내보내기용 [out][in] 행렬 (패딩 제외)
+    std::vector<float> exportWeights(size_t offset, int in, int out, int outStride) const {
+        std::vector<float> w(static_cast<size_t>(out) * in);
+        for (int o = 0; o < out; o++) {
+            for (int i = 0; i < in; i++) w[static_cast<size_t>(o) * in + i] = params[offset + static_cast<size_t>(i) * outStride + o];
+        }
+        return w;
+    }
+    std::vector<float> exportBias(size_t offset, int count) const {
+        return std::vector<float>(params.begin() + offset, params.begin() + offset + count);
+    }
+
+private:
+    // ReLU + 드롭아웃 (배율을 keep에 보관해 역전파에서 재사용)
+    void activate(float* h, float* keep, int rows, int width, bool training, const int* sampleIds, int epoch, int layer) const {
+        const float scale = 1.0f / (1.0f - opts.dropout);
+        for (int r = 0; r < rows; r++) {
+            float* row = h + r * width;
+            float* mask = keep + r * width;
+            if (training && opts.dropout > 0.0f) {
+                SplitMix64 rng{(uint64_t(opts.seed) << 32) ^ (uint64_t(epoch) << 24) ^ (uint64_t(sampleIds[r]) << 2) ^ uint64_t(layer)};
+                for (int i = 0; i < width; i++) mask[i] = rng.uniform() < opts.dropout ? 0.0f : scale;
+            } else {
+                std::fill(mask, mask + width, 1.0f);
+            }
+            for (int i = 0; i < width; i++) row[i] = std::max(row[i], 0.0f) * mask[i];
+        }
+    }
+
+    // 다음 층에서 온 기울기에 ReLU 미분(출력 > 0)과 드롭아웃 배율 적용
+    static void gateGradient(float* d, const float* h, const float* keep, int count) {
+        for (int i = 0; i < count; i++) d[i] = h[i] > 0.0f ? d[i] * keep[i] : 0.0f;
+    }
+
+    static void biasGradient(const float* d, int rows, int width, float* out) {
+        std::fill(out, out + width, 0.0f);
+        for (int r = 0; r < rows; r++) {
+            for (int i = 0; i < width; i++) out[i] += d[r * width + i];
+        }
+    }
+
+    int classes;
+    Options opts;
+    std::vector<float> params, adamM, adamV;
+    std::vector<float> w2, w3;
+    int step = 0;
+};
+
+// ----- 내보내기 / 검증 -----
+
+void writeFloatArray(FILE* out, const char* name, const std::vector<float>& values) {
+    std::fprintf(out, "static const float %s[] = {", name);
+    for (size_t i = 0; i < values.size(); i++) std::fprintf(out, "%s%.8ff", i ? ", " : "", values[i]);
+    std::fprintf(out, "};\n");
+}
+
+void writeNumberList(FILE* out, const std::vector<double>& values) {
+    for (size_t i = 0; i < values.size(); i++) std::fprintf(out, "%s%.17g", i ? ", " : "", values[i]);
+}
+
+bool writeModel(const std::string& dir, const Trainer& trainer, int classes, const std::vector<double>& mean,
+                const std::vector<double>& scale, const std::vector<std::string>& labels) {
+    FILE* out = std::fopen((dir + "/gesture_weights.h").c_str(), "w");
+    if (!out) return false;
+    writeFloatArray(out, "W1", trainer.exportWeights(OFF_W1, D_IN, H1, H1));
+    writeFloatArray(out, "B1", trainer.exportBias(OFF_B1, H1));
+    writeFloatArray(out, "W2", trainer.exportWeights(OFF_W2, H1, H2, H2));
+    writeFloatArray(out, "B2", trainer.exportBias(OFF_B2, H2));
+    writeFloatArray(out, "W3", trainer.exportWeights(OFF_W3, H2, classes, C_PAD));
+    writeFloatArray(out, "B3", trainer.exportBias(OFF_B3, classes));
+    if (std::fclose(out) != 0) return false;
+
+    out = std::fopen((dir + "/scaler.json").c_str(), "w");
+    if (!out) return false;
+    std::fprintf(out, "{\"mean\": [");
+    writeNumberList(out, mean);
+    std::fprintf(out, "], \"scale\": [");
+    writeNumberList(out, scale);
+    std::fprintf(out, "]}");
+    if (std::fclose(out) != 0) return false;
+
+    out = std::fopen((dir + "/labels.json").c_str(), "w");
+    if (!out) return false;
+    std::fprintf(out, "{\"labels\": [");
+    for (size_t i = 0; i < labels.size(); i++) std::fprintf(out, "%s\"%s\"", i ? ", " : "", labels[i].c_str());
+    std::fprintf(out, "]}");
+    return std::fclose(out) == 0;
+}
+
+// gesture_weights.h에서 "NAME[] = {...}" 배열 읽기
+bool parseHeaderArray(const std::string& text, const char* name, size_t expected, std::vector<float>& out) {
+    const size_t pos = text.find(std::string(name) + "[] = {");
+    if (pos == std::string::npos) return false;
+    out.clear();
+    const char* p = text.c_str() + text.find('{', pos) + 1;
+    while (*p && *p != '}') {
+        char* end = nullptr;
+        const float value = std::strtof(p, &end);
+        if (end == p) return false;
+        out.push_back(value);
+        p = end;
+        while (*p == 'f' || *p == ',' || *p == ' ') p++;
+    }
+    return out.size() == expected;
+}
+
+// 내보낸 가중치로 predictMLP와 같은 순서의 스칼라 순전파
+int predictExported(const std::vector<float> (&w)[6], int classes, const float* x) {
+    float h1[H1], h2[H2], logits[C_PAD];
+    for (int i = 0; i < H1; i++) {
+        float sum = w[1][i];
+        for (int j = 0; j < D_IN; j++) sum += w[0][i * D_IN + j] * x[j];
+        h1[i] = std::max(sum, 0.f);
+    }
+    for (int i = 0; i < H2; i++) {
+        float sum = w[3][i];
+        for (int j = 0; j < H1; j++) sum += w[2][i * H1 + j] * h1[j];
+        h2[i] = std::max(sum, 0.f);
+    }
+    for (int i = 0; i < classes; i++) {
+        float sum = w[5][i];
+        for (int j = 0; j < H2; j++) sum += w[4][i * H2 + j] * h2[j];
+        logits[i] = sum;
+    }
+    return static_cast<int>(std::max_element(logits, logits + classes) - logits);
+}
+
+double msSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--dataset") opts.dataset = value();
+        else if (arg == "--labels") opts.labels = value();
+        else if (arg == "--out") opts.out = value();
+        else if (arg == "--epochs") opts.epochs = std::max(1, std::atoi(value()));
+        else if (arg == "--batch") opts.batch = std::max(1, std::atoi(value()));
+        else if (arg == "--lr") opts.lr = std::strtof(value(), nullptr);
+        else if (arg == "--dropout") opts.dropout = std::min(0.9f, std::max(0.0f, std::strtof(value(), nullptr)));
+        else if (arg == "--val") opts.val = std::min(0.9f, std::max(0.0f, std::strtof(value(), nullptr)));
+        else if (arg == "--threads") opts.threads = std::max(0, std::atoi(value()));
+        else if (arg == "--seed") opts.seed = static_cast<uint32_t>(std::strtoul(value(), nullptr, 10));
+        else {
+            std::fprintf(stderr,
+                         "usage: train_mlp [--dataset PATH] [--labels PATH] [--out DIR] [--epochs N] [--batch N] [--lr F]\n"
+                         "                 [--dropout F] [--val F] [--threads N] [--seed N]\n");
+            return 1;
+        }
+    }
+    const int threads = opts.threads > 0 ? opts.threads : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    // 1. 로드 (라벨 순서: --labels 파일 또는 CSV 사전순)
+    const auto loadStart = Clock::now();
+    std::string error;
+    std::vector<std::string> labels;
+    LabeledDataset data;
+    const bool labelsOk = opts.labels.empty() ? loadDatasetLabels(opts.dataset, labels, &error)
+                                              : loadLabelsJson(opts.labels, labels, &error);
+    if (!labelsOk || !loadDatasetCsv(opts.dataset, labels, data, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    const int classes = static_cast<int>(labels.size());
+    if (data.dim != D_IN) {
+        std::fprintf(stderr, "error: dataset has %d features, MLP expects %d\n", data.dim, D_IN);
+        return 1;
+    }
+    if (classes != SignRecognition::numClasses()) {
+        std::fprintf(stderr, "error: dataset has %d classes, SignRecognition expects %d\n", classes, SignRecognition::numClasses());
+        return 1;
+    }
+    if (std::find(data.labels.begin(), data.labels.end(), -1) != data.labels.end()) {
+        std::fprintf(stderr, "error: %s has labels missing from %s\n", opts.dataset.c_str(), opts.labels.c_str());
+        return 1;
+    }
+    const double loadMs = msSince(loadStart);
+
+    // 2. 클래스별 층화 분할
+    std::mt19937 splitRng(opts.seed);
+    std::vector<int> trainRows, valRows;
+    for (int c = 0; c < classes; c++) {
+        std::vector<int> rows;
+        for (size_t r = 0; r < data.size(); r++) {
+            if (data.labels[r] == c) rows.push_back(static_cast<int>(r));
+        }
+        std::shuffle(rows.begin(), rows.end(), splitRng);
+        const size_t valCount = static_cast<size_t>(std::lround(rows.size() * double(opts.val)));
+        valRows.insert(valRows.end(), rows.begin(), rows.begin() + valCount);
+        trainRows.insert(trainRows.end(), rows.begin() + valCount, rows.end());
+    }
+    if (trainRows.empty()) {
+        std::fprintf(stderr, "error: no training rows left after --val %.2f\n", opts.val);
+        return 1;
+    }
+
+    // 3. StandardScaler (학습 행만, 모집단 표준편차, 0이면 1)
+    std::vector<double> mean(D_IN, 0.0), scale(D_IN, 0.0);
+    for (int r : trainRows) {
+        for (int j = 0; j < D_IN; j++) mean[j] += data.row(r)[j];
+    }
+    for (int j = 0; j < D_IN; j++) mean[j] /= trainRows.size();
+    for (int r : trainRows) {
+        for (int j = 0; j < D_IN; j++) scale[j] += (data.row(r)[j] - mean[j]) * (data.row(r)[j] - mean[j]);
+    }
+    for (int j = 0; j < D_IN; j++) {
+        scale[j] = std::sqrt(scale[j] / trainRows.size());
+        if (scale[j] == 0.0) scale[j] = 1.0;
+    }
+    // 표준화된 전체 행 (행 간격 D_PAD, 패딩 열 0)
+    std::vector<float> standardized(data.size() * D_PAD, 0.0f);
+    for (size_t r = 0; r < data.size(); r++) {
+        for (int j = 0; j < D_IN; j++) {
+            standardized[r * D_PAD + j] = static_cast<float>((data.row(r)[j] - mean[j]) / scale[j]);
+        }
+    }
+
+    // 4. 학습
+    Trainer trainer(classes, opts);
+    WorkerPool pool(threads);
+    const int maxShards = (opts.batch + SHARD - 1) / SHARD;
+    std::vector<ShardWork> shards(maxShards);
+    constexpr size_t PARAM_CHUNK = 2048;
+    const int paramChunks = static_cast<int>((PARAMS + PARAM_CHUNK - 1) / PARAM_CHUNK);
+
+    auto loadShard = [&](ShardWork& w, const int* rows, int count) {
+        for (int r = 0; r < count; r++) {
+            std::copy_n(standardized.begin() + static_cast<size_t>(rows[r]) * D_PAD, D_PAD, w.x.begin() + r * D_PAD);
+        }
+    };
+    // 행 목록 전체의 정확도 (드롭아웃 없이, 조각 단위로 나눠 실행)
+    auto evaluate = [&](const std::vector<int>& rows) {
+        if (rows.empty()) return 0.0;
+        std::vector<ShardWork> evalShards(std::min<size_t>(threads, (rows.size() + SHARD - 1) / SHARD));
+        std::vector<int> correct(evalShards.size(), 0);
+        const int total = static_cast<int>((rows.size() + SHARD - 1) / SHARD);
+        const int perJob = (total + static_cast<int>(evalShards.size()) - 1) / static_cast<int>(evalShards.size());
+        pool.run(static_cast<int>(evalShards.size()), [&](int job) {
+            for (int s = job * perJob; s < std::min(total, (job + 1) * perJob); s++) {
+                const int first = s * SHARD;
+                const int count = std::min<int>(SHARD, static_cast<int>(rows.size()) - first);
+                loadShard(evalShards[job], rows.data() + first, count);
+                trainer.forward(evalShards[job], count, false, nullptr, 0);
+                for (int r = 0; r < count; r++) {
+                    const float* z = evalShards[job].logits.data() + r * C_PAD;
+                    correct[job] += std::max_element(z, z + classes) - z == data.labels[rows[first + r]];
+                }
+            }
+        });
+        int sum = 0;
+        for (int c : correct) sum += c;
+        return 100.0 * sum / rows.size();
+    };
+
+    std::printf("%zu rows (%zu train / %zu val), %d classes, %d threads, batch %d, %d epochs\n", data.size(),
+                trainRows.size(), valRows.size(), classes, threads, opts.batch, opts.epochs);
+    std::mt19937 shuffleRng(opts.seed + 1);
+    std::vector<int> order = trainRows;
+    std::vector<int> targets(opts.batch);
+    const auto trainStart = Clock::now();
+    int steps = 0;
+    for (int epoch = 0; epoch < opts.epochs; epoch++) {
+        std::shuffle(order.begin(), order.end(), shuffleRng);
+        double loss = 0.0;
+        int correct = 0;
+        for (size_t first = 0; first < order.size(); first += opts.batch) {
+            const int batchRows = static_cast<int>(std::min<size_t>(opts.batch, order.size() - first));
+            const int shardCount = (batchRows + SHARD - 1) / SHARD;
+            const float inverseBatch = 1.0f / batchRows;
+            for (int r = 0; r < batchRows; r++) targets[r] = data.labels[order[first + r]];
+
+            pool.run(shardCount, [&](int s) {
+                const int offset = s * SHARD;
+                const int count = std::min(SHARD, batchRows - offset);
+                loadShard(shards[s], order.data() + first + offset, count);
+                trainer.backward(shards[s], count, order.data() + first + offset, targets.data() + offset, epoch, inverseBatch);
+            });
+            trainer.beginStep();
+            pool.run(paramChunks, [&](int chunk) {
+                trainer.adamStep(shards, shardCount, chunk * PARAM_CHUNK, std::min(PARAMS, (chunk + 1) * PARAM_CHUNK));
+            });
+            trainer.refreshBackwardWeights();
+            for (int s = 0; s < shardCount; s++) {
+                loss += shards[s].loss;
+                correct += shards[s].correct;
+            }
+            steps++;
+        }
+        if (epoch == 0 || (epoch + 1) % 10 == 0 || epoch + 1 == opts.epochs) {
+            std::printf("epoch %3d  loss %.4f  train acc %.2f%% (dropout)  val acc %.2f%%\n", epoch + 1, loss / order.size(),
+                        100.0 * correct / order.size(), evaluate(valRows));
+        }
+    }
+    const double trainMs = msSince(trainStart);
+    const double trainAccuracy = evaluate(trainRows);
+    const double valAccuracy = evaluate(valRows);
+    std::printf("load %.1f ms, train %.1f ms (%d steps, %.1f us/step, %.0f rows/s)\n", loadMs, trainMs, steps,
+                1000.0 * trainMs / steps, 1000.0 * opts.epochs * order.size() / trainMs);
+    std::printf("final accuracy: train %.2f%%, val %.2f%%\n", trainAccuracy, valAccuracy);
+
+    // 5. 내보내기
+    std::error_code dirError;
+    std::filesystem::create_directories(opts.out, dirError);
+    if (!writeModel(opts.out, trainer, classes, mean, scale, labels)) {
+        std::fprintf(stderr, "error: cannot write model files to %s\n", opts.out.c_str());
+        return 1;
+    }
+    std::printf("wrote %s/{gesture_weights.h, scaler.json, labels.json}\n", opts.out.c_str());
+
+    // 6. 내보낸 파일로 다시 예측 (SignRecognition이 읽는 형식 그대로)
+    std::vector<float> weights[6];
+    std::vector<float> exportedMean, exportedScale;
+    std::vector<std::string> exportedLabels;
+    std::ifstream header(opts.out + "/gesture_weights.h");
+    std::stringstream headerText;
+    headerText << header.rdbuf();
+    const char* names[6] = {"W1", "B1", "W2", "B2", "W3", "B3"};
+    const size_t sizes[6] = {size_t(H1) * D_IN, size_t(H1), size_t(H2) * H1, size_t(H2), size_t(classes) * H2, size_t(classes)};
+    for (int k = 0; k < 6; k++) {
+        if (!parseHeaderArray(headerText.str(), names[k], sizes[k], weights[k])) {
+            std::fprintf(stderr, "error: cannot read %s back from gesture_weights.h\n", names[k]);
+            return 1;
+        }
+    }
+    if (!loadScalerJson(opts.out + "/scaler.json", exportedMean, exportedScale, &error) ||
+        !loadLabelsJson(opts.out + "/labels.json", exportedLabels, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    std::vector<int> allRows(data.size());
+    for (size_t r = 0; r < data.size(); r++) allRows[r] = static_cast<int>(r);
+    ShardWork check;
+    int agree = 0;
+    float x[D_IN];
+    for (size_t first = 0; first < data.size(); first += SHARD) {
+        const int count = static_cast<int>(std::min<size_t>(SHARD, data.size() - first));
+        loadShard(check, allRows.data() + first, count);
+        trainer.forward(check, count, false, nullptr, 0);
+        for (int r = 0; r < count; r++) {
+            const float* row = data.row(first + r);
+            for (int j = 0; j < D_IN; j++) x[j] = (row[j] - exportedMean[j]) / exportedScale[j];
+            const float* z = check.logits.data() + r * C_PAD;
+            agree += predictExported(weights, classes, x) == std::max_element(z, z + classes) - z;
+        }
+    }
+    const bool ok = agree == static_cast<int>(data.size()) && exportedLabels == labels;
+    std::printf("exported model vs trainer predictions: %d/%zu agree\n", agree, data.size());
+    std::printf("\n%s\n", ok ? "OK: exported model reproduces trainer predictions" : "FAILED: exported model differs from trainer");
+    return ok ? 0 : 2;
+}
@@ -0,0 +1,202 @@
+/**
+ * 두 손 동시 인식 검증/벤치마크 (네이티브 전용)
+ *
+ *   make twohand
+ *   ./build/native/two_hand_bench --repeat 50
+ *
+ * 데이터셋 프레임(왼손 0..62, 오른손 63..125열, 좌표가 모두 0이면 손 없음)마다
+ * 1) 따로: 손마다 recognize 한 번씩 (두 손이면 두 번)
+ * 2) 함께: recognizeTwoHands 한 번 (SoA 한 패스)
+ * 3) 스테이징: recognizeStagedTwoHands (x, y만, z = 0)
+ * 4) 신경망: 두 손 프레임의 특징(과 은닉층이 0이 되지 않는 합성 입력)에서 neuralNetworkInferencePair 출력이
+ *    neuralNetworkInference 두 번과 비트 단위로 같은지 (비공개 단계라 recognizer_internals.h로 호출)
+ * 손별 결과(id, 신뢰도)가 따로 실행과 하나라도 다르거나 조합 라벨이 combineHands와 다르거나
+ * 신경망 출력이 다르면 종료 코드 2
+ * 두 손 프레임 기준 프레임당 시간과 속도 향상을 출력
+ */
+
+#include "dataset_io.h"
+#include "recognizer_internals.h"
+#include "sign_recognition.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string dataset = "../notebooks/sign_dataset.csv";
+    std::string labels = "../public/models/labels.json";
+    int repeat = 50;
+};
+
+// 손 좌표 63개 → 랜드마크 (모두 0이면 빈 벡터 = 손 없음)
+std::vector<HandLandmark> toHand(const float* hand, bool keepZ) {
+    if (!std::any_of(hand, hand + 63, [](float v) { return v != 0.0f; })) return {};
+    std::vector<HandLandmark> landmarks(21);
+    for (int i = 0; i < 21; i++) landmarks[i] = HandLandmark{hand[i * 3], hand[i * 3 + 1], keepZ ? hand[i * 3 + 2] : 0.0f};
+    return landmarks;
+}
+
+bool same(const RecognitionResult& a, const RecognitionResult& b) {
+    return a.id == b.id && a.confidence == b.confidence;
+}
+
+template <typename F>
+double usPerFrame(int repeat, size_t frames, F&& fn) {
+    fn();  // 워밍업
+    auto start = Clock::now();
+    for (int r = 0; r < repeat; r++) fn();
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / (double(repeat) * frames);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--dataset") opts.dataset = value();
+        else if (arg == "--labels") opts.labels = value();
+        else if (arg == "--repeat") opts.repeat = std::max(1, std::atoi(value()));
+        else {
+            std::fprintf(stderr, "usage: two_hand_bench [--repeat N] [--dataset PATH] [--labels PATH]\n");
+            return 1;
+        }
+    }
+
+    std::string error;
+    std::vector<std::string> labels;
+    LabeledDataset data;
+    if (!loadLabelsJson(opts.labels, labels, &error) || !loadDatasetCsv(opts.dataset, labels, data, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+
+    SignRecognizer single;  // 손마다 따로 (기준)
+    SignRecognizer paired;  // 두 손 함께
+    single.initialize();
+    paired.initialize();
+
+    const size_t frames = data.size();
+    std::vector<std::vector<HandLandmark>> left(frames), right(frames);
+    std::vector<size_t> bothHands;
+    for (size_t r = 0; r < frames; r++) {
+        left[r] = toHand(data.row(r), true);
+        right[r] = toHand(data.row(r) + 63, true);
+        if (!left[r].empty() && !right[r].empty()) bothHands.push_back(r);
+    }
+    std::printf("%zu frames (%zu with both hands) x %d repeats\n\n", frames, bothHands.size(), opts.repeat);
+
+    const RecognitionResult none = {"감지되지 않음", 0.0f, 0};
+    int mismatches = 0;
+    auto report = [&mismatches](const char* path, size_t frame, const char* part, const RecognitionResult& expected,
+                                const RecognitionResult& actual) {
+        if (mismatches++ < 5) {
+            std::printf("mismatch %s frame %zu %s: expected (%d, %.6f) got (%d, %.6f)\n", path, frame, part, expected.id,
+                        expected.confidence, actual.id, actual.confidence);
+        }
+    };
+
+    // 1. recognizeTwoHands vs 손마다 recognize
+    for (size_t r = 0; r < frames; r++) {
+        RecognitionResult expectedLeft = left[r].empty() ? none : single.recognize(left[r]);
+        RecognitionResult expectedRight = right[r].empty() ? none : single.recognize(right[r]);
+        TwoHandResult result = paired.recognizeTwoHands(left[r], right[r]);
+        RecognitionResult expectedCombined = SignRecognizer::combineHands(expectedLeft, expectedRight);
+        if (!same(expectedLeft, result.left)) report("vector", r, "left", expectedLeft, result.left);
+        if (!same(expectedRight, result.right)) report("vector", r, "right", expectedRight, result.right);
+        if (!same(expectedCombined, result.combined)) report("vector", r, "combined", expectedCombined, result.combined);
+    }
+
+    // 2. 스테이징 (x, y만 기록, 손 없으면 좌표 0)
+    float* input = paired.getInputBuffer();
+    const float* output = paired.getOutputBuffer();
+    for (size_t first = 0; first < frames; first += SignRecognizer::MAX_TWO_HAND_FRAMES) {
+        const int count = static_cast<int>(std::min<size_t>(SignRecognizer::MAX_TWO_HAND_FRAMES, frames - first));
+        for (int f = 0; f < count; f++) {
+            const float* row = data.row(first + f);
+            float* dst = input + f * SignRecognizer::TWO_HAND_FLOATS_PER_FRAME;
+            for (int h = 0; h < 2; h++) {
+                for (int i = 0; i < 21; i++) {
+                    dst[h * SignRecognizer::FLOATS_PER_FRAME + i * 2] = row[h * 63 + i * 3];
+                    dst[h * SignRecognizer::FLOATS_PER_FRAME + i * 2 + 1] = row[h * 63 + i * 3 + 1];
+                }
+            }
+        }
+        paired.recognizeStagedTwoHands(count);
+        for (int f = 0; f < count; f++) {
+            const size_t r = first + f;
+            std::vector<HandLandmark> hands[2] = {toHand(data.row(r), false), toHand(data.row(r) + 63, false)};
+            RecognitionResult expected[3];
+            for (int h = 0; h < 2; h++) expected[h] = hands[h].empty() ? none : single.recognize(hands[h]);
+            expected[2] = SignRecognizer::combineHands(expected[0], expected[1]);
+            const char* parts[3] = {"left", "right", "combined"};
+            for (int p = 0; p < 3; p++) {
+                const float* out = output + f * SignRecognizer::TWO_HAND_RESULT_FLOATS + p * 2;
+                RecognitionResult actual = {"", out[1], static_cast<int>(out[0])};
+                if (!same(expected[p], actual)) report("staged", r, parts[p], expected[p], actual);
+            }
+        }
+    }
+
+    // 3. 신경망 한 패스 두 손 vs 한 손씩 두 번 (출력 점수 비트 비교)
+    //    데이터셋 특징은 표준화 값이라 첫 층 ReLU가 모두 0이 될 수 있어, 양수로 옮긴 합성 입력도 함께 확인
+    constexpr int F = SignRecognizerInternals::COMPLEX_FEATURES;
+    int pairDiffers = 0, pairChecked = 0, pairNonZero = 0;
+    auto checkPair = [&](const float* a, const float* b) {
+        float pairOut[2][SignModel::OUTPUT_SIZE];
+        SignRecognizerInternals::neuralNetworkInferencePair(paired, a, b, F, pairOut[0], pairOut[1]);
+        const std::vector<float> first = SignRecognizerInternals::neuralNetworkInference(single, a, F);
+        const std::vector<float> second = SignRecognizerInternals::neuralNetworkInference(single, b, F);
+        pairDiffers += std::memcmp(first.data(), pairOut[0], sizeof(pairOut[0])) != 0 ||
+                       std::memcmp(second.data(), pairOut[1], sizeof(pairOut[1])) != 0;
+        pairNonZero += std::any_of(first.begin(), first.end(), [](float v) { return v != 0.0f; });
+        pairChecked++;
+    };
+    for (size_t r : bothHands) {
+        const std::vector<float> a = SignRecognizerInternals::extractComplexFeatures(single, left[r]);
+        const std::vector<float> b = SignRecognizerInternals::extractComplexFeatures(single, right[r]);
+        checkPair(a.data(), b.data());
+    }
+    std::vector<float> synthetic[2];
+    for (int k = 0; k < 64; k++) {
+        for (int h = 0; h < 2; h++) {
+            synthetic[h].resize(F);
+            for (int i = 0; i < F; i++) {
+                synthetic[h][i] = 0.25f + static_cast<float>((k * 131 + h * 71 + i * 37) % 101) / 101.0f;
+            }
+        }
+        checkPair(synthetic[0].data(), synthetic[1].data());
+    }
+    std::printf("network pair vs two single passes: %d/%d differ (%d with non-zero scores)\n\n", pairDiffers, pairChecked,
+                pairNonZero);
+
+    // 4. 두 손 프레임 시간 (따로 두 번 vs 함께 한 번)
+    const size_t timed = std::max<size_t>(1, bothHands.size());
+    double separateUs = usPerFrame(opts.repeat, timed, [&] {
+        for (size_t r : bothHands) {
+            single.recognize(left[r]);
+            single.recognize(right[r]);
+        }
+    });
+    double pairedUs = usPerFrame(opts.repeat, timed, [&] {
+        for (size_t r : bothHands) paired.recognizeTwoHands(left[r], right[r]);
+    });
+
+    std::printf("%-32s %10s\n", "path (two-hand frames)", "us/frame");
+    std::printf("%-32s %10.2f\n", "recognize x 2", separateUs);
+    std::printf("%-32s %10.2f  (%.2fx)\n", "recognizeTwoHands", pairedUs, separateUs / pairedUs);
+
+    bool ok = mismatches == 0 && pairDiffers == 0 && pairNonZero > 0;
+    std::printf("\n%s\n", ok ? "OK: two-hand results identical to per-hand recognize" : "FAILED: results differ");
+    return ok ? 0 : 2;
+}
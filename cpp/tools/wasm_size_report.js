@@ -0,0 +1,163 @@
+#!/usr/bin/env node
+/**
+ * WASM 모듈별 다운로드 크기 + 컴파일/인스턴스화 시간 보고 (Node.js, make size-report)
+ *
+ *   node tools/wasm_size_report.js build build/aux [--runs 10]
+ *
+ * 각 디렉토리의 *.wasm (짝이 되는 Emscripten *.js 포함)에 대해:
+ * - 크기: wasm + js 원본, gzip -9, brotli (전송 압축 기준 다운로드 크기)
+ * - compile: WebAssembly.compile() 시간 (첫 실행 / 중앙값)
+ * - instantiate: MODULARIZE 팩토리 호출 → Promise 완료까지 (컴파일 + 인스턴스화 + 런타임 초기화,
+ *   wasmBinary로 바이트를 넘겨 로더의 fetch/환경 분기와 무관하게 측정)
+ * - first: 코어 모듈이면 인스턴스화 후 SignRecognizer 생성 + 첫 recognizeStaged(1)까지
+ * 브라우저 캐시/네트워크는 포함하지 않으므로 모듈 간 상대 비교용
+ */
+
+const fs = require("fs");
+const path = require("path");
+const zlib = require("zlib");
+
+function parseArgs(argv) {
+  const dirs = [];
+  let runs = 10;
+  for (let i = 0; i < argv.length; i++) {
+    if (argv[i] === "--runs") runs = Math.max(1, parseInt(argv[++i], 10) || 1);
+    else dirs.push(argv[i]);
+  }
+  return { dirs: dirs.length ? dirs : ["build", "build/aux"], runs };
+}
+
+function median(values) {
+  const sorted = [...values].sort((a, b) => a - b);
+  return sorted[Math.floor(sorted.length / 2)];
+}
+
+function compressedSizes(buffers) {
+  let gzip = 0;
+  let brotli = 0;
+  for (const buf of buffers) {
+    gzip += zlib.gzipSync(buf, { level: 9 }).length;
+    brotli += zlib.brotliCompressSync(buf, {
+      params: { [zlib.constants.BROTLI_PARAM_QUALITY]: 11 },
+    }).length;
+  }
+  return { gzip, brotli };
+}
+
+async function timeCompile(bytes, runs) {
+  const samples = [];
+  for (let i = 0; i < runs; i++) {
+    const start = process.hrtime.bigint();
+    await WebAssembly.compile(bytes);
+    samples.push(Number(process.hrtime.bigint() - start) / 1e6);
+  }
+  return { first: samples[0], median: median(samples) };
+}
+
+// 코어 모듈: 스테이징 버퍼 경로로 첫 인식 한 번 (0으로 채운 프레임, 결과는 보지 않음)
+function firstRecognition(module) {
+  if (!module.SignRecognizer) return null;
+  const start = process.hrtime.bigint();
+  const recognizer = new module.SignRecognizer();
+  recognizer.initialize();
+  if (recognizer.recognizeStaged) recognizer.recognizeStaged(1);
+  const elapsed = Number(process.hrtime.bigint() - start) / 1e6;
+  recognizer.delete();
+  return elapsed;
+}
+
+async function timeInstantiate(jsPath, wasm, runs) {
+  let factory;
+  try {
+    factory = require(path.resolve(jsPath));
+  } catch (err) {
+    return { error: `require failed: ${err.message}` };
+  }
+  if (typeof factory !== "function") return { error: "no MODULARIZE factory export" };
+
+  const samples = [];
+  let first = null;
+  for (let i = 0; i < runs; i++) {
+    const start = process.hrtime.bigint();
+    let module;
+    try {
+      module = await factory({ wasmBinary: wasm, print: () => {}, printErr: () => {} });
+    } catch (err) {
+      return { error: `instantiate failed: ${err.message || err}` };
+    }
+    samples.push(Number(process.hrtime.bigint() - start) / 1e6);
+    if (i === 0) first = firstRecognition(module);
+  }
+  return { first: samples[0], median: median(samples), recognition: first };
+}
+
+function kb(bytes) {
+  return (bytes / 1024).toFixed(1);
+}
+
+function ms(value) {
+  return value === null || value === undefined ? "-" : value.toFixed(2);
+}
+
+async function main() {
+  const { dirs, runs } = parseArgs(process.argv.slice(2));
+  const rows = [];
+  for (const dir of dirs) {
+    if (!fs.existsSync(dir)) {
+      console.error(`skip: ${dir} (not built)`);
+      continue;
+    }
+    for (const name of fs.readdirSync(dir).sort()) {
+      if (!name.endsWith(".wasm")) continue;
+      const wasmPath = path.join(dir, name);
+      const jsPath = wasmPath.replace(/\.wasm$/, ".js");
+      const wasm = fs.readFileSync(wasmPath);
+      const js = fs.existsSync(jsPath) ? fs.readFileSync(jsPath) : Buffer.alloc(0);
+      const sizes = compressedSizes([wasm, js]);
+      const compile = await timeCompile(wasm, runs);
+      const inst = js.length ? await timeInstantiate(jsPath, wasm, runs) : { error: "no js loader" };
+      rows.push({ name: path.join(dir, name), raw: wasm.length + js.length, ...sizes, compile, inst });
+    }
+  }
+  if (!rows.length) {
+    console.error("error: no .wasm files found (run make build aux first)");
+    process.exit(1);
+  }
+
+  console.log(`runs=${runs} (first / median, ms)`);
+  console.log(
+    "module".padEnd(32) +
+      "rawKB".padStart(9) +
+      "gzipKB".padStart(9) +
+      "brKB".padStart(9) +
+      "compile".padStart(16) +
+      "instantiate".padStart(16) +
+      "first".padStart(9)
+  );
+  let total = { raw: 0, gzip: 0, brotli: 0 };
+  for (const row of rows) {
+    total.raw += row.raw;
+    total.gzip += row.gzip;
+    total.brotli += row.brotli;
+    const inst = row.inst.error
+      ? row.inst.error
+      : `${ms(row.inst.first)}/${ms(row.inst.median)}`.padStart(16) + ms(row.inst.recognition).padStart(9);
+    console.log(
+      row.name.padEnd(32) +
+        kb(row.raw).padStart(9) +
+        kb(row.gzip).padStart(9) +
+        kb(row.brotli).padStart(9) +
+        `${ms(row.compile.first)}/${ms(row.compile.median)}`.padStart(16) +
+        (row.inst.error ? "  " : "") +
+        inst
+    );
+  }
+  console.log(
+    "total".padEnd(32) + kb(total.raw).padStart(9) + kb(total.gzip).padStart(9) + kb(total.brotli).padStart(9)
+  );
+}
+
+main().catch((err) => {
+  console.error(err);
+  process.exit(1);
+});
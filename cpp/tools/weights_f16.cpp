@@ -0,0 +1,181 @@
+/**
+ * MLP 가중치 FP16 변환기 + fp32 대비 정합성 검사 (네이티브 전용)
+ *
+ *   make weights-f16                                   # src/gesture_weights_f16.h 재생성
+ *   ./build/native/weights_f16 --check                 # fp32 경로와 로짓/예측 비교
+ *
+ * --emit: gesture_weights.h의 W1/W2/W3를 half(uint16_t)로, B1/B2/B3는 fp32 그대로 기록
+ *         (SIGN_WEIGHTS_FP16 빌드에서 sign_recognition.cpp가 포함)
+ * --check: 데이터셋 전체를 fp32 가중치와 half 가중치(커널 안에서 확장)로 각각 추론해
+ *          최대 가중치 오차, 최대 로짓 차이, 예측 일치율을 출력 (예측이 하나라도 다르면 종료 코드 2)
+ */
+
+#include "dataset_io.h"
+#include "gesture_weights.h"
+#include "half_float.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int D_IN = 126;
+constexpr int H1 = sizeof(B1) / sizeof(float);
+constexpr int H2 = sizeof(B2) / sizeof(float);
+constexpr int NUM_CLASSES = sizeof(B3) / sizeof(float);
+static_assert(sizeof(W1) / sizeof(float) == static_cast<size_t>(H1) * D_IN, "W1 shape");
+static_assert(sizeof(W2) / sizeof(float) == static_cast<size_t>(H2) * H1, "W2 shape");
+static_assert(sizeof(W3) / sizeof(float) == static_cast<size_t>(NUM_CLASSES) * H2, "W3 shape");
+
+std::vector<uint16_t> toHalf(const float* src, size_t count) {
+    std::vector<uint16_t> out(count);
+    for (size_t i = 0; i < count; i++) out[i] = floatToHalf(src[i]);
+    return out;
+}
+
+void writeHalfArray(FILE* out, const char* name, const std::vector<uint16_t>& values) {
+    std::fprintf(out, "static const uint16_t %s[] = {", name);
+    for (size_t i = 0; i < values.size(); i++) std::fprintf(out, "%s0x%04x", i ? ", " : "", values[i]);
+    std::fprintf(out, "};\n");
+}
+
+void writeFloatArray(FILE* out, const char* name, const float* values, size_t count) {
+    std::fprintf(out, "static const float %s[] = {", name);
+    for (size_t i = 0; i < count; i++) std::fprintf(out, "%s%.8ff", i ? ", " : "", values[i]);
+    std::fprintf(out, "};\n");
+}
+
+bool emitHeader(const std::string& path) {
+    FILE* out = std::fopen(path.c_str(), "w");
+    if (!out) return false;
+    std::fprintf(out, "// 자동 생성: tools/weights_f16.cpp (make weights-f16), 직접 수정하지 말 것\n");
+    std::fprintf(out, "// W1/W2/W3: IEEE half (uint16_t), B1/B2/B3: fp32\n");
+    std::fprintf(out, "#include <cstdint>\n");
+    writeHalfArray(out, "W1", toHalf(W1, sizeof(W1) / sizeof(float)));
+    writeFloatArray(out, "B1", B1, H1);
+    writeHalfArray(out, "W2", toHalf(W2, sizeof(W2) / sizeof(float)));
+    writeFloatArray(out, "B2", B2, H2);
+    writeHalfArray(out, "W3", toHalf(W3, sizeof(W3) / sizeof(float)));
+    writeFloatArray(out, "B3", B3, NUM_CLASSES);
+    return std::fclose(out) == 0;
+}
+
+// 기준 fp32 순전파 (SignRecognition::predictMLP와 같은 순서의 스칼라 누산)
+void forwardF32(const float* x, float* logits) {
+    float h1[H1], h2[H2];
+    for (int i = 0; i < H1; i++) {
+        float sum = B1[i];
+        for (int j = 0; j < D_IN; j++) sum += W1[i * D_IN + j] * x[j];
+        h1[i] = std::max(sum, 0.f);
+    }
+    for (int i = 0; i < H2; i++) {
+        float sum = B2[i];
+        for (int j = 0; j < H1; j++) sum += W2[i * H1 + j] * h1[j];
+        h2[i] = std::max(sum, 0.f);
+    }
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        float sum = B3[i];
+        for (int j = 0; j < H2; j++) sum += W3[i * H2 + j] * h2[j];
+        logits[i] = sum;
+    }
+}
+
+// half 가중치 순전파 (SIGN_WEIGHTS_FP16 빌드의 커널과 같은 dotHalf 사용)
+void forwardF16(const uint16_t* w1, const uint16_t* w2, const uint16_t* w3, const float* x, float* logits) {
+    alignas(32) float h1[H1];
+    alignas(32) float h2[H2];
+    for (int i = 0; i < H1; i++) h1[i] = std::max(B1[i] + dotHalf(w1 + i * D_IN, x, D_IN), 0.f);
+    for (int i = 0; i < H2; i++) h2[i] = std::max(B2[i] + dotHalf(w2 + i * H1, h1, H1), 0.f);
+    for (int i = 0; i < NUM_CLASSES; i++) logits[i] = B3[i] + dotHalf(w3 + i * H2, h2, H2);
+}
+
+int argmax(const float* v, int n) {
+    return static_cast<int>(std::max_element(v, v + n) - v);
+}
+
+double maxWeightError(const float* src, const std::vector<uint16_t>& half) {
+    double worst = 0.0;
+    for (size_t i = 0; i < half.size(); i++) worst = std::max(worst, std::fabs(double(src[i]) - halfToFloat(half[i])));
+    return worst;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::string emitPath;
+    bool check = false;
+    std::string dataset = "../notebooks/sign_dataset.csv";
+    std::string scaler = "../public/models/scaler.json";
+    std::string labels = "../public/models/labels.json";
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--emit") emitPath = value();
+        else if (arg == "--check") check = true;
+        else if (arg == "--dataset") dataset = value();
+        else if (arg == "--scaler") scaler = value();
+        else if (arg == "--labels") labels = value();
+        else {
+            std::fprintf(stderr, "usage: weights_f16 [--emit PATH] [--check [--dataset PATH] [--scaler PATH] [--labels PATH]]\n");
+            return 1;
+        }
+    }
+    if (emitPath.empty() && !check) check = true;
+
+    if (!emitPath.empty()) {
+        if (!emitHeader(emitPath)) {
+            std::fprintf(stderr, "error: cannot write %s\n", emitPath.c_str());
+            return 1;
+        }
+        size_t weights = sizeof(W1) / sizeof(float) + sizeof(W2) / sizeof(float) + sizeof(W3) / sizeof(float);
+        std::printf("wrote %s (%zu weights: %zu -> %zu bytes)\n", emitPath.c_str(), weights, weights * sizeof(float),
+                    weights * sizeof(uint16_t));
+    }
+    if (!check) return 0;
+
+    std::string error;
+    std::vector<std::string> labelNames;
+    std::vector<float> mean, scale;
+    LabeledDataset data;
+    if (!loadLabelsJson(labels, labelNames, &error) || !loadScalerJson(scaler, mean, scale, &error) ||
+        !loadDatasetCsv(dataset, labelNames, data, &error)) {
+        std::fprintf(stderr, "error: %s\n", error.c_str());
+        return 1;
+    }
+    if (data.dim != D_IN) {
+        std::fprintf(stderr, "error: dataset has %d features, MLP expects %d\n", data.dim, D_IN);
+        return 1;
+    }
+
+    std::vector<uint16_t> w1 = toHalf(W1, sizeof(W1) / sizeof(float));
+    std::vector<uint16_t> w2 = toHalf(W2, sizeof(W2) / sizeof(float));
+    std::vector<uint16_t> w3 = toHalf(W3, sizeof(W3) / sizeof(float));
+
+    double maxLogitDiff = 0.0;
+    size_t agree = 0, correct32 = 0, correct16 = 0;
+    alignas(32) float x[D_IN];
+    for (size_t r = 0; r < data.size(); r++) {
+        const float* row = data.row(r);
+        for (int j = 0; j < D_IN; j++) x[j] = (row[j] - mean[j]) / scale[j];
+        float ref[NUM_CLASSES], half[NUM_CLASSES];
+        forwardF32(x, ref);
+        forwardF16(w1.data(), w2.data(), w3.data(), x, half);
+        for (int c = 0; c < NUM_CLASSES; c++) maxLogitDiff = std::max(maxLogitDiff, std::fabs(double(ref[c]) - half[c]));
+        int p32 = argmax(ref, NUM_CLASSES), p16 = argmax(half, NUM_CLASSES);
+        agree += p32 == p16;
+        correct32 += p32 == data.labels[r];
+        correct16 += p16 == data.labels[r];
+    }
+
+    std::printf("max |w - half(w)|: W1 %.3g, W2 %.3g, W3 %.3g\n", maxWeightError(W1, w1), maxWeightError(W2, w2),
+                maxWeightError(W3, w3));
+    std::printf("frames: %zu, max logit diff: %.3g, prediction agreement: %zu/%zu\n", data.size(), maxLogitDiff, agree,
+                data.size());
+    std::printf("accuracy: fp32 %.2f%%, fp16 %.2f%%\n", 100.0 * correct32 / data.size(), 100.0 * correct16 / data.size());
+    return agree == data.size() ? 0 : 2;
+}